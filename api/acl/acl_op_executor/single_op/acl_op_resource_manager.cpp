@@ -17,7 +17,9 @@
 #include "common/log_inner.h"
 #include "common/common_inner.h"
 #include "common/acl_json_parser.h"
+#include "common/prof_api_reg.h"
 #include "single_op/op_model_parser.h"
+#include "single_op/op_model_match_cache.h"
 #include "single_op/shape_range_utils.h"
 #include "single_op/executor/acl_stream_executor.h"
 #include "single_op/compile/op_compile_service.h"
@@ -35,10 +37,18 @@ constexpr int32_t OM_FILE_SUFFIX_LEN = 3;
 constexpr int32_t OM_DIR_MAX_DEPTH = 3;
 constexpr int32_t DECIMAL = 10;
 const std::string ACL_MAX_OPQUEUE_NUM = "max_opqueue_num";
+const std::string ACL_OP_RESOURCE_POOL_SIZE = "op_resource_pool_size";
+
+void ReportOpModelMapStats() {
+  const AclOpMapStats stats = AclOpResourceManager::GetInstance().GetOpModelMapStats();
+  ACL_LOG_EVENT("[Report][OpModelMap]hit = %lu, miss = %lu, eviction = %lu, entry = %lu", stats.hitCount,
+                stats.missCount, stats.evictionCount, stats.entryCount);
+}
 }  // namespace
 
 AclOpResourceManager::AclOpResourceManager() {
   GetRuntimeV2Env();
+  RegisterProfStopHook(&ReportOpModelMapStats);
 }
 
 void AclOpResourceManager::GetRuntimeV2Env() {
@@ -116,6 +126,35 @@ aclError AclOpResourceManager::HandleMaxOpQueueConfig(const char_t *const config
   return ACL_SUCCESS;
 }
 
+aclError AclOpResourceManager::HandleOpResourcePoolConfig(const char_t *const configBuffer) {
+  ACL_LOG_INFO("start to execute HandleOpResourcePoolConfig");
+  std::string poolSizeStr;
+  bool found = false;
+  const aclError ret =
+      acl::JsonParser::GetJsonCtxByKeyFromBuffer(configBuffer, poolSizeStr, ACL_OP_RESOURCE_POOL_SIZE, found);
+  if (ret != ACL_SUCCESS) {
+    ACL_LOG_INNER_ERROR("[Parse][Config]parse op_resource_pool_size config from buffer failed, errorCode = %d", ret);
+    return ret;
+  }
+  if (!found) {
+    ACL_LOG_INFO("no op_resource_pool_size found, op resource pool is disabled.");
+    return ACL_SUCCESS;
+  }
+  StringUtils::Strip(poolSizeStr, "\"");
+  char_t *endPtr = nullptr;
+  const int64_t poolSize = strtol(poolSizeStr.c_str(), &endPtr, DECIMAL);
+  if ((poolSizeStr.empty()) || (endPtr == nullptr) || (*endPtr != '\0') || (poolSize < 0)) {
+    ACL_LOG_INNER_ERROR(
+        "[Check][PoolSize]op_resource_pool_size [%s] is invalid from buffer, "
+        "it should be a non-negative integer.",
+        poolSizeStr.c_str());
+    return ACL_ERROR_INVALID_PARAM;
+  }
+  ACL_LOG_INFO("op_resource_pool_size is set [%ld].", poolSize);
+  ge::GeExecutor::SetSingleOpResourcePoolSize(static_cast<size_t>(poolSize));
+  return ACL_SUCCESS;
+}
+
 bool AclOpResourceManager::OmFileFilterFn(const std::string &fileName) {
   const auto pos = fileName.rfind(".om");
   if (pos == std::string::npos) {
@@ -279,6 +318,8 @@ aclError AclOpResourceManager::RegisterModel(OpModelDef &&modelConfig, ModelMap
     ACL_LOG_INFO("Insert modeldef to hash map");
     ACL_REQUIRES_OK(opModelDefs.Insert(aclOp, modelDefPtr, agingModelDef, isRegistered));
   }
+  // 新注册的模型可能改变已有签名的匹配结果(如动态模型优先匹配)
+  OpModelMatchCache::Invalidate();
 
   if (agingModelDef != nullptr) {
     ACL_REQUIRES_OK(modelCache_.Delete(*agingModelDef, isDynamic));
@@ -357,9 +398,8 @@ aclError AclOpResourceManager::GetOpModel(AclOp &aclOp) {
 }
 
 aclError AclOpResourceManager::MatchStaticOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic,
-                                                  bool &isNeedMatchDymaic) {
+                                                  bool &isNeedMatchDymaic, std::shared_ptr<OpModelDef> &modelDef) {
   RT2_PROFILING_SCOPE(gert::profiling::kUnknownName, gert::profiling::kAclMatchStaticOpModel);
-  std::shared_ptr<OpModelDef> modelDef;
   aclError ret = ACL_SUCCESS;
   isNeedMatchDymaic = false;
   bool isExistConst = false;
@@ -398,9 +438,9 @@ aclError AclOpResourceManager::MatchStaticOpModel(const AclOp &aclOp, OpModel &o
   return ret;
 }
 
-aclError AclOpResourceManager::MatchDynamicOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic) {
+aclError AclOpResourceManager::MatchDynamicOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic,
+                                                   std::shared_ptr<OpModelDef> &modelDef) {
   RT2_PROFILING_SCOPE(gert::profiling::kUnknownName, gert::profiling::kAclMatchDynamicOpModel);
-  std::shared_ptr<OpModelDef> modelDef;
   aclError ret = ACL_SUCCESS;
   // check the input shape must be static when executing
   if (!aclOp.isCompile) {
@@ -455,19 +495,37 @@ aclError AclOpResourceManager::MatchOpModel(const AclOp &aclOp, OpModel &opModel
   aclError ret;
   RT2_PROFILING_SCOPE(gert::profiling::kUnknownName, gert::profiling::kAclMatchOpModel);
   aclOp.BackupConst();
-  if ((GetGlobalJitCompileFlag() == 0) || (GetGlobalCompileFlag() == 1)) {
-    ret = MatchDynamicOpModel(aclOp, opModel, isDynamic);
+  const bool isMatchDynamicFirst = (GetGlobalJitCompileFlag() == 0) || (GetGlobalCompileFlag() == 1);
+  const int32_t matchMode = isMatchDynamicFirst ? 1 : 0;
+  const bool isCacheable = OpModelMatchCache::IsEnable() && OpModelMatchCache::IsCacheable(aclOp);
+  std::shared_ptr<OpModelDef> modelDef;
+  if (isCacheable && OpModelMatchCache::Lookup(aclOp, matchMode, opModel, isDynamic, modelDef)) {
+    // 静态加载的模型不老化，无需加锁刷新时间戳
+    if ((modelDef != nullptr) && (modelDef->timestamp != static_cast<uint64_t>(ULLONG_MAX))) {
+      opModels_.UpdateTimestamp(modelDef);
+    }
+    return ACL_SUCCESS;
+  }
+  // 代数需在匹配前读取，匹配过程中发生的模型变更会使本次缓存的结果失效
+  const uint64_t generation = OpModelMatchCache::GetGeneration();
+  if (isMatchDynamicFirst) {
+    ret = MatchDynamicOpModel(aclOp, opModel, isDynamic, modelDef);
     if (ret != ACL_SUCCESS) {
       bool isNeedMatchDymaic = false;
-      ret = MatchStaticOpModel(aclOp, opModel, isDynamic, isNeedMatchDymaic);
+      ret = MatchStaticOpModel(aclOp, opModel, isDynamic, isNeedMatchDymaic, modelDef);
     }
   } else {
     bool isNeedMatchDymaic = false;
-    ret = MatchStaticOpModel(aclOp, opModel, isDynamic, isNeedMatchDymaic);
-    if (!isNeedMatchDymaic) {
+    ret = MatchStaticOpModel(aclOp, opModel, isDynamic, isNeedMatchDymaic, modelDef);
+    if (isNeedMatchDymaic) {
+      ret = MatchDynamicOpModel(aclOp, opModel, isDynamic, modelDef);
+    } else if (ret != ACL_SUCCESS) {
       return ret;
     }
-    ret = MatchDynamicOpModel(aclOp, opModel, isDynamic);
+  }
+
+  if (isCacheable && (ret == ACL_SUCCESS)) {
+    OpModelMatchCache::Store(aclOp, matchMode, generation, opModel, isDynamic, modelDef);
   }
 
   if (UNLIKELY((ret != ACL_SUCCESS) && (!aclOp.isCompile))) {
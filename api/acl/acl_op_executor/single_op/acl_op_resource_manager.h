@@ -73,12 +73,18 @@ class ACL_FUNC_VISIBILITY AclOpResourceManager {
 
   aclError HandleMaxOpQueueConfig(const char_t *const configBuffer);
 
+  aclError HandleOpResourcePoolConfig(const char_t *const configBuffer);
+
   aclError SetHostMemToConst(const AclOp &aclopHostMemToConst, bool &isExistConst) const;
 
   static aclError SetTensorConst(aclTensorDesc *const desc, const aclDataBuffer *const dataBuffer);
 
   void SetMaxOpNum(const uint64_t maxOpNum);
 
+  AclOpMapStats GetOpModelMapStats() const {
+    return opModels_.GetStats();
+  }
+
   void HandleReleaseSourceByStream(aclrtStream stream, aclrtStreamState state, void *args);
   void HandleReleaseSourceByDevice(int32_t deviceId, aclrtDeviceState state, void *args) const;
   void UpdateAllocatorsForOp(const void *const cacheKey, std::shared_ptr<gert::Allocators> &allocators);
@@ -105,8 +111,10 @@ class ACL_FUNC_VISIBILITY AclOpResourceManager {
 
   static bool IsDynamicOpModel(const AclOp &aclOp);
 
-  aclError MatchStaticOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic, bool &isNeedMatchDymaic);
-  aclError MatchDynamicOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic);
+  aclError MatchStaticOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic, bool &isNeedMatchDymaic,
+                              std::shared_ptr<OpModelDef> &modelDef);
+  aclError MatchDynamicOpModel(const AclOp &aclOp, OpModel &opModel, bool &isDynamic,
+                               std::shared_ptr<OpModelDef> &modelDef);
 
   void CleanAllocatorsForOp(const void *const cacheKey);
 
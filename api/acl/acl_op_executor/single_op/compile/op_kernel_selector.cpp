@@ -12,16 +12,24 @@
 #include <map>
 #include <memory>
 #include "common/log_inner.h"
+#include "common/prof_api_reg.h"
 #include "acl_op_kernel_registry.h"
 #include "utils/acl_attr_utils.h"
 
 namespace {
 constexpr uint64_t DEFAULT_MAX_OP_NUM_FOR_HANDLE = UINT64_MAX;
+
+void ReportKernelDescMapStats() {
+  const acl::AclOpMapStats stats = acl::OpKernelSelector::GetInstance().GetKernelDescMapStats();
+  ACL_LOG_EVENT("[Report][KernelDescMap]hit = %lu, miss = %lu, eviction = %lu, entry = %lu", stats.hitCount,
+                stats.missCount, stats.evictionCount, stats.entryCount);
+}
 }
 
 namespace acl {
 OpKernelSelector::OpKernelSelector() {
   kernelDescMap_.SetMaxOpNum(DEFAULT_MAX_OP_NUM_FOR_HANDLE);
+  RegisterProfStopHook(&ReportKernelDescMapStats);
 }
 
 bool OpKernelSelector::Register(const std::string &opType, aclopCompileFunc func) {
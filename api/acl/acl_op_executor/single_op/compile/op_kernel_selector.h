@@ -59,6 +59,10 @@ class OpKernelSelector {
 
   void SetMaxOpNum(const uint64_t maxOpNum);
 
+  AclOpMapStats GetKernelDescMapStats() const {
+    return kernelDescMap_.GetStats();
+  }
+
  private:
   OpKernelSelector();
   aclopCompileFunc GetSelectFunc(const std::string &opType);
@@ -34,6 +34,12 @@ aclError AclOpExecutorInitCallbackFunc(const char *configBuffer, size_t bufferSi
       return ret;
     }
     ACL_LOG_INFO("set HandleMaxOpQueueConfig success");
+    // config op_resource_pool_size
+    const auto poolRet = acl::AclOpResourceManager::GetInstance().HandleOpResourcePoolConfig(configBuffer);
+    if (poolRet != ACL_SUCCESS) {
+      ACL_LOG_ERROR("[Process][PoolConfig]process HandleOpResourcePoolConfig failed");
+      return poolRet;
+    }
   }
   return ACL_SUCCESS;
 }
@@ -10,6 +10,8 @@
 
 #include "op_model_cache.h"
 
+#include "op_model_match_cache.h"
+
 #include "framework/common/util.h"
 #include "executor/ge_executor.h"
 
@@ -47,6 +49,7 @@ aclError OpModelCache::Add(const uint64_t opId, OpModel &operModel) {
   auto ret = cachedModels_.insert(std::make_pair(opId, operModel));
   ACL_REQUIRES_TRUE(ret.second, ACL_ERROR_FAILURE, "ACL internal error: OpModelCache Add has same opId!");
   ret.first->second.mtx = std::move(mtx);
+  OpModelMatchCache::Invalidate();
   return ACL_SUCCESS;
 }
 
@@ -58,6 +61,7 @@ aclError OpModelCache::Delete(const OpModelDef &modelDef, const bool isDynamic)
   if (it != cachedModels_.end()) {
     const uint64_t opId = it->second.opModelId;
     (void)cachedModels_.erase(it);
+    OpModelMatchCache::Invalidate();
     ACL_LOG_INFO("start to unload single op resource %lu", opId);
     if (isDynamic) {
       return static_cast<int32_t>(ge::GeExecutor::UnloadDynamicSingleOp(opId));
@@ -94,6 +98,7 @@ aclError OpModelCache::UpdateCachedExecutor(const uint64_t &id, const std::share
     return ACL_ERROR_FAILURE;
   }
   iter->second.executor = executor;
+  OpModelMatchCache::Invalidate();
   return ACL_SUCCESS;
 }
 
@@ -104,6 +109,7 @@ aclError OpModelCache::CleanCachedExecutor(rtStream_t stream) {
       (void)it->second.executor->Erase(stream);
     }
   }
+  OpModelMatchCache::Invalidate();
   return ACL_SUCCESS;
 }
 
@@ -116,10 +122,12 @@ aclError OpModelCache::UnloadCachedModelData(const uint64_t &id) {
   }
   iter->second.data = nullptr;
   iter->second.size = 0U;
+  OpModelMatchCache::Invalidate();
   return ACL_SUCCESS;
 }
 
 void OpModelCache::CleanCachedModels() noexcept {
   cachedModels_.clear();
+  OpModelMatchCache::Invalidate();
 }
 }  // namespace acl
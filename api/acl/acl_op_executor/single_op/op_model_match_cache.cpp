@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "op_model_match_cache.h"
+
+#include <array>
+#include <new>
+
+#include "utils/acl_attr_utils.h"
+#include "utils/acl_hash_utils.h"
+
+namespace acl {
+namespace {
+// 两路组相联，相同opType不同属性的算子交替执行时不会互相挤占
+constexpr size_t kWayNum = 2U;
+constexpr size_t kSetNum = OpModelMatchCache::kSlotNum / kWayNum;
+
+struct MatchCacheEntry {
+  uint64_t generation = 0U;  // 0表示无效，全局代数从1开始
+  uint64_t lastUseTick = 0U;
+  size_t signature = 0U;
+  int32_t matchMode = 0;
+  std::string opType;
+  std::vector<aclTensorDesc> inputDescArr;
+  std::vector<aclTensorDesc> outputDescArr;
+  std::unique_ptr<aclopAttr> opAttr;
+  OpModel opModel;
+  bool isDynamic = false;
+  std::shared_ptr<OpModelDef> modelDef;
+};
+
+struct MatchCacheTable {
+  std::array<MatchCacheEntry, OpModelMatchCache::kSlotNum> entries;
+  uint64_t tick = 0U;
+  OpModelMatchCache::Stats stats;
+};
+
+MatchCacheTable &GetThreadTable() {
+  static thread_local MatchCacheTable table;
+  return table;
+}
+
+void HashTensorDescs(const int32_t num, const aclTensorDesc *const descArr[], size_t &seed) {
+  hash_utils::HashCombine(seed, num);
+  for (int32_t i = 0; i < num; ++i) {
+    const aclTensorDesc *const desc = descArr[i];
+    hash_utils::HashCombine(seed, static_cast<int32_t>(desc->dataType));
+    hash_utils::HashCombine(seed, static_cast<int32_t>(desc->format));
+    hash_utils::HashCombine(seed, static_cast<int32_t>(desc->storageFormat));
+    hash_utils::HashCombine(seed, desc->dims.size());
+    for (const int64_t dim : desc->dims) {
+      hash_utils::HashCombine(seed, dim);
+    }
+  }
+}
+
+// 签名只用于定位槽位，不包含属性值的digest(其计算需要序列化全部属性)，命中时再逐项比较
+size_t GetSignature(const AclOp &aclOp, const int32_t matchMode) {
+  size_t seed = 0U;
+  hash_utils::HashCombine(seed, aclOp.opType);
+  hash_utils::HashCombine(seed, matchMode);
+  HashTensorDescs(aclOp.numInputs, aclOp.inputDesc, seed);
+  HashTensorDescs(aclOp.numOutputs, aclOp.outputDesc, seed);
+  hash_utils::HashCombine(seed, (aclOp.opAttr == nullptr) ? 0U : (aclOp.opAttr->Attrs().size() + 1U));
+  return seed;
+}
+
+bool IsDescsMatched(const std::vector<aclTensorDesc> &cachedDescs, const int32_t num,
+                    const aclTensorDesc *const descArr[]) {
+  if (cachedDescs.size() != static_cast<size_t>(num)) {
+    return false;
+  }
+  for (size_t i = 0U; i < cachedDescs.size(); ++i) {
+    if (!(cachedDescs[i] == descArr[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IsEntryMatched(const MatchCacheEntry &entry, const AclOp &aclOp, const int32_t matchMode,
+                    const size_t signature, const uint64_t generation) {
+  if ((entry.generation != generation) || (entry.signature != signature) || (entry.matchMode != matchMode)) {
+    return false;
+  }
+  if (entry.opType != aclOp.opType) {
+    return false;
+  }
+  if ((!IsDescsMatched(entry.inputDescArr, aclOp.numInputs, aclOp.inputDesc)) ||
+      (!IsDescsMatched(entry.outputDescArr, aclOp.numOutputs, aclOp.outputDesc))) {
+    return false;
+  }
+  if ((entry.opAttr == nullptr) || (aclOp.opAttr == nullptr)) {
+    return (entry.opAttr == nullptr) && (aclOp.opAttr == nullptr);
+  }
+  return attr_utils::OpAttrEquals(aclOp.opAttr, entry.opAttr.get());
+}
+
+bool IsDescsCacheable(const int32_t num, const aclTensorDesc *const descArr[]) {
+  if (num <= 0) {
+    return true;
+  }
+  if (descArr == nullptr) {
+    return false;
+  }
+  for (int32_t i = 0; i < num; ++i) {
+    const aclTensorDesc *const desc = descArr[i];
+    if ((desc == nullptr) || desc->IsConstTensor() || desc->IsHostMemTensor()) {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+std::atomic<uint64_t> OpModelMatchCache::generation_{1U};
+std::atomic<bool> OpModelMatchCache::enable_{true};
+
+bool OpModelMatchCache::IsCacheable(const AclOp &aclOp) {
+  if (aclOp.isCompile) {
+    return false;
+  }
+  return IsDescsCacheable(aclOp.numInputs, aclOp.inputDesc) && IsDescsCacheable(aclOp.numOutputs, aclOp.outputDesc);
+}
+
+bool OpModelMatchCache::Lookup(const AclOp &aclOp, const int32_t matchMode, OpModel &opModel, bool &isDynamic,
+                               std::shared_ptr<OpModelDef> &modelDef) {
+  auto &table = GetThreadTable();
+  const size_t signature = GetSignature(aclOp, matchMode);
+  const uint64_t generation = GetGeneration();
+  const size_t setBegin = (signature % kSetNum) * kWayNum;
+  for (size_t way = 0U; way < kWayNum; ++way) {
+    auto &entry = table.entries[setBegin + way];
+    if (IsEntryMatched(entry, aclOp, matchMode, signature, generation)) {
+      entry.lastUseTick = ++table.tick;
+      opModel = entry.opModel;
+      isDynamic = entry.isDynamic;
+      modelDef = entry.modelDef;
+      ++table.stats.hitCount;
+      return true;
+    }
+  }
+  ++table.stats.missCount;
+  return false;
+}
+
+void OpModelMatchCache::Store(const AclOp &aclOp, const int32_t matchMode, const uint64_t generation,
+                              const OpModel &opModel, const bool isDynamic,
+                              const std::shared_ptr<OpModelDef> &modelDef) {
+  // 匹配过程中模型发生了变更，结果可能已过期
+  if (generation != GetGeneration()) {
+    return;
+  }
+  auto &table = GetThreadTable();
+  const size_t signature = GetSignature(aclOp, matchMode);
+  const size_t setBegin = (signature % kSetNum) * kWayNum;
+  // 优先替换失效项，否则替换最久未使用的一路
+  const auto getUseTick = [generation](const MatchCacheEntry &entry) -> uint64_t {
+    return (entry.generation == generation) ? entry.lastUseTick : 0U;
+  };
+  size_t victim = setBegin;
+  for (size_t way = 1U; way < kWayNum; ++way) {
+    if (getUseTick(table.entries[setBegin + way]) < getUseTick(table.entries[victim])) {
+      victim = setBegin + way;
+    }
+  }
+
+  auto &entry = table.entries[victim];
+  entry.generation = generation;
+  entry.lastUseTick = ++table.tick;
+  entry.signature = signature;
+  entry.matchMode = matchMode;
+  entry.opType = aclOp.opType;
+  entry.inputDescArr.clear();
+  for (int32_t i = 0; i < aclOp.numInputs; ++i) {
+    entry.inputDescArr.emplace_back(*aclOp.inputDesc[i]);
+  }
+  entry.outputDescArr.clear();
+  for (int32_t i = 0; i < aclOp.numOutputs; ++i) {
+    entry.outputDescArr.emplace_back(*aclOp.outputDesc[i]);
+  }
+  entry.opAttr.reset();
+  if (aclOp.opAttr != nullptr) {
+    entry.opAttr.reset(new (std::nothrow) aclopAttr(*aclOp.opAttr));
+    if (entry.opAttr == nullptr) {
+      entry.generation = 0U;
+      return;
+    }
+  }
+  entry.opModel = opModel;
+  entry.isDynamic = isDynamic;
+  entry.modelDef = modelDef;
+}
+
+void OpModelMatchCache::Clear() {
+  auto &table = GetThreadTable();
+  for (auto &entry : table.entries) {
+    entry = MatchCacheEntry();
+  }
+  table.tick = 0U;
+  table.stats = Stats();
+}
+
+OpModelMatchCache::Stats OpModelMatchCache::GetStats() {
+  return GetThreadTable().stats;
+}
+}  // namespace acl
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ACL_OP_EXEC_OP_MODEL_MATCH_CACHE_H_
+#define ACL_OP_EXEC_OP_MODEL_MATCH_CACHE_H_
+
+#include <atomic>
+#include <memory>
+
+#include "types/op_model.h"
+#include "types/acl_op_inner.h"
+
+namespace acl {
+/**
+ * 单算子执行时op model匹配结果的线程内缓存。
+ * 以算子签名(opType、输入输出tensor desc、属性)为key，直接映射到线程私有的槽位，命中时无需计算全量hash、
+ * 访问全局map及加锁即可得到匹配结果。
+ * 模型注册、老化、卸载及executor更新时递增全局代数，代数不一致的缓存项视为失效。
+ * 存在host内存或const输入输出时，匹配结果依赖tensor数据，不走缓存。
+ */
+class OpModelMatchCache {
+ public:
+  static constexpr size_t kSlotNum = 64U;
+
+  struct Stats {
+    uint64_t hitCount = 0U;
+    uint64_t missCount = 0U;
+  };
+
+  static bool IsCacheable(const AclOp &aclOp);
+
+  // 读取当前代数，需在匹配前读取并用于Store，保证匹配过程中发生的变更能使本次结果失效
+  static uint64_t GetGeneration() {
+    return generation_.load(std::memory_order_acquire);
+  }
+
+  static void Invalidate() {
+    (void)generation_.fetch_add(1U, std::memory_order_acq_rel);
+  }
+
+  static void SetEnable(const bool enable) {
+    enable_.store(enable, std::memory_order_relaxed);
+  }
+
+  static bool IsEnable() {
+    return enable_.load(std::memory_order_relaxed);
+  }
+
+  static bool Lookup(const AclOp &aclOp, const int32_t matchMode, OpModel &opModel, bool &isDynamic,
+                     std::shared_ptr<OpModelDef> &modelDef);
+
+  static void Store(const AclOp &aclOp, const int32_t matchMode, const uint64_t generation, const OpModel &opModel,
+                    const bool isDynamic, const std::shared_ptr<OpModelDef> &modelDef);
+
+  // 清空当前线程的缓存项及统计
+  static void Clear();
+
+  // 当前线程的命中统计
+  static Stats GetStats();
+
+ private:
+  static std::atomic<uint64_t> generation_;
+  static std::atomic<bool> enable_;
+};
+}  // namespace acl
+
+#endif  // ACL_OP_EXEC_OP_MODEL_MATCH_CACHE_H_
@@ -12,6 +12,7 @@
 #include <mutex>
 #include <unordered_set>
 #include <map>
+#include <vector>
 #include "mmpa/mmpa_api.h"
 #include "common/log_inner.h"
 
@@ -19,6 +20,7 @@ namespace {
 static bool g_profRun = false;
 static std::mutex g_profMutex;
 static std::unordered_set<uint32_t> g_deviceList;
+static std::vector<acl::AclProfStopHook> g_profStopHooks;
 constexpr uint64_t ACL_PROF_ACL_API = 0x0001U;
 constexpr uint32_t START_PROFILING = 1U;
 constexpr uint32_t STOP_PROFILING = 2U;
@@ -142,6 +144,9 @@ static aclError ProfInnerStop(const MsprofCommandHandle *const profilerConfig) {
 
   if (g_deviceList.empty() && g_profRun) {
     g_profRun = false;
+    for (const auto hook : g_profStopHooks) {
+      hook();
+    }
   }
   ACL_LOG_INFO("successfully execute ProfInnerStop");
   return ACL_SUCCESS;
@@ -221,4 +226,12 @@ AclProfilingReporter::~AclProfilingReporter() noexcept {
   }
 }
 
+void RegisterProfStopHook(const AclProfStopHook hook) {
+  if (hook == nullptr) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lk(g_profMutex);
+  g_profStopHooks.emplace_back(hook);
+}
+
 }  // namespace acl
@@ -99,6 +99,10 @@ class AclProfilingReporter {
   uint64_t startTime_ = 0UL;
   const AclProfType aclApi_;
 };
+
+using AclProfStopHook = void (*)();
+// 注册acl api profiling停止时的回调，用于输出各模块在采集期间的运行统计(如缓存命中率)
+void RegisterProfStopHook(const AclProfStopHook hook);
 }  // namespace acl
 
 #define ACL_PROFILING_REG(apiId) const acl::AclProfilingReporter profilingReporter(apiId)
@@ -11,6 +11,10 @@
 #ifndef ACL_UTILS_ACL_OP_MAP_H
 #define ACL_UTILS_ACL_OP_MAP_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <list>
 #include <map>
 #include <mutex>
 #include <vector>
@@ -22,6 +26,22 @@
 #include <unordered_map>
 
 namespace acl {
+struct AclOpMapStats {
+  uint64_t hitCount = 0U;
+  uint64_t missCount = 0U;
+  uint64_t evictionCount = 0U;
+  uint64_t entryCount = 0U;
+};
+
+/**
+ * 按算子hash索引的op model/kernel表。
+ * 桶按seed分为kStripeNum个分段，各分段独立加锁，不同线程查找不同算子时互不阻塞；
+ * 可老化的项(timestamp不为ULLONG_MAX)另外挂在LRU链表上，超过上限时从链表头淘汰，无需遍历全表。
+ * 命中时只刷新项的时间戳，不获取agingMutex_；淘汰时若链表头的时间戳晚于入链时记录的值，说明其后被访问过，
+ * 将其移到链表尾后继续检查下一项。
+ * 被淘汰的项在其所在分段锁内从LRU链表和hash表中一并删除，与同分段的查找/去重互斥。
+ * 加锁顺序固定为分段锁 -> agingMutex_，不在持有agingMutex_时获取分段锁。
+ */
 template <typename T>
 class AclOpMap {
  public:
@@ -32,70 +52,168 @@ class AclOpMap {
   aclError GetDynamic(const AclOp &op, T &entry, const uint64_t seq, const bool needUpdateTimestamp = false);
 
   void SetMaxOpNum(const uint64_t maxNum) {
+    const std::lock_guard<std::mutex> lk(agingMutex_);
     maxOpNum = maxNum;
   }
 
+  // 匹配结果来自外部缓存时，刷新其LRU位置及老化时间戳
+  void UpdateTimestamp(const T &entry);
+
+  AclOpMapStats GetStats() const;
+
+  void Clear();
+
  private:
-  aclError Aging(T &agingT);
-  void Updatetimestamp(T &entry) const;
-  bool Deduplicate(const AclOp &op, const aclopAttr *const attr, const T &entry, const size_t seed,
-                   const bool isDynamic);
-  aclError AddMemAndAging(const T &entry, T &agingT, const size_t seed);
+  static constexpr size_t kStripeNum = 16U;
+  using HashMap = std::unordered_map<size_t, std::vector<T>>;
+  struct Stripe {
+    HashMap hashMap;
+    std::mutex mutex;
+  };
+  struct LruNode {
+    T entry;
+    size_t seed;
+    // 入链或上次移到链表尾时项的时间戳
+    uint64_t timestamp;
+  };
+  using LruList = std::list<LruNode>;
+
+  Stripe &GetStripe(const size_t seed) {
+    return stripes_[seed % kStripeNum];
+  }
+  void Aging(T &agingT);
+  void Updatetimestamp(const T &entry) const;
+  static uint64_t LoadTimestamp(const T &entry) {
+    return __atomic_load_n(&entry->timestamp, __ATOMIC_RELAXED);
+  }
+  bool Deduplicate(const HashMap &hashMap, const AclOp &op, const aclopAttr *const attr, const T &entry,
+                   const size_t seed, const bool isDynamic);
+  bool AddMem(HashMap &hashMap, const T &entry, const size_t seed);
+  static void EraseFromHashMap(HashMap &hashMap, const T &agingT, const size_t agingSeed);
   bool CheckValueRange(const AclOp &op, const T &entry) const;
   bool HasSameValueRange(const AclOp &op, const T &entry) const;
-  using HashMap = std::unordered_map<size_t, std::vector<T>>;
 
-  HashMap hashMap_;
-  mutable std::mutex mutex_;
+  std::array<Stripe, kStripeNum> stripes_;
+  // 以下成员由agingMutex_保护
+  mutable std::mutex agingMutex_;
+  LruList lruList_;
+  std::unordered_map<const void *, typename LruList::iterator> lruIndex_;
   uint64_t cnt{0U};
   uint64_t maxOpNum{DEFAULT_MAX_OPQUEUE_NUM};
+
+  std::atomic<uint64_t> hitCount_{0U};
+  std::atomic<uint64_t> missCount_{0U};
+  std::atomic<uint64_t> evictionCount_{0U};
 };
 
 template <typename T>
-aclError AclOpMap<T>::Aging(T &agingT) {
-  // Find the min timestampe in hashMap
-  uint64_t timestampMin = static_cast<uint64_t>(ULONG_MAX);
-  typename HashMap::iterator itHashMapMin;
-  typename std::vector<T>::iterator itVectorMin;
-
-  bool found = false;
-  for (auto hashMapIter = hashMap_.begin(); hashMapIter != hashMap_.end(); ++hashMapIter) {
-    for (auto vecIter = hashMapIter->second.begin(); vecIter != hashMapIter->second.end(); ++vecIter) {
-      if ((*vecIter)->timestamp < timestampMin) {
-        timestampMin = (*vecIter)->timestamp;
-        itHashMapMin = hashMapIter;
-        itVectorMin = vecIter;
-        found = true;
+void AclOpMap<T>::Aging(T &agingT) {
+  size_t retryNum = 0U;
+  size_t maxRetryNum = 0U;
+  while (true) {
+    T candidate = nullptr;
+    size_t seed = 0U;
+    {
+      const std::lock_guard<std::mutex> lk(agingMutex_);
+      if ((cnt <= maxOpNum) || lruList_.empty()) {
+        return;
+      }
+      if (retryNum == 0U) {
+        maxRetryNum = lruList_.size();
+      }
+      candidate = lruList_.front().entry;
+      seed = lruList_.front().seed;
+    }
+    // 在候选项所在分段锁内确认并删除，避免同分段并发的去重/查找命中即将被删除的项
+    auto &stripe = GetStripe(seed);
+    const std::lock_guard<std::mutex> stripeLk(stripe.mutex);
+    const std::lock_guard<std::mutex> lk(agingMutex_);
+    const auto indexIter = lruIndex_.find(candidate.get());
+    if ((indexIter == lruIndex_.end()) || (indexIter->second != lruList_.begin())) {
+      // 已被其他线程淘汰或移动
+      continue;
+    }
+    const uint64_t timestamp = LoadTimestamp(candidate);
+    if (timestamp != indexIter->second->timestamp) {
+      indexIter->second->timestamp = timestamp;
+      lruList_.splice(lruList_.end(), lruList_, indexIter->second);
+      if (++retryNum > maxRetryNum) {
+        // 所有项都在并发访问中，本次不淘汰，由后续插入继续老化
+        ACL_LOG_INFO("AclOpMap::Aging skipped, all %zu entries were accessed recently", maxRetryNum);
+        return;
       }
+      continue;
     }
+    ACL_LOG_INFO("AclOpMap::Aging IN, type = %s, digest = %zu", candidate->opType.c_str(), seed);
+    (void)lruIndex_.erase(indexIter);
+    lruList_.pop_front();
+    --cnt;
+    (void)evictionCount_.fetch_add(1U, std::memory_order_relaxed);
+    EraseFromHashMap(stripe.hashMap, candidate, seed);
+    agingT = candidate;
+    return;
   }
+}
 
-  if (!found) {
-    ACL_LOG_DEBUG("AclOpMap::Aging IN, cannot find minimum value");
-    return ACL_SUCCESS;
-  }
-  ACL_LOG_INFO("AclOpMap::Aging IN, type = %s, digest = %zu, timestamp is %lu", (*itVectorMin)->opType.c_str(),
-               itHashMapMin->first, timestampMin);
-  agingT = *itVectorMin;
-  // aging model in hashMap with min timestamp
-  (void)itHashMapMin->second.erase(itVectorMin);
-  --cnt;
+template <typename T>
+void AclOpMap<T>::EraseFromHashMap(HashMap &hashMap, const T &agingT, const size_t agingSeed) {
+  const auto iter = hashMap.find(agingSeed);
+  if (iter == hashMap.end()) {
+    return;
+  }
+  for (auto vecIter = iter->second.begin(); vecIter != iter->second.end(); ++vecIter) {
+    if (*vecIter == agingT) {
+      (void)iter->second.erase(vecIter);
+      break;
+    }
+  }
   // after aging model in hashMap, the model vector maybe empty, delete the seed in hashMap
-  if (itHashMapMin->second.empty()) {
-    ACL_LOG_INFO("AclOpMap::After delete model, hash map empty while seed is %zu. delete seed in HashMap",
-                 itHashMapMin->first);
-    (void)hashMap_.erase(itHashMapMin);
+  if (iter->second.empty()) {
+    ACL_LOG_INFO("AclOpMap::After delete model, hash map empty while seed is %zu. delete seed in HashMap", agingSeed);
+    (void)hashMap.erase(iter);
   }
+}
 
-  return ACL_SUCCESS;
+template <typename T>
+void AclOpMap<T>::UpdateTimestamp(const T &entry) {
+  // LRU位置在老化时按时间戳调整，这里无需加锁
+  Updatetimestamp(entry);
 }
 
 template <typename T>
-void AclOpMap<T>::Updatetimestamp(T &entry) const {
-  if (entry->timestamp == static_cast<uint64_t>(ULLONG_MAX)) {
+AclOpMapStats AclOpMap<T>::GetStats() const {
+  AclOpMapStats stats;
+  stats.hitCount = hitCount_.load(std::memory_order_relaxed);
+  stats.missCount = missCount_.load(std::memory_order_relaxed);
+  stats.evictionCount = evictionCount_.load(std::memory_order_relaxed);
+  {
+    const std::lock_guard<std::mutex> lk(agingMutex_);
+    stats.entryCount = cnt;
+  }
+  return stats;
+}
+
+template <typename T>
+void AclOpMap<T>::Clear() {
+  for (auto &stripe : stripes_) {
+    const std::lock_guard<std::mutex> lk(stripe.mutex);
+    stripe.hashMap.clear();
+  }
+  const std::lock_guard<std::mutex> lk(agingMutex_);
+  lruList_.clear();
+  lruIndex_.clear();
+  cnt = 0U;
+}
+
+template <typename T>
+void AclOpMap<T>::Updatetimestamp(const T &entry) const {
+  const uint64_t timestamp = LoadTimestamp(entry);
+  if (timestamp == static_cast<uint64_t>(ULLONG_MAX)) {
     return;
   }
-  entry->timestamp = attr_utils::GetCurrentTimestamp();
+  // 时间戳精度内的多次访问也需要与入链时记录的值不同，老化时才能识别为被访问过
+  const uint64_t now = std::max(attr_utils::GetCurrentTimestamp(), timestamp + 1U);
+  __atomic_store_n(&entry->timestamp, now, __ATOMIC_RELAXED);
 }
 
 template <typename T>
@@ -120,10 +238,10 @@ bool AclOpMap<T>::HasSameValueRange(const AclOp &op, const T &entry) const {
 }
 
 template <typename T>
-bool AclOpMap<T>::Deduplicate(const AclOp &op, const aclopAttr *const attr, const T &entry, const size_t seed,
-                              const bool isDynamic) {
-  const auto iter = hashMap_.find(seed);
-  if (iter != hashMap_.end()) {
+bool AclOpMap<T>::Deduplicate(const HashMap &hashMap, const AclOp &op, const aclopAttr *const attr, const T &entry,
+                              const size_t seed, const bool isDynamic) {
+  const auto iter = hashMap.find(seed);
+  if (iter != hashMap.end()) {
     for (auto vecIter = iter->second.begin(); vecIter != iter->second.end(); ++vecIter) {
       if (isDynamic) {
         if (!HasSameValueRange(op, *vecIter)) {
@@ -147,18 +265,23 @@ bool AclOpMap<T>::Deduplicate(const AclOp &op, const aclopAttr *const attr, cons
 }
 
 template <typename T>
-aclError AclOpMap<T>::AddMemAndAging(const T &entry, T &agingT, const size_t seed) {
-  hashMap_[seed].emplace_back(entry);
+bool AclOpMap<T>::AddMem(HashMap &hashMap, const T &entry, const size_t seed) {
+  hashMap[seed].emplace_back(entry);
   ACL_LOG_INFO("AclOpMap::Insert op into HashMap success, seed = %zu", seed);
 
+  const std::lock_guard<std::mutex> lk(agingMutex_);
   ++cnt;
-  if ((entry->timestamp == static_cast<uint64_t>(ULLONG_MAX)) || (cnt <= maxOpNum)) {
-    ACL_LOG_INFO("AclOpMap::AddMemAndAging in, cnt is %lu, maxOpNum is %lu, no need aging", cnt, maxOpNum);
-    return ACL_SUCCESS;
+  const uint64_t timestamp = LoadTimestamp(entry);
+  if (timestamp != static_cast<uint64_t>(ULLONG_MAX)) {
+    const auto nodeIter = lruList_.emplace(lruList_.end(), LruNode{entry, seed, timestamp});
+    lruIndex_[entry.get()] = nodeIter;
   }
-  ACL_LOG_INFO("AclOpMap::time stamp is %lu, cnt is %lu, maxOpNum is %lu, start aging", entry->timestamp, cnt,
-               maxOpNum);
-  return Aging(agingT);
+  if ((timestamp == static_cast<uint64_t>(ULLONG_MAX)) || (cnt <= maxOpNum)) {
+    ACL_LOG_INFO("AclOpMap::AddMem in, cnt is %lu, maxOpNum is %lu, no need aging", cnt, maxOpNum);
+    return false;
+  }
+  ACL_LOG_INFO("AclOpMap::time stamp is %lu, cnt is %lu, maxOpNum is %lu, start aging", timestamp, cnt, maxOpNum);
+  return true;
 }
 
 template <typename T>
@@ -211,15 +334,21 @@ aclError AclOpMap<T>::Insert(const AclOp &op, const T &entry, T &agingT, bool &i
     ACL_LOG_ERROR("[Check][GetAclOpHash]GetAclOpHash failed, seed = %zu, op = %s", seed, op.DebugString().c_str());
     return ACL_ERROR_FAILURE;
   }
+  bool needAging = false;
   // Lock
   {
-    const std::lock_guard<std::mutex> lk(mutex_);
-    isDeduplicate = Deduplicate(op, opAttr, entry, seed, false);
+    auto &stripe = GetStripe(seed);
+    const std::lock_guard<std::mutex> lk(stripe.mutex);
+    isDeduplicate = Deduplicate(stripe.hashMap, op, opAttr, entry, seed, false);
     if (!isDeduplicate) {
-      ACL_REQUIRES_OK(AddMemAndAging(entry, agingT, seed));
+      needAging = AddMem(stripe.hashMap, entry, seed);
     }
     ACL_LOG_INFO("AclOpMap::Insert success, seed = %zu, op = %s", seed, op.DebugString().c_str());
   }
+  // 被淘汰的项可能位于其他分段，释放当前分段锁后再老化，避免同时持有两个分段锁
+  if (needAging) {
+    Aging(agingT);
+  }
   return ACL_SUCCESS;
 }
 
@@ -248,15 +377,21 @@ aclError AclOpMap<T>::InsertDynamic(const AclOp &op, const T &entry, T &agingT,
     ACL_LOG_ERROR("[Check][GetAclOpHash]GetAclOpHash failed, seed = %zu, op = %s", seed, op.DebugString().c_str());
     return ACL_ERROR_FAILURE;
   }
+  bool needAging = false;
   // Lock
   {
-    const std::lock_guard<std::mutex> lk(mutex_);
-    isDeduplicate = Deduplicate(op, opAttr, entry, seed, true);
+    auto &stripe = GetStripe(seed);
+    const std::lock_guard<std::mutex> lk(stripe.mutex);
+    isDeduplicate = Deduplicate(stripe.hashMap, op, opAttr, entry, seed, true);
     if (!isDeduplicate) {
-      ACL_REQUIRES_OK(AddMemAndAging(entry, agingT, seed));
+      needAging = AddMem(stripe.hashMap, entry, seed);
     }
     ACL_LOG_INFO("AclOpMap::Insert success, seed = %zu, op = %s", seed, op.DebugString().c_str());
   }
+  // 被淘汰的项可能位于其他分段，释放当前分段锁后再老化，避免同时持有两个分段锁
+  if (needAging) {
+    Aging(agingT);
+  }
   return ACL_SUCCESS;
 }
 
@@ -280,9 +415,11 @@ aclError AclOpMap<T>::Get(const AclOp &op, T &entry, const bool needUpdateTimest
   }
   size_t seed = 0U;
   ACL_REQUIRES_OK(hash_utils::GetAclOpHash(op, opAttr, digest, seed));
-  const std::lock_guard<std::mutex> lk(mutex_);
-  const auto iter = hashMap_.find(seed);
-  if (iter == hashMap_.end()) {
+  auto &stripe = GetStripe(seed);
+  const std::lock_guard<std::mutex> lk(stripe.mutex);
+  const auto iter = stripe.hashMap.find(seed);
+  if (iter == stripe.hashMap.end()) {
+    (void)missCount_.fetch_add(1U, std::memory_order_relaxed);
     return ACL_ERROR_OP_NOT_FOUND;
   }
   // Cyclically traversing the model size >= 1 with same seed
@@ -292,12 +429,14 @@ aclError AclOpMap<T>::Get(const AclOp &op, T &entry, const bool needUpdateTimest
         ACL_LOG_INFO("Get aclOp from aclOpMap success! seed = %zu, aclOp = %s", seed, op.DebugString().c_str());
         entry = *modelVecIter;
         if (needUpdateTimestamp) {
-          Updatetimestamp(*modelVecIter);
+          Updatetimestamp(entry);
         }
+        (void)hitCount_.fetch_add(1U, std::memory_order_relaxed);
         return ACL_SUCCESS;
       }
     }
   }
+  (void)missCount_.fetch_add(1U, std::memory_order_relaxed);
   ACL_LOG_DEBUG("Get aclOp from aclOpMap failed due to CheckValueRange failed! seed = %zu, aclOp = %s", seed,
                 op.DebugString().c_str());
   return ACL_ERROR_OP_NOT_FOUND;
@@ -323,9 +462,11 @@ aclError AclOpMap<T>::GetDynamic(const AclOp &op, T &entry, const uint64_t seq,
   }
   size_t seed = 0U;
   ACL_REQUIRES_OK(hash_utils::GetAclOpHashDynamic(op, opAttr, digest, seed, seq));
-  const std::lock_guard<std::mutex> lk(mutex_);
-  const auto iter = hashMap_.find(seed);
-  if (iter == hashMap_.end()) {
+  auto &stripe = GetStripe(seed);
+  const std::lock_guard<std::mutex> lk(stripe.mutex);
+  const auto iter = stripe.hashMap.find(seed);
+  if (iter == stripe.hashMap.end()) {
+    (void)missCount_.fetch_add(1U, std::memory_order_relaxed);
     return ACL_ERROR_OP_NOT_FOUND;
   }
   // Cyclically traversing the model size >= 1 with same seed
@@ -335,12 +476,14 @@ aclError AclOpMap<T>::GetDynamic(const AclOp &op, T &entry, const uint64_t seq,
         ACL_LOG_INFO("Get aclOp from aclOpMap success! seed = %zu, aclOp = %s", seed, op.DebugString().c_str());
         entry = *modelVecIter;
         if (needUpdateTimestamp) {
-          Updatetimestamp(*modelVecIter);
+          Updatetimestamp(entry);
         }
+        (void)hitCount_.fetch_add(1U, std::memory_order_relaxed);
         return ACL_SUCCESS;
       }
     }
   }
+  (void)missCount_.fetch_add(1U, std::memory_order_relaxed);
   ACL_LOG_DEBUG("Get aclOp from aclOpMap failed due to CheckValueRange failed! seed = %zu, aclOp = %s", seed,
                 op.DebugString().c_str());
   return ACL_ERROR_OP_NOT_FOUND;
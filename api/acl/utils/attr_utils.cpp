@@ -9,6 +9,7 @@
  */
 
 #include "acl_attr_utils.h"
+#include <atomic>
 #include <cmath>
 #include "securec.h"
 
@@ -670,9 +671,9 @@ bool OpAttrEquals(const aclopAttr *const lhs, const aclopAttr *const rhs) {
 }
 
 uint64_t GetCurrentTimestamp() {
-  static uint64_t timeStamp = 0UL;
-  ++timeStamp;
-  return timeStamp;
+  // AclOpMap各分段在各自的锁内刷新时间戳，计数需保证原子
+  static std::atomic<uint64_t> timeStamp{0UL};
+  return timeStamp.fetch_add(1UL, std::memory_order_relaxed) + 1UL;
 }
 
 static bool ConstToAttr(const vector<aclTensorDesc> &tensorDesc, std::vector<std::string> &constStr) {
@@ -20,6 +20,7 @@ namespace ge {
 // todo refactor func name to AddAndCompile
 Status CompileContext::Compile(uint32_t graph_id, const ComputeGraphPtr &graph, const std::vector<gert::Tensor> &inputs,
                                const std::map<std::string, std::string> &options, uint64_t session_id) {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   Graph graph_to_add = GraphUtilsEx::CreateGraphFromComputeGraph(graph);  // todo check if need more info in graph
   GE_ASSERT_SUCCESS(graph_manager_.AddGraph(graph_id, graph_to_add, options, domi::GetContext()));
   GELOGI("[Session: ][AddGraph] success to add slice graph id: %ld, session_id: %llu", graph_id, session_id);
@@ -47,6 +48,7 @@ Status CompileContext::Compile(uint32_t graph_id, const ComputeGraphPtr &graph,
 
 Status CompileContext::Compile(uint32_t graph_id, const ComputeGraphPtr &graph, const std::vector<ge::Tensor> &inputs,
                                const std::map<std::string, std::string> &options, uint64_t session_id) {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   Graph graph_to_add = GraphUtilsEx::CreateGraphFromComputeGraph(graph);
   GE_ASSERT_SUCCESS(graph_manager_.AddGraph(graph_id, graph_to_add, options, domi::GetContext()));
   GELOGI("[Session: ][AddGraph] success to add slice graph id: %ld, session_id: %llu", graph_id, session_id);
@@ -56,6 +58,7 @@ Status CompileContext::Compile(uint32_t graph_id, const ComputeGraphPtr &graph,
 }
 
 Status CompileContext::Load(uint32_t graph_id, const aclrtStream stream) const {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   GE_ASSERT_SUCCESS(graph_manager_.LoadGraph(graph_id, {}, stream));
   GELOGI("[Session: ][AddGraph] success to load slice_graph_id: %ld", graph_id);
   return SUCCESS;
@@ -63,21 +66,25 @@ Status CompileContext::Load(uint32_t graph_id, const aclrtStream stream) const {
 
 Status CompileContext::Load(uint32_t graph_id, const std::map<AscendString, AscendString> &options,
                             const aclrtStream stream) {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   GE_ASSERT_SUCCESS(graph_manager_.LoadGraph(graph_id, options, stream));
   GELOGI("[Session: ][LoadGraph] success to load slice_graph_id: %ld", graph_id);
   return SUCCESS;
 }
 
 Status CompileContext::Fork(uint32_t origin_graph_id, uint32_t forked_graph_id) {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   GE_ASSERT_SUCCESS(graph_manager_.ForkGraph(origin_graph_id, forked_graph_id));
   GELOGI("[Session: ][ForkGraph] success to fork graph: %u from graph:%u", forked_graph_id, origin_graph_id);
   return SUCCESS;
 }
 bool CompileContext::IsGraphNeedRebuild(uint32_t graph_id) {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   return graph_manager_.IsGraphNeedRebuild(graph_id);
 }
 
 Status CompileContext::GetCompiledGraphSummary(uint32_t graph_id, CompiledGraphSummaryPtr &summary) const {
+  const std::lock_guard<std::recursive_mutex> locker(graph_mutex_);
   GE_ASSERT_SUCCESS(graph_manager_.GetCompiledGraphSummary(graph_id, summary));
   GELOGI("[Session: ][GetCompiledGraphSummary] success to get compiled graph: %u", graph_id);
   return SUCCESS;
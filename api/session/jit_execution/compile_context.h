@@ -10,7 +10,9 @@
 
 #ifndef COMPILE_CONTEXT_H
 #define COMPILE_CONTEXT_H
+#include <atomic>
 #include <cstdint>
+#include <mutex>
 #include "ge/ge_api_types.h"
 #include "exe_graph/runtime/runtime_tensor.h"
 #include "graph/compute_graph.h"
@@ -22,7 +24,14 @@ class CompileContext {
  public:
   explicit CompileContext(GraphManager &graph_manager) : graph_manager_(graph_manager) {}
   uint32_t GenNewGraphId() {
-    return inner_ge_graph_id_generator_++;
+    return inner_ge_graph_id_generator_.fetch_add(1U);
+  }
+  /**
+   * 前台JitExecutor与后台推测编译共用GraphManager，Compile/Fork/Load等图操作在内部锁中串行执行。
+   * 前台加载后台编译结果前用该接口尝试持锁，后台编译进行中时推迟加载，避免前台请求等待整个编译过程
+   */
+  std::unique_lock<std::recursive_mutex> TryLock() const {
+    return std::unique_lock<std::recursive_mutex>(graph_mutex_, std::try_to_lock);
   }
   Status Compile(uint32_t graph_id, const ComputeGraphPtr &graph, const std::vector<gert::Tensor> &inputs,
                  const std::map<std::string, std::string> &options, uint64_t session_id);
@@ -36,7 +45,8 @@ class CompileContext {
 
  private:
   GraphManager &graph_manager_;
-  uint32_t inner_ge_graph_id_generator_{0};
+  std::atomic<uint32_t> inner_ge_graph_id_generator_{0U};
+  mutable std::recursive_mutex graph_mutex_;
 };
 
 }  // namespace ge
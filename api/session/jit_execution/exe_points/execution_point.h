@@ -49,6 +49,18 @@ class ExecutionPoint {
     return models_.FindOrCreateGuarded(inputs);
   }
 
+  GuardedExecutionPoint *FindGeneralized(const std::vector<gert::Tensor> &inputs) const {
+    return models_.FindGeneralized(inputs);
+  }
+
+  Status SetGeneralized(std::unique_ptr<GuardedExecutionPoint> gep) {
+    return models_.SetGeneralized(std::move(gep));
+  }
+
+  Status AddSpeculativeCompiled(std::unique_ptr<GuardedExecutionPoint> gep) {
+    return models_.AddSpeculativeCompiled(std::move(gep));
+  }
+
   size_t GetEpOutNum() const {
     return sliced_graph_->GetOutputSize();
   }
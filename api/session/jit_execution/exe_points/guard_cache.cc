@@ -71,20 +71,49 @@ Status GuardCheckCache::AddCompiledCompiledGraph(GuardedExecutionPoint *gep) {
   // 拷贝EP中的原图，用于gep->GetGraph()被CompileAndLoad使用
   GE_ASSERT_SUCCESS(gep->CopySlicedGraph());
 
+  InsertWithEviction(std::unique_ptr<GuardedExecutionPoint>(gep));
+  return SUCCESS;
+}
+
+Status GuardCheckCache::AddSpeculativeCompiled(std::unique_ptr<GuardedExecutionPoint> gep) {
+  GE_ASSERT_NOTNULL(gep);
+  GE_ASSERT_TRUE(gep->Compiled());
+  GELOGI("Add speculative compiled GEP(%u) to cache, cache size(%zu)", gep->GetCompiledGraphId(),
+         cache_models_.size());
+  InsertWithEviction(std::move(gep));
+  return SUCCESS;
+}
+
+Status GuardCheckCache::SetGeneralized(std::unique_ptr<GuardedExecutionPoint> gep) {
+  GE_ASSERT_NOTNULL(gep);
+  GE_ASSERT_TRUE(gep->IsGeneralized());
+  if (generalized_model_ != nullptr) {
+    GE_ASSERT_SUCCESS(generalized_model_->RemoveItem());
+  }
+  generalized_model_ = std::move(gep);
+  return SUCCESS;
+}
+
+GuardedExecutionPoint *GuardCheckCache::FindGeneralized(const std::vector<gert::Tensor> &inputs) const {
+  if ((generalized_model_ == nullptr) || (!generalized_model_->Match(inputs))) {
+    return nullptr;
+  }
+  return generalized_model_.get();
+}
+
+void GuardCheckCache::InsertWithEviction(std::unique_ptr<GuardedExecutionPoint> gep) {
   if (max_cache_count_ <= cache_models_.size()) {
     auto &lastItem = cache_models_.back();
     lastItem->RemoveItem();
     cache_models_.pop_back();
   }
 
-  cache_models_.emplace_back(gep);
+  cache_models_.emplace_back(std::move(gep));
 
   std::sort(cache_models_.begin(), cache_models_.end(),
             [](std::unique_ptr<ge::GuardedExecutionPoint> &a, std::unique_ptr<ge::GuardedExecutionPoint> &b) {
               return a->GetPriority() > b->GetPriority();
             });
-
-  return SUCCESS;
 }
 
 Status GuardCheckCache::RemoveCompiledGraph() {
@@ -95,5 +124,9 @@ Status GuardCheckCache::RemoveCompiledGraph() {
     }
   }
   cache_models_.clear();
+  if (generalized_model_ != nullptr) {
+    GE_ASSERT_SUCCESS(generalized_model_->RemoveItem());
+    generalized_model_.reset();
+  }
   return ge::SUCCESS;
 }
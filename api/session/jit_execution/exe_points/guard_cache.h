@@ -59,6 +59,30 @@ class GuardCheckCache {
 
   GuardedExecutionPoint *FindOrCreateGuarded(const std::vector<gert::Tensor> &inputs);
 
+  /**
+   * 将后台已编译完成的特化结果放入cache，与AddCompiledCompiledGraph不同，不会重新拷贝原图
+   *
+   * @param gep 已编译的gep
+   * @return
+   */
+  Status AddSpeculativeCompiled(std::unique_ptr<GuardedExecutionPoint> gep);
+
+  /**
+   * 设置泛化(符号化/动态)编译结果，guard miss时在特化结果就绪前用于兜底执行
+   *
+   * @param gep 已编译的泛化gep
+   * @return
+   */
+  Status SetGeneralized(std::unique_ptr<GuardedExecutionPoint> gep);
+
+  /**
+   * 获取可用于执行当前输入的泛化编译结果
+   *
+   * @param inputs
+   * @return 泛化gep，若不存在或rank/dtype不一致返回nullptr
+   */
+  GuardedExecutionPoint *FindGeneralized(const std::vector<gert::Tensor> &inputs) const;
+
   /**
    * 获取已经保存的cache个数
    *
@@ -71,8 +95,11 @@ class GuardCheckCache {
   };
 
  private:
+  void InsertWithEviction(std::unique_ptr<GuardedExecutionPoint> gep);
+
   uint32_t max_cache_count_;
   std::vector<std::unique_ptr<GuardedExecutionPoint>> cache_models_;
+  std::unique_ptr<GuardedExecutionPoint> generalized_model_;
   std::vector<char> last_guard_miss_reason_;
   ExecutionPoint *owner_point_;
 };
@@ -30,11 +30,24 @@ const std::string kGuardCheckSoName = "libguard_check.so";
 constexpr char_t const *kGuardCheckSoDataResult = "_guard_check_so_data";
 
 bool GuardedExecutionPoint::Match(const std::vector<gert::Tensor> &inputs) const {
+  if (generalized_) {
+    if (inputs.size() != generalized_input_descs_.size()) {
+      return false;
+    }
+    for (size_t i = 0U; i < inputs.size(); ++i) {
+      if ((inputs[i].GetDataType() != generalized_input_descs_[i].first) ||
+          (inputs[i].GetStorageShape().GetDimNum() != generalized_input_descs_[i].second)) {
+        GELOGI("Generalized GEP(%u) miss, input[%zu] dtype or rank changed.", compiled_graph_id_, i);
+        return false;
+      }
+    }
+    return true;
+  }
   return matcher_.Match(inputs);
 }
 
 bool GuardCheckFuncCaller::Match(const vector<gert::Tensor> &inputs) const {
-  if (func_ == nullptr) {
+  if ((program_ == nullptr) && (func_ == nullptr)) {
     return false;
   }
 
@@ -46,9 +59,10 @@ bool GuardCheckFuncCaller::Match(const vector<gert::Tensor> &inputs) const {
     rt_inputs.emplace_back(const_cast<gert::Tensor *>(&inputs[i]));
   }
 
-  char_t reason[kMaxStringSize];
+  char_t reason[kMaxStringSize] = {'\0'};
   GE_TIMESTAMP_START(GuardMatch);
-  bool match_result = func_(rt_inputs.data(), num_tensors, reason, kMaxStringSize);
+  bool match_result = (program_ != nullptr) ? program_->Check(rt_inputs.data(), num_tensors, reason, kMaxStringSize)
+                                            : func_(rt_inputs.data(), num_tensors, reason, kMaxStringSize);
   GE_TIMESTAMP_END(GuardMatch, "GuardMatch");
   if (!match_result) {
     GELOGI("GuardMiss reason: %s", reason);
@@ -58,6 +72,12 @@ bool GuardCheckFuncCaller::Match(const vector<gert::Tensor> &inputs) const {
 
 Status GuardCheckFuncCaller::LoadGuardCheckFunc(ComputeGraphPtr computeGraphPtr) {
   GELOGD("Start load guard check func");
+  const std::string *program_data = ge::AttrUtils::GetStr(computeGraphPtr, kGuardCheckProgramData);
+  if ((program_data != nullptr) && !program_data->empty()) {
+    program_ = GuardProgramCache::GetInstance().Load(*program_data);
+    GE_ASSERT_NOTNULL(program_, "LoadGuardCheckFunc load guard program of size %zu failed", program_data->size());
+    return ge::SUCCESS;
+  }
   const std::string *buffer = ge::AttrUtils::GetStr(computeGraphPtr, kGuardCheckSoDataResult);
   if ((buffer == nullptr) || buffer->empty()) {
     GELOGE(ge::FAILED, "LoadGuardCheckFunc GetStr fail %s", kGuardCheckSoDataResult);
@@ -117,6 +137,17 @@ bool GuardedExecutionPoint::SetCompiled(uint32_t compiled_graph_id, ComputeGraph
   return true;
 }
 
+void GuardedExecutionPoint::SetGeneralized(uint32_t compiled_graph_id, const std::vector<gert::Tensor> &inputs) {
+  generalized_input_descs_.clear();
+  generalized_input_descs_.reserve(inputs.size());
+  for (const auto &input : inputs) {
+    generalized_input_descs_.emplace_back(input.GetDataType(), input.GetStorageShape().GetDimNum());
+  }
+  compiled_graph_id_ = compiled_graph_id;
+  generalized_ = true;
+  compiled_ = true;
+}
+
 ComputeGraphPtr GuardedExecutionPoint::GetGraph() const {
   return compiled_graph_;
 }
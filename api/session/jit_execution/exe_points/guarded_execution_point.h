@@ -13,12 +13,15 @@
 #include <cstdint>
 #include <iostream>
 #include <array>
+#include <utility>
+#include <vector>
 
 #include "exe_graph/runtime/runtime_tensor.h"
 #include "ge/ge_api_types.h"
 
 #include "graph/compute_graph.h"
 #include "graph/optimize/symbolic/codegen/guard_codegen.h"
+#include "common/guard/guard_program.h"
 
 namespace ge {
 
@@ -32,6 +35,8 @@ class GuardCheckFuncCaller {
   Status UnloadGraphCheckFunc() const;
 
  private:
+  // 优先使用进程内解释执行的guard program，没有时回退到加载guard_check.so
+  GuardProgramPtr program_;
   GuardCheckFunc func_{nullptr};
   int32_t file_handle_{-1};
   void *so_handle_{nullptr};
@@ -63,6 +68,16 @@ class GuardedExecutionPoint {
   void SetForked(uint32_t forked_graph_id) {
     forked_graph_ids_.push_back(forked_graph_id);
   }
+  /**
+   * 标记为泛化编译结果，泛化图不加载guard函数，只要输入的rank和dtype一致即视为匹配
+   *
+   * @param compiled_graph_id 泛化图的编译id
+   * @param inputs 泛化编译时使用的输入
+   */
+  void SetGeneralized(uint32_t compiled_graph_id, const std::vector<gert::Tensor> &inputs);
+  bool IsGeneralized() const {
+    return generalized_;
+  }
 
   Status RemoveItem();
   uint32_t GetPriority() const;
@@ -77,6 +92,9 @@ class GuardedExecutionPoint {
   ComputeGraphPtr compiled_graph_;
 
   bool compiled_{false};
+  bool generalized_{false};
+  // 泛化图输入的(dtype, rank)，用于替代guard函数做粗粒度匹配
+  std::vector<std::pair<DataType, size_t>> generalized_input_descs_;
   uint32_t compiled_graph_id_{0U};
   std::vector<uint32_t> forked_graph_ids_;
   friend class GuardedExecutionPointUtil;
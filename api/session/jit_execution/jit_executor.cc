@@ -234,6 +234,8 @@ std::unique_ptr<JitExecutor> JitExecutor::Create(GraphManager &graph_manager, Us
   auto jit_allocator = gert::AllocatorFactory::Create("usergraph", gert::kOnDeviceHbm);
   GE_ASSERT_NOTNULL(jit_allocator);
   jit.get()->external_allocator_ = std::move(jit_allocator);
+  jit.get()->speculative_compiler_ = MakeUnique<SpeculativeCompiler>(compile_context, cmc, mutex, jit.get()->device_id_);
+  GE_ASSERT_NOTNULL(jit.get()->speculative_compiler_);
   return jit;
 }
 
@@ -242,6 +244,7 @@ Status JitExecutor::Finalize() {
   // 通过给jit挂外置allocator的方法必须在load
   // graph之前，因为LoadGraph接口中会默认create一个allocator，而在execute阶段会优先使用默认create的allocator 在load
   // graph之前外置allocator会导致load过程中去申请const、feature等内存，这就强制要求这个外置allocator的生命周期大于整个GE的生命周期，否则会在remove的时候释放const内存失败。所以不在JIT中外置allocator
+  GE_ASSERT_SUCCESS(ReleaseSpeculativeCompiled());
   auto sorted_geps_to_inner_graph_id = SortMapByValue(geps_to_inner_ge_graph_id_, false);
   for (const auto &gep_2_id : sorted_geps_to_inner_graph_id) {
     GELOGI("[Jit]RemoveGraph %u", gep_2_id.second);
@@ -426,8 +429,9 @@ Status JitExecutor::ProcessAndExecuteGraphAsync(UserGraphExecution &task, const
   uint32_t guarded_ep_instance_id;
   {
     std::lock_guard<std::mutex> locker(mutex_);
+    JIT_ASSERT_SUCCESS(SwapInSpeculativeCompiled(stream, task.load_options), task);
     // 需要value
-    gep = ep->FindOrCreateGuarded(compile_inputs);
+    gep = FindOrCreateGuardedAsync(ep, compile_inputs, task.session_id);
     JIT_ASSERT_NOTNULL(gep, task);
     GELOGD("Get GEP[compiled_graph_id:%u] [compiled? %d] of EP[%ld] USER_GRAPH[%u], session_id:%llu.",
            gep->GetCompiledGraphId(), gep->Compiled(), ep->GetId(), task.user_graph_id, task.session_id);
@@ -435,6 +439,11 @@ Status JitExecutor::ProcessAndExecuteGraphAsync(UserGraphExecution &task, const
     // 需要value
     JIT_ASSERT_SUCCESS(
         CompileAndLoad(compile_inputs, gep, guarded_ep_instance_id, stream, task.load_options, task.session_id), task);
+    if (speculative_compiler_->IsAsyncCompileEnabled() && SpeculativeCompiler::IsSupportedInputs(compile_inputs) &&
+        (ep->FindGeneralized(compile_inputs) == nullptr)) {
+      // 首次特化编译完成后在后台补充泛化编译，后续guard miss可先用泛化图执行
+      JIT_ASSERT_SUCCESS(speculative_compiler_->SubmitGeneralized(ep, compile_inputs, task.session_id), task);
+    }
   }
   JIT_ASSERT_NOTNULL(gep, task);
   GELOGD("ExecuteGraphWithStreamAsync GEP[ins_id:%u] of EP[%ld] USER_GRAPH[%u].", guarded_ep_instance_id,
@@ -450,6 +459,89 @@ Status JitExecutor::ProcessAndExecuteGraphAsync(UserGraphExecution &task, const
   return SUCCESS;
 }
 
+GuardedExecutionPoint *JitExecutor::FindOrCreateGuardedAsync(ExecutionPoint *ep,
+                                                             const std::vector<gert::Tensor> &compile_inputs,
+                                                             uint64_t session_id) {
+  if (!speculative_compiler_->IsAsyncCompileEnabled() || !SpeculativeCompiler::IsSupportedInputs(compile_inputs)) {
+    return ep->FindOrCreateGuarded(compile_inputs);
+  }
+  auto gep = ep->FindGuarded(compile_inputs);
+  if (gep != nullptr) {
+    return gep;
+  }
+  gep = ep->FindGeneralized(compile_inputs);
+  if (gep == nullptr) {
+    // 尚无泛化图可兜底，退化为同步编译
+    return ep->FindOrCreateGuarded(compile_inputs);
+  }
+  GELOGI("Guard miss of EP[%ld], execute with generalized GEP[%u] and compile specialized one in background.",
+         ep->GetId(), gep->GetCompiledGraphId());
+  GE_ASSERT_SUCCESS(speculative_compiler_->OnGuardMiss(ep, compile_inputs, session_id));
+  return gep;
+}
+
+Status JitExecutor::SwapInSpeculativeCompiled(const aclrtStream stream,
+                                              const std::map<AscendString, AscendString> &load_options) {
+  // 后台编译进行中时不等待，已完成的结果留到后续请求再加载
+  const auto graph_lock = compile_context_.TryLock();
+  if (!graph_lock.owns_lock()) {
+    GELOGD("Speculative compile is in progress, defer swapping in compiled results.");
+    return SUCCESS;
+  }
+  auto results = speculative_compiler_->FetchReady();
+  for (size_t i = 0U; i < results.size(); ++i) {
+    auto &result = results[i];
+    const auto ret = SwapInSpeculativeCompiled(result, stream, load_options);
+    if (ret != SUCCESS) {
+      // 当前及剩余的结果尚未放入cache，需要在这里释放，避免残留在GraphManager中
+      for (size_t j = i; j < results.size(); ++j) {
+        GELOGW("[Jit]RemoveGraph %u of speculative compile result which failed to swap in", results[j].instance_id);
+        if (results[j].gep != nullptr) {
+          (void)results[j].gep->RemoveItem();
+        }
+        (void)graph_manager_.RemoveGraph(results[j].instance_id);
+      }
+      return ret;
+    }
+  }
+  return SUCCESS;
+}
+
+Status JitExecutor::SwapInSpeculativeCompiled(SpeculativeCompileResult &result, const aclrtStream stream,
+                                              const std::map<AscendString, AscendString> &load_options) {
+  GE_ASSERT_NOTNULL(result.ep);
+  GE_ASSERT_NOTNULL(result.gep);
+  GE_ASSERT_SUCCESS(compile_context_.Load(result.instance_id, load_options, stream));
+  GE_ASSERT_RT_OK(SetDeviceCached(device_id_));
+  GELOGI("Swap in speculative compiled GEP[%u] of EP[%ld], generalized: %d.", result.instance_id, result.ep->GetId(),
+         static_cast<int32_t>(result.generalized));
+  // 放入cache成功后gep所有权转移给EP，再记录实例id，失败时由调用者统一释放
+  const auto gep = result.gep.get();
+  if (result.generalized) {
+    GE_ASSERT_SUCCESS(result.ep->SetGeneralized(std::move(result.gep)));
+  } else {
+    GE_ASSERT_SUCCESS(result.ep->AddSpeculativeCompiled(std::move(result.gep)));
+  }
+  GE_ASSERT_TRUE(geps_to_inner_ge_graph_id_.emplace(gep, result.instance_id).second);
+  compiled_ge_graph_id_.emplace_back(result.instance_id);
+  return SUCCESS;
+}
+
+Status JitExecutor::ReleaseSpeculativeCompiled() {
+  if (speculative_compiler_ == nullptr) {
+    return SUCCESS;
+  }
+  // 后台编译完成但尚未放入cache的结果，需要在这里释放
+  auto results = speculative_compiler_->Finalize();
+  for (auto &result : results) {
+    GELOGI("[Jit]RemoveGraph %u of unused speculative compile result", result.instance_id);
+    (void)result.gep->RemoveItem();
+    GE_ASSERT_SUCCESS(graph_manager_.RemoveGraph(result.instance_id));
+  }
+  speculative_compiler_.reset();
+  return SUCCESS;
+}
+
 Status JitExecutor::TryExecuteWithoutProcess(UserGraphExecution &task) {
   const auto first_ep = order_.GetFirstPoint();
   if (first_ep == nullptr || !first_ep->IsLast()) {
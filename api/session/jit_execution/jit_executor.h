@@ -21,6 +21,7 @@
 #include "exe_points/execution_order.h"
 #include "cache/compiled_model_cache.h"
 #include "compile_context.h"
+#include "speculative_compiler.h"
 #include "graph/utils/tensor_adapter.h"
 #include "graph/utils/type_utils.h"
 
@@ -93,6 +94,12 @@ class JitExecutor {
                                      const std::vector<gert::Tensor> &inputs, std::vector<gert::Tensor> &outputs,
                                      ExecutionPoint *ep, bool need_malloc_output = false);
   Status TryExecuteWithoutProcess(UserGraphExecution &task);
+  GuardedExecutionPoint *FindOrCreateGuardedAsync(ExecutionPoint *ep, const std::vector<gert::Tensor> &compile_inputs,
+                                                  uint64_t session_id);
+  Status SwapInSpeculativeCompiled(const aclrtStream stream, const std::map<AscendString, AscendString> &load_options);
+  Status SwapInSpeculativeCompiled(SpeculativeCompileResult &result, const aclrtStream stream,
+                                   const std::map<AscendString, AscendString> &load_options);
+  Status ReleaseSpeculativeCompiled();
   Status MallocOutputsForStatic(uint32_t guarded_ep_instance_id, const GuardedExecutionPoint *gep,
                                 std::vector<gert::Tensor> &outputs);
 
@@ -109,6 +116,7 @@ class JitExecutor {
   int32_t device_id_{-1};
   std::vector<uint32_t> compiled_ge_graph_id_;
   std::shared_ptr<ge::Allocator> external_allocator_{nullptr};
+  std::unique_ptr<SpeculativeCompiler> speculative_compiler_;
 };
 }  // namespace ge
 
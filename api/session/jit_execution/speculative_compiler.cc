@@ -0,0 +1,281 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "speculative_compiler.h"
+
+#include <sstream>
+#include "common/checker.h"
+#include "common/memory/tensor_trans_utils.h"
+#include "common/compile_profiling/ge_call_wrapper.h"
+#include "graph/ge_local_context.h"
+#include "base/err_mgr.h"
+#include "acl/acl_rt.h"
+
+namespace ge {
+namespace {
+constexpr size_t kPredictHistorySize = 3U;
+constexpr uint32_t kSpeculativeCompileThreadNum = 1U;
+constexpr int64_t kUnknownDim = -1;
+
+bool IsOptionEnabled(const char_t *option_key) {
+  std::string option_value;
+  (void)GetThreadLocalContext().GetOption(option_key, option_value);
+  return option_value == "1";
+}
+
+gert::Tensor MakeShapeOnlyTensor(const gert::Tensor &src, const gert::Shape &origin_shape,
+                                 const gert::Shape &storage_shape) {
+  gert::Tensor tensor(src.GetShape(), src.GetFormat(), src.GetDataType());
+  tensor.MutableOriginShape() = origin_shape;
+  tensor.MutableStorageShape() = storage_shape;
+  tensor.MutableTensorData().SetPlacement(gert::kOnDeviceHbm);
+  return tensor;
+}
+
+gert::Shape GeneralizeShape(const gert::Shape &shape) {
+  gert::Shape generalized = shape;
+  for (size_t i = 0U; i < generalized.GetDimNum(); ++i) {
+    generalized.SetDim(i, kUnknownDim);
+  }
+  return generalized;
+}
+}  // namespace
+
+bool ShapeBucketPredictor::RecordAndPredict(int64_t ep_id, const std::vector<gert::Shape> &shapes,
+                                            std::vector<gert::Shape> &predicted) {
+  auto &history = miss_history_[ep_id];
+  history.emplace_back(shapes);
+  if (history.size() > kPredictHistorySize) {
+    history.pop_front();
+  }
+  if (history.size() < kPredictHistorySize) {
+    return false;
+  }
+  const auto &first = history[0U];
+  const auto &second = history[1U];
+  const auto &third = history[2U];
+  if ((first.size() != second.size()) || (second.size() != third.size())) {
+    return false;
+  }
+  predicted.clear();
+  bool has_step = false;
+  for (size_t i = 0U; i < third.size(); ++i) {
+    if ((first[i].GetDimNum() != second[i].GetDimNum()) || (second[i].GetDimNum() != third[i].GetDimNum())) {
+      return false;
+    }
+    gert::Shape next = third[i];
+    for (size_t dim = 0U; dim < third[i].GetDimNum(); ++dim) {
+      const int64_t last_step = second[i].GetDim(dim) - first[i].GetDim(dim);
+      const int64_t step = third[i].GetDim(dim) - second[i].GetDim(dim);
+      if (last_step != step) {
+        return false;
+      }
+      const int64_t next_dim = third[i].GetDim(dim) + step;
+      if (next_dim <= 0) {
+        return false;
+      }
+      has_step = has_step || (step != 0);
+      next.SetDim(dim, next_dim);
+    }
+    predicted.emplace_back(next);
+  }
+  return has_step;
+}
+
+SpeculativeCompiler::SpeculativeCompiler(CompileContext &compile_context, CompiledModelCache &cmc, std::mutex &mutex,
+                                         int32_t device_id)
+    : compile_context_(compile_context), cmc_(cmc), mutex_(mutex), device_id_(device_id) {
+  async_compile_enabled_ = IsOptionEnabled(kOptionJitAsyncCompile);
+  shape_prediction_enabled_ = async_compile_enabled_ && IsOptionEnabled(kOptionJitShapePrediction);
+  if (async_compile_enabled_) {
+    compile_pool_ = MakeUnique<ThreadPool>("jit_spec", kSpeculativeCompileThreadNum, true);
+  }
+  GELOGI("Jit async compile enabled: %d, shape prediction enabled: %d.", static_cast<int32_t>(async_compile_enabled_),
+         static_cast<int32_t>(shape_prediction_enabled_));
+}
+
+SpeculativeCompiler::~SpeculativeCompiler() {
+  (void)Finalize();
+}
+
+bool SpeculativeCompiler::IsSupportedInputs(const std::vector<gert::Tensor> &inputs) {
+  // 值依赖的host输入需要拷贝数据，后台编译只基于shape，不支持
+  return std::none_of(inputs.cbegin(), inputs.cend(), [](const gert::Tensor &input) {
+    return gert::TensorPlacementUtils::IsOnHost(input.GetPlacement());
+  });
+}
+
+std::string SpeculativeCompiler::GenSignature(int64_t ep_id, const std::vector<gert::Tensor> &inputs,
+                                              bool generalized) {
+  std::stringstream ss;
+  ss << ep_id << (generalized ? ":G" : ":S");
+  if (generalized) {
+    return ss.str();
+  }
+  for (const auto &input : inputs) {
+    ss << "|" << static_cast<int32_t>(input.GetDataType());
+    const auto &shape = input.GetStorageShape();
+    for (size_t i = 0U; i < shape.GetDimNum(); ++i) {
+      ss << "," << shape.GetDim(i);
+    }
+  }
+  return ss.str();
+}
+
+Status SpeculativeCompiler::OnGuardMiss(ExecutionPoint *ep, const std::vector<gert::Tensor> &inputs,
+                                        uint64_t session_id) {
+  GE_ASSERT_NOTNULL(ep);
+  if (!async_compile_enabled_) {
+    return SUCCESS;
+  }
+  std::vector<gert::Tensor> shape_inputs;
+  std::vector<gert::Shape> miss_shapes;
+  bool can_predict = shape_prediction_enabled_;
+  for (const auto &input : inputs) {
+    shape_inputs.emplace_back(MakeShapeOnlyTensor(input, input.GetOriginShape(), input.GetStorageShape()));
+    miss_shapes.emplace_back(input.GetStorageShape());
+    // 预测仅处理origin与storage一致的场景，避免推导私有格式的shape
+    can_predict = can_predict && (input.GetOriginShape() == input.GetStorageShape());
+  }
+  GE_ASSERT_SUCCESS(Submit(ep, std::move(shape_inputs), false, session_id));
+
+  std::vector<gert::Shape> predicted_shapes;
+  if (!can_predict || !predictor_.RecordAndPredict(ep->GetId(), miss_shapes, predicted_shapes)) {
+    return SUCCESS;
+  }
+  std::vector<gert::Tensor> predicted_inputs;
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    predicted_inputs.emplace_back(MakeShapeOnlyTensor(inputs[i], predicted_shapes[i], predicted_shapes[i]));
+  }
+  if (ep->FindGuarded(predicted_inputs) != nullptr) {
+    GELOGD("Predicted shape of EP[%ld] is already covered by guard cache.", ep->GetId());
+    return SUCCESS;
+  }
+  GELOGI("Predict next guard miss of EP[%ld], submit speculative compile.", ep->GetId());
+  return Submit(ep, std::move(predicted_inputs), false, session_id);
+}
+
+Status SpeculativeCompiler::SubmitGeneralized(ExecutionPoint *ep, const std::vector<gert::Tensor> &inputs,
+                                              uint64_t session_id) {
+  GE_ASSERT_NOTNULL(ep);
+  if (!async_compile_enabled_) {
+    return SUCCESS;
+  }
+  {
+    std::lock_guard<std::mutex> ready_locker(ready_mutex_);
+    if (!generalized_eps_.insert(ep->GetId()).second) {
+      return SUCCESS;
+    }
+  }
+  std::vector<gert::Tensor> shape_inputs;
+  for (const auto &input : inputs) {
+    shape_inputs.emplace_back(
+        MakeShapeOnlyTensor(input, GeneralizeShape(input.GetOriginShape()), GeneralizeShape(input.GetStorageShape())));
+  }
+  return Submit(ep, std::move(shape_inputs), true, session_id);
+}
+
+Status SpeculativeCompiler::Submit(ExecutionPoint *ep, std::vector<gert::Tensor> &&shape_inputs, bool generalized,
+                                   uint64_t session_id) {
+  GE_ASSERT_NOTNULL(compile_pool_);
+  auto signature = GenSignature(ep->GetId(), shape_inputs, generalized);
+  {
+    std::lock_guard<std::mutex> ready_locker(ready_mutex_);
+    if (!inflight_signatures_.insert(signature).second) {
+      GELOGD("Speculative compile [%s] is already in flight.", signature.c_str());
+      return SUCCESS;
+    }
+  }
+  GELOGI("Submit speculative compile [%s], session_id: %llu.", signature.c_str(), session_id);
+  // 后台线程需要与提交线程一致的session/graph option与错误码上下文
+  const auto ge_context = GetThreadLocalContext();
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  auto fut = compile_pool_->commit(
+      [this, ep, signature, generalized, session_id, ge_context,
+       err_msg_ctx](const std::vector<gert::Tensor> &compile_inputs) {
+        error_message::SetErrMgrContext(err_msg_ctx);
+        GetThreadLocalContext() = ge_context;
+        CompileInBackground(ep, compile_inputs, generalized, signature, session_id);
+      },
+      std::move(shape_inputs));
+  GE_ASSERT_TRUE(fut.valid(), "Submit speculative compile [%s] failed.", signature.c_str());
+  return SUCCESS;
+}
+
+void SpeculativeCompiler::CompileInBackground(ExecutionPoint *ep, const std::vector<gert::Tensor> &shape_inputs,
+                                              bool generalized, const std::string &signature, uint64_t session_id) {
+  const auto compile_func = [&]() -> Status {
+    GE_ASSERT_RT_OK(aclrtSetDevice(device_id_));
+    auto gep = MakeUnique<GuardedExecutionPoint>(ep);
+    GE_ASSERT_NOTNULL(gep);
+    GE_ASSERT_SUCCESS(gep->CopySlicedGraph());
+    uint32_t instance_id = 0U;
+    std::map<std::string, std::string> options;
+    {
+      // compile mutex仅保护图id与cache key的生成，编译本身由CompileContext内部锁串行，不阻塞前台guard命中的请求
+      std::lock_guard<std::mutex> locker(mutex_);
+      if (stopped_.load()) {
+        return SUCCESS;
+      }
+      instance_id = compile_context_.GenNewGraphId();
+      if (generalized) {
+        options = ep->GetEpGraphOptions();
+      } else {
+        GE_ASSERT_SUCCESS(cmc_.CreateKeyOptionForGuardedExecutionPoint(gep.get(), options));
+      }
+    }
+    GE_TIMESTAMP_START(SpeculativeCompile);
+    GE_ASSERT_SUCCESS(compile_context_.Compile(instance_id, gep->GetGraph(), shape_inputs, options, session_id),
+                      "GEP:%u, EP:%ld, session_id:%llu", instance_id, ep->GetId(), session_id);
+    GE_TIMESTAMP_END(SpeculativeCompile, "SpeculativeCompile");
+    if (generalized) {
+      gep->SetGeneralized(instance_id, shape_inputs);
+    } else {
+      GE_ASSERT_TRUE(gep->SetCompiled(instance_id, gep->GetGraph()));
+    }
+    GELOGI("Speculative compile [%s] finished, GEP[%u] of EP[%ld] is ready.", signature.c_str(), instance_id,
+           ep->GetId());
+    std::lock_guard<std::mutex> ready_locker(ready_mutex_);
+    SpeculativeCompileResult result;
+    result.ep = ep;
+    result.gep = std::move(gep);
+    result.instance_id = instance_id;
+    result.generalized = generalized;
+    ready_results_.emplace_back(std::move(result));
+    return SUCCESS;
+  };
+  if (stopped_.load()) {
+    return;
+  }
+  if (compile_func() != SUCCESS) {
+    // 后台编译失败不影响主流程，guard miss时退化为同步编译
+    GELOGW("Speculative compile [%s] failed, fallback to synchronous compile.", signature.c_str());
+  }
+  std::lock_guard<std::mutex> ready_locker(ready_mutex_);
+  (void)inflight_signatures_.erase(signature);
+}
+
+std::vector<SpeculativeCompileResult> SpeculativeCompiler::FetchReady() {
+  std::vector<SpeculativeCompileResult> results;
+  std::lock_guard<std::mutex> ready_locker(ready_mutex_);
+  results.swap(ready_results_);
+  return results;
+}
+
+std::vector<SpeculativeCompileResult> SpeculativeCompiler::Finalize() {
+  if (stopped_.exchange(true)) {
+    return {};
+  }
+  if (compile_pool_ != nullptr) {
+    compile_pool_->Destroy();
+  }
+  return FetchReady();
+}
+}  // namespace ge
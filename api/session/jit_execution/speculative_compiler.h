@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SPECULATIVE_COMPILER_H
+#define SPECULATIVE_COMPILER_H
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "exe_graph/runtime/runtime_tensor.h"
+#include "ge/ge_api_types.h"
+#include "common/thread_pool/thread_pool.h"
+#include "exe_points/execution_point.h"
+#include "cache/compiled_model_cache.h"
+#include "compile_context.h"
+
+namespace ge {
+// "1"开启异步编译：guard miss时若存在泛化编译结果则先用其执行，特化图在后台线程编译完成后再放入GuardCheckCache
+constexpr const char_t *kOptionJitAsyncCompile = "ge.jit.asyncCompile";
+// "1"开启shape预测：根据最近几次guard miss的shape步长预测下一个shape并提前编译
+constexpr const char_t *kOptionJitShapePrediction = "ge.jit.shapePrediction";
+
+struct SpeculativeCompileResult {
+  ExecutionPoint *ep{nullptr};
+  std::unique_ptr<GuardedExecutionPoint> gep;
+  uint32_t instance_id{0U};
+  bool generalized{false};
+};
+
+/**
+ * 根据最近几次guard miss的输入shape预测下一个可能出现的shape，
+ * 当连续三次miss的各维度呈等差变化时(如按seq len分桶递增)，预测下一个桶的shape
+ */
+class ShapeBucketPredictor {
+ public:
+  /**
+   * 记录一次guard miss的输入shape
+   *
+   * @param ep_id miss所在的EP
+   * @param shapes 各输入的storage shape
+   * @param predicted 预测出的下一组shape
+   * @return 是否预测成功
+   */
+  bool RecordAndPredict(int64_t ep_id, const std::vector<gert::Shape> &shapes, std::vector<gert::Shape> &predicted);
+
+ private:
+  std::map<int64_t, std::deque<std::vector<gert::Shape>>> miss_history_;
+};
+
+class SpeculativeCompiler {
+ public:
+  SpeculativeCompiler(CompileContext &compile_context, CompiledModelCache &cmc, std::mutex &mutex,
+                      int32_t device_id);
+  ~SpeculativeCompiler();
+
+  bool IsAsyncCompileEnabled() const {
+    return async_compile_enabled_;
+  }
+
+  /**
+   * guard miss时调用，调用者需持有compile mutex。
+   * 提交当前输入的特化编译任务，若尚无泛化编译结果则同时提交泛化编译任务，开启预测时提交预测shape的编译任务
+   *
+   * @param ep 发生guard miss的EP
+   * @param inputs 编译输入，不支持host输入(值依赖场景)
+   * @param session_id
+   * @return
+   */
+  Status OnGuardMiss(ExecutionPoint *ep, const std::vector<gert::Tensor> &inputs, uint64_t session_id);
+
+  /**
+   * 同步编译完成第一份特化结果后调用，在后台补充泛化编译
+   */
+  Status SubmitGeneralized(ExecutionPoint *ep, const std::vector<gert::Tensor> &inputs, uint64_t session_id);
+
+  /**
+   * 取出后台已完成编译的结果，调用者负责放入GuardCheckCache并加载
+   */
+  std::vector<SpeculativeCompileResult> FetchReady();
+
+  /**
+   * 停止后台编译线程，返回尚未被取走的编译结果供调用者释放
+   */
+  std::vector<SpeculativeCompileResult> Finalize();
+
+  static bool IsSupportedInputs(const std::vector<gert::Tensor> &inputs);
+
+ private:
+  Status Submit(ExecutionPoint *ep, std::vector<gert::Tensor> &&shape_inputs, bool generalized, uint64_t session_id);
+  void CompileInBackground(ExecutionPoint *ep, const std::vector<gert::Tensor> &shape_inputs, bool generalized,
+                           const std::string &signature, uint64_t session_id);
+  static std::string GenSignature(int64_t ep_id, const std::vector<gert::Tensor> &inputs, bool generalized);
+
+  CompileContext &compile_context_;
+  CompiledModelCache &cmc_;
+  std::mutex &mutex_;
+  int32_t device_id_;
+  bool async_compile_enabled_{false};
+  bool shape_prediction_enabled_{false};
+  std::atomic_bool stopped_{false};
+  ShapeBucketPredictor predictor_;
+
+  std::mutex ready_mutex_;
+  std::set<std::string> inflight_signatures_;
+  std::set<int64_t> generalized_eps_;
+  std::vector<SpeculativeCompileResult> ready_results_;
+  std::unique_ptr<ThreadPool> compile_pool_;
+};
+}  // namespace ge
+
+#endif  // SPECULATIVE_COMPILER_H
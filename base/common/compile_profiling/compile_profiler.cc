@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "common/compile_profiling/compile_profiler.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <fstream>
+#include <sys/resource.h>
+#include <unistd.h>
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/util.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/attr_utils.h"
+#include "graph_metadef/graph/utils/file_utils.h"
+#include "mmpa/mmpa_api.h"
+#include "nlohmann/json.hpp"
+
+namespace ge {
+namespace {
+constexpr const char_t *kEnvCompileProfile = "GE_COMPILE_PROFILE";
+constexpr const char_t *kEnvCompileProfileTopN = "GE_COMPILE_PROFILE_TOP_N";
+constexpr size_t kDefaultTopN = 20U;
+constexpr int32_t kJsonIndent = 2;
+
+nlohmann::json RecordToJson(const PassProfileRecord &record) {
+  nlohmann::json record_json;
+  record_json["pass"] = record.pass_name;
+  if (!record.graph_name.empty()) {
+    record_json["graph"] = record.graph_name;
+  }
+  record_json["run_count"] = record.run_count;
+  record_json["total_time_us"] = record.total_time_us;
+  record_json["max_time_us"] = record.max_time_us;
+  record_json["rss_delta_kb"] = record.rss_delta_kb;
+  record_json["peak_rss_delta_kb"] = record.max_peak_rss_delta_kb;
+  if (record.nodes_before >= 0L) {
+    record_json["nodes_before"] = record.nodes_before;
+    record_json["nodes_after"] = record.nodes_after;
+    record_json["edges_before"] = record.edges_before;
+    record_json["edges_after"] = record.edges_after;
+  }
+  return record_json;
+}
+
+void SortBySeq(std::vector<PassProfileRecord> &records) {
+  std::sort(records.begin(), records.end(),
+            [](const PassProfileRecord &lhs, const PassProfileRecord &rhs) { return lhs.seq < rhs.seq; });
+}
+
+// 带上session_graph_id，避免不同session中graph id相同的图互相覆盖
+std::string GetDefaultProfilePath(const std::string &compile_key, uint32_t graph_id) {
+  std::string ascend_work_path;
+  GE_CHK_BOOL_EXEC(GetAscendWorkPath(ascend_work_path) == SUCCESS, return "", "Failed to get ASCEND_WORK_PATH");
+  const std::string file_name = "ge_compile_profile_" + std::to_string(mmGetPid()) + "_" +
+                                (compile_key.empty() ? std::to_string(graph_id) : compile_key) + ".json";
+  return ascend_work_path.empty() ? file_name : (ascend_work_path + "/" + file_name);
+}
+}  // namespace
+
+CompileProfiler::CompileProfiler() : top_n_(kDefaultTopN) {
+  const char_t *compile_profile = std::getenv(kEnvCompileProfile);
+  enabled_ = (compile_profile != nullptr) && (std::string(compile_profile) == "1");
+  const char_t *top_n = std::getenv(kEnvCompileProfileTopN);
+  if (top_n != nullptr) {
+    const auto value = std::strtoull(top_n, nullptr, 10);
+    top_n_ = (value == 0ULL) ? kDefaultTopN : static_cast<size_t>(value);
+  }
+  GELOGI("[Compile Profiling] enabled %d, top n %zu", static_cast<int32_t>(IsEnabled()), top_n_);
+}
+
+CompileProfiler &CompileProfiler::GetInstance() {
+  static CompileProfiler instance;
+  return instance;
+}
+
+void CompileProfiler::Record(const std::string &compile_key, const std::string &pass_name,
+                             const std::string &graph_name, const PassProfileSample &sample) {
+  std::lock_guard<std::mutex> lk(mu_);
+  auto &record = records_[std::make_tuple(compile_key, pass_name, graph_name)];
+  if (record.run_count == 0UL) {
+    record.compile_key = compile_key;
+    record.pass_name = pass_name;
+    record.graph_name = graph_name;
+    record.seq = next_seq_++;
+    record.nodes_before = sample.nodes_before;
+    record.edges_before = sample.edges_before;
+  }
+  record.run_count += sample.run_count;
+  record.total_time_us += sample.time_cost_us;
+  record.max_time_us = std::max(record.max_time_us, sample.time_cost_us);
+  record.rss_delta_kb += sample.rss_delta_kb;
+  record.max_peak_rss_delta_kb = std::max(record.max_peak_rss_delta_kb, sample.peak_rss_delta_kb);
+  if (sample.nodes_after >= 0L) {
+    record.nodes_after = sample.nodes_after;
+    record.edges_after = sample.edges_after;
+  }
+}
+
+std::vector<PassProfileRecord> CompileProfiler::GetRecords(const std::string &compile_key) const {
+  std::vector<PassProfileRecord> records;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    for (auto it = records_.lower_bound(std::make_tuple(compile_key, std::string(), std::string()));
+         (it != records_.cend()) && (std::get<0U>(it->first) == compile_key); ++it) {
+      records.emplace_back(it->second);
+    }
+  }
+  SortBySeq(records);
+  return records;
+}
+
+std::vector<PassProfileRecord> CompileProfiler::TakeRecords(const std::string &compile_key) {
+  std::vector<PassProfileRecord> records;
+  {
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = records_.lower_bound(std::make_tuple(compile_key, std::string(), std::string()));
+    while ((it != records_.end()) && (std::get<0U>(it->first) == compile_key)) {
+      records.emplace_back(it->second);
+      it = records_.erase(it);
+    }
+  }
+  SortBySeq(records);
+  return records;
+}
+
+std::vector<PassProfileRecord> CompileProfiler::GetTopPasses(const std::string &compile_key) const {
+  return GetTopPasses(GetRecords(compile_key));
+}
+
+std::vector<PassProfileRecord> CompileProfiler::GetTopPasses(const std::vector<PassProfileRecord> &records) const {
+  std::map<std::string, PassProfileRecord> name_to_records;
+  for (const auto &record : records) {
+    auto &pass_record = name_to_records[record.pass_name];
+    if (pass_record.run_count == 0UL) {
+      pass_record.compile_key = record.compile_key;
+      pass_record.pass_name = record.pass_name;
+      pass_record.seq = record.seq;
+    }
+    pass_record.run_count += record.run_count;
+    pass_record.total_time_us += record.total_time_us;
+    pass_record.max_time_us = std::max(pass_record.max_time_us, record.max_time_us);
+    pass_record.rss_delta_kb += record.rss_delta_kb;
+    pass_record.max_peak_rss_delta_kb = std::max(pass_record.max_peak_rss_delta_kb, record.max_peak_rss_delta_kb);
+  }
+  std::vector<PassProfileRecord> top_passes;
+  top_passes.reserve(name_to_records.size());
+  for (auto &name_to_record : name_to_records) {
+    top_passes.emplace_back(std::move(name_to_record.second));
+  }
+  std::sort(top_passes.begin(), top_passes.end(), [](const PassProfileRecord &lhs, const PassProfileRecord &rhs) {
+    return (lhs.total_time_us != rhs.total_time_us) ? (lhs.total_time_us > rhs.total_time_us) : (lhs.seq < rhs.seq);
+  });
+  if (top_passes.size() > top_n_) {
+    top_passes.resize(top_n_);
+  }
+  return top_passes;
+}
+
+std::string CompileProfiler::ToJson(const std::vector<PassProfileRecord> &records, const std::string &root_graph_name,
+                                    uint32_t graph_id) const {
+  nlohmann::json profile_json;
+  profile_json["graph_name"] = root_graph_name;
+  profile_json["graph_id"] = graph_id;
+  uint64_t total_time_us = 0UL;
+  nlohmann::json passes_json = nlohmann::json::array();
+  for (const auto &record : records) {
+    passes_json.emplace_back(RecordToJson(record));
+  }
+  nlohmann::json top_json = nlohmann::json::array();
+  for (const auto &record : GetTopPasses(records)) {
+    top_json.emplace_back(RecordToJson(record));
+    total_time_us += record.total_time_us;
+  }
+  profile_json["top_passes_time_us"] = total_time_us;
+  profile_json["top_passes"] = std::move(top_json);
+  profile_json["passes"] = std::move(passes_json);
+  return profile_json.dump(kJsonIndent);
+}
+
+Status CompileProfiler::Dump(const std::string &compile_key, const std::string &root_graph_name, uint32_t graph_id,
+                             std::string &path) {
+  if (path.empty()) {
+    path = GetDefaultProfilePath(compile_key, graph_id);
+  }
+  // 只取出本次编译的记录，其他并发编译的记录保留到各自落盘
+  const auto records = TakeRecords(compile_key);
+  GEEVENT("[Compile Profiling] top %zu passes of graph %s(%u):", top_n_, root_graph_name.c_str(), graph_id);
+  for (const auto &record : GetTopPasses(records)) {
+    GEEVENT("[Compile Profiling] %s: total %" PRIu64 " us, max %" PRIu64 " us, run %" PRIu64
+            " times, peak rss +%" PRId64 " KB",
+            record.pass_name.c_str(), record.total_time_us, record.max_time_us, record.run_count,
+            record.max_peak_rss_delta_kb);
+  }
+  const auto profile_json = ToJson(records, root_graph_name, graph_id);
+  std::ofstream profile_file(path, std::ios::out | std::ios::trunc);
+  if (!profile_file.is_open()) {
+    GELOGW("[Compile Profiling] Failed to open %s.", path.c_str());
+    return FAILED;
+  }
+  profile_file << profile_json;
+  GEEVENT("[Compile Profiling] profile of graph %s(%u) is written to %s", root_graph_name.c_str(), graph_id,
+          path.c_str());
+  return SUCCESS;
+}
+
+void CompileProfiler::Reset() {
+  std::lock_guard<std::mutex> lk(mu_);
+  records_.clear();
+  next_seq_ = 0UL;
+}
+
+std::string CompileProfiler::GetCompileKey(const ComputeGraphPtr &graph) {
+  std::string compile_key;
+  auto current_graph = graph;
+  while (current_graph != nullptr) {
+    if (AttrUtils::GetStr(current_graph, ATTR_NAME_SESSION_GRAPH_ID, compile_key) && (!compile_key.empty())) {
+      return compile_key;
+    }
+    current_graph = current_graph->GetParentGraph();
+  }
+  return "";
+}
+
+void CompileProfiler::GetGraphSize(const ComputeGraphPtr &graph, int64_t &node_num, int64_t &edge_num) {
+  node_num = 0L;
+  edge_num = 0L;
+  if (graph == nullptr) {
+    return;
+  }
+  for (const auto node : graph->GetDirectNodePtr()) {
+    ++node_num;
+    for (const auto out_anchor : node->GetAllOutDataAnchorsPtr()) {
+      edge_num += static_cast<int64_t>(out_anchor->GetPeerInDataNodesSize());
+    }
+    edge_num += static_cast<int64_t>(node->GetOutControlNodes().size());
+  }
+}
+
+void CompileProfiler::GetRss(int64_t &rss_kb, int64_t &peak_rss_kb) {
+  rss_kb = 0L;
+  peak_rss_kb = 0L;
+  std::ifstream statm("/proc/self/statm");
+  int64_t size_pages = 0L;
+  int64_t rss_pages = 0L;
+  if (statm >> size_pages >> rss_pages) {
+    rss_kb = rss_pages * static_cast<int64_t>(sysconf(_SC_PAGESIZE)) / 1024L;
+  }
+  struct rusage usage {};
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+    peak_rss_kb = static_cast<int64_t>(usage.ru_maxrss);
+  }
+}
+
+PassProfileScope::PassProfileScope(const std::string &pass_name, const ComputeGraphPtr &graph)
+    : enabled_(CompileProfiler::GetInstance().IsEnabled()), pass_name_(pass_name), graph_(graph) {
+  if (!enabled_) {
+    return;
+  }
+  CompileProfiler::GetGraphSize(graph_, sample_.nodes_before, sample_.edges_before);
+  CompileProfiler::GetRss(rss_kb_, peak_rss_kb_);
+  start_time_us_ = GetCurrentTimestamp();
+}
+
+PassProfileScope::~PassProfileScope() {
+  if (!enabled_) {
+    return;
+  }
+  sample_.time_cost_us = GetCurrentTimestamp() - start_time_us_;
+  int64_t rss_kb = 0L;
+  int64_t peak_rss_kb = 0L;
+  CompileProfiler::GetRss(rss_kb, peak_rss_kb);
+  sample_.rss_delta_kb = rss_kb - rss_kb_;
+  sample_.peak_rss_delta_kb = peak_rss_kb - peak_rss_kb_;
+  CompileProfiler::GetGraphSize(graph_, sample_.nodes_after, sample_.edges_after);
+  CompileProfiler::GetInstance().Record(CompileProfiler::GetCompileKey(graph_), pass_name_,
+                                       (graph_ == nullptr) ? "" : graph_->GetName(), sample_);
+}
+}  // namespace ge
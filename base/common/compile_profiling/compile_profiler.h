@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GE_COMMON_COMPILE_PROFILING_COMPILE_PROFILER_H_
+#define GE_COMMON_COMPILE_PROFILING_COMPILE_PROFILER_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "graph/compute_graph.h"
+#include "ge/ge_api_error_codes.h"
+
+namespace ge {
+// pass执行前后的采样，节点级pass一次采样可以覆盖多次调用
+struct PassProfileSample {
+  uint64_t run_count = 1UL;
+  uint64_t time_cost_us = 0UL;
+  int64_t rss_delta_kb = 0L;
+  int64_t peak_rss_delta_kb = 0L;
+  int64_t nodes_before = -1L;  // -1表示未统计
+  int64_t edges_before = -1L;
+  int64_t nodes_after = -1L;
+  int64_t edges_after = -1L;
+};
+
+// 同一次编译中同一pass在同一张图上的累计统计
+struct PassProfileRecord {
+  std::string compile_key;  // 所属编译，取图上的session_graph_id
+  std::string pass_name;
+  std::string graph_name;
+  uint64_t seq = 0UL;  // 首次执行的顺序
+  uint64_t run_count = 0UL;
+  uint64_t total_time_us = 0UL;
+  uint64_t max_time_us = 0UL;
+  int64_t rss_delta_kb = 0L;
+  int64_t max_peak_rss_delta_kb = 0L;
+  int64_t nodes_before = -1L;  // 首次执行前
+  int64_t edges_before = -1L;
+  int64_t nodes_after = -1L;  // 最后一次执行后
+  int64_t edges_after = -1L;
+};
+
+/**
+ * 编译profile：按(编译, pass, 图)记录耗时、执行次数、RSS变化和图规模变化，图编译结束时落盘为json，并打印按耗时排序的top N。
+ * 编译以根图上的session_graph_id区分，多个session或多张图并发编译时各自落盘，互不影响。
+ * 通过环境变量GE_COMPILE_PROFILE=1开启，GE_COMPILE_PROFILE_TOP_N指定summary条数，文件写到ASCEND_WORK_PATH下。
+ */
+class CompileProfiler {
+ public:
+  static CompileProfiler &GetInstance();
+
+  bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  void SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+  void SetTopN(size_t top_n) {
+    top_n_ = top_n;
+  }
+
+  void Record(const std::string &compile_key, const std::string &pass_name, const std::string &graph_name,
+              const PassProfileSample &sample);
+  std::vector<PassProfileRecord> GetRecords(const std::string &compile_key) const;
+  // 按pass汇总一次编译中所有图上的耗时，按总耗时降序取前top_n_个
+  std::vector<PassProfileRecord> GetTopPasses(const std::string &compile_key) const;
+  // 落盘compile_key对应的记录到path(为空时使用默认路径)，只清除已落盘的记录，返回实际写入的路径
+  Status Dump(const std::string &compile_key, const std::string &root_graph_name, uint32_t graph_id,
+              std::string &path);
+  void Reset();
+
+  // 图或其根图上的session_graph_id，没有时返回空
+  static std::string GetCompileKey(const ComputeGraphPtr &graph);
+  static void GetGraphSize(const ComputeGraphPtr &graph, int64_t &node_num, int64_t &edge_num);
+  // 当前进程的RSS和峰值RSS，单位KB
+  static void GetRss(int64_t &rss_kb, int64_t &peak_rss_kb);
+
+ private:
+  CompileProfiler();
+  // 取出compile_key对应的记录并从records_中删除
+  std::vector<PassProfileRecord> TakeRecords(const std::string &compile_key);
+  std::vector<PassProfileRecord> GetTopPasses(const std::vector<PassProfileRecord> &records) const;
+  std::string ToJson(const std::vector<PassProfileRecord> &records, const std::string &root_graph_name,
+                     uint32_t graph_id) const;
+
+  std::atomic<bool> enabled_{false};
+  size_t top_n_;
+  mutable std::mutex mu_;
+  uint64_t next_seq_ = 0UL;
+  // key: (compile_key, pass_name, graph_name)
+  std::map<std::tuple<std::string, std::string, std::string>, PassProfileRecord> records_;
+};
+
+// 在作用域内采样一次pass执行，profile未开启时不做任何统计
+class PassProfileScope {
+ public:
+  PassProfileScope(const std::string &pass_name, const ComputeGraphPtr &graph);
+  ~PassProfileScope();
+  PassProfileScope(const PassProfileScope &) = delete;
+  PassProfileScope &operator=(const PassProfileScope &) = delete;
+
+ private:
+  bool enabled_;
+  const std::string &pass_name_;
+  const ComputeGraphPtr &graph_;
+  uint64_t start_time_us_ = 0UL;
+  int64_t rss_kb_ = 0L;
+  int64_t peak_rss_kb_ = 0L;
+  PassProfileSample sample_;
+};
+}  // namespace ge
+
+#endif  // GE_COMMON_COMPILE_PROFILING_COMPILE_PROFILER_H_
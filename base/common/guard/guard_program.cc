@@ -0,0 +1,525 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "common/guard/guard_program.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+#include "securec.h"
+#include "framework/common/debug/ge_log.h"
+
+namespace ge {
+namespace {
+constexpr uint32_t kGuardProgramMagic = 0x50524755U;  // "UGRP"
+constexpr uint32_t kGuardProgramVersion = 1U;
+constexpr uint32_t kMaxRegisterNum = std::numeric_limits<uint16_t>::max() + 1U;
+constexpr double kFloatRelativeTolerance = 1e-6;
+constexpr char_t const *kDivideByZeroReason = "Check Symbol Check Expression divides by zero, guard missed.";
+
+bool FloatEqual(const double lhs, const double rhs) {
+  const double abs_diff = std::fabs(lhs - rhs);
+  if (abs_diff <= std::numeric_limits<double>::epsilon()) {
+    return true;
+  }
+  return (abs_diff / std::max(std::fabs(lhs), std::fabs(rhs))) <= kFloatRelativeTolerance;
+}
+
+template <typename T>
+int64_t LoadElement(const gert::Tensor *tensor, const int64_t elem_idx) {
+  const auto *data = tensor->GetData<T>();
+  if ((data == nullptr) || (elem_idx < 0) || (static_cast<size_t>(elem_idx) >= tensor->GetSize() / sizeof(T))) {
+    return -1;
+  }
+  return static_cast<int64_t>(data[elem_idx]);
+}
+
+template <typename T>
+int64_t LoadSum(const gert::Tensor *tensor) {
+  const auto *data = tensor->GetData<T>();
+  if (data == nullptr) {
+    return -1;
+  }
+  int64_t sum = 0;
+  const size_t elem_num = tensor->GetSize() / sizeof(T);
+  for (size_t i = 0U; i < elem_num; ++i) {
+    sum += static_cast<int64_t>(data[i]);
+  }
+  return sum;
+}
+
+template <typename T>
+int64_t LoadFirst(const gert::Tensor *tensor) {
+  const auto *data = tensor->GetData<uint8_t>();
+  if ((data == nullptr) || (tensor->GetSize() < sizeof(T))) {
+    return -1;
+  }
+  return static_cast<int64_t>(*reinterpret_cast<const T *>(data));
+}
+
+int64_t LoadByDataType(const gert::Tensor *tensor, const DataType dtype, const bool is_sum, const int64_t elem_idx) {
+  switch (dtype) {
+    case DT_INT32:
+      return is_sum ? LoadSum<int32_t>(tensor) : LoadElement<int32_t>(tensor, elem_idx);
+    case DT_INT64:
+      return is_sum ? LoadSum<int64_t>(tensor) : LoadElement<int64_t>(tensor, elem_idx);
+    case DT_UINT32:
+      return is_sum ? LoadSum<uint32_t>(tensor) : LoadElement<uint32_t>(tensor, elem_idx);
+    case DT_UINT64:
+      return is_sum ? LoadSum<uint64_t>(tensor) : LoadElement<uint64_t>(tensor, elem_idx);
+    default:
+      return -1;
+  }
+}
+
+// 与InputValueForCondSource生成的代码一致，按输入的实际数据类型取首个元素
+int64_t LoadCondValue(const gert::Tensor *tensor) {
+  switch (tensor->GetDataType()) {
+    case DT_STRING:
+      return (tensor->GetSize() > (sizeof(StringHead) + 1U)) ? 1 : 0;
+    case DT_BOOL:
+      return LoadFirst<bool>(tensor);
+    case DT_FLOAT:
+      return LoadFirst<float>(tensor);
+    case DT_DOUBLE:
+      return LoadFirst<double>(tensor);
+    case DT_FLOAT16:
+    case DT_INT16:
+    case DT_UINT16:
+      return LoadFirst<int16_t>(tensor);
+    case DT_INT32:
+    case DT_UINT32:
+      return LoadFirst<int32_t>(tensor);
+    case DT_INT64:
+    case DT_UINT64:
+      return LoadFirst<int64_t>(tensor);
+    default:
+      return LoadFirst<uint8_t>(tensor);
+  }
+}
+
+int64_t LoadSource(const SourceLoadInfo &load_info, gert::Tensor **tensors, const size_t num_tensors) {
+  const gert::Tensor *tensor = nullptr;
+  if ((load_info.input_data_idx >= 0) && (static_cast<size_t>(load_info.input_data_idx) < num_tensors)) {
+    tensor = tensors[load_info.input_data_idx];
+  }
+  if (tensor == nullptr) {
+    return -1;
+  }
+  switch (load_info.type) {
+    case SourceLoadType::kInputShapeDim:
+      return tensor->GetOriginShape().GetDim(static_cast<size_t>(load_info.index));
+    case SourceLoadType::kInputRank:
+      return static_cast<int64_t>(tensor->GetOriginShape().GetDimNum());
+    case SourceLoadType::kInputValueElement:
+      return LoadByDataType(tensor, load_info.dtype, false, load_info.index);
+    case SourceLoadType::kInputValueSum:
+      return LoadByDataType(tensor, load_info.dtype, true, 0);
+    case SourceLoadType::kInputValueForCond:
+      return LoadCondValue(tensor);
+    default:
+      return -1;
+  }
+}
+
+bool NeedReason() {
+  const char_t *log_level = std::getenv("ASCEND_GLOBAL_LOG_LEVEL");
+  return (log_level != nullptr) && (std::atoi(log_level) <= 1);
+}
+
+void CopyReason(const std::string &msg, char_t *reason, const size_t reason_size) {
+  if ((reason == nullptr) || (reason_size == 0U) || !NeedReason()) {
+    return;
+  }
+  (void)strncpy_s(reason, reason_size, msg.c_str(), std::min(msg.size(), reason_size - 1U));
+  reason[reason_size - 1U] = '\0';
+}
+
+template <typename T>
+void AppendPod(std::string &buffer, const T &value) {
+  (void)buffer.append(reinterpret_cast<const char_t *>(&value), sizeof(T));
+}
+
+class Reader {
+ public:
+  explicit Reader(const std::string &data) : data_(data) {}
+
+  template <typename T>
+  bool Read(T &value) {
+    if (data_.size() - offset_ < sizeof(T)) {
+      return false;
+    }
+    (void)memcpy_s(&value, sizeof(T), data_.data() + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string &value) {
+    uint32_t len = 0U;
+    if (!Read(len) || (data_.size() - offset_ < len)) {
+      return false;
+    }
+    value.assign(data_.data() + offset_, len);
+    offset_ += len;
+    return true;
+  }
+
+  bool ReadCount(uint32_t &count, const size_t min_elem_size) {
+    return Read(count) && (static_cast<size_t>(count) * min_elem_size <= data_.size() - offset_);
+  }
+
+  bool IsEnd() const {
+    return offset_ == data_.size();
+  }
+
+ private:
+  const std::string &data_;
+  size_t offset_{0U};
+};
+
+bool IsValidInstruction(const GuardProgram::Instruction &instruction, const uint32_t register_num,
+                        const size_t load_num, const size_t const_num, const size_t reason_num) {
+  const size_t operand_num = std::max({static_cast<size_t>(register_num), load_num, const_num, reason_num});
+  if ((instruction.op >= GuardProgram::OpCode::kEnd) || (instruction.dst >= register_num) ||
+      (instruction.lhs >= operand_num) || (instruction.rhs >= operand_num)) {
+    return false;
+  }
+  switch (instruction.op) {
+    case GuardProgram::OpCode::kLoad:
+      return instruction.lhs < load_num;
+    case GuardProgram::OpCode::kConst:
+      return instruction.lhs < const_num;
+    case GuardProgram::OpCode::kCheck:
+      return (instruction.lhs < register_num) && (instruction.rhs < reason_num);
+    default:
+      return (instruction.lhs < register_num) && (instruction.rhs < register_num);
+  }
+}
+}  // namespace
+
+void GuardProgram::WriteReason(const size_t reason_idx, char_t *reason, const size_t reason_size) const {
+  CopyReason(reasons_[reason_idx], reason, reason_size);
+}
+
+bool GuardProgram::Check(gert::Tensor **tensors, const size_t num_tensors, char_t *reason,
+                         const size_t reason_size) const {
+  // 同一个program可能被多个线程同时执行，寄存器按线程分配
+  // load、常量和reason的下标也复用lhs/rhs字段，寄存器数不小于这些下标的范围，取操作数时不会越界
+  thread_local std::vector<Value> registers;
+  const size_t operand_num =
+      std::max({static_cast<size_t>(register_num_), loads_.size(), constants_.size(), reasons_.size()});
+  if (registers.size() < operand_num) {
+    registers.resize(operand_num);
+  }
+  Value *const regs = registers.data();
+  for (const auto &ins : instructions_) {
+    Value &dst = regs[ins.dst];
+    const Value &lhs = regs[ins.lhs];
+    const Value &rhs = regs[ins.rhs];
+    switch (ins.op) {
+      case OpCode::kLoad:
+        dst.int_value = LoadSource(loads_[ins.lhs], tensors, num_tensors);
+        break;
+      case OpCode::kConst:
+        dst = constants_[ins.lhs];
+        break;
+      case OpCode::kIntToFloat:
+        dst.float_value = static_cast<double>(lhs.int_value);
+        break;
+      case OpCode::kAddInt:
+        dst.int_value = lhs.int_value + rhs.int_value;
+        break;
+      case OpCode::kSubInt:
+        dst.int_value = lhs.int_value - rhs.int_value;
+        break;
+      case OpCode::kMulInt:
+        dst.int_value = lhs.int_value * rhs.int_value;
+        break;
+      case OpCode::kDivInt:
+      case OpCode::kModInt:
+        // guard_check.so中除零会直接崩溃，这里按检查失败处理
+        if ((rhs.int_value == 0) ||
+            ((rhs.int_value == -1) && (lhs.int_value == std::numeric_limits<int64_t>::min()))) {
+          CopyReason(kDivideByZeroReason, reason, reason_size);
+          return false;
+        }
+        dst.int_value = (ins.op == OpCode::kDivInt) ? (lhs.int_value / rhs.int_value) : (lhs.int_value % rhs.int_value);
+        break;
+      case OpCode::kMaxInt:
+        dst.int_value = std::max(lhs.int_value, rhs.int_value);
+        break;
+      case OpCode::kMinInt:
+        dst.int_value = std::min(lhs.int_value, rhs.int_value);
+        break;
+      case OpCode::kAbsInt:
+        dst.int_value = std::abs(lhs.int_value);
+        break;
+      case OpCode::kAddFloat:
+        dst.float_value = lhs.float_value + rhs.float_value;
+        break;
+      case OpCode::kSubFloat:
+        dst.float_value = lhs.float_value - rhs.float_value;
+        break;
+      case OpCode::kMulFloat:
+        dst.float_value = lhs.float_value * rhs.float_value;
+        break;
+      case OpCode::kDivFloat:
+        dst.float_value = lhs.float_value / rhs.float_value;
+        break;
+      case OpCode::kModFloat:
+        dst.float_value = std::fmod(lhs.float_value, rhs.float_value);
+        break;
+      case OpCode::kMaxFloat:
+        dst.float_value = (lhs.float_value > rhs.float_value) ? lhs.float_value : rhs.float_value;
+        break;
+      case OpCode::kMinFloat:
+        dst.float_value = (lhs.float_value < rhs.float_value) ? lhs.float_value : rhs.float_value;
+        break;
+      case OpCode::kAbsFloat:
+        dst.float_value = std::fabs(lhs.float_value);
+        break;
+      case OpCode::kPowFloat:
+        dst.float_value = std::pow(lhs.float_value, rhs.float_value);
+        break;
+      case OpCode::kExpFloat:
+        dst.float_value = std::exp(lhs.float_value);
+        break;
+      case OpCode::kLogFloat:
+        dst.float_value = std::log(lhs.float_value);
+        break;
+      case OpCode::kSqrtFloat:
+        dst.float_value = std::sqrt(lhs.float_value);
+        break;
+      case OpCode::kCeilFloat:
+        dst.float_value = std::ceil(lhs.float_value);
+        break;
+      case OpCode::kFloorFloat:
+        dst.float_value = std::floor(lhs.float_value);
+        break;
+      case OpCode::kEqInt:
+        dst.int_value = static_cast<int64_t>(lhs.int_value == rhs.int_value);
+        break;
+      case OpCode::kNeInt:
+        dst.int_value = static_cast<int64_t>(lhs.int_value != rhs.int_value);
+        break;
+      case OpCode::kLeInt:
+        dst.int_value = static_cast<int64_t>(lhs.int_value <= rhs.int_value);
+        break;
+      case OpCode::kLtInt:
+        dst.int_value = static_cast<int64_t>(lhs.int_value < rhs.int_value);
+        break;
+      case OpCode::kEqFloat:
+        dst.int_value = static_cast<int64_t>(FloatEqual(lhs.float_value, rhs.float_value));
+        break;
+      case OpCode::kNeFloat:
+        dst.int_value = static_cast<int64_t>(!FloatEqual(lhs.float_value, rhs.float_value));
+        break;
+      case OpCode::kLeFloat:
+        dst.int_value = static_cast<int64_t>(lhs.float_value <= rhs.float_value);
+        break;
+      case OpCode::kLtFloat:
+        dst.int_value = static_cast<int64_t>(lhs.float_value < rhs.float_value);
+        break;
+      case OpCode::kAnd:
+        dst.int_value = static_cast<int64_t>((lhs.int_value != 0) && (rhs.int_value != 0));
+        break;
+      case OpCode::kOr:
+        dst.int_value = static_cast<int64_t>((lhs.int_value != 0) || (rhs.int_value != 0));
+        break;
+      case OpCode::kCheck:
+        if (lhs.int_value == 0) {
+          WriteReason(ins.rhs, reason, reason_size);
+          return false;
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+std::string GuardProgram::Serialize() const {
+  std::string buffer;
+  AppendPod(buffer, kGuardProgramMagic);
+  AppendPod(buffer, kGuardProgramVersion);
+  AppendPod(buffer, register_num_);
+  AppendPod(buffer, static_cast<uint32_t>(instructions_.size()));
+  for (const auto &ins : instructions_) {
+    AppendPod(buffer, ins);
+  }
+  AppendPod(buffer, static_cast<uint32_t>(loads_.size()));
+  for (const auto &load_info : loads_) {
+    AppendPod(buffer, static_cast<int32_t>(load_info.type));
+    AppendPod(buffer, load_info.input_data_idx);
+    AppendPod(buffer, load_info.index);
+    AppendPod(buffer, static_cast<int32_t>(load_info.dtype));
+  }
+  AppendPod(buffer, static_cast<uint32_t>(constants_.size()));
+  for (const auto &value : constants_) {
+    AppendPod(buffer, value);
+  }
+  AppendPod(buffer, static_cast<uint32_t>(reasons_.size()));
+  for (const auto &msg : reasons_) {
+    AppendPod(buffer, static_cast<uint32_t>(msg.size()));
+    (void)buffer.append(msg);
+  }
+  return buffer;
+}
+
+std::shared_ptr<GuardProgram> GuardProgram::Deserialize(const std::string &data) {
+  Reader reader(data);
+  uint32_t magic = 0U;
+  uint32_t version = 0U;
+  auto program = std::make_shared<GuardProgram>();
+  if (!reader.Read(magic) || (magic != kGuardProgramMagic) || !reader.Read(version) ||
+      (version != kGuardProgramVersion) || !reader.Read(program->register_num_) ||
+      (program->register_num_ > kMaxRegisterNum)) {
+    GELOGE(FAILED, "Invalid guard program header, size %zu, version %u.", data.size(), version);
+    return nullptr;
+  }
+  uint32_t count = 0U;
+  bool success = reader.ReadCount(count, sizeof(Instruction));
+  program->instructions_.resize(success ? count : 0U);
+  for (auto &ins : program->instructions_) {
+    success = success && reader.Read(ins);
+  }
+  success = success && reader.ReadCount(count, sizeof(int32_t) * 3U + sizeof(int64_t));
+  program->loads_.resize(success ? count : 0U);
+  for (auto &load_info : program->loads_) {
+    int32_t type = 0;
+    int32_t dtype = 0;
+    success = success && reader.Read(type) && reader.Read(load_info.input_data_idx) && reader.Read(load_info.index) &&
+              reader.Read(dtype) && (type > 0) && (type < static_cast<int32_t>(SourceLoadType::kEnd));
+    load_info.type = static_cast<SourceLoadType>(type);
+    load_info.dtype = static_cast<DataType>(dtype);
+  }
+  success = success && reader.ReadCount(count, sizeof(Value));
+  program->constants_.resize(success ? count : 0U);
+  for (auto &value : program->constants_) {
+    success = success && reader.Read(value);
+  }
+  success = success && reader.ReadCount(count, sizeof(uint32_t));
+  program->reasons_.resize(success ? count : 0U);
+  for (auto &msg : program->reasons_) {
+    success = success && reader.ReadString(msg);
+  }
+  if (!success || !reader.IsEnd()) {
+    GELOGE(FAILED, "Guard program of size %zu is truncated or has trailing data.", data.size());
+    return nullptr;
+  }
+  for (const auto &ins : program->instructions_) {
+    if (!IsValidInstruction(ins, program->register_num_, program->loads_.size(), program->constants_.size(),
+                            program->reasons_.size())) {
+      GELOGE(FAILED, "Guard program has invalid instruction, op %u, dst %u, lhs %u, rhs %u.",
+             static_cast<uint32_t>(ins.op), ins.dst, ins.lhs, ins.rhs);
+      return nullptr;
+    }
+  }
+  return program;
+}
+
+uint16_t GuardProgramBuilder::AllocRegister() {
+  if (program_.register_num_ >= kMaxRegisterNum) {
+    overflow_ = true;
+    return 0U;
+  }
+  return static_cast<uint16_t>(program_.register_num_++);
+}
+
+uint16_t GuardProgramBuilder::AddLoad(const SourceLoadInfo &load_info) {
+  if (program_.loads_.size() >= kMaxRegisterNum) {
+    overflow_ = true;
+    return 0U;
+  }
+  const auto load_idx = static_cast<uint16_t>(program_.loads_.size());
+  program_.loads_.emplace_back(load_info);
+  return AddInstruction(GuardProgram::OpCode::kLoad, load_idx);
+}
+
+uint16_t GuardProgramBuilder::AddIntConst(const int64_t value) {
+  GuardProgram::Value const_value{};
+  const_value.int_value = value;
+  if (program_.constants_.size() >= kMaxRegisterNum) {
+    overflow_ = true;
+    return 0U;
+  }
+  program_.constants_.emplace_back(const_value);
+  return AddInstruction(GuardProgram::OpCode::kConst, static_cast<uint16_t>(program_.constants_.size() - 1U));
+}
+
+uint16_t GuardProgramBuilder::AddFloatConst(const double value) {
+  GuardProgram::Value const_value{};
+  const_value.float_value = value;
+  if (program_.constants_.size() >= kMaxRegisterNum) {
+    overflow_ = true;
+    return 0U;
+  }
+  program_.constants_.emplace_back(const_value);
+  return AddInstruction(GuardProgram::OpCode::kConst, static_cast<uint16_t>(program_.constants_.size() - 1U));
+}
+
+uint16_t GuardProgramBuilder::AddInstruction(const GuardProgram::OpCode op, const uint16_t lhs, const uint16_t rhs) {
+  const uint16_t dst = AllocRegister();
+  program_.instructions_.push_back({op, 0U, dst, lhs, rhs});
+  return dst;
+}
+
+void GuardProgramBuilder::AddCheck(const uint16_t reg, const std::string &reason) {
+  if (program_.reasons_.size() >= kMaxRegisterNum) {
+    overflow_ = true;
+    return;
+  }
+  program_.reasons_.emplace_back(reason);
+  program_.instructions_.push_back(
+      {GuardProgram::OpCode::kCheck, 0U, reg, reg, static_cast<uint16_t>(program_.reasons_.size() - 1U)});
+}
+
+GuardProgramPtr GuardProgramBuilder::Build() {
+  if (overflow_) {
+    GELOGW("Guard program exceeds %u registers, constants or checks.", kMaxRegisterNum);
+    return nullptr;
+  }
+  return std::make_shared<GuardProgram>(std::move(program_));
+}
+
+GuardProgramCache &GuardProgramCache::GetInstance() {
+  static GuardProgramCache instance;
+  return instance;
+}
+
+GuardProgramPtr GuardProgramCache::Load(const std::string &data) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  const auto iter = programs_.find(data);
+  if (iter != programs_.end()) {
+    auto program = iter->second.lock();
+    if (program != nullptr) {
+      GELOGD("Guard program of size %zu is shared from cache.", data.size());
+      return program;
+    }
+  }
+  GuardProgramPtr program = GuardProgram::Deserialize(data);
+  if (program == nullptr) {
+    return nullptr;
+  }
+  for (auto it = programs_.begin(); it != programs_.end();) {
+    it = it->second.expired() ? programs_.erase(it) : std::next(it);
+  }
+  programs_[data] = program;
+  return program;
+}
+
+size_t GuardProgramCache::Size() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return programs_.size();
+}
+}  // namespace ge
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GE_COMMON_GUARD_GUARD_PROGRAM_H_
+#define GE_COMMON_GUARD_GUARD_PROGRAM_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "exe_graph/runtime/runtime_tensor.h"
+#include "graph/symbolizer/source_load_info.h"
+
+namespace ge {
+constexpr char_t const *kGuardCheckProgramData = "_guard_check_program";
+
+/* GuardProgram是guard表达式降级后的寄存器式字节码，在进程内解释执行，替代编译guard_check.so：
+ * 1. 每条指令的结果写入一个新的寄存器(SSA)，寄存器按编译期推导的类型保存int64_t或double；
+ * 2. kLoad按SourceLoadInfo从图输入取符号值，kCheck检查寄存器值，为0时返回false并按需写入失败原因；
+ * 3. 序列化结果与内容一一对应，相同的guard集合反序列化后通过GuardProgramCache共享同一个实例。 */
+class GuardProgram {
+ public:
+  enum class OpCode : uint8_t {
+    kLoad = 0,   // dst = loads[lhs]
+    kConst,      // dst = constants[lhs]
+    kIntToFloat,
+    kAddInt,
+    kSubInt,
+    kMulInt,
+    kDivInt,
+    kModInt,
+    kMaxInt,
+    kMinInt,
+    kAbsInt,
+    kAddFloat,
+    kSubFloat,
+    kMulFloat,
+    kDivFloat,
+    kModFloat,
+    kMaxFloat,
+    kMinFloat,
+    kAbsFloat,
+    kPowFloat,
+    kExpFloat,
+    kLogFloat,
+    kSqrtFloat,
+    kCeilFloat,
+    kFloorFloat,
+    kEqInt,
+    kNeInt,
+    kLeInt,
+    kLtInt,
+    kEqFloat,    // 与codegen的CompareEqual一致，浮点比较带绝对和相对误差
+    kNeFloat,
+    kLeFloat,
+    kLtFloat,
+    kAnd,
+    kOr,
+    kCheck,      // regs[lhs]为0时检查失败，失败原因为reasons[rhs]
+    kEnd
+  };
+
+  struct Instruction {
+    OpCode op;
+    uint8_t reserved;
+    uint16_t dst;
+    uint16_t lhs;
+    uint16_t rhs;
+  };
+
+  union Value {
+    int64_t int_value;
+    double float_value;
+  };
+
+  /**
+   * 与GuardCheckFunc语义一致，返回值true表示检查通过，false表示检查失败
+   * 检查失败且ASCEND_GLOBAL_LOG_LEVEL不大于1时，往reason中写入第一个失败的guard的原因
+   */
+  bool Check(gert::Tensor **tensors, size_t num_tensors, char_t *reason, size_t reason_size) const;
+
+  std::string Serialize() const;
+
+  // 校验所有下标后反序列化，格式非法时返回nullptr
+  static std::shared_ptr<GuardProgram> Deserialize(const std::string &data);
+
+  size_t GetInstructionNum() const {
+    return instructions_.size();
+  }
+
+  size_t GetCheckNum() const {
+    return reasons_.size();
+  }
+
+ private:
+  friend class GuardProgramBuilder;
+  void WriteReason(size_t reason_idx, char_t *reason, size_t reason_size) const;
+
+  uint32_t register_num_{0U};
+  std::vector<Instruction> instructions_;
+  std::vector<SourceLoadInfo> loads_;
+  std::vector<Value> constants_;
+  std::vector<std::string> reasons_;
+};
+using GuardProgramPtr = std::shared_ptr<const GuardProgram>;
+
+class GuardProgramBuilder {
+ public:
+  // 以下接口返回结果所在的寄存器
+  uint16_t AddLoad(const SourceLoadInfo &load_info);
+  uint16_t AddIntConst(int64_t value);
+  uint16_t AddFloatConst(double value);
+  uint16_t AddInstruction(GuardProgram::OpCode op, uint16_t lhs, uint16_t rhs = 0U);
+
+  void AddCheck(uint16_t reg, const std::string &reason);
+
+  // 寄存器或常量数超过uint16_t的表示范围时返回nullptr
+  GuardProgramPtr Build();
+
+ private:
+  uint16_t AllocRegister();
+
+  bool overflow_{false};
+  GuardProgram program_;
+};
+
+// 按序列化内容共享guard program，内容相同的模型或执行点只持有一个实例
+class GuardProgramCache {
+ public:
+  static GuardProgramCache &GetInstance();
+
+  GuardProgramPtr Load(const std::string &data);
+
+  size_t Size();
+
+ private:
+  GuardProgramCache() = default;
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::weak_ptr<const GuardProgram>> programs_;
+};
+}  // namespace ge
+#endif  // GE_COMMON_GUARD_GUARD_PROGRAM_H_
@@ -16,27 +16,31 @@
 #include "securec.h"
 
 namespace ge {
-#define FORALL_OM2_CONSTANTS(DO)                                                         \
-  DO(OM2_ARCHIVE_VERSION, "om2_version");                                                \
-  DO(OM2_ARCHIVE_VERSION_VALUE, "0");                                                    \
-  DO(OM2_MODEL_NUM, "model_num");                                                        \
-  DO(OM2_ATC_COMMAND, "atc_command");                                                    \
-  DO(OM2_MANIFEST_PATH, "manifest.json");                                                \
-  DO(OM2_DATA_DIR, "data/");                                                             \
-  DO(OM2_MODEL_DIR_FORMAT, "data/model_%s/");                                            \
-  DO(OM2_MODEL_META_PATH_FORMAT, "data/model_%s/model_meta.json");                       \
-  DO(OM2_RUNTIME_DIR_FORMAT, "data/model_%s/runtime/");                                  \
-  DO(OM2_DEBUG_DIR_FORMAT, "data/model_%s/debug/");                                      \
-  DO(OM2_OP_ATTR_PATH_FORMAT, "data/model_%s/debug/op_attr.json");                       \
-  DO(OM2_CUSTOM_KERNELS_DIR_FORMAT, "data/custom_ops/%s/");                              \
-  DO(OM2_KERNELS_DIR_FORMAT, "data/kernels_%s/");                                        \
-  DO(OM2_CONSTANTS_DIR, "data/constants/");                                              \
-  DO(OM2_CONSTANTS_FILE_PREFIX, "constant_");                                            \
-  DO(OM2_CONSTANTS_CONFIG_PATH_FORMAT, "data/constants/model_%s_constants_config.json"); \
-  DO(OM2_VARIABLES_DIR, "data/variables/");                                              \
-  DO(OM2_VAR_RESOURCE_PATH, "data/variables/var_resource.json");                         \
-  DO(OM2_VAR_WEIGHT_FILE, "data/variables/var_weight_data");                             \
-  DO(OM2_VARIABLES_CONFIG_PATH_FORMAT, "data/variables/model_%s_variables_config.json"); \
+#define FORALL_OM2_CONSTANTS(DO)                                                                \
+  DO(OM2_ARCHIVE_VERSION, "om2_version");                                                       \
+  DO(OM2_ARCHIVE_VERSION_VALUE, "0");                                                           \
+  DO(OM2_MODEL_NUM, "model_num");                                                               \
+  DO(OM2_ATC_COMMAND, "atc_command");                                                           \
+  DO(OM2_MANIFEST_PATH, "manifest.json");                                                       \
+  DO(OM2_DATA_DIR, "data/");                                                                    \
+  DO(OM2_MODEL_DIR_FORMAT, "data/model_%s/");                                                   \
+  DO(OM2_MODEL_META_PATH_FORMAT, "data/model_%s/model_meta.json");                              \
+  DO(OM2_RUNTIME_DIR_FORMAT, "data/model_%s/runtime/");                                         \
+  DO(OM2_DEBUG_DIR_FORMAT, "data/model_%s/debug/");                                             \
+  DO(OM2_OP_ATTR_PATH_FORMAT, "data/model_%s/debug/op_attr.json");                              \
+  DO(OM2_OP_ATTR_BIN_PATH_FORMAT, "data/model_%s/debug/op_attr.om2meta");                       \
+  DO(OM2_CUSTOM_KERNELS_DIR_FORMAT, "data/custom_ops/%s/");                                     \
+  DO(OM2_KERNELS_DIR_FORMAT, "data/kernels_%s/");                                               \
+  DO(OM2_CONSTANTS_DIR, "data/constants/");                                                     \
+  DO(OM2_CONSTANTS_FILE_PREFIX, "constant_");                                                   \
+  DO(OM2_CONSTANTS_CONFIG_PATH_FORMAT, "data/constants/model_%s_constants_config.json");        \
+  DO(OM2_CONSTANTS_CONFIG_BIN_PATH_FORMAT, "data/constants/model_%s_constants_config.om2meta"); \
+  DO(OM2_VARIABLES_DIR, "data/variables/");                                                     \
+  DO(OM2_VAR_RESOURCE_PATH, "data/variables/var_resource.json");                                \
+  DO(OM2_VAR_WEIGHT_FILE, "data/variables/var_weight_data");                                    \
+  DO(OM2_VARIABLES_CONFIG_PATH_FORMAT, "data/variables/model_%s_variables_config.json");        \
+  DO(OM2_VARIABLES_CONFIG_BIN_PATH_FORMAT, "data/variables/model_%s_variables_config.om2meta"); \
+  DO(OM2_BINARY_META_SUFFIX, ".om2meta");                                                       \
   DO(OM2_VISUAL_JSON_PATH_FORMAT, "data/model_%s/debug/ge_visual_00000000_graph_0.json")
 
 #define DEFINE_OM2_CONST(name, value) inline constexpr const char *name = (value)
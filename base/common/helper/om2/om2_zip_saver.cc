@@ -88,8 +88,17 @@ Status SerializeWeightData(const gert::Om2ModelData &model_data, const std::shar
 }
 
 Status SerializeConstantsConfig(const gert::Om2ModelData &model_data,
-                                const std::shared_ptr<ZipArchiveWriter> &zip_writer, const bool is_offline) {
+                                const std::shared_ptr<ZipArchiveWriter> &zip_writer, const bool is_offline,
+                                const Om2MetaFormat meta_format) {
   const size_t model_index = 0UL;
+  if (meta_format == Om2MetaFormat::kBinary) {
+    std::vector<uint8_t> buffer;
+    GE_ASSERT_SUCCESS(Om2BinaryMetaCodec::EncodeConstantsConfig(
+        model_data.constants_data.consts, model_data.constants_data.internal_weight_size, is_offline, buffer));
+    const auto entry_path = FormatOm2Path(OM2_CONSTANTS_CONFIG_BIN_PATH_FORMAT, std::to_string(model_index).c_str());
+    GE_ASSERT_TRUE(zip_writer->WriteBytes(entry_path, buffer.data(), buffer.size(), false, kOm2BinaryMetaAlignment));
+    return SUCCESS;
+  }
   JsonFile json_file;
   (void)json_file.Set("internal_weight_size", model_data.constants_data.internal_weight_size);
   auto const_json_object = JsonFile::json::object();
@@ -175,10 +184,17 @@ Status SerializeVarResource(const gert::Om2ModelData &model_data, const std::sha
 }
 
 Status SerializeVarMetas(const gert::Om2ModelData &model_data, const std::shared_ptr<ZipArchiveWriter> &zip_writer,
-                         const std::string &model_index_str) {
+                         const std::string &model_index_str, const Om2MetaFormat meta_format) {
   if (model_data.var_metas.empty()) {
     return SUCCESS;
   }
+  if (meta_format == Om2MetaFormat::kBinary) {
+    std::vector<uint8_t> buffer;
+    GE_ASSERT_SUCCESS(Om2BinaryMetaCodec::EncodeVariablesConfig(model_data.var_metas, model_data.graph_id, buffer));
+    const auto entry_path = FormatOm2Path(OM2_VARIABLES_CONFIG_BIN_PATH_FORMAT, model_index_str.c_str());
+    GE_ASSERT_TRUE(zip_writer->WriteBytes(entry_path, buffer.data(), buffer.size(), false, kOm2BinaryMetaAlignment));
+    return SUCCESS;
+  }
   JsonFile json_file;
   (void)json_file.Set("graph_id", model_data.graph_id);
   auto var_metas_json = JsonFile::json::array();
@@ -384,14 +400,27 @@ Status SerializeModelMeta(const gert::Om2ModelData &model_data, const std::share
   return SUCCESS;
 }
 
-Status SerializeDebugInfo(const gert::Om2ModelData &model_data, const std::shared_ptr<ZipArchiveWriter> &zip_writer) {
-  const size_t model_index = 0UL;
-  // op_attr.json
+Status SerializeOpAttrMap(const gert::Om2ModelData &model_data, const std::shared_ptr<ZipArchiveWriter> &zip_writer,
+                          const std::string &model_index_str, const Om2MetaFormat meta_format) {
+  if (meta_format == Om2MetaFormat::kBinary) {
+    std::vector<uint8_t> buffer;
+    GE_ASSERT_SUCCESS(Om2BinaryMetaCodec::EncodeOpAttrMap(model_data.debug_info.op_attr_map, buffer));
+    const auto entry_path = FormatOm2Path(OM2_OP_ATTR_BIN_PATH_FORMAT, model_index_str.c_str());
+    GE_ASSERT_TRUE(zip_writer->WriteBytes(entry_path, buffer.data(), buffer.size(), false, kOm2BinaryMetaAlignment));
+    return SUCCESS;
+  }
   const auto op_attr_json_str = model_data.debug_info.op_attr_map.empty()
                                     ? std::string("{}")
                                     : SerializeOpAttrMapToJson(model_data.debug_info.op_attr_map);
-  const auto op_attr_entry_path = FormatOm2Path(OM2_OP_ATTR_PATH_FORMAT, std::to_string(model_index).c_str());
+  const auto op_attr_entry_path = FormatOm2Path(OM2_OP_ATTR_PATH_FORMAT, model_index_str.c_str());
   GE_ASSERT_TRUE(zip_writer->WriteBytes(op_attr_entry_path, op_attr_json_str.data(), op_attr_json_str.size(), false));
+  return SUCCESS;
+}
+
+Status SerializeDebugInfo(const gert::Om2ModelData &model_data, const std::shared_ptr<ZipArchiveWriter> &zip_writer,
+                          const Om2MetaFormat meta_format) {
+  const size_t model_index = 0UL;
+  GE_ASSERT_SUCCESS(SerializeOpAttrMap(model_data, zip_writer, std::to_string(model_index), meta_format));
 
   // visual json
   const auto visual_entry_path = FormatOm2Path(OM2_VISUAL_JSON_PATH_FORMAT, std::to_string(model_index).c_str());
@@ -413,14 +442,14 @@ Status SerializeManifest(const gert::Om2ModelData &model_data, const std::shared
 }  // namespace
 
 Status Om2ZipSaver::Save(const gert::Om2ModelData &model_data, ModelBufferData &model, const bool is_offline,
-                         const std::string &writer_path) {
+                         const std::string &writer_path, const Om2MetaFormat meta_format) {
   GELOGI(
       "[OM2] Begin to serialize Om2ModelData to ZIP, model_name:%s, root_graph:%s, "
-      "inputs:%zu, outputs:%zu, kernels:%zu, custom kernels: %zu, weight_size:%zu",
+      "inputs:%zu, outputs:%zu, kernels:%zu, custom kernels: %zu, weight_size:%zu, meta_format:%u",
       model_data.model_meta.model_name.c_str(), model_data.model_meta.root_graph_name.c_str(),
       model_data.model_meta.input_desc.size(), model_data.model_meta.output_desc.size(),
       model_data.kernel_binaries.size(), model_data.custom_kernel_binaries.size(),
-      model_data.constants_data.internal_weight_size);
+      model_data.constants_data.internal_weight_size, static_cast<uint32_t>(meta_format));
   const std::string path = writer_path.empty() ? "om2_model" : writer_path;
   auto zip_writer = std::make_shared<ZipArchiveWriter>(path);
   GE_ASSERT_NOTNULL(zip_writer);
@@ -428,14 +457,14 @@ Status Om2ZipSaver::Save(const gert::Om2ModelData &model_data, ModelBufferData &
 
   GE_ASSERT_SUCCESS(SerializeCodegenArtifacts(model_data, zip_writer));
   GE_ASSERT_SUCCESS(SerializeWeightData(model_data, zip_writer));
-  GE_ASSERT_SUCCESS(SerializeConstantsConfig(model_data, zip_writer, is_offline));
+  GE_ASSERT_SUCCESS(SerializeConstantsConfig(model_data, zip_writer, is_offline, meta_format));
   GE_ASSERT_SUCCESS(SerializeVarResource(model_data, zip_writer));
-  GE_ASSERT_SUCCESS(SerializeVarMetas(model_data, zip_writer, "0"));
+  GE_ASSERT_SUCCESS(SerializeVarMetas(model_data, zip_writer, "0", meta_format));
   GE_ASSERT_SUCCESS(SerializeKernelBinaries(model_data, zip_writer));
   GE_ASSERT_SUCCESS(SerializeCustomKernelBinaries(model_data, zip_writer));
   GE_ASSERT_SUCCESS(SerializeCustomKernelSharedLibs(model_data, zip_writer));
   GE_ASSERT_SUCCESS(SerializeModelMeta(model_data, zip_writer));
-  GE_ASSERT_SUCCESS(SerializeDebugInfo(model_data, zip_writer));
+  GE_ASSERT_SUCCESS(SerializeDebugInfo(model_data, zip_writer, meta_format));
   GE_ASSERT_SUCCESS(SerializeManifest(model_data, zip_writer));
 
   GE_ASSERT_TRUE(zip_writer->SaveModelData(model, is_offline));
@@ -14,6 +14,7 @@
 #include <string>
 #include "ge/ge_ir_build.h"
 #include "common/om2/om2_model_data.h"
+#include "common/om2/om2_binary_meta.h"
 
 namespace gert {
 struct Om2ModelData;
@@ -24,7 +25,7 @@ namespace ge {
 class Om2ZipSaver {
  public:
   static Status Save(const gert::Om2ModelData &model_data, ModelBufferData &model, bool is_offline,
-                     const std::string &writer_path = "");
+                     const std::string &writer_path = "", Om2MetaFormat meta_format = Om2MetaFormat::kJson);
 };
 
 }  // namespace ge
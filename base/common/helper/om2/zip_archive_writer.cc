@@ -36,6 +36,10 @@ constexpr int64_t kBufSize = 16384L;        // same as UNZ_BUFSIZE
 constexpr size_t kBufVectorSize = 16384UL;  // same as UNZ_BUFSIZE
 constexpr uint32_t kMaxWriteSize = std::numeric_limits<uint32_t>::max();
 constexpr uint32_t kMaxFileNameLength = 4096U;  // same as UNZ_MAXFILENAMEINZIP
+constexpr uint64_t kLocalFileHeaderFixedSize = 30U;
+constexpr uint64_t kZip64LocalExtraSize = 20U;    // minizip writes zip64 local extra when zip64 = 1
+constexpr uint16_t kAlignmentExtraHeaderId = 0xD935U;  // same as zipalign
+constexpr size_t kExtraFieldHeaderSize = 4U;
 
 int MemGrow(MemoryFile *mem_file, const uint64_t new_size) {
   if (new_size <= mem_file->capacity) {
@@ -370,6 +374,29 @@ std::string GetBaseName(const std::string &path) {
 
   return file_name.substr(0, pos_dot);
 }
+
+// 生成填充用的local extra field，使entry数据起始位置按alignment对齐
+std::vector<uint8_t> BuildAlignmentExtraField(const uint64_t header_offset, const size_t name_len,
+                                              const size_t alignment) {
+  if (alignment <= 1U) {
+    return {};
+  }
+  const uint64_t data_offset = header_offset + kLocalFileHeaderFixedSize + name_len + kZip64LocalExtraSize;
+  size_t padding = static_cast<size_t>((alignment - (data_offset % alignment)) % alignment);
+  if (padding == 0U) {
+    return {};
+  }
+  while (padding < kExtraFieldHeaderSize) {
+    padding += alignment;
+  }
+  std::vector<uint8_t> extra_field(padding, 0U);
+  const auto data_len = static_cast<uint16_t>(padding - kExtraFieldHeaderSize);
+  extra_field[0U] = static_cast<uint8_t>(kAlignmentExtraHeaderId & 0xFFU);
+  extra_field[1U] = static_cast<uint8_t>(kAlignmentExtraHeaderId >> 8U);
+  extra_field[2U] = static_cast<uint8_t>(data_len & 0xFFU);
+  extra_field[3U] = static_cast<uint8_t>(data_len >> 8U);
+  return extra_field;
+}
 }  // namespace
 
 SimpleZipArchiveReader::SimpleZipArchiveReader(const uint8_t *data, size_t length) : mem_file_{data, length, 0} {
@@ -508,7 +535,7 @@ bool ZipArchiveWriter::WriteFile(const std::string &entry_name, const std::strin
 }
 
 bool ZipArchiveWriter::WriteBytes(const std::string &entry_name, const void *data, const size_t data_size,
-                                  const bool compress) {
+                                  const bool compress, const size_t alignment) {
   GE_ASSERT_TRUE(IsMemFileOpened(), "Invalid status of archive [%s]", archive_path_.c_str());
   GE_ASSERT_TRUE(!entry_name.empty(), "Entry name cannot be empty");
   GE_ASSERT_NOTNULL(data, "Pointer data is null, arc_name is [%s]", entry_name.c_str());
@@ -522,10 +549,19 @@ bool ZipArchiveWriter::WriteBytes(const std::string &entry_name, const void *dat
   zip_fileinfo file_info{};
   const int compression_method = compress ? Z_DEFLATED : Z_BINARY;
   const int compression_level = compress ? Z_DEFAULT_COMPRESSION : Z_NO_COMPRESSION;
-  auto ret = zipOpenNewFileInZip64(zip_handle_, arc_name_with_prefix.c_str(), &file_info, nullptr, 0, nullptr, 0,
-                                   nullptr, compression_method, compression_level, 1);
+  const size_t data_alignment = compress ? 0U : alignment;
+  const auto extra_field = BuildAlignmentExtraField(mem_file_.position, arc_name_with_prefix.size(), data_alignment);
+  auto ret = zipOpenNewFileInZip64(zip_handle_, arc_name_with_prefix.c_str(), &file_info,
+                                   extra_field.empty() ? nullptr : extra_field.data(),
+                                   static_cast<uInt>(extra_field.size()), nullptr, 0, nullptr, compression_method,
+                                   compression_level, 1);
   GE_ASSERT_TRUE(ret == ZIP_OK, "Failed to open file [%s] in zip, ret = %d", arc_name_with_prefix.c_str(), ret);
   GE_MAKE_GUARD(close_file_in_zip, [this]() { (void)zipCloseFileInZip(zip_handle_); });
+  if ((data_alignment > 1U) && ((mem_file_.position % data_alignment) != 0U)) {
+    // 对齐只影响加载时能否原地访问，不影响包的正确性
+    GELOGW("Data of [%s] is not aligned to %zu, offset = %lu", arc_name_with_prefix.c_str(), data_alignment,
+           mem_file_.position);
+  }
 
   auto pdata = static_cast<const uint8_t *>(data);
   size_t remaining = data_size;
@@ -68,9 +68,12 @@ class ZipArchiveWriter {
    * @param data      Pointer to the buffer to write. Must not be null.
    * @param data_size Size in bytes of the buffer. Extremely large (>4GB) buffers are supported.
    * @param compress  Whether to compress the data. If false, the compression method is STORED.
+   * @param alignment Only for STORED entries. If non-zero, the file data is aligned to this value in the archive
+   *                  by a padding extra field, so that readers can access it in place.
    * @return true on success, false if any error occurs.
    */
-  bool WriteBytes(const std::string &entry_name, const void *data, const size_t data_size, const bool compress = true);
+  bool WriteBytes(const std::string &entry_name, const void *data, const size_t data_size, const bool compress = true,
+                  const size_t alignment = 0U);
   bool SaveModelData(ModelBufferData &model, bool save_to_file);
   bool SaveModelDataToFile();
   bool IsMemFileOpened() const {
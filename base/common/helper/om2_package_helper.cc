@@ -19,6 +19,7 @@
 #include "common/helper/om2/om2_package_contants.h"
 #include "common/helper/om2/json_file.h"
 #include "common/om2/om2_model_data.h"
+#include "common/om2/om2_binary_meta.h"
 #include "common/om2/codegen/om2_codegen.h"
 #include "common/om2/codegen/om2_codegen_utils.h"
 #include "framework/omg/omg_inner_types.h"
@@ -38,6 +39,7 @@ namespace ge {
 namespace {
 constexpr auto kAttrKernelName = "_kernelname";
 const std::string kOm2ConstantsConfigSuffix = "_constants_config.json";
+const std::string kOm2BinaryConstantsConfigSuffix = "_constants_config.om2meta";
 const std::string kOm2ExternalWeightDirName = "weight";
 
 constexpr size_t kAippDimPartsNum = 6U;
@@ -101,7 +103,18 @@ std::string StripOm2ArchiveRoot(const std::string &entry_name) {
 }
 
 bool IsOm2ConstantsConfigEntry(const std::string &entry_name) {
-  return (entry_name.find(OM2_CONSTANTS_DIR) == 0U) && EndsWith(entry_name, kOm2ConstantsConfigSuffix);
+  return (entry_name.find(OM2_CONSTANTS_DIR) == 0U) &&
+         (EndsWith(entry_name, kOm2ConstantsConfigSuffix) || EndsWith(entry_name, kOm2BinaryConstantsConfigSuffix));
+}
+
+size_t GetRepackedOm2EntryAlignment(const std::string &entry_name) {
+  return EndsWith(entry_name, OM2_BINARY_META_SUFFIX) ? kOm2BinaryMetaAlignment : 0U;
+}
+
+Om2MetaFormat GetOm2MetaFormatOption() {
+  std::string meta_format;
+  (void)GetContext().GetOption(kOptionOm2MetaFormat, meta_format);
+  return (meta_format == kOm2MetaFormatBinary) ? Om2MetaFormat::kBinary : Om2MetaFormat::kJson;
 }
 
 bool ShouldCompressRepackedOm2Entry(const std::string &entry_name) {
@@ -163,6 +176,37 @@ Status RewriteOm2ConstantsConfig(const std::string &output_file_name, JsonFile &
   return SUCCESS;
 }
 
+Status RewriteOm2BinaryConstantsConfig(const std::string &output_file_name, const uint8_t *data, const size_t data_size,
+                                       std::map<std::string, std::string> &old_file_to_new_file,
+                                       std::string &rewritten_config) {
+  Om2ConstMetas consts;
+  size_t internal_weight_size = 0U;
+  GE_ASSERT_SUCCESS(Om2BinaryMetaCodec::DecodeConstantsConfig(data, data_size, consts, internal_weight_size));
+  bool changed = false;
+  for (auto &const_meta : consts) {
+    if ((const_meta.type == "INTERNAL") || const_meta.file_path.empty()) {
+      continue;
+    }
+    if (const_meta.file_name.empty()) {
+      const_meta.file_name = StringUtils::GetFileName(const_meta.file_path);
+    }
+    GE_ASSERT_TRUE(!const_meta.file_name.empty(), "[OM2] External weight file name is empty, file_path=%s",
+                   const_meta.file_path.c_str());
+    const std::string new_file_path = MakeOm2ExternalWeightPath(output_file_name, const_meta.file_name);
+    GE_ASSERT_TRUE(!new_file_path.empty(), "[OM2] Failed to make external weight path, output=%s",
+                   output_file_name.c_str());
+    old_file_to_new_file[const_meta.file_path] = new_file_path;
+    const_meta.file_path.clear();
+    changed = true;
+  }
+  if (changed) {
+    std::vector<uint8_t> buffer;
+    GE_ASSERT_SUCCESS(Om2BinaryMetaCodec::EncodeConstantsConfig(consts, internal_weight_size, false, buffer));
+    rewritten_config.assign(buffer.begin(), buffer.end());
+  }
+  return SUCCESS;
+}
+
 Status CollectOm2ExternalWeightRelocation(const std::string &output_file_name, const SimpleZipArchiveReader &archive,
                                           const std::vector<std::string> &archive_entries,
                                           std::map<std::string, std::string> &rewritten_configs,
@@ -175,6 +219,15 @@ Status CollectOm2ExternalWeightRelocation(const std::string &output_file_name, c
     size_t buffer_size = 0U;
     const auto buffer = archive.ExtractToMem(entry_name, buffer_size);
     GE_ASSERT_NOTNULL(buffer, "[OM2] Failed to extract constants config entry %s", entry_name.c_str());
+    if (EndsWith(relative_entry_name, kOm2BinaryConstantsConfigSuffix)) {
+      std::string rewritten_config;
+      GE_ASSERT_SUCCESS(RewriteOm2BinaryConstantsConfig(output_file_name, buffer.get(), buffer_size,
+                                                        old_file_to_new_file, rewritten_config));
+      if (!rewritten_config.empty()) {
+        rewritten_configs[entry_name] = std::move(rewritten_config);
+      }
+      continue;
+    }
     const JsonFile const_json_readonly(reinterpret_cast<const uint8_t *>(buffer.get()), buffer_size);
     GE_ASSERT_TRUE(const_json_readonly.IsValid(), "[OM2] Invalid constants config entry %s", entry_name.c_str());
     JsonFile const_json(const_json_readonly.Raw());
@@ -199,7 +252,8 @@ Status RepackOm2Model(const std::string &output_file_name, const SimpleZipArchiv
     if (rewritten_config != rewritten_configs.end()) {
       GE_ASSERT_TRUE(zip_writer->WriteBytes(relative_entry_name, rewritten_config->second.data(),
                                             rewritten_config->second.size(),
-                                            ShouldCompressRepackedOm2Entry(relative_entry_name)));
+                                            ShouldCompressRepackedOm2Entry(relative_entry_name),
+                                            GetRepackedOm2EntryAlignment(relative_entry_name)));
       continue;
     }
     size_t buffer_size = 0U;
@@ -207,7 +261,8 @@ Status RepackOm2Model(const std::string &output_file_name, const SimpleZipArchiv
     GE_ASSERT_NOTNULL(buffer, "[OM2] Failed to extract archive entry %s", entry_name.c_str());
     GE_ASSERT_TRUE(buffer_size > 0U, "[OM2] Empty archive entry %s is invalid", entry_name.c_str());
     GE_ASSERT_TRUE(zip_writer->WriteBytes(relative_entry_name, buffer.get(), buffer_size,
-                                          ShouldCompressRepackedOm2Entry(relative_entry_name)));
+                                          ShouldCompressRepackedOm2Entry(relative_entry_name),
+                                          GetRepackedOm2EntryAlignment(relative_entry_name)));
   }
   GE_ASSERT_TRUE(zip_writer->SaveModelData(relocated_model, false));
   return SUCCESS;
@@ -519,7 +574,7 @@ Status Om2PackageHelper::SaveToOmModel(const GeModelPtr &ge_model, const std::st
 
   // Serialize to ZIP via Om2ZipSaver
   const std::string writer_path = (!is_offline_ && !ge_model->GetName().empty()) ? ge_model->GetName() : output_file;
-  GE_ASSERT_SUCCESS(Om2ZipSaver::Save(model_data, model, is_offline_, writer_path));
+  GE_ASSERT_SUCCESS(Om2ZipSaver::Save(model_data, model, is_offline_, writer_path, GetOm2MetaFormatOption()));
 
   GELOGI("[OM2] Successfully created OM2 model");
   return SUCCESS;
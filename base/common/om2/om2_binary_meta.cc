@@ -0,0 +1,498 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "common/om2/om2_binary_meta.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "common/checker.h"
+
+namespace ge {
+namespace {
+constexpr uint32_t kOm2BinaryMetaMagic = 0x4D42324FU;  // "O2BM"
+constexpr uint16_t kOm2BinaryMetaMajorVersion = 1U;
+constexpr uint16_t kOm2BinaryMetaMinorVersion = 0U;
+constexpr size_t kSectionAlignment = 8U;
+constexpr size_t kShapeRangeIntNum = 2U;
+
+struct Section {
+  uint64_t offset;
+  uint64_t size;
+};
+
+struct Header {
+  uint32_t magic;
+  uint16_t major_version;
+  uint16_t minor_version;
+  uint16_t kind;
+  uint16_t reserved0;
+  uint32_t record_size;
+  uint32_t sub_record_size;
+  uint32_t reserved1;
+  uint64_t aux;
+  uint64_t record_count;
+  uint64_t sub_record_count;
+  Section records;
+  Section sub_records;
+  Section int_pool;
+  Section str_pool;
+};
+
+struct StrRef {
+  uint32_t offset;
+  uint32_t len;
+};
+
+struct Span {
+  uint32_t begin;
+  uint32_t count;
+};
+
+struct TensorDescRecord {
+  StrRef name;
+  int32_t data_type;
+  int32_t format;
+  uint64_t size;
+  Span shape;
+  Span shape_range;
+};
+
+struct OpAttrRecord {
+  StrRef op_name;
+  Span attrs;
+};
+
+struct AttrRecord {
+  StrRef name;
+  StrRef value;
+};
+
+struct ConstRecord {
+  uint64_t index;
+  int64_t offset;
+  int64_t size;
+  StrRef type;
+  StrRef file_name;
+  StrRef file_path;
+  StrRef op_name;
+};
+
+struct VarMetaRecord {
+  uint64_t index;
+  StrRef var_name;
+  StrRef op_type;
+  StrRef op_name;
+  TensorDescRecord tensor_desc;
+};
+
+// 布局写入文件，字段调整必须提升版本号
+static_assert(sizeof(Header) == 112U, "Layout of om2 binary meta header changed");
+static_assert(sizeof(TensorDescRecord) == 40U, "Layout of om2 binary tensor desc changed");
+static_assert(sizeof(OpAttrRecord) == 16U, "Layout of om2 binary op attr record changed");
+static_assert(sizeof(AttrRecord) == 16U, "Layout of om2 binary attr record changed");
+static_assert(sizeof(ConstRecord) == 56U, "Layout of om2 binary const record changed");
+static_assert(sizeof(VarMetaRecord) == 72U, "Layout of om2 binary var meta record changed");
+
+class Om2BinaryMetaBuilder {
+ public:
+  Om2BinaryMetaBuilder(const Om2BinaryMetaKind kind, const uint64_t aux) : kind_(kind), aux_(aux) {}
+
+  StrRef AddString(const std::string &str) {
+    const auto iter = interned_.find(str);
+    if (iter != interned_.end()) {
+      return iter->second;
+    }
+    StrRef ref{static_cast<uint32_t>(str_pool_.size()), static_cast<uint32_t>(str.size())};
+    if ((str_pool_.size() + str.size()) > std::numeric_limits<uint32_t>::max()) {
+      overflow_ = true;
+      return StrRef{0U, 0U};
+    }
+    (void)str_pool_.insert(str_pool_.end(), str.begin(), str.end());
+    (void)interned_.emplace(str, ref);
+    return ref;
+  }
+
+  Span AddInts(const std::vector<int64_t> &values) {
+    return AddInts(values.data(), values.size());
+  }
+
+  Span AddShapeRange(const std::vector<std::pair<int64_t, int64_t>> &shape_range) {
+    const Span span{static_cast<uint32_t>(int_pool_.size()), static_cast<uint32_t>(shape_range.size())};
+    for (const auto &range : shape_range) {
+      int_pool_.emplace_back(range.first);
+      int_pool_.emplace_back(range.second);
+    }
+    CheckCount(int_pool_.size());
+    return span;
+  }
+
+  TensorDescRecord AddTensorDesc(const Om2TensorDesc &desc) {
+    TensorDescRecord record{};
+    record.name = AddString(desc.GetName());
+    record.data_type = static_cast<int32_t>(desc.GetDataType());
+    record.format = static_cast<int32_t>(desc.GetFormat());
+    record.size = static_cast<uint64_t>(desc.GetSize());
+    record.shape = AddInts(desc.GetShape());
+    record.shape_range = AddShapeRange(desc.GetShapeRange());
+    return record;
+  }
+
+  template <typename T>
+  void AddRecord(const T &record) {
+    Append(records_, record);
+    record_size_ = static_cast<uint32_t>(sizeof(T));
+    ++record_count_;
+  }
+
+  template <typename T>
+  void AddSubRecord(const T &record) {
+    Append(sub_records_, record);
+    sub_record_size_ = static_cast<uint32_t>(sizeof(T));
+    ++sub_record_count_;
+    CheckCount(sub_record_count_);
+  }
+
+  uint32_t SubRecordCount() const {
+    return static_cast<uint32_t>(sub_record_count_);
+  }
+
+  Status Finish(std::vector<uint8_t> &buffer) const {
+    GE_ASSERT_TRUE(!overflow_, "[OM2] Binary meta of kind %u exceeds the 4GB limit",
+                   static_cast<uint32_t>(kind_));
+    Header header{};
+    header.magic = kOm2BinaryMetaMagic;
+    header.major_version = kOm2BinaryMetaMajorVersion;
+    header.minor_version = kOm2BinaryMetaMinorVersion;
+    header.kind = static_cast<uint16_t>(kind_);
+    header.record_size = record_size_;
+    header.sub_record_size = sub_record_size_;
+    header.aux = aux_;
+    header.record_count = record_count_;
+    header.sub_record_count = sub_record_count_;
+
+    size_t offset = sizeof(Header);
+    const auto place = [&offset](Section &section, const size_t size) {
+      offset = AlignUp(offset);
+      section.offset = offset;
+      section.size = size;
+      offset += size;
+    };
+    place(header.records, records_.size());
+    place(header.sub_records, sub_records_.size());
+    place(header.int_pool, int_pool_.size() * sizeof(int64_t));
+    place(header.str_pool, str_pool_.size());
+
+    buffer.assign(offset, 0U);
+    (void)memcpy(buffer.data(), &header, sizeof(Header));
+    CopySection(buffer, header.records, records_.data());
+    CopySection(buffer, header.sub_records, sub_records_.data());
+    CopySection(buffer, header.int_pool, int_pool_.data());
+    CopySection(buffer, header.str_pool, str_pool_.data());
+    return SUCCESS;
+  }
+
+ private:
+  static size_t AlignUp(const size_t offset) {
+    return (offset + kSectionAlignment - 1U) / kSectionAlignment * kSectionAlignment;
+  }
+
+  static void CopySection(std::vector<uint8_t> &buffer, const Section &section, const void *src) {
+    if (section.size > 0U) {
+      (void)memcpy(buffer.data() + section.offset, src, section.size);
+    }
+  }
+
+  template <typename T>
+  static void Append(std::vector<uint8_t> &dst, const T &record) {
+    const auto *bytes = reinterpret_cast<const uint8_t *>(&record);
+    (void)dst.insert(dst.end(), bytes, bytes + sizeof(T));
+  }
+
+  Span AddInts(const int64_t *values, const size_t count) {
+    const Span span{static_cast<uint32_t>(int_pool_.size()), static_cast<uint32_t>(count)};
+    (void)int_pool_.insert(int_pool_.end(), values, values + count);
+    CheckCount(int_pool_.size());
+    return span;
+  }
+
+  void CheckCount(const size_t count) {
+    overflow_ = overflow_ || (count > std::numeric_limits<uint32_t>::max());
+  }
+
+  Om2BinaryMetaKind kind_;
+  uint64_t aux_;
+  uint32_t record_size_{0U};
+  uint32_t sub_record_size_{0U};
+  uint64_t record_count_{0U};
+  uint64_t sub_record_count_{0U};
+  bool overflow_{false};
+  std::vector<uint8_t> records_;
+  std::vector<uint8_t> sub_records_;
+  std::vector<int64_t> int_pool_;
+  std::vector<char> str_pool_;
+  std::unordered_map<std::string, StrRef> interned_;
+};
+
+/**
+ * 直接在archive内存上读取二进制元数据，所有引用在访问前做越界校验
+ */
+class Om2BinaryMetaView {
+ public:
+  Status Init(const uint8_t *data, const size_t data_size, const Om2BinaryMetaKind kind) {
+    GE_ASSERT_NOTNULL(data);
+    GE_ASSERT_TRUE(data_size >= sizeof(Header), "[OM2] Binary meta size %zu is too small", data_size);
+    (void)memcpy(&header_, data, sizeof(Header));
+    GE_ASSERT_TRUE(header_.magic == kOm2BinaryMetaMagic, "[OM2] Invalid binary meta magic 0x%x", header_.magic);
+    GE_ASSERT_TRUE(header_.major_version == kOm2BinaryMetaMajorVersion,
+                   "[OM2] Unsupported binary meta version %u.%u, expect major version %u",
+                   static_cast<uint32_t>(header_.major_version), static_cast<uint32_t>(header_.minor_version),
+                   static_cast<uint32_t>(kOm2BinaryMetaMajorVersion));
+    GE_ASSERT_TRUE(header_.kind == static_cast<uint16_t>(kind), "[OM2] Binary meta kind %u mismatch, expect %u",
+                   static_cast<uint32_t>(header_.kind), static_cast<uint32_t>(kind));
+    data_ = data;
+    data_size_ = data_size;
+    GE_ASSERT_TRUE(CheckSection(header_.records, header_.record_count, header_.record_size));
+    GE_ASSERT_TRUE(CheckSection(header_.sub_records, header_.sub_record_count, header_.sub_record_size));
+    GE_ASSERT_TRUE(CheckSection(header_.int_pool, header_.int_pool.size / sizeof(int64_t), sizeof(int64_t)));
+    GE_ASSERT_TRUE(CheckSection(header_.str_pool, header_.str_pool.size, 1U));
+    return SUCCESS;
+  }
+
+  uint64_t Aux() const {
+    return header_.aux;
+  }
+
+  size_t RecordCount() const {
+    return static_cast<size_t>(header_.record_count);
+  }
+
+  // 记录长度以文件中为准，兼容同一主版本内追加字段
+  template <typename T>
+  bool GetRecord(const size_t index, T &record) const {
+    return ReadFixed(header_.records, header_.record_count, header_.record_size, index, record);
+  }
+
+  template <typename T>
+  bool GetSubRecord(const size_t index, T &record) const {
+    return ReadFixed(header_.sub_records, header_.sub_record_count, header_.sub_record_size, index, record);
+  }
+
+  bool GetString(const StrRef &ref, std::string &str) const {
+    GE_ASSERT_TRUE(static_cast<uint64_t>(ref.offset) + ref.len <= header_.str_pool.size,
+                   "[OM2] String ref [%u, %u] out of range %lu", ref.offset, ref.len, header_.str_pool.size);
+    str.assign(reinterpret_cast<const char *>(data_ + header_.str_pool.offset + ref.offset), ref.len);
+    return true;
+  }
+
+  bool GetInts(const Span &span, const size_t ints_per_item, std::vector<int64_t> &values) const {
+    const uint64_t int_num = header_.int_pool.size / sizeof(int64_t);
+    const uint64_t count = static_cast<uint64_t>(span.count) * ints_per_item;
+    GE_ASSERT_TRUE(static_cast<uint64_t>(span.begin) + count <= int_num, "[OM2] Int span [%u, %u] out of range %lu",
+                   span.begin, span.count, int_num);
+    values.resize(static_cast<size_t>(count));
+    if (count > 0U) {
+      (void)memcpy(values.data(), data_ + header_.int_pool.offset + span.begin * sizeof(int64_t),
+                   count * sizeof(int64_t));
+    }
+    return true;
+  }
+
+  bool GetTensorDesc(const TensorDescRecord &record, Om2TensorDesc &desc) const {
+    std::string name;
+    GE_ASSERT_TRUE(GetString(record.name, name));
+    desc.SetName(name);
+    desc.SetDataType(static_cast<DataType>(record.data_type));
+    desc.SetFormat(static_cast<Format>(record.format));
+    desc.SetSize(static_cast<size_t>(record.size));
+    std::vector<int64_t> values;
+    GE_ASSERT_TRUE(GetInts(record.shape, 1U, values));
+    desc.SetShape(values);
+    GE_ASSERT_TRUE(GetInts(record.shape_range, kShapeRangeIntNum, values));
+    std::vector<std::pair<int64_t, int64_t>> shape_range;
+    shape_range.reserve(record.shape_range.count);
+    for (size_t i = 0U; i < values.size(); i += kShapeRangeIntNum) {
+      shape_range.emplace_back(values[i], values[i + 1U]);
+    }
+    desc.SetShapeRange(shape_range);
+    return true;
+  }
+
+ private:
+  bool CheckSection(const Section &section, const uint64_t count, const uint64_t item_size) const {
+    GE_ASSERT_TRUE(section.offset <= data_size_, "[OM2] Section offset %lu out of range %zu", section.offset,
+                   data_size_);
+    GE_ASSERT_TRUE(section.size <= data_size_ - section.offset, "[OM2] Section [%lu, %lu] out of range %zu",
+                   section.offset, section.size, data_size_);
+    if (count == 0U) {
+      return true;
+    }
+    GE_ASSERT_TRUE(item_size > 0U, "[OM2] Invalid record size 0 with %lu records", count);
+    GE_ASSERT_TRUE(count <= section.size / item_size, "[OM2] Section size %lu is too small for %lu records of %lu",
+                   section.size, count, item_size);
+    return true;
+  }
+
+  template <typename T>
+  bool ReadFixed(const Section &section, const uint64_t count, const uint32_t stride, const size_t index,
+                 T &record) const {
+    GE_ASSERT_TRUE(index < count, "[OM2] Record index %zu out of range %lu", index, count);
+    record = T{};
+    const size_t copy_size = std::min(static_cast<size_t>(stride), sizeof(T));
+    (void)memcpy(&record, data_ + section.offset + index * stride, copy_size);
+    return true;
+  }
+
+  Header header_{};
+  const uint8_t *data_{nullptr};
+  size_t data_size_{0U};
+};
+}  // namespace
+
+bool Om2BinaryMetaCodec::IsBinaryMeta(const uint8_t *data, const size_t data_size) {
+  uint32_t magic = 0U;
+  if ((data == nullptr) || (data_size < sizeof(Header))) {
+    return false;
+  }
+  (void)memcpy(&magic, data, sizeof(magic));
+  return magic == kOm2BinaryMetaMagic;
+}
+
+Status Om2BinaryMetaCodec::EncodeOpAttrMap(
+    const std::map<std::string, std::map<std::string, std::string>> &op_attr_map, std::vector<uint8_t> &buffer) {
+  Om2BinaryMetaBuilder builder(Om2BinaryMetaKind::kOpAttr, 0U);
+  for (const auto &[op_name, attrs] : op_attr_map) {
+    OpAttrRecord record{};
+    record.op_name = builder.AddString(op_name);
+    record.attrs.begin = builder.SubRecordCount();
+    record.attrs.count = static_cast<uint32_t>(attrs.size());
+    for (const auto &[attr_name, value] : attrs) {
+      builder.AddSubRecord(AttrRecord{builder.AddString(attr_name), builder.AddString(value)});
+    }
+    builder.AddRecord(record);
+  }
+  return builder.Finish(buffer);
+}
+
+Status Om2BinaryMetaCodec::DecodeOpAttrMap(const uint8_t *data, const size_t data_size,
+                                           std::map<std::string, std::map<std::string, std::string>> &op_attr_map) {
+  Om2BinaryMetaView view;
+  GE_ASSERT_SUCCESS(view.Init(data, data_size, Om2BinaryMetaKind::kOpAttr));
+  std::string op_name;
+  std::string attr_name;
+  std::string value;
+  for (size_t i = 0U; i < view.RecordCount(); ++i) {
+    OpAttrRecord record{};
+    GE_ASSERT_TRUE(view.GetRecord(i, record));
+    GE_ASSERT_TRUE(view.GetString(record.op_name, op_name));
+    // 编码时按map顺序写入，带hint插入为均摊常数复杂度
+    auto &attrs = op_attr_map.emplace_hint(op_attr_map.end(), op_name, std::map<std::string, std::string>{})->second;
+    for (uint32_t j = 0U; j < record.attrs.count; ++j) {
+      AttrRecord attr{};
+      GE_ASSERT_TRUE(view.GetSubRecord(static_cast<size_t>(record.attrs.begin) + j, attr));
+      GE_ASSERT_TRUE(view.GetString(attr.name, attr_name));
+      GE_ASSERT_TRUE(view.GetString(attr.value, value));
+      (void)attrs.emplace_hint(attrs.end(), attr_name, value);
+    }
+  }
+  return SUCCESS;
+}
+
+Status Om2BinaryMetaCodec::EncodeConstantsConfig(const Om2ConstMetas &consts, const size_t internal_weight_size,
+                                                 const bool is_offline, std::vector<uint8_t> &buffer) {
+  // 与json格式一致，按const key去重排序，保证两种格式加载出的常量列表相同
+  std::map<std::string, const Om2ConstMeta *> sorted_consts;
+  for (const auto &const_meta : consts) {
+    std::string const_key = const_meta.op_name.empty() ? const_meta.file_name : const_meta.op_name;
+    if (const_key.empty()) {
+      const_key = "constant_" + std::to_string(const_meta.index);
+    }
+    sorted_consts[const_key] = &const_meta;
+  }
+  Om2BinaryMetaBuilder builder(Om2BinaryMetaKind::kConstantsConfig, static_cast<uint64_t>(internal_weight_size));
+  for (const auto &key_to_meta : sorted_consts) {
+    const auto &const_meta = *key_to_meta.second;
+    ConstRecord record{};
+    record.index = static_cast<uint64_t>(const_meta.index);
+    record.offset = const_meta.offset;
+    record.size = const_meta.size;
+    record.type = builder.AddString(const_meta.type);
+    record.file_name = builder.AddString(const_meta.file_name);
+    if (!is_offline && const_meta.type != "INTERNAL" && !const_meta.file_path.empty()) {
+      record.file_path = builder.AddString(const_meta.file_path);
+    } else {
+      record.file_path = builder.AddString("");
+    }
+    record.op_name = builder.AddString(const_meta.op_name);
+    builder.AddRecord(record);
+  }
+  return builder.Finish(buffer);
+}
+
+Status Om2BinaryMetaCodec::DecodeConstantsConfig(const uint8_t *data, const size_t data_size, Om2ConstMetas &consts,
+                                                 size_t &internal_weight_size) {
+  Om2BinaryMetaView view;
+  GE_ASSERT_SUCCESS(view.Init(data, data_size, Om2BinaryMetaKind::kConstantsConfig));
+  internal_weight_size = static_cast<size_t>(view.Aux());
+  consts.reserve(consts.size() + view.RecordCount());
+  for (size_t i = 0U; i < view.RecordCount(); ++i) {
+    ConstRecord record{};
+    GE_ASSERT_TRUE(view.GetRecord(i, record));
+    Om2ConstMeta meta;
+    meta.index = static_cast<size_t>(record.index);
+    meta.offset = record.offset;
+    meta.size = record.size;
+    GE_ASSERT_TRUE(view.GetString(record.type, meta.type));
+    GE_ASSERT_TRUE(view.GetString(record.file_name, meta.file_name));
+    GE_ASSERT_TRUE(view.GetString(record.file_path, meta.file_path));
+    GE_ASSERT_TRUE(view.GetString(record.op_name, meta.op_name));
+    (void)consts.emplace_back(std::move(meta));
+  }
+  return SUCCESS;
+}
+
+Status Om2BinaryMetaCodec::EncodeVariablesConfig(const std::vector<Om2VarMeta> &var_metas, const uint32_t graph_id,
+                                                 std::vector<uint8_t> &buffer) {
+  Om2BinaryMetaBuilder builder(Om2BinaryMetaKind::kVariablesConfig, static_cast<uint64_t>(graph_id));
+  for (const auto &meta : var_metas) {
+    VarMetaRecord record{};
+    record.index = static_cast<uint64_t>(meta.index);
+    record.var_name = builder.AddString(meta.var_name);
+    record.op_type = builder.AddString(meta.op_type);
+    record.op_name = builder.AddString(meta.op_name);
+    record.tensor_desc = builder.AddTensorDesc(meta.tensor_desc);
+    builder.AddRecord(record);
+  }
+  return builder.Finish(buffer);
+}
+
+Status Om2BinaryMetaCodec::DecodeVariablesConfig(const uint8_t *data, const size_t data_size,
+                                                 std::vector<Om2VarMeta> &var_metas, uint32_t &graph_id) {
+  Om2BinaryMetaView view;
+  GE_ASSERT_SUCCESS(view.Init(data, data_size, Om2BinaryMetaKind::kVariablesConfig));
+  graph_id = static_cast<uint32_t>(view.Aux());
+  var_metas.reserve(var_metas.size() + view.RecordCount());
+  for (size_t i = 0U; i < view.RecordCount(); ++i) {
+    VarMetaRecord record{};
+    GE_ASSERT_TRUE(view.GetRecord(i, record));
+    Om2VarMeta meta;
+    meta.index = static_cast<size_t>(record.index);
+    GE_ASSERT_TRUE(view.GetString(record.var_name, meta.var_name));
+    GE_ASSERT_TRUE(view.GetString(record.op_type, meta.op_type));
+    GE_ASSERT_TRUE(view.GetString(record.op_name, meta.op_name));
+    GE_ASSERT_TRUE(view.GetTensorDesc(record.tensor_desc, meta.tensor_desc));
+    (void)var_metas.emplace_back(std::move(meta));
+  }
+  return SUCCESS;
+}
+}  // namespace ge
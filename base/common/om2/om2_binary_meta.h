@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GE_COMMON_OM2_OM2_BINARY_META_H_
+#define GE_COMMON_OM2_OM2_BINARY_META_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/ge_common/ge_types.h"
+#include "common/om2/codegen/om2_codegen_types.h"
+
+namespace ge {
+// 取值"binary"时om2包中的op_attr/constants/variables元数据使用二进制格式保存，默认"json"
+constexpr const char *kOptionOm2MetaFormat = "ge.om2MetaFormat";
+constexpr const char *kOm2MetaFormatBinary = "binary";
+// 二进制元数据entry在zip包中不压缩并按该字节数对齐，加载时可直接在包内存上解析
+constexpr size_t kOm2BinaryMetaAlignment = 64U;
+
+enum class Om2MetaFormat : uint32_t { kJson = 0U, kBinary = 1U };
+
+enum class Om2BinaryMetaKind : uint16_t { kOpAttr = 1U, kConstantsConfig = 2U, kVariablesConfig = 3U };
+
+/**
+ * om2二进制元数据格式(小端)，所有区段均为定长记录，读取时只做越界校验，不做文本解析：
+ *   Header | records[record_count] | sub_records[sub_record_count] | int64 pool | string pool
+ * 记录中的字符串以(offset, len)引用string pool，变长数组以(begin, count)引用sub_records或int64 pool。
+ * 主版本号不一致时拒绝解析，新增字段通过追加记录尾部并提升次版本号兼容。
+ */
+class Om2BinaryMetaCodec {
+ public:
+  static Status EncodeOpAttrMap(const std::map<std::string, std::map<std::string, std::string>> &op_attr_map,
+                                std::vector<uint8_t> &buffer);
+  static Status DecodeOpAttrMap(const uint8_t *data, size_t data_size,
+                                std::map<std::string, std::map<std::string, std::string>> &op_attr_map);
+
+  /**
+   * 与json格式保持一致，离线模式以及INTERNAL类型的常量不保存file_path
+   */
+  static Status EncodeConstantsConfig(const Om2ConstMetas &consts, size_t internal_weight_size, bool is_offline,
+                                      std::vector<uint8_t> &buffer);
+  static Status DecodeConstantsConfig(const uint8_t *data, size_t data_size, Om2ConstMetas &consts,
+                                      size_t &internal_weight_size);
+
+  static Status EncodeVariablesConfig(const std::vector<Om2VarMeta> &var_metas, uint32_t graph_id,
+                                      std::vector<uint8_t> &buffer);
+  static Status DecodeVariablesConfig(const uint8_t *data, size_t data_size, std::vector<Om2VarMeta> &var_metas,
+                                      uint32_t &graph_id);
+
+  static bool IsBinaryMeta(const uint8_t *data, size_t data_size);
+};
+}  // namespace ge
+
+#endif  // GE_COMMON_OM2_OM2_BINARY_META_H_
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "common/profiling/ge_host_trace_exporter.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include "common/checker.h"
+
+namespace gert {
+namespace {
+constexpr uint32_t kStreamMagic = 0x50484547U;  // "GEHP"
+constexpr uint32_t kStreamVersion = 2U;
+constexpr uint8_t kRecordsTag = 1U;
+constexpr uint8_t kStringTableTag = 2U;
+constexpr uint64_t kVarintMask = 0x7FUL;
+constexpr uint64_t kVarintContinue = 0x80UL;
+constexpr uint32_t kVarintShift = 7U;
+constexpr uint32_t kVarintMaxShift = 63U;
+constexpr int64_t kNsPerUs = 1000;
+// 防止损坏的文件导致字符串表无限扩容
+constexpr uint64_t kMaxStringIndex = 1UL << 24U;
+const std::string kModelName = "Model";
+const std::string kExecuteName = "Execute";
+
+void EncodeFixed32(const uint32_t value, std::string &buffer) {
+  for (size_t i = 0UL; i < sizeof(uint32_t); ++i) {
+    buffer.push_back(static_cast<char>((value >> (i * 8UL)) & 0xFFU));
+  }
+}
+
+void EncodeVarint(uint64_t value, std::string &buffer) {
+  while (value >= kVarintContinue) {
+    buffer.push_back(static_cast<char>((value & kVarintMask) | kVarintContinue));
+    value >>= kVarintShift;
+  }
+  buffer.push_back(static_cast<char>(value));
+}
+
+uint64_t ZigZagEncode(const int64_t value) {
+  return (static_cast<uint64_t>(value) << 1U) ^ static_cast<uint64_t>(value >> 63);
+}
+
+int64_t ZigZagDecode(const uint64_t value) {
+  return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1UL);
+}
+
+class StreamReader {
+ public:
+  explicit StreamReader(const std::string &data) : data_(data) {}
+  bool ReadFixed32(uint32_t &value) {
+    if ((data_.size() - offset_) < sizeof(uint32_t)) {
+      return false;
+    }
+    value = 0U;
+    for (size_t i = 0UL; i < sizeof(uint32_t); ++i) {
+      value |= static_cast<uint32_t>(static_cast<uint8_t>(data_[offset_ + i])) << (i * 8UL);
+    }
+    offset_ += sizeof(uint32_t);
+    return true;
+  }
+  bool ReadByte(uint8_t &value) {
+    if (offset_ >= data_.size()) {
+      return false;
+    }
+    value = static_cast<uint8_t>(data_[offset_++]);
+    return true;
+  }
+  bool ReadVarint(uint64_t &value) {
+    value = 0UL;
+    for (uint32_t shift = 0U; shift <= kVarintMaxShift; shift += kVarintShift) {
+      uint8_t byte = 0U;
+      if (!ReadByte(byte)) {
+        return false;
+      }
+      value |= (static_cast<uint64_t>(byte) & kVarintMask) << shift;
+      if ((byte & kVarintContinue) == 0U) {
+        return true;
+      }
+    }
+    return false;
+  }
+  bool ReadString(std::string &value) {
+    uint64_t len = 0UL;
+    if ((!ReadVarint(len)) || (len > (data_.size() - offset_))) {
+      return false;
+    }
+    value = data_.substr(offset_, len);
+    offset_ += len;
+    return true;
+  }
+  bool IsEnd() const {
+    return offset_ >= data_.size();
+  }
+
+ private:
+  const std::string &data_;
+  size_t offset_{0UL};
+};
+
+struct RawRecord {
+  int64_t thread_id;
+  int64_t timestamp_ns;
+  uint64_t name_idx;
+  uint64_t type_idx;
+  ExecutorEvent event;
+};
+
+ge::Status DecodeRecords(StreamReader &reader, const int64_t wall_clock_offset_ns, std::vector<RawRecord> &records) {
+  uint64_t thread_id = 0UL;
+  uint64_t num = 0UL;
+  GE_ASSERT_TRUE(reader.ReadVarint(thread_id) && reader.ReadVarint(num), "Failed to read records chunk head");
+  int64_t timestamp = 0;
+  for (uint64_t i = 0UL; i < num; ++i) {
+    uint64_t delta = 0UL;
+    RawRecord record{static_cast<int64_t>(thread_id), 0, 0UL, 0UL, kExecuteEventEnd};
+    uint8_t event = 0U;
+    GE_ASSERT_TRUE(reader.ReadVarint(delta) && reader.ReadVarint(record.name_idx) &&
+                       reader.ReadVarint(record.type_idx) && reader.ReadByte(event),
+                   "Failed to read record %" PRIu64 " of thread %" PRIu64, i, thread_id);
+    GE_ASSERT_TRUE(event < static_cast<uint8_t>(kExecuteEventEnd), "Invalid event %u", static_cast<uint32_t>(event));
+    timestamp += ZigZagDecode(delta);
+    record.timestamp_ns = timestamp + wall_clock_offset_ns;
+    record.event = static_cast<ExecutorEvent>(event);
+    records.emplace_back(record);
+  }
+  return ge::SUCCESS;
+}
+
+void WriteJsonString(const std::string &str, std::ostream &out_stream) {
+  out_stream << '"';
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        out_stream << "\\\"";
+        break;
+      case '\\':
+        out_stream << "\\\\";
+        break;
+      case '\n':
+        out_stream << "\\n";
+        break;
+      case '\t':
+        out_stream << "\\t";
+        break;
+      default:
+        if (static_cast<uint8_t>(c) < 0x20U) {
+          char_t escaped[8] = {};
+          (void)snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<uint32_t>(c));
+          out_stream << escaped;
+        } else {
+          out_stream << c;
+        }
+        break;
+    }
+  }
+  out_stream << '"';
+}
+
+// 形如"[name]"的字段去掉首尾的方括号
+std::string StripBracket(const std::string &field) {
+  if ((field.size() >= 2UL) && (field.front() == '[') && (field.back() == ']')) {
+    return field.substr(1UL, field.size() - 2UL);
+  }
+  return field;
+}
+}  // namespace
+
+void GeHostTraceFormat::EncodeHeader(const int64_t wall_clock_offset_ns, std::string &buffer) {
+  EncodeFixed32(kStreamMagic, buffer);
+  EncodeFixed32(kStreamVersion, buffer);
+  EncodeVarint(ZigZagEncode(wall_clock_offset_ns), buffer);
+}
+
+void GeHostTraceFormat::EncodeRecords(const ProfilingRecord *const records, const size_t num, std::string &buffer) {
+  if (num == 0UL) {
+    return;
+  }
+  buffer.push_back(static_cast<char>(kRecordsTag));
+  EncodeVarint(static_cast<uint64_t>(records[0].thread_id), buffer);
+  EncodeVarint(num, buffer);
+  // 同一线程相邻记录的时间戳很接近，差值编码后绝大多数记录只占5~8个字节
+  int64_t last_timestamp = 0;
+  for (size_t i = 0UL; i < num; ++i) {
+    const auto timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(records[i].timestamp.time_since_epoch()).count();
+    EncodeVarint(ZigZagEncode(timestamp - last_timestamp), buffer);
+    EncodeVarint(records[i].name_idx, buffer);
+    EncodeVarint(records[i].type_idx, buffer);
+    buffer.push_back(static_cast<char>(records[i].event));
+    last_timestamp = timestamp;
+  }
+}
+
+void GeHostTraceFormat::EncodeStringTable(const std::vector<std::string> &idx_to_str,
+                                          std::vector<std::string> &written_strs, std::string &buffer) {
+  // idx_to_str预先分配了空位，注册字符串时原地填充，因此按下标比较找出需要追加的字符串
+  std::vector<size_t> changed_indexes;
+  for (size_t i = 0UL; i < idx_to_str.size(); ++i) {
+    const bool is_written = (i < written_strs.size()) && (written_strs[i] == idx_to_str[i]);
+    if ((!is_written) && (!idx_to_str[i].empty())) {
+      changed_indexes.emplace_back(i);
+    }
+  }
+  written_strs = idx_to_str;
+  if (changed_indexes.empty()) {
+    return;
+  }
+  buffer.push_back(static_cast<char>(kStringTableTag));
+  EncodeVarint(changed_indexes.size(), buffer);
+  for (const auto idx : changed_indexes) {
+    EncodeVarint(idx, buffer);
+    EncodeVarint(idx_to_str[idx].size(), buffer);
+    buffer.append(idx_to_str[idx]);
+  }
+}
+
+ge::Status GeHostTraceExporter::LoadText(std::istream &in_stream) {
+  std::string line;
+  while (std::getline(in_stream, line)) {
+    // in format: <timestamp> <thread-id> [<node-name>] [<kernel-type>] <event-type>
+    const auto first_space = line.find(' ');
+    const auto second_space = (first_space == std::string::npos) ? first_space : line.find(' ', first_space + 1UL);
+    const auto last_space = line.rfind(' ');
+    const auto type_begin = line.rfind(" [", last_space);
+    if ((second_space == std::string::npos) || (type_begin == std::string::npos) || (type_begin <= second_space) ||
+        (line[second_space + 1UL] != '[')) {
+      continue;  // 版本号、统计信息等非记录行
+    }
+    TraceEvent trace_event{};
+    try {
+      trace_event.timestamp_ns = std::stoll(line.substr(0UL, first_space));
+      trace_event.thread_id = std::stoll(line.substr(first_space + 1UL, second_space - first_space - 1UL));
+    } catch (...) {
+      continue;
+    }
+    trace_event.name = StripBracket(line.substr(second_space + 1UL, type_begin - second_space - 1UL));
+    trace_event.type = StripBracket(line.substr(type_begin + 1UL, last_space - type_begin - 1UL));
+    const auto event = line.substr(last_space + 1UL);
+    const bool is_model = (trace_event.name == kModelName) && (trace_event.type == kExecuteName);
+    if (event == "Start") {
+      trace_event.event = is_model ? kModelStart : kExecuteStart;
+    } else if (event == "End") {
+      trace_event.event = is_model ? kModelEnd : kExecuteEnd;
+    } else {
+      continue;
+    }
+    events_.emplace_back(std::move(trace_event));
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status GeHostTraceExporter::LoadStream(const std::string &stream_path) {
+  std::ifstream in_stream(stream_path, std::ios::in | std::ios::binary);
+  GE_ASSERT_TRUE(in_stream.is_open(), "Failed to open ge host profiling file %s", stream_path.c_str());
+  const std::string data((std::istreambuf_iterator<char>(in_stream)), std::istreambuf_iterator<char>());
+  StreamReader reader(data);
+  uint32_t magic = 0U;
+  uint32_t version = 0U;
+  uint64_t wall_clock_offset = 0UL;
+  GE_ASSERT_TRUE(reader.ReadFixed32(magic) && reader.ReadFixed32(version) && reader.ReadVarint(wall_clock_offset),
+                 "Failed to read head of %s", stream_path.c_str());
+  GE_ASSERT_TRUE((magic == kStreamMagic) && (version == kStreamVersion),
+                 "%s is not a ge host profiling file, magic 0x%x, version %u", stream_path.c_str(), magic, version);
+
+  std::vector<RawRecord> records;
+  std::vector<std::string> idx_to_str;
+  while (!reader.IsEnd()) {
+    uint8_t tag = 0U;
+    (void)reader.ReadByte(tag);
+    if (tag == kRecordsTag) {
+      GE_ASSERT_SUCCESS(DecodeRecords(reader, ZigZagDecode(wall_clock_offset), records));
+    } else if (tag == kStringTableTag) {
+      uint64_t num = 0UL;
+      GE_ASSERT_TRUE(reader.ReadVarint(num), "Failed to read string table of %s", stream_path.c_str());
+      for (uint64_t i = 0UL; i < num; ++i) {
+        uint64_t idx = 0UL;
+        std::string str;
+        GE_ASSERT_TRUE(reader.ReadVarint(idx) && reader.ReadString(str), "Failed to read string %" PRIu64 " of %s", i,
+                       stream_path.c_str());
+        GE_ASSERT_TRUE(idx < kMaxStringIndex, "Invalid string index %" PRIu64 " in %s", idx, stream_path.c_str());
+        if (idx >= idx_to_str.size()) {
+          idx_to_str.resize(idx + 1UL);
+        }
+        idx_to_str[idx] = std::move(str);
+      }
+    } else {
+      GELOGE(ge::FAILED, "Unknown chunk tag %u in %s", static_cast<uint32_t>(tag), stream_path.c_str());
+      return ge::FAILED;
+    }
+  }
+
+  const auto get_str = [&idx_to_str](const uint64_t idx) -> std::string {
+    return ((idx < idx_to_str.size()) && (!idx_to_str[idx].empty())) ? idx_to_str[idx]
+                                                                     : ("Unknown_" + std::to_string(idx));
+  };
+  events_.reserve(events_.size() + records.size());
+  for (const auto &record : records) {
+    const bool is_model = (record.event == kModelStart) || (record.event == kModelEnd);
+    events_.emplace_back(TraceEvent{record.thread_id, record.timestamp_ns,
+                                    is_model ? kModelName : get_str(record.name_idx),
+                                    is_model ? kExecuteName : get_str(record.type_idx), record.event});
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status GeHostTraceExporter::WriteChromeTrace(std::ostream &out_stream) const {
+  // 同一线程内B/E事件需要按时间有序，否则trace viewer无法正确配对
+  std::vector<const TraceEvent *> sorted_events;
+  sorted_events.reserve(events_.size());
+  for (const auto &trace_event : events_) {
+    sorted_events.emplace_back(&trace_event);
+  }
+  std::stable_sort(sorted_events.begin(), sorted_events.end(), [](const TraceEvent *lhs, const TraceEvent *rhs) {
+    return (lhs->thread_id != rhs->thread_id) ? (lhs->thread_id < rhs->thread_id)
+                                              : (lhs->timestamp_ns < rhs->timestamp_ns);
+  });
+
+  const auto pid = static_cast<int64_t>(mmGetPid());
+  out_stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool is_first = true;
+  for (const auto trace_event : sorted_events) {
+    out_stream << (is_first ? "\n" : ",\n");
+    is_first = false;
+    out_stream << "{\"name\":";
+    WriteJsonString(trace_event->name, out_stream);
+    out_stream << ",\"cat\":";
+    WriteJsonString(trace_event->type, out_stream);
+    const bool is_begin = (trace_event->event == kExecuteStart) || (trace_event->event == kModelStart);
+    // ts单位为us，保留ns精度
+    const auto ts_us = trace_event->timestamp_ns / kNsPerUs;
+    const auto ts_ns = trace_event->timestamp_ns % kNsPerUs;
+    char_t ts[32] = {};
+    (void)snprintf(ts, sizeof(ts), "%" PRId64 ".%03" PRId64, ts_us, (ts_ns < 0) ? -ts_ns : ts_ns);
+    out_stream << ",\"ph\":\"" << (is_begin ? 'B' : 'E') << "\",\"ts\":" << ts << ",\"pid\":" << pid
+               << ",\"tid\":" << trace_event->thread_id << '}';
+  }
+  out_stream << "\n]}" << std::endl;
+  GE_ASSERT_TRUE(out_stream.good(), "Failed to write chrome trace");
+  return ge::SUCCESS;
+}
+}  // namespace gert
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_CXX_BASE_COMMON_PROFILING_GE_HOST_TRACE_EXPORTER_H_
+#define AIR_CXX_BASE_COMMON_PROFILING_GE_HOST_TRACE_EXPORTER_H_
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "runtime/subscriber/global_profiler.h"
+
+namespace gert {
+/**
+ * GlobalProfiler流式落盘的文件格式，整数均为小端varint：
+ *   文件头：magic(4B) version(4B) wall_clock_offset_ns
+ *   记录块：tag=1 thread_id count {zigzag(时间戳差值) name_idx type_idx event(1B)}*count
+ *   字符串表：tag=2 count {idx len bytes}*count，每次dump追加一段，只包含上一段之后新增或变化的字符串
+ */
+class GeHostTraceFormat {
+ public:
+  static void EncodeHeader(const int64_t wall_clock_offset_ns, std::string &buffer);
+  static void EncodeRecords(const ProfilingRecord *const records, const size_t num, std::string &buffer);
+  // written_strs为已写入文件的字符串表，编码后更新为idx_to_str
+  static void EncodeStringTable(const std::vector<std::string> &idx_to_str, std::vector<std::string> &written_strs,
+                                std::string &buffer);
+};
+
+// 把GE host profiling的结果转换成chrome trace json，可直接在chrome://tracing或Perfetto UI中打开
+class GeHostTraceExporter {
+ public:
+  // 解析GlobalProfiler::Dump输出的文本
+  ge::Status LoadText(std::istream &in_stream);
+  // 解析流式落盘的二进制文件，节点名和kernel类型从文件中各段字符串表合并后还原
+  ge::Status LoadStream(const std::string &stream_path);
+  ge::Status WriteChromeTrace(std::ostream &out_stream) const;
+  size_t GetEventNum() const {
+    return events_.size();
+  }
+
+ private:
+  struct TraceEvent {
+    int64_t thread_id;
+    int64_t timestamp_ns;
+    std::string name;
+    std::string type;
+    ExecutorEvent event;
+  };
+  std::vector<TraceEvent> events_;
+};
+}  // namespace gert
+
+#endif  // AIR_CXX_BASE_COMMON_PROFILING_GE_HOST_TRACE_EXPORTER_H_
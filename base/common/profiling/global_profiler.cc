@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <cinttypes>
+#include <cstdlib>
 #include <unordered_map>
 #include "runtime/subscriber/global_profiler.h"
 #include "base/err_msg.h"
@@ -26,6 +28,7 @@
 #include "graph/compute_graph.h"
 #include "aprof_pub.h"
 #include "graph/debug/ge_attr_define.h"
+#include "common/profiling/ge_host_trace_exporter.h"
 
 namespace gert {
 const std::unordered_map<std::string, GeProfInfoType> kNamesToProfTypes = {
@@ -56,6 +59,14 @@ constexpr uint32_t kHashOffset = 8U;
 const std::string kOpImplModeEnum = "_op_impl_mode_enum";
 constexpr uint32_t kEnableHf32 = 0x40U;
 constexpr uint32_t kOpImplHf32Mode = 1U;
+// 每个线程的环形缓冲区可容纳的记录数，必须是2的幂
+constexpr size_t kRecordRingCapacity = 64UL * 1024UL;
+constexpr std::chrono::milliseconds kFlushInterval(10);
+// 流式落盘时攒够这么多字节再写文件
+constexpr size_t kStreamWriteThreshold = 1024UL * 1024UL;
+constexpr const char_t *kEnvSampleInterval = "GE_HOST_PROFILING_SAMPLE_INTERVAL";
+constexpr const char_t *kEnvStreamToFile = "GE_HOST_PROFILING_STREAM";
+std::atomic<uint64_t> g_profiler_generation{0UL};
 
 REGISTER_PROF_TYPE(LaunchHcomKernel);
 REGISTER_PROF_TYPE(LaunchKernelWithHandle);
@@ -90,9 +101,8 @@ void DumpEventType(const ExecutorEvent et, std::ostream &out_stream) {
   }
 }
 
-void DumpE2eEvent(const int64_t thread_id, const ExecutorEvent et,
-                  const std::chrono::time_point<std::chrono::system_clock> timestamp, std::ostream &out_stream) {
-  out_stream << std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count() << ' ';
+void DumpE2eEvent(const int64_t thread_id, const ExecutorEvent et, const int64_t timestamp, std::ostream &out_stream) {
+  out_stream << timestamp << ' ';
   out_stream << thread_id << ' ';
   out_stream << "[Model]";
   out_stream << ' ';
@@ -148,10 +158,193 @@ void InitProfTensorDesc(const ge::TaskDescInfo &task_desc_info, const size_t ind
                 task_desc_info.output_shape, index - input_size);
   }
 }
+
+// 优先落盘到ASCEND_WORK_PATH下，文件名为ge_profiling_<pid><suffix>
+std::string GetGeProfilingPath(const std::string &suffix) {
+  std::string ascend_work_path;
+  GE_CHK_BOOL_EXEC(ge::GetAscendWorkPath(ascend_work_path) == ge::SUCCESS, return "",
+                   "Failed to get ASCEND_WORK_PATH");
+  const std::string file_name = "ge_profiling_" + std::to_string(mmGetPid()) + suffix;
+  return ascend_work_path.empty() ? file_name : (ascend_work_path + "/" + file_name);
+}
+
+int64_t GetWallClockOffset() {
+  const auto wall_clock = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+  const auto steady_clock =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(ProfilingClock::now().time_since_epoch()).count();
+  return wall_clock - steady_clock;
+}
 }  // namespace
 
-void GlobalProfiler::Dump(std::ostream &out_stream, std::vector<std::string> &idx_to_str) const {
-  size_t print_size = GetCount();
+GlobalProfilerOption GlobalProfilerOption::LoadFromEnv() {
+  GlobalProfilerOption option;
+  const char_t *sample_interval = std::getenv(kEnvSampleInterval);
+  if (sample_interval != nullptr) {
+    const auto interval = std::strtoull(sample_interval, nullptr, 10);
+    option.sample_interval = (interval == 0ULL) ? 1UL : static_cast<uint64_t>(interval);
+  }
+  const char_t *stream_to_file = std::getenv(kEnvStreamToFile);
+  if ((stream_to_file != nullptr) && (std::string(stream_to_file) == "1")) {
+    option.stream_path = GetGeProfilingPath(".bin");
+  }
+  GELOGI("[Ge Profiling] sample interval %" PRIu64 ", stream path [%s]", option.sample_interval,
+         option.stream_path.c_str());
+  return option;
+}
+
+ProfilingRecordRing::ProfilingRecordRing(const size_t capacity, const int64_t thread_id)
+    : capacity_(capacity), mask_(capacity - 1UL), thread_id_(thread_id),
+      records_(new (std::nothrow) ProfilingRecord[capacity]) {}
+
+size_t ProfilingRecordRing::PopAll(std::vector<ProfilingRecord> &records) {
+  const auto tail = tail_.load(std::memory_order_relaxed);
+  const auto head = head_.load(std::memory_order_acquire);
+  for (auto i = tail; i < head; ++i) {
+    records.emplace_back(records_[i & mask_]);
+  }
+  tail_.store(head, std::memory_order_release);
+  return head - tail;
+}
+
+GlobalProfiler::GlobalProfiler(const GlobalProfilerOption &option)
+    : generation_(g_profiler_generation.fetch_add(1UL, std::memory_order_relaxed) + 1UL),
+      sample_interval_(std::max(option.sample_interval, static_cast<uint64_t>(1UL))),
+      stream_path_(option.stream_path),
+      wall_clock_offset_ns_(GetWallClockOffset()) {
+  if (!stream_path_.empty()) {
+    stream_file_.open(stream_path_, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (stream_file_.is_open()) {
+      GeHostTraceFormat::EncodeHeader(wall_clock_offset_ns_, stream_buffer_);
+    } else {
+      GELOGW("[Ge Profiling] Failed to open %s, records will be kept in memory.", stream_path_.c_str());
+    }
+  }
+  flush_thread_ = std::thread([this]() { FlushLoop(); });
+}
+
+GlobalProfiler::~GlobalProfiler() {
+  {
+    const std::lock_guard<std::mutex> lk(flush_mutex_);
+    stop_flush_ = true;
+  }
+  flush_cv_.notify_all();
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+  if (stream_file_.is_open()) {
+    DrainRings();
+    stream_file_.write(stream_buffer_.data(), static_cast<std::streamsize>(stream_buffer_.size()));
+    stream_file_.close();
+  }
+}
+
+ProfilingRecordRing *GlobalProfiler::RegisterThreadRing() {
+  thread_local static const auto tid = static_cast<int64_t>(mmGetTid());
+  auto ring = ge::MakeUnique<ProfilingRecordRing>(kRecordRingCapacity, tid);
+  if ((ring == nullptr) || (!ring->IsValid())) {
+    GELOGW("[Ge Profiling] Failed to create record ring for thread %" PRId64, tid);
+    return nullptr;
+  }
+  const std::lock_guard<std::mutex> lk(rings_mutex_);
+  rings_.emplace_back(std::move(ring));
+  return rings_.back().get();
+}
+
+size_t GlobalProfiler::GetCount() const {
+  size_t count = 0UL;
+  const std::lock_guard<std::mutex> lk(rings_mutex_);
+  for (const auto &ring : rings_) {
+    count += ring->GetRecordCount();
+  }
+  return count;
+}
+
+void GlobalProfiler::FlushLoop() {
+  std::unique_lock<std::mutex> lk(flush_mutex_);
+  while (!stop_flush_) {
+    (void)flush_cv_.wait_for(lk, kFlushInterval, [this]() { return stop_flush_; });
+    DrainRings();
+  }
+}
+
+// 调用者需持有flush_mutex_
+void GlobalProfiler::DrainRings() {
+  std::vector<ProfilingRecordRing *> rings;
+  {
+    const std::lock_guard<std::mutex> lk(rings_mutex_);
+    for (const auto &ring : rings_) {
+      rings.emplace_back(ring.get());
+    }
+  }
+  for (const auto ring : rings) {
+    drain_buffer_.clear();
+    if (ring->PopAll(drain_buffer_) == 0UL) {
+      continue;
+    }
+    if (stream_file_.is_open()) {
+      GeHostTraceFormat::EncodeRecords(drain_buffer_.data(), drain_buffer_.size(), stream_buffer_);
+      continue;
+    }
+    const auto remain = (records_.size() < kProfilingDataCap) ? (kProfilingDataCap - records_.size()) : 0UL;
+    const auto keep_num = std::min(remain, drain_buffer_.size());
+    records_.insert(records_.end(), drain_buffer_.begin(), drain_buffer_.begin() + static_cast<int64_t>(keep_num));
+    overflow_count_ += drain_buffer_.size() - keep_num;
+  }
+  if (stream_file_.is_open() && (stream_buffer_.size() >= kStreamWriteThreshold)) {
+    stream_file_.write(stream_buffer_.data(), static_cast<std::streamsize>(stream_buffer_.size()));
+    stream_buffer_.clear();
+  }
+}
+
+// 调用者需持有flush_mutex_。只追加上次dump之后新注册的字符串，文件保持打开，之后的记录继续流式落盘
+void GlobalProfiler::WriteStringTable(const std::vector<std::string> &idx_to_str) {
+  GeHostTraceFormat::EncodeStringTable(idx_to_str, written_strs_, stream_buffer_);
+  stream_file_.write(stream_buffer_.data(), static_cast<std::streamsize>(stream_buffer_.size()));
+  stream_buffer_.clear();
+  (void)stream_file_.flush();
+}
+
+void GlobalProfiler::DumpRecords(std::ostream &out_stream, const std::vector<std::string> &idx_to_str) {
+  // 各线程的记录分别缓存，合并后按时间排序，同一时间戳保持记录顺序
+  std::stable_sort(records_.begin(), records_.end(), [](const ProfilingRecord &lhs, const ProfilingRecord &rhs) {
+    return lhs.timestamp < rhs.timestamp;
+  });
+  const auto get_str = [&idx_to_str](const uint64_t idx) -> const std::string & {
+    static const std::string kUnknown = "UNKNOWN";
+    return (idx < idx_to_str.size()) ? idx_to_str[idx] : kUnknown;
+  };
+  for (const auto &rec : records_) {
+    const auto timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(rec.timestamp.time_since_epoch()).count() +
+        wall_clock_offset_ns_;
+    if ((rec.event == kModelStart) || (rec.event == kModelEnd)) {
+      DumpE2eEvent(rec.thread_id, rec.event, timestamp, out_stream);
+      continue;
+    }
+    // in format: <timestamp> <thread-id> <node-name> <kernel-type> <event-type>
+    out_stream << timestamp << ' ';
+    out_stream << rec.thread_id << ' ';
+    out_stream << '[' << get_str(rec.name_idx) << ']';
+    out_stream << ' ';
+    out_stream << '[' << get_str(rec.type_idx) << ']';
+    out_stream << ' ';
+    DumpEventType(rec.event, out_stream);
+    out_stream << std::endl;
+  }
+}
+
+void GlobalProfiler::Dump(std::ostream &out_stream, std::vector<std::string> &idx_to_str) {
+  const std::lock_guard<std::mutex> lk(flush_mutex_);
+  DrainRings();
+  size_t dropped_count = overflow_count_;
+  {
+    const std::lock_guard<std::mutex> rings_lk(rings_mutex_);
+    for (const auto &ring : rings_) {
+      dropped_count += ring->GetDroppedCount();
+    }
+  }
+
   std::ofstream fs;
   GE_MAKE_GUARD(close, [&fs]() -> void {
     fs.flush();
@@ -160,14 +353,8 @@ void GlobalProfiler::Dump(std::ostream &out_stream, std::vector<std::string> &id
   const auto out_buf = out_stream.rdbuf();
   GE_CHECK_NOTNULL_JUST_RETURN(out_buf);
   if (&out_stream == &std::cout) {
-    std::string ascend_work_path;
-    GE_CHK_BOOL_EXEC(ge::GetAscendWorkPath(ascend_work_path) == ge::SUCCESS, return, "Failed to get ASCEND_WORK_PATH");
-    std::string ge_profiling_path;
-    if (!ascend_work_path.empty()) {
-      ge_profiling_path = ascend_work_path + "/ge_profiling_" + std::to_string(mmGetPid()) + ".txt";
-    } else {
-      ge_profiling_path = "ge_profiling_" + std::to_string(mmGetPid()) + ".txt";
-    }
+    const auto ge_profiling_path = GetGeProfilingPath(".txt");
+    GE_CHK_BOOL_EXEC(!ge_profiling_path.empty(), return, "Failed to get ge profiling path");
     fs.open(ge_profiling_path, std::ios::out | std::ios::app);
     if (fs.is_open()) {
       auto f_buf = fs.rdbuf();
@@ -176,28 +363,25 @@ void GlobalProfiler::Dump(std::ostream &out_stream, std::vector<std::string> &id
     }
   }
 
-  out_stream << "ExecutorProfiler version: " << kVersionSingleThread << ", dump start, records num: " << print_size
-             << std::endl;
-  if (print_size > kProfilingDataCap) {
-    out_stream << "Too many records(" << print_size << "), the records after " << kProfilingDataCap
-               << " will be dropped" << std::endl;
-    print_size = kProfilingDataCap;
-  }
-  for (size_t i = 0UL; i < print_size; ++i) {
-    auto &rec = records_[i];
-    if ((rec.event == kModelStart) || (rec.event == kModelEnd)) {
-      DumpE2eEvent(rec.thread_id, rec.event, rec.timestamp, out_stream);
-      continue;
+  out_stream << "ExecutorProfiler version: " << kVersionSingleThread << ", dump start, records num: "
+             << GetCount() << std::endl;
+  if (dropped_count > 0UL) {
+    out_stream << "Too many records, " << dropped_count << " records have been dropped" << std::endl;
+  }
+  if (stream_file_.is_open()) {
+    WriteStringTable(idx_to_str);
+    // 流式落盘的记录不在内存中保留，这里顺带转换成chrome trace方便直接查看
+    const auto trace_path = GetGeProfilingPath(".json");
+    GeHostTraceExporter exporter;
+    std::ofstream trace_file(trace_path, std::ios::out | std::ios::trunc);
+    if ((exporter.LoadStream(stream_path_) == ge::SUCCESS) && trace_file.is_open() &&
+        (exporter.WriteChromeTrace(trace_file) == ge::SUCCESS)) {
+      out_stream << "Records are streamed to " << stream_path_ << ", chrome trace: " << trace_path << std::endl;
+    } else {
+      out_stream << "Records are streamed to " << stream_path_ << ", failed to export chrome trace" << std::endl;
     }
-    // in format: <timestamp> <thread-id> <node-name> <kernel-type> <event-type>
-    out_stream << std::chrono::duration_cast<std::chrono::nanoseconds>(rec.timestamp.time_since_epoch()).count() << ' ';
-    out_stream << rec.thread_id << ' ';
-    out_stream << '[' << idx_to_str[rec.name_idx] << ']';
-    out_stream << ' ';
-    out_stream << '[' << idx_to_str[rec.type_idx] << ']';
-    out_stream << ' ';
-    DumpEventType(rec.event, out_stream);
-    out_stream << std::endl;
+  } else {
+    DumpRecords(out_stream, idx_to_str);
   }
   out_stream << "Profiling dump end" << std::endl;
   (void)out_stream.rdbuf(out_buf);
@@ -211,7 +395,7 @@ void GlobalProfilingWrapper::Init(const uint64_t enable_flags) {
   }
 
   if (IsEnabled(ProfilingType::kGeHost) && (global_profiler_ == nullptr)) {
-    global_profiler_ = ge::MakeUnique<GlobalProfiler>();
+    global_profiler_ = ge::MakeUnique<GlobalProfiler>(GlobalProfilerOption::LoadFromEnv());
     if (global_profiler_ == nullptr) {
       GELOGE(ge::FAILED, "Init global profiling failed.");
     }
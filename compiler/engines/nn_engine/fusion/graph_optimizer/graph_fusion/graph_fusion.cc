@@ -32,6 +32,7 @@
 #include "graph_optimizer/graph_fusion/fusion_pass_manager/builtin_pass/node_optimize/split_conv_concat_fusion_pass.h"
 #include "graph_optimizer/graph_fusion/fusion_pass_manager/builtin_pass/quant_pass/quant_host_cpu_op_common.h"
 #include "graph_optimizer/graph_fusion/graph_matcher.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
 #include "graph_optimizer/graph_fusion/fusion_pass_manager/builtin_pass/quant_pass/delete_no_const_folding_fusion_pass.h"
 #include "param_calculate/tensorsize_calculator.h"
 #include "common/util/trace_manager/trace_manager.h"
@@ -842,7 +843,8 @@ Status GraphFusion::RunGraphFusionPassByType(const string &stage, ge::ComputeGra
   return SUCCESS;
 }
 
-void AdjustRunCountAfterPass(ge::ComputeGraph &graph, const FusionPassOrRule &pass_or_rule, int64_t &run_count) {
+void AdjustRunCountAfterPass(ge::ComputeGraph &graph, const FusionPassOrRule &pass_or_rule, const bool is_index_updated,
+                             int64_t &run_count) {
   int64_t run_count_attr = 0;
   (void)ge::AttrUtils::GetInt(graph, "run_count", run_count_attr);
   run_count++;
@@ -850,11 +852,52 @@ void AdjustRunCountAfterPass(ge::ComputeGraph &graph, const FusionPassOrRule &pa
     FE_LOGI("pass:%s, run_count is not equal. run_count:%ld, cur_count:%ld", pass_or_rule.name.c_str(), run_count_attr,
             run_count);
     (void)GraphNodeMapUtil::ReCreateNodeTypeMapInGraph(graph);
+    // pattern pass在每次改写后已增量更新索引，节点数不一致说明pass在Fusion之外改了图，此时才遍历整图
+    const FusionPatternIndexPtr pattern_index = FusionPatternIndex::GetFromGraph(graph);
+    if ((pattern_index != nullptr) &&
+        ((!is_index_updated) || (pattern_index->GetNodeNum() != graph.GetDirectNodesSize()))) {
+      pattern_index->Update(graph);
+    }
     (void)ge::AttrUtils::SetInt(graph, "run_count", run_count);
   }
   return;
 }
 
+void GraphFusion::PreparePatternFusionPasses(
+    ge::ComputeGraph &graph, const std::vector<FusionPassOrRule> &sorted_graph_fusion_vec,
+    const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map,
+    std::vector<std::unique_ptr<PatternFusionBasePass>> &prepared_passes) const {
+  prepared_passes.clear();
+  prepared_passes.resize(sorted_graph_fusion_vec.size());
+  FusionPatternIndexPtr pattern_index = nullptr;
+  FE_MAKE_SHARED(pattern_index = std::make_shared<FusionPatternIndex>(), return);
+  for (size_t i = 0; i < sorted_graph_fusion_vec.size(); ++i) {
+    const FusionPassOrRule &pass_or_rule = sorted_graph_fusion_vec[i];
+    const auto pass_type = static_cast<GraphFusionPassType>(pass_or_rule.type);
+    if (pass_or_rule.method != PASS_METHOD || pass_or_rule.pass_desc.create_fn == nullptr ||
+        (pass_type != CUSTOM_AI_CORE_GRAPH_PASS && pass_type != CUSTOM_VECTOR_CORE_GRAPH_PASS &&
+         pass_type != BUILT_IN_GRAPH_PASS && pass_type != BUILT_IN_VECTOR_CORE_GRAPH_PASS) ||
+        find(GRAPH_FUSION_QUANT_PASS_VEC.begin(), GRAPH_FUSION_QUANT_PASS_VEC.end(), pass_or_rule.type) !=
+            GRAPH_FUSION_QUANT_PASS_VEC.end() ||
+        ge_pass_map.find(pass_or_rule.name) != ge_pass_map.end()) {
+      continue;
+    }
+    std::unique_ptr<GraphPass> graph_pass(pass_or_rule.pass_desc.create_fn());
+    auto pattern_pass = dynamic_cast<PatternFusionBasePass *>(graph_pass.get());
+    if (pattern_pass == nullptr) {
+      continue;
+    }
+    (void)graph_pass.release();
+    prepared_passes[i].reset(pattern_pass);
+    pattern_pass->SetName(pass_or_rule.name);
+    pattern_index->AddPatterns(pattern_pass->GetPatterns());
+  }
+  pattern_index->Build(graph);
+  FusionPatternIndex::SetToGraph(graph, pattern_index);
+  FE_LOGD("Graph[%s]: %zu patterns are indexed, %zu nodes are matched.", graph.GetName().c_str(),
+          pattern_index->GetPatternNum(), pattern_index->GetLastMatchedNodeNum());
+}
+
 Status GraphFusion::FusionEachGraph(ge::ComputeGraph &graph) {
   bool is_single_op_scene = false;
   (void)ge::AttrUtils::GetBool(graph, ge::ATTR_SINGLE_OP_SCENE, is_single_op_scene);
@@ -868,7 +911,11 @@ Status GraphFusion::FusionEachGraph(ge::ComputeGraph &graph) {
   }
   int64_t run_count = 0;
   auto ge_pass_map = GetGePassMapFromRegistry();
-  for (const FusionPassOrRule &pass_or_rule : sorted_graph_fusion_vec) {
+  // 所有pass的pattern编入同一索引，pass仍按优先级依次执行，每次改图后只重新匹配变化的节点
+  std::vector<std::unique_ptr<PatternFusionBasePass>> prepared_passes;
+  PreparePatternFusionPasses(graph, sorted_graph_fusion_vec, ge_pass_map, prepared_passes);
+  for (size_t i = 0; i < sorted_graph_fusion_vec.size(); ++i) {
+    const FusionPassOrRule &pass_or_rule = sorted_graph_fusion_vec[i];
     FE_TIMECOST_START(RunOnePassFusion);
     FE_LOGD("Start Graph Fusion:%s Owner:%s Method:%s Priority:%d.", pass_or_rule.name.c_str(),
             GetPassTypeString(static_cast<GraphFusionPassType>(pass_or_rule.type)).c_str(), pass_or_rule.method.c_str(),
@@ -877,11 +924,13 @@ Status GraphFusion::FusionEachGraph(ge::ComputeGraph &graph) {
     if (pass_or_rule.method == PASS_METHOD) {
       if (find(GRAPH_FUSION_QUANT_PASS_VEC.begin(), GRAPH_FUSION_QUANT_PASS_VEC.end(), pass_or_rule.type) ==
           GRAPH_FUSION_QUANT_PASS_VEC.end()) {
-        ret = RunOnePassFusion(graph, pass_or_rule, ge_pass_map);
-        AdjustRunCountAfterPass(graph, pass_or_rule, run_count);
+        const bool is_index_updated = prepared_passes[i] != nullptr;
+        ret = RunOnePassFusion(graph, pass_or_rule, ge_pass_map, std::move(prepared_passes[i]));
+        AdjustRunCountAfterPass(graph, pass_or_rule, is_index_updated, run_count);
       }
     } else if (pass_or_rule.method == RULE_METHOD) {
       ret = RunOneRuleFusion(graph, pass_or_rule);
+      FusionPatternIndex::UpdateInGraph(graph);
     } else {
       FE_LOGW("Unknown fusion method:%s.", pass_or_rule.method.c_str());
       continue;
@@ -889,9 +938,11 @@ Status GraphFusion::FusionEachGraph(ge::ComputeGraph &graph) {
     string out_s = "GraphFusion::RunOnePassFusion pass_name: " + pass_or_rule.name;
     FE_TIMECOST_END_LOGI(RunOnePassFusion, out_s.c_str());
     if (ret != SUCCESS) {
+      FusionPatternIndex::SetToGraph(graph, nullptr);
       return FAILED;
     }
   }
+  FusionPatternIndex::SetToGraph(graph, nullptr);
   if (GraphNodeMapUtil::ClearOpTypeMapToGraph(graph) != SUCCESS) {
     REPORT_FE_ERROR("[GraphOpt][FirstRoundFusion] Failed to clear op type map.");
     return FAILED;
@@ -1148,7 +1199,8 @@ Status GraphFusion::RunOneRuleFusion(ge::ComputeGraph &graph, const FusionPassOr
 }
 
 Status GraphFusion::RunOnePassFusion(ge::ComputeGraph &graph, const FusionPassOrRule &pass_or_rule,
-                                     const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map) {
+                                     const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map,
+                                     std::unique_ptr<PatternFusionBasePass> prepared_pass) {
   auto pass_type = static_cast<GraphFusionPassType>(pass_or_rule.type);
 
   int32_t priority = FusionPriorityManager::GetRealPriority(pass_or_rule.priority);
@@ -1180,8 +1232,9 @@ Status GraphFusion::RunOnePassFusion(ge::ComputeGraph &graph, const FusionPassOr
         (void)ge::AttrUtils::SetInt(graph, "run_count", ++run_count_attr);
       }
     } else {
-      auto pattern_fusion_base_pass_ptr = std::unique_ptr<PatternFusionBasePass>(
-          dynamic_cast<PatternFusionBasePass *>(pass_or_rule.pass_desc.create_fn()));
+      auto pattern_fusion_base_pass_ptr = (prepared_pass != nullptr) ? std::move(prepared_pass) :
+          std::unique_ptr<PatternFusionBasePass>(
+              dynamic_cast<PatternFusionBasePass *>(pass_or_rule.pass_desc.create_fn()));
       FE_CHECK(pattern_fusion_base_pass_ptr == nullptr,
                REPORT_FE_ERROR("[GraphOpt][FirstRoundFusion] Graph[%s], Pass[%s, %s]: the pattern fusion is nullptr.",
                                graph_name.c_str(), pass_or_rule.name.c_str(), pass_type_str.c_str()),
@@ -14,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "fusion_config_manager/fusion_priority_manager.h"
 #include "fusion_rule_manager/fusion_rule_data/fusion_rule_pattern.h"
@@ -118,7 +119,18 @@ class GraphFusion {
    *  @return  SUCCESS or FAILED
    */
   Status RunOnePassFusion(ge::ComputeGraph &graph, const FusionPassOrRule &pass_or_rule,
-                          const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map);
+                          const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map,
+                          std::unique_ptr<PatternFusionBasePass> prepared_pass = nullptr);
+
+  /*
+   *  @ingroup fe
+   *  @brief   create pattern fusion passes of graph in advance and index all their patterns in one traversal
+   *  @param   [in|out] graph compute graph
+   *  @param   [out] prepared_passes passes created, aligned with sorted_graph_fusion_vec
+   */
+  void PreparePatternFusionPasses(ge::ComputeGraph &graph, const std::vector<FusionPassOrRule> &sorted_graph_fusion_vec,
+                                  const std::map<std::string, ge::fusion::CreateFusionPassFn> &ge_pass_map,
+                                  std::vector<std::unique_ptr<PatternFusionBasePass>> &prepared_passes) const;
 
   Status RunOnePassFusionByType(ge::ComputeGraph &graph, const FusionPassOrRule &pass_or_rule,
                                 const GraphFusionPassType &pass_type,
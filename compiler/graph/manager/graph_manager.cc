@@ -31,6 +31,7 @@
 #include "opt_info/ge_opt_info.h"
 #include "analyzer/analyzer.h"
 #include "common/compile_profiling/ge_trace_wrapper.h"
+#include "common/compile_profiling/compile_profiler.h"
 #include "common/op/transop_util.h"
 #include "graph/ge_context.h"
 #include "base/err_mgr.h"
@@ -1378,8 +1379,14 @@ Status GraphManager::PreRun(const GraphNodePtr &graph_node, const std::vector<Ge
   ComputeGraphPtr root_graph = GraphUtilsEx::GetComputeGraph(*graph_node->GetGraph());
   GE_CHECK_NOTNULL(root_graph);
   graph_node->SetComputeGraph(root_graph);
-  GE_CHK_STATUS_RET(BuildModel(graph_node, inputs, root_graph, ge_root_model),
-                    "[Build][Model] failed, session_id:%" PRIu64 ", graph_id:%u.", session_id, graph_id);
+  const Status build_ret = BuildModel(graph_node, inputs, root_graph, ge_root_model);
+  if (CompileProfiler::GetInstance().IsEnabled()) {
+    // 编译失败时也落盘，便于定位失败前耗时的pass
+    std::string profile_path;
+    (void)CompileProfiler::GetInstance().Dump(CompileProfiler::GetCompileKey(root_graph), root_graph->GetName(),
+                                              graph_id, profile_path);
+  }
+  GE_CHK_STATUS_RET(build_ret, "[Build][Model] failed, session_id:%" PRIu64 ", graph_id:%u.", session_id, graph_id);
   graph_node->SetGeRootModel(ge_root_model);
   GE_COMPILE_TRACE_TIMESTAMP_END(BuildModel, "ModelBuild");
   ReportTracingRecordDuration(ge::TracingModule::kModelCompile);
@@ -3380,7 +3387,7 @@ Status GraphManager::OptimizeStage1(ge::ComputeGraphPtr &compute_graph) {
 
   NamesToPass names_to_passes;
   TransOpNearbyAllreduceFusionPass trans_op_nearby_allreduce_fusion_pass;
-  ConstantFoldingPass constant_folding_pass;
+  ConstantFoldingPass constant_folding_pass(true);
   ConstantClipPass constant_clip_pass;
   DimensionAdjustPass dimension_adjust_pass;
   EnterPass enter_pass;
@@ -3529,7 +3536,7 @@ Status GraphManager::OptimizeStage2(ge::ComputeGraphPtr &compute_graph) {
   SetAttrForHcomBroadCastOp(compute_graph);
 
   NamesToPass names_to_passes;
-  ConstantFoldingPass constant_folding_pass;
+  ConstantFoldingPass constant_folding_pass(true);
   ReshapeRemovePass reshape_remove_pass;
   CondRemovePass condition_remove_pass;
   AssignRemovePass assign_remove_pass;
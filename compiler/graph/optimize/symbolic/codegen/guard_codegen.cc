@@ -24,6 +24,7 @@
 #include "framework/common/framework_types_internal.h"
 #include "mmpa/mmpa_api.h"
 #include "guard_codegen.h"
+#include "guard_program_lowering.h"
 #include "common/compile_profiling/ge_call_wrapper.h"
 #include "graph/ge_local_context.h"
 #include "ge_common/ge_common_api_types.h"
@@ -35,6 +36,8 @@ const std::string kSymbolCheckFileName = "guard_check.cc";
 const std::string k2Space = "  ";
 constexpr uint32_t kMaxFileNameLen = 128U;
 constexpr char_t const *kGuardCheckSoDataResult = "_guard_check_so_data";
+// 取值为"1"时在GuardProgram之外仍编译guard_check.so，供旧版本运行时加载，默认关闭
+constexpr char_t const *kOptionGuardCheckSoCompatible = "ge.experiment.guard_check_so_compatible";
 constexpr size_t kConstLogHeaderLen = 110U;
 const std::regex kSafePathRegex(R"(^(?!.*\.{2})[A-Za-z0-9./+\-_]+$)");  // 允许字母、数字、_ / . -, 但禁止..
 
@@ -159,9 +162,7 @@ private:
 
 Status GenErrorInfos(CodePrinter &printer, const std::vector<SymbolCheckInfo> &symbol_check_infos) {
   for (const auto &iter : symbol_check_infos) {
-    printer.AddLine(k2Space + "err_msgs.emplace_back(\"[" + iter.file + ":" + std::to_string(iter.line) +
-                    "] Check Symbol Check Expression: " + std::string(iter.expr.Serialize().get()) +
-                    " Context Info: " + iter.dfx_info + " missed.\");");
+    printer.AddLine(k2Space + "err_msgs.emplace_back(\"" + GuardProgramLowering::GetMissedReason(iter) + "\");");
   }
   return SUCCESS;
 }
@@ -320,6 +321,12 @@ graphStatus CompileGuardCheckFunc(const CodePrinter &printer, const ComputeGraph
   GE_ASSERT_TRUE(AttrUtils::SetStr(graph, kGuardCheckSoDataResult, std::string(buffer.data(), buffer.size())));
   return GRAPH_SUCCESS;
 }
+
+bool IsGuardCheckSoCompatible() {
+  std::string compatible;
+  return (GetThreadLocalContext().GetOption(kOptionGuardCheckSoCompatible, compatible) == GRAPH_SUCCESS) &&
+         (compatible == "1");
+}
 }  // namespace
 
 Status GuardCodegen::GuardFuncCodegenAndCompile(const ComputeGraphPtr &graph) const {
@@ -351,4 +358,30 @@ Status GuardCodegen::GuardFuncCodegenAndCompile(const ComputeGraphPtr &graph) co
   GE_ASSERT_SUCCESS(CompileGuardCheckFunc(printer, graph));
   return GRAPH_SUCCESS;
 }
+
+Status GuardCodegen::GuardFuncLowerOrCompile(const ComputeGraphPtr &graph) const {
+  GE_ASSERT_NOTNULL(graph);
+  auto shape_env_attr = graph->GetAttrsGroup<ShapeEnvAttr>();
+  GE_ASSERT_NOTNULL(shape_env_attr);
+  GE_TIMESTAMP_START(GuardProgramLower);
+  const auto program = GuardProgramLowering::Lower(*shape_env_attr);
+  GE_TIMESTAMP_END(GuardProgramLower, "GuardProgramLower");
+  if (program == nullptr) {
+    GELOGI("Graph %s guards can not be lowered to guard program, fallback to compile guard_check.so.",
+           graph->GetName().c_str());
+    (void)graph->DelAttr(kGuardCheckProgramData);
+    return GuardFuncCodegenAndCompile(graph);
+  }
+  GE_ASSERT_TRUE(AttrUtils::SetStr(graph, kGuardCheckProgramData, program->Serialize()));
+  GELOGI("Graph %s guards are lowered to guard program, instruction num %zu, check num %zu.",
+         graph->GetName().c_str(), program->GetInstructionNum(), program->GetCheckNum());
+  if (IsGuardCheckSoCompatible()) {
+    // 模型需要在不识别GuardProgram的旧版本运行时上执行，额外保留guard_check.so
+    GELOGI("Option %s is enabled, compile guard_check.so for graph %s as well.", kOptionGuardCheckSoCompatible,
+           graph->GetName().c_str());
+    return GuardFuncCodegenAndCompile(graph);
+  }
+  (void)graph->DelAttr(kGuardCheckSoDataResult);
+  return GRAPH_SUCCESS;
+}
 }  // namespace ge
@@ -33,6 +33,15 @@ class GuardCodegen {
    * @return Status: SUCCESS表示成功
    */
   Status GuardFuncCodegenAndCompile(const ComputeGraphPtr &graph) const;
+
+  /**
+   * 优先把Guard关系表达式降级成进程内解释执行的GuardProgram，序列化后通过`_guard_check_program`属性打在graph上，
+   * 存在GuardProgram不支持的符号来源或表达式时回退到GuardFuncCodegenAndCompile。
+   * 模型需在旧版本运行时上执行时，可通过ge.experiment.guard_check_so_compatible=1同时生成guard_check.so
+   * @param graph：待生成guard check的计算图
+   * @return Status: SUCCESS表示成功
+   */
+  Status GuardFuncLowerOrCompile(const ComputeGraphPtr &graph) const;
 };
 }  // namespace ge
 
@@ -0,0 +1,381 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "guard_program_lowering.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+#include "framework/common/debug/ge_log.h"
+
+namespace ge {
+namespace {
+using OpCode = GuardProgram::OpCode;
+
+struct Operand {
+  uint16_t reg{0U};
+  bool is_float{false};
+};
+
+/* 解析Expression::Serialize()输出的C++表达式，按guard_check.so中的C++语义推导int64_t/double类型：
+ * 整数之间的四则运算、Mod、Max、Min、Abs结果为整数，整数除法向零取整；
+ * Pow、Exp、Log、Sqrt、Ceiling、Floor、Rational以及包含浮点的运算结果为浮点；
+ * 比较和逻辑运算结果为0/1的整数。 */
+class ExprLowering {
+ public:
+  ExprLowering(GuardProgramBuilder &builder, const std::unordered_map<std::string, SourceLoadInfo> &sources)
+      : builder_(builder), sources_(sources) {}
+
+  bool Lower(const std::string &text, Operand &result) {
+    text_ = &text;
+    pos_ = 0U;
+    if (!ParseAdd(result)) {
+      return false;
+    }
+    SkipSpace();
+    return pos_ == text.size();
+  }
+
+ private:
+  char Peek() {
+    SkipSpace();
+    return (pos_ < text_->size()) ? (*text_)[pos_] : '\0';
+  }
+
+  void SkipSpace() {
+    while ((pos_ < text_->size()) && (std::isspace(static_cast<unsigned char>((*text_)[pos_])) != 0)) {
+      ++pos_;
+    }
+  }
+
+  bool Expect(const char expected) {
+    if (Peek() != expected) {
+      GELOGI("Guard expression %s expects '%c' at %zu.", text_->c_str(), expected, pos_);
+      return false;
+    }
+    ++pos_;
+    return true;
+  }
+
+  Operand ToFloat(const Operand &operand) {
+    if (operand.is_float) {
+      return operand;
+    }
+    return {builder_.AddInstruction(OpCode::kIntToFloat, operand.reg), true};
+  }
+
+  Operand EmitBinary(const OpCode int_op, const OpCode float_op, const Operand &lhs, const Operand &rhs) {
+    if (!lhs.is_float && !rhs.is_float) {
+      return {builder_.AddInstruction(int_op, lhs.reg, rhs.reg), false};
+    }
+    return {builder_.AddInstruction(float_op, ToFloat(lhs).reg, ToFloat(rhs).reg), true};
+  }
+
+  Operand EmitCompare(const OpCode int_op, const OpCode float_op, const Operand &lhs, const Operand &rhs) {
+    Operand result = EmitBinary(int_op, float_op, lhs, rhs);
+    result.is_float = false;
+    return result;
+  }
+
+  Operand EmitFloatUnary(const OpCode op, const Operand &operand) {
+    return {builder_.AddInstruction(op, ToFloat(operand).reg), true};
+  }
+
+  Operand ToBool(const Operand &operand) {
+    if (operand.is_float) {
+      return EmitCompare(OpCode::kNeFloat, OpCode::kNeFloat, operand, FloatConst(0.0));
+    }
+    return EmitCompare(OpCode::kNeInt, OpCode::kNeFloat, operand, IntConst(0));
+  }
+
+  Operand IntConst(const int64_t value) {
+    const auto key = "i" + std::to_string(value);
+    const auto iter = leaves_.find(key);
+    if (iter != leaves_.end()) {
+      return iter->second;
+    }
+    const Operand operand{builder_.AddIntConst(value), false};
+    leaves_[key] = operand;
+    return operand;
+  }
+
+  Operand FloatConst(const double value) {
+    const auto key = "f" + std::to_string(value);
+    const auto iter = leaves_.find(key);
+    if (iter != leaves_.end()) {
+      return iter->second;
+    }
+    const Operand operand{builder_.AddFloatConst(value), true};
+    leaves_[key] = operand;
+    return operand;
+  }
+
+  bool ParseAdd(Operand &result) {
+    if (!ParseMul(result)) {
+      return false;
+    }
+    while ((Peek() == '+') || (Peek() == '-')) {
+      const bool is_add = ((*text_)[pos_++] == '+');
+      Operand rhs;
+      if (!ParseMul(rhs)) {
+        return false;
+      }
+      result = is_add ? EmitBinary(OpCode::kAddInt, OpCode::kAddFloat, result, rhs)
+                      : EmitBinary(OpCode::kSubInt, OpCode::kSubFloat, result, rhs);
+    }
+    return true;
+  }
+
+  bool ParseMul(Operand &result) {
+    if (!ParseUnary(result)) {
+      return false;
+    }
+    while ((Peek() == '*') || (Peek() == '/')) {
+      const bool is_mul = ((*text_)[pos_++] == '*');
+      Operand rhs;
+      if (!ParseUnary(rhs)) {
+        return false;
+      }
+      result = is_mul ? EmitBinary(OpCode::kMulInt, OpCode::kMulFloat, result, rhs)
+                      : EmitBinary(OpCode::kDivInt, OpCode::kDivFloat, result, rhs);
+    }
+    return true;
+  }
+
+  bool ParseUnary(Operand &result) {
+    if (Peek() != '-') {
+      return ParsePrimary(result);
+    }
+    ++pos_;
+    const char next = Peek();
+    if ((std::isdigit(static_cast<unsigned char>(next)) != 0) || (next == '.')) {
+      return ParseNumber(true, result);
+    }
+    Operand operand;
+    if (!ParseUnary(operand)) {
+      return false;
+    }
+    result = operand.is_float ? EmitBinary(OpCode::kSubInt, OpCode::kSubFloat, FloatConst(0.0), operand)
+                              : EmitBinary(OpCode::kSubInt, OpCode::kSubFloat, IntConst(0), operand);
+    return true;
+  }
+
+  bool ParsePrimary(Operand &result) {
+    const char c = Peek();
+    if (c == '(') {
+      ++pos_;
+      return ParseAdd(result) && Expect(')');
+    }
+    if ((std::isdigit(static_cast<unsigned char>(c)) != 0) || (c == '.')) {
+      return ParseNumber(false, result);
+    }
+    const size_t begin = pos_;
+    while ((pos_ < text_->size()) &&
+           ((std::isalnum(static_cast<unsigned char>((*text_)[pos_])) != 0) || ((*text_)[pos_] == '_'))) {
+      ++pos_;
+    }
+    if (begin == pos_) {
+      GELOGI("Guard expression %s has unsupported token at %zu.", text_->c_str(), pos_);
+      return false;
+    }
+    const std::string name = text_->substr(begin, pos_ - begin);
+    if (Peek() == '(') {
+      ++pos_;
+      return ParseCall(name, result);
+    }
+    return ParseName(name, result);
+  }
+
+  bool ParseNumber(const bool negative, Operand &result) {
+    const size_t begin = pos_;
+    bool is_float = false;
+    while (pos_ < text_->size()) {
+      const char c = (*text_)[pos_];
+      if ((c == '.') || (c == 'e') || (c == 'E')) {
+        is_float = true;
+      } else if (((c == '+') || (c == '-')) && ((*text_)[pos_ - 1U] == 'e' || (*text_)[pos_ - 1U] == 'E')) {
+        is_float = true;
+      } else if (std::isdigit(static_cast<unsigned char>(c)) == 0) {
+        break;
+      }
+      ++pos_;
+    }
+    const std::string literal = (negative ? "-" : "") + text_->substr(begin, pos_ - begin);
+    char *end = nullptr;
+    errno = 0;
+    if (is_float) {
+      const double value = std::strtod(literal.c_str(), &end);
+      result = FloatConst(value);
+    } else {
+      const int64_t value = std::strtoll(literal.c_str(), &end, 10);
+      result = IntConst(value);
+    }
+    if ((errno != 0) || (end != literal.c_str() + literal.size())) {
+      GELOGI("Guard expression %s has unsupported literal %s.", text_->c_str(), literal.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool ParseName(const std::string &name, Operand &result) {
+    if ((name == "True") || (name == "False")) {
+      result = IntConst((name == "True") ? 1 : 0);
+      return true;
+    }
+    const auto iter = leaves_.find(name);
+    if (iter != leaves_.end()) {
+      result = iter->second;
+      return true;
+    }
+    const auto source_iter = sources_.find(name);
+    if ((source_iter == sources_.end()) || (source_iter->second.type == SourceLoadType::kUnsupported)) {
+      GELOGI("Symbol %s in guard expression %s can not be loaded without codegen.", name.c_str(), text_->c_str());
+      return false;
+    }
+    result = {builder_.AddLoad(source_iter->second), false};
+    leaves_[name] = result;
+    return true;
+  }
+
+  bool ParseArgs(std::vector<Operand> &args) {
+    if (Peek() == ')') {
+      ++pos_;
+      return true;
+    }
+    while (true) {
+      Operand arg;
+      if (!ParseAdd(arg)) {
+        return false;
+      }
+      args.emplace_back(arg);
+      if (Peek() != ',') {
+        return Expect(')');
+      }
+      ++pos_;
+    }
+  }
+
+  bool ParseCall(const std::string &name, Operand &result) {
+    std::vector<Operand> args;
+    if (!ParseArgs(args)) {
+      return false;
+    }
+    if ((name == "LogicAnd") || (name == "LogicOr")) {
+      if (args.empty()) {
+        return false;
+      }
+      result = ToBool(args[0U]);
+      for (size_t i = 1U; i < args.size(); ++i) {
+        const OpCode op = (name == "LogicAnd") ? OpCode::kAnd : OpCode::kOr;
+        result = {builder_.AddInstruction(op, result.reg, ToBool(args[i]).reg), false};
+      }
+      return true;
+    }
+    if (args.size() == 1U) {
+      return LowerUnaryCall(name, args[0U], result);
+    }
+    if (args.size() == 2U) {
+      return LowerBinaryCall(name, args[0U], args[1U], result);
+    }
+    GELOGI("Guard expression %s has unsupported function %s with %zu args.", text_->c_str(), name.c_str(),
+           args.size());
+    return false;
+  }
+
+  bool LowerUnaryCall(const std::string &name, const Operand &arg, Operand &result) {
+    static const std::unordered_map<std::string, OpCode> kFloatUnaryOps = {
+        {"Exp", OpCode::kExpFloat},   {"Log", OpCode::kLogFloat},         {"Sqrt", OpCode::kSqrtFloat},
+        {"Ceiling", OpCode::kCeilFloat}, {"Floor", OpCode::kFloorFloat}};
+    const auto iter = kFloatUnaryOps.find(name);
+    if (iter != kFloatUnaryOps.end()) {
+      result = EmitFloatUnary(iter->second, arg);
+      return true;
+    }
+    if (name == "Abs") {
+      result = {builder_.AddInstruction(arg.is_float ? OpCode::kAbsFloat : OpCode::kAbsInt, arg.reg), arg.is_float};
+      return true;
+    }
+    GELOGI("Guard expression %s has unsupported function %s.", text_->c_str(), name.c_str());
+    return false;
+  }
+
+  bool LowerBinaryCall(const std::string &name, const Operand &lhs, const Operand &rhs, Operand &result) {
+    static const std::unordered_map<std::string, std::pair<OpCode, OpCode>> kArithOps = {
+        {"Max", {OpCode::kMaxInt, OpCode::kMaxFloat}}, {"Min", {OpCode::kMinInt, OpCode::kMinFloat}},
+        {"Mod", {OpCode::kModInt, OpCode::kModFloat}}};
+    static const std::unordered_map<std::string, std::pair<OpCode, OpCode>> kCompareOps = {
+        {"ExpectEq", {OpCode::kEqInt, OpCode::kEqFloat}}, {"ExpectNe", {OpCode::kNeInt, OpCode::kNeFloat}},
+        {"ExpectLe", {OpCode::kLeInt, OpCode::kLeFloat}}, {"ExpectLt", {OpCode::kLtInt, OpCode::kLtFloat}}};
+    auto iter = kArithOps.find(name);
+    if (iter != kArithOps.end()) {
+      result = EmitBinary(iter->second.first, iter->second.second, lhs, rhs);
+      return true;
+    }
+    iter = kCompareOps.find(name);
+    if (iter != kCompareOps.end()) {
+      result = EmitCompare(iter->second.first, iter->second.second, lhs, rhs);
+      return true;
+    }
+    if (name == "Pow") {
+      result = {builder_.AddInstruction(OpCode::kPowFloat, ToFloat(lhs).reg, ToFloat(rhs).reg), true};
+      return true;
+    }
+    if (name == "Rational") {
+      result = {builder_.AddInstruction(OpCode::kDivFloat, ToFloat(lhs).reg, ToFloat(rhs).reg), true};
+      return true;
+    }
+    GELOGI("Guard expression %s has unsupported function %s.", text_->c_str(), name.c_str());
+    return false;
+  }
+
+  GuardProgramBuilder &builder_;
+  const std::unordered_map<std::string, SourceLoadInfo> &sources_;
+  // 符号和常量只加载一次，后续的guard直接复用寄存器
+  std::unordered_map<std::string, Operand> leaves_;
+  const std::string *text_{nullptr};
+  size_t pos_{0U};
+};
+}  // namespace
+
+std::string GuardProgramLowering::GetMissedReason(const SymbolCheckInfo &check_info) {
+  return "[" + check_info.file + ":" + std::to_string(check_info.line) +
+         "] Check Symbol Check Expression: " + std::string(check_info.expr.Serialize().get()) +
+         " Context Info: " + check_info.dfx_info + " missed.";
+}
+
+GuardProgramPtr GuardProgramLowering::Lower(ShapeEnvAttr &shape_env_attr) {
+  std::unordered_map<std::string, SourceLoadInfo> sources;
+  for (const auto &sym_to_source : shape_env_attr.GetAllSym2Src()) {
+    if (sym_to_source.second != nullptr) {
+      sources[std::string(sym_to_source.first.Serialize().get())] = sym_to_source.second->GetLoadInfo();
+    }
+  }
+  GuardProgramBuilder builder;
+  ExprLowering lowering(builder, sources);
+  for (const auto &check_infos :
+       {shape_env_attr.GetAllSymbolCheckInfos(), shape_env_attr.GetAllSymbolAssertInfos()}) {
+    for (const auto &check_info : check_infos) {
+      const std::string text(check_info.expr.Serialize().get());
+      Operand result;
+      if (!lowering.Lower(text, result)) {
+        GELOGI("Guard expression %s can not be lowered to guard program.", text.c_str());
+        return nullptr;
+      }
+      if (result.is_float) {
+        result = {builder.AddInstruction(OpCode::kNeFloat, result.reg, builder.AddFloatConst(0.0)), false};
+      }
+      builder.AddCheck(result.reg, GetMissedReason(check_info));
+    }
+  }
+  return builder.Build();
+}
+}  // namespace ge
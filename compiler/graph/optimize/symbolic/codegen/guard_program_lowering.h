@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_CXX_COMPILER_GRAPH_OPTIMIZE_SYMBOLIC_CODEGEN_GUARD_PROGRAM_LOWERING_H_
+#define AIR_CXX_COMPILER_GRAPH_OPTIMIZE_SYMBOLIC_CODEGEN_GUARD_PROGRAM_LOWERING_H_
+
+#include <string>
+#include "attribute_group/attr_group_shape_env.h"
+#include "common/guard/guard_program.h"
+
+namespace ge {
+class GuardProgramLowering {
+ public:
+  /**
+   * 把ShapeEnv中的guard表达式降级成GuardProgram字节码，类型推导与guard_check.so中的C++语义一致
+   * @param shape_env_attr：产生guard的ShapeEnv
+   * @return 存在不支持的符号来源或表达式时返回nullptr，调用方需要回退到codegen
+   */
+  static GuardProgramPtr Lower(ShapeEnvAttr &shape_env_attr);
+
+  // guard检查失败时的原因，与guard_check.so中的err_msgs一致
+  static std::string GetMissedReason(const SymbolCheckInfo &check_info);
+};
+}  // namespace ge
+
+#endif  // AIR_CXX_COMPILER_GRAPH_OPTIMIZE_SYMBOLIC_CODEGEN_GUARD_PROGRAM_LOWERING_H_
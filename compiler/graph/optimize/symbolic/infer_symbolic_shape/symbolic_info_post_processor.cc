@@ -79,7 +79,7 @@ Status SymbolicInfoPostProcessor::Run(const ComputeGraphPtr &graph) {
   GE_ASSERT_SUCCESS(MarkInferShapeMergeKey(graph));
 
   GuardCodegen guard_codegen{};
-  GE_ASSERT_SUCCESS(guard_codegen.GuardFuncCodegenAndCompile(graph));
+  GE_ASSERT_SUCCESS(guard_codegen.GuardFuncLowerOrCompile(graph));
   return SUCCESS;
 }
 }  // namespace ge
@@ -457,6 +457,10 @@ std::string InputShapeSource::GetSourceStr() const {
     }())";
 }
 
+SourceLoadInfo InputShapeSource::GetLoadInfo() const {
+  return {SourceLoadType::kInputShapeDim, input_data_idx_, static_cast<int64_t>(dim_idx_), DT_UNDEFINED};
+}
+
 std::string InputValueSumSource::GetSourceStr() const {
   return R"([&]() -> int64_t {
               const auto* tensor = context->GetGraphInputTensor()" +
@@ -476,6 +480,10 @@ std::string InputValueSumSource::GetSourceStr() const {
         )";
 }
 
+SourceLoadInfo InputValueSumSource::GetLoadInfo() const {
+  return {SourceLoadType::kInputValueSum, input_data_idx_, 0, dtype_};
+}
+
 std::string InputValueElementSource::GetSourceStr() const {
   return R"([&]() -> int64_t {
       const auto* tensor = context->GetGraphInputTensor()" +
@@ -493,6 +501,10 @@ std::string InputValueElementSource::GetSourceStr() const {
       }())";
 }
 
+SourceLoadInfo InputValueElementSource::GetLoadInfo() const {
+  return {SourceLoadType::kInputValueElement, input_data_idx_, static_cast<int64_t>(elem_idx_), dtype_};
+}
+
 std::string InputRankSource::GetSourceStr() const {
   return R"([&]() -> size_t {
       const auto *tensor = context->GetGraphInputTensor()" +
@@ -504,6 +516,10 @@ std::string InputRankSource::GetSourceStr() const {
     }())";
 }
 
+SourceLoadInfo InputRankSource::GetLoadInfo() const {
+  return {SourceLoadType::kInputRank, input_data_idx_, 0, DT_UNDEFINED};
+}
+
 Status SymbolicShapeSymbolizer::Symbolize(const ComputeGraphPtr &graph, const std::vector<GeTensor> &graph_inputs) {
   GELOGD("Start symbolize graph: %s", graph->GetName().c_str());
   // 对repeat算子特殊处理，Repeat算子需要对value的sum做symbolize处理，给repeat的data节点打上标签
@@ -29,6 +29,7 @@ class InputShapeSource : public ge::Source {
     return dim_idx_;
   }
   [[nodiscard]] std::string GetSourceStr() const override;
+  [[nodiscard]] SourceLoadInfo GetLoadInfo() const override;
 
  private:
   int32_t input_data_idx_;  // Data的index，描述symbol来自于graph输入中第几个输入data
@@ -40,6 +41,7 @@ class InputValueSumSource : public ge::Source {
   InputValueSumSource(int32_t input_data_idx, ge::DataType dtype) : input_data_idx_(input_data_idx), dtype_(dtype) {}
 
   [[nodiscard]] std::string GetSourceStr() const override;
+  [[nodiscard]] SourceLoadInfo GetLoadInfo() const override;
 
  private:
   int32_t input_data_idx_;  // Data的index，描述symbol来自于graph输入中第几个输入data
@@ -52,6 +54,7 @@ class InputValueElementSource : public ge::Source {
       : input_data_idx_(input_data_idx), elem_idx_(elem_idx), dtype_(dtype) {}
 
   [[nodiscard]] std::string GetSourceStr() const override;
+  [[nodiscard]] SourceLoadInfo GetLoadInfo() const override;
 
  private:
   int32_t input_data_idx_;  // Data的index，描述symbol来自于graph输入中第几个输入data
@@ -64,6 +67,7 @@ class InputRankSource final : public ge::Source {
   explicit InputRankSource(const int32_t input_data_idx) : input_data_idx_(input_data_idx) {}
 
   [[nodiscard]] std::string GetSourceStr() const override;
+  [[nodiscard]] SourceLoadInfo GetLoadInfo() const override;
 
  private:
   int32_t input_data_idx_;  // Data的index，描述symbol来自于graph输入中第几个输入data
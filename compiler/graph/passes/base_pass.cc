@@ -14,6 +14,7 @@
 #include <unordered_set>
 
 #include "common/checker.h"
+#include "common/compile_profiling/compile_profiler.h"
 #include "graph/utils/graph_utils.h"
 #include "graph/utils/type_utils_inner.h"
 #include "graph/passes/pass_utils.h"
@@ -323,19 +324,54 @@ Status GEPass::Run(const NamesToPass &names_to_passes, bool with_filter) {
     return PARAM_INVALID;
   }
 
-  const auto ret = RunPassesOneGraph(filtered_names_to_passes);
-  if (graph_ == root_graph_) {
-    // 只在根图打印pass的统计信息
-    for (const auto &name_to_pass : filtered_names_to_passes) {
-      GELOGI("[GEPERFTRACE] The time cost of %s is [%lu] micro seconds, call count is [%lu]",
-             name_to_pass.first.c_str(), name_to_pass.second->MutablePerf().time_cost_,
-             name_to_pass.second->MutablePerf().call_num_);
+  if ((graph_ != root_graph_) || (!CompileProfiler::GetInstance().IsEnabled())) {
+    const auto ret = RunPassesOneGraph(filtered_names_to_passes);
+    if (graph_ == root_graph_) {
+      PrintPassPerf(filtered_names_to_passes);
     }
+    return ret;
   }
-  return ret;
+  return RunPassesOneGraphWithProfile(filtered_names_to_passes);
   // todo debug mode is on, find first node in topo order which is not passed. and give a warning
 }
 
+void GEPass::PrintPassPerf(const NamesToPass &names_to_passes) {
+  // 只在根图打印pass的统计信息
+  for (const auto &name_to_pass : names_to_passes) {
+    GELOGI("[GEPERFTRACE] The time cost of %s is [%lu] micro seconds, call count is [%lu]",
+           name_to_pass.first.c_str(), name_to_pass.second->MutablePerf().time_cost_,
+           name_to_pass.second->MutablePerf().call_num_);
+  }
+}
+
+Status GEPass::RunPassesOneGraphWithProfile(const NamesToPass &names_to_passes) {
+  // 整组pass记录一条图规模和内存变化，组内每个pass按节点调用累计的耗时和次数各记录一条
+  std::string group_name = "GEPass(";
+  std::vector<BaseNodePass::Perf> perfs_before;
+  for (const auto &name_to_pass : names_to_passes) {
+    group_name += (perfs_before.empty() ? "" : ",") + name_to_pass.first;
+    perfs_before.emplace_back(name_to_pass.second->MutablePerf());
+  }
+  group_name += ")";
+  Status ret = SUCCESS;
+  {
+    PassProfileScope profile_scope(group_name, graph_);
+    ret = RunPassesOneGraph(names_to_passes);
+  }
+  PrintPassPerf(names_to_passes);
+  const auto compile_key = CompileProfiler::GetCompileKey(graph_);
+  for (size_t i = 0U; i < names_to_passes.size(); ++i) {
+    const auto &perf = names_to_passes[i].second->MutablePerf();
+    PassProfileSample sample;
+    sample.run_count = perf.call_num_ - perfs_before[i].call_num_;
+    sample.time_cost_us = perf.time_cost_ - perfs_before[i].time_cost_;
+    if (sample.run_count > 0UL) {
+      CompileProfiler::GetInstance().Record(compile_key, names_to_passes[i].first, graph_->GetName(), sample);
+    }
+  }
+  return ret;
+}
+
 Status GEPass::AddPassAfterGraphOptimized(const NamesToPass &names_to_passes) {
   pass_after_graph_ = names_to_passes;
   return SUCCESS;
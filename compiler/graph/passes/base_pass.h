@@ -297,6 +297,8 @@ class GEPass {
                            RepassLevelState &rp_state);
   Status RunPassesGraphRepass(const NamesToPass &names_to_passes, GraphLevelState &graph_state);
   Status RunPassesOneGraph(const NamesToPass &names_to_passes);
+  Status RunPassesOneGraphWithProfile(const NamesToPass &names_to_passes);
+  static void PrintPassPerf(const NamesToPass &names_to_passes);
   Status RunPassesOnSubGraph(const NodePtr &node, const NamesToPass &names_to_passes, bool &has_sub_graph);
   Status RunPassesOnNode(NodePtr &node, const NamesToPass &names_to_passes, GraphLevelState &graph_state,
                          RepassLevelState &rp_state);
@@ -15,6 +15,7 @@
 #include "graph/passes/pass_utils.h"
 #include "graph/utils/node_utils.h"
 #include "common/compile_profiling/ge_trace_wrapper.h"
+#include "common/compile_profiling/compile_profiler.h"
 #include "framework/omg/omg_inner_types.h"
 #include "common/util/trace_manager/trace_manager.h"
 
@@ -48,7 +49,11 @@ Status PassManager::Run(const ComputeGraphPtr &graph,
     GE_CHECK_NOTNULL(pass);
     TraceOwnerGuard guard("GE", pass_name, graph->GetName());
     GE_TRACE_START(PassRun);
-    Status status = pass->Run(graph);
+    Status status = SUCCESS;
+    {
+      PassProfileScope profile_scope(pass_name, graph);
+      status = pass->Run(graph);
+    }
     if ((status != SUCCESS) && (status != NOT_CHANGED)) {
       GELOGE(status, "[Pass][Run] failed on graph %s", graph->GetName().c_str());
       return status;
@@ -59,7 +64,10 @@ Status PassManager::Run(const ComputeGraphPtr &graph,
       std::string subgraph_pass_name = pass_name + "::" + graph->GetName();
       GE_TRACE_START(PassRunSubgraph);
       TraceOwnerGuard sub_guard("GE_SUB", subgraph_pass_name, graph->GetName());
-      status = pass->Run(subgraph);
+      {
+        PassProfileScope profile_scope(pass_name, subgraph);
+        status = pass->Run(subgraph);
+      }
       GE_COMPILE_TRACE_TIMESTAMP_END(PassRunSubgraph, subgraph_pass_name.c_str());
       if ((status != SUCCESS) && (status != NOT_CHANGED)) {
         GELOGE(status, "[Pass][Run] failed on subgraph %s", subgraph->GetName().c_str());
@@ -10,15 +10,14 @@
 
 #include "graph/passes/standard_optimize/common_subexpression_elimination_pass.h"
 
-#include <sstream>
 #include <string>
-#include <set>
 #include <queue>
+#include <vector>
 
 #include "common/checker.h"
-#include "common/base64.h"
 #include "graph/utils/node_utils.h"
 #include "graph/passes/standard_optimize/constant_folding/folding_pass.h"
+#include "graph/passes/standard_optimize/cse_node_table.h"
 #include "register/op_kernel_registry.h"
 #include "common/op/transop_util.h"
 
@@ -34,36 +33,6 @@ struct CandidateNodes {
     }
   }
 };
-std::string GetCseKey(const NodePtr &node) {
-  std::stringstream ss;
-  ss << node->GetType() << "-data-inputs-";
-  for (auto &in_anchor : node->GetAllInDataAnchors()) {
-    auto src_anchor = in_anchor->GetPeerOutAnchor();
-    if (src_anchor == nullptr) {
-      ss << in_anchor->GetIdx() << "-null-";
-    } else {
-      const auto &input_desc = node->GetOpDesc()->GetInputDescPtr(in_anchor->GetIdx());
-      GE_ASSERT_NOTNULL(input_desc);
-      ss << in_anchor->GetIdx() << "-" << src_anchor->GetOwnerNode()->GetName() << "-" << src_anchor->GetIdx() << "-"
-         << input_desc->GetShape().ToString() << "-" << input_desc->GetOriginShape().ToString() << "-"
-         << input_desc->GetFormat() << "-" << input_desc->GetOriginFormat() << "-";
-    }
-  }
-
-  ss << "control-inputs-";
-  std::set<std::string> control_in_node_names;
-  for (auto &src_node : node->GetInControlNodes()) {
-    control_in_node_names.insert(src_node->GetName());
-  }
-  for (auto &name : control_in_node_names) {
-    ss << name << "-";
-  }
-
-  ss << "attrs-" << AttrUtils::GetAllAttrsStr(node->GetOpDesc());
-
-  return ss.str();
-}
-
 Status CollectPeerCandidateNodesWithType(
     const OutDataAnchor *const out_data_anchor, const std::unordered_map<NodePtr, size_t> &nodes_2_topo_idx,
     std::map<std::string, std::map<size_t, NodePtr>> &node_types_to_ordered_nodes) {
@@ -123,6 +92,24 @@ Status CollectCandidate(const NodePtr &node, const std::unordered_map<NodePtr, s
 Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
   GELOGD("Begin to run the CSE process on the graph");
   GE_CHECK_NOTNULL(graph);
+  size_t round = 0U;
+  size_t total_removed_num = 0U;
+  while (true) {
+    size_t removed_num = 0U;
+    GE_CHK_STATUS_RET_NOLOG(RunOnce(graph, removed_num));
+    ++round;
+    total_removed_num += removed_num;
+    if ((!iterate_to_fixpoint_) || (removed_num == 0U)) {
+      break;
+    }
+  }
+  GELOGD("The CSE process on graph %s removed %zu nodes in %zu rounds", graph->GetName().c_str(), total_removed_num,
+         round);
+  return SUCCESS;
+}
+
+Status CommonSubexpressionEliminationPass::RunOnce(const ComputeGraphPtr &graph, size_t &removed_num) {
+  removed_num = 0U;
   // here mark nodes to its topo id, to make sure CSE optimize follow origin node seq
   std::unordered_map<NodePtr, size_t> nodes_2_topo_idx;
   size_t index = 0U;
@@ -136,21 +123,19 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
     GE_ASSERT_SUCCESS(CollectCandidate(node, nodes_2_topo_idx, candidate_nodes));
   }
 
-  std::unordered_map<std::string, NodePtr> keys_to_node;
+  CseNodeTable cse_nodes(nodes_2_topo_idx);
   while (!candidate_nodes.node_queue.empty()) {
     const auto node = candidate_nodes.node_queue.front();
     candidate_nodes.node_queue.pop();
-    auto key = GetCseKey(node);
-    GELOGD("The node %s cse key %s", node->GetName().c_str(), ge::base64::EncodeToBase64(key).c_str());
-    std::unordered_map<std::string, NodePtr>::const_iterator iter = keys_to_node.find(key);
-    if (iter == keys_to_node.cend()) {
-      keys_to_node[key] = node;
+    NodePtr same_node = nullptr;
+    GE_ASSERT_SUCCESS(cse_nodes.FindOrInsert(node, same_node));
+    if (same_node == nullptr) {
       continue;
     }
 
-    if (node->GetAllOutDataAnchorsSize() != iter->second->GetAllOutDataAnchorsSize()) {
+    if (node->GetAllOutDataAnchorsSize() != same_node->GetAllOutDataAnchorsSize()) {
       GELOGW("The node %s and %s have the same CSE key, but different output anchor count, skip to fusion them",
-             iter->second->GetName().c_str(), node->GetName().c_str());
+             same_node->GetName().c_str(), node->GetName().c_str());
       continue;
     }
 
@@ -159,12 +144,12 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
       output_map[i] = i;
     }
 
-    auto ret = GraphUtils::ReplaceNodeAnchors(iter->second, node, {}, output_map);
+    auto ret = GraphUtils::ReplaceNodeAnchors(same_node, node, {}, output_map);
     if (ret != GRAPH_SUCCESS) {
       REPORT_INNER_ERR_MSG("E19999", "Replace node:%s(%s)'s anchor by node:%s(%s) failed", node->GetName().c_str(),
-                           node->GetType().c_str(), iter->second->GetName().c_str(), iter->second->GetType().c_str());
+                           node->GetType().c_str(), same_node->GetName().c_str(), same_node->GetType().c_str());
       GELOGE(INTERNAL_ERROR, "[Replace][Node] %s by node %s failed, ret:%u", node->GetName().c_str(),
-             iter->second->GetName().c_str(), ret);
+             same_node->GetName().c_str(), ret);
       return INTERNAL_ERROR;
     }
     NodeUtils::UnlinkAll(*node);
@@ -176,10 +161,11 @@ Status CommonSubexpressionEliminationPass::Run(ComputeGraphPtr graph) {
              graph->GetName().c_str());
       return INTERNAL_ERROR;
     }
+    ++removed_num;
 
     GELOGI("Remove node %s by the CSE process, replace it with node %s", node->GetName().c_str(),
-           iter->second->GetName().c_str());
-    GE_ASSERT_SUCCESS(CollectCandidate(iter->second, nodes_2_topo_idx, candidate_nodes));
+           same_node->GetName().c_str());
+    GE_ASSERT_SUCCESS(CollectCandidate(same_node, nodes_2_topo_idx, candidate_nodes));
   }
   return SUCCESS;
 }
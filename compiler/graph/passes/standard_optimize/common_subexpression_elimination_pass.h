@@ -17,7 +17,15 @@
 namespace ge {
 class CommonSubexpressionEliminationPass : public GraphPass {
  public:
+  // iterate_to_fixpoint为true时重复整图消除直到某一轮没有节点被删除
+  explicit CommonSubexpressionEliminationPass(bool iterate_to_fixpoint = false)
+      : iterate_to_fixpoint_(iterate_to_fixpoint) {}
   Status Run(ge::ComputeGraphPtr graph) override;
+
+ private:
+  static Status RunOnce(const ComputeGraphPtr &graph, size_t &removed_num);
+
+  bool iterate_to_fixpoint_;
 };
 }  // namespace ge
 #endif  // GE_COMMON_SUBEXPRESSION_ELIMINATION_H_
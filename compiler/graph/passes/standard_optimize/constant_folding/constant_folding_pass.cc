@@ -11,10 +11,14 @@
 #include "graph/passes/standard_optimize/constant_folding/constant_folding_pass.h"
 
 #include <vector>
+#include "common/thread_pool/thread_pool.h"
+#include "base/err_mgr.h"
+#include "graph/ge_local_context.h"
 #include "graph/utils/node_utils.h"
 #include "graph/utils/type_utils.h"
 #include "graph/utils/constant_utils.h"
 #include "host_cpu_engine/host_cpu_engine.h"
+#include "host_kernels/kernel_elewise_engine.h"
 #include "api/gelib/gelib.h"
 #include "register/op_kernel_registry.h"
 #include "graph/ge_context.h"
@@ -26,8 +30,240 @@ const int64_t kShapeCalNum = 8;
 const char *const kKernelLibName = "aicpu_ascend_kernel";
 const char *const kOpsFlagClose = "0";
 const char *const kPassName = "ConstantFoldingPass";
+const char *const kPrecomputeThreadName = "ge_cstfold";
+constexpr uint32_t kPrecomputeThreadNum = 16U;
+// 就绪节点少于该值时直接在当前线程计算
+constexpr size_t kMinParallelNodeNum = 4U;
+
+struct PrecomputeTask {
+  std::shared_ptr<Kernel> kernel;
+  std::vector<ConstGeTensorPtr> inputs;
+  size_t missing_num = 0U;
+};
+
+void AppendDescSignature(const GeTensorDesc &desc, std::vector<int64_t> &signature) {
+  signature.emplace_back(static_cast<int64_t>(desc.GetDataType()));
+  signature.emplace_back(static_cast<int64_t>(desc.GetFormat()));
+  const auto &dims = desc.GetShape().GetDims();
+  signature.emplace_back(static_cast<int64_t>(dims.size()));
+  signature.insert(signature.end(), dims.begin(), dims.end());
+}
+
+// 签名覆盖kernel计算依赖的输入输出描述和输入数据，用于判断预计算结果与串行计算是否等价
+std::vector<int64_t> GenerateComputeSignature(const OpDescPtr &op_desc, const std::vector<ConstGeTensorPtr> &inputs) {
+  std::vector<int64_t> signature;
+  for (const auto &desc : op_desc->GetAllInputsDescPtr()) {
+    AppendDescSignature(*desc, signature);
+  }
+  for (const auto &desc : op_desc->GetAllOutputsDescPtr()) {
+    AppendDescSignature(*desc, signature);
+  }
+  for (const auto &input : inputs) {
+    if (input == nullptr) {
+      signature.emplace_back(-1);
+      continue;
+    }
+    signature.emplace_back(static_cast<int64_t>(reinterpret_cast<uintptr_t>(input->GetData().data())));
+    signature.emplace_back(static_cast<int64_t>(input->GetData().size()));
+    AppendDescSignature(input->GetTensorDesc(), signature);
+  }
+  return signature;
+}
+
+// 与ComputeWithHostCpuKernel的前置判断一致，host cpu kernel可用时相应节点不参与预计算
+bool IsHostCpuKernelAvailable() {
+  const std::shared_ptr<GELib> instance_ptr = ge::GELib::GetInstance();
+  if ((instance_ptr == nullptr) || (!instance_ptr->InitFlag())) {
+    return false;
+  }
+  return instance_ptr->OpsKernelManagerObj().GetOpsKernelInfoStore(kKernelLibName) != nullptr;
+}
+
+// 输出shape与节点描述不一致时，串行折叠会刷新后继节点的输入描述，后继节点的预计算结果必然失效，因此不再向后传递
+bool IsOutputsUsable(const NodePtr &node, const std::vector<GeTensorPtr> &outputs) {
+  const auto &op_desc = node->GetOpDesc();
+  if ((outputs.size() != op_desc->GetOutputsSize()) || (outputs.size() != node->GetAllOutDataAnchorsSize())) {
+    return false;
+  }
+  for (size_t i = 0U; i < outputs.size(); ++i) {
+    if ((outputs[i] == nullptr) || outputs[i]->GetTensorDesc().GetShape().IsUnknownShape() ||
+        (outputs[i]->GetTensorDesc().GetShape().GetDims() !=
+         op_desc->GetOutputDesc(static_cast<uint32_t>(i)).GetShape().GetDims())) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace
 
+void ConstantFoldingPass::OnStartPassGraph(const ComputeGraphPtr &graph) {
+  BaseNodePass::OnStartPassGraph(graph);
+  // 带子图节点处理完后会再次通知父图开始，已预计算过的图不再重复预计算
+  if (parallel_compute_ && precomputed_graphs_.insert(graph->GetName()).second) {
+    PrecomputeFoldableNodes(graph);
+  }
+}
+
+void ConstantFoldingPass::PrecomputeFoldableNodes(const ComputeGraphPtr &graph) {
+  std::string memory_optimization_policy;
+  (void)ge::GetContext().GetOption(MEMORY_OPTIMIZATION_POLICY, memory_optimization_policy);
+  if (memory_optimization_policy == kMemoryPriority) {
+    // 预计算结果在被消费前一直驻留内存，内存优先模式下不预计算
+    return;
+  }
+  const bool host_cpu_kernel_available = IsHostCpuKernelAvailable();
+  std::map<NodePtr, PrecomputeTask> tasks;
+  std::vector<NodePtr> wave;
+  for (const auto &node : graph->GetDirectNode()) {
+    const auto &op_desc = node->GetOpDesc();
+    if ((op_desc == nullptr) || NodeUtils::IsConst(*node) || (op_desc->GetInputsSize() == 0U) ||
+        (op_desc->GetInputsSize() != node->GetAllInDataAnchorsSize()) || (precomputed_results_.count(node) > 0U) ||
+        folding_pass::IsNoNeedConstantFolding(node) || folding_pass::IsUserSpecifiedSkipConstantFold(node) ||
+        AreAllOutputsEmptyShape(op_desc)) {
+      continue;
+    }
+    if (host_cpu_kernel_available && OpKernelRegistry::GetInstance().IsRegistered(NodeUtils::GetNodeType(node))) {
+      continue;
+    }
+    PrecomputeTask task;
+    task.kernel = folding_pass::GetKernelByType(node);
+    if (task.kernel == nullptr) {
+      continue;
+    }
+    task.inputs.resize(op_desc->GetInputsSize());
+    bool is_valid = true;
+    for (const auto &in_anchor : node->GetAllInDataAnchors()) {
+      const auto &peer_out_anchor = in_anchor->GetPeerOutAnchor();
+      if (peer_out_anchor == nullptr) {
+        is_valid = false;
+        break;
+      }
+      const auto &peer_node = peer_out_anchor->GetOwnerNode();
+      if (!NodeUtils::IsConst(*peer_node)) {
+        ++task.missing_num;
+        continue;
+      }
+      GeTensorPtr weight;
+      (void)ConstantUtils::MutableWeight(peer_node->GetOpDesc(), static_cast<uint32_t>(peer_out_anchor->GetIdx()),
+                                         weight);
+      if (weight == nullptr) {
+        is_valid = false;
+        break;
+      }
+      task.inputs[static_cast<size_t>(in_anchor->GetIdx())] = weight;
+    }
+    if (!is_valid) {
+      continue;
+    }
+    if (task.missing_num == 0U) {
+      wave.emplace_back(node);
+    }
+    tasks[node] = std::move(task);
+  }
+
+  std::unique_ptr<ThreadPool> thread_pool;
+  const auto &context = GetThreadLocalContext();
+  const auto &err_msg_ctx = error_message::GetErrMgrContext();
+  size_t precomputed_num = 0U;
+  while (!wave.empty()) {
+    std::vector<PrecomputedResult> results(wave.size());
+    std::vector<std::shared_ptr<Kernel>> kernels(wave.size());
+    for (size_t i = 0U; i < wave.size(); ++i) {
+      auto &task = tasks[wave[i]];
+      kernels[i] = task.kernel;
+      results[i].inputs = std::move(task.inputs);
+      results[i].signature = GenerateComputeSignature(wave[i]->GetOpDesc(), results[i].inputs);
+    }
+    const auto compute = [&wave, &kernels, &results](const size_t index) {
+      auto &result = results[index];
+      const uint64_t start_time = GetCurrentTimestamp();
+      result.ret = kernels[index]->Compute(wave[index]->GetOpDesc(), result.inputs, result.outputs);
+      result.cost_time = GetCurrentTimestamp() - start_time;
+    };
+    // 线程异常时丢弃对应结果，串行遍历到该节点时重新计算
+    std::vector<bool> computed(wave.size(), true);
+    if (wave.size() < kMinParallelNodeNum) {
+      for (size_t i = 0U; i < wave.size(); ++i) {
+        compute(i);
+      }
+    } else {
+      if (thread_pool == nullptr) {
+        thread_pool = MakeUnique<ThreadPool>(kPrecomputeThreadName, kPrecomputeThreadNum, false);
+      }
+      std::vector<std::future<void>> fut_rets;
+      for (size_t i = 0U; i < wave.size(); ++i) {
+        fut_rets.emplace_back(thread_pool->commit([&compute, &context, &err_msg_ctx, i]() {
+          error_message::SetErrMgrContext(err_msg_ctx);
+          GetThreadLocalContext() = context;
+          // 节点间已并行，kernel内部不再切块提交到elewise线程池
+          const ElewiseEngine::InlineScope inline_scope;
+          compute(i);
+        }));
+      }
+      for (size_t i = 0U; i < fut_rets.size(); ++i) {
+        if (!fut_rets[i].valid()) {
+          computed[i] = false;
+          continue;
+        }
+        // 多线程可能存在异常，增加try catch和相应的日志为了辅助定位
+        try {
+          fut_rets[i].get();
+        } catch (std::exception &e) {
+          GELOGW("Got an exception when precompute node %s, reason[%s].", wave[i]->GetNamePtr(), e.what());
+          computed[i] = false;
+        }
+      }
+    }
+
+    // 按就绪顺序串行回填后继节点输入，保证每轮就绪节点的顺序确定
+    std::vector<NodePtr> next_wave;
+    for (size_t i = 0U; i < wave.size(); ++i) {
+      const auto &node = wave[i];
+      if (!computed[i]) {
+        continue;
+      }
+      auto &result = results[i];
+      if ((result.ret == SUCCESS) && IsOutputsUsable(node, result.outputs)) {
+        for (const auto &out_anchor : node->GetAllOutDataAnchors()) {
+          const auto &output = result.outputs[static_cast<size_t>(out_anchor->GetIdx())];
+          for (const auto &peer_in_anchor : out_anchor->GetPeerInDataAnchors()) {
+            const auto iter = tasks.find(peer_in_anchor->GetOwnerNode());
+            if ((iter == tasks.end()) || (iter->second.missing_num == 0U)) {
+              continue;
+            }
+            iter->second.inputs[static_cast<size_t>(peer_in_anchor->GetIdx())] = output;
+            if (--iter->second.missing_num == 0U) {
+              next_wave.emplace_back(iter->first);
+            }
+          }
+        }
+      }
+      precomputed_results_[node] = std::move(result);
+      ++precomputed_num;
+    }
+    wave = std::move(next_wave);
+  }
+  GELOGI("Graph %s precomputed %zu constant folding nodes.", graph->GetName().c_str(), precomputed_num);
+}
+
+bool ConstantFoldingPass::GetPrecomputedResult(const NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs,
+                                               std::vector<GeTensorPtr> &outputs, Status &ret) {
+  const auto iter = precomputed_results_.find(node);
+  if (iter == precomputed_results_.end()) {
+    return false;
+  }
+  const PrecomputedResult result = std::move(iter->second);
+  (void)precomputed_results_.erase(iter);
+  if (result.signature != GenerateComputeSignature(node->GetOpDesc(), inputs)) {
+    GELOGD("Inputs of node %s changed after precompute, compute it again.", node->GetName().c_str());
+    return false;
+  }
+  outputs = result.outputs;
+  ret = result.ret;
+  AddCostTimeOfGeConstantFolding(node, result.cost_time);
+  return true;
+}
+
 bool ConstantFoldingPass::NeedIgnorePass(const NodePtr &node) {
   if (folding_pass::IsNoNeedConstantFolding(node)) {
     return true;
@@ -104,9 +340,15 @@ Status ConstantFoldingPass::ComputeWithBuiltInKernel(NodePtr &node, const vector
     return NOT_CHANGED;
   }
 
+  Status ret = SUCCESS;
+  if (GetPrecomputedResult(node, inputs, outputs, ret)) {
+    GELOGD("Use precomputed result of node %s type %s.", node->GetName().c_str(), node->GetType().c_str());
+    return ret;
+  }
+
   // Statistic of ge constant folding kernel
   uint64_t start_time = GetCurrentTimestamp();
-  auto ret = op_kernel->Compute(node->GetOpDesc(), inputs, outputs);
+  ret = op_kernel->Compute(node->GetOpDesc(), inputs, outputs);
   CollectCostTimeOfGeConstantFolding(node, start_time);
   return ret;
 }
@@ -156,7 +398,10 @@ const std::map<std::string, std::pair<uint64_t, uint64_t>> &ConstantFoldingPass:
 }
 
 void ConstantFoldingPass::CollectCostTimeOfGeConstantFolding(const NodePtr &node, uint64_t start_time) {
-  uint64_t cost_time = GetCurrentTimestamp() - start_time;
+  AddCostTimeOfGeConstantFolding(node, GetCurrentTimestamp() - start_time);
+}
+
+void ConstantFoldingPass::AddCostTimeOfGeConstantFolding(const NodePtr &node, uint64_t cost_time) {
   if (statistic_of_ge_constant_folding_.find(node->GetType()) != statistic_of_ge_constant_folding_.end()) {
     uint64_t &cnt = statistic_of_ge_constant_folding_[node->GetType()].first;
     uint64_t &cur_cost_time = statistic_of_ge_constant_folding_[node->GetType()].second;
@@ -12,6 +12,8 @@
 #define GE_GRAPH_PASSES_CONSTANT_FOLDING_PASS_H_
 
 #include <map>
+#include <set>
+#include <string>
 #include <vector>
 
 #include "graph/passes/standard_optimize/constant_folding/potential_folding_pass.h"
@@ -20,6 +22,9 @@
 namespace ge {
 class ConstantFoldingPass : public PotentialFoldingPass {
  public:
+  /// @param parallel_compute 开启后在遍历图之前并行预计算就绪的可折叠节点，图修改仍按原顺序串行执行
+  explicit ConstantFoldingPass(bool parallel_compute = false) : parallel_compute_(parallel_compute) {}
+  void OnStartPassGraph(const ComputeGraphPtr &graph) override;
   bool NeedIgnorePass(const NodePtr &node) override;
   bool NeedFold() const override;
   Status ComputePotentialWeight(NodePtr &node, std::vector<GeTensorPtr> &outputs) override;
@@ -34,13 +39,28 @@ class ConstantFoldingPass : public PotentialFoldingPass {
                                          std::vector<GeTensorPtr> &outputs);
 
  private:
+  struct PrecomputedResult {
+    // 持有输入以保证签名中的数据地址在结果被消费前不会被复用
+    std::vector<ConstGeTensorPtr> inputs;
+    std::vector<int64_t> signature;
+    std::vector<GeTensorPtr> outputs;
+    Status ret = NOT_CHANGED;
+    uint64_t cost_time = 0UL;
+  };
+  void PrecomputeFoldableNodes(const ComputeGraphPtr &graph);
+  bool GetPrecomputedResult(const NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs,
+                            std::vector<GeTensorPtr> &outputs, Status &ret);
   Status ComputeWithBuiltInKernel(NodePtr &node, const std::vector<ConstGeTensorPtr> &inputs,
                                   std::vector<GeTensorPtr> &outputs);
   void CollectCostTimeOfGeConstantFolding(const NodePtr &node, uint64_t start_time);
   void CollectCostTimeOfOpConstantFolding(const NodePtr &node, uint64_t start_time);
+  void AddCostTimeOfGeConstantFolding(const NodePtr &node, uint64_t cost_time);
   std::map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_op_constant_folding_;
   std::map<std::string, std::pair<std::uint64_t, uint64_t>> statistic_of_ge_constant_folding_;
   bool need_fold_ = true;
+  bool parallel_compute_ = false;
+  std::map<NodePtr, PrecomputedResult> precomputed_results_;
+  std::set<std::string> precomputed_graphs_;
 };
 }  // namespace ge
 
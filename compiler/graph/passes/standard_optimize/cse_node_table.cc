@@ -0,0 +1,163 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "graph/passes/standard_optimize/cse_node_table.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "common/checker.h"
+#include "graph/utils/attr_utils.h"
+
+namespace ge {
+namespace {
+CacheHashKey HashShape(CacheHashKey seed, const GeShape &shape) {
+  const size_t dim_num = shape.GetDimNum();
+  seed = HashUtils::HashCombine(seed, dim_num);
+  for (size_t i = 0U; i < dim_num; ++i) {
+    seed = HashUtils::HashCombine(seed, shape.GetDim(i));
+  }
+  return HashUtils::HashCombine(seed, shape.IsUnknownDimNum());
+}
+
+bool IsSameInputDesc(const ConstGeTensorDescPtr &lhs, const ConstGeTensorDescPtr &rhs) {
+  if ((lhs == nullptr) || (rhs == nullptr)) {
+    return lhs == rhs;
+  }
+  return (lhs->GetShape() == rhs->GetShape()) && (lhs->GetOriginShape() == rhs->GetOriginShape()) &&
+         (lhs->GetFormat() == rhs->GetFormat()) && (lhs->GetOriginFormat() == rhs->GetOriginFormat());
+}
+}  // namespace
+
+Status CseNodeTable::FindOrInsert(const NodePtr &node, NodePtr &same_node) {
+  same_node = nullptr;
+  CacheHashKey hash = 0UL;
+  GE_ASSERT_SUCCESS(GetStructuralHash(node, hash));
+  GELOGD("The node %s cse hash %lu", node->GetNamePtr(), hash);
+  auto &same_hash_nodes = hash_to_nodes_[hash];
+  for (const auto &recorded_node : same_hash_nodes) {
+    if (IsSameNode(recorded_node, node)) {
+      same_node = recorded_node;
+      return SUCCESS;
+    }
+  }
+  same_hash_nodes.emplace_back(node);
+  return SUCCESS;
+}
+
+size_t CseNodeTable::GetTypeId(const NodePtr &node) {
+  return type_ids_.emplace(node->GetType(), type_ids_.size()).first->second;
+}
+
+Status CseNodeTable::GetNodeId(const NodePtr &node, size_t &node_id) const {
+  const auto iter = nodes_2_topo_idx_.find(node);
+  GE_ASSERT_TRUE(iter != nodes_2_topo_idx_.cend(), "Node %s is not in the graph.", node->GetNamePtr());
+  node_id = iter->second;
+  return SUCCESS;
+}
+
+Status CseNodeTable::GetControlInputIds(const NodePtr &node, std::vector<size_t> &node_ids) const {
+  node_ids.clear();
+  for (const auto &src_node : node->GetInControlNodes()) {
+    size_t node_id = 0U;
+    GE_ASSERT_SUCCESS(GetNodeId(src_node, node_id));
+    node_ids.emplace_back(node_id);
+  }
+  std::sort(node_ids.begin(), node_ids.end());
+  node_ids.erase(std::unique(node_ids.begin(), node_ids.end()), node_ids.end());
+  return SUCCESS;
+}
+
+Status CseNodeTable::GetStructuralHash(const NodePtr &node, CacheHashKey &hash) {
+  hash = HashUtils::HashCombine(HashUtils::HASH_SEED, GetTypeId(node));
+  const auto &op_desc = node->GetOpDesc();
+  GE_ASSERT_NOTNULL(op_desc);
+  for (const auto in_anchor : node->GetAllInDataAnchorsPtr()) {
+    GE_ASSERT_NOTNULL(in_anchor);
+    hash = HashUtils::HashCombine(hash, in_anchor->GetIdx());
+    const auto src_anchor = in_anchor->GetPeerOutAnchor();
+    if (src_anchor == nullptr) {
+      hash = HashUtils::HashCombine(hash, SIZE_MAX);
+      continue;
+    }
+    size_t src_node_id = 0U;
+    GE_ASSERT_SUCCESS(GetNodeId(src_anchor->GetOwnerNode(), src_node_id));
+    const auto &input_desc = op_desc->GetInputDescPtr(static_cast<uint32_t>(in_anchor->GetIdx()));
+    GE_ASSERT_NOTNULL(input_desc);
+    hash = HashUtils::HashCombine(hash, src_node_id);
+    hash = HashUtils::HashCombine(hash, src_anchor->GetIdx());
+    hash = HashShape(hash, input_desc->GetShape());
+    hash = HashShape(hash, input_desc->GetOriginShape());
+    hash = HashUtils::HashCombine(hash, input_desc->GetFormat());
+    hash = HashUtils::HashCombine(hash, input_desc->GetOriginFormat());
+  }
+  GE_ASSERT_SUCCESS(GetControlInputIds(node, control_input_ids_));
+  hash = HashUtils::HashCombine(hash, control_input_ids_);
+  return SUCCESS;
+}
+
+bool CseNodeTable::IsSameDataInputs(const NodePtr &lhs, const NodePtr &rhs) const {
+  const auto lhs_in_anchors = lhs->GetAllInDataAnchorsPtr();
+  const auto rhs_in_anchors = rhs->GetAllInDataAnchorsPtr();
+  if (lhs_in_anchors.size() != rhs_in_anchors.size()) {
+    return false;
+  }
+  for (size_t i = 0U; i < lhs_in_anchors.size(); ++i) {
+    const auto lhs_src_anchor = lhs_in_anchors[i]->GetPeerOutAnchor();
+    const auto rhs_src_anchor = rhs_in_anchors[i]->GetPeerOutAnchor();
+    if ((lhs_src_anchor == nullptr) || (rhs_src_anchor == nullptr)) {
+      if (lhs_src_anchor != rhs_src_anchor) {
+        return false;
+      }
+      continue;
+    }
+    if ((lhs_src_anchor->GetOwnerNodeBarePtr() != rhs_src_anchor->GetOwnerNodeBarePtr()) ||
+        (lhs_src_anchor->GetIdx() != rhs_src_anchor->GetIdx())) {
+      return false;
+    }
+    const auto idx = static_cast<uint32_t>(lhs_in_anchors[i]->GetIdx());
+    if (!IsSameInputDesc(lhs->GetOpDesc()->GetInputDescPtr(idx), rhs->GetOpDesc()->GetInputDescPtr(idx))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+const CseNodeTable::AttrsStr &CseNodeTable::GetAttrsStr(const NodePtr &node) {
+  auto iter = attrs_strs_.find(node.get());
+  if (iter == attrs_strs_.end()) {
+    AttrsStr attrs_str;
+    attrs_str.str = AttrUtils::GetAllAttrsStr(node->GetOpDesc());
+    attrs_str.hash = std::hash<std::string>{}(attrs_str.str);
+    iter = attrs_strs_.emplace(node.get(), std::move(attrs_str)).first;
+  }
+  return iter->second;
+}
+
+bool CseNodeTable::IsSameNode(const NodePtr &lhs, const NodePtr &rhs) {
+  if (lhs->GetType() != rhs->GetType()) {
+    return false;
+  }
+  // 结构相同、属性不同的节点(如按head切分的Slice)会落在同一个桶里，先比较属性串的hash快速排除
+  const auto &lhs_attrs = GetAttrsStr(lhs);
+  const auto &rhs_attrs = GetAttrsStr(rhs);
+  if ((lhs_attrs.hash != rhs_attrs.hash) || (!IsSameDataInputs(lhs, rhs))) {
+    return false;
+  }
+  std::vector<size_t> lhs_control_ids;
+  std::vector<size_t> rhs_control_ids;
+  if ((GetControlInputIds(lhs, lhs_control_ids) != SUCCESS) || (GetControlInputIds(rhs, rhs_control_ids) != SUCCESS) ||
+      (lhs_control_ids != rhs_control_ids)) {
+    return false;
+  }
+  return lhs_attrs.str == rhs_attrs.str;
+}
+}  // namespace ge
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GE_GRAPH_PASSES_STANDARD_OPTIMIZE_CSE_NODE_TABLE_H_
+#define GE_GRAPH_PASSES_STANDARD_OPTIMIZE_CSE_NODE_TABLE_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "graph/node.h"
+#include "graph/utils/hash_utils.h"
+#include "framework/common/ge_inner_error_codes.h"
+
+namespace ge {
+/**
+ * CSE的等价节点表：按结构hash(类型、数据输入、输入描述、控制输入)分桶，hash相同时再完整比较，
+ * 属性串只在桶内需要比较时生成并缓存。节点用图内的拓扑序号标识，不依赖节点名。
+ */
+class CseNodeTable {
+ public:
+  explicit CseNodeTable(const std::unordered_map<NodePtr, size_t> &nodes_2_topo_idx)
+      : nodes_2_topo_idx_(nodes_2_topo_idx) {}
+
+  // 查找与node等价的已记录节点，找不到时记录node，same_node为nullptr
+  Status FindOrInsert(const NodePtr &node, NodePtr &same_node);
+
+ private:
+  struct AttrsStr {
+    std::string str;
+    size_t hash = 0U;
+  };
+
+  size_t GetTypeId(const NodePtr &node);
+  Status GetNodeId(const NodePtr &node, size_t &node_id) const;
+  Status GetControlInputIds(const NodePtr &node, std::vector<size_t> &node_ids) const;
+  Status GetStructuralHash(const NodePtr &node, CacheHashKey &hash);
+  bool IsSameDataInputs(const NodePtr &lhs, const NodePtr &rhs) const;
+  const AttrsStr &GetAttrsStr(const NodePtr &node);
+  bool IsSameNode(const NodePtr &lhs, const NodePtr &rhs);
+
+  const std::unordered_map<NodePtr, size_t> &nodes_2_topo_idx_;
+  std::unordered_map<std::string, size_t> type_ids_;
+  std::unordered_map<CacheHashKey, std::vector<NodePtr>> hash_to_nodes_;
+  std::unordered_map<const Node *, AttrsStr> attrs_strs_;
+  std::vector<size_t> control_input_ids_;
+};
+}  // namespace ge
+#endif  // GE_GRAPH_PASSES_STANDARD_OPTIMIZE_CSE_NODE_TABLE_H_
@@ -102,6 +102,10 @@ std::string InputValueForCondSource::GetSourceStr() const {
     }())";
 }
 
+SourceLoadInfo InputValueForCondSource::GetLoadInfo() const {
+  return {SourceLoadType::kInputValueForCond, input_data_idx_, cond_value_, DT_UNDEFINED};
+}
+
 Status SymbolicCondRemovePass::GetCondIndexSymbol(const NodePtr &cond_input, Expression &cond_index_sym,
                                                   const std::string &node_type) {
   auto op_desc = cond_input->GetOpDesc();
@@ -22,6 +22,7 @@ class InputValueForCondSource : public Source {
   InputValueForCondSource(int32_t input_data_idx, int32_t cond_value)
       : input_data_idx_(input_data_idx), cond_value_(cond_value) {}
   [[nodiscard]] std::string GetSourceStr() const override;
+  [[nodiscard]] SourceLoadInfo GetLoadInfo() const override;
 
  private:
   int32_t input_data_idx_;
@@ -13,6 +13,7 @@
 #include "common/b_cast/b_cast.h"
 #include "graph/utils/type_utils.h"
 #include "host_kernels/kernel_factory.h"
+#include "host_kernels/kernel_elewise_engine.h"
 #include "common/checker.h"
 #include "host_kernels/elewise_calculation_ops/add_kernel.h"
 
@@ -149,49 +150,18 @@ Status AddKernel::ComputeComplex(const OpDescPtr &op_desc_ptr, const std::vector
 template <typename InT>
 Status AddKernel::BCastAdd(const OpDescPtr &op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
                            std::vector<GeTensorPtr> &v_output) const {
-  // only broadcast shape
-  BCast bcast;
-  Status ret = bcast.GenerateBcastInfo(BCast::TransShapeToDimVec(input[kAddFirstInput]->GetTensorDesc()),
-                                       BCast::TransShapeToDimVec(input[kAddSecondInput]->GetTensorDesc()));
-  if (ret != SUCCESS) {
-    GELOGE(ret, "Greater broadcasting failed.");
-    return ret;
-  }
-
-  std::vector<int64_t> x_indexes;
-  std::vector<int64_t> y_indexes;
-  bcast.BCastIndexes(x_indexes, y_indexes);
-
-  auto x1_data = reinterpret_cast<const InT *>(input[kAddFirstInput]->GetData().data());
-  auto x2_data = reinterpret_cast<const InT *>(input[kAddSecondInput]->GetData().data());
-
-  size_t data_num = x_indexes.size();
-  std::unique_ptr<InT[]> buf(new (std::nothrow) InT[data_num]());
-  if (buf == nullptr) {
-    GELOGE(MEMALLOC_FAILED, "New sizeof(T) * data_num(%zu) memory failed", static_cast<size_t>(sizeof(InT) * data_num));
-    return MEMALLOC_FAILED;
-  }
-
-  DataType data_type = input[kAddFirstInput]->GetTensorDesc().GetDataType();
-  for (size_t i = 0; i < data_num; i++) {
-    auto x_index = *(x1_data + x_indexes[i]);
-    auto y_index = *(x2_data + y_indexes[i]);
-    if (OverflowCheck<InT>(x_index, y_index, data_type) != SUCCESS) {
-      GELOGE(PARAM_INVALID, "Result of add is overflow.");
-      return PARAM_INVALID;
-    }
-    *(buf.get() + i) = x_index + y_index;
-  }
-
   GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(kAddFirstOutput));
   if (output_ptr == nullptr) {
     GELOGE(MEMALLOC_FAILED, "Make shared failed");
     return MEMALLOC_FAILED;
   }
-  output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), data_num * sizeof(InT));
-  output_ptr->MutableTensorDesc().SetDataType(data_type);
-  std::vector<int64_t> bcast_dims = bcast.GetOutputShape();
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast_dims));
+  const Status ret =
+      ElewiseEngine::BinaryCompute<elewise::AddOp, InT>(input[kAddFirstInput], input[kAddSecondInput], output_ptr);
+  if (ret != SUCCESS) {
+    GELOGE(ret, "Add broadcasting failed or result of add is overflow.");
+    return ret;
+  }
+  output_ptr->MutableTensorDesc().SetDataType(input[kAddFirstInput]->GetTensorDesc().GetDataType());
   v_output.push_back(output_ptr);
 
   return SUCCESS;
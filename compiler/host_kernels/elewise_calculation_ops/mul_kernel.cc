@@ -23,6 +23,7 @@
 #include "common/checker.h"
 #include "graph/utils/type_utils.h"
 #include "host_kernels/kernel_factory.h"
+#include "host_kernels/kernel_elewise_engine.h"
 
 namespace ge {
 namespace {
@@ -111,38 +112,10 @@ Status OverflowCheckSub(T const &x, T const &y, DataType const &type) {
   return SUCCESS;
 }
 
-#define DEFINE_FUNC_WITH_STATUS_BY_TYPE(TYPE)                                         \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-      [](TYPE const &a, TYPE const &b, DataType &type, Status &ret) -> TYPE {         \
-    ret = OverflowCheckMul(a, b, type);                                               \
-    if (ret != SUCCESS) {                                                             \
-      GELOGE(PARAM_INVALID, "Result of mul is overflow.");                            \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return static_cast<TYPE>(a) * static_cast<TYPE>(b);                               \
-  }
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                              \
-  case DTYPE:                                                            \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE##_, func_##TYPE); \
-    break
-
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                        \
-  case DTYPE:                                                                                                          \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE##_.data()), y_data_##TYPE##_.size() * length); \
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                     \
+  case DTYPE:                                                                                   \
+    ret = ElewiseEngine::BinaryCompute<elewise::MulOp, TYPE>(input[0U], input[1U], output_ptr); \
     break
-// [no need to check result]
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int8_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int32_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int64_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint8_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint32_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint64_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(fp16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(float);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(double);
 
 template <typename InT>
 Status ComplexCompute(const OpDescPtr op_desc_ptr, const std::vector<ConstGeTensorPtr> &input,
@@ -219,7 +192,6 @@ Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGe
   }
 
   DataType data_type = input[0]->GetTensorDesc().GetDataType();
-  BCast bcast;
   switch (data_type) {
     case DT_COMPLEX32:
       return ComplexCompute<fp16_t>(op_desc_ptr, input, v_output);
@@ -227,57 +199,39 @@ Status MulKernel::Compute(const OpDescPtr op_desc_ptr, const std::vector<ConstGe
       return ComplexCompute<float>(op_desc_ptr, input, v_output);
     case DT_COMPLEX128:
       return ComplexCompute<double>(op_desc_ptr, input, v_output);
-      SET_BCAST_COMPUTE_CASE(DT_INT8, int8_t);
-      SET_BCAST_COMPUTE_CASE(DT_INT16, int16_t);
-      SET_BCAST_COMPUTE_CASE(DT_INT32, int32_t);
-      SET_BCAST_COMPUTE_CASE(DT_INT64, int64_t);
-      SET_BCAST_COMPUTE_CASE(DT_UINT8, uint8_t);
-      SET_BCAST_COMPUTE_CASE(DT_UINT16, uint16_t);
-      SET_BCAST_COMPUTE_CASE(DT_UINT32, uint32_t);
-      SET_BCAST_COMPUTE_CASE(DT_UINT64, uint64_t);
-      SET_BCAST_COMPUTE_CASE(DT_FLOAT16, fp16_t);
-      SET_BCAST_COMPUTE_CASE(DT_FLOAT, float);
-      SET_BCAST_COMPUTE_CASE(DT_DOUBLE, double);
     default:
-      ret = NOT_CHANGED;
       break;
   }
 
-  if (ret != SUCCESS) {
-    GELOGW("BCastCompute fail, data_type: %s, ret: %s", TypeUtils::DataTypeToSerialString(data_type).c_str(),
-           GET_ERRORNO_STR(ret).c_str());
-    return NOT_CHANGED;
-  }
-
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
   GeTensorPtr output_ptr = MakeShared<GeTensor>(op_desc_ptr->GetOutputDesc(0));
   if (output_ptr == nullptr) {
     GELOGE(MEMALLOC_FAILED, "Make shared failed");
     return MEMALLOC_FAILED;
   }
 
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
   switch (data_type) {
-    SET_OUTPUT(DT_INT8, int8_t);
-    SET_OUTPUT(DT_INT16, int16_t);
-    SET_OUTPUT(DT_INT32, int32_t);
-    SET_OUTPUT(DT_INT64, int64_t);
-    SET_OUTPUT(DT_UINT8, uint8_t);
-    SET_OUTPUT(DT_UINT16, uint16_t);
-    SET_OUTPUT(DT_UINT32, uint32_t);
-    SET_OUTPUT(DT_UINT64, uint64_t);
-    SET_OUTPUT(DT_FLOAT16, fp16_t);
-    SET_OUTPUT(DT_FLOAT, float);
-    SET_OUTPUT(DT_DOUBLE, double);
+    SET_BCAST_COMPUTE_CASE(DT_INT8, int8_t);
+    SET_BCAST_COMPUTE_CASE(DT_INT16, int16_t);
+    SET_BCAST_COMPUTE_CASE(DT_INT32, int32_t);
+    SET_BCAST_COMPUTE_CASE(DT_INT64, int64_t);
+    SET_BCAST_COMPUTE_CASE(DT_UINT8, uint8_t);
+    SET_BCAST_COMPUTE_CASE(DT_UINT16, uint16_t);
+    SET_BCAST_COMPUTE_CASE(DT_UINT32, uint32_t);
+    SET_BCAST_COMPUTE_CASE(DT_UINT64, uint64_t);
+    SET_BCAST_COMPUTE_CASE(DT_FLOAT16, fp16_t);
+    SET_BCAST_COMPUTE_CASE(DT_FLOAT, float);
+    SET_BCAST_COMPUTE_CASE(DT_DOUBLE, double);
     default:
+      ret = NOT_CHANGED;
       break;
   }
+
+  if (ret != SUCCESS) {
+    GELOGW("BCastCompute fail, data_type: %s, ret: %s", TypeUtils::DataTypeToSerialString(data_type).c_str(),
+           GET_ERRORNO_STR(ret).c_str());
+    return NOT_CHANGED;
+  }
+
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
   GELOGD("MulKernel success");
@@ -13,6 +13,7 @@
 #include <cfloat>
 
 #include <memory>
+#include <type_traits>
 
 #include "framework/common/debug/ge_log.h"
 #include "framework/common/debug/log.h"
@@ -21,6 +22,7 @@
 #include "framework/common/debug/ge_log.h"
 #include "host_kernels/kernel_utils.h"
 #include "host_kernels/kernel_factory.h"
+#include "host_kernels/kernel_elewise_engine.h"
 #include "common/math/ge_math_util.h"
 #include "framework/common/framework_types_internal.h"
 
@@ -46,6 +48,18 @@ Status ZeroCheck(T x, const DataType &data_type) {
   }
   return SUCCESS;
 }
+
+// fp16按double计算，float和double按原类型计算
+template <typename T>
+bool CalcRsqrt(const T &x, T &y, const DataType &data_type) {
+  using CalcT = typename std::conditional<std::is_same<T, fp16_t>::value, double, T>::type;
+  if (ZeroCheck(x, data_type) != SUCCESS) {
+    return false;
+  }
+  const CalcT denominator = std::sqrt(static_cast<CalcT>(x));
+  y = static_cast<CalcT>(1) / denominator;
+  return true;
+}
 #define SET_RSQRT_CASE(DTYPE, TYPE)                               \
   case (DTYPE):                                                   \
     ret = RsqrtKernel::RsqrtCompute<TYPE>(input_ptr, output_ptr); \
@@ -65,33 +79,13 @@ Status RsqrtKernel::RsqrtCompute(ConstGeTensorPtr &input_tensor_ptr, GeTensorPtr
       GELOGW("New buf failed");
       return NOT_CHANGED;
     }
-    auto ptr = const_cast<T *>(reinterpret_cast<const T *>(input_tensor_ptr->GetData().data()));
-    for (size_t i = 0; i < data_count; i++) {
-      if (ZeroCheck(*(ptr + i), data_type) != SUCCESS) {
-        GELOGW("Rsqrt: The input data cannot less than or equal to zero, rsqrt folding failed.");
-        return NOT_CHANGED;
-      }
-      switch (data_type) {
-        case DT_FLOAT16: {
-          double val = static_cast<double>(*(reinterpret_cast<const fp16_t *>(input_tensor_ptr->GetData().data()) + i));
-          double drSqrt = 1.0 / std::sqrt(val);
-          buf[i] = drSqrt;
-          break;
-        }
-        case DT_FLOAT: {
-          float denominator = std::sqrt(*(reinterpret_cast<const float *>(input_tensor_ptr->GetData().data()) + i));
-          buf[i] = static_cast<float>(1 / denominator);
-          break;
-        }
-        case DT_DOUBLE: {
-          double denominator = std::sqrt(*(reinterpret_cast<const double *>(input_tensor_ptr->GetData().data()) + i));
-          buf[i] = static_cast<double>(1 / denominator);
-          break;
-        }
-        default:
-          GELOGW("Input data type must be FP16, FP32 and DOUBLE.");
-          return NOT_CHANGED;
-      }
+    const T *const ptr = reinterpret_cast<const T *>(input_tensor_ptr->GetData().data());
+    const Status ret = ElewiseEngine::UnaryCompute(
+        ptr, static_cast<int64_t>(data_count), buf.get(),
+        [&data_type](const T &x, T &y) -> bool { return CalcRsqrt(x, y, data_type); });
+    if (ret != SUCCESS) {
+      GELOGW("Rsqrt: The input data cannot less than or equal to zero, rsqrt folding failed.");
+      return NOT_CHANGED;
     }
     GE_IF_BOOL_EXEC(output_tensor_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), data_size) != GRAPH_SUCCESS,
                     GELOGW("Set data failed");
@@ -16,9 +16,9 @@
 #include "framework/common/debug/log.h"
 #include "common/math/ge_math_util.h"
 #include "framework/common/op/ge_op_utils.h"
-#include "common/b_cast/b_cast.h"
 #include "graph/utils/type_utils.h"
 #include "host_kernels/kernel_factory.h"
+#include "host_kernels/kernel_elewise_engine.h"
 
 namespace ge {
 namespace {
@@ -28,81 +28,10 @@ const size_t kSubFirstOutput = 0;
 const size_t kSubOutputSize = 1;
 const size_t kSubInputSize = 2;
 
-template <typename T>
-Status OverflowCheck(T const &x, T const &y, DataType &data_type) {
-  switch (data_type) {
-    case DT_INT8:
-      FMK_INT8_SUBCHECK(x, y)
-      break;
-    case DT_INT16:
-      FMK_INT16_SUBCHECK(x, y)
-      break;
-    case DT_INT32:
-      FMK_INT32_SUBCHECK(x, y)
-      break;
-    case DT_INT64:
-      FMK_INT64_SUBCHECK(x, y)
-      break;
-    case DT_UINT8:
-      FMK_UINT8_SUBCHECK(x, y)
-      break;
-    case DT_UINT16:
-      FMK_UINT16_SUBCHECK(x, y)
-      break;
-    case DT_UINT32:
-      FMK_UINT32_SUBCHECK(x, y)
-      break;
-    case DT_UINT64:
-      FMK_UINT64_SUBCHECK(x, y)
-      break;
-    case DT_FLOAT16:
-      FMK_FP16_SUBCHECK(x, y)
-      break;
-    case DT_FLOAT:
-      FMK_FLOAT_SUBCHECK(x, y)
-      break;
-    case DT_DOUBLE:
-      FMK_DOUBLE_SUBCHECK(x, y)
-      break;
-    default:
-      break;
-  }
-
-  return SUCCESS;
-}
-
-#define DEFINE_FUNC_WITH_STATUS_BY_TYPE(TYPE)                                         \
-  std::function<TYPE(TYPE const &, TYPE const &, DataType &, Status &)> func_##TYPE = \
-      [](TYPE const &x, TYPE const &y, DataType &type, Status &ret) -> TYPE {         \
-    ret = OverflowCheck<TYPE>(x, y, type);                                            \
-    if (ret != SUCCESS) {                                                             \
-      GELOGE(PARAM_INVALID, "Result of sub is overflow.");                            \
-      return static_cast<TYPE>(0);                                                    \
-    }                                                                                 \
-    return static_cast<TYPE>(x) - static_cast<TYPE>(y);                               \
-  }
-
-#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                              \
-  case DTYPE:                                                            \
-    ret = bcast.BCastComputeCheck(input, y_data_##TYPE##_, func_##TYPE); \
-    break
-
-#define SET_OUTPUT(DTYPE, TYPE)                                                                                        \
-  case DTYPE:                                                                                                          \
-    (void)output_ptr->SetData(reinterpret_cast<uint8_t *>(y_data_##TYPE##_.data()), y_data_##TYPE##_.size() * length); \
+#define SET_BCAST_COMPUTE_CASE(DTYPE, TYPE)                                                 \
+  case DTYPE:                                                                               \
+    ret = ElewiseEngine::BinaryCompute<elewise::SubOp, TYPE>(weight0, weight1, output_ptr); \
     break
-
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int8_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int32_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(int64_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint8_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint32_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(uint64_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(fp16_t);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(float);
-DEFINE_FUNC_WITH_STATUS_BY_TYPE(double);
 }  // namespace
 
 Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge::ConstGeTensorPtr> &input,
@@ -119,9 +48,15 @@ Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge:
   ConstGeTensorPtr weight0 = input[kSubFirstInput];
   ConstGeTensorPtr weight1 = input[kSubSecondInput];
 
+  auto output_tensor_desc = op_desc_ptr->GetOutputDesc(kSubFirstOutput);
+  GeTensorPtr output_ptr = MakeShared<GeTensor>(output_tensor_desc);
+  if (output_ptr == nullptr) {
+    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
+    return NOT_CHANGED;
+  }
+
   Status ret;
   DataType data_type = input[kSubFirstInput]->GetTensorDesc().GetDataType();
-  BCast bcast;
   switch (data_type) {
     SET_BCAST_COMPUTE_CASE(DT_INT8, int8_t);
     SET_BCAST_COMPUTE_CASE(DT_INT16, int16_t);
@@ -146,36 +81,6 @@ Status SubKernel::Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge:
     return NOT_CHANGED;
   }
 
-  uint32_t length = 1;
-  if (!TypeUtils::GetDataTypeLength(data_type, length)) {
-    GELOGW("Can't GetDataTypeLength of data_type: %s", TypeUtils::DataTypeToSerialString(data_type).c_str());
-    return NOT_CHANGED;
-  }
-
-  auto output_tensor_desc = op_desc_ptr->GetOutputDesc(kSubFirstOutput);
-  GeTensorPtr output_ptr = MakeShared<GeTensor>(output_tensor_desc);
-  if (output_ptr == nullptr) {
-    GELOGW("make_shared ge::GeTensor failed, node name %s.", op_desc_ptr->GetName().c_str());
-    return NOT_CHANGED;
-  }
-
-  output_ptr->MutableTensorDesc().SetShape(GeShape(bcast.GetOutputShape()));
-  // only return GRAPH_SUCCESS here
-  switch (data_type) {
-    SET_OUTPUT(DT_INT8, int8_t);
-    SET_OUTPUT(DT_INT16, int16_t);
-    SET_OUTPUT(DT_INT32, int32_t);
-    SET_OUTPUT(DT_INT64, int64_t);
-    SET_OUTPUT(DT_UINT8, uint8_t);
-    SET_OUTPUT(DT_UINT16, uint16_t);
-    SET_OUTPUT(DT_UINT32, uint32_t);
-    SET_OUTPUT(DT_UINT64, uint64_t);
-    SET_OUTPUT(DT_FLOAT16, fp16_t);
-    SET_OUTPUT(DT_FLOAT, float);
-    SET_OUTPUT(DT_DOUBLE, double);
-    default:
-      break;
-  }
   output_ptr->MutableTensorDesc().SetDataType(data_type);
   v_output.push_back(output_ptr);
 
@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "host_kernels/kernel_elewise_engine.h"
+
+#include <exception>
+#include <future>
+#include <thread>
+#include <utility>
+
+#include "base/err_mgr.h"
+#include "common/thread_pool/thread_pool.h"
+#include "graph/ge_local_context.h"
+
+namespace ge {
+namespace {
+constexpr int64_t kMaxParallelNum = 8;
+const char *const kElewiseThreadName = "ge_elewise";
+
+// 各算子共享的线程池，调用线程自身计算第一块，故池中线程数为kMaxParallelNum - 1
+ThreadPool &GetElewiseThreadPool() {
+  static ThreadPool thread_pool(kElewiseThreadName, static_cast<uint32_t>(kMaxParallelNum - 1), false);
+  return thread_pool;
+}
+
+// 当前线程是否处于ElewiseEngine::InlineScope内
+thread_local bool g_run_inline = false;
+}  // namespace
+
+ElewiseEngine::InlineScope::InlineScope() : prev_inline_(g_run_inline) {
+  g_run_inline = true;
+}
+
+ElewiseEngine::InlineScope::~InlineScope() {
+  g_run_inline = prev_inline_;
+}
+
+Status ElewiseEngine::GenerateBroadcastPlan(const std::vector<int64_t> &x_dims, const std::vector<int64_t> &y_dims,
+                                            BroadcastPlan &plan) {
+  const size_t rank = std::max(x_dims.size(), y_dims.size());
+  std::vector<int64_t> out_shape(rank, 1);
+  std::vector<int64_t> x_strides(rank, 0);
+  std::vector<int64_t> y_strides(rank, 0);
+  int64_t x_acc = 1;
+  int64_t y_acc = 1;
+  int64_t out_acc = 1;
+  // 从最低维开始右对齐，维度为1的一侧stride置0
+  for (size_t i = 0U; i < rank; ++i) {
+    const size_t out_idx = rank - 1U - i;
+    const int64_t x_dim = (i < x_dims.size()) ? x_dims[x_dims.size() - 1U - i] : 1;
+    const int64_t y_dim = (i < y_dims.size()) ? y_dims[y_dims.size() - 1U - i] : 1;
+    if ((x_dim < 0) || (y_dim < 0) || ((x_dim != y_dim) && (x_dim != 1) && (y_dim != 1))) {
+      GELOGW("Shapes are not compatible according to the broadcasting rule, dim %zu: %ld vs %ld.", out_idx, x_dim,
+             y_dim);
+      return PARAM_INVALID;
+    }
+    out_shape[out_idx] = (x_dim == 1) ? y_dim : x_dim;
+    x_strides[out_idx] = (x_dim == 1) ? 0 : x_acc;
+    y_strides[out_idx] = (y_dim == 1) ? 0 : y_acc;
+    x_acc *= x_dim;
+    y_acc *= y_dim;
+    out_acc *= out_shape[out_idx];
+  }
+
+  plan.out_shape = out_shape;
+  plan.x_num = x_acc;
+  plan.y_num = y_acc;
+  plan.out_num = out_acc;
+  plan.dims.clear();
+  plan.x_strides.clear();
+  plan.y_strides.clear();
+  for (size_t i = 0U; i < rank; ++i) {
+    if (out_shape[i] == 1) {
+      continue;
+    }
+    // 两个输入在相邻两维上都连续(或都广播)时合并为一维
+    if ((!plan.dims.empty()) && (plan.x_strides.back() == x_strides[i] * out_shape[i]) &&
+        (plan.y_strides.back() == y_strides[i] * out_shape[i])) {
+      plan.dims.back() *= out_shape[i];
+      plan.x_strides.back() = x_strides[i];
+      plan.y_strides.back() = y_strides[i];
+      continue;
+    }
+    plan.dims.emplace_back(out_shape[i]);
+    plan.x_strides.emplace_back(x_strides[i]);
+    plan.y_strides.emplace_back(y_strides[i]);
+  }
+  if (plan.dims.empty()) {
+    plan.dims.emplace_back(1);
+    plan.x_strides.emplace_back(0);
+    plan.y_strides.emplace_back(0);
+  }
+  return SUCCESS;
+}
+
+Status ElewiseEngine::CheckDataSize(const BroadcastPlan &plan, const size_t x_size, const size_t y_size,
+                                    const size_t type_size) {
+  if ((x_size < (static_cast<size_t>(plan.x_num) * type_size)) ||
+      (y_size < (static_cast<size_t>(plan.y_num) * type_size))) {
+    GELOGW("Data size of inputs is not enough, x: %zu bytes for %ld elements, y: %zu bytes for %ld elements.", x_size,
+           plan.x_num, y_size, plan.y_num);
+    return PARAM_INVALID;
+  }
+  return SUCCESS;
+}
+
+Status ElewiseEngine::ParallelFor(const int64_t total, const int64_t grain,
+                                  const std::function<Status(int64_t, int64_t)> &func) {
+  if (total <= 0) {
+    return SUCCESS;
+  }
+  const int64_t hardware_num = static_cast<int64_t>(std::thread::hardware_concurrency());
+  const int64_t parallel_num =
+      std::min({total / std::max(grain, static_cast<int64_t>(1)), hardware_num, kMaxParallelNum});
+  // 调用方已按节点并行时不再提交任务，避免与其线程池争抢并互相等待
+  if ((parallel_num <= 1) || g_run_inline) {
+    return func(0, total);
+  }
+
+  const auto ge_context = GetThreadLocalContext();
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  const int64_t block = (total + parallel_num - 1) / parallel_num;
+  std::vector<Status> results(static_cast<size_t>(parallel_num), SUCCESS);
+  std::vector<std::future<Status>> fut_rets(static_cast<size_t>(parallel_num));
+  std::vector<std::pair<int64_t, int64_t>> ranges(static_cast<size_t>(parallel_num));
+  int64_t begin = 0;
+  for (int64_t i = 0; i < parallel_num; ++i) {
+    const int64_t end = std::min(begin + block, total);
+    ranges[static_cast<size_t>(i)] = std::make_pair(begin, end);
+    begin = end;
+  }
+  auto &thread_pool = GetElewiseThreadPool();
+  for (size_t i = 1U; i < ranges.size(); ++i) {
+    const auto range = ranges[i];
+    fut_rets[i] = thread_pool.commit([&func, &ge_context, &err_msg_ctx, range]() -> Status {
+      error_message::SetErrMgrContext(err_msg_ctx);
+      GetThreadLocalContext() = ge_context;
+      return func(range.first, range.second);
+    });
+  }
+  results[0U] = func(ranges[0U].first, ranges[0U].second);
+  for (size_t i = 1U; i < fut_rets.size(); ++i) {
+    if (!fut_rets[i].valid()) {
+      // 提交失败时在当前线程补算
+      GELOGW("Failed to commit range [%ld, %ld) to thread pool, compute it in current thread.", ranges[i].first,
+             ranges[i].second);
+      results[i] = func(ranges[i].first, ranges[i].second);
+      continue;
+    }
+    try {
+      results[i] = fut_rets[i].get();
+    } catch (const std::exception &e) {
+      GELOGW("Got an exception when compute range [%ld, %ld), reason[%s].", ranges[i].first, ranges[i].second,
+             e.what());
+      results[i] = FAILED;
+    }
+  }
+  for (const auto result : results) {
+    if (result != SUCCESS) {
+      return result;
+    }
+  }
+  return SUCCESS;
+}
+}  // namespace ge
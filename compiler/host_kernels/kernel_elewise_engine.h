@@ -0,0 +1,492 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GE_HOST_KERNELS_KERNEL_ELEWISE_ENGINE_H_
+#define GE_HOST_KERNELS_KERNEL_ELEWISE_ENGINE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "common/fp16_t/fp16_t.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/ge_inner_error_codes.h"
+#include "graph/ge_tensor.h"
+
+namespace ge {
+namespace elewise {
+// SSE与NEON都支持的向量宽度，使用GCC向量扩展，不依赖具体指令集
+constexpr size_t kSimdBytes = 16U;
+
+template <typename T>
+struct Simd {
+  typedef T Vec __attribute__((vector_size(kSimdBytes)));
+  static constexpr int64_t kLanes = static_cast<int64_t>(kSimdBytes / sizeof(T));
+
+  static Vec Load(const T *const addr) {
+    Vec v;
+    (void)memcpy(&v, addr, sizeof(Vec));
+    return v;
+  }
+  static void Store(T *const addr, const Vec &v) {
+    (void)memcpy(addr, &v, sizeof(Vec));
+  }
+  static Vec Dup(const T value) {
+    Vec v;
+    for (int64_t i = 0; i < kLanes; ++i) {
+      v[i] = value;
+    }
+    return v;
+  }
+};
+
+// 整数运算按无符号回绕计算，溢出由标记位判断，避免有符号溢出的未定义行为
+template <typename T>
+using UnsignedOf = typename std::conditional<std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                                             std::make_unsigned<T>, std::enable_if<true, T>>::type::type;
+
+inline uint16_t Fp16InvalidMask(const fp16_t &value) {
+  return Fp16IsInvalid(value.val) ? kFp16ExpMask : static_cast<uint16_t>(0U);
+}
+
+template <typename T>
+constexpr bool IsSimdType() {
+  return std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+}
+
+/**
+ * 二元算子：Compute对标量(V=T)和向量(V=Simd<T>::Vec)通用，溢出信息按位累积到flag中，
+ * 一段数据算完后再逐lane调用IsOverflow判断，循环内没有分支，便于向量化。
+ */
+template <typename T, typename Enable = void>
+struct AddOp {  // 浮点：结果非有限值即溢出，r - r对inf/nan为nan
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a + b;
+    flag = flag + (r - r);
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != static_cast<T>(0);
+  }
+};
+
+template <typename T>
+struct AddOp<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = (V)((UV)a + (UV)b);
+    flag = (V)(flag | ((a ^ r) & (b ^ r)));
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag < 0;
+  }
+};
+
+template <typename T>
+struct AddOp<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type> {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = (V)(a + b);
+    flag = (V)(flag | (V)(r < a));
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != 0U;
+  }
+};
+
+template <>
+struct AddOp<fp16_t> {
+  static constexpr bool kSimd = false;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a + b;
+    flag.val |= Fp16InvalidMask(r);
+    return r;
+  }
+  static bool IsOverflow(const fp16_t &flag) {
+    return Fp16IsInvalid(flag.val);
+  }
+};
+
+template <typename T, typename Enable = void>
+struct SubOp {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a - b;
+    flag = flag + (r - r);
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != static_cast<T>(0);
+  }
+};
+
+template <typename T>
+struct SubOp<T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type> {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = (V)((UV)a - (UV)b);
+    flag = (V)(flag | ((a ^ b) & (a ^ r)));
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag < 0;
+  }
+};
+
+template <typename T>
+struct SubOp<T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type> {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    flag = (V)(flag | (V)(a < b));
+    return (V)(a - b);
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != 0U;
+  }
+};
+
+template <>
+struct SubOp<fp16_t> {
+  static constexpr bool kSimd = false;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a - b;
+    flag.val |= Fp16InvalidMask(r);
+    return r;
+  }
+  static bool IsOverflow(const fp16_t &flag) {
+    return Fp16IsInvalid(flag.val);
+  }
+};
+
+template <typename T, typename Enable = void>
+struct MulOp {
+  static constexpr bool kSimd = true;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a * b;
+    flag = flag + (r - r);
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != static_cast<T>(0);
+  }
+};
+
+// 整数乘法没有便宜的向量化溢出判断，逐元素使用编译器内建的溢出检查
+template <typename T>
+struct MulOp<T, typename std::enable_if<std::is_integral<T>::value>::type> {
+  static constexpr bool kSimd = false;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    V r;
+    if (__builtin_mul_overflow(a, b, &r)) {
+      flag = static_cast<V>(1);
+    }
+    return r;
+  }
+  static bool IsOverflow(const T &flag) {
+    return flag != static_cast<T>(0);
+  }
+};
+
+template <>
+struct MulOp<fp16_t> {
+  static constexpr bool kSimd = false;
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    const V r = a * b;
+    flag.val |= Fp16InvalidMask(r);
+    return r;
+  }
+  static bool IsOverflow(const fp16_t &flag) {
+    return Fp16IsInvalid(flag.val);
+  }
+};
+
+template <typename T>
+struct MaximumOp {
+  static constexpr bool kSimd = IsSimdType<T>();
+  template <typename V, typename UV>
+  static V Compute(const V &a, const V &b, V &flag) {
+    (void)flag;
+    return a > b ? a : b;
+  }
+  static bool IsOverflow(const T &flag) {
+    (void)flag;
+    return false;
+  }
+};
+
+// 向量路径上按lane累积的溢出标记，非向量算子不使用
+template <typename T, typename Op, bool kSimd = Op::kSimd>
+struct SimdFlag {
+  bool IsOverflow() const {
+    return false;
+  }
+};
+
+template <typename T, typename Op>
+struct SimdFlag<T, Op, true> {
+  typename Simd<T>::Vec value = Simd<T>::Dup(static_cast<T>(0));
+  bool IsOverflow() const {
+    for (int64_t i = 0; i < Simd<T>::kLanes; ++i) {
+      if (Op::IsOverflow(value[i])) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+// 最内层循环，kXScalar/kYScalar表示对应输入在该维上是广播的标量
+template <typename Op, typename T, bool kXScalar, bool kYScalar, bool kSimd = Op::kSimd>
+struct Loop {
+  static void Run(const T *const x, const T *const y, T *const out, const int64_t len, T &flag,
+                  SimdFlag<T, Op> &simd_flag) {
+    (void)simd_flag;
+    for (int64_t i = 0; i < len; ++i) {
+      out[i] = Op::template Compute<T, UnsignedOf<T>>(kXScalar ? x[0] : x[i], kYScalar ? y[0] : y[i], flag);
+    }
+  }
+};
+
+template <typename Op, typename T, bool kXScalar, bool kYScalar>
+struct Loop<Op, T, kXScalar, kYScalar, true> {
+  static void Run(const T *const x, const T *const y, T *const out, const int64_t len, T &flag,
+                  SimdFlag<T, Op> &simd_flag) {
+    using S = Simd<T>;
+    using Vec = typename S::Vec;
+    using UVec = typename Simd<UnsignedOf<T>>::Vec;
+    const Vec x_dup = kXScalar ? S::Dup(x[0]) : Vec{};
+    const Vec y_dup = kYScalar ? S::Dup(y[0]) : Vec{};
+    int64_t i = 0;
+    for (; (i + S::kLanes) <= len; i += S::kLanes) {
+      const Vec a = kXScalar ? x_dup : S::Load(x + i);
+      const Vec b = kYScalar ? y_dup : S::Load(y + i);
+      S::Store(out + i, Op::template Compute<Vec, UVec>(a, b, simd_flag.value));
+    }
+    for (; i < len; ++i) {
+      out[i] = Op::template Compute<T, UnsignedOf<T>>(kXScalar ? x[0] : x[i], kYScalar ? y[0] : y[i], flag);
+    }
+  }
+};
+}  // namespace elewise
+
+// 合并连续维度后的广播描述，strides中广播维为0，最内层维度的stride只可能是0或1
+struct BroadcastPlan {
+  std::vector<int64_t> out_shape;
+  std::vector<int64_t> dims;
+  std::vector<int64_t> x_strides;
+  std::vector<int64_t> y_strides;
+  int64_t x_num = 1;
+  int64_t y_num = 1;
+  int64_t out_num = 1;
+};
+
+/**
+ * host kernel共用的逐元素/归约计算引擎：
+ * 1. 广播按合并后的维度直接计算偏移，不再生成逐元素的下标数组；
+ * 2. 最内层按连续/标量广播分别走向量化的快速路径；
+ * 3. 元素数超过阈值时按块分给多个线程计算，工作线程只做计算，不打日志。
+ */
+class ElewiseEngine {
+ public:
+  ElewiseEngine() = delete;
+  ~ElewiseEngine() = delete;
+
+  // 单线程处理的最小元素数，低于该值时不开线程
+  static constexpr int64_t kParallelGrain = 64 * 1024;
+
+  // 作用域内当前线程的ParallelFor不再向线程池提交任务，供调用方自身已按节点并行(如常量折叠预计算)时使用
+  class InlineScope {
+   public:
+    InlineScope();
+    ~InlineScope();
+    InlineScope(const InlineScope &) = delete;
+    InlineScope &operator=(const InlineScope &) = delete;
+
+   private:
+    bool prev_inline_;
+  };
+
+  static Status GenerateBroadcastPlan(const std::vector<int64_t> &x_dims, const std::vector<int64_t> &y_dims,
+                                      BroadcastPlan &plan);
+
+  // 校验输入数据长度足够plan中的元素个数
+  static Status CheckDataSize(const BroadcastPlan &plan, const size_t x_size, const size_t y_size,
+                              const size_t type_size);
+
+  // 把[0, total)切块后在共享线程池中并行执行func，total低于kParallelGrain、只有一个核或处于InlineScope内时
+  // 在当前线程执行，返回第一个失败的状态
+  static Status ParallelFor(const int64_t total, const int64_t grain,
+                            const std::function<Status(int64_t, int64_t)> &func);
+
+  // out = Op(x, y)，发生溢出时返回FAILED
+  template <template <typename, typename...> class Op, typename T>
+  static Status BinaryCompute(const T *const x, const T *const y, const BroadcastPlan &plan, T *const out) {
+    if (plan.out_num <= 0) {
+      return SUCCESS;
+    }
+    const int64_t inner = plan.dims.back();
+    return ParallelFor(plan.out_num, kParallelGrain, [x, y, out, inner, &plan](int64_t begin, int64_t end) -> Status {
+      T flag{};
+      elewise::SimdFlag<T, Op<T>> simd_flag;
+      int64_t pos = begin;
+      while (pos < end) {
+        const int64_t row = pos / inner;
+        const int64_t col = pos - (row * inner);
+        const int64_t len = std::min(inner - col, end - pos);
+        int64_t x_offset = 0;
+        int64_t y_offset = 0;
+        GetRowOffset(plan, row, x_offset, y_offset);
+        const int64_t x_step = plan.x_strides.back();
+        const int64_t y_step = plan.y_strides.back();
+        RunInner<Op<T>>(x + x_offset + (col * x_step), x_step, y + y_offset + (col * y_step), y_step, out + pos, len,
+                        flag, simd_flag);
+        pos += len;
+      }
+      return (simd_flag.IsOverflow() || Op<T>::IsOverflow(flag)) ? FAILED : SUCCESS;
+    });
+  }
+
+  // 按x、y的shape广播计算，结果的数据和shape写到output，发生溢出时返回FAILED
+  template <template <typename, typename...> class Op, typename T>
+  static Status BinaryCompute(const ConstGeTensorPtr &x, const ConstGeTensorPtr &y, const GeTensorPtr &output) {
+    BroadcastPlan plan;
+    Status ret = GenerateBroadcastPlan(x->GetTensorDesc().GetShape().GetDims(),
+                                       y->GetTensorDesc().GetShape().GetDims(), plan);
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    ret = CheckDataSize(plan, x->GetData().size(), y->GetData().size(), sizeof(T));
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    const size_t out_num = static_cast<size_t>(plan.out_num);
+    std::unique_ptr<T[]> buf(new (std::nothrow) T[out_num]);
+    if (buf == nullptr) {
+      GELOGE(MEMALLOC_FAILED, "New sizeof(T) * data_num(%zu) memory failed", sizeof(T) * out_num);
+      return MEMALLOC_FAILED;
+    }
+    ret = BinaryCompute<Op, T>(reinterpret_cast<const T *>(x->GetData().data()),
+                               reinterpret_cast<const T *>(y->GetData().data()), plan, buf.get());
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    if (output->SetData(reinterpret_cast<uint8_t *>(buf.get()), out_num * sizeof(T)) != GRAPH_SUCCESS) {
+      GELOGW("Set data failed.");
+      return INTERNAL_ERROR;
+    }
+    output->MutableTensorDesc().SetShape(GeShape(plan.out_shape));
+    return SUCCESS;
+  }
+
+  // 在[outer, axis, inner]排布的数据上沿axis用Op归约，结果排布为[outer, inner]，发生溢出时返回FAILED
+  template <template <typename, typename...> class Op, typename T>
+  static Status ReduceCompute(const T *const x, const int64_t outer, const int64_t axis, const int64_t inner,
+                              T *const out) {
+    if ((outer <= 0) || (axis <= 0) || (inner <= 0)) {
+      return SUCCESS;
+    }
+    if (inner == 1) {
+      // 沿连续维归约，按outer切块
+      const int64_t grain = std::max(kParallelGrain / axis, static_cast<int64_t>(1));
+      return ParallelFor(outer, grain, [x, out, axis](int64_t begin, int64_t end) -> Status {
+        T flag{};
+        for (int64_t i = begin; i < end; ++i) {
+          const T *const row = x + (i * axis);
+          T acc = row[0];
+          for (int64_t k = 1; k < axis; ++k) {
+            acc = Op<T>::template Compute<T, elewise::UnsignedOf<T>>(acc, row[k], flag);
+          }
+          out[i] = acc;
+        }
+        return Op<T>::IsOverflow(flag) ? FAILED : SUCCESS;
+      });
+    }
+    // 归约轴不在最内层时，逐个slice与累加行做连续的逐元素运算
+    const int64_t grain = std::max(kParallelGrain / axis, static_cast<int64_t>(1));
+    return ParallelFor(outer * inner, grain, [x, out, axis, inner](int64_t begin, int64_t end) -> Status {
+      T flag{};
+      elewise::SimdFlag<T, Op<T>> simd_flag;
+      int64_t pos = begin;
+      while (pos < end) {
+        const int64_t i = pos / inner;
+        const int64_t j = pos - (i * inner);
+        const int64_t len = std::min(inner - j, end - pos);
+        const T *const src = x + (i * axis * inner) + j;
+        T *const dst = out + pos;
+        (void)memcpy(dst, src, static_cast<size_t>(len) * sizeof(T));
+        for (int64_t k = 1; k < axis; ++k) {
+          RunInner<Op<T>>(dst, 1, src + (k * inner), 1, dst, len, flag, simd_flag);
+        }
+        pos += len;
+      }
+      return (simd_flag.IsOverflow() || Op<T>::IsOverflow(flag)) ? FAILED : SUCCESS;
+    });
+  }
+
+  // out[i] = func(x[i])，func返回false表示输入非法
+  template <typename InT, typename OutT, typename Func>
+  static Status UnaryCompute(const InT *const x, const int64_t num, OutT *const out, const Func &func) {
+    return ParallelFor(num, kParallelGrain, [x, out, &func](int64_t begin, int64_t end) -> Status {
+      bool valid = true;
+      for (int64_t i = begin; i < end; ++i) {
+        valid = func(x[i], out[i]) && valid;
+      }
+      return valid ? SUCCESS : FAILED;
+    });
+  }
+
+ private:
+  static void GetRowOffset(const BroadcastPlan &plan, int64_t row, int64_t &x_offset, int64_t &y_offset) {
+    for (size_t i = plan.dims.size() - 1U; i > 0U; --i) {
+      const size_t dim_idx = i - 1U;
+      const int64_t idx = row % plan.dims[dim_idx];
+      row /= plan.dims[dim_idx];
+      x_offset += idx * plan.x_strides[dim_idx];
+      y_offset += idx * plan.y_strides[dim_idx];
+    }
+  }
+
+  template <typename Op, typename T>
+  static void RunInner(const T *const x, const int64_t x_step, const T *const y, const int64_t y_step, T *const out,
+                       const int64_t len, T &flag, elewise::SimdFlag<T, Op> &simd_flag) {
+    if ((x_step != 0) && (y_step != 0)) {
+      elewise::Loop<Op, T, false, false>::Run(x, y, out, len, flag, simd_flag);
+    } else if (y_step != 0) {
+      elewise::Loop<Op, T, true, false>::Run(x, y, out, len, flag, simd_flag);
+    } else if (x_step != 0) {
+      elewise::Loop<Op, T, false, true>::Run(x, y, out, len, flag, simd_flag);
+    } else {
+      const T value = Op::template Compute<T, elewise::UnsignedOf<T>>(x[0], y[0], flag);
+      std::fill(out, out + len, value);
+    }
+  }
+};
+}  // namespace ge
+
+#endif  // GE_HOST_KERNELS_KERNEL_ELEWISE_ENGINE_H_
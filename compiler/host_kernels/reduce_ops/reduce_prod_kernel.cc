@@ -10,6 +10,7 @@
 
 #include "reduce_prod_kernel.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 
@@ -21,6 +22,7 @@
 #include "host_kernels/kernel_utils.h"
 #include "graph/utils/type_utils.h"
 #include "host_kernels/kernel_factory.h"
+#include "host_kernels/kernel_elewise_engine.h"
 
 namespace ge {
 namespace {
@@ -114,28 +116,22 @@ Status ReduceProdKernel::DataCal(const std::vector<ge::ConstGeTensorPtr> &input,
     int32_t *input_data = const_cast<int32_t *>(reinterpret_cast<const int32_t *>(data_tensor->GetData().GetData()));
     GE_CHECK_NOTNULL(input_data);
     size_t data_num = data_tensor->GetData().size() / sizeof(int32_t);
-    unique_ptr<int32_t[]> buf(new (std::nothrow) int32_t[data_num]());
+    if (static_cast<size_t>(head_dim_ * axis_dim_ * end_dim_) > data_num) {
+      GELOGW("Data size of input is not enough, expect %ld elements, actual %zu.", head_dim_ * axis_dim_ * end_dim_,
+             data_num);
+      return INTERNAL_ERROR;
+    }
+    const int64_t out_num = std::max(head_dim_ * end_dim_, static_cast<int64_t>(1));
+    unique_ptr<int32_t[]> buf(new (std::nothrow) int32_t[static_cast<size_t>(out_num)]());
     if (buf == nullptr) {
       GELOGW("new buf failed");
       return INTERNAL_ERROR;
     }
 
-    int32_t tmp_x = 1;
-    int32_t tmp_y = 1;
-    for (int64_t i = 0; i < head_dim_; ++i) {
-      for (int64_t j = 0; j < end_dim_; ++j) {
-        // all index for input_data is less than size of input_data
-        tmp_x = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j)];
-        for (int64_t k = 1; k < axis_dim_; ++k) {
-          tmp_y = input_data[static_cast<size_t>(i * end_dim_ * axis_dim_ + j + k * end_dim_)];
-          if (ge::CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
-            GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", tmp_x, tmp_y);
-            return INTERNAL_ERROR;
-          }
-          tmp_x *= tmp_y;
-        }
-        buf[static_cast<size_t>(i * end_dim_ + j)] = tmp_x;
-      }
+    if (ElewiseEngine::ReduceCompute<elewise::MulOp, int32_t>(input_data, head_dim_, axis_dim_, end_dim_, buf.get()) !=
+        SUCCESS) {
+      GELOGW("Product is overflow, reduce axis dim: %ld.", axis_dim_);
+      return INTERNAL_ERROR;
     }
 
     GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()),
@@ -204,17 +200,11 @@ Status ReduceProdKernel::ComputeNoAxis(const ge::OpDescPtr &op_desc_ptr, const s
       return INTERNAL_ERROR;
     }
 
-    int32_t tmp_x = input_data[0];
-    int32_t tmp_y = 1;
-    for (size_t k = 1; k < data_num; ++k) {
-      tmp_y = input_data[k];
-      if (ge::CheckInt32MulOverflow(tmp_x, tmp_y) != SUCCESS) {
-        GELOGW("Product is overflow. multiplier 1: %d. multiplier 2: %d.", tmp_x, tmp_y);
-        return INTERNAL_ERROR;
-      }
-      tmp_x *= tmp_y;
+    if (ElewiseEngine::ReduceCompute<elewise::MulOp, int32_t>(input_data, 1, static_cast<int64_t>(data_num), 1,
+                                                              buf.get()) != SUCCESS) {
+      GELOGW("Product is overflow, data num: %zu.", data_num);
+      return INTERNAL_ERROR;
     }
-    buf[0] = tmp_x;
     GE_IF_BOOL_EXEC(output_ptr->SetData(reinterpret_cast<uint8_t *>(buf.get()), sizeof(int32_t)) != GRAPH_SUCCESS,
                     GELOGW("set data failed");
                     return INTERNAL_ERROR);
@@ -15,6 +15,10 @@
 #include "tensor_engine/fusion_types.h"
 
 namespace te {
+namespace fusion {
+class TbeOpInfoHasher;
+}  // namespace fusion
+
 class TbeAttrValue {
  public:
   TbeAttrValue() : dtype_(ATTR_INT8) {}
@@ -245,6 +249,7 @@ class TbeAttrValue {
   bool operator==(TbeAttrValue &rObject);
 
  private:
+  friend class fusion::TbeOpInfoHasher;
   // need to adapt operator== func while adding new variable
   std::string name_;
   int8_t int8_value_{0};
@@ -11,6 +11,7 @@
 #ifndef ATC_OPCOMPILER_INC_TENSOR_ENGINE_TBE_OP_INFO_H_
 #define ATC_OPCOMPILER_INC_TENSOR_ENGINE_TBE_OP_INFO_H_
 
+#include <atomic>
 #include <map>
 #include <vector>
 #include <memory>
@@ -21,6 +22,10 @@
 #include "tensor_engine/tbe_op_param.h"
 
 namespace te {
+namespace fusion {
+class TbeOpInfoHasher;
+}  // namespace fusion
+
 class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
  public:
   TbeOpInfo(const std::string &name, const std::string &moduleName, const std::string &opType,
@@ -165,6 +170,7 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
 
   void AddInput(const TbeOpParam &param) {
     inputs_.push_back(param);
+    structural_hash_.Invalidate();
   }
 
   void GetInputs(std::vector<TbeOpParam> &inputs) const {
@@ -176,15 +182,18 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
   }
 
   std::vector<TbeOpParam> &MutableInputs() {
+    structural_hash_.Invalidate();
     return inputs_;
   }
 
   void SetInputs(const std::vector<TbeOpParam> &inputs) {
     inputs_.assign(inputs.begin(), inputs.end());
+    structural_hash_.Invalidate();
   }
 
   void AddOutput(const TbeOpParam &param) {
     outputs_.push_back(param);
+    structural_hash_.Invalidate();
   }
 
   void GetOutputs(std::vector<TbeOpParam> &outputs) const {
@@ -196,15 +205,18 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
   }
 
   std::vector<TbeOpParam> &MutableOutputs() {
+    structural_hash_.Invalidate();
     return outputs_;
   }
 
   void SetOutputs(const std::vector<TbeOpParam> &outputs) {
     outputs_.assign(outputs.begin(), outputs.end());
+    structural_hash_.Invalidate();
   }
 
   void AddAttrValue(const TbeAttrValue &value) {
     attr_values_.push_back(value);
+    structural_hash_.Invalidate();
   }
 
   void GetAttrValues(std::vector<TbeAttrValue> &attrValues) const {
@@ -241,10 +253,12 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
 
   void SetOpImplMode(const std::string &opImplMode) {
     op_impl_mode_ = opImplMode;
+    structural_hash_.Invalidate();
   }
 
   void ClearOpImplMode() {
     op_impl_mode_.clear();
+    structural_hash_.Invalidate();
   }
 
   void GetExtraParams(std::string &extraParams) const {
@@ -297,6 +311,7 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
 
   void SetL1Space(const int64_t l1Space) {
     op_L1_space_ = l1Space;
+    structural_hash_.Invalidate();
   }
 
   void SetIsUnknownShape(const bool unknown) {
@@ -479,6 +494,7 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
   bool operator==(TbeOpInfo &rObject);
 
  private:
+  friend class fusion::TbeOpInfoHasher;
   // need to adapt operator== func while adding new variable
   // parameter from upper
   std::string op_name_;
@@ -532,6 +548,55 @@ class TbeOpInfo : public std::enable_shared_from_this<TbeOpInfo> {
   int64_t ubFusionSpaceSize_;
   std::string cust_aic_num_;
   std::string cust_aiv_num_;
+  // 结构hash缓存，由fusion::TbeOpInfoHasher首次计算时填充，修改参与hash的字段后失效。
+  // 多个线程可同时对同一对象求hash：low/high写完后以release写valid，读取方acquire读到valid后再读low/high
+  class StructuralHashMemo {
+   public:
+    StructuralHashMemo() = default;
+    StructuralHashMemo(const StructuralHashMemo &other) {
+      CopyFrom(other);
+    }
+    StructuralHashMemo &operator=(const StructuralHashMemo &other) {
+      if (this != &other) {
+        CopyFrom(other);
+      }
+      return *this;
+    }
+    bool Load(uint64_t &low, uint64_t &high) const {
+      if (!valid_.load(std::memory_order_acquire)) {
+        return false;
+      }
+      low = low_.load(std::memory_order_relaxed);
+      high = high_.load(std::memory_order_relaxed);
+      return true;
+    }
+    void Store(const uint64_t low, const uint64_t high) {
+      low_.store(low, std::memory_order_relaxed);
+      high_.store(high, std::memory_order_relaxed);
+      valid_.store(true, std::memory_order_release);
+    }
+    void Invalidate() {
+      valid_.store(false, std::memory_order_release);
+    }
+    bool IsValid() const {
+      return valid_.load(std::memory_order_acquire);
+    }
+
+   private:
+    void CopyFrom(const StructuralHashMemo &other) {
+      uint64_t low = 0U;
+      uint64_t high = 0U;
+      if (other.Load(low, high)) {
+        Store(low, high);
+      } else {
+        Invalidate();
+      }
+    }
+    std::atomic<bool> valid_{false};
+    std::atomic<uint64_t> low_{0U};
+    std::atomic<uint64_t> high_{0U};
+  };
+  mutable StructuralHashMemo structural_hash_;
 };
 using TbeOpInfoPtr = std::shared_ptr<TbeOpInfo>;
 using ConstTbeOpInfoPtr = std::shared_ptr<const TbeOpInfo>;
@@ -17,6 +17,10 @@
 #include "tensor_engine/fusion_types.h"
 
 namespace te {
+namespace fusion {
+class TbeOpInfoHasher;
+}  // namespace fusion
+
 static constexpr size_t K_TBE_RT_MEMORY_UB = (0x1U << 15U);
 
 class TbeOpTensor {
@@ -483,6 +487,7 @@ class TbeOpTensor {
   bool operator==(TbeOpTensor &rObject);
 
  private:
+  friend class fusion::TbeOpInfoHasher;
   // need to adapt operator== func while adding new variable
   std::string name_;
   // current shape and format
@@ -9,7 +9,9 @@
  */
 
 #include "cache/te_cache_manager.h"
+#include <ctime>
 #include <fcntl.h>
+#include <sys/stat.h>
 #include "inc/te_fusion_log.h"
 #include "inc/te_fusion_check.h"
 #include "inc/te_fusion_util_constants.h"
@@ -19,6 +21,7 @@
 #include "common/te_config_info.h"
 #include "cache/te_cache_utils.h"
 #include "cache/te_cache_space_manager.h"
+#include "cache/te_cache_store.h"
 #include "dfxinfo_manager/dfxinfo_manager.h"
 #include "python_adapter/python_api_call.h"
 #include "graph/ge_context.h"
@@ -114,6 +117,40 @@ bool TeCacheManager::IsCacheEnable() const {
   return cache_mode_ != CompileCacheMode::Disable;
 }
 
+bool TeCacheManager::IsCacheStoreEnable() const {
+  const TeCacheStore &cacheStore = TeCacheStore::Instance();
+  return cacheStore.IsOpened() && (cacheStore.GetCacheDirPath() == cache_dir_path_);
+}
+
+void TeCacheManager::AddCacheStoreEntry(const std::string &kernelName, const std::vector<std::string> &cacheFilePaths,
+                                        const uint64_t binChecksum) const {
+  if (!IsCacheStoreEnable()) {
+    return;
+  }
+  TeCacheEntry entry;
+  entry.kernelName = kernelName;
+  entry.binChecksum = binChecksum;
+  entry.lastAccessTime = static_cast<uint64_t>(std::time(nullptr));
+  const std::string cacheDirPrefix = cache_dir_path_ + "/";
+  const size_t prefixLen = cacheDirPrefix.length();
+  for (const auto &filePath : cacheFilePaths) {
+    struct stat fileStat;
+    if ((filePath.length() <= prefixLen) || (filePath.compare(0U, prefixLen, cacheDirPrefix) != 0) ||
+        (stat(filePath.c_str(), &fileStat) != 0)) {
+      TE_DBGLOG("Cache file [%s] of kernel [%s] does not exist, skip indexing.", filePath.c_str(), kernelName.c_str());
+      continue;
+    }
+    entry.files.emplace_back(filePath.substr(prefixLen), static_cast<uint64_t>(fileStat.st_size));
+    entry.totalSize += static_cast<uint64_t>(fileStat.st_size);
+  }
+  if (!TeCacheStore::Instance().Insert(entry)) {
+    // 索引不再覆盖全部kernel，未命中时需退回文件搜索
+    TE_INFOLOG("Kernel [%s] is not indexed in cache dir [%s], cache index is no longer authoritative.",
+               kernelName.c_str(), cache_dir_path_.c_str());
+    TeCacheStore::Instance().SetAuthoritative(false);
+  }
+}
+
 CompileResultPtr TeCacheManager::MatchCompileCache(const std::string &kernelName, bool spkMode) {
   if (!IsCacheEnable()) {
     TE_DBGLOG("Compile cache mode is disable.");
@@ -137,9 +174,23 @@ CompileResultPtr TeCacheManager::MatchCompileCache(const std::string &kernelName
     return nullptr;
   }
 
+  // 索引覆盖全部kernel时，未命中即可确定缓存不存在，不需要访问文件系统
+  const bool storeEnable = IsCacheStoreEnable();
+  TeCacheEntry cacheEntry;
+  bool confirmedMiss = false;
+  const bool indexed = storeEnable && TeCacheStore::Instance().Lookup(kernelName, cacheEntry, confirmedMiss);
+  if (confirmedMiss) {
+    TE_DBGLOG("Kernel [%s] is not found in cache index.", kernelName.c_str());
+    DfxInfoManager::Instance().RecordStatistics(StatisticsType::DISK_CACHE, RecordEventType::CACHE_NOT_EXIST);
+    return nullptr;
+  }
+
   std::string jsonFilePath = RealPath(cache_dir_path_ + "/" + kernelName + ".json");
   if (jsonFilePath.empty()) {
     TE_DBGLOG("Kernel json file for [%s] does not match.", kernelName.c_str());
+    if (indexed) {
+      (void)TeCacheStore::Instance().Remove(kernelName);
+    }
     DfxInfoManager::Instance().RecordStatistics(StatisticsType::DISK_CACHE, RecordEventType::CACHE_NOT_EXIST);
     return nullptr;
   }
@@ -151,16 +202,42 @@ CompileResultPtr TeCacheManager::MatchCompileCache(const std::string &kernelName
     return compileRetPtr;
   }
 
-  // verify sha256 of bin file
-  if (!VerifyBinFileSha256(compileRetPtr)) {
+  // 索引中记录了bin校验值时直接比对，否则校验sha256，校验通过后将校验值记入索引
+  if (indexed && (cacheEntry.binChecksum != 0U)) {
+    if (!VerifyBinFileChecksum(compileRetPtr, cacheEntry.binChecksum)) {
+      TE_INFOLOGF("Verify checksum of json file[%s] and bin file[%s] not success.", compileRetPtr->jsonPath.c_str(),
+                  compileRetPtr->binPath.c_str());
+      DfxInfoManager::Instance().RecordStatistics(StatisticsType::DISK_CACHE, RecordEventType::SHA256_FAIL);
+      return nullptr;
+    }
+  } else if (!VerifyBinFileSha256(compileRetPtr)) {
     TE_INFOLOGF("Verify sha256 of json file[%s] and bin file[%s] not success.", compileRetPtr->jsonPath.c_str(),
                 compileRetPtr->binPath.c_str());
     DfxInfoManager::Instance().RecordStatistics(StatisticsType::DISK_CACHE, RecordEventType::SHA256_FAIL);
     return nullptr;
+  } else if (storeEnable) {
+    std::vector<std::string> cacheFilePaths;
+    if (indexed) {
+      for (const auto &file : cacheEntry.files) {
+        cacheFilePaths.emplace_back(cache_dir_path_ + "/" + file.first);
+      }
+    } else {
+      cacheFilePaths = {compileRetPtr->jsonPath, compileRetPtr->binPath};
+      if (!compileRetPtr->headerPath.empty()) {
+        cacheFilePaths.emplace_back(compileRetPtr->headerPath);
+      }
+    }
+    AddCacheStoreEntry(kernelName, cacheFilePaths,
+                       TeCacheStore::CalcChecksum(compileRetPtr->kernelBin->GetBinData(),
+                                                  compileRetPtr->kernelBin->GetBinDataSize()));
   }
 
   // update access time of json and bin file
-  if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
+  if (indexed) {
+    if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
+      TeCacheStore::Instance().Touch(cacheEntry);
+    }
+  } else if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
     if (!TeFileUtils::UpdateFileAccessTime(compileRetPtr->jsonPath) ||
         !TeFileUtils::UpdateFileAccessTime(compileRetPtr->binPath)) {
       TE_INFOLOGF("Update access time for json file[%s] or bin file[%s] not success.", compileRetPtr->jsonPath.c_str(),
@@ -215,9 +292,29 @@ bool TeCacheManager::SetCompileResult(const CompileResultPtr &compileResultPtr)
     return false;
   }
   std::string cacheBinFilePath = cache_dir_path_ + compileResultPtr->binPath.substr(bin_pos);
+  TeCacheEntry cacheEntry;
+  if (IsCacheStoreEnable() && TeCacheStore::Instance().Lookup(kernelName, cacheEntry)) {
+    TE_DBGLOG("Kernel [%s] is already indexed in cache dir.", kernelName.c_str());
+    return true;
+  }
+  std::vector<std::string> cacheFilePaths = {cacheJsonFilePath, cacheBinFilePath};
+  if (!compileResultPtr->headerPath.empty()) {
+    size_t pos = compileResultPtr->headerPath.find_last_of('.');
+    if (pos != std::string::npos) {
+      cacheFilePaths.emplace_back(cacheBinFilePath.substr(0, cacheBinFilePath.find_last_of('.')) +
+                                  compileResultPtr->headerPath.substr(pos));
+    }
+  }
+  const uint64_t binChecksum =
+      (compileResultPtr->kernelBin == nullptr)
+          ? 0U
+          : TeCacheStore::CalcChecksum(compileResultPtr->kernelBin->GetBinData(),
+                                       compileResultPtr->kernelBin->GetBinDataSize());
   if (!RealPath(cacheJsonFilePath).empty() || !RealPath(cacheBinFilePath).empty()) {
     TE_DBGLOGF("Json file path[%s] or bin file path[%s] is already existed in cache dir.", cacheJsonFilePath.c_str(),
                cacheBinFilePath.c_str());
+    // 文件由其他进程写入但尚未建立索引，校验值未知，命中时再校验sha256
+    AddCacheStoreEntry(kernelName, cacheFilePaths, 0U);
     return true;
   }
 
@@ -230,6 +327,9 @@ bool TeCacheManager::SetCompileResult(const CompileResultPtr &compileResultPtr)
   bool ret = CopyCompileRetIntoCacheDir(compileResultPtr, cacheJsonFilePath, cacheBinFilePath);
   TE_DBGLOG("Try to unlock cache file of kernel[%s] in cache dir[%s].", kernelName.c_str(), cache_dir_path_.c_str());
   TeCacheUtils::UnlockAndCloseCacheFile(fp);
+  if (ret) {
+    AddCacheStoreEntry(kernelName, cacheFilePaths, binChecksum);
+  }
   return ret;
 }
 
@@ -280,6 +380,20 @@ bool TeCacheManager::CopyCompileRetIntoCacheDir(const CompileResultPtr &compileR
   return true;
 }
 
+bool TeCacheManager::VerifyBinFileChecksum(const CompileResultPtr &compileResultPtr, const uint64_t binChecksum) {
+  if (compileResultPtr == nullptr || compileResultPtr->kernelBin == nullptr) {
+    return false;
+  }
+  const uint64_t checksumInBin = TeCacheStore::CalcChecksum(compileResultPtr->kernelBin->GetBinData(),
+                                                            compileResultPtr->kernelBin->GetBinDataSize());
+  if (checksumInBin != binChecksum) {
+    TE_INFOLOG("The checksum [%lu] of the binary file does not match the checksum [%lu] in cache index.",
+               checksumInBin, binChecksum);
+    return false;
+  }
+  return true;
+}
+
 bool TeCacheManager::VerifyBinFileSha256(const CompileResultPtr &compileResultPtr) {
   if (compileResultPtr == nullptr || compileResultPtr->jsonInfo == nullptr || compileResultPtr->kernelBin == nullptr) {
     return false;
@@ -330,10 +444,22 @@ PreCompileResultPtr TeCacheManager::MatchPreCompileCache(const std::string &kern
               preCompileRetPtr->prebuiltOptions.c_str());
     return preCompileRetPtr;
   }
+  const bool storeEnable = IsCacheStoreEnable();
+  TeCacheEntry cacheEntry;
+  bool confirmedMiss = false;
+  const bool indexed = storeEnable && TeCacheStore::Instance().Lookup(kernelName, cacheEntry, confirmedMiss);
+  if (confirmedMiss) {
+    TE_DBGLOG("Kernel [%s] is not found in cache index during the matching of pre-compile results.",
+              kernelName.c_str());
+    return nullptr;
+  }
   std::string jsonFilePath = RealPath(cache_dir_path_ + "/" + kernelName + ".json");
   if (jsonFilePath.empty()) {
     TE_DBGLOG("The json file for kernel [%s] was not found during the matching of pre-compile results.",
               kernelName.c_str());
+    if (indexed) {
+      (void)TeCacheStore::Instance().Remove(kernelName);
+    }
     return nullptr;
   }
   nlohmann::json jsonInfo;
@@ -361,7 +487,13 @@ PreCompileResultPtr TeCacheManager::MatchPreCompileCache(const std::string &kern
               preCompileRetPtr->prebuiltOptions.c_str());
   }
 
-  if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
+  if (indexed) {
+    if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
+      TeCacheStore::Instance().Touch(cacheEntry);
+    }
+  } else if (storeEnable) {
+    AddCacheStoreEntry(kernelName, {jsonFilePath}, 0U);
+  } else if (TeCacheSpaceManager::Instance().GetMaxOpCacheSize() != CACHE_AGING_FUCNTION_SWITCH) {
     if (!TeFileUtils::UpdateFileAccessTime(jsonFilePath)) {
       TE_INFOLOG("Cannot Update AccessTime for json file[%s].", jsonFilePath.c_str());
       return nullptr;
@@ -398,6 +530,10 @@ bool TeCacheManager::SetPreCompileResult(const std::string &kernelName,
   TE_DBGLOG("Begin to save pre-compile result into json file [%s].", jsonCachePath.c_str());
   if (!RealPath(jsonCachePath).empty()) {
     TE_DBGLOG("Json cache file [%s] is already existed.", jsonCachePath.c_str());
+    TeCacheEntry cacheEntry;
+    if (IsCacheStoreEnable() && !TeCacheStore::Instance().Lookup(kernelName, cacheEntry)) {
+      AddCacheStoreEntry(kernelName, {jsonCachePath}, 0U);
+    }
     return true;
   }
   // if json file is not existed in cache dir, copy json and bin file to cache dir
@@ -408,6 +544,9 @@ bool TeCacheManager::SetPreCompileResult(const std::string &kernelName,
   }
   bool ret = SavePreCompileRetIntoCacheDir(preCompileResultPtr, jsonCachePath);
   TeCacheUtils::UnlockAndCloseCacheFile(fp);
+  if (ret) {
+    AddCacheStoreEntry(kernelName, {jsonCachePath}, 0U);
+  }
   return ret;
 }
 
@@ -511,6 +650,7 @@ void TeCacheManager::ClearOpArgsCache(const std::string &session_graph_id) {
 }
 
 void TeCacheManager::Finalize() {
+  TeCacheStore::Instance().WaitBackgroundTask();
   compile_ret_cache_map_.clear();
   precompile_ret_cache_map_.clear();
 }
@@ -51,6 +51,11 @@ class TeCacheManager {
                                             const std::string &jsonCachePath);
 
   static bool VerifyBinFileSha256(const CompileResultPtr &compileResultPtr);
+  static bool VerifyBinFileChecksum(const CompileResultPtr &compileResultPtr, const uint64_t binChecksum);
+
+  bool IsCacheStoreEnable() const;
+  void AddCacheStoreEntry(const std::string &kernelName, const std::vector<std::string> &cacheFilePaths,
+                          const uint64_t binChecksum) const;
 
   bool SetCacheDirPath();
 
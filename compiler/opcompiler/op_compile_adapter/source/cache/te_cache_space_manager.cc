@@ -20,6 +20,7 @@
 #include "common/te_config_info.h"
 #include "common/te_file_utils.h"
 #include "cache/te_cache_utils.h"
+#include "cache/te_cache_store.h"
 #include "dfxinfo_manager/dfxinfo_manager.h"
 #include "graph/ge_context.h"
 
@@ -109,10 +110,55 @@ bool TeCacheSpaceManager::LoadIniFile(
 }
 
 void TeCacheSpaceManager::InitCacheSpace(const std::string &cacheDirPath, const CompileCacheMode cacheMode) {
+  // 版本变化时索引文件会随缓存目录一起删除，删除前先关闭索引
+  TeCacheStore::Instance().Close();
   DelCachedFiles(cacheDirPath, cacheMode);
+  if ((cacheMode != CompileCacheMode::Disable) && TeCacheStore::Instance().Open(cacheDirPath)) {
+    ImportCacheFilesIntoStore(cacheDirPath);
+  }
   (void)CacheSpaceInitialize(cacheDirPath);
 }
 
+void TeCacheSpaceManager::ImportCacheFilesIntoStore(const std::string &cacheDir) const {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  if (cacheStore.IsAuthoritative()) {
+    TE_DBGLOG("Cache index in dir [%s] is authoritative, %zu kernels are indexed.", cacheDir.c_str(),
+              cacheStore.GetEntryNum());
+    return;
+  }
+  // 首次使用索引时遍历一次缓存目录，导入已有kernel，之后的查询及老化都不再遍历目录
+  std::vector<std::string> cachedJsonFiles;
+  CollectCacheJsonFileAccessTime(cacheDir, cachedJsonFiles);
+  std::multimap<uint64_t, CacheFileSizeInfo> filesStatInfo;
+  GetFilesAccessTime(cachedJsonFiles, filesStatInfo);
+  const std::string jsonSuffix = ".json";
+  const size_t prefixLen = cacheDir.length() + 1U;
+  for (const auto &fileStatInfo : filesStatInfo) {
+    const CacheFileSizeInfo &cacheFileInfo = fileStatInfo.second;
+    if ((cacheFileInfo.jsonFilePath.length() <= prefixLen + jsonSuffix.length()) ||
+        !IsStrEndWith(cacheFileInfo.jsonFilePath, jsonSuffix)) {
+      continue;
+    }
+    TeCacheEntry entry;
+    entry.kernelName = cacheFileInfo.jsonFilePath.substr(
+        prefixLen, cacheFileInfo.jsonFilePath.length() - prefixLen - jsonSuffix.length());
+    entry.lastAccessTime = fileStatInfo.first;
+    for (const auto &fileInfo : cacheFileInfo.totalFileSizeInfos) {
+      if (fileInfo.filePath.length() > prefixLen) {
+        entry.files.emplace_back(fileInfo.filePath.substr(prefixLen), fileInfo.fileSize);
+        entry.totalSize += fileInfo.fileSize;
+      }
+    }
+    if (!cacheStore.Insert(entry)) {
+      TE_WARNLOG("Import kernel [%s] into cache index not successfully, keep searching cache files.",
+                 entry.kernelName.c_str());
+      return;
+    }
+  }
+  cacheStore.SetAuthoritative(true);
+  TE_INFOLOG("Imported %zu kernels into cache index in dir [%s].", filesStatInfo.size(), cacheDir.c_str());
+}
+
 int64_t TeCacheSpaceManager::GetMaxOpCacheSize() const {
   return maxOpCacheSize_;
 }
@@ -625,13 +671,27 @@ bool TeCacheSpaceManager::CacheSpaceInitialize(const std::string &cacheDir) {
     TE_DBGLOG("The log aging function is disabled.");
     return true;
   }
-  int64_t totalUsedSize = TeFileUtils::GetDirectorySize(cacheDir);
+  // 索引覆盖全部kernel时，使用量及老化顺序都从索引获取，老化在后台进行，不阻塞编译
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  const bool useCacheStore = cacheStore.IsAuthoritative() && (cacheStore.GetCacheDirPath() == cacheDir);
+  int64_t totalUsedSize = useCacheStore ? static_cast<int64_t>(cacheStore.GetTotalSize())
+                                        : TeFileUtils::GetDirectorySize(cacheDir);
   int64_t remainSizeRadio = GetCacheRemainSizeRadio();
 
   TE_INFOLOG("Max op_cache_size is [%llu], and total_used_size is [%llu].", maxSize, totalUsedSize);
   if (totalUsedSize >= maxSize) {
     TE_WARNLOG("The cache space is insufficient. The max size is %llu and the total_used_size is %llu.", maxSize,
                totalUsedSize);
+    if (useCacheStore) {
+      if (!CheckInt64MulOverflow(maxSize, remainSizeRadio)) {
+        return false;
+      }
+      uint64_t sizeToDel = totalUsedSize - maxSize * remainSizeRadio / PERCENT_UNIT;
+      TE_INFOLOG("The remainSizeRadio is %d. [%llu] bytes of indexed cache need to be aged.", remainSizeRadio,
+                 sizeToDel);
+      cacheStore.StartBackgroundAging(sizeToDel, MIN_CACHE_AGING_TIME);
+      return true;
+    }
     const std::string delCacheLockName = "op_cache_file_del";
     FILE *fp = TeCacheUtils::LockAndOpenCacheFile(cacheDir, delCacheLockName);
     if (fp == nullptr) {
@@ -647,6 +707,8 @@ bool TeCacheSpaceManager::CacheSpaceInitialize(const std::string &cacheDir) {
     TE_INFOLOG("The remainSizeRadio is %d. [%llu] bytes of space need to be deleted.", remainSizeRadio, sizeToDel);
     DelCacheFileByAccessTime(cacheDir, sizeToDel);
     TeCacheUtils::UnlockAndCloseCacheFile(fp);
+  } else if (useCacheStore && cacheStore.NeedCompact()) {
+    cacheStore.StartBackgroundAging(0U, MIN_CACHE_AGING_TIME);
   }
   return true;
 }
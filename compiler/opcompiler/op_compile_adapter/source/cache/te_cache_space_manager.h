@@ -73,6 +73,8 @@ class TeCacheSpaceManager {
 
   void CollectCacheJsonFileAccessTime(const std::string &cachePath, std::vector<std::string> &cachedJsonFiles) const;
 
+  void ImportCacheFilesIntoStore(const std::string &cacheDir) const;
+
   int64_t GetCacheSpaceMaxSizeCfg();
 
   int64_t GetCacheRemainSizeRadio() const;
@@ -0,0 +1,783 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "cache/te_cache_store.h"
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "inc/te_fusion_log.h"
+#include "inc/te_fusion_util_constants.h"
+
+namespace te {
+namespace fusion {
+namespace {
+const std::string kIndexFileName = "/kernel_cache.idx";
+const std::string kDataFileName = "/kernel_cache.dat";
+const std::string kTmpFileSuffix = ".tmp";
+constexpr uint64_t kIndexMagic = 0x5445434143484549UL;  // "TECACHEI"
+constexpr uint32_t kIndexVersion = 1U;
+constexpr uint32_t kSlotNum = 1U << 18U;
+constexpr uint64_t kMaxLoadPercent = 75U;
+constexpr uint64_t kPercentUnit = 100U;
+constexpr uint32_t kRecordMagic = 0x54454352U;  // "TECR"
+constexpr uint32_t kMaxRecordBodyLen = 1U << 20U;
+constexpr uint64_t kTombstoneOffset = UINT64_MAX;
+constexpr uint64_t kMinCompactDataSize = 1UL << 20U;
+constexpr uint64_t kChecksumSeed = 0xCBF29CE484222325UL;
+constexpr uint64_t kChecksumPrime = 0x100000001B3UL;
+constexpr uint64_t kMixMul1 = 0xFF51AFD7ED558CCDUL;
+constexpr uint64_t kMixMul2 = 0xC4CEB9FE1A85EC53UL;
+constexpr uint32_t kMixShift = 33U;
+
+struct RecordHead {
+  uint32_t magic;
+  uint32_t bodyLen;
+  uint32_t keyLen;
+  uint32_t fileNum;
+  uint64_t binChecksum;
+  uint64_t bodyChecksum;
+};
+
+template <typename T>
+inline T AtomicLoad(const T &value) {
+  return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+inline void AtomicStore(T &value, const T newValue) {
+  __atomic_store_n(&value, newValue, __ATOMIC_RELEASE);
+}
+
+template <typename T>
+inline void AtomicAdd(T &value, const T delta) {
+  (void)__atomic_add_fetch(&value, delta, __ATOMIC_ACQ_REL);
+}
+
+template <typename T>
+inline void AtomicSub(T &value, const T delta) {
+  (void)__atomic_sub_fetch(&value, delta, __ATOMIC_ACQ_REL);
+}
+
+uint64_t HashKey(const std::string &kernelName) {
+  const uint64_t hash = TeCacheStore::CalcChecksum(kernelName.data(), kernelName.size());
+  // 0表示空槽位
+  return (hash == 0U) ? 1U : hash;
+}
+
+uint64_t GetCurrentTime() {
+  return static_cast<uint64_t>(std::time(nullptr));
+}
+
+template <typename T>
+void AppendValue(std::string &buffer, const T value) {
+  (void)buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadValue(const std::string &buffer, size_t &pos, T &value) {
+  if (pos + sizeof(T) > buffer.size()) {
+    return false;
+  }
+  (void)memcpy_s(&value, sizeof(T), buffer.data() + pos, sizeof(T));
+  pos += sizeof(T);
+  return true;
+}
+
+bool ReadString(const std::string &buffer, size_t &pos, const size_t len, std::string &value) {
+  if (pos + len > buffer.size()) {
+    return false;
+  }
+  value.assign(buffer.data() + pos, len);
+  pos += len;
+  return true;
+}
+
+std::string SerializeRecord(const TeCacheEntry &entry) {
+  std::string body;
+  (void)body.append(entry.kernelName);
+  for (const auto &file : entry.files) {
+    AppendValue(body, static_cast<uint32_t>(file.first.size()));
+    AppendValue(body, file.second);
+    (void)body.append(file.first);
+  }
+  RecordHead head{kRecordMagic,
+                  static_cast<uint32_t>(body.size()),
+                  static_cast<uint32_t>(entry.kernelName.size()),
+                  static_cast<uint32_t>(entry.files.size()),
+                  entry.binChecksum,
+                  TeCacheStore::CalcChecksum(body.data(), body.size())};
+  std::string record;
+  record.reserve(sizeof(RecordHead) + body.size());
+  AppendValue(record, head);
+  (void)record.append(body);
+  return record;
+}
+
+bool WriteAll(const int fd, const std::string &buffer, const uint64_t offset) {
+  size_t written = 0U;
+  while (written < buffer.size()) {
+    const ssize_t ret = pwrite(fd, buffer.data() + written, buffer.size() - written,
+                               static_cast<off_t>(offset + written));
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    written += static_cast<size_t>(ret);
+  }
+  return true;
+}
+
+bool ReadAll(const int fd, void *buffer, const size_t len, const uint64_t offset) {
+  size_t readLen = 0U;
+  while (readLen < len) {
+    const ssize_t ret =
+        pread(fd, static_cast<char *>(buffer) + readLen, len - readLen, static_cast<off_t>(offset + readLen));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return false;
+    }
+    readLen += static_cast<size_t>(ret);
+  }
+  return true;
+}
+}  // namespace
+
+struct TeCacheStore::IndexHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t capacity;
+  uint64_t liveNum;
+  uint64_t tombNum;
+  uint64_t totalSize;
+  uint64_t dataSize;      // 记录文件中已提交的长度，之后的内容视为未完成的写入
+  uint64_t liveDataSize;  // 有效记录占用的长度
+  uint64_t generation;    // 记录文件被替换时递增
+  uint32_t authoritative;
+  uint32_t reserved;
+};
+
+struct TeCacheStore::IndexSlot {
+  uint64_t keyHash;  // 0表示空槽位
+  uint64_t offset;   // kTombstoneOffset表示已删除或尚未发布
+  uint64_t totalSize;
+  uint64_t lastAccess;
+  uint32_t recordLen;
+  uint32_t reserved;
+};
+
+TeCacheStore::DataFile::~DataFile() {
+  if (fd_ >= 0) {
+    (void)close(fd_);
+  }
+}
+
+TeCacheStore &TeCacheStore::Instance() {
+  static TeCacheStore teCacheStore;
+  return teCacheStore;
+}
+
+TeCacheStore::~TeCacheStore() {
+  Close();
+}
+
+uint64_t TeCacheStore::CalcChecksum(const void *data, const size_t size) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  uint64_t hash = kChecksumSeed;
+  const size_t wordNum = size / sizeof(uint64_t);
+  for (size_t i = 0U; i < wordNum; ++i) {
+    uint64_t word = 0U;
+    (void)memcpy_s(&word, sizeof(word), bytes + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash = (hash ^ word) * kChecksumPrime;
+    hash ^= hash >> kMixShift;
+  }
+  for (size_t i = wordNum * sizeof(uint64_t); i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kChecksumPrime;
+  }
+  hash ^= static_cast<uint64_t>(size);
+  hash = (hash ^ (hash >> kMixShift)) * kMixMul1;
+  hash = (hash ^ (hash >> kMixShift)) * kMixMul2;
+  return hash ^ (hash >> kMixShift);
+}
+
+bool TeCacheStore::IsOpened() const {
+  return header_ != nullptr;
+}
+
+bool TeCacheStore::LockFile() const {
+  struct flock lock = {};
+  lock.l_type = F_WRLCK;
+  lock.l_whence = SEEK_SET;
+  while (fcntl(indexFd_, F_SETLKW, &lock) != 0) {
+    if (errno != EINTR) {
+      TE_WARNLOG("Lock cache index file in dir [%s] failed, %s.", cacheDirPath_.c_str(), strerror(errno));
+      return false;
+    }
+  }
+  return true;
+}
+
+void TeCacheStore::UnlockFile() const {
+  struct flock lock = {};
+  lock.l_type = F_UNLCK;
+  lock.l_whence = SEEK_SET;
+  if (fcntl(indexFd_, F_SETLK, &lock) != 0) {
+    TE_INFOLOG("Unlock cache index file in dir [%s] not successfully.", cacheDirPath_.c_str());
+  }
+}
+
+bool TeCacheStore::Open(const std::string &cacheDirPath) {
+  if (IsOpened()) {
+    if (cacheDirPath_ == cacheDirPath) {
+      return true;
+    }
+    Close();
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  cacheDirPath_ = cacheDirPath;
+  dataFilePath_ = cacheDirPath + kDataFileName;
+  if (!OpenIndexFile(cacheDirPath + kIndexFileName)) {
+    TE_WARNLOG("Open cache index in dir [%s] unsuccessful, fall back to searching cache files.",
+               cacheDirPath.c_str());
+    if (header_ != nullptr) {
+      (void)munmap(header_, mapSize_);
+      header_ = nullptr;
+      slots_ = nullptr;
+    }
+    if (indexFd_ >= 0) {
+      (void)close(indexFd_);
+      indexFd_ = -1;
+    }
+    return false;
+  }
+  TE_INFOLOG("Open cache index in dir [%s] success, entry num:%lu, total size:%lu, authoritative:%u.",
+             cacheDirPath.c_str(), AtomicLoad(header_->liveNum), AtomicLoad(header_->totalSize),
+             AtomicLoad(header_->authoritative));
+  return true;
+}
+
+bool TeCacheStore::OpenIndexFile(const std::string &indexPath) {
+  indexFd_ = open(indexPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, FILE_AUTHORITY);
+  if (indexFd_ < 0) {
+    TE_INFOLOG("Open index file [%s] not successfully, %s.", indexPath.c_str(), strerror(errno));
+    return false;
+  }
+  if (!LockFile()) {
+    return false;
+  }
+  mapSize_ = sizeof(IndexHeader) + static_cast<size_t>(kSlotNum) * sizeof(IndexSlot);
+  struct stat fileStat = {};
+  bool needReset = (fstat(indexFd_, &fileStat) != 0) || (static_cast<size_t>(fileStat.st_size) != mapSize_);
+  if (needReset && (ftruncate(indexFd_, static_cast<off_t>(mapSize_)) != 0)) {
+    TE_INFOLOG("Resize index file [%s] not successfully, %s.", indexPath.c_str(), strerror(errno));
+    UnlockFile();
+    return false;
+  }
+  void *addr = mmap(nullptr, mapSize_, PROT_READ | PROT_WRITE, MAP_SHARED, indexFd_, 0);
+  if (addr == MAP_FAILED) {
+    TE_INFOLOG("Map index file [%s] not successfully, %s.", indexPath.c_str(), strerror(errno));
+    UnlockFile();
+    return false;
+  }
+  header_ = static_cast<IndexHeader *>(addr);
+  slots_ = reinterpret_cast<IndexSlot *>(header_ + 1);
+  needReset = needReset || (header_->magic != kIndexMagic) || (header_->version != kIndexVersion) ||
+              (header_->capacity != kSlotNum);
+  if (needReset) {
+    TE_INFOLOG("Index file [%s] is new or incompatible, reset it.", indexPath.c_str());
+    ResetIndex();
+  }
+  const bool ret = ReopenDataFile(needReset);
+  UnlockFile();
+  return ret;
+}
+
+void TeCacheStore::ResetIndex() const {
+  for (uint32_t i = 0U; i < kSlotNum; ++i) {
+    slots_[i] = IndexSlot{0U, kTombstoneOffset, 0U, 0U, 0U, 0U};
+  }
+  const uint64_t generation = (header_->magic == kIndexMagic) ? (header_->generation + 1U) : 1U;
+  header_->version = kIndexVersion;
+  header_->capacity = kSlotNum;
+  header_->liveNum = 0U;
+  header_->tombNum = 0U;
+  header_->totalSize = 0U;
+  header_->dataSize = 0U;
+  header_->liveDataSize = 0U;
+  header_->authoritative = 0U;
+  header_->reserved = 0U;
+  AtomicStore(header_->generation, generation);
+  AtomicStore(header_->magic, kIndexMagic);
+}
+
+bool TeCacheStore::ReopenDataFile(const bool truncate) {
+  const uint32_t flags = static_cast<uint32_t>(O_RDWR | O_CREAT | O_CLOEXEC) | (truncate ? O_TRUNC : 0U);
+  const int fd = open(dataFilePath_.c_str(), static_cast<int>(flags), FILE_AUTHORITY);
+  if (fd < 0) {
+    TE_INFOLOG("Open data file [%s] not successfully, %s.", dataFilePath_.c_str(), strerror(errno));
+    return false;
+  }
+  std::lock_guard<std::mutex> lock_guard(dataFileMutex_);
+  dataFile_ = std::make_shared<DataFile>(fd);
+  dataGeneration_ = AtomicLoad(header_->generation);
+  return true;
+}
+
+TeCacheStore::DataFilePtr TeCacheStore::GetDataFile() {
+  std::lock_guard<std::mutex> lock_guard(dataFileMutex_);
+  if (header_ == nullptr) {
+    return nullptr;
+  }
+  // 其他进程压缩后替换了记录文件
+  const uint64_t generation = AtomicLoad(header_->generation);
+  if (generation != dataGeneration_) {
+    const int fd = open(dataFilePath_.c_str(), O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+      TE_INFOLOG("Reopen data file [%s] not successfully, %s.", dataFilePath_.c_str(), strerror(errno));
+      return nullptr;
+    }
+    dataFile_ = std::make_shared<DataFile>(fd);
+    dataGeneration_ = generation;
+  }
+  return dataFile_;
+}
+
+void TeCacheStore::Close() {
+  WaitBackgroundTask();
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (header_ != nullptr) {
+    (void)munmap(header_, mapSize_);
+    header_ = nullptr;
+    slots_ = nullptr;
+  }
+  if (indexFd_ >= 0) {
+    (void)close(indexFd_);
+    indexFd_ = -1;
+  }
+  std::lock_guard<std::mutex> data_lock_guard(dataFileMutex_);
+  dataFile_.reset();
+  dataGeneration_ = 0U;
+}
+
+bool TeCacheStore::IsAuthoritative() const {
+  return IsOpened() && (AtomicLoad(header_->authoritative) != 0U);
+}
+
+void TeCacheStore::SetAuthoritative(const bool authoritative) {
+  if (!IsOpened()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (!LockFile()) {
+    // 撤销标记只会让查询退回文件搜索，加锁失败时也需生效
+    if (!authoritative) {
+      AtomicStore(header_->authoritative, 0U);
+    }
+    return;
+  }
+  AtomicStore(header_->authoritative, authoritative ? 1U : 0U);
+  UnlockFile();
+}
+
+uint64_t TeCacheStore::GetTotalSize() const {
+  return IsOpened() ? AtomicLoad(header_->totalSize) : 0U;
+}
+
+size_t TeCacheStore::GetEntryNum() const {
+  return IsOpened() ? static_cast<size_t>(AtomicLoad(header_->liveNum)) : 0U;
+}
+
+bool TeCacheStore::ReadRecord(const DataFilePtr &dataFile, const uint64_t offset, TeCacheEntry &entry) const {
+  const uint64_t dataSize = AtomicLoad(header_->dataSize);
+  RecordHead head = {};
+  if ((offset + sizeof(RecordHead) > dataSize) || !ReadAll(dataFile->GetFd(), &head, sizeof(head), offset)) {
+    return false;
+  }
+  if ((head.magic != kRecordMagic) || (head.bodyLen > kMaxRecordBodyLen) ||
+      (offset + sizeof(RecordHead) + head.bodyLen > dataSize)) {
+    return false;
+  }
+  std::string body(head.bodyLen, '\0');
+  if (!ReadAll(dataFile->GetFd(), &body[0], body.size(), offset + sizeof(RecordHead)) ||
+      (CalcChecksum(body.data(), body.size()) != head.bodyChecksum)) {
+    return false;
+  }
+  size_t pos = 0U;
+  if (!ReadString(body, pos, head.keyLen, entry.kernelName)) {
+    return false;
+  }
+  entry.files.clear();
+  for (uint32_t i = 0U; i < head.fileNum; ++i) {
+    uint32_t nameLen = 0U;
+    uint64_t fileSize = 0U;
+    std::string fileName;
+    if (!ReadValue(body, pos, nameLen) || !ReadValue(body, pos, fileSize) ||
+        !ReadString(body, pos, nameLen, fileName)) {
+      return false;
+    }
+    entry.files.emplace_back(std::move(fileName), fileSize);
+  }
+  entry.binChecksum = head.binChecksum;
+  return true;
+}
+
+bool TeCacheStore::AppendRecord(const DataFilePtr &dataFile, const TeCacheEntry &entry, uint64_t &offset,
+                                uint32_t &recordLen) const {
+  const std::string record = SerializeRecord(entry);
+  if (record.size() > sizeof(RecordHead) + kMaxRecordBodyLen) {
+    TE_INFOLOG("Record of kernel [%s] is too large.", entry.kernelName.c_str());
+    return false;
+  }
+  // 崩溃时可能残留未提交的内容，以索引头中的长度为准覆盖写
+  offset = AtomicLoad(header_->dataSize);
+  if (!WriteAll(dataFile->GetFd(), record, offset)) {
+    TE_INFOLOG("Write record of kernel [%s] not successfully, %s.", entry.kernelName.c_str(), strerror(errno));
+    return false;
+  }
+  recordLen = static_cast<uint32_t>(record.size());
+  AtomicStore(header_->dataSize, offset + recordLen);
+  return true;
+}
+
+TeCacheStore::IndexSlot *TeCacheStore::FindSlot(const DataFilePtr &dataFile, const std::string &kernelName,
+                                                TeCacheEntry *entry) const {
+  if (dataFile == nullptr) {
+    return nullptr;
+  }
+  const uint64_t keyHash = HashKey(kernelName);
+  for (uint32_t i = 0U; i < kSlotNum; ++i) {
+    const uint64_t slotId = (keyHash + i) & (kSlotNum - 1U);
+    IndexSlot &slot = slots_[slotId];
+    const uint64_t slotHash = AtomicLoad(slot.keyHash);
+    if (slotHash == 0U) {
+      return nullptr;
+    }
+    if (slotHash != keyHash) {
+      continue;
+    }
+    const uint64_t offset = AtomicLoad(slot.offset);
+    if (offset == kTombstoneOffset) {
+      continue;
+    }
+    // 其他进程可能正在压缩重建索引，以记录中的kernel名为准
+    TeCacheEntry record;
+    if (!ReadRecord(dataFile, offset, record) || (record.kernelName != kernelName)) {
+      continue;
+    }
+    if (entry != nullptr) {
+      record.lastAccessTime = AtomicLoad(slot.lastAccess);
+      record.totalSize = AtomicLoad(slot.totalSize);
+      record.slotId = slotId;
+      record.recordOffset = offset;
+      *entry = std::move(record);
+    }
+    return &slot;
+  }
+  return nullptr;
+}
+
+void TeCacheStore::InsertSlot(const uint64_t offset, const uint32_t recordLen, const TeCacheEntry &entry) const {
+  const uint64_t keyHash = HashKey(entry.kernelName);
+  for (uint32_t i = 0U; i < kSlotNum; ++i) {
+    IndexSlot &slot = slots_[(keyHash + i) & (kSlotNum - 1U)];
+    const uint64_t slotHash = AtomicLoad(slot.keyHash);
+    if ((slotHash != 0U) && (AtomicLoad(slot.offset) != kTombstoneOffset)) {
+      continue;
+    }
+    if (slotHash != 0U) {
+      AtomicSub(header_->tombNum, static_cast<uint64_t>(1U));
+    }
+    // 先写内容再发布偏移，无锁查询只会看到完整的槽位
+    AtomicStore(slot.keyHash, keyHash);
+    AtomicStore(slot.totalSize, entry.totalSize);
+    AtomicStore(slot.lastAccess, (entry.lastAccessTime == 0U) ? GetCurrentTime() : entry.lastAccessTime);
+    AtomicStore(slot.recordLen, recordLen);
+    AtomicStore(slot.offset, offset);
+    AtomicAdd(header_->liveNum, static_cast<uint64_t>(1U));
+    AtomicAdd(header_->totalSize, entry.totalSize);
+    AtomicAdd(header_->liveDataSize, static_cast<uint64_t>(recordLen));
+    return;
+  }
+}
+
+void TeCacheStore::RemoveSlot(IndexSlot *slot) const {
+  AtomicStore(slot->offset, kTombstoneOffset);
+  AtomicSub(header_->liveNum, static_cast<uint64_t>(1U));
+  AtomicAdd(header_->tombNum, static_cast<uint64_t>(1U));
+  AtomicSub(header_->totalSize, AtomicLoad(slot->totalSize));
+  AtomicSub(header_->liveDataSize, static_cast<uint64_t>(AtomicLoad(slot->recordLen)));
+}
+
+bool TeCacheStore::Lookup(const std::string &kernelName, TeCacheEntry &entry) {
+  if (!IsOpened() || kernelName.empty()) {
+    return false;
+  }
+  return FindSlot(GetDataFile(), kernelName, &entry) != nullptr;
+}
+
+bool TeCacheStore::Lookup(const std::string &kernelName, TeCacheEntry &entry, bool &confirmedMiss) {
+  confirmedMiss = false;
+  if (!IsOpened() || kernelName.empty()) {
+    return false;
+  }
+  const uint64_t generation = AtomicLoad(header_->generation);
+  if (FindSlot(GetDataFile(), kernelName, &entry) != nullptr) {
+    return true;
+  }
+  // 压缩重建先撤销authoritative，重建完成后先递增代数再恢复，因此代数不变且标记有效时未命中可信
+  confirmedMiss = IsAuthoritative() && (AtomicLoad(header_->generation) == generation);
+  return false;
+}
+
+void TeCacheStore::Touch(const TeCacheEntry &entry) const {
+  if (!IsOpened() || (entry.slotId >= kSlotNum)) {
+    return;
+  }
+  IndexSlot &slot = slots_[entry.slotId];
+  if (AtomicLoad(slot.offset) == entry.recordOffset) {
+    AtomicStore(slot.lastAccess, GetCurrentTime());
+  }
+}
+
+bool TeCacheStore::Insert(const TeCacheEntry &entry) {
+  if (!IsOpened() || entry.kernelName.empty()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (!LockFile()) {
+    return false;
+  }
+  const auto isOverloaded = [this](const uint64_t usedNum) {
+    return (usedNum + 1U) * kPercentUnit > static_cast<uint64_t>(kSlotNum) * kMaxLoadPercent;
+  };
+  if (isOverloaded(AtomicLoad(header_->liveNum) + AtomicLoad(header_->tombNum))) {
+    (void)CompactLocked();
+  }
+  bool ret = false;
+  DataFilePtr dataFile = GetDataFile();
+  uint64_t offset = 0U;
+  uint32_t recordLen = 0U;
+  if (isOverloaded(AtomicLoad(header_->liveNum) + AtomicLoad(header_->tombNum))) {
+    TE_INFOLOG("Cache index in dir [%s] is full, kernel [%s] is not indexed.", cacheDirPath_.c_str(),
+               entry.kernelName.c_str());
+  } else if ((dataFile != nullptr) && AppendRecord(dataFile, entry, offset, recordLen)) {
+    IndexSlot *oldSlot = FindSlot(dataFile, entry.kernelName, nullptr);
+    if (oldSlot != nullptr) {
+      RemoveSlot(oldSlot);
+    }
+    InsertSlot(offset, recordLen, entry);
+    ret = true;
+  }
+  UnlockFile();
+  return ret;
+}
+
+bool TeCacheStore::Remove(const std::string &kernelName) {
+  if (!IsOpened() || kernelName.empty()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (!LockFile()) {
+    return false;
+  }
+  IndexSlot *slot = FindSlot(GetDataFile(), kernelName, nullptr);
+  if (slot != nullptr) {
+    RemoveSlot(slot);
+  }
+  UnlockFile();
+  return slot != nullptr;
+}
+
+void TeCacheStore::DeleteEntryFiles(const TeCacheEntry &entry) const {
+  for (const auto &file : entry.files) {
+    const std::string filePath = cacheDirPath_ + "/" + file.first;
+    if ((unlink(filePath.c_str()) != 0) && (errno != ENOENT)) {
+      TE_INFOLOG("Delete aged file [%s] not successfully, %s.", filePath.c_str(), strerror(errno));
+      continue;
+    }
+    TE_DBGLOG("Aged file is [%s], last access time is [%lu].", filePath.c_str(), entry.lastAccessTime);
+  }
+}
+
+uint64_t TeCacheStore::EvictByLru(const uint64_t sizeToDel, const uint64_t minIdleSeconds) {
+  if (!IsOpened()) {
+    return 0U;
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (!LockFile()) {
+    return 0U;
+  }
+  DataFilePtr dataFile = GetDataFile();
+  std::vector<std::pair<uint64_t, uint32_t>> candidates;
+  candidates.reserve(static_cast<size_t>(AtomicLoad(header_->liveNum)));
+  for (uint32_t i = 0U; (sizeToDel > 0U) && (i < kSlotNum); ++i) {
+    if ((AtomicLoad(slots_[i].keyHash) != 0U) && (AtomicLoad(slots_[i].offset) != kTombstoneOffset)) {
+      candidates.emplace_back(AtomicLoad(slots_[i].lastAccess), i);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  const uint64_t now = GetCurrentTime();
+  uint64_t freedSize = 0U;
+  for (const auto &candidate : candidates) {
+    if (candidate.first + minIdleSeconds > now) {
+      TE_INFOLOG("Current time is [%lu], the oldest access time is [%lu], stop aging.", now, candidate.first);
+      break;
+    }
+    IndexSlot &slot = slots_[candidate.second];
+    TeCacheEntry entry;
+    if ((dataFile != nullptr) && ReadRecord(dataFile, AtomicLoad(slot.offset), entry)) {
+      entry.lastAccessTime = candidate.first;
+      DeleteEntryFiles(entry);
+    }
+    freedSize += AtomicLoad(slot.totalSize);
+    RemoveSlot(&slot);
+    if (freedSize >= sizeToDel) {
+      break;
+    }
+  }
+  TE_INFOLOG("Aged [%lu] bytes of cache in dir [%s], [%lu] bytes required.", freedSize, cacheDirPath_.c_str(),
+             sizeToDel);
+  if (NeedCompact()) {
+    (void)CompactLocked();
+  }
+  UnlockFile();
+  return freedSize;
+}
+
+bool TeCacheStore::NeedCompact() const {
+  if (!IsOpened()) {
+    return false;
+  }
+  const uint64_t dataSize = AtomicLoad(header_->dataSize);
+  return (dataSize > kMinCompactDataSize) && (dataSize > AtomicLoad(header_->liveDataSize) * 2U);
+}
+
+bool TeCacheStore::Compact() {
+  if (!IsOpened()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock_guard(writeMutex_);
+  if (!LockFile()) {
+    return false;
+  }
+  const bool ret = CompactLocked();
+  UnlockFile();
+  return ret;
+}
+
+bool TeCacheStore::CompactLocked() {
+  DataFilePtr dataFile = GetDataFile();
+  if (dataFile == nullptr) {
+    return false;
+  }
+  std::vector<TeCacheEntry> liveEntries;
+  liveEntries.reserve(static_cast<size_t>(AtomicLoad(header_->liveNum)));
+  for (uint32_t i = 0U; i < kSlotNum; ++i) {
+    const IndexSlot &slot = slots_[i];
+    if ((AtomicLoad(slot.keyHash) == 0U) || (AtomicLoad(slot.offset) == kTombstoneOffset)) {
+      continue;
+    }
+    TeCacheEntry entry;
+    if (!ReadRecord(dataFile, AtomicLoad(slot.offset), entry)) {
+      continue;
+    }
+    entry.lastAccessTime = AtomicLoad(slot.lastAccess);
+    entry.totalSize = AtomicLoad(slot.totalSize);
+    liveEntries.emplace_back(std::move(entry));
+  }
+
+  // 有效记录写入新文件后替换，持有旧文件句柄的查询不受影响
+  const std::string tmpPath = dataFilePath_ + kTmpFileSuffix;
+  const int fd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, FILE_AUTHORITY);
+  if (fd < 0) {
+    TE_INFOLOG("Open file [%s] not successfully, %s.", tmpPath.c_str(), strerror(errno));
+    return false;
+  }
+  std::vector<std::pair<uint64_t, uint32_t>> locations;
+  locations.reserve(liveEntries.size());
+  uint64_t offset = 0U;
+  for (const auto &entry : liveEntries) {
+    const std::string record = SerializeRecord(entry);
+    if (!WriteAll(fd, record, offset)) {
+      TE_INFOLOG("Write file [%s] not successfully, %s.", tmpPath.c_str(), strerror(errno));
+      (void)close(fd);
+      (void)unlink(tmpPath.c_str());
+      return false;
+    }
+    locations.emplace_back(offset, static_cast<uint32_t>(record.size()));
+    offset += record.size();
+  }
+  if (rename(tmpPath.c_str(), dataFilePath_.c_str()) != 0) {
+    TE_INFOLOG("Rename file [%s] not successfully, %s.", tmpPath.c_str(), strerror(errno));
+    (void)close(fd);
+    (void)unlink(tmpPath.c_str());
+    return false;
+  }
+
+  // 重建索引，期间其他进程的查询可能未命中，先撤销authoritative使未命中的查询退回文件搜索
+  const uint32_t authoritative = AtomicLoad(header_->authoritative);
+  AtomicStore(header_->authoritative, 0U);
+  const uint64_t oldDataSize = AtomicLoad(header_->dataSize);
+  for (uint32_t i = 0U; i < kSlotNum; ++i) {
+    AtomicStore(slots_[i].offset, kTombstoneOffset);
+    AtomicStore(slots_[i].keyHash, static_cast<uint64_t>(0U));
+  }
+  AtomicStore(header_->liveNum, static_cast<uint64_t>(0U));
+  AtomicStore(header_->tombNum, static_cast<uint64_t>(0U));
+  AtomicStore(header_->totalSize, static_cast<uint64_t>(0U));
+  AtomicStore(header_->liveDataSize, static_cast<uint64_t>(0U));
+  AtomicStore(header_->dataSize, offset);
+  for (size_t i = 0U; i < liveEntries.size(); ++i) {
+    InsertSlot(locations[i].first, locations[i].second, liveEntries[i]);
+  }
+  const uint64_t generation = AtomicLoad(header_->generation) + 1U;
+  AtomicStore(header_->generation, generation);
+  AtomicStore(header_->authoritative, authoritative);
+  {
+    std::lock_guard<std::mutex> lock_guard(dataFileMutex_);
+    dataFile_ = std::make_shared<DataFile>(fd);
+    dataGeneration_ = generation;
+  }
+  TE_INFOLOG("Compact cache data file [%s] from [%lu] to [%lu] bytes, entry num:%zu.", dataFilePath_.c_str(),
+             oldDataSize, offset, liveEntries.size());
+  return true;
+}
+
+void TeCacheStore::StartBackgroundAging(const uint64_t sizeToDel, const uint64_t minIdleSeconds) {
+  std::lock_guard<std::mutex> lock_guard(backgroundMutex_);
+  if (backgroundThread_.joinable()) {
+    backgroundThread_.join();
+  }
+  try {
+    backgroundThread_ = std::thread([this, sizeToDel, minIdleSeconds]() {
+      (void)EvictByLru(sizeToDel, minIdleSeconds);
+    });
+  } catch (const std::system_error &e) {
+    TE_INFOLOG("Start background aging thread not successfully, %s, aging synchronously.", e.what());
+    (void)EvictByLru(sizeToDel, minIdleSeconds);
+  }
+}
+
+void TeCacheStore::WaitBackgroundTask() {
+  std::lock_guard<std::mutex> lock_guard(backgroundMutex_);
+  if (backgroundThread_.joinable()) {
+    backgroundThread_.join();
+  }
+}
+}  // namespace fusion
+}  // namespace te
@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef ATC_OPCOMPILER_TE_FUSION_SOURCE_CACHE_TE_CACHE_STORE_H_
+#define ATC_OPCOMPILER_TE_FUSION_SOURCE_CACHE_TE_CACHE_STORE_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace te {
+namespace fusion {
+struct TeCacheEntry {
+  std::string kernelName;
+  // 缓存目录下属于该kernel的文件名及大小，老化时一并删除
+  std::vector<std::pair<std::string, uint64_t>> files;
+  // bin内容的校验值，0表示未知(由旧目录导入)，命中时需走sha256校验
+  uint64_t binChecksum = 0U;
+  uint64_t lastAccessTime = 0U;
+  uint64_t totalSize = 0U;
+  // 查询时所在的槽位及记录偏移，用于更新访问时间
+  uint64_t slotId = 0U;
+  uint64_t recordOffset = 0U;
+};
+
+/**
+ * @brief: 编译缓存目录的索引
+ * 缓存目录下维护两个文件：
+ * kernel_cache.dat 只追加写的记录文件，每条记录描述一个kernel的缓存文件集合及bin校验值；
+ * kernel_cache.idx 以kernel名hash为key的开放寻址索引，mmap共享到所有进程，槽位中记录记录文件偏移、
+ *                  文件总大小及最近访问时间。
+ * 查询无锁，O(1)定位记录；写入、删除及压缩在进程内互斥锁与索引文件的fcntl写锁下进行，支持多进程并发。
+ * 压缩时重写记录文件并重建索引，其他进程通过索引头中的代数感知并重新打开记录文件；重建期间索引不完整，
+ * 先撤销authoritative标记，重建完成并递增代数后再恢复。
+ */
+class TeCacheStore {
+ public:
+  static TeCacheStore &Instance();
+
+  bool Open(const std::string &cacheDirPath);
+  void Close();
+  bool IsOpened() const;
+  const std::string &GetCacheDirPath() const {
+    return cacheDirPath_;
+  }
+
+  // 索引是否覆盖了缓存目录中全部kernel，为true时索引未命中即可认定缓存不存在
+  bool IsAuthoritative() const;
+  void SetAuthoritative(const bool authoritative);
+
+  bool Lookup(const std::string &kernelName, TeCacheEntry &entry);
+  // 未命中时，confirmedMiss表示能否据此认定缓存不存在：索引覆盖全部kernel，且查询期间未发生压缩重建
+  bool Lookup(const std::string &kernelName, TeCacheEntry &entry, bool &confirmedMiss);
+  // 命中后更新访问时间，只写共享内存，不修改文件时间
+  void Touch(const TeCacheEntry &entry) const;
+  // 已存在同名kernel时以新记录为准
+  bool Insert(const TeCacheEntry &entry);
+  bool Remove(const std::string &kernelName);
+
+  uint64_t GetTotalSize() const;
+  size_t GetEntryNum() const;
+
+  /**
+   * 按最近访问时间从旧到新淘汰kernel，删除其缓存文件，直至释放sizeToDel字节，之后按需压缩记录文件
+   * @param minIdleSeconds 最近minIdleSeconds秒内访问过的kernel不淘汰
+   * @return 实际释放的字节数
+   */
+  uint64_t EvictByLru(const uint64_t sizeToDel, const uint64_t minIdleSeconds);
+  // 丢弃记录文件中已失效的记录并重建索引
+  bool Compact();
+  // 记录文件中失效记录占比较高时需要压缩
+  bool NeedCompact() const;
+
+  // 后台执行淘汰及压缩，Close或再次调用前等待上一次任务完成
+  void StartBackgroundAging(const uint64_t sizeToDel, const uint64_t minIdleSeconds);
+  void WaitBackgroundTask();
+
+  static uint64_t CalcChecksum(const void *data, const size_t size);
+
+ private:
+  TeCacheStore() = default;
+  ~TeCacheStore();
+  TeCacheStore(const TeCacheStore &) = delete;
+  TeCacheStore &operator=(const TeCacheStore &) = delete;
+
+  struct IndexHeader;
+  struct IndexSlot;
+  // 记录文件句柄，压缩后替换为新文件，仍在读取旧文件的查询持有引用直至结束
+  class DataFile {
+   public:
+    explicit DataFile(const int fd) : fd_(fd) {}
+    ~DataFile();
+    int GetFd() const {
+      return fd_;
+    }
+
+   private:
+    int fd_;
+  };
+  using DataFilePtr = std::shared_ptr<DataFile>;
+
+  bool OpenIndexFile(const std::string &indexPath);
+  void ResetIndex() const;
+  bool ReopenDataFile(const bool truncate);
+  DataFilePtr GetDataFile();
+  bool LockFile() const;
+  void UnlockFile() const;
+  IndexSlot *FindSlot(const DataFilePtr &dataFile, const std::string &kernelName, TeCacheEntry *entry) const;
+  void InsertSlot(const uint64_t offset, const uint32_t recordLen, const TeCacheEntry &entry) const;
+  bool AppendRecord(const DataFilePtr &dataFile, const TeCacheEntry &entry, uint64_t &offset,
+                    uint32_t &recordLen) const;
+  bool ReadRecord(const DataFilePtr &dataFile, const uint64_t offset, TeCacheEntry &entry) const;
+  void RemoveSlot(IndexSlot *slot) const;
+  void DeleteEntryFiles(const TeCacheEntry &entry) const;
+  bool CompactLocked();
+
+  std::string cacheDirPath_;
+  std::string dataFilePath_;
+  int indexFd_ = -1;
+  IndexHeader *header_ = nullptr;
+  IndexSlot *slots_ = nullptr;
+  size_t mapSize_ = 0U;
+  // 进程内写操作互斥，多进程间由索引文件的fcntl写锁互斥
+  mutable std::mutex writeMutex_;
+  mutable std::mutex dataFileMutex_;
+  DataFilePtr dataFile_;
+  uint64_t dataGeneration_ = 0U;
+  std::mutex backgroundMutex_;
+  std::thread backgroundThread_;
+};
+}  // namespace fusion
+}  // namespace te
+#endif  // ATC_OPCOMPILER_TE_FUSION_SOURCE_CACHE_TE_CACHE_STORE_H_
@@ -9,157 +9,330 @@
  */
 
 #include "common/tbe_op_info_hash.h"
+#include <cmath>
+#include <cstring>
 #include <memory>
-#include <nlohmann/json.hpp>
-#include "assemble_json/te_attr_utils.h"
+#include <type_traits>
 
 namespace te {
 namespace fusion {
-using std::hash;
 namespace {
-constexpr size_t HASH_INITIAL_VALUE = 17;
-constexpr size_t HASH_MULTIPER = 31;
+constexpr uint64_t kHashSeedLow = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t kHashSeedHigh = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t kHashMulLow = 0x87C37B91114253D5ULL;
+constexpr uint64_t kHashMulHigh = 0x4CF5AD432745937FULL;
+// json中inf/nan均序列化为null
+constexpr uint64_t kNonFiniteValue = 0x7FF8DEADBEEF0001ULL;
+// 用于区分字段边界，避免相邻字段拼接后产生相同输入
+constexpr uint64_t kTagTensor = 0x54454E534F520001ULL;
+constexpr uint64_t kTagParam = 0x504152414D000002ULL;
+constexpr uint64_t kTagAttr = 0x4154545200000003ULL;
+constexpr uint64_t kTagRangeNone = 0x52414E4745000004ULL;
 
-// Hash function for TbeAttrValue
-struct HashTbeAttrValue {
-  size_t operator()(const TbeAttrValue &cattr) const {
-    nlohmann::json jsonData;
-    GetAttrValueToJson(cattr, jsonData);
-    return hash<string>()(jsonData.dump());
+inline uint64_t RotateLeft(const uint64_t value, const uint32_t shift) {
+  return (value << shift) | (value >> (64U - shift));
+}
+
+inline uint64_t Mix64(uint64_t value) {
+  value ^= value >> 33U;
+  value *= 0xFF51AFD7ED558CCDULL;
+  value ^= value >> 33U;
+  value *= 0xC4CEB9FE1A85EC53ULL;
+  value ^= value >> 33U;
+  return value;
+}
+
+inline uint64_t FloatToBits(const double value) {
+  if (!std::isfinite(value)) {
+    return kNonFiniteValue;
   }
-};
+  uint64_t bits = 0U;
+  (void)std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
 
-// Hash function for TbeOpTensor
-struct HashTbeOpTensor {
-  size_t operator()(const TbeOpTensor &ctensor) const {
-    size_t key = HASH_INITIAL_VALUE;
-    key = key * HASH_MULTIPER + hash<string>()(ctensor.GetFormat());
-    key = key * HASH_MULTIPER + hash<int32_t>()(ctensor.GetSubFormat());
-    key = key * HASH_MULTIPER + hash<string>()(ctensor.GetOriginFormat());
-    std::string dType = ctensor.GetType() == "bool" ? "int8" : ctensor.GetType();
-    key = key * HASH_MULTIPER + hash<string>()(dType);
-    key = key * HASH_MULTIPER + static_cast<size_t>(ctensor.GetShapeType());
-    key = key * HASH_MULTIPER + hash<bool>()(ctensor.HasConstValue());
-    for (const int64_t &shapeDim : ctensor.GetShape()) {
-      key = key * HASH_MULTIPER + hash<int64_t>()(shapeDim);
+template <typename T>
+bool TbeElemCompare(const std::vector<T> &elems1, const std::vector<T> &elems2) {
+  if (elems1.size() != elems2.size()) {
+    return false;
+  }
+  // operator==未声明为const，仅做只读比较
+  for (size_t i = 0; i < elems1.size(); ++i) {
+    if (!(const_cast<T &>(elems1[i]) == const_cast<T &>(elems2[i]))) {
+      return false;
     }
+  }
+  return true;
+}
+}  // namespace
 
-    for (const int64_t &oriShapeDim : ctensor.GetOriginShape()) {
-      key = key * HASH_MULTIPER + hash<int64_t>()(oriShapeDim);
-    }
-    // L1 fusion begin
-    key = key * HASH_MULTIPER + hash<size_t>()(ctensor.GetAddrType());
+// 两路独立种子的64位混合，合成128位结果
+class TbeOpInfoHasher::State {
+ public:
+  void Update(const uint64_t value) {
+    low_ = RotateLeft(low_ ^ Mix64(value * kHashMulLow), 27U) * 5U + 0x52DCE729U;
+    high_ = RotateLeft(high_ ^ Mix64(value * kHashMulHigh), 31U) * 5U + 0x38495AB5U;
+    ++length_;
+  }
 
-    for (const int64_t validShapeDim : ctensor.GetValidShape()) {
-      key = key * HASH_MULTIPER + hash<int64_t>()(validShapeDim);
-    }
+  template <typename T, typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, int>::type = 0>
+  void Update(const T value) {
+    Update(static_cast<uint64_t>(static_cast<int64_t>(value)));
+  }
 
-    for (const int64_t sgtShapeDim : ctensor.GetSgtSliceShape()) {
-      key = key * HASH_MULTIPER + hash<int64_t>()(sgtShapeDim);
-    }
+  void UpdateFloat(const double value) {
+    Update(FloatToBits(value));
+  }
 
-    for (const int64_t offsetItem : ctensor.GetSliceOffset()) {
-      key = key * HASH_MULTIPER + hash<int64_t>()(offsetItem);
+  void Update(const std::string &value) {
+    Update(static_cast<uint64_t>(value.size()));
+    const char *data = value.data();
+    size_t left = value.size();
+    while (left >= sizeof(uint64_t)) {
+      uint64_t chunk = 0U;
+      (void)std::memcpy(&chunk, data, sizeof(chunk));
+      Update(chunk);
+      data += sizeof(uint64_t);
+      left -= sizeof(uint64_t);
     }
-    // L1 fusion end
-    key = key * HASH_MULTIPER + hash<int32_t>()(ctensor.GetL1FusionType());
-    key = key * HASH_MULTIPER + hash<int64_t>()(ctensor.GetL1AddrFlag());
-    key = key * HASH_MULTIPER + hash<int64_t>()(ctensor.GetAddrOffset());
-    key = key * HASH_MULTIPER + hash<int64_t>()(ctensor.GetL1ValidSize());
-    key = key * HASH_MULTIPER + HashTbeAttrValue()(ctensor.GetConstValue());
-
-    for (const int64_t totalShapeDim : ctensor.GetTotalShape()) {
-      key = key * HASH_MULTIPER + hash<uint32_t>()(totalShapeDim);
+    if (left > 0U) {
+      uint64_t chunk = 0U;
+      (void)std::memcpy(&chunk, data, left);
+      Update(chunk);
     }
+  }
 
-    key = key * HASH_MULTIPER + hash<uint32_t>()(ctensor.GetSplitIndex());
+  template <typename T>
+  void Update(const std::vector<T> &values) {
+    Update(static_cast<uint64_t>(values.size()));
+    for (const T &value : values) {
+      Update(value);
+    }
+  }
 
-    std::vector<std::pair<int64_t, int64_t>> range;
-    if (ctensor.GetShapeRange(range)) {
-      for (auto &t : range) {
-        key = key * HASH_MULTIPER + hash<int64_t>()(t.first);
-        key = key * HASH_MULTIPER + hash<int64_t>()(t.second);
-      }
+  void Update(const std::vector<bool> &values) {
+    Update(static_cast<uint64_t>(values.size()));
+    for (const bool value : values) {
+      Update(static_cast<uint64_t>(value ? 1U : 0U));
     }
+  }
 
-    if (ctensor.GetOriginShapeRange(range)) {
-      for (auto &t : range) {
-        key = key * HASH_MULTIPER + hash<int64_t>()(t.first);
-        key = key * HASH_MULTIPER + hash<int64_t>()(t.second);
-      }
+  template <typename T>
+  void UpdateFloats(const std::vector<T> &values) {
+    Update(static_cast<uint64_t>(values.size()));
+    for (const T value : values) {
+      UpdateFloat(static_cast<double>(value));
     }
-    return key;
   }
-};
 
-// Hash function for TbeOpParam
-struct HashTbeOpParam {
-  size_t operator()(const TbeOpParam &copparam) const {
-    size_t key = HASH_INITIAL_VALUE;
-    te::TensorType tt = copparam.GetType();
-    key = key * HASH_MULTIPER + static_cast<size_t>(tt);
+  void Update(const std::pair<int64_t, int64_t> &value) {
+    Update(value.first);
+    Update(value.second);
+  }
 
-    const std::vector<TbeOpTensor> &tensors = copparam.GetTensors();
-    for (auto &t : tensors) {
-      key = key * HASH_MULTIPER + HashTbeOpTensor()(t);
+  void UpdateRange(const std::tuple<bool, std::vector<std::pair<int64_t, int64_t>>> &range) {
+    if (!std::get<0>(range)) {
+      Update(kTagRangeNone);
+      return;
     }
+    Update(std::get<1>(range));
+  }
 
-    return key;
+  TbeOpInfoHashValue Finish() const {
+    TbeOpInfoHashValue hashValue;
+    uint64_t low = low_ ^ length_;
+    uint64_t high = high_ ^ length_;
+    low += high;
+    high += low;
+    hashValue.low = Mix64(low);
+    hashValue.high = Mix64(high);
+    hashValue.low += hashValue.high;
+    hashValue.high += hashValue.low;
+    return hashValue;
   }
-};
 
-template <typename OP, typename Vec, void (OP::*get_vector)(Vec &) const>
-bool TbeElemCompare(const OP *op1, const OP *op2) {
-  Vec elems1, elems2;
-  (op1->*get_vector)(elems1);
-  (op2->*get_vector)(elems2);
+ private:
+  uint64_t low_ = kHashSeedLow;
+  uint64_t high_ = kHashSeedHigh;
+  uint64_t length_ = 0U;
+};
 
-  if (elems1.size() != elems2.size()) {
-    return false;
+void TbeOpInfoHasher::UpdateAttr(State &state, const TbeAttrValue &attr) {
+  state.Update(kTagAttr);
+  state.Update(attr.dtype_);
+  switch (attr.dtype_) {
+    case ATTR_INT8:
+      state.Update(attr.int8_value_);
+      break;
+    case ATTR_UINT8:
+      state.Update(attr.uint8_value_);
+      break;
+    case ATTR_INT16:
+      state.Update(attr.int16_value_);
+      break;
+    case ATTR_UINT16:
+      state.Update(attr.uint16_value_);
+      break;
+    case ATTR_INT32:
+      state.Update(attr.int32_value_);
+      break;
+    case ATTR_UINT32:
+      state.Update(attr.uint32_value_);
+      break;
+    case ATTR_INT64:
+      state.Update(attr.int64_value_);
+      break;
+    case ATTR_UINT64:
+      state.Update(attr.uint64_value_);
+      break;
+    case ATTR_FLOAT32:
+      state.UpdateFloat(static_cast<double>(attr.float_value_));
+      break;
+    case ATTR_DOUBLE:
+      state.UpdateFloat(attr.double_value_);
+      break;
+    case ATTR_BOOL:
+      state.Update(attr.bool_value_);
+      break;
+    case ATTR_STR:
+      state.Update(attr.str_value_);
+      break;
+    case ATTR_LIST_INT8:
+      state.Update(attr.list_int8_value_);
+      break;
+    case ATTR_LIST_UINT8:
+      state.Update(attr.list_uint8_value_);
+      break;
+    case ATTR_LIST_INT16:
+      state.Update(attr.list_int16_value_);
+      break;
+    case ATTR_LIST_UINT16:
+      state.Update(attr.list_uint16_value_);
+      break;
+    case ATTR_LIST_INT32:
+      state.Update(attr.list_int32_value_);
+      break;
+    case ATTR_LIST_UINT32:
+      state.Update(attr.list_uint32_value_);
+      break;
+    case ATTR_LIST_INT64:
+      state.Update(attr.list_int64_value_);
+      break;
+    case ATTR_LIST_UINT64:
+      state.Update(attr.list_uint64_value_);
+      break;
+    case ATTR_LIST_FLOAT32:
+      state.UpdateFloats(attr.list_float_value_);
+      break;
+    case ATTR_LIST_DOUBLE:
+      state.UpdateFloats(attr.list_double_value_);
+      break;
+    case ATTR_LIST_BOOL:
+      state.Update(attr.list_bool_value_);
+      break;
+    case ATTR_LIST_STR:
+      state.Update(attr.list_str_value_);
+      break;
+    case ATTR_LIST_LIST_INT64:
+      state.Update(static_cast<uint64_t>(attr.list_list_int64_value_.size()));
+      for (const std::vector<int64_t> &value : attr.list_list_int64_value_) {
+        state.Update(value);
+      }
+      break;
+    case ATTR_LIST_LIST_FLOAT:
+      state.Update(static_cast<uint64_t>(attr.list_list_float_value_.size()));
+      for (const std::vector<float> &value : attr.list_list_float_value_) {
+        state.UpdateFloats(value);
+      }
+      break;
+    default:
+      break;
   }
+}
 
-  for (size_t i = 0; i < elems1.size(); ++i) {
-    if (!(elems1[i] == elems2[i])) {
-      return false;
-    }
+void TbeOpInfoHasher::UpdateTensor(State &state, const TbeOpTensor &tensor) {
+  state.Update(kTagTensor);
+  state.Update(tensor.format_);
+  state.Update(tensor.sub_format_);
+  state.Update(tensor.origin_format_);
+  // bool与int8编译结果相同
+  if (tensor.dtype_ == "bool") {
+    state.Update(std::string("int8"));
+  } else {
+    state.Update(tensor.dtype_);
   }
-  return true;
+  state.Update(tensor.stype_);
+  state.Update(tensor.is_const_);
+  state.Update(tensor.shape_);
+  state.Update(tensor.origin_shape_);
+  // L1 fusion begin
+  state.Update(tensor.addr_type_);
+  state.Update(tensor.valid_shape_);
+  state.Update(tensor.sgt_slice_shape_);
+  state.Update(tensor.slice_offset_);
+  // L1 fusion end
+  state.Update(tensor.L1_fusion_type_);
+  state.Update(tensor.L1_addr_flag_);
+  state.Update(tensor.addr_offset_);
+  state.Update(tensor.L1_valid_size_);
+  UpdateAttr(state, tensor.const_value_);
+  state.Update(tensor.total_shape_);
+  state.Update(tensor.split_index_);
+  state.UpdateRange(tensor.shapeRange_);
+  state.UpdateRange(tensor.originShapeRange_);
 }
-}  // namespace
-
-size_t HashTbeOpInfo::operator()(const TbeOpInfo &tbeOpInfo) const {
-  size_t key = HASH_INITIAL_VALUE;
-  string tmp;
-
-  std::string opType;
-  (void)tbeOpInfo.GetOpType(opType);
-  key = key * HASH_MULTIPER + hash<string>()(opType);
 
+TbeOpInfoHashValue TbeOpInfoHasher::Calc(const TbeOpInfo &tbeOpInfo) {
+  State state;
+  state.Update(tbeOpInfo.op_type_);
   // L1 fusion begin
-  int64_t opL1Space = 0;
-  (void)tbeOpInfo.GetL1Space(opL1Space);
-  key = key * HASH_MULTIPER + hash<int64_t>()(opL1Space);
+  state.Update(tbeOpInfo.op_L1_space_);
   // L1 fusion end
-  const vector<TbeOpParam> &inputs = tbeOpInfo.GetInputs();
-  for (auto &item : inputs) {
-    key = key * HASH_MULTIPER + HashTbeOpParam()(item);
+  for (const std::vector<TbeOpParam> *params : {&tbeOpInfo.inputs_, &tbeOpInfo.outputs_}) {
+    state.Update(static_cast<uint64_t>(params->size()));
+    for (const TbeOpParam &param : *params) {
+      state.Update(kTagParam);
+      state.Update(param.GetType());
+      const std::vector<TbeOpTensor> &tensors = param.GetTensors();
+      state.Update(static_cast<uint64_t>(tensors.size()));
+      for (const TbeOpTensor &tensor : tensors) {
+        UpdateTensor(state, tensor);
+      }
+    }
   }
-
-  const vector<TbeOpParam> &outputs = tbeOpInfo.GetOutputs();
-  for (auto &item : outputs) {
-    key = key * HASH_MULTIPER + HashTbeOpParam()(item);
+  state.Update(static_cast<uint64_t>(tbeOpInfo.attr_values_.size()));
+  for (const TbeAttrValue &attr : tbeOpInfo.attr_values_) {
+    UpdateAttr(state, attr);
   }
+  state.Update(tbeOpInfo.op_impl_mode_);
+  return state.Finish();
+}
 
-  vector<TbeAttrValue> attrs = {};
-  tbeOpInfo.GetAttrValues(attrs);
-  for (auto &item : attrs) {
-    key = key * HASH_MULTIPER + HashTbeAttrValue()(item);
+TbeOpInfoHashValue TbeOpInfoHasher::Get(const TbeOpInfo &tbeOpInfo) {
+  TbeOpInfoHashValue hashValue;
+  if (tbeOpInfo.structural_hash_.Load(hashValue.low, hashValue.high)) {
+    return hashValue;
   }
+  // 并发首次计算时各线程得到相同结果，重复写入无害
+  hashValue = Calc(tbeOpInfo);
+  tbeOpInfo.structural_hash_.Store(hashValue.low, hashValue.high);
+  return hashValue;
+}
 
-  std::string opImplMode = tbeOpInfo.GetOpImplMode();
-  key = key * HASH_MULTIPER + hash<string>()(opImplMode);
+TbeOpInfoHashValue TbeOpInfoHasher::CalcTensor(const TbeOpTensor &tensor) {
+  State state;
+  UpdateTensor(state, tensor);
+  return state.Finish();
+}
+
+TbeOpInfoHashValue TbeOpInfoHasher::CalcAttr(const TbeAttrValue &attr) {
+  State state;
+  UpdateAttr(state, attr);
+  return state.Finish();
+}
 
-  return key;
+size_t HashTbeOpInfo::operator()(const TbeOpInfo &tbeOpInfo) const {
+  return static_cast<size_t>(TbeOpInfoHasher::Get(tbeOpInfo).low);
 }
 
 size_t HashTbeOpInfo::operator()(const std::shared_ptr<TbeOpInfo> &tbeOpInfo) const {
@@ -167,7 +340,13 @@ size_t HashTbeOpInfo::operator()(const std::shared_ptr<TbeOpInfo> &tbeOpInfo) co
 }
 
 bool EqualToTbeOpInfo::operator()(const TbeOpInfo &a, const TbeOpInfo &b) const {
-  string tmp1, tmp2;
+  // 结构hash不同的op编译结果不同，无需逐字段比较
+  if (TbeOpInfoHasher::Get(a) != TbeOpInfoHasher::Get(b)) {
+    return false;
+  }
+
+  std::string tmp1;
+  std::string tmp2;
   (void)a.GetModuleName(tmp1);
   (void)b.GetModuleName(tmp2);
 
@@ -175,9 +354,8 @@ bool EqualToTbeOpInfo::operator()(const TbeOpInfo &a, const TbeOpInfo &b) const
     return false;
   }
 
-  if (!TbeElemCompare<TbeOpInfo, vector<TbeOpParam>, &TbeOpInfo::GetInputs>(&a, &b) ||
-      !TbeElemCompare<TbeOpInfo, vector<TbeOpParam>, &TbeOpInfo::GetOutputs>(&a, &b) ||
-      !TbeElemCompare<TbeOpInfo, vector<TbeAttrValue>, &TbeOpInfo::GetAttrValues>(&a, &b)) {
+  if (!TbeElemCompare(a.GetInputs(), b.GetInputs()) || !TbeElemCompare(a.GetOutputs(), b.GetOutputs()) ||
+      !TbeElemCompare(a.GetAttrValues(), b.GetAttrValues())) {
     return false;
   }
 
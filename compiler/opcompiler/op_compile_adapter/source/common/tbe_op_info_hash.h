@@ -11,10 +11,43 @@
 #ifndef ATC_OPCOMPILER_TE_FUSION_SOURCE_COMMON_TBE_OP_INFO_HASH_H_
 #define ATC_OPCOMPILER_TE_FUSION_SOURCE_COMMON_TBE_OP_INFO_HASH_H_
 
+#include <cstdint>
 #include "tensor_engine/tbe_op_info.h"
 
 namespace te {
 namespace fusion {
+struct TbeOpInfoHashValue {
+  uint64_t low = 0U;
+  uint64_t high = 0U;
+
+  bool operator==(const TbeOpInfoHashValue &other) const {
+    return low == other.low && high == other.high;
+  }
+
+  bool operator!=(const TbeOpInfoHashValue &other) const {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @brief: TbeOpInfo的128位结构hash
+ * 直接按字段计算，不构造json也不拷贝vector；属性只对dtype及当前dtype对应的取值计算，与属性json的语义一致，
+ * 非有限浮点数在json中均为null，计算时也视为同一值。
+ */
+class TbeOpInfoHasher {
+ public:
+  // 结果缓存在TbeOpInfo上，参与hash的字段被修改后重新计算
+  static TbeOpInfoHashValue Get(const TbeOpInfo &tbeOpInfo);
+  static TbeOpInfoHashValue Calc(const TbeOpInfo &tbeOpInfo);
+  static TbeOpInfoHashValue CalcTensor(const TbeOpTensor &tensor);
+  static TbeOpInfoHashValue CalcAttr(const TbeAttrValue &attr);
+
+ private:
+  class State;
+  static void UpdateTensor(State &state, const TbeOpTensor &tensor);
+  static void UpdateAttr(State &state, const TbeAttrValue &attr);
+};
+
 // Hash function for TbeInfo
 struct HashTbeOpInfo {
   size_t operator()(const TbeOpInfo &tbeOpInfo) const;
@@ -120,28 +120,28 @@ Status HeterogeneousExchangeService::EnsureInitialized(int32_t device_id) {
   return SUCCESS;
 }
 
-void HeterogeneousExchangeService::ProcessEmptyToNotEmptyEvent(const uint32_t queue_id) {
-  std::lock_guard<std::mutex> lk(dequeue_mu_);
-  auto it = subscribed_dequeues_.find(queue_id);
+void HeterogeneousExchangeService::NotifyQueueEvent(std::mutex &mu, const QueueEventStates &states,
+                                                    const uint32_t queue_id) {
+  std::lock_guard<std::mutex> lk(mu);
+  const auto it = states.find(queue_id);
   GELOGI("[ReceiveEvent] receive queue id[%u] event, find result[%d]", queue_id,
-         static_cast<int32_t>(it != subscribed_dequeues_.end()));
-  if (it != subscribed_dequeues_.end()) {
-    GELOGI("[ReceiveEvent] received queue id[%u] enqueue, notify dequeue", queue_id);
-    it->second = true;
-    dequeue_cv_.notify_all();
+         static_cast<int32_t>(it != states.cend()));
+  if (it != states.cend()) {
+    auto &state = *it->second;
+    std::lock_guard<std::mutex> state_lk(state.mu);
+    ++state.event_seq;
+    state.cv.notify_all();
   }
 }
 
+void HeterogeneousExchangeService::ProcessEmptyToNotEmptyEvent(const uint32_t queue_id) {
+  GELOGI("[ReceiveEvent] received queue id[%u] enqueue, notify dequeue", queue_id);
+  NotifyQueueEvent(dequeue_mu_, subscribed_dequeues_, queue_id);
+}
+
 void HeterogeneousExchangeService::ProcessF2NFEvent(const uint32_t queue_id) {
-  std::lock_guard<std::mutex> lk(enqueue_mu_);
-  auto it = subscribed_enqueues_.find(queue_id);
-  GELOGI("[ReceiveEvent] receive queue id[%u] event, find result[%d]", queue_id,
-         static_cast<int32_t>(it != subscribed_enqueues_.end()));
-  if (it != subscribed_enqueues_.end()) {
-    GELOGI("[ReceiveEvent] received queue id[%u] not full, notify enqueue", queue_id);
-    it->second = true;
-    enqueue_cv_.notify_all();
-  }
+  GELOGI("[ReceiveEvent] received queue id[%u] not full, notify enqueue", queue_id);
+  NotifyQueueEvent(enqueue_mu_, subscribed_enqueues_, queue_id);
 }
 
 void HeterogeneousExchangeService::WaitEvents(const int32_t device_id) {
@@ -176,35 +176,47 @@ void HeterogeneousExchangeService::WaitEvents(const int32_t device_id) {
   GELOGI("Event thread exist successfully, device id = %d", device_id);
 }
 
-Status HeterogeneousExchangeService::EnsureEnqueueSubscribed(const int32_t device_id, const uint32_t queue_id) {
-  const auto &it = subscribed_enqueues_.find(queue_id);
-  if (it == subscribed_enqueues_.cend()) {
-    GELOGI("[EnqueueSubscribe] start, queue id = %u", queue_id);
-    auto ret = rtQueueSubF2NFEvent(device_id, queue_id, kEventGroupId);
-    if (ret != RT_ERROR_NONE) {
-      REPORT_INNER_ERR_MSG("E19999", "Call rtQueueSubF2NFEvent fail, ret: 0x%X", static_cast<uint32_t>(ret));
-      GELOGE(RT_FAILED, "[EnqueueSubscribe] failed, rt_err = %d, queue id = %u", ret, queue_id);
-      return RT_ERROR_TO_GE_STATUS(ret);
-    }
-    GELOGI("[EnqueueSubscribe] ended successfully, queue id = %u", queue_id);
+Status HeterogeneousExchangeService::EnsureEnqueueSubscribed(const int32_t device_id, const uint32_t queue_id,
+                                                             std::shared_ptr<QueueEventState> &state) {
+  std::lock_guard<std::mutex> lk(enqueue_mu_);
+  const auto it = subscribed_enqueues_.find(queue_id);
+  if (it != subscribed_enqueues_.cend()) {
+    state = it->second;
+    return SUCCESS;
   }
-  subscribed_enqueues_[queue_id] = false;
+  GELOGI("[EnqueueSubscribe] start, queue id = %u", queue_id);
+  auto ret = rtQueueSubF2NFEvent(device_id, queue_id, kEventGroupId);
+  if (ret != RT_ERROR_NONE) {
+    REPORT_INNER_ERR_MSG("E19999", "Call rtQueueSubF2NFEvent fail, ret: 0x%X", static_cast<uint32_t>(ret));
+    GELOGE(RT_FAILED, "[EnqueueSubscribe] failed, rt_err = %d, queue id = %u", ret, queue_id);
+    return RT_ERROR_TO_GE_STATUS(ret);
+  }
+  state = MakeShared<QueueEventState>();
+  GE_CHECK_NOTNULL(state);
+  subscribed_enqueues_[queue_id] = state;
+  GELOGI("[EnqueueSubscribe] ended successfully, queue id = %u", queue_id);
   return SUCCESS;
 }
 
-Status HeterogeneousExchangeService::EnsureDequeueSubscribed(const int32_t device_id, const uint32_t queue_id) {
-  const auto &it = subscribed_dequeues_.find(queue_id);
-  if (it == subscribed_dequeues_.cend()) {
-    GELOGI("[DequeueSubscribe] start, queue id = %u", queue_id);
-    auto ret = rtQueueSubscribe(device_id, queue_id, kEventGroupId, kRtQueueTypeSingle);
-    if (ret != RT_ERROR_NONE) {
-      REPORT_INNER_ERR_MSG("E19999", "Call rtQueueSubscribe fail, ret: 0x%X", static_cast<uint32_t>(ret));
-      GELOGE(RT_FAILED, "[DequeueSubscribe] failed, rt_err = %d, queue id = %d", ret, queue_id);
-      return RT_ERROR_TO_GE_STATUS(ret);
-    }
-    GELOGI("[DequeueSubscribe] ended successfully, queue id = %u", queue_id);
+Status HeterogeneousExchangeService::EnsureDequeueSubscribed(const int32_t device_id, const uint32_t queue_id,
+                                                             std::shared_ptr<QueueEventState> &state) {
+  std::lock_guard<std::mutex> lk(dequeue_mu_);
+  const auto it = subscribed_dequeues_.find(queue_id);
+  if (it != subscribed_dequeues_.cend()) {
+    state = it->second;
+    return SUCCESS;
+  }
+  GELOGI("[DequeueSubscribe] start, queue id = %u", queue_id);
+  auto ret = rtQueueSubscribe(device_id, queue_id, kEventGroupId, kRtQueueTypeSingle);
+  if (ret != RT_ERROR_NONE) {
+    REPORT_INNER_ERR_MSG("E19999", "Call rtQueueSubscribe fail, ret: 0x%X", static_cast<uint32_t>(ret));
+    GELOGE(RT_FAILED, "[DequeueSubscribe] failed, rt_err = %d, queue id = %d", ret, queue_id);
+    return RT_ERROR_TO_GE_STATUS(ret);
   }
-  subscribed_dequeues_[queue_id] = false;
+  state = MakeShared<QueueEventState>();
+  GE_CHECK_NOTNULL(state);
+  subscribed_dequeues_[queue_id] = state;
+  GELOGI("[DequeueSubscribe] ended successfully, queue id = %u", queue_id);
   return SUCCESS;
 }
 
@@ -850,41 +862,56 @@ Status HeterogeneousExchangeService::EnqueueMbufToClientQueue(int32_t device_id,
 
 Status HeterogeneousExchangeService::EnqueueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t m_buf,
                                                  int32_t timeout) {
-  GE_CHK_STATUS_RET(SetTransId(device_id, queue_id, m_buf), "Set mbuf trans id failed, device_id = %d, queue_id = %u",
-                    device_id, queue_id);
+  size_t enqueued_num = 0U;
+  return DoEnqueueMbufs(device_id, queue_id, &m_buf, 1U, timeout, enqueued_num);
+}
+
+Status HeterogeneousExchangeService::EnqueueMbufs(int32_t device_id, uint32_t queue_id,
+                                                  const std::vector<rtMbufPtr_t> &m_bufs, int32_t timeout,
+                                                  size_t &enqueued_num) {
+  enqueued_num = 0U;
+  if (m_bufs.empty()) {
+    return SUCCESS;
+  }
+  return DoEnqueueMbufs(device_id, queue_id, m_bufs.data(), m_bufs.size(), timeout, enqueued_num);
+}
+
+Status HeterogeneousExchangeService::DoEnqueueMbufs(int32_t device_id, uint32_t queue_id, const rtMbufPtr_t *m_bufs,
+                                                    size_t num, int32_t timeout, size_t &enqueued_num) {
+  enqueued_num = 0U;
+  for (size_t i = 0U; i < num; ++i) {
+    GE_CHK_STATUS_RET(SetTransId(device_id, queue_id, m_bufs[i]),
+                      "Set mbuf trans id failed, device_id = %d, queue_id = %u", device_id, queue_id);
+  }
   if (IsClientQueue(queue_id)) {
-    Status enqueue_ret = EnqueueMbufToClientQueue(device_id, queue_id, m_buf, timeout);
-    if (enqueue_ret == SUCCESS) {
+    for (; enqueued_num < num; ++enqueued_num) {
+      GE_CHK_STATUS_RET_NOLOG(EnqueueMbufToClientQueue(device_id, queue_id, m_bufs[enqueued_num], timeout));
       // enqueue success, take ownership of m_buf
-      GE_CHK_RT(rtMbufFree(m_buf));
+      GE_CHK_RT(rtMbufFree(m_bufs[enqueued_num]));
     }
-    return enqueue_ret;
+    return SUCCESS;
   }
   auto ret = RT_ERROR_NONE;
   GE_CHK_STATUS_RET(InitializeEvents(device_id), "[Enqueue] [Init] failed, device id = %d", device_id);
-  std::unique_lock<std::mutex> lk(enqueue_mu_);
-  GE_CHK_STATUS_RET(EnsureEnqueueSubscribed(device_id, queue_id), "[Enqueue] [Init] failed, queue id = %u", queue_id);
+  std::shared_ptr<QueueEventState> state;
+  GE_CHK_STATUS_RET(EnsureEnqueueSubscribed(device_id, queue_id, state), "[Enqueue] [Init] failed, queue id = %u",
+                    queue_id);
   int32_t left_wait_time = timeout;
-  GELOGD("Enqueue timeout = %d ms.", timeout);
+  GELOGD("Enqueue timeout = %d ms, mbuf num = %zu.", timeout, num);
   const uint64_t begin_time = MsprofSysCycleTime();
-  while (true) {
-    subscribed_enqueues_[queue_id] = false;
-    ret = rtMemQueueEnQueue(device_id, queue_id, m_buf);
+  while (enqueued_num < num) {
+    const uint64_t event_seq = state->event_seq.load();
+    ret = rtMemQueueEnQueue(device_id, queue_id, m_bufs[enqueued_num]);
     if (ret == RT_ERROR_NONE) {
-      GELOGD("[EnqueueMbuf] success, device_id = %d, queue_id = %u", device_id, queue_id);
-      if (ProfilingProperties::Instance().ProfilingTrainingTraceOn()) {
-        (void)gert::GlobalProfilingWrapper::ReportApiInfoModelLevel(
-            begin_time, MsprofSysCycleTime(), GetCurrentTransId(device_id, queue_id),
-            static_cast<uint32_t>(gert::GeProfInfoType::kInputCopy));
-      }
-      return SUCCESS;
+      ++enqueued_num;
+      continue;
     }
     if (ret == ACL_ERROR_RT_QUEUE_FULL) {
       GELOGD("[Enqueue][MBuf] failed, queue is full, device_id = %d, queue_id = %u, left_wait_time = %d", device_id,
              queue_id, left_wait_time);
       // -1 means always wait.
       if ((left_wait_time == -1) || (left_wait_time > 0)) {
-        GE_CHK_STATUS_RET(WaitF2NFEvent(queue_id, lk, left_wait_time), "[Enqueue] Wait f2nf event failed.");
+        GE_CHK_STATUS_RET(WaitF2NFEvent(*state, event_seq, left_wait_time), "[Enqueue] Wait f2nf event failed.");
         continue;
       }
 
@@ -898,18 +925,24 @@ Status HeterogeneousExchangeService::EnqueueMbuf(int32_t device_id, uint32_t que
     }
     GELOGE(RT_FAILED, "[Enqueue][Mbuf] failed, device_id = %d, queue_id = %u, rt_error_code = %d", device_id, queue_id,
            ret);
-    ret = RT_ERROR_TO_GE_STATUS(ret);
-    break;
+    return RT_ERROR_TO_GE_STATUS(ret);
   }
-  return ret;
+  GELOGD("[EnqueueMbuf] success, device_id = %d, queue_id = %u, num = %zu", device_id, queue_id, num);
+  if (ProfilingProperties::Instance().ProfilingTrainingTraceOn()) {
+    (void)gert::GlobalProfilingWrapper::ReportApiInfoModelLevel(
+        begin_time, MsprofSysCycleTime(), GetCurrentTransId(device_id, queue_id),
+        static_cast<uint32_t>(gert::GeProfInfoType::kInputCopy));
+  }
+  return SUCCESS;
 }
 
-Status HeterogeneousExchangeService::WaitF2NFEvent(const uint32_t queue_id, std::unique_lock<std::mutex> &lk,
+Status HeterogeneousExchangeService::WaitF2NFEvent(QueueEventState &state, const uint64_t event_seq,
                                                    int32_t &left_wait_time) {
   int32_t wait_time =
       ((left_wait_time <= 0) || (left_wait_time > kEnqueueInterval)) ? kEnqueueInterval : left_wait_time;
-  if (enqueue_cv_.wait_for(lk, std::chrono::milliseconds(wait_time),
-                           [this, queue_id] { return subscribed_enqueues_[queue_id]; })) {
+  std::unique_lock<std::mutex> lk(state.mu);
+  if (state.cv.wait_for(lk, std::chrono::milliseconds(wait_time),
+                        [&state, event_seq] { return state.event_seq != event_seq; })) {
     GELOGI("[Enqueue] receive f2nf event");
   } else {
     if (left_wait_time >= wait_time) {
@@ -948,66 +981,99 @@ Status HeterogeneousExchangeService::ClientQueueDequeueMbuf(int32_t device_id, u
 
 Status HeterogeneousExchangeService::DequeueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t *m_buf,
                                                  int32_t timeout) {
-  auto ret = RT_ERROR_NONE;
+  GE_CHECK_NOTNULL(m_buf);
+  size_t dequeued_num = 0U;
+  return DoDequeueMbufs(device_id, queue_id, m_buf, 1U, timeout, dequeued_num);
+}
+
+Status HeterogeneousExchangeService::DequeueMbufs(int32_t device_id, uint32_t queue_id, size_t max_num,
+                                                  int32_t timeout, std::vector<rtMbufPtr_t> &m_bufs) {
+  GE_CHK_BOOL_RET_STATUS(max_num > 0U, PARAM_INVALID, "[Dequeue] max num must be > 0, queue_id = %u", queue_id);
+  m_bufs.resize(max_num);
+  size_t dequeued_num = 0U;
+  const Status ret = DoDequeueMbufs(device_id, queue_id, m_bufs.data(), max_num, timeout, dequeued_num);
+  m_bufs.resize(dequeued_num);
+  return ret;
+}
+
+uint64_t HeterogeneousExchangeService::GetMbufTransId(rtMbufPtr_t m_buf) {
+  void *head_buf = nullptr;
+  uint64_t head_size = 0U;
+  const rtError_t get_ret = rtMbufGetPrivInfo(m_buf, &head_buf, &head_size);
+  if ((get_ret == RT_ERROR_NONE) && (head_buf != nullptr) && (head_size >= sizeof(MsgInfo))) {
+    const MsgInfo *const msg_info =
+        PtrToPtr<char_t, MsgInfo>(static_cast<char_t *>(head_buf) + head_size - sizeof(MsgInfo));
+    return msg_info->trans_id;
+  }
+  GELOGW("Dequeue mbuf get trans id failed.");
+  return UINT64_MAX;
+}
+
+Status HeterogeneousExchangeService::DoDequeueMbufs(int32_t device_id, uint32_t queue_id, rtMbufPtr_t *m_bufs,
+                                                    size_t max_num, int32_t timeout, size_t &dequeued_num) {
+  dequeued_num = 0U;
   if (IsClientQueue(queue_id)) {
-    return ClientQueueDequeueMbuf(device_id, queue_id, m_buf, timeout);
+    GE_CHK_STATUS_RET_NOLOG(ClientQueueDequeueMbuf(device_id, queue_id, &m_bufs[0], timeout));
+    // 已取到数据，后续只取队列中现有的
+    for (dequeued_num = 1U; dequeued_num < max_num; ++dequeued_num) {
+      if (ClientQueueDequeueMbuf(device_id, queue_id, &m_bufs[dequeued_num], 0) != SUCCESS) {
+        break;
+      }
+    }
+    return SUCCESS;
   }
+  auto ret = RT_ERROR_NONE;
   GE_CHK_STATUS_RET(InitializeEvents(device_id), "[Dequeue] [Init] failed, device id = %d", device_id);
-  std::unique_lock<std::mutex> lk(dequeue_mu_);
-  GE_CHK_STATUS_RET(EnsureDequeueSubscribed(device_id, queue_id), "[Dequeue] [Init] failed, queue id = %u", queue_id);
+  std::shared_ptr<QueueEventState> state;
+  GE_CHK_STATUS_RET(EnsureDequeueSubscribed(device_id, queue_id, state), "[Dequeue] [Init] failed, queue id = %u",
+                    queue_id);
   int32_t left_wait_time = timeout;
   HeterogeneousProfiler::Instance().RecordHeterogeneousProfilerEvent(ProfilerType::kStartPoint,
                                                                      ProfilerEvent::kMbufDequeue, device_id, queue_id);
   const uint64_t begin_time = MsprofSysCycleTime();
-  while (true) {
-    subscribed_dequeues_[queue_id] = false;
-    ret = rtMemQueueDeQueue(device_id, queue_id, m_buf);
+  while (dequeued_num < max_num) {
+    const uint64_t event_seq = state->event_seq.load();
+    ret = rtMemQueueDeQueue(device_id, queue_id, &m_bufs[dequeued_num]);
     if (ret == RT_ERROR_NONE) {
-      GELOGD("[DequeueMbuf] success, device_id = %d, queue_id = %u", device_id, queue_id);
-      HeterogeneousProfiler::Instance().RecordHeterogeneousProfilerEvent(
-          ProfilerType::kEndPoint, ProfilerEvent::kMbufDequeue, device_id, queue_id);
-      if (!ProfilingProperties::Instance().ProfilingTrainingTraceOn()) {
-        return SUCCESS;
-      }
-      void *head_buf = nullptr;
-      uint64_t head_size = 0U;
-      uint64_t trans_id = UINT64_MAX;
-      GE_CHECK_NOTNULL(m_buf);
-      const rtError_t get_ret = rtMbufGetPrivInfo(*m_buf, &head_buf, &head_size);
-      if ((get_ret == RT_ERROR_NONE) && (head_buf != nullptr) && (head_size >= sizeof(MsgInfo))) {
-        const MsgInfo *const msg_info =
-            PtrToPtr<char_t, MsgInfo>(static_cast<char_t *>(head_buf) + head_size - sizeof(MsgInfo));
-        trans_id = msg_info->trans_id;
-      } else {
-        GELOGW("Dequeue mbuf get trans id failed.");
-      }
-      (void)gert::GlobalProfilingWrapper::ReportApiInfoModelLevel(
-          begin_time, MsprofSysCycleTime(), trans_id, static_cast<uint32_t>(gert::GeProfInfoType::kInputCopy));
-      return SUCCESS;
+      ++dequeued_num;
+      continue;
+    }
+    if (dequeued_num > 0U) {
+      // 已取到数据时不再等待
+      break;
     }
     if (ret == ACL_ERROR_RT_QUEUE_EMPTY) {
       GELOGD("[Dequeue][MBuf] failed, queue is empty, device_id = %d, queue_id = %u, left_wait_time = %dms", device_id,
              queue_id, left_wait_time);
       // -1 means always wait.
       if ((left_wait_time == -1) || (left_wait_time > 0)) {
-        GE_CHK_STATUS_RET(WaitEnqueueEvent(queue_id, lk, left_wait_time), "[Dequeue] Wait enqueue event failed.");
+        GE_CHK_STATUS_RET(WaitEnqueueEvent(queue_id, *state, event_seq, left_wait_time),
+                          "[Dequeue] Wait enqueue event failed.");
         continue;
       }
     }
     GELOGW("[Dequeue][MBuf] timeout, device_id = %d, queue_id = %u, timeout = %d ms, rt_error_code = %d", device_id,
            queue_id, timeout, ret);
-    ret = RT_ERROR_TO_GE_STATUS(ret);
-    break;
+    return RT_ERROR_TO_GE_STATUS(ret);
   }
-  return ret;
+  GELOGD("[DequeueMbuf] success, device_id = %d, queue_id = %u, num = %zu", device_id, queue_id, dequeued_num);
+  HeterogeneousProfiler::Instance().RecordHeterogeneousProfilerEvent(ProfilerType::kEndPoint,
+                                                                     ProfilerEvent::kMbufDequeue, device_id, queue_id);
+  if (ProfilingProperties::Instance().ProfilingTrainingTraceOn()) {
+    (void)gert::GlobalProfilingWrapper::ReportApiInfoModelLevel(
+        begin_time, MsprofSysCycleTime(), GetMbufTransId(m_bufs[0]),
+        static_cast<uint32_t>(gert::GeProfInfoType::kInputCopy));
+  }
+  return SUCCESS;
 }
 
-Status HeterogeneousExchangeService::WaitEnqueueEvent(const uint32_t queue_id, std::unique_lock<std::mutex> &lk,
-                                                      int32_t &left_wait_time) {
+Status HeterogeneousExchangeService::WaitEnqueueEvent(const uint32_t queue_id, QueueEventState &state,
+                                                      const uint64_t event_seq, int32_t &left_wait_time) {
   int32_t wait_time =
       ((left_wait_time <= 0) || (left_wait_time > kDequeueInterval)) ? kDequeueInterval : left_wait_time;
-  if (dequeue_cv_.wait_for(lk, std::chrono::milliseconds(wait_time),
-                           [this, queue_id] { return subscribed_dequeues_[queue_id]; })) {
+  std::unique_lock<std::mutex> lk(state.mu);
+  if (state.cv.wait_for(lk, std::chrono::milliseconds(wait_time),
+                        [&state, event_seq] { return state.event_seq != event_seq; })) {
     GELOGI("[Dequeue] receive enqueue event");
     HeterogeneousProfiler::Instance().RecordHeterogeneousProfilerEvent(ProfilerType::kStartPoint,
                                                                        ProfilerEvent::kMbufDequeue, queue_id);
@@ -11,11 +11,14 @@
 #ifndef RUNTIME_DEPLOY_HETEROGENEOUS_EXCHANGE_SERVICE_H_
 #define RUNTIME_DEPLOY_HETEROGENEOUS_EXCHANGE_SERVICE_H_
 
+#include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <thread>
 #include <condition_variable>
 #include <atomic>
+#include <vector>
 #include "common/thread_pool/thread_pool.h"
 #include "framework/common/runtime_tensor_desc.h"
 #include "dflow/base/deploy/exchange_service.h"
@@ -66,6 +69,12 @@ class HeterogeneousExchangeService : public ExchangeService {
   Status DequeueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t *m_buf, int32_t timeout) override;
   void ResetQueueInfo(const int32_t device_id, const uint32_t queue_id) override;
   Status EnqueueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t m_buf, int32_t timeout) override;
+  // 批量入队：一次加锁和订阅检查后依次入队，队列满时等待满转非满事件再继续，enqueued_num返回已入队(已转移所有权)的个数
+  Status EnqueueMbufs(int32_t device_id, uint32_t queue_id, const std::vector<rtMbufPtr_t> &m_bufs, int32_t timeout,
+                      size_t &enqueued_num);
+  // 批量出队：队列为空时最多等待timeout，取到第一个后不再等待，最多取出max_num个
+  Status DequeueMbufs(int32_t device_id, uint32_t queue_id, size_t max_num, int32_t timeout,
+                      std::vector<rtMbufPtr_t> &m_bufs);
   using ExchangeService::CreateQueue;
   void AddClientQueue(const uint32_t queue_id);
   bool IsClientQueue(const uint32_t queue_id);
@@ -75,6 +84,14 @@ class HeterogeneousExchangeService : public ExchangeService {
   static Status EnqueueMbufToClientQueue(int32_t device_id, uint32_t queue_id, rtMbufPtr_t m_buf, int32_t timeout);
 
  private:
+  // 单个队列的事件等待状态，出入队本身不加锁，只有等待事件时持有该队列的锁，不同队列互不阻塞
+  struct QueueEventState {
+    std::mutex mu;
+    std::condition_variable cv;
+    std::atomic<uint64_t> event_seq{0UL};  // 收到空转非空(满转非满)事件的次数，出入队前记录，等待其变化
+  };
+  using QueueEventStates = std::map<uint32_t, std::shared_ptr<QueueEventState>>;
+
   static Status MoveMbufTo(void *m_buf, const ControlInfo &control_info, std::shared_ptr<AlignedPtr> &aligned_ptr);
   static Status CopyMbufTo(void *m_buf, void *data, size_t size, const ControlInfo &control_info);
   static Status CopyMbufHeadTo(void *m_buf, void *&control_data, size_t &head_size);
@@ -82,12 +99,21 @@ class HeterogeneousExchangeService : public ExchangeService {
   void ProcessF2NFEvent(const uint32_t queue_id);
   void WaitEvents(const int32_t device_id);
   Status InitializeEvents(const int32_t device_id);
-  Status EnsureEnqueueSubscribed(const int32_t device_id, const uint32_t queue_id);
-  Status EnsureDequeueSubscribed(const int32_t device_id, const uint32_t queue_id);
+  Status EnsureEnqueueSubscribed(const int32_t device_id, const uint32_t queue_id,
+                                 std::shared_ptr<QueueEventState> &state);
+  Status EnsureDequeueSubscribed(const int32_t device_id, const uint32_t queue_id,
+                                 std::shared_ptr<QueueEventState> &state);
   static Status CheckResult(void *head_buf, size_t head_size, ControlInfo &control_info);
   static Status UpdateTensorDesc(const RuntimeTensorDesc &runtime_tensor_desc, GeTensorDesc &tensor_desc);
-  Status WaitF2NFEvent(const uint32_t queue_id, std::unique_lock<std::mutex> &lk, int32_t &left_wait_time);
-  Status WaitEnqueueEvent(const uint32_t queue_id, std::unique_lock<std::mutex> &lk, int32_t &left_wait_time);
+  static Status WaitF2NFEvent(QueueEventState &state, const uint64_t event_seq, int32_t &left_wait_time);
+  static Status WaitEnqueueEvent(const uint32_t queue_id, QueueEventState &state, const uint64_t event_seq,
+                                 int32_t &left_wait_time);
+  static void NotifyQueueEvent(std::mutex &mu, const QueueEventStates &states, const uint32_t queue_id);
+  Status DoEnqueueMbufs(int32_t device_id, uint32_t queue_id, const rtMbufPtr_t *m_bufs, size_t num, int32_t timeout,
+                        size_t &enqueued_num);
+  Status DoDequeueMbufs(int32_t device_id, uint32_t queue_id, rtMbufPtr_t *m_bufs, size_t max_num, int32_t timeout,
+                        size_t &dequeued_num);
+  static uint64_t GetMbufTransId(rtMbufPtr_t m_buf);
   static Status InitHeadInfo(const ControlInfo &control_info, rtMbufPtr_t mbuf);
   Status ProcessEnqueueBuff(const int32_t device_id, const uint32_t queue_id, const std::vector<BuffInfo> &buffs,
                             const ControlInfo &control_info);
@@ -109,13 +135,12 @@ class HeterogeneousExchangeService : public ExchangeService {
   std::mutex trans_mu_;
   std::map<TransInfoContext, uint64_t> trans_ids_;
 
+  // dequeue_mu_/enqueue_mu_只保护订阅表的查找和插入
   std::mutex dequeue_mu_;
-  std::condition_variable dequeue_cv_;
-  std::map<uint32_t, bool> subscribed_dequeues_;  // key is qid, true means not empty
+  QueueEventStates subscribed_dequeues_;  // key is qid
 
   std::mutex enqueue_mu_;
-  std::condition_variable enqueue_cv_;
-  std::map<uint32_t, bool> subscribed_enqueues_;  // key is qid, true means not full
+  QueueEventStates subscribed_enqueues_;  // key is qid
 
   std::atomic<bool> waiting_{true};
   std::vector<std::thread> events_threads_;
@@ -9,6 +9,7 @@
  */
 
 #include "deploy/deployer/deploy_context.h"
+#include <cinttypes>
 #include <string>
 #include "common/compile_profiling/ge_call_wrapper.h"
 #include "common/thread_pool/thread_pool.h"
@@ -23,6 +24,7 @@
 #include "deploy/deployer/heterogeneous_model_deployer.h"
 #include "deploy/abnormal_status_handler/device_abnormal_status_handler.h"
 #include "deploy/flowrm/flow_route_manager.h"
+#include "deploy/model_send/weight_stream_sender.h"
 #include "common/data_flow/route/rank_table_builder.h"
 #include "common/utils/rts_api_utils.h"
 #include "graph/utils/tensor_utils.h"
@@ -38,6 +40,19 @@ constexpr size_t kMaxFlowRouteSize = 8 * 1024U;
 
 using HService = HeterogeneousExchangeService;
 
+// mbuf带分片头时has_head为true，并输出分片头与数据地址
+Status GetWeightChunkHead(rtMbufPtr_t m_buf, WeightChunkHead &head, void *&data, bool &has_head) {
+  void *priv_info = nullptr;
+  uint64_t priv_size = 0UL;
+  GE_CHK_RT_RET(rtMbufGetPrivInfo(m_buf, &priv_info, &priv_size));
+  has_head = WeightChunkUtils::ParseHead(priv_info, static_cast<size_t>(priv_size), head);
+  if (has_head) {
+    GE_CHK_RT_RET(rtMbufGetBuffAddr(m_buf, &data));
+    GE_CHECK_NOTNULL(data);
+  }
+  return SUCCESS;
+}
+
 void GetQueueIdsFromAttrs(const std::vector<DeployQueueAttr> &queue_attrs, std::vector<uint32_t> &queue_id) {
   for (const auto attr : queue_attrs) {
     queue_id.emplace_back(attr.queue_id);
@@ -182,8 +197,7 @@ Status DeployContext::GetOrCreateTransferQueue(int32_t device_id, uint32_t &queu
 }
 
 Status DeployContext::ProcessSharedContent(const deployer::SharedContentDescRequest &request,
-                                           const deployer::DeployerResponse &response) {
-  (void)response;
+                                           deployer::DeployerResponse &response) {
   GE_CHK_BOOL_RET_STATUS(request.has_shared_content_desc(), PARAM_INVALID, "Request shared_content_desc is not set");
   GE_CHK_BOOL_RET_STATUS(!request.device_ids().empty(), PARAM_INVALID, "request device id not set");
 
@@ -215,7 +229,12 @@ Status DeployContext::ProcessSharedContent(const deployer::SharedContentDescRequ
   uint64_t total_size = content_desc.total_length();
   uint64_t offset = 0U;
   uint64_t data_offset = 0U;
-  while (offset < total_size) {
+  // 重发请求只携带发送端上一轮校验失败的分片
+  const std::vector<uint64_t> resend_indices(request.resend_chunk_indices().cbegin(),
+                                             request.resend_chunk_indices().cend());
+  WeightChunkChecker chunk_checker(total_size, resend_indices);
+  bool has_chunk_head = false;
+  while (has_chunk_head ? (!chunk_checker.IsFinished()) : (offset < total_size)) {
     rtMbufPtr_t m_buf = nullptr;
     std::vector<DeployQueueAttr> queue_attrs;
     local_route->GetQueueAttrs(queue_attrs);
@@ -228,6 +247,21 @@ Status DeployContext::ProcessSharedContent(const deployer::SharedContentDescRequ
     uint64_t buffer_size = 0U;
     GE_CHK_STATUS_RET_NOLOG(RtsApiUtils::MbufGetBufferSize(m_buf, buffer_size));
     GE_CHK_BOOL_RET_STATUS(buffer_size > 0U, FAILED, "Get buff size is 0.");
+    // 分片头中带有crc，校验失败的分片丢弃并在响应中返回给发送端重发；发送端重新入队产生的重复分片直接丢弃
+    WeightChunkHead chunk_head{};
+    void *chunk_data = nullptr;
+    GE_CHK_STATUS_RET_NOLOG(GetWeightChunkHead(m_buf, chunk_head, chunk_data, has_chunk_head));
+    if (has_chunk_head) {
+      auto check_result = WeightChunkChecker::Result::kAccepted;
+      GE_CHK_STATUS_RET(chunk_checker.Check(chunk_head, chunk_data, buffer_size, check_result),
+                        "Failed to check weight chunk of [%s], queue_id = %u, device_id = %d.",
+                        content_desc.node_name().c_str(), deq_attr.queue_id, deq_attr.device_id);
+      if (check_result != WeightChunkChecker::Result::kAccepted) {
+        continue;
+      }
+      // 重发的分片不连续，按分片头中的偏移写入
+      data_offset = chunk_head.chunk_offset;
+    }
     GE_CHECK_LE(offset, UINT64_MAX - buffer_size);
     offset += buffer_size;
     GELOGD("Dequeue shared content buffer size[%lu] of total size[%lu] from queue[%u] in device id[%d]", buffer_size,
@@ -254,6 +288,47 @@ Status DeployContext::ProcessSharedContent(const deployer::SharedContentDescRequ
     GELOGD("Process shared content successfully, size = %lu, current/total = %lu/%lu", buffer_size, offset, total_size);
   }
   GE_TIMESTAMP_EVENT_END(ReceiveFile, "ReceiveFile");
+  const auto failed_chunks = chunk_checker.GetFailedChunks();
+  if (!failed_chunks.empty()) {
+    GELOGW("%zu weight chunks of [%s] failed crc check, first chunk = %" PRIu64 ", request sender to resend them.",
+           failed_chunks.size(), content_desc.node_name().c_str(), failed_chunks.front());
+    auto desc_response = response.mutable_shared_content_desc_response();
+    GE_CHECK_NOTNULL(desc_response);
+    desc_response->mutable_failed_chunk_indices()->Add(failed_chunks.cbegin(), failed_chunks.cend());
+    return SUCCESS;
+  }
+  // 记录内容摘要，后续内容相同的节点可直接复用
+  for (int32_t device_id : request.device_ids()) {
+    auto var_manager = GetVarManager(device_id, session_id);
+    if (var_manager != nullptr) {
+      var_manager->AddContentDigest(request.content_digest(), content_desc.node_name());
+    }
+  }
+  return SUCCESS;
+}
+
+Status DeployContext::ProcessSharedContentManifest(const deployer::SharedContentManifestRequest &request,
+                                                   deployer::DeployerResponse &response) {
+  auto manifest_response = response.mutable_shared_content_manifest_response();
+  GE_CHECK_NOTNULL(manifest_response);
+  uint32_t index = 0U;
+  for (const auto &item : request.items()) {
+    const auto &content_desc = item.shared_content_desc();
+    deployer::SharedContentHeldItem held_item;
+    for (int32_t device_id : item.device_ids()) {
+      auto var_manager = GetVarManager(device_id, content_desc.session_id());
+      if ((var_manager != nullptr) && var_manager->ReuseSharedContent(item.content_digest(), content_desc)) {
+        held_item.add_device_ids(device_id);
+      }
+    }
+    if (held_item.device_ids_size() > 0) {
+      held_item.set_index(index);
+      *manifest_response->add_held_items() = std::move(held_item);
+    }
+    ++index;
+  }
+  GELOGI("Process shared content manifest successfully, item num = %d, held item num = %d.", request.items_size(),
+         manifest_response->held_items_size());
   return SUCCESS;
 }
 
@@ -88,7 +88,10 @@ class DeployContext {
   Status ProcessMultiVarManager(const deployer::MultiVarManagerRequest &request);
 
   Status ProcessSharedContent(const deployer::SharedContentDescRequest &request,
-                              const deployer::DeployerResponse &response);
+                              deployer::DeployerResponse &response);
+
+  Status ProcessSharedContentManifest(const deployer::SharedContentManifestRequest &request,
+                                      deployer::DeployerResponse &response);
 
   Status ProcessHeartbeat(const deployer::DeployerRequest &request, deployer::DeployerResponse &response);
 
@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "deploy/deployer/deploy_task_scheduler.h"
+#include <algorithm>
+#include <cinttypes>
+#include "common/thread_pool/thread_pool.h"
+#include "base/err_mgr.h"
+#include "graph/ge_local_context.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+
+namespace ge {
+namespace {
+uint64_t GetCostUs(const std::chrono::steady_clock::time_point &start,
+                   const std::chrono::steady_clock::time_point &end) {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+}  // namespace
+
+DeployTaskScheduler::DeployTaskScheduler(const std::string &name, const size_t max_inflight_num)
+    : name_(name), max_inflight_num_(std::max(max_inflight_num, static_cast<size_t>(1UL))) {}
+
+Status DeployTaskScheduler::AddTask(const std::string &phase, const std::string &desc, const TaskFunc &func,
+                                    const std::vector<size_t> &deps, size_t &task_id) {
+  GE_CHK_BOOL_RET_STATUS(func != nullptr, PARAM_INVALID, "[%s] task func of [%s] is null.", name_.c_str(),
+                         desc.c_str());
+  task_id = tasks_.size();
+  Task task;
+  task.phase = phase;
+  task.desc = desc;
+  task.func = func;
+  for (const auto dep : deps) {
+    GE_CHK_BOOL_RET_STATUS(dep < task_id, PARAM_INVALID, "[%s] task[%s] depends on invalid task id[%zu].",
+                           name_.c_str(), desc.c_str(), dep);
+  }
+  for (const auto dep : deps) {
+    tasks_[dep].successors.emplace_back(task_id);
+    ++task.pending_dep_num;
+  }
+  tasks_.emplace_back(std::move(task));
+  return SUCCESS;
+}
+
+Status DeployTaskScheduler::Run() {
+  phase_stats_.clear();
+  if (tasks_.empty()) {
+    return SUCCESS;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  std::deque<size_t> ready_tasks;
+  for (size_t i = 0UL; i < tasks_.size(); ++i) {
+    if (tasks_[i].pending_dep_num == 0UL) {
+      ready_tasks.emplace_back(i);
+    }
+  }
+  std::map<std::string, PhaseTime> phase_times;
+  // 任务在线程池中执行，需要沿用调用线程的上下文
+  const auto ge_context = GetThreadLocalContext();
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  ThreadPool thread_pool("ge_dpl_sch", static_cast<uint32_t>(std::min(max_inflight_num_, tasks_.size())), true);
+  size_t inflight_num = 0UL;
+  size_t finished_num = 0UL;
+  Status ret = SUCCESS;
+  while (finished_num < tasks_.size()) {
+    while ((ret == SUCCESS) && (!ready_tasks.empty()) && (inflight_num < max_inflight_num_)) {
+      const auto task_id = ready_tasks.front();
+      ready_tasks.pop_front();
+      auto fut = thread_pool.commit([this, task_id, &ge_context, &err_msg_ctx]() {
+        error_message::SetErrMgrContext(err_msg_ctx);
+        GetThreadLocalContext() = ge_context;
+        FinishedTask finished_task{task_id, FAILED, std::chrono::steady_clock::now(), {}};
+        finished_task.ret = tasks_[task_id].func();
+        finished_task.end = std::chrono::steady_clock::now();
+        {
+          std::lock_guard<std::mutex> lk(mu_);
+          finished_tasks_.emplace_back(finished_task);
+        }
+        finished_cv_.notify_one();
+      });
+      if (!fut.valid()) {
+        GELOGE(FAILED, "[%s] failed to commit task[%s].", name_.c_str(), tasks_[task_id].desc.c_str());
+        ret = FAILED;
+        break;
+      }
+      ++inflight_num;
+    }
+    // 失败后等已下发的任务都结束
+    if (inflight_num == 0UL) {
+      break;
+    }
+    std::deque<FinishedTask> finished_tasks;
+    {
+      std::unique_lock<std::mutex> lk(mu_);
+      finished_cv_.wait(lk, [this]() { return !finished_tasks_.empty(); });
+      finished_tasks.swap(finished_tasks_);
+    }
+    for (const auto &finished_task : finished_tasks) {
+      --inflight_num;
+      ++finished_num;
+      if ((finished_task.ret != SUCCESS) && (ret == SUCCESS)) {
+        GELOGE(finished_task.ret, "[%s] task[%s] of phase[%s] failed, stop scheduling.", name_.c_str(),
+               tasks_[finished_task.task_id].desc.c_str(), tasks_[finished_task.task_id].phase.c_str());
+        ret = finished_task.ret;
+      }
+      OnTaskFinished(finished_task, ready_tasks, phase_times);
+    }
+  }
+  if ((ret == SUCCESS) && (finished_num < tasks_.size())) {
+    GELOGE(FAILED, "[%s] only %zu of %zu tasks finished.", name_.c_str(), finished_num, tasks_.size());
+    ret = FAILED;
+  }
+  ReportPhaseStats();
+  GEEVENT("[DeployScheduler][%s] finished, task num = %zu, finished num = %zu, max inflight num = %zu, cost = %" PRIu64
+          " us, ret = %u.",
+          name_.c_str(), tasks_.size(), finished_num, max_inflight_num_,
+          GetCostUs(start, std::chrono::steady_clock::now()), ret);
+  return ret;
+}
+
+void DeployTaskScheduler::OnTaskFinished(const FinishedTask &finished_task, std::deque<size_t> &ready_tasks,
+                                         std::map<std::string, PhaseTime> &phase_times) {
+  const auto &task = tasks_[finished_task.task_id];
+  const auto cost_us = GetCostUs(finished_task.start, finished_task.end);
+  GELOGD("[%s] task[%s] of phase[%s] finished, cost = %" PRIu64 " us, ret = %u.", name_.c_str(), task.desc.c_str(),
+         task.phase.c_str(), cost_us, finished_task.ret);
+  auto &stat = phase_stats_[task.phase];
+  const auto it = phase_times.find(task.phase);
+  if (it == phase_times.end()) {
+    phase_times[task.phase] = PhaseTime{finished_task.start, finished_task.end};
+  } else {
+    it->second.first_start = std::min(it->second.first_start, finished_task.start);
+    it->second.last_end = std::max(it->second.last_end, finished_task.end);
+  }
+  const auto &phase_time = phase_times[task.phase];
+  ++stat.task_num;
+  stat.span_us = GetCostUs(phase_time.first_start, phase_time.last_end);
+  stat.total_cost_us += cost_us;
+  stat.max_cost_us = std::max(stat.max_cost_us, cost_us);
+  if (finished_task.ret != SUCCESS) {
+    return;
+  }
+  for (const auto successor : task.successors) {
+    auto &successor_task = tasks_[successor];
+    if (--successor_task.pending_dep_num == 0UL) {
+      ready_tasks.emplace_back(successor);
+    }
+  }
+}
+
+void DeployTaskScheduler::ReportPhaseStats() const {
+  for (const auto &it : phase_stats_) {
+    const auto &stat = it.second;
+    GEEVENT("[DeployScheduler][%s] phase = %s, task num = %zu, span = %" PRIu64 " us, total cost = %" PRIu64
+            " us, max cost = %" PRIu64 " us.",
+            name_.c_str(), it.first.c_str(), stat.task_num, stat.span_us, stat.total_cost_us, stat.max_cost_us);
+  }
+}
+}  // namespace ge
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_RUNTIME_HETEROGENEOUS_DEPLOY_DEPLOYER_DEPLOY_TASK_SCHEDULER_H_
+#define AIR_RUNTIME_HETEROGENEOUS_DEPLOY_DEPLOYER_DEPLOY_TASK_SCHEDULER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "ge/ge_api_error_codes.h"
+
+namespace ge {
+struct DeployPhaseStat {
+  size_t task_num = 0UL;
+  uint64_t span_us = 0UL;        // 阶段内第一个任务开始到最后一个任务结束
+  uint64_t total_cost_us = 0UL;  // 阶段内所有任务耗时之和
+  uint64_t max_cost_us = 0UL;
+};
+
+/**
+ * 部署任务调度器：任务按依赖关系组成DAG，依赖都完成的任务并发执行，同时执行的任务数不超过max_inflight_num。
+ * 任一任务失败后不再调度新任务，等已下发的任务结束后返回第一个失败的错误码。Run只能调用一次。
+ */
+class DeployTaskScheduler {
+ public:
+  using TaskFunc = std::function<Status()>;
+
+  DeployTaskScheduler(const std::string &name, const size_t max_inflight_num);
+  ~DeployTaskScheduler() = default;
+
+  // deps为已添加任务的task_id，只能依赖先添加的任务，因此不会成环
+  Status AddTask(const std::string &phase, const std::string &desc, const TaskFunc &func,
+                 const std::vector<size_t> &deps, size_t &task_id);
+
+  Status Run();
+
+  const std::map<std::string, DeployPhaseStat> &GetPhaseStats() const {
+    return phase_stats_;
+  }
+
+ private:
+  using TimePoint = std::chrono::steady_clock::time_point;
+  struct Task {
+    std::string phase;
+    std::string desc;
+    TaskFunc func;
+    std::vector<size_t> successors;
+    size_t pending_dep_num = 0UL;
+  };
+  struct FinishedTask {
+    size_t task_id;
+    Status ret;
+    TimePoint start;
+    TimePoint end;
+  };
+  struct PhaseTime {
+    TimePoint first_start;
+    TimePoint last_end;
+  };
+
+  void OnTaskFinished(const FinishedTask &finished_task, std::deque<size_t> &ready_tasks,
+                      std::map<std::string, PhaseTime> &phase_times);
+  void ReportPhaseStats() const;
+
+  std::string name_;
+  size_t max_inflight_num_;
+  std::vector<Task> tasks_;
+  std::map<std::string, DeployPhaseStat> phase_stats_;
+  std::mutex mu_;
+  std::condition_variable finished_cv_;
+  std::deque<FinishedTask> finished_tasks_;
+};
+}  // namespace ge
+
+#endif  // AIR_RUNTIME_HETEROGENEOUS_DEPLOY_DEPLOYER_DEPLOY_TASK_SCHEDULER_H_
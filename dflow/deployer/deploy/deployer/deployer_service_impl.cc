@@ -46,6 +46,7 @@ REGISTER_REQUEST_PROCESSOR(deployer::kLoadModel, DeployerServiceImpl::LoadModelP
 REGISTER_REQUEST_PROCESSOR(deployer::kUnloadModel, DeployerServiceImpl::UnloadModelProcess);
 REGISTER_REQUEST_PROCESSOR(deployer::kDownloadVarManager, DeployerServiceImpl::MultiVarManagerInfoProcess);
 REGISTER_REQUEST_PROCESSOR(deployer::kDownloadSharedContent, DeployerServiceImpl::SharedContentProcess);
+REGISTER_REQUEST_PROCESSOR(deployer::kQuerySharedContent, DeployerServiceImpl::SharedContentManifestProcess);
 REGISTER_REQUEST_PROCESSOR(deployer::kTransferFile, DeployerServiceImpl::TransferFileProcess);
 REGISTER_REQUEST_PROCESSOR(deployer::kInitProcessResource, DeployerServiceImpl::InitProcessResourceProcess);
 REGISTER_REQUEST_PROCESSOR(deployer::kHeartbeat, DeployerServiceImpl::HeartbeatProcess);
@@ -122,6 +123,17 @@ void DeployerServiceImpl::SharedContentProcess(DeployContext &context, const dep
   }
 }
 
+void DeployerServiceImpl::SharedContentManifestProcess(DeployContext &context,
+                                                       const deployer::DeployerRequest &request,
+                                                       deployer::DeployerResponse &response) {
+  auto ret = context.ProcessSharedContentManifest(request.shared_content_manifest_request(), response);
+  if (ret != SUCCESS) {
+    GELOGE(FAILED, "Failed to process shared content manifest.");
+    response.set_error_code(FAILED);
+    response.set_error_message("Failed to process shared content manifest.");
+  }
+}
+
 void DeployerServiceImpl::InitProcessResourceProcess(DeployContext &context, const deployer::DeployerRequest &request,
                                                      deployer::DeployerResponse &response) {
   context.InitProcessResource(request.init_process_resource_request(), response);
@@ -110,6 +110,9 @@ class DeployerServiceImpl {
   static void SharedContentProcess(DeployContext &context, const deployer::DeployerRequest &request,
                                    deployer::DeployerResponse &response);
 
+  static void SharedContentManifestProcess(DeployContext &context, const deployer::DeployerRequest &request,
+                                           deployer::DeployerResponse &response);
+
   static void TransferFileProcess(DeployContext &context, const deployer::DeployerRequest &request,
                                   deployer::DeployerResponse &response);
 
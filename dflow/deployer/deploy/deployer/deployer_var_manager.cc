@@ -78,6 +78,41 @@ Status DeployerVarManager::ProcessSharedContent(const deployer::SharedContentDes
   return SUCCESS;
 }
 
+void DeployerVarManager::AddContentDigest(const std::string &content_digest, const std::string &node_name) {
+  if (content_digest.empty() || (shared_content_descs_.count(node_name) == 0U) ||
+      (content_digest_to_node_.size() >= kMaxSharedContentSize)) {
+    return;
+  }
+  (void)content_digest_to_node_.emplace(content_digest, node_name);
+  GELOGD("shared content [%s] added, digest = %s.", node_name.c_str(), content_digest.c_str());
+}
+
+bool DeployerVarManager::ReuseSharedContent(const std::string &content_digest,
+                                            const deployer::SharedContentDescription &shared_content_desc) {
+  const auto digest_it = content_digest_to_node_.find(content_digest);
+  if (content_digest.empty() || (digest_it == content_digest_to_node_.cend())) {
+    return false;
+  }
+  const auto desc_it = shared_content_descs_.find(digest_it->second);
+  if ((desc_it == shared_content_descs_.cend()) ||
+      (desc_it->second.total_length() != shared_content_desc.total_length())) {
+    return false;
+  }
+  const auto &node_name = shared_content_desc.node_name();
+  if ((shared_content_descs_.count(node_name) == 0U) && (shared_content_descs_.size() >= kMaxSharedContentSize)) {
+    return false;
+  }
+  // 内存位置沿用已接收的内容，节点相关的信息使用新节点的
+  auto reused_desc = desc_it->second;
+  reused_desc.set_node_name(node_name);
+  reused_desc.set_mem_type(shared_content_desc.mem_type());
+  *reused_desc.mutable_tensor_desc() = shared_content_desc.tensor_desc();
+  GELOGI("shared content [%s] reuses received content of [%s], size is %lu, digest = %s.", node_name.c_str(),
+         digest_it->second.c_str(), reused_desc.total_length(), content_digest.c_str());
+  shared_content_descs_[node_name] = std::move(reused_desc);
+  return true;
+}
+
 void DeployerVarManager::SetVarManagerInfo(deployer::VarManagerInfo var_manager_info) {
   var_manager_info_ = std::move(var_manager_info);
 }
@@ -29,6 +29,13 @@ class DeployerVarManager {
   Status ProcessSharedContent(const deployer::SharedContentDescription &shared_content_desc, const size_t size,
                               const size_t offset, const uint32_t queue_id);
 
+  // 记录已接收完成的共享内容的内容摘要
+  void AddContentDigest(const std::string &content_digest, const std::string &node_name);
+
+  // 已持有内容摘要相同的共享内容时，新节点直接复用已有的内存，无需再传输
+  bool ReuseSharedContent(const std::string &content_digest,
+                          const deployer::SharedContentDescription &shared_content_desc);
+
   void SetVarManagerInfo(deployer::VarManagerInfo var_manager_info);
 
   const deployer::VarManagerInfo &GetVarManagerInfo() const;
@@ -59,6 +66,7 @@ class DeployerVarManager {
   uint64_t var_mem_size_ = 0;
   bool share_var_mem_ = true;
   std::map<std::string, deployer::SharedContentDescription> shared_content_descs_;
+  std::map<std::string, std::string> content_digest_to_node_;
   deployer::VarManagerInfo var_manager_info_;
   std::vector<rtMbufPtr_t> var_mbuf_vec_;
   std::map<uint64_t, void *> offset_and_var_map_;
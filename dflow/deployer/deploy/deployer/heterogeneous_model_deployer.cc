@@ -52,19 +52,11 @@ Status HeterogeneousModelDeployer::DoDeployModelWithFlow(DeployContext &deploy_c
                          "Failed to build FlowRoutePlan");
   GE_TIMESTAMP_EVENT_END(ResolveFlowRoutePlans, "deploying in ResolveFlowRoutePlans stage");
 
-  // 3. fork executor process and deploy hcom rank table
-  GE_TIMESTAMP_START(DeployDevMaintenanceCfg);
-  GE_CHK_STATUS_RET(FlowModelSender::DeployDevMaintenanceCfg(deploy_state), "Failed to deploy dev cfg");
-  GE_TIMESTAMP_EVENT_END(DeployDevMaintenanceCfg, "deploying in DeployDevMaintenanceCfg stage");
-
-  // 4. distribute models and metadata to each device
-  // 4_1. distribute flow route plan
+  // 3. deploy dev maintenance cfg, then distribute flow route plan and deploy plan to each device
+  // 不同节点之间并发执行，同一节点上按 维测配置 -> FlowRoutePlan -> DeployPlan 的顺序执行
   GE_TIMESTAMP_START(TransferPlan);
-  GE_CHK_BOOL_RET_STATUS(FlowModelSender::TransferFlowRoutePlan(deploy_state) == SUCCESS, FAILED,
-                         "Failed to dispatched FlowRoutePlan");
-  // 4_2. distribute deploy plan
-  GE_CHK_BOOL_RET_STATUS(FlowModelSender::TransferDeployPlan(deploy_state) == SUCCESS, FAILED,
-                         "Failed to dispatched DeployPlan");
+  GE_CHK_BOOL_RET_STATUS(FlowModelSender::TransferPlans(deploy_state) == SUCCESS, FAILED,
+                         "Failed to dispatched FlowRoutePlan and DeployPlan");
   GE_TIMESTAMP_EVENT_END(TransferPlan, "deploying in TransferPlan stage");
 
   // pre-deploy local flow route
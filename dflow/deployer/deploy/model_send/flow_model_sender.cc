@@ -11,24 +11,30 @@
 #include "deploy/model_send/flow_model_sender.h"
 #include <fstream>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
 #include "common/thread_pool/thread_pool.h"
+#include "base/err_mgr.h"
 #include "graph/ge_context.h"
+#include "graph/ge_local_context.h"
 #include "graph/debug/ge_attr_define.h"
 #include "graph/utils/tensor_utils.h"
 #include "common/file_constant_utils/file_constant_utils.h"
 #include "framework/common/framework_types_internal.h"
 #include "deploy/deployer/deployer_proxy.h"
+#include "deploy/deployer/deploy_task_scheduler.h"
 #include "deploy/flowrm/flow_route_planner.h"
 #include "common/data_flow/queue/heterogeneous_exchange_service.h"
 #include "dflow/base/utils/process_utils.h"
 #include "deploy/resource/resource_manager.h"
 #include "deploy/flowrm/flow_route_manager.h"
+#include "deploy/model_send/weight_stream_sender.h"
 #include "deploy/resource/heterogeneous_deploy_planner.h"
 #include "executor/executor_context.h"
 
 namespace ge {
 namespace {
-constexpr int32_t kEnqueueTimeout = 5 * 60 * 1000;  // ms
 // todo:临时方案新增option，待HCCL正式方案上库后删除
 const std::string STATIC_MODEL_ADDR_FIXED = "ge.exec.static_model_addr_fixed";
 constexpr const char *OPTION_MOMORY_POOL_THRESHOLD = "ge.experiment.memory_pool_threshold";
@@ -40,6 +46,8 @@ const std::string kUdfBuildInFuncNamePrefix = "_BuiltIn_";
 const std::string kUdfResourceSubDir = "udf_resource";
 constexpr size_t kMaxTransferPoolSize = 12U;
 constexpr size_t kMaxSerializePoolSize = 8U;
+// 复用节点上_value_sha256时的摘要前缀，其十六进制编码与ComputeDigest不同，以前缀区分两种来源
+const std::string kWeightSha256DigestPrefix = "w_";
 
 const std::unordered_set<string> kTransferOptionsWhiteList{STATIC_MEMORY_POLICY,
                                                            FILE_CONSTANT_PATH,
@@ -147,53 +155,228 @@ Status FlowModelSender::TransferFileConstants(
     const std::map<int32_t, std::map<uint64_t, std::map<OpDescPtr, std::set<int32_t>>>> &node_need_transfer_memory) {
   std::map<std::string, std::string> file_id_to_path;
   GE_CHK_STATUS_RET(FileConstantUtils::GetFileIdToPathMapFromOption(file_id_to_path), "Failed to get file path");
+  // 同一节点的文件常量共用一条传输路由，只能串行发送；不同节点之间并行发送
+  std::vector<int32_t> node_ids;
   for (const auto &it : node_need_transfer_memory) {
-    GELOGI("[VarManager] process shared memory.");
-    auto node_id = it.first;
-    auto session_op_desc_map = it.second;
-    auto dev_iter = device_ids.find(node_id);
-    if (dev_iter == device_ids.end()) {
+    if (device_ids.find(it.first) != device_ids.end()) {
+      node_ids.emplace_back(it.first);
+    }
+  }
+  if (node_ids.empty()) {
+    return SUCCESS;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  std::atomic<uint64_t> transferred_size(0UL);
+  std::atomic<uint64_t> reused_size(0UL);
+  ThreadPool thread_pool("ge_dpl_trfc", node_ids.size() > kMaxTransferPoolSize ? kMaxTransferPoolSize : node_ids.size(),
+                         false);
+  std::vector<std::future<Status>> transfer_futures;
+  const auto ge_context = GetThreadLocalContext();
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  for (const auto node_id : node_ids) {
+    std::future<Status> fut = thread_pool.commit([this, node_id, &device_ids, &node_need_transfer_memory,
+                                                  &file_id_to_path, &transferred_size, &reused_size, &ge_context,
+                                                  &err_msg_ctx]() -> Status {
+      error_message::SetErrMgrContext(err_msg_ctx);
+      GetThreadLocalContext() = ge_context;
+      uint64_t node_transferred_size = 0UL;
+      uint64_t node_reused_size = 0UL;
+      const auto ret = TransferNodeFileConstants(node_id, device_ids.at(node_id), node_need_transfer_memory.at(node_id),
+                                                 file_id_to_path, node_transferred_size, node_reused_size);
+      transferred_size += node_transferred_size;
+      reused_size += node_reused_size;
+      return ret;
+    });
+    GE_CHK_BOOL_RET_STATUS(fut.valid(), FAILED, "Failed to commit file constants transfer task, node_id = %d.",
+                           node_id);
+    transfer_futures.emplace_back(std::move(fut));
+  }
+  Status ret = SUCCESS;
+  for (size_t i = 0U; i < transfer_futures.size(); ++i) {
+    const auto transfer_ret = transfer_futures[i].get();
+    if (transfer_ret != SUCCESS) {
+      GELOGE(transfer_ret, "Failed to transfer file constants, node_id = %d.", node_ids[i]);
+      ret = transfer_ret;
+    }
+  }
+  GE_CHK_STATUS_RET(ret, "Failed to transfer file constants.");
+  const auto cost_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  WeightStreamStat stat;
+  stat.total_length = transferred_size.load();
+  stat.total_cost_us = static_cast<uint64_t>(cost_us.count());
+  GEEVENT("[Transfer][FileConstants] success, node num = %zu, total size = %" PRIu64 ", reused size = %" PRIu64
+          ", cost = %" PRIu64 " us, throughput = %.2f MB/s.",
+          node_ids.size(), stat.total_length, reused_size.load(), stat.total_cost_us, stat.GetThroughput());
+  return SUCCESS;
+}
+
+Status FlowModelSender::GetNodeFileConstants(const int32_t node_id,
+                                             const std::map<OpDescPtr, std::set<int32_t>> &op_desc_map,
+                                             const std::map<std::string, std::string> &file_id_to_path,
+                                             const bool enable_dedup, std::vector<FileConstantInfo> &file_constants) {
+  std::map<std::string, size_t> send_key_to_index;
+  for (const auto &op_it : op_desc_map) {
+    const auto &op_desc = op_it.first;
+    FileConstantInfo file_constant;
+    GE_CHK_STATUS_RET(GetOpFileInfo(op_desc, file_id_to_path, file_constant.file_path, file_constant.offset,
+                                    file_constant.length),
+                      "Failed to get file path");
+    auto send_key = op_desc->GetName() + "_" + file_constant.file_path + "_" + std::to_string(file_constant.offset) +
+                    "_" + std::to_string(file_constant.length) + "_" + std::to_string(node_id);
+    GELOGI("FileConstant[%s] need to transfer to device, device size = %zu, send key = %s.",
+           op_desc->GetName().c_str(), op_it.second.size(), send_key.c_str());
+    // 同名且内容位置相同的文件常量只传输一次，目标device取并集
+    const auto it = send_key_to_index.find(send_key);
+    if (it != send_key_to_index.cend()) {
+      file_constants[it->second].devices.insert(op_it.second.cbegin(), op_it.second.cend());
       continue;
     }
-    for (const auto &session_iter : session_op_desc_map) {
-      auto session_id = session_iter.first;
-      auto op_desc_map = session_iter.second;
-      std::map<std::string, std::set<int32_t>> op_transfer_device_list;
-      for (const auto &op_it : op_desc_map) {
-        const auto &op_desc = op_it.first;
-        std::string file_path;
-        size_t offset = 0U;
-        size_t length = 0U;
-        GE_CHK_STATUS_RET(GetOpFileInfo(op_desc, file_id_to_path, file_path, offset, length),
-                          "Failed to get file path");
-        auto send_key = op_desc->GetName() + "_" + file_path + "_" + std::to_string(offset) + "_" +
-                        std::to_string(length) + "_" + std::to_string(node_id);
-        op_transfer_device_list[send_key].insert(op_it.second.begin(), op_it.second.end());
-        GELOGI("FileConstant[%s] need to transfer to device, device size = %zu, send key = %s.",
-               op_desc->GetName().c_str(), op_it.second.size(), send_key.c_str());
-      }
+    if (enable_dedup) {
+      GE_CHK_STATUS_RET(GetContentDigest(op_desc, file_constant.file_path, file_constant.offset,
+                                         file_constant.length, file_constant.digest),
+                        "Failed to get content digest of file constant[%s].", op_desc->GetName().c_str());
+    }
+    file_constant.op_desc = op_desc;
+    file_constant.devices = op_it.second;
+    send_key_to_index[send_key] = file_constants.size();
+    file_constants.emplace_back(std::move(file_constant));
+  }
+  return SUCCESS;
+}
+
+Status FlowModelSender::GetContentDigest(const OpDescPtr &op_desc, const std::string &file_path, const size_t offset,
+                                         const size_t length, std::string &digest) {
+  // 由Const转换来的文件常量在编译时已对权重计算过SHA-256，直接复用，避免传输前把文件额外完整读一遍
+  const std::string *const weight_sha256 = AttrUtils::GetStr(op_desc, ATTR_NAME_WEIGHT_SHA256);
+  if ((weight_sha256 != nullptr) && (!weight_sha256->empty())) {
+    digest = kWeightSha256DigestPrefix + *weight_sha256 + "_" + std::to_string(length);
+    return SUCCESS;
+  }
+  const auto digest_key = file_path + "_" + std::to_string(offset) + "_" + std::to_string(length);
+  {
+    std::lock_guard<std::mutex> lk(digest_mu_);
+    const auto it = content_digests_.find(digest_key);
+    if (it != content_digests_.cend()) {
+      digest = it->second;
+      return SUCCESS;
+    }
+  }
+  std::unique_ptr<std::istream> input_stream;
+  GE_CHK_STATUS_RET_NOLOG(CreateInputStream(file_path, offset, input_stream));
+  GE_CHK_STATUS_RET_NOLOG(WeightChunkUtils::ComputeDigest(*input_stream, length, digest));
+  std::lock_guard<std::mutex> lk(digest_mu_);
+  content_digests_[digest_key] = digest;
+  return SUCCESS;
+}
+
+Status FlowModelSender::BuildSharedContentDesc(const uint64_t session_id, const OpDescPtr &op_desc,
+                                               const int64_t file_constant_size,
+                                               deployer::SharedContentDescription &shared_content_desc) {
+  auto tensor_desc = op_desc->MutableOutputDesc(0);
+  GE_CHECK_NOTNULL(tensor_desc);
+  rtMemType_t memory_type = RT_MEMORY_HBM;
+  auto mem_type = static_cast<uint32_t>(RT_MEMORY_DEFAULT);
+  if (AttrUtils::GetInt(op_desc, ATTR_OUTPUT_MEMORY_TYPE, mem_type) && (mem_type == 1)) {  // 1: rdma
+    memory_type = RT_MEMORY_RDMA_HBM;
+  }
+  shared_content_desc.set_session_id(session_id);
+  shared_content_desc.set_node_name(op_desc->GetName());
+  shared_content_desc.set_total_length(file_constant_size);
+  shared_content_desc.set_mem_type(memory_type);
+  proto::TensorDescriptor *tensor_desc_proto = shared_content_desc.mutable_tensor_desc();
+  GeTensorSerializeUtils::GeTensorDescAsProto(*tensor_desc, tensor_desc_proto);
+  return SUCCESS;
+}
+
+bool FlowModelSender::QuerySharedContents(const int32_t node_id, const uint64_t session_id,
+                                          const std::vector<FileConstantInfo *> &file_constants,
+                                          uint64_t &reused_size) {
+  deployer::DeployerRequest request;
+  request.set_type(deployer::kQuerySharedContent);
+  auto manifest_request = request.mutable_shared_content_manifest_request();
+  for (const auto file_constant : file_constants) {
+    auto item = manifest_request->add_items();
+    if (BuildSharedContentDesc(session_id, file_constant->op_desc, static_cast<int64_t>(file_constant->length),
+                               *item->mutable_shared_content_desc()) != SUCCESS) {
+      return false;
+    }
+    item->set_content_digest(file_constant->digest);
+    item->mutable_device_ids()->Add(file_constant->devices.cbegin(), file_constant->devices.cend());
+  }
+  deployer::DeployerResponse response;
+  if ((DeployerProxy::GetInstance().SendRequest(node_id, request, response) != SUCCESS) ||
+      (response.error_code() != SUCCESS)) {
+    // 接收端不支持时按原方式全部传输
+    GELOGW("[Query][SharedContent] failed, node_id = %d, error code = %u, error message = %s, transfer all.", node_id,
+           response.error_code(), response.error_message().c_str());
+    return false;
+  }
+  for (const auto &held_item : response.shared_content_manifest_response().held_items()) {
+    if (held_item.index() >= file_constants.size()) {
+      GELOGW("[Query][SharedContent] invalid index[%u], item num = %zu.", held_item.index(), file_constants.size());
+      continue;
+    }
+    auto &file_constant = *file_constants[held_item.index()];
+    for (const auto device_id : held_item.device_ids()) {
+      (void)file_constant.devices.erase(device_id);
+    }
+    if (file_constant.devices.empty()) {
+      reused_size += file_constant.length;
+      GELOGI("FileConstant[%s] is held by node[%d], skip transfer, size = %zu, digest = %s.",
+             file_constant.op_desc->GetName().c_str(), node_id, file_constant.length, file_constant.digest.c_str());
+    }
+  }
+  return true;
+}
+
+Status FlowModelSender::TransferNodeFileConstants(
+    const int32_t node_id, const std::set<int32_t> &device_ids,
+    const std::map<uint64_t, std::map<OpDescPtr, std::set<int32_t>>> &session_op_desc_map,
+    const std::map<std::string, std::string> &file_id_to_path, uint64_t &transferred_size, uint64_t &reused_size) {
+  GELOGI("[VarManager] process shared memory, node_id = %d.", node_id);
+  bool enable_dedup = WeightStreamOption::LoadFromEnv().enable_dedup;
+  for (const auto &session_iter : session_op_desc_map) {
+    auto session_id = session_iter.first;
+    std::vector<FileConstantInfo> file_constants;
+    GE_CHK_STATUS_RET_NOLOG(
+        GetNodeFileConstants(node_id, session_iter.second, file_id_to_path, enable_dedup, file_constants));
+    // 内容相同的文件常量只传输一次，其余的在传输完成后查询，由接收端直接复用
+    std::map<std::string, std::vector<FileConstantInfo *>> digest_to_file_constants;
+    std::vector<FileConstantInfo *> all_file_constants;
+    for (auto &file_constant : file_constants) {
+      all_file_constants.emplace_back(&file_constant);
+      digest_to_file_constants[file_constant.digest].emplace_back(&file_constant);
+    }
+    if (enable_dedup) {
+      enable_dedup = QuerySharedContents(node_id, session_id, all_file_constants, reused_size);
+    }
 
-      for (const auto &op_desc_to_device : op_desc_map) {
-        const auto &op_desc = op_desc_to_device.first;
-        std::string file_path;
-        size_t offset = 0U;
-        size_t length = 0U;
-        GE_CHK_STATUS_RET(GetOpFileInfo(op_desc, file_id_to_path, file_path, offset, length),
-                          "Failed to get file path");
-        auto send_key = op_desc->GetName() + "_" + file_path + "_" + std::to_string(offset) + "_" +
-                        std::to_string(length) + "_" + std::to_string(node_id);
-        ge::ConstGeTensorDescPtr tensor_desc = op_desc->GetOutputDescPtr(0U);
-        GE_CHECK_NOTNULL(tensor_desc);
-
-        SendInfo send_info;
-        send_info.session_id = session_id;
-        send_info.node_id = node_id;
-        send_info.device_ids = std::vector<int32_t>(dev_iter->second.begin(), dev_iter->second.end());
-        std::unique_ptr<std::istream> input_stream;
-        GE_CHK_STATUS_RET_NOLOG(CreateInputStream(file_path, offset, input_stream));
-        GE_CHK_STATUS_RET(
-            CopyOneWeightToTransfer(send_info, *input_stream, length, op_desc, op_transfer_device_list[send_key]),
-            "Failed to send data.");
+    SendInfo send_info;
+    send_info.session_id = session_id;
+    send_info.node_id = node_id;
+    send_info.device_ids = std::vector<int32_t>(device_ids.begin(), device_ids.end());
+    for (auto &file_constant : file_constants) {
+      if (file_constant.devices.empty()) {
+        continue;
+      }
+      std::unique_ptr<std::istream> input_stream;
+      GE_CHK_STATUS_RET_NOLOG(CreateInputStream(file_constant.file_path, file_constant.offset, input_stream));
+      GE_CHK_STATUS_RET(CopyOneWeightToTransfer(send_info, *input_stream, file_constant.length, file_constant.op_desc,
+                                                file_constant.devices, file_constant.digest),
+                        "Failed to send data.");
+      transferred_size += file_constant.length;
+      file_constant.devices.clear();
+      if (!enable_dedup) {
+        continue;
+      }
+      std::vector<FileConstantInfo *> same_content_file_constants;
+      for (const auto same_content : digest_to_file_constants[file_constant.digest]) {
+        if (!same_content->devices.empty()) {
+          same_content_file_constants.emplace_back(same_content);
+        }
+      }
+      if (!same_content_file_constants.empty()) {
+        enable_dedup = QuerySharedContents(node_id, session_id, same_content_file_constants, reused_size);
       }
     }
   }
@@ -201,41 +384,34 @@ Status FlowModelSender::TransferFileConstants(
 }
 
 Status FlowModelSender::TransferWeightWithQ(std::istream &input_stream, int64_t file_constant_size,
-                                            const DeployQueueAttr &queue_attr) const {
-  std::string compress_nodes;
-  size_t used_memory = 0U;
-  size_t copy_len_once = 0U;
-  auto file_size = static_cast<size_t>(file_constant_size);
-  const int64_t kBlockSize = 1024 * 1024 * 10;
-  compress_nodes.reserve(kBlockSize);
-  input_stream.seekg(0, input_stream.end);
-  int64_t stream_size = input_stream.tellg();
-  GE_CHK_BOOL_RET_STATUS(stream_size == file_constant_size, FAILED,
-                         "The file size[%ld] is inconsistent with the specified size[%ld] of tensor dec", stream_size,
+                                            const DeployQueueAttr &queue_attr,
+                                            const WeightStreamSender::ConfirmFunc &confirm) const {
+  GE_CHK_BOOL_RET_STATUS(file_constant_size >= 0, PARAM_INVALID, "Invalid file constant size[%ld].",
+                         file_constant_size);
+  // 从当前位置开始发送，文件常量在文件中的偏移已由CreateInputStream定位
+  const auto begin_pos = input_stream.tellg();
+  (void)input_stream.seekg(0, input_stream.end);
+  const auto end_pos = input_stream.tellg();
+  (void)input_stream.seekg(begin_pos);
+  GE_CHK_BOOL_RET_STATUS((begin_pos >= 0) && (end_pos - begin_pos >= file_constant_size), FAILED,
+                         "The file size[%ld] from offset[%ld] is less than the specified size[%ld] of tensor desc",
+                         static_cast<int64_t>(end_pos - begin_pos), static_cast<int64_t>(begin_pos),
                          file_constant_size);
-  input_stream.seekg(0, input_stream.beg);
 
-  auto &exchange_service = HeterogeneousExchangeService::GetInstance();
-  ExchangeService::ControlInfo control_info{};
-  control_info.timeout = kEnqueueTimeout;
-  while ((!input_stream.eof()) && (used_memory != file_size)) {
-    input_stream.read(&compress_nodes[0], kBlockSize);
-    copy_len_once = input_stream.gcount();
-    if (file_size - used_memory < copy_len_once) {
-      copy_len_once = file_size - used_memory;
-    }
-    used_memory += copy_len_once;
-    GELOGD("Enqueue shared content size[%zu] of total size[%lu] to queue[%u] in device[%d]", copy_len_once,
-           file_constant_size, queue_attr.queue_id, queue_attr.device_id);
-    GE_CHK_STATUS_RET(exchange_service.Enqueue(queue_attr.device_id, queue_attr.queue_id, &compress_nodes[0],
-                                               copy_len_once, control_info),
-                      "Failed to enqueue weight, device_id = %d, queue_id = %d", queue_attr.device_id,
-                      queue_attr.queue_id);
-  }
+  WeightStreamSender sender(HeterogeneousExchangeService::GetInstance(), WeightStreamOption::LoadFromEnv());
+  GE_CHK_STATUS_RET(
+      sender.SendWithConfirm(input_stream, static_cast<uint64_t>(file_constant_size), queue_attr, confirm),
+      "Failed to send weight, device_id = %d, queue_id = %u", queue_attr.device_id, queue_attr.queue_id);
+  const auto &stat = sender.GetStat();
+  GEEVENT("[Transfer][Weight] size = %ld, chunk num = %" PRIu64 ", resend num = %" PRIu64 ", cost = %" PRIu64
+          " us, throughput = %.2f MB/s, queue_id = %u, device_id = %d.",
+          file_constant_size, stat.chunk_num, stat.resend_num, stat.total_cost_us, stat.GetThroughput(),
+          queue_attr.queue_id, queue_attr.device_id);
   return SUCCESS;
 }
 
 Status FlowModelSender::GetOrCreateFlowRoutePlan(const SendInfo &send_info, deployer::FlowRoutePlan &remote_route) {
+  std::lock_guard<std::mutex> lk(plan_mu_);
   auto it = node_id_to_plan_.find(send_info.node_id);
   if (it != node_id_to_plan_.end()) {
     remote_route = it->second;
@@ -255,8 +431,7 @@ Status FlowModelSender::GetOrCreateFlowRoutePlan(const SendInfo &send_info, depl
 
 Status FlowModelSender::CopyOneWeightToTransfer(const SendInfo &send_info, std::istream &input_stream,
                                                 int64_t file_constant_size, const OpDescPtr &op_desc,
-                                                const std::set<int32_t> &devices) {
-  auto session_id = static_cast<int64_t>(send_info.session_id);
+                                                const std::set<int32_t> &devices, const std::string &content_digest) {
   GELOGI("Enter to CopyOneWeightToTransfer, file constant size = %ld", file_constant_size);
 
   deployer::FlowRoutePlan remote_route;
@@ -269,42 +444,38 @@ Status FlowModelSender::CopyOneWeightToTransfer(const SendInfo &send_info, std::
   local_route->GetQueueAttrs(queue_attrs);
   GE_CHK_BOOL_RET_STATUS(queue_attrs.size() >= 1U, FAILED, "Check transfer pre deploy queue size[%zu] failed.",
                          queue_attrs.size());
-  auto f = std::async(std::launch::async, [this, &input_stream, file_constant_size, &queue_attrs]() {
-    GE_CHK_STATUS_RET(TransferWeightWithQ(input_stream, file_constant_size, queue_attrs[0]),
-                      "Failed to transfer weight, file size = %ld.", file_constant_size);
-    return SUCCESS;
-  });
-
-  auto tensor_desc = op_desc->MutableOutputDesc(0);
-  GE_CHECK_NOTNULL(tensor_desc);
-  rtMemType_t memory_type = RT_MEMORY_HBM;
-  auto mem_type = static_cast<uint32_t>(RT_MEMORY_DEFAULT);
-  if (AttrUtils::GetInt(op_desc, ATTR_OUTPUT_MEMORY_TYPE, mem_type) && (mem_type == 1)) {  // 1: rdma
-    memory_type = RT_MEMORY_RDMA_HBM;
-  }
-
   deployer::DeployerRequest request;
   request.set_type(deployer::kDownloadSharedContent);
   auto shared_content_desc_request = request.mutable_shared_content_desc_request();
   GE_CHECK_NOTNULL(shared_content_desc_request);
   shared_content_desc_request->mutable_device_ids()->Add(devices.begin(), devices.end());
   *shared_content_desc_request->mutable_flow_route() = remote_route;
+  shared_content_desc_request->set_content_digest(content_digest);
   auto shared_content_description = shared_content_desc_request->mutable_shared_content_desc();
   GE_CHECK_NOTNULL(shared_content_description);
-  shared_content_description->set_session_id(session_id);
-  shared_content_description->set_node_name(op_desc->GetName());
-  shared_content_description->set_total_length(file_constant_size);
-  shared_content_description->set_mem_type(memory_type);
-  proto::TensorDescriptor *tensor_desc_proto = shared_content_description->mutable_tensor_desc();
-  GeTensorSerializeUtils::GeTensorDescAsProto(*tensor_desc, tensor_desc_proto);
-  deployer::DeployerResponse response;
-  GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(send_info.node_id, request, response),
-                    "[Send] [shared_content] failed.");
-  if ((response.error_code() != SUCCESS) || (f.get() != SUCCESS)) {
-    GELOGE(FAILED, "[CopyOneWeightToTransfer] failed, node_id = %d, error code = %u, error message = %s",
-           send_info.node_id, response.error_code(), response.error_message().c_str());
-    return FAILED;
-  }
+  GE_CHK_STATUS_RET_NOLOG(BuildSharedContentDesc(send_info.session_id, op_desc, file_constant_size,
+                                                 *shared_content_description));
+  // 每轮传输发送一次请求，接收端处理完本轮分片后返回crc校验失败的分片
+  const auto confirm = [&send_info, &request, shared_content_desc_request](const std::vector<uint64_t> &resend_indices,
+                                                                          std::vector<uint64_t> &failed_indices)
+      -> Status {
+    shared_content_desc_request->clear_resend_chunk_indices();
+    shared_content_desc_request->mutable_resend_chunk_indices()->Add(resend_indices.cbegin(), resend_indices.cend());
+    deployer::DeployerResponse response;
+    GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(send_info.node_id, request, response),
+                      "[Send] [shared_content] failed.");
+    if (response.error_code() != SUCCESS) {
+      GELOGE(FAILED, "[CopyOneWeightToTransfer] failed, node_id = %d, error code = %u, error message = %s",
+             send_info.node_id, response.error_code(), response.error_message().c_str());
+      return FAILED;
+    }
+    const auto &failed_chunks = response.shared_content_desc_response().failed_chunk_indices();
+    failed_indices.assign(failed_chunks.cbegin(), failed_chunks.cend());
+    return SUCCESS;
+  };
+  GE_CHK_STATUS_RET(TransferWeightWithQ(input_stream, file_constant_size, queue_attrs[0], confirm),
+                    "Failed to transfer weight, node_id = %d, file size = %ld.", send_info.node_id,
+                    file_constant_size);
   return SUCCESS;
 }
 
@@ -324,12 +495,63 @@ Status FlowModelSender::CreateInputStream(const std::string &constant_file_path,
   return SUCCESS;
 }
 
-Status FlowModelSender::DeployDevMaintenanceCfg(const DeployState &deploy_state) {
+Status FlowModelSender::TransferPlans(const DeployState &deploy_state) {
+  std::map<std::string, std::vector<deployer::SubmodelDesc>> grouped_by_target_device;
+  std::map<std::string, const DeployPlan::DeviceInfo *> devices_used;
+  GE_CHK_STATUS_RET_NOLOG(BuildSubmodelDescs(deploy_state, grouped_by_target_device, devices_used));
+  // 同一节点上按 下发维测配置 -> 下发FlowRoutePlan -> 下发各device的DeployPlan 的顺序执行，不同节点之间并发
+  DeployTaskScheduler scheduler("TransferPlans", kMaxTransferPoolSize);
+  std::map<int32_t, size_t> node_last_tasks;
   for (const auto &it : deploy_state.GetDeployPlan().GetSubmodels()) {
-    auto target_node_id = it.second.device_info.GetNodeId();
-    GE_CHK_STATUS_RET(DownloadDevMaintenanceCfg(target_node_id), "[Download][DevMaintenanceCfg] failed, node_id[%d].",
-                      target_node_id);
+    const auto node_id = it.second.device_info.GetNodeId();
+    if (node_last_tasks.find(node_id) != node_last_tasks.cend()) {
+      continue;
+    }
+    size_t task_id = 0UL;
+    GE_CHK_STATUS_RET_NOLOG(scheduler.AddTask(
+        "DownloadDevMaintenanceCfg", "node_" + std::to_string(node_id),
+        [node_id]() -> Status {
+          GE_CHK_STATUS_RET(DownloadDevMaintenanceCfg(node_id), "[Download][DevMaintenanceCfg] failed, node_id[%d].",
+                            node_id);
+          return SUCCESS;
+        },
+        {}, task_id));
+    node_last_tasks[node_id] = task_id;
+  }
+  for (const auto &it : deploy_state.GetFlowRoutePlansToDeploy()) {
+    const auto node_id = it.first;
+    const auto &flow_route_plan = it.second;
+    std::vector<size_t> deps;
+    const auto last_task_it = node_last_tasks.find(node_id);
+    if (last_task_it != node_last_tasks.cend()) {
+      deps.emplace_back(last_task_it->second);
+    }
+    size_t task_id = 0UL;
+    GE_CHK_STATUS_RET_NOLOG(scheduler.AddTask(
+        "TransferFlowRoutePlan", "node_" + std::to_string(node_id),
+        [&deploy_state, node_id, &flow_route_plan]() -> Status {
+          return TransferFlowRoutePlanToNode(deploy_state, node_id, flow_route_plan);
+        },
+        deps, task_id));
+    node_last_tasks[node_id] = task_id;
+  }
+  for (const auto &it : devices_used) {
+    const auto &target_device = *it.second;
+    std::vector<size_t> deps;
+    const auto last_task_it = node_last_tasks.find(target_device.GetNodeId());
+    if (last_task_it != node_last_tasks.cend()) {
+      deps.emplace_back(last_task_it->second);
+    }
+    auto &submodel_descs = grouped_by_target_device[target_device.GetKey()];
+    size_t task_id = 0UL;
+    GE_CHK_STATUS_RET_NOLOG(scheduler.AddTask(
+        "TransferDeployPlan", target_device.GetDesc(),
+        [&deploy_state, &target_device, &submodel_descs]() -> Status {
+          return TransferDeployPlanToDevice(deploy_state, target_device, submodel_descs);
+        },
+        deps, task_id));
   }
+  GE_CHK_STATUS_RET(scheduler.Run(), "Failed to transfer plans, root_model_id = %u.", deploy_state.GetRootModelId());
   return SUCCESS;
 }
 
@@ -392,23 +614,33 @@ Status FlowModelSender::DeployDevCfg(int32_t dev_id, DeviceDebugConfig::ConfigTy
 
 Status FlowModelSender::SendDatagwSchedInfo(std::map<std::string, const DeployPlan::DeviceInfo *> &datagw_devices_used,
                                             std::map<std::string, deployer::DeployerRequest> &datagw_sched_infos) {
+  // 各device之间没有依赖，并发下发
+  DeployTaskScheduler scheduler("TransferDataGwSchedInfo", kMaxTransferPoolSize);
   for (const auto &it : datagw_devices_used) {
     const auto &target_device = *it.second;
-
-    deployer::DeployerResponse response;
-    GE_CHK_STATUS_RET(
-        DeployerProxy::GetInstance().SendRequest(target_device.GetNodeId(), datagw_sched_infos[it.first], response),
-        "DynamicSched Failed to send request to target_device = %s", target_device.GetDesc().c_str());
-    auto ret = response.error_code();
-    if (ret != SUCCESS) {
-      GELOGE(ret, "DynamicSched [Transfer][Sched info] failed, target_device = %s, request = %s, error_message = %s",
-             target_device.GetDesc().c_str(), datagw_sched_infos[it.first].DebugString().c_str(),
-             response.error_message().c_str());
-      return ret;
-    }
-    GEEVENT("DynamicSched [Transfer][Sched info] success, target_device = %s", target_device.GetDesc().c_str());
+    auto &request = datagw_sched_infos[it.first];
+    size_t task_id = 0UL;
+    GE_CHK_STATUS_RET_NOLOG(scheduler.AddTask(
+        "TransferDataGwSchedInfo", target_device.GetDesc(),
+        [&target_device, &request]() -> Status {
+          deployer::DeployerResponse response;
+          GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(target_device.GetNodeId(), request, response),
+                            "DynamicSched Failed to send request to target_device = %s",
+                            target_device.GetDesc().c_str());
+          auto ret = response.error_code();
+          if (ret != SUCCESS) {
+            GELOGE(ret,
+                   "DynamicSched [Transfer][Sched info] failed, target_device = %s, request = %s, "
+                   "error_message = %s",
+                   target_device.GetDesc().c_str(), request.DebugString().c_str(), response.error_message().c_str());
+            return ret;
+          }
+          GEEVENT("DynamicSched [Transfer][Sched info] success, target_device = %s", target_device.GetDesc().c_str());
+          return SUCCESS;
+        },
+        {}, task_id));
   }
-  return SUCCESS;
+  return scheduler.Run();
 }
 
 Status FlowModelSender::TransferDataGwDeployPlan(DeployState &deploy_state) {
@@ -465,66 +697,58 @@ Status FlowModelSender::TransferDataGwDeployPlan(DeployState &deploy_state) {
   return SendDatagwSchedInfo(datagw_devices_used, datagw_sched_infos);
 }
 
-Status FlowModelSender::TransferDeployPlan(const DeployState &deploy_state) {
-  std::map<std::string, std::vector<deployer::SubmodelDesc>> grouped_by_target_device;
-  std::map<std::string, const DeployPlan::DeviceInfo *> devices_used;
-  GE_CHK_STATUS_RET_NOLOG(BuildSubmodelDescs(deploy_state, grouped_by_target_device, devices_used));
-  for (const auto &it : devices_used) {
-    const auto &target_device = *it.second;
-    const auto *node_info = DeployerProxy::GetInstance().GetNodeInfo(target_device.GetNodeId());
-    GE_CHECK_NOTNULL(node_info);
-    auto &submodel_descs = grouped_by_target_device[target_device.GetKey()];
-    for (const auto &submodel_desc : submodel_descs) {
-      GEEVENT("Model deployment info, model_name = %s, model_type = %s, graph_id = %u, %s, device_id = %d.",
-              submodel_desc.model_name().c_str(), submodel_desc.engine_name().c_str(), deploy_state.GetGraphId(),
-              node_info->DebugString().c_str(), target_device.GetDeviceId());
-    }
+Status FlowModelSender::TransferDeployPlanToDevice(const DeployState &deploy_state,
+                                                   const DeployPlan::DeviceInfo &target_device,
+                                                   std::vector<deployer::SubmodelDesc> &submodel_descs) {
+  const auto *node_info = DeployerProxy::GetInstance().GetNodeInfo(target_device.GetNodeId());
+  GE_CHECK_NOTNULL(node_info);
+  for (const auto &submodel_desc : submodel_descs) {
+    GEEVENT("Model deployment info, model_name = %s, model_type = %s, graph_id = %u, %s, device_id = %d.",
+            submodel_desc.model_name().c_str(), submodel_desc.engine_name().c_str(), deploy_state.GetGraphId(),
+            node_info->DebugString().c_str(), target_device.GetDeviceId());
+  }
 
-    deployer::DeployerRequest request;
-    GE_CHK_STATUS_RET(BuildUpdateDeployPlanRequest(deploy_state, target_device, submodel_descs, request),
-                      "Failed to build request");
-    GEEVENT("[Transfer][DeployPlan] in deploying start, root_model_id = %u, target_device = %s",
-            deploy_state.GetRootModelId(), target_device.GetDesc().c_str());
-    deployer::DeployerResponse response;
-    GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(target_device.GetNodeId(), request, response),
-                      "Failed to send request to target_device = %s", target_device.GetDesc().c_str());
-    auto ret = response.error_code();
-    if (ret != SUCCESS) {
-      GELOGE(ret, "[Transfer][DeployPlan] failed, target_device = %s, request = %s, error_message = %s",
-             target_device.GetDesc().c_str(), request.DebugString().c_str(), response.error_message().c_str());
-      return ret;
-    }
-    GEEVENT("[Transfer][DeployPlan] in deploying success, root_model_id = %u, target_device = %s",
-            deploy_state.GetRootModelId(), target_device.GetDesc().c_str());
+  deployer::DeployerRequest request;
+  GE_CHK_STATUS_RET(BuildUpdateDeployPlanRequest(deploy_state, target_device, submodel_descs, request),
+                    "Failed to build request");
+  GEEVENT("[Transfer][DeployPlan] in deploying start, root_model_id = %u, target_device = %s",
+          deploy_state.GetRootModelId(), target_device.GetDesc().c_str());
+  deployer::DeployerResponse response;
+  GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(target_device.GetNodeId(), request, response),
+                    "Failed to send request to target_device = %s", target_device.GetDesc().c_str());
+  auto ret = response.error_code();
+  if (ret != SUCCESS) {
+    GELOGE(ret, "[Transfer][DeployPlan] failed, target_device = %s, request = %s, error_message = %s",
+           target_device.GetDesc().c_str(), request.DebugString().c_str(), response.error_message().c_str());
+    return ret;
   }
+  GEEVENT("[Transfer][DeployPlan] in deploying success, root_model_id = %u, target_device = %s",
+          deploy_state.GetRootModelId(), target_device.GetDesc().c_str());
   return SUCCESS;
 }
 
-Status FlowModelSender::TransferFlowRoutePlan(const DeployState &deploy_state) {
-  for (const auto &it : deploy_state.GetFlowRoutePlansToDeploy()) {
-    const auto &node_id = it.first;
-    const auto &flow_route_plan = it.second;
-    deployer::DeployerRequest request;
-    request.set_type(deployer::kAddFlowRoutePlan);
-    auto flow_route_plan_request = request.mutable_add_flow_route_plan_request();
-    flow_route_plan_request->set_node_id(node_id);
-    flow_route_plan_request->set_root_model_id(deploy_state.GetRootModelId());
-    *(flow_route_plan_request->mutable_flow_route_plan()) = flow_route_plan;
-
-    GEEVENT("[Transfer][FlowRoutePlan] start, root_model_id = %u, target_node = %d", deploy_state.GetRootModelId(),
-            node_id);
-    deployer::DeployerResponse response;
-    GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(node_id, request, response),
-                      "Failed to send request to target_device = %d", node_id);
-    auto ret = response.error_code();
-    if (ret != SUCCESS) {
-      GELOGE(ret, "[Transfer][FlowRoutePlan] failed, target_node = %d, request = %s, error_message = %s", node_id,
-             request.DebugString().c_str(), response.error_message().c_str());
-      return ret;
-    }
-    GEEVENT("[Transfer][FlowRoutePlan] success, root_model_id = %u, target_node = %d", deploy_state.GetRootModelId(),
-            node_id);
+Status FlowModelSender::TransferFlowRoutePlanToNode(const DeployState &deploy_state, const int32_t node_id,
+                                                    const deployer::FlowRoutePlan &flow_route_plan) {
+  deployer::DeployerRequest request;
+  request.set_type(deployer::kAddFlowRoutePlan);
+  auto flow_route_plan_request = request.mutable_add_flow_route_plan_request();
+  flow_route_plan_request->set_node_id(node_id);
+  flow_route_plan_request->set_root_model_id(deploy_state.GetRootModelId());
+  *(flow_route_plan_request->mutable_flow_route_plan()) = flow_route_plan;
+
+  GEEVENT("[Transfer][FlowRoutePlan] start, root_model_id = %u, target_node = %d", deploy_state.GetRootModelId(),
+          node_id);
+  deployer::DeployerResponse response;
+  GE_CHK_STATUS_RET(DeployerProxy::GetInstance().SendRequest(node_id, request, response),
+                    "Failed to send request to target_device = %d", node_id);
+  auto ret = response.error_code();
+  if (ret != SUCCESS) {
+    GELOGE(ret, "[Transfer][FlowRoutePlan] failed, target_node = %d, request = %s, error_message = %s", node_id,
+           request.DebugString().c_str(), response.error_message().c_str());
+    return ret;
   }
+  GEEVENT("[Transfer][FlowRoutePlan] success, root_model_id = %u, target_node = %d", deploy_state.GetRootModelId(),
+          node_id);
   return SUCCESS;
 }
 
@@ -12,11 +12,13 @@
 #define AIR_RUNTIME_HETEROGENEOUS_DEPLOY_MODEL_SEND_FLOW_MODEL_SENDER_H_
 
 #include <map>
+#include <mutex>
 #include "proto/deployer.pb.h"
 #include "ge_common/ge_common_api_types.h"
 #include "dflow/base/deploy/deploy_planner.h"
 #include "common/config/device_debug_config.h"
 #include "deploy/deployer/deploy_state.h"
+#include "deploy/model_send/weight_stream_sender.h"
 
 namespace ge {
 class FlowModelSender {
@@ -24,11 +26,8 @@ class FlowModelSender {
   FlowModelSender() = default;
   ~FlowModelSender();
 
-  static Status DeployDevMaintenanceCfg(const DeployState &deploy_state);
-
-  static Status TransferDeployPlan(const DeployState &deploy_state);
-
-  static Status TransferFlowRoutePlan(const DeployState &deploy_state);
+  // 按节点并发下发维测配置、FlowRoutePlan和DeployPlan，同一节点上保持原有先后顺序
+  static Status TransferPlans(const DeployState &deploy_state);
 
   static Status TransferSubmodels(DeployState &deploy_state);
 
@@ -46,6 +45,15 @@ class FlowModelSender {
     std::vector<int32_t> device_ids;
   };
 
+  struct FileConstantInfo {
+    OpDescPtr op_desc;
+    std::string file_path;
+    size_t offset = 0U;
+    size_t length = 0U;
+    std::string digest;
+    std::set<int32_t> devices;  // 还需要传输的device
+  };
+
   static Status GetDeviceInfo(int32_t node_id, int32_t device_id, int32_t device_type,
                               DeployPlan::DeviceInfo &deploy_device_info);
 
@@ -66,10 +74,32 @@ class FlowModelSender {
       const std::map<int32_t, std::map<uint64_t, std::map<OpDescPtr, std::set<int32_t>>>> &node_need_transfer_memory);
 
   Status CopyOneWeightToTransfer(const SendInfo &send_info, std::istream &input_stream, int64_t file_constant_size,
-                                 const OpDescPtr &op_desc, const std::set<int32_t> &devices);
+                                 const OpDescPtr &op_desc, const std::set<int32_t> &devices,
+                                 const std::string &content_digest = "");
+
+  Status TransferNodeFileConstants(
+      int32_t node_id, const std::set<int32_t> &device_ids,
+      const std::map<uint64_t, std::map<OpDescPtr, std::set<int32_t>>> &session_op_desc_map,
+      const std::map<std::string, std::string> &file_id_to_path, uint64_t &transferred_size, uint64_t &reused_size);
+
+  Status GetNodeFileConstants(int32_t node_id, const std::map<OpDescPtr, std::set<int32_t>> &op_desc_map,
+                              const std::map<std::string, std::string> &file_id_to_path, bool enable_dedup,
+                              std::vector<FileConstantInfo> &file_constants);
+
+  // 优先复用编译时打在节点上的权重SHA-256，没有时读取文件内容计算
+  Status GetContentDigest(const OpDescPtr &op_desc, const std::string &file_path, size_t offset, size_t length,
+                          std::string &digest);
+
+  // 查询接收端已持有的内容，并从file_constants中去掉无需传输的device；接收端不支持时返回false
+  static bool QuerySharedContents(int32_t node_id, uint64_t session_id,
+                                  const std::vector<FileConstantInfo *> &file_constants, uint64_t &reused_size);
+
+  static Status BuildSharedContentDesc(uint64_t session_id, const OpDescPtr &op_desc, int64_t file_constant_size,
+                                       deployer::SharedContentDescription &shared_content_desc);
 
-  Status TransferWeightWithQ(std::istream &input_stream, int64_t file_constant_size,
-                             const DeployQueueAttr &queue_attr) const;
+  // confirm在发送的同时等待接收端处理结果，接收端返回crc校验失败的分片时只重发这些分片
+  Status TransferWeightWithQ(std::istream &input_stream, int64_t file_constant_size, const DeployQueueAttr &queue_attr,
+                             const WeightStreamSender::ConfirmFunc &confirm) const;
 
   static Status CreateInputStream(const std::string &constant_file_path, size_t offset,
                                   std::unique_ptr<std::istream> &in_stream);
@@ -89,6 +119,11 @@ class FlowModelSender {
   static Status BuildSubmodelDescs(const DeployState &deploy_state,
                                    std::map<std::string, std::vector<deployer::SubmodelDesc>> &submodel_descs,
                                    std::map<std::string, const DeployPlan::DeviceInfo *> &devices_used);
+  static Status TransferDeployPlanToDevice(const DeployState &deploy_state,
+                                           const DeployPlan::DeviceInfo &target_device,
+                                           std::vector<deployer::SubmodelDesc> &submodel_descs);
+  static Status TransferFlowRoutePlanToNode(const DeployState &deploy_state, const int32_t node_id,
+                                            const deployer::FlowRoutePlan &flow_route_plan);
 
   Status GetOrCreateFlowRoutePlan(const SendInfo &send_info, deployer::FlowRoutePlan &remote_route);
 
@@ -98,7 +133,10 @@ class FlowModelSender {
                               std::string &file_path, size_t &offset, size_t &length);
   static Status SendDatagwSchedInfo(std::map<std::string, const DeployPlan::DeviceInfo *> &datagw_devices_used,
                                     std::map<std::string, deployer::DeployerRequest> &datagw_sched_infos);
+  std::mutex plan_mu_;
   std::map<int32_t, deployer::FlowRoutePlan> node_id_to_plan_;
+  std::mutex digest_mu_;
+  std::map<std::string, std::string> content_digests_;
   DeployPlan::DeviceInfo head_device_;
 };
 }  // namespace ge
@@ -0,0 +1,542 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "deploy/model_send/weight_stream_sender.h"
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <memory>
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+#include <openssl/evp.h>
+#include "securec.h"
+#include "base/err_mgr.h"
+#include "framework/common/debug/ge_log.h"
+#include "framework/common/debug/log.h"
+
+namespace ge {
+namespace {
+constexpr uint32_t kWeightChunkMagic = 0x5747484BU;  // "WGHK"
+constexpr uint32_t kWeightChunkVersion = 1U;
+// CRC32C(Castagnoli)，x86的SSE4.2与ARMv8的CRC扩展都有对应指令
+constexpr uint32_t kCrc32Polynomial = 0x82F63B78U;
+constexpr size_t kCrc32SliceNum = 8UL;
+constexpr size_t kMinChunkSize = 64UL * 1024UL;
+constexpr uint64_t kBytesPerMb = 1024UL * 1024UL;
+constexpr const char_t *kEnvChunkSize = "GE_WEIGHT_STREAM_CHUNK_SIZE";  // MB
+constexpr const char_t *kEnvReadAheadNum = "GE_WEIGHT_STREAM_READ_AHEAD_NUM";
+constexpr const char_t *kEnvDedup = "GE_WEIGHT_STREAM_DEDUP";  // 为0时关闭
+constexpr size_t kDigestBlockSize = 1024UL * 1024UL;
+
+// 不支持crc指令时使用slicing-by-8查表，每次处理8字节
+class Crc32Table {
+ public:
+  static const Crc32Table &Instance() {
+    static const Crc32Table table;
+    return table;
+  }
+  uint32_t values[kCrc32SliceNum][256U];
+
+ private:
+  Crc32Table() {
+    for (uint32_t i = 0U; i < 256U; ++i) {
+      uint32_t crc = i;
+      for (int32_t bit = 0; bit < 8; ++bit) {
+        crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ kCrc32Polynomial) : (crc >> 1U);
+      }
+      values[0U][i] = crc;
+    }
+    for (size_t slice = 1UL; slice < kCrc32SliceNum; ++slice) {
+      for (uint32_t i = 0U; i < 256U; ++i) {
+        const uint32_t prev = values[slice - 1UL][i];
+        values[slice][i] = (prev >> 8U) ^ values[0U][prev & 0xFFU];
+      }
+    }
+  }
+};
+
+inline uint32_t LoadLittleEndian32(const uint8_t *const data) {
+  return static_cast<uint32_t>(data[0U]) | (static_cast<uint32_t>(data[1U]) << 8U) |
+         (static_cast<uint32_t>(data[2U]) << 16U) | (static_cast<uint32_t>(data[3U]) << 24U);
+}
+
+uint64_t GetCostUs(const std::chrono::steady_clock::time_point &start) {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+uint32_t Crc32BySoftware(const uint8_t *ptr, size_t left, uint32_t crc) {
+  const auto &table = Crc32Table::Instance().values;
+  while (left >= kCrc32SliceNum) {
+    const uint32_t low = LoadLittleEndian32(ptr) ^ crc;
+    const uint32_t high = LoadLittleEndian32(ptr + 4U);
+    crc = table[7U][low & 0xFFU] ^ table[6U][(low >> 8U) & 0xFFU] ^ table[5U][(low >> 16U) & 0xFFU] ^
+          table[4U][low >> 24U] ^ table[3U][high & 0xFFU] ^ table[2U][(high >> 8U) & 0xFFU] ^
+          table[1U][(high >> 16U) & 0xFFU] ^ table[0U][high >> 24U];
+    ptr += kCrc32SliceNum;
+    left -= kCrc32SliceNum;
+  }
+  while (left > 0UL) {
+    crc = (crc >> 8U) ^ table[0U][(crc ^ *ptr) & 0xFFU];
+    ++ptr;
+    --left;
+  }
+  return crc;
+}
+
+#if defined(__x86_64__)
+__attribute__((target("sse4.2"))) uint32_t Crc32ByHardware(const uint8_t *ptr, size_t left, uint32_t crc) {
+  uint64_t crc64 = crc;
+  while (left >= sizeof(uint64_t)) {
+    uint64_t value = 0UL;
+    (void)std::memcpy(&value, ptr, sizeof(value));
+    crc64 = _mm_crc32_u64(crc64, value);
+    ptr += sizeof(uint64_t);
+    left -= sizeof(uint64_t);
+  }
+  crc = static_cast<uint32_t>(crc64);
+  while (left > 0UL) {
+    crc = _mm_crc32_u8(crc, *ptr);
+    ++ptr;
+    --left;
+  }
+  return crc;
+}
+
+bool IsCrc32HardwareSupported() {
+  static const bool is_supported = (__builtin_cpu_supports("sse4.2") != 0);
+  return is_supported;
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+uint32_t Crc32ByHardware(const uint8_t *ptr, size_t left, uint32_t crc) {
+  while (left >= sizeof(uint64_t)) {
+    uint64_t value = 0UL;
+    (void)std::memcpy(&value, ptr, sizeof(value));
+    crc = __crc32cd(crc, value);
+    ptr += sizeof(uint64_t);
+    left -= sizeof(uint64_t);
+  }
+  while (left > 0UL) {
+    crc = __crc32cb(crc, *ptr);
+    ++ptr;
+    --left;
+  }
+  return crc;
+}
+
+bool IsCrc32HardwareSupported() {
+  return true;
+}
+#else
+uint32_t Crc32ByHardware(const uint8_t *ptr, size_t left, uint32_t crc) {
+  return Crc32BySoftware(ptr, left, crc);
+}
+
+bool IsCrc32HardwareSupported() {
+  return false;
+}
+#endif
+
+size_t GetEnvSize(const char_t *const env_name, const size_t default_value) {
+  const char_t *const env_value = std::getenv(env_name);
+  if (env_value == nullptr) {
+    return default_value;
+  }
+  const auto value = std::strtoull(env_value, nullptr, 10);
+  return (value == 0ULL) ? default_value : static_cast<size_t>(value);
+}
+}  // namespace
+
+WeightStreamOption WeightStreamOption::LoadFromEnv() {
+  WeightStreamOption option;
+  option.chunk_size = std::max(GetEnvSize(kEnvChunkSize, option.chunk_size / kBytesPerMb) * kBytesPerMb,
+                               kMinChunkSize);
+  option.read_ahead_num = GetEnvSize(kEnvReadAheadNum, option.read_ahead_num);
+  const char_t *const dedup_env = std::getenv(kEnvDedup);
+  option.enable_dedup = (dedup_env == nullptr) || (std::strcmp(dedup_env, "0") != 0);
+  GELOGI("[WeightStream] chunk size = %zu, read ahead num = %zu, enable dedup = %d.", option.chunk_size,
+         option.read_ahead_num, static_cast<int32_t>(option.enable_dedup));
+  return option;
+}
+
+double WeightStreamStat::GetThroughput() const {
+  if (total_cost_us == 0UL) {
+    return 0.0;
+  }
+  return (static_cast<double>(total_length) / static_cast<double>(kBytesPerMb)) /
+         (static_cast<double>(total_cost_us) / 1000000.0);
+}
+
+uint32_t WeightChunkUtils::Crc32(const void *const data, const size_t size, const uint32_t init_crc) {
+  const auto *const ptr = static_cast<const uint8_t *>(data);
+  const uint32_t crc = IsCrc32HardwareSupported() ? Crc32ByHardware(ptr, size, ~init_crc)
+                                                  : Crc32BySoftware(ptr, size, ~init_crc);
+  return ~crc;
+}
+
+void WeightChunkUtils::FillHead(const WeightChunkHead &head, ExchangeService::ControlInfo &control_info) {
+  (void)memcpy_s(control_info.user_data, sizeof(control_info.user_data), &head, sizeof(head));
+}
+
+bool WeightChunkUtils::ParseHead(const void *const user_data, const size_t size, WeightChunkHead &head) {
+  if ((user_data == nullptr) || (size < sizeof(WeightChunkHead))) {
+    return false;
+  }
+  if (memcpy_s(&head, sizeof(head), user_data, sizeof(head)) != EOK) {
+    return false;
+  }
+  return (head.magic == kWeightChunkMagic) && (head.version == kWeightChunkVersion);
+}
+
+Status WeightChunkUtils::ComputeDigest(std::istream &input_stream, const uint64_t length, std::string &digest) {
+  const auto begin_pos = input_stream.tellg();
+  GE_CHK_BOOL_RET_STATUS(begin_pos >= 0, FAILED, "Failed to get position of input stream.");
+  // 接收端以摘要相同作为内容相同直接复用，需使用抗碰撞的SHA-256
+  const std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> md_ctx(EVP_MD_CTX_new(), &EVP_MD_CTX_free);
+  GE_CHK_BOOL_RET_STATUS(md_ctx != nullptr, FAILED, "Failed to create digest context.");
+  GE_CHK_BOOL_RET_STATUS(EVP_DigestInit_ex(md_ctx.get(), EVP_sha256(), nullptr) == 1, FAILED,
+                         "Failed to init sha256.");
+  std::string buffer(static_cast<size_t>(std::min(length, static_cast<uint64_t>(kDigestBlockSize))), '\0');
+  uint64_t left = length;
+  while (left > 0UL) {
+    const auto read_len = static_cast<size_t>(std::min(left, static_cast<uint64_t>(buffer.size())));
+    (void)input_stream.read(&buffer[0U], static_cast<std::streamsize>(read_len));
+    GE_CHK_BOOL_RET_STATUS(static_cast<size_t>(input_stream.gcount()) == read_len, FAILED,
+                           "Failed to read input stream, expect size = %zu, read size = %ld.", read_len,
+                           static_cast<int64_t>(input_stream.gcount()));
+    GE_CHK_BOOL_RET_STATUS(EVP_DigestUpdate(md_ctx.get(), buffer.data(), read_len) == 1, FAILED,
+                           "Failed to update sha256.");
+    left -= read_len;
+  }
+  uint8_t sha256[EVP_MAX_MD_SIZE] = {};
+  uint32_t sha256_len = 0U;
+  GE_CHK_BOOL_RET_STATUS(EVP_DigestFinal_ex(md_ctx.get(), sha256, &sha256_len) == 1, FAILED,
+                         "Failed to finalize sha256.");
+  input_stream.clear();
+  (void)input_stream.seekg(begin_pos);
+  char_t digest_buf[EVP_MAX_MD_SIZE * 2U + 1U] = {};
+  for (size_t i = 0UL; i < sha256_len; ++i) {
+    GE_CHK_BOOL_RET_STATUS(sprintf_s(&digest_buf[i * 2U], sizeof(digest_buf) - (i * 2U), "%02x",
+                                     static_cast<uint32_t>(sha256[i])) > 0,
+                           FAILED, "Failed to format digest.");
+  }
+  digest = std::string(digest_buf) + "_" + std::to_string(length);
+  return SUCCESS;
+}
+
+WeightStreamSender::WeightStreamSender(ExchangeService &exchange_service, const WeightStreamOption &option)
+    : exchange_service_(exchange_service), option_(option) {}
+
+Status WeightStreamSender::Send(std::istream &input_stream, const uint64_t length, const DeployQueueAttr &queue_attr) {
+  GE_CHK_BOOL_RET_STATUS((option_.chunk_size > 0UL) && (option_.read_ahead_num > 0UL), PARAM_INVALID,
+                         "Invalid weight stream option, chunk size = %zu, read ahead num = %zu.", option_.chunk_size,
+                         option_.read_ahead_num);
+  const auto start = std::chrono::steady_clock::now();
+  stat_ = WeightStreamStat{};
+  stat_.total_length = length;
+  filled_chunks_.clear();
+  free_chunks_.clear();
+  read_finished_ = false;
+  aborted_ = false;
+  const auto buffer_size = static_cast<size_t>(std::min(static_cast<uint64_t>(option_.chunk_size), length));
+  const auto chunk_num = (length + option_.chunk_size - 1UL) / option_.chunk_size;
+  free_chunks_.resize(static_cast<size_t>(std::min(static_cast<uint64_t>(option_.read_ahead_num), chunk_num)));
+  for (auto &chunk : free_chunks_) {
+    chunk.buffer.resize(buffer_size);
+  }
+
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  auto read_future = std::async(std::launch::async, [this, &input_stream, length, &err_msg_ctx]() -> Status {
+    error_message::SetErrMgrContext(err_msg_ctx);
+    const auto ret = ReadChunks(input_stream, length);
+    if (ret != SUCCESS) {
+      Abort();
+      return ret;
+    }
+    std::lock_guard<std::mutex> lk(mu_);
+    read_finished_ = true;
+    filled_cv_.notify_one();
+    return SUCCESS;
+  });
+
+  Status enqueue_ret = SUCCESS;
+  Chunk chunk;
+  while (PopFilledChunk(chunk)) {
+    enqueue_ret = EnqueueChunk(chunk, length, queue_attr);
+    if (enqueue_ret != SUCCESS) {
+      Abort();
+      break;
+    }
+    ++stat_.chunk_num;
+    RecycleChunk(std::move(chunk));
+  }
+  const auto read_ret = read_future.get();
+  GE_CHK_STATUS_RET(read_ret, "Failed to read weight, total size = %" PRIu64 ".", length);
+  GE_CHK_STATUS_RET(enqueue_ret, "Failed to enqueue weight, device_id = %d, queue_id = %u.", queue_attr.device_id,
+                    queue_attr.queue_id);
+  GE_CHK_BOOL_RET_STATUS(stat_.chunk_num == chunk_num, FAILED,
+                         "Weight chunk num[%" PRIu64 "] is inconsistent with expected num[%" PRIu64 "].",
+                         stat_.chunk_num, chunk_num);
+  stat_.total_cost_us = GetCostUs(start);
+  GELOGI("[WeightStream] send %" PRIu64 " bytes in %" PRIu64 " chunks to queue[%u] in device[%d], "
+         "read cost = %" PRIu64 " us, enqueue cost = %" PRIu64 " us, total cost = %" PRIu64
+         " us, resend = %" PRIu64 ", throughput = %.2f MB/s.",
+         length, stat_.chunk_num, queue_attr.queue_id, queue_attr.device_id, stat_.read_cost_us,
+         stat_.enqueue_cost_us, stat_.total_cost_us, stat_.resend_num, stat_.GetThroughput());
+  return SUCCESS;
+}
+
+Status WeightStreamSender::SendWithConfirm(std::istream &input_stream, const uint64_t length,
+                                           const DeployQueueAttr &queue_attr, const ConfirmFunc &confirm) {
+  const auto start = std::chrono::steady_clock::now();
+  const auto begin_pos = input_stream.tellg();
+  GE_CHK_BOOL_RET_STATUS(begin_pos >= 0, FAILED, "Failed to get position of input stream.");
+  const auto err_msg_ctx = error_message::GetErrMgrContext();
+  std::vector<uint64_t> resend_indices;
+  for (uint32_t round = 0U;; ++round) {
+    // 接收端在confirm返回前消费本轮的全部分片，入队与confirm需要并行
+    auto send_future = std::async(std::launch::async, [this, &input_stream, begin_pos, length, &queue_attr,
+                                                       &resend_indices, &err_msg_ctx]() -> Status {
+      error_message::SetErrMgrContext(err_msg_ctx);
+      if (resend_indices.empty()) {
+        return Send(input_stream, length, queue_attr);
+      }
+      return Resend(input_stream, begin_pos, length, resend_indices, queue_attr);
+    });
+    std::vector<uint64_t> failed_indices;
+    const auto confirm_ret = confirm(resend_indices, failed_indices);
+    const auto send_ret = send_future.get();
+    GE_CHK_STATUS_RET(send_ret, "Failed to send weight, round = %u, device_id = %d, queue_id = %u.", round,
+                      queue_attr.device_id, queue_attr.queue_id);
+    GE_CHK_STATUS_RET(confirm_ret, "Failed to confirm weight, round = %u, device_id = %d, queue_id = %u.", round,
+                      queue_attr.device_id, queue_attr.queue_id);
+    if (failed_indices.empty()) {
+      break;
+    }
+    GE_CHK_BOOL_RET_STATUS(round < option_.max_resend_times, FAILED,
+                           "%zu weight chunks still failed crc check after resend %u times, first chunk = %" PRIu64
+                           ", device_id = %d, queue_id = %u.",
+                           failed_indices.size(), round, failed_indices.front(), queue_attr.device_id,
+                           queue_attr.queue_id);
+    GELOGW("%zu weight chunks failed crc check on receiver, first chunk = %" PRIu64 ", resend round = %u.",
+           failed_indices.size(), failed_indices.front(), round + 1U);
+    resend_indices = std::move(failed_indices);
+  }
+  input_stream.clear();
+  (void)input_stream.seekg(begin_pos + static_cast<std::streamoff>(length));
+  stat_.total_cost_us = GetCostUs(start);
+  return SUCCESS;
+}
+
+Status WeightStreamSender::Resend(std::istream &input_stream, const std::streampos begin_pos, const uint64_t length,
+                                  const std::vector<uint64_t> &chunk_indices, const DeployQueueAttr &queue_attr) {
+  Chunk chunk;
+  for (const auto index : chunk_indices) {
+    GE_CHK_BOOL_RET_STATUS(index < ((length + option_.chunk_size - 1UL) / option_.chunk_size), PARAM_INVALID,
+                           "Invalid weight chunk[%" PRIu64 "] to resend, total size = %" PRIu64 ".", index, length);
+    chunk.index = index;
+    chunk.offset = index * option_.chunk_size;
+    chunk.length = static_cast<size_t>(std::min(static_cast<uint64_t>(option_.chunk_size), length - chunk.offset));
+    chunk.buffer.resize(chunk.length);
+    input_stream.clear();
+    (void)input_stream.seekg(begin_pos + static_cast<std::streamoff>(chunk.offset));
+    (void)input_stream.read(&chunk.buffer[0U], static_cast<std::streamsize>(chunk.length));
+    GE_CHK_BOOL_RET_STATUS(input_stream.gcount() == static_cast<std::streamsize>(chunk.length), FAILED,
+                           "Failed to read weight chunk[%" PRIu64 "] to resend, offset = %" PRIu64 ", size = %zu.",
+                           index, chunk.offset, chunk.length);
+    chunk.crc = WeightChunkUtils::Crc32(chunk.buffer.data(), chunk.length);
+    ++stat_.resend_num;
+    GELOGW("Resend weight chunk[%" PRIu64 "] which failed crc check, offset = %" PRIu64 ", size = %zu.", index,
+           chunk.offset, chunk.length);
+    GE_CHK_STATUS_RET_NOLOG(EnqueueChunk(chunk, length, queue_attr));
+  }
+  return SUCCESS;
+}
+
+Status WeightStreamSender::ReadChunks(std::istream &input_stream, const uint64_t length) {
+  uint64_t offset = 0UL;
+  uint64_t index = 0UL;
+  while (offset < length) {
+    Chunk chunk;
+    {
+      std::unique_lock<std::mutex> lk(mu_);
+      free_cv_.wait(lk, [this]() { return (!free_chunks_.empty()) || aborted_; });
+      if (aborted_) {
+        return SUCCESS;
+      }
+      chunk = std::move(free_chunks_.back());
+      free_chunks_.pop_back();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const auto read_len = static_cast<size_t>(std::min(static_cast<uint64_t>(option_.chunk_size), length - offset));
+    chunk.buffer.resize(read_len);
+    (void)input_stream.read(&chunk.buffer[0U], static_cast<std::streamsize>(read_len));
+    const auto read_size = input_stream.gcount();
+    GE_CHK_BOOL_RET_STATUS(read_size == static_cast<std::streamsize>(read_len), FAILED,
+                           "Failed to read weight chunk[%" PRIu64 "], offset = %" PRIu64
+                           ", expect size = %zu, read size = %ld.",
+                           index, offset, read_len, static_cast<int64_t>(read_size));
+    chunk.index = index;
+    chunk.offset = offset;
+    chunk.length = read_len;
+    // crc在预读线程中计算，与入队重叠
+    chunk.crc = WeightChunkUtils::Crc32(chunk.buffer.data(), read_len);
+    stat_.read_cost_us += GetCostUs(start);
+    offset += read_len;
+    ++index;
+    std::lock_guard<std::mutex> lk(mu_);
+    filled_chunks_.emplace_back(std::move(chunk));
+    filled_cv_.notify_one();
+  }
+  return SUCCESS;
+}
+
+Status WeightStreamSender::EnqueueChunk(const Chunk &chunk, const uint64_t total_length,
+                                        const DeployQueueAttr &queue_attr) {
+  const auto start = std::chrono::steady_clock::now();
+  WeightChunkHead head{};
+  head.magic = kWeightChunkMagic;
+  head.version = kWeightChunkVersion;
+  head.chunk_index = chunk.index;
+  head.chunk_offset = chunk.offset;
+  head.chunk_length = chunk.length;
+  head.total_length = total_length;
+  head.crc = chunk.crc;
+  ExchangeService::ControlInfo control_info{};
+  control_info.timeout = option_.enqueue_timeout;
+  WeightChunkUtils::FillHead(head, control_info);
+  Status ret = SUCCESS;
+  for (uint32_t times = 0U; times <= option_.max_resend_times; ++times) {
+    if (times > 0U) {
+      ++stat_.resend_num;
+      GELOGW("Resend weight chunk[%" PRIu64 "], offset = %" PRIu64 ", size = %zu, times = %u.", chunk.index,
+             chunk.offset, chunk.length, times);
+    }
+    GELOGD("Enqueue weight chunk[%" PRIu64 "] size[%zu] of total size[%" PRIu64 "] to queue[%u] in device[%d]",
+           chunk.index, chunk.length, total_length, queue_attr.queue_id, queue_attr.device_id);
+    ret = exchange_service_.Enqueue(queue_attr.device_id, queue_attr.queue_id, chunk.buffer.data(), chunk.length,
+                                    control_info);
+    if (ret == SUCCESS) {
+      stat_.enqueue_cost_us += GetCostUs(start);
+      return SUCCESS;
+    }
+  }
+  GELOGE(ret, "Failed to enqueue weight chunk[%" PRIu64 "], offset = %" PRIu64 ", size = %zu, resend times = %u.",
+         chunk.index, chunk.offset, chunk.length, option_.max_resend_times);
+  return ret;
+}
+
+bool WeightStreamSender::PopFilledChunk(Chunk &chunk) {
+  std::unique_lock<std::mutex> lk(mu_);
+  filled_cv_.wait(lk, [this]() { return (!filled_chunks_.empty()) || read_finished_ || aborted_; });
+  if (aborted_ || filled_chunks_.empty()) {
+    return false;
+  }
+  chunk = std::move(filled_chunks_.front());
+  filled_chunks_.pop_front();
+  return true;
+}
+
+void WeightStreamSender::RecycleChunk(Chunk &&chunk) {
+  std::lock_guard<std::mutex> lk(mu_);
+  free_chunks_.emplace_back(std::move(chunk));
+  free_cv_.notify_one();
+}
+
+void WeightStreamSender::Abort() {
+  std::lock_guard<std::mutex> lk(mu_);
+  aborted_ = true;
+  filled_cv_.notify_all();
+  free_cv_.notify_all();
+}
+
+WeightChunkChecker::WeightChunkChecker(const uint64_t total_length, const std::vector<uint64_t> &resend_indices)
+    : total_length_(total_length),
+      is_resend_(!resend_indices.empty()),
+      pending_chunks_(resend_indices.cbegin(), resend_indices.cend()) {}
+
+Status WeightChunkChecker::Check(const WeightChunkHead &head, const void *const data, const size_t size,
+                                 Result &result) {
+  result = Result::kAccepted;
+  if (received_chunks_.count(head.chunk_index) > 0U) {
+    GELOGW("Drop duplicated weight chunk[%" PRIu64 "], offset = %" PRIu64 ", received = %" PRIu64 ".",
+           head.chunk_index, head.chunk_offset, received_length_);
+    result = Result::kDuplicated;
+    return SUCCESS;
+  }
+  const bool is_failed = (failed_chunks_.count(head.chunk_index) > 0U);
+  if (is_resend_) {
+    GE_CHK_BOOL_RET_STATUS((pending_chunks_.count(head.chunk_index) > 0U) || is_failed, FAILED,
+                           "Weight chunk[%" PRIu64 "] offset[%" PRIu64 "] is not expected to be resent.",
+                           head.chunk_index, head.chunk_offset);
+  } else if (!is_failed) {
+    // 首次传输按顺序入队，校验失败分片的重复入队除外
+    GE_CHK_BOOL_RET_STATUS(
+        (head.chunk_index == next_chunk_index_) && (head.chunk_offset == (received_length_ + failed_length_)), FAILED,
+        "Weight chunk is missing, expect chunk[%" PRIu64 "] offset[%" PRIu64 "], but got chunk[%" PRIu64
+        "] offset[%" PRIu64 "].",
+        next_chunk_index_, received_length_ + failed_length_, head.chunk_index, head.chunk_offset);
+  }
+  GE_CHK_BOOL_RET_STATUS(head.total_length == total_length_, FAILED,
+                         "Weight chunk[%" PRIu64 "] total size[%" PRIu64 "] is inconsistent with expected[%" PRIu64
+                         "].",
+                         head.chunk_index, head.total_length, total_length_);
+  GE_CHK_BOOL_RET_STATUS((head.chunk_length == size) && (head.chunk_offset <= total_length_) &&
+                             (size <= (total_length_ - head.chunk_offset)),
+                         FAILED,
+                         "Weight chunk[%" PRIu64 "] size[%zu] is invalid, chunk length = %" PRIu64
+                         ", offset/total = %" PRIu64 "/%" PRIu64 ".",
+                         head.chunk_index, size, head.chunk_length, head.chunk_offset, total_length_);
+  (void)pending_chunks_.erase(head.chunk_index);
+  if ((!is_resend_) && (!is_failed)) {
+    ++next_chunk_index_;
+  }
+  const auto crc = WeightChunkUtils::Crc32(data, size);
+  if (crc != head.crc) {
+    GELOGW("Weight chunk[%" PRIu64 "] crc check failed, offset = %" PRIu64
+           ", size = %zu, expect crc = 0x%08X, actual crc = 0x%08X, wait for resending.",
+           head.chunk_index, head.chunk_offset, size, head.crc, crc);
+    if (!is_failed) {
+      failed_chunks_[head.chunk_index] = size;
+      failed_length_ += size;
+    }
+    result = Result::kCorrupted;
+    return SUCCESS;
+  }
+  if (is_failed) {
+    (void)failed_chunks_.erase(head.chunk_index);
+    failed_length_ -= size;
+  }
+  (void)received_chunks_.insert(head.chunk_index);
+  received_length_ += size;
+  return SUCCESS;
+}
+
+bool WeightChunkChecker::IsFinished() const {
+  if (is_resend_) {
+    return pending_chunks_.empty();
+  }
+  return (received_length_ + failed_length_) >= total_length_;
+}
+
+std::vector<uint64_t> WeightChunkChecker::GetFailedChunks() const {
+  std::vector<uint64_t> failed_chunks;
+  for (const auto &failed_chunk : failed_chunks_) {
+    failed_chunks.emplace_back(failed_chunk.first);
+  }
+  return failed_chunks;
+}
+}  // namespace ge
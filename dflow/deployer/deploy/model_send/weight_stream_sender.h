@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_RUNTIME_HETEROGENEOUS_DEPLOY_MODEL_SEND_WEIGHT_STREAM_SENDER_H_
+#define AIR_RUNTIME_HETEROGENEOUS_DEPLOY_MODEL_SEND_WEIGHT_STREAM_SENDER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+#include "dflow/base/deploy/exchange_service.h"
+
+namespace ge {
+// 每个分片的描述写在mbuf私有头的user data中，接收端据此校验、去重，不带该头的mbuf按原有方式处理
+struct WeightChunkHead {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t chunk_index;
+  uint64_t chunk_offset;
+  uint64_t chunk_length;
+  uint64_t total_length;
+  uint32_t crc;
+  uint32_t reserved;
+};
+static_assert(sizeof(WeightChunkHead) <= kMaxUserDataSize, "WeightChunkHead must fit in mbuf user data");
+
+struct WeightStreamOption {
+  size_t chunk_size = 10UL * 1024UL * 1024UL;
+  // 预读缓冲个数，读文件与入队之间最多相差read_ahead_num个分片
+  size_t read_ahead_num = 4UL;
+  int32_t enqueue_timeout = 5 * 60 * 1000;  // ms
+  // 单个分片入队失败后的重新入队次数，同时也是接收端crc校验失败后按分片重发的最大轮数
+  uint32_t max_resend_times = 3U;
+  // 传输前按内容摘要查询接收端已持有的文件常量，只传输缺失的
+  bool enable_dedup = true;
+  static WeightStreamOption LoadFromEnv();
+};
+
+struct WeightStreamStat {
+  uint64_t total_length = 0UL;
+  uint64_t chunk_num = 0UL;
+  uint64_t resend_num = 0UL;
+  uint64_t read_cost_us = 0UL;
+  uint64_t enqueue_cost_us = 0UL;
+  uint64_t total_cost_us = 0UL;
+  double GetThroughput() const;  // MB/s
+};
+
+class WeightChunkUtils {
+ public:
+  // CRC32C，init_crc为前一段数据的结果时可分段计算
+  static uint32_t Crc32(const void *const data, const size_t size, const uint32_t init_crc = 0U);
+  static void FillHead(const WeightChunkHead &head, ExchangeService::ControlInfo &control_info);
+  // 不是分片头时返回false
+  static bool ParseHead(const void *const user_data, const size_t size, WeightChunkHead &head);
+  // 从input_stream当前位置开始计算length字节的SHA-256内容摘要，计算完成后恢复读位置
+  static Status ComputeDigest(std::istream &input_stream, const uint64_t length, std::string &digest);
+};
+
+/**
+ * 流式发送一个文件常量：预读线程按分片读文件，调用线程按顺序入队，读盘与传输重叠。
+ * 同一个队列上的分片必须串行发送，多个文件常量并行时需使用不同的队列。
+ */
+class WeightStreamSender {
+ public:
+  // 等待接收端处理完一轮传输，resend_indices为空表示首次传输，failed_indices返回接收端crc校验失败的分片
+  using ConfirmFunc =
+      std::function<Status(const std::vector<uint64_t> &resend_indices, std::vector<uint64_t> &failed_indices)>;
+
+  WeightStreamSender(ExchangeService &exchange_service, const WeightStreamOption &option);
+  ~WeightStreamSender() = default;
+
+  // 从input_stream当前位置开始发送length字节
+  Status Send(std::istream &input_stream, const uint64_t length, const DeployQueueAttr &queue_attr);
+
+  // 发送的同时调用confirm等待接收端确认，只重发接收端校验失败的分片，最多重发max_resend_times轮
+  Status SendWithConfirm(std::istream &input_stream, const uint64_t length, const DeployQueueAttr &queue_attr,
+                         const ConfirmFunc &confirm);
+
+  const WeightStreamStat &GetStat() const {
+    return stat_;
+  }
+
+ private:
+  struct Chunk {
+    std::string buffer;
+    uint64_t index = 0UL;
+    uint64_t offset = 0UL;
+    size_t length = 0UL;
+    uint32_t crc = 0U;
+  };
+
+  Status ReadChunks(std::istream &input_stream, const uint64_t length);
+  Status Resend(std::istream &input_stream, const std::streampos begin_pos, const uint64_t length,
+                const std::vector<uint64_t> &chunk_indices, const DeployQueueAttr &queue_attr);
+  Status EnqueueChunk(const Chunk &chunk, const uint64_t total_length, const DeployQueueAttr &queue_attr);
+  bool PopFilledChunk(Chunk &chunk);
+  void RecycleChunk(Chunk &&chunk);
+  void Abort();
+
+  ExchangeService &exchange_service_;
+  WeightStreamOption option_;
+  WeightStreamStat stat_;
+  std::mutex mu_;
+  std::condition_variable filled_cv_;
+  std::condition_variable free_cv_;
+  std::deque<Chunk> filled_chunks_;
+  std::vector<Chunk> free_chunks_;
+  bool read_finished_ = false;
+  bool aborted_ = false;
+};
+
+/**
+ * 接收端按分片头校验一轮传输：crc校验失败的分片记录下来返回给发送端单独重发，分片缺失时传输失败，
+ * 发送端重新入队产生的重复分片直接丢弃
+ */
+class WeightChunkChecker {
+ public:
+  enum class Result { kAccepted, kDuplicated, kCorrupted };
+
+  // resend_indices为空时校验首次传输的全部分片，否则只接收发送端重发的这些分片
+  explicit WeightChunkChecker(const uint64_t total_length, const std::vector<uint64_t> &resend_indices = {});
+  ~WeightChunkChecker() = default;
+
+  Status Check(const WeightChunkHead &head, const void *const data, const size_t size, Result &result);
+
+  // 本轮的分片均已收到(包括校验失败的)
+  bool IsFinished() const;
+
+  std::vector<uint64_t> GetFailedChunks() const;
+
+  uint64_t GetReceivedLength() const {
+    return received_length_;
+  }
+
+ private:
+  uint64_t total_length_;
+  uint64_t received_length_ = 0UL;
+  uint64_t failed_length_ = 0UL;
+  uint64_t next_chunk_index_ = 0UL;
+  bool is_resend_ = false;
+  std::set<uint64_t> pending_chunks_;
+  std::set<uint64_t> received_chunks_;
+  std::map<uint64_t, uint64_t> failed_chunks_;  // chunk index -> length
+};
+}  // namespace ge
+
+#endif  // AIR_RUNTIME_HETEROGENEOUS_DEPLOY_MODEL_SEND_WEIGHT_STREAM_SENDER_H_
@@ -9,12 +9,33 @@
  */
 
 #include "data_flow_data_aligner.h"
+#include <algorithm>
+#include <limits>
 #include "securec.h"
 #include "common/checker.h"
 #include "graph_metadef/common/ge_common/util.h"
+#include "common/plugin/ge_make_unique_util.h"
 #include "data_flow_info_utils.h"
 
 namespace ge {
+namespace {
+constexpr uint32_t kInvalidIndex = UINT32_MAX;
+constexpr size_t kMinSlotNum = 16UL;
+
+uint64_t MixHash(uint64_t value) {
+  value ^= value >> 33U;
+  value *= 0xFF51AFD7ED558CCDUL;
+  value ^= value >> 33U;
+  value *= 0xC4CEB9FE1A85EC53UL;
+  value ^= value >> 33U;
+  return value;
+}
+
+uint64_t HashKey(const AlignCacheShard::Key &key) {
+  return MixHash(key.first ^ (static_cast<uint64_t>(key.second) * 0x9E3779B97F4A7C15UL));
+}
+}  // namespace
+
 AlignCacheData::~AlignCacheData() {
   for (size_t idx = 0; idx < queue_data_.size(); ++idx) {
     auto &que = queue_data_[idx];
@@ -90,76 +111,244 @@ Status AlignCacheData::Take(std::vector<GeTensor> &data, DataFlowInfo &info) {
   return ret;
 }
 
+size_t AlignCacheShard::FindSlot(const Key &key, const uint64_t hash) const {
+  if (slots_.empty()) {
+    return slots_.size();
+  }
+  const size_t mask = slots_.size() - 1UL;
+  for (size_t slot = hash & mask; slots_[slot] != kInvalidIndex; slot = (slot + 1UL) & mask) {
+    if (entries_[slots_[slot]].key == key) {
+      return slot;
+    }
+  }
+  return slots_.size();
+}
+
+AlignCacheData *AlignCacheShard::Find(const Key &key) const {
+  const size_t slot = FindSlot(key, HashKey(key));
+  return (slot == slots_.size()) ? nullptr : entries_[slots_[slot]].data.get();
+}
+
+AlignCacheData *AlignCacheShard::FindOrAdd(const Key &key, std::atomic<uint64_t> &next_seq,
+                                           std::vector<std::atomic<size_t>> &cache_nums) {
+  const uint64_t hash = HashKey(key);
+  size_t slot = FindSlot(key, hash);
+  if (slot != slots_.size()) {
+    return entries_[slots_[slot]].data.get();
+  }
+  if ((Size() + 1UL) * 2UL > slots_.size()) {
+    Rehash(std::max(kMinSlotNum, slots_.size() * 2UL));
+  }
+  auto data = MakeUnique<AlignCacheData>(cache_nums);
+  if (data == nullptr) {
+    GELOGE(FAILED, "Make unique align cache data failed.");
+    return nullptr;
+  }
+  uint32_t entry_idx = kInvalidIndex;
+  if (free_entries_.empty()) {
+    entry_idx = static_cast<uint32_t>(entries_.size());
+    entries_.emplace_back();
+  } else {
+    entry_idx = free_entries_.back();
+    free_entries_.pop_back();
+  }
+  auto &entry = entries_[entry_idx];
+  entry.key = key;
+  entry.hash = hash;
+  entry.seq = next_seq.fetch_add(1UL, std::memory_order_relaxed);
+  entry.data = std::move(data);
+  entry.prev = tail_;
+  entry.next = kInvalidIndex;
+  if (tail_ == kInvalidIndex) {
+    head_ = entry_idx;
+  } else {
+    entries_[tail_].next = entry_idx;
+  }
+  tail_ = entry_idx;
+
+  const size_t mask = slots_.size() - 1UL;
+  for (slot = hash & mask; slots_[slot] != kInvalidIndex; slot = (slot + 1UL) & mask) {
+  }
+  slots_[slot] = entry_idx;
+  size_.store(Size() + 1UL, std::memory_order_relaxed);
+  return entry.data.get();
+}
+
+void AlignCacheShard::EraseSlot(size_t slot) {
+  const uint32_t entry_idx = slots_[slot];
+  // 线性探测的删除：把后续探测链上的元素前移，避免留下墓碑
+  const size_t mask = slots_.size() - 1UL;
+  slots_[slot] = kInvalidIndex;
+  for (size_t next = (slot + 1UL) & mask; slots_[next] != kInvalidIndex; next = (next + 1UL) & mask) {
+    const size_t home = entries_[slots_[next]].hash & mask;
+    // home在(slot, next]之间时元素无需移动
+    const bool in_range = (slot <= next) ? ((home > slot) && (home <= next)) : ((home > slot) || (home <= next));
+    if (!in_range) {
+      slots_[slot] = slots_[next];
+      slots_[next] = kInvalidIndex;
+      slot = next;
+    }
+  }
+
+  auto &entry = entries_[entry_idx];
+  if (entry.prev == kInvalidIndex) {
+    head_ = entry.next;
+  } else {
+    entries_[entry.prev].next = entry.next;
+  }
+  if (entry.next == kInvalidIndex) {
+    tail_ = entry.prev;
+  } else {
+    entries_[entry.next].prev = entry.prev;
+  }
+  entry.data.reset();
+  free_entries_.emplace_back(entry_idx);
+  size_.store(Size() - 1UL, std::memory_order_relaxed);
+}
+
+void AlignCacheShard::Erase(const Key &key) {
+  const size_t slot = FindSlot(key, HashKey(key));
+  if (slot != slots_.size()) {
+    EraseSlot(slot);
+  }
+}
+
+size_t AlignCacheShard::EraseByTransId(const uint64_t trans_id) {
+  size_t erase_num = 0UL;
+  uint32_t entry_idx = head_;
+  while (entry_idx != kInvalidIndex) {
+    const auto &entry = entries_[entry_idx];
+    const uint32_t next = entry.next;
+    if (entry.key.first == trans_id) {
+      EraseSlot(FindSlot(entry.key, entry.hash));
+      ++erase_num;
+    }
+    entry_idx = next;
+  }
+  return erase_num;
+}
+
+AlignCacheData *AlignCacheShard::GetOldest(Key &key, uint64_t &seq) const {
+  if (head_ == kInvalidIndex) {
+    return nullptr;
+  }
+  const auto &entry = entries_[head_];
+  key = entry.key;
+  seq = entry.seq;
+  return entry.data.get();
+}
+
+void AlignCacheShard::Rehash(const size_t capacity) {
+  slots_.assign(capacity, kInvalidIndex);
+  const size_t mask = capacity - 1UL;
+  for (uint32_t entry_idx = head_; entry_idx != kInvalidIndex; entry_idx = entries_[entry_idx].next) {
+    size_t slot = entries_[entry_idx].hash & mask;
+    while (slots_[slot] != kInvalidIndex) {
+      slot = (slot + 1UL) & mask;
+    }
+    slots_[slot] = entry_idx;
+  }
+}
+
+void AlignCacheShard::Clear() {
+  // 先析构缓存，归还cache_nums计数
+  entries_.clear();
+  free_entries_.clear();
+  slots_.clear();
+  head_ = kInvalidIndex;
+  tail_ = kInvalidIndex;
+  size_.store(0UL, std::memory_order_relaxed);
+}
+
 DataFlowDataAligner::DataFlowDataAligner(const std::vector<uint32_t> &queue_idxes, InputAlignAttrs input_align_attrs,
                                          const CheckIgnoreTransIdFunc &check_ignore_trans_id_func)
     : queue_idxes_(queue_idxes),
       align_attrs_(input_align_attrs),
       check_ignore_trans_id_func_(check_ignore_trans_id_func),
       cache_nums_(queue_idxes.size()) {
+  const auto max_queue_idx = std::max_element(queue_idxes_.cbegin(), queue_idxes_.cend());
+  if (max_queue_idx != queue_idxes_.cend()) {
+    queue_idx_order_.resize(static_cast<size_t>(*max_queue_idx) + 1UL, std::numeric_limits<size_t>::max());
+  }
   for (size_t i = 0; i < queue_idxes_.size(); ++i) {
     queue_idx_order_[queue_idxes_[i]] = i;
   }
 }
 
 DataFlowDataAligner::~DataFlowDataAligner() {
-  std::lock_guard<std::mutex> guard(mt_);
-  if (!wait_align_data_.empty()) {
+  if (GetCacheSize() != 0UL) {
     GELOGW("data aligner has data not aligned, queue index=%s, left data nums=%s", ToString(queue_idxes_).c_str(),
-           ToString(cache_nums_).c_str());
+           ToString(GetCacheNums()).c_str());
   }
 }
 
+AlignCacheShard &DataFlowDataAligner::GetShard(const uint64_t trans_id) {
+  // 高位用于选分片，分片内的哈希表使用低位，二者互不影响
+  return shards_[MixHash(trans_id) >> (64U - kShardBits)];
+}
+
+size_t DataFlowDataAligner::GetCacheSize() const {
+  size_t cache_size = 0UL;
+  for (const auto &shard : shards_) {
+    cache_size += shard.Size();
+  }
+  return cache_size;
+}
+
+std::vector<size_t> DataFlowDataAligner::GetCacheNums() const {
+  std::vector<size_t> cache_nums;
+  cache_nums.reserve(cache_nums_.size());
+  for (const auto &cache_num : cache_nums_) {
+    cache_nums.emplace_back(cache_num.load(std::memory_order_relaxed));
+  }
+  return cache_nums;
+}
+
 Status DataFlowDataAligner::PushAndAlignData(uint32_t queue_idx, TensorWithHeader tensor_with_header,
                                              std::vector<GeTensor> &output, DataFlowInfo &info, bool &is_aligned) {
   is_aligned = false;
-  std::lock_guard<std::mutex> guard(mt_);
-  auto queue_find_ret = queue_idx_order_.find(queue_idx);
-  GE_ASSERT_TRUE(queue_find_ret != queue_idx_order_.end(), "queue idx is invalid, queue_idx=%u, valid idx list=%s",
-                 queue_idx, ToString(queue_idxes_).c_str());
+  GE_ASSERT_TRUE(
+      (queue_idx < queue_idx_order_.size()) && (queue_idx_order_[queue_idx] != std::numeric_limits<size_t>::max()),
+      "queue idx is invalid, queue_idx=%u, valid idx list=%s", queue_idx, ToString(queue_idxes_).c_str());
 
-  size_t idx = queue_find_ret->second;
+  size_t idx = queue_idx_order_[queue_idx];
   uint64_t trans_id = tensor_with_header.msg_info.trans_id;
   uint32_t data_label = tensor_with_header.msg_info.data_label;
   if ((check_ignore_trans_id_func_ != nullptr) && check_ignore_trans_id_func_(trans_id)) {
     GELOGW("trans_id=%" PRIu64 ", data_label=%u is dropped as it is ignored.", trans_id, data_label);
     return SUCCESS;
   }
-  std::pair<uint64_t, uint32_t> trans_id_and_data_label(trans_id, data_label);
-  auto cache_find_ret = wait_align_data_.find(trans_id_and_data_label);
-  if (cache_find_ret == wait_align_data_.end()) {
-    AlignCacheData tmp_cache_data(cache_nums_);
-    auto emplace_ret = wait_align_data_.emplace(trans_id_and_data_label, std::move(tmp_cache_data));
-    GE_ASSERT_TRUE(emplace_ret.second, "add cache data failed, trans_id=%" PRIu64 ", data_label=%u", trans_id,
-                   data_label);
-    cache_find_ret = emplace_ret.first;
-  }
-  auto &cache_data = cache_find_ret->second;
-  // when first push failed, or take empty, need erase it.
-  ScopeGuard scope_guard([this, &cache_data, &trans_id_and_data_label]() {
-    if (cache_data.IsEmpty()) {
-      (void)wait_align_data_.erase(trans_id_and_data_label);
-    }
-  });
-  GE_CHK_STATUS_RET(cache_data.Push(idx, std::move(tensor_with_header)),
-                    "save queue_idx[%u] trans_id[%" PRIu64 "] data_label[%u] to the [%zu]th cache queue failed",
-                    queue_idx, trans_id, data_label, idx);
-  GELOGD("save queue_idx[%u] trans_id[%" PRIu64 "] data_label[%u] to the [%zu]th cache queue success.", queue_idx,
-         trans_id, data_label, idx);
-  if (cache_data.IsComplete()) {
+  const AlignCacheShard::Key trans_id_and_data_label(trans_id, data_label);
+  auto &shard = GetShard(trans_id);
+  std::lock_guard<std::mutex> guard(shard.GetMutex());
+  auto *cache_data = shard.FindOrAdd(trans_id_and_data_label, next_seq_, cache_nums_);
+  GE_ASSERT_NOTNULL(cache_data, "add cache data failed, trans_id=%" PRIu64 ", data_label=%u", trans_id, data_label);
+  Status ret = cache_data->Push(idx, std::move(tensor_with_header));
+  if (ret != SUCCESS) {
+    GELOGE(ret, "save queue_idx[%u] trans_id[%" PRIu64 "] data_label[%u] to the [%zu]th cache queue failed",
+           queue_idx, trans_id, data_label, idx);
+  } else if (cache_data->IsComplete()) {
     GELOGI("trans_id[%" PRIu64 "] data_label[%u] align complete.", trans_id, data_label);
     is_aligned = true;
-    return cache_data.Take(output, info);
+    ret = cache_data->Take(output, info);
+  } else {
+    GELOGD("save queue_idx[%u] trans_id[%" PRIu64 "] data_label[%u] to the [%zu]th cache queue success.", queue_idx,
+           trans_id, data_label, idx);
   }
-  return SUCCESS;
+  // when first push failed, or take empty, need erase it.
+  if (cache_data->IsEmpty()) {
+    shard.Erase(trans_id_and_data_label);
+  }
+  return ret;
 }
 
 uint32_t DataFlowDataAligner::SelectNextQueueIdx() {
-  std::lock_guard<std::mutex> guard(mt_);
   size_t next_take_idx = 0;
   size_t min_cache_size = std::numeric_limits<size_t>::max();
   for (size_t idx = 0; idx < cache_nums_.size(); ++idx) {
-    if (min_cache_size > cache_nums_[idx]) {
-      min_cache_size = cache_nums_[idx];
+    const size_t cache_num = cache_nums_[idx].load(std::memory_order_relaxed);
+    if (min_cache_size > cache_num) {
+      min_cache_size = cache_num;
       next_take_idx = idx;
     }
   }
@@ -167,20 +356,9 @@ uint32_t DataFlowDataAligner::SelectNextQueueIdx() {
 }
 
 void DataFlowDataAligner::ClearCacheByTransId(uint64_t trans_id) {
-  std::lock_guard<std::mutex> guard(mt_);
-  if (wait_align_data_.empty()) {
-    return;
-  }
-  auto iter = wait_align_data_.begin();
-  size_t drop_cache_cnt = 0;
-  while (iter != wait_align_data_.end()) {
-    if (iter->first.first == trans_id) {
-      iter = wait_align_data_.erase(iter);
-      ++drop_cache_cnt;
-    } else {
-      ++iter;
-    }
-  }
+  auto &shard = GetShard(trans_id);
+  std::lock_guard<std::mutex> guard(shard.GetMutex());
+  const size_t drop_cache_cnt = shard.EraseByTransId(trans_id);
   GELOGI("clear cache by trans id=%" PRIu64 ", drop cache cnt=%zu, queue idxes=%s", trans_id, drop_cache_cnt,
          ToString(queue_idxes_).c_str());
 }
@@ -196,32 +374,68 @@ Status DataFlowDataAligner::TryTakeExpiredOrOverLimitData(std::vector<GeTensor>
   return TryTakeOverLimit(data, info, has_output);
 }
 
+AlignCacheShard *DataFlowDataAligner::LockOldestShard(std::unique_lock<std::mutex> &lock) {
+  while (true) {
+    AlignCacheShard *oldest_shard = nullptr;
+    uint64_t oldest_seq = std::numeric_limits<uint64_t>::max();
+    AlignCacheShard::Key key;
+    uint64_t seq = 0UL;
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard.GetMutex());
+      if ((shard.GetOldest(key, seq) != nullptr) && (seq < oldest_seq)) {
+        oldest_seq = seq;
+        oldest_shard = &shard;
+      }
+    }
+    if (oldest_shard == nullptr) {
+      return nullptr;
+    }
+    lock = std::unique_lock<std::mutex>(oldest_shard->GetMutex());
+    // 新到达的缓存序号更大，只有最早的缓存被并发取走时才需要重新查找
+    if ((oldest_shard->GetOldest(key, seq) != nullptr) && (seq == oldest_seq)) {
+      return oldest_shard;
+    }
+    lock.unlock();
+  }
+}
+
 Status DataFlowDataAligner::TryTakeOverLimit(std::vector<GeTensor> &data, DataFlowInfo &info, bool &has_output) {
-  std::lock_guard<std::mutex> guard(mt_);
-  if (wait_align_data_.size() <= align_attrs_.align_max_cache_num) {
+  if (GetCacheSize() <= align_attrs_.align_max_cache_num) {
     return SUCCESS;
   }
+  AlignCacheShard::Key key;
+  uint64_t seq = 0UL;
   if (!align_attrs_.drop_when_not_align) {
-    auto begin = wait_align_data_.begin();
-    Status ret = begin->second.Take(data, info);
-    if (begin->second.IsEmpty()) {
+    std::unique_lock<std::mutex> lock;
+    auto *shard = LockOldestShard(lock);
+    if (shard == nullptr) {
+      return SUCCESS;
+    }
+    auto *oldest = shard->GetOldest(key, seq);
+    Status ret = oldest->Take(data, info);
+    if (oldest->IsEmpty()) {
       GELOGW("cache size=%zu is over limit size %u, take trans id=%" PRIu64 ", data label=%u finish.",
-             wait_align_data_.size(), align_attrs_.align_max_cache_num, begin->first.first, begin->first.second);
-      (void)wait_align_data_.erase(begin);
+             GetCacheSize(), align_attrs_.align_max_cache_num, key.first, key.second);
+      shard->Erase(key);
     } else {
       GELOGW("cache size=%zu is over limit size %u, take trans id=%" PRIu64
              ", "
              "data label=%u not finish, need take next time.",
-             wait_align_data_.size(), align_attrs_.align_max_cache_num, begin->first.first, begin->first.second);
+             GetCacheSize(), align_attrs_.align_max_cache_num, key.first, key.second);
     }
     has_output = true;
     return ret;
   }
-  while (wait_align_data_.size() > align_attrs_.align_max_cache_num) {
-    GELOGW("cache size=%zu is over limit size %u, drop trans id=%" PRIu64 ", data label=%u.", wait_align_data_.size(),
-           align_attrs_.align_max_cache_num, wait_align_data_.begin()->first.first,
-           wait_align_data_.begin()->first.second);
-    (void)wait_align_data_.erase(wait_align_data_.begin());
+  while (GetCacheSize() > align_attrs_.align_max_cache_num) {
+    std::unique_lock<std::mutex> lock;
+    auto *shard = LockOldestShard(lock);
+    if (shard == nullptr) {
+      break;
+    }
+    (void)shard->GetOldest(key, seq);
+    GELOGW("cache size=%zu is over limit size %u, drop trans id=%" PRIu64 ", data label=%u.", GetCacheSize(),
+           align_attrs_.align_max_cache_num, key.first, key.second);
+    shard->Erase(key);
   }
   return SUCCESS;
 }
@@ -231,39 +445,46 @@ Status DataFlowDataAligner::TryTakeExpired(std::vector<GeTensor> &data, DataFlow
   if (align_attrs_.align_timeout == kAlignNeverTimeout) {
     return SUCCESS;
   }
-  std::lock_guard<std::mutex> guard(mt_);
-  if (wait_align_data_.empty()) {
-    return SUCCESS;
-  }
+  // 所有缓存的超时时间相同，按到达顺序最早的缓存最先超时，每个分片只需检查链表头部
   const auto current_time = std::chrono::steady_clock::now();
-  for (auto iter = wait_align_data_.begin(); iter != wait_align_data_.end();) {
-    if (!iter->second.IsExpire(current_time, align_attrs_.align_timeout)) {
-      ++iter;
-      continue;
-    }
-    if (align_attrs_.drop_when_not_align) {
-      GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, need drop it.", iter->first.first,
-             iter->first.second);
-      iter = wait_align_data_.erase(iter);
-      continue;
-    }
-    Status ret = iter->second.Take(data, info);
-    if (iter->second.IsEmpty()) {
-      GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, and take finish.", iter->first.first,
-             iter->first.second);
-      (void)wait_align_data_.erase(iter);
-    } else {
-      GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, and take not finish.", iter->first.first,
-             iter->first.second);
+  AlignCacheShard::Key key;
+  uint64_t seq = 0UL;
+  if (align_attrs_.drop_when_not_align) {
+    for (auto &shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard.GetMutex());
+      for (auto *oldest = shard.GetOldest(key, seq);
+           (oldest != nullptr) && oldest->IsExpire(current_time, align_attrs_.align_timeout);
+           oldest = shard.GetOldest(key, seq)) {
+        GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, need drop it.", key.first, key.second);
+        shard.Erase(key);
+      }
     }
-    has_output = true;
-    return ret;
+    return SUCCESS;
   }
-  return SUCCESS;
+  std::unique_lock<std::mutex> lock;
+  auto *shard = LockOldestShard(lock);
+  if (shard == nullptr) {
+    return SUCCESS;
+  }
+  auto *oldest = shard->GetOldest(key, seq);
+  if (!oldest->IsExpire(current_time, align_attrs_.align_timeout)) {
+    return SUCCESS;
+  }
+  Status ret = oldest->Take(data, info);
+  if (oldest->IsEmpty()) {
+    GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, and take finish.", key.first, key.second);
+    shard->Erase(key);
+  } else {
+    GELOGW("data trans id=%" PRIu64 ", data label=%u is expire, and take not finish.", key.first, key.second);
+  }
+  has_output = true;
+  return ret;
 }
 
 void DataFlowDataAligner::ClearCache() {
-  std::lock_guard<std::mutex> guard(mt_);
-  wait_align_data_.clear();
+  for (auto &shard : shards_) {
+    std::lock_guard<std::mutex> guard(shard.GetMutex());
+    shard.Clear();
+  }
 }
 }  // namespace ge
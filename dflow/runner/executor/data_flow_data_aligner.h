@@ -11,7 +11,10 @@
 #ifndef EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_DEPLOY_DATAFLOW_DATA_ALIGNER_H_
 #define EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_DEPLOY_DATAFLOW_DATA_ALIGNER_H_
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <queue>
 #include <vector>
 #include <map>
@@ -29,7 +32,8 @@ struct TensorWithHeader {
 };
 class AlignCacheData {
  public:
-  explicit AlignCacheData(std::vector<size_t> &cache_nums) : cache_nums_(cache_nums), queue_data_(cache_nums.size()) {}
+  explicit AlignCacheData(std::vector<std::atomic<size_t>> &cache_nums)
+      : cache_nums_(cache_nums), queue_data_(cache_nums.size()) {}
   ~AlignCacheData();
   AlignCacheData(const AlignCacheData &context) = delete;
   AlignCacheData &operator=(const AlignCacheData &context) & = delete;
@@ -45,10 +49,63 @@ class AlignCacheData {
 
  private:
   std::chrono::steady_clock::time_point start_time_ = std::chrono::steady_clock::now();
-  std::vector<size_t> &cache_nums_;
+  std::vector<std::atomic<size_t>> &cache_nums_;
   std::vector<std::queue<TensorWithHeader>> queue_data_;
 };
 
+/**
+ * 对齐缓存的一个分片：以(trans_id, data_label)为key的开放寻址哈希表(线性探测)，
+ * 缓存本身存放在entries_中，并按到达顺序串成双向链表，用于超时和超限时按先来先出淘汰。
+ * 所有接口都不加锁，由调用者持有GetMutex()。
+ */
+class AlignCacheShard {
+ public:
+  using Key = std::pair<uint64_t, uint32_t>;
+  AlignCacheShard() = default;
+  ~AlignCacheShard() = default;
+  AlignCacheShard(const AlignCacheShard &) = delete;
+  AlignCacheShard &operator=(const AlignCacheShard &) = delete;
+
+  AlignCacheData *Find(const Key &key) const;
+  // 新增的缓存从next_seq取到达序号
+  AlignCacheData *FindOrAdd(const Key &key, std::atomic<uint64_t> &next_seq,
+                            std::vector<std::atomic<size_t>> &cache_nums);
+  void Erase(const Key &key);
+  size_t EraseByTransId(uint64_t trans_id);
+  // 获取最早到达的缓存，分片为空时返回nullptr
+  AlignCacheData *GetOldest(Key &key, uint64_t &seq) const;
+  void Clear();
+
+  size_t Size() const {
+    return size_.load(std::memory_order_relaxed);
+  }
+  std::mutex &GetMutex() {
+    return mt_;
+  }
+
+ private:
+  struct Entry {
+    Key key;
+    uint64_t hash = 0UL;
+    uint64_t seq = 0UL;
+    std::unique_ptr<AlignCacheData> data;
+    uint32_t prev = 0U;
+    uint32_t next = 0U;
+  };
+  size_t FindSlot(const Key &key, uint64_t hash) const;
+  void EraseSlot(size_t slot);
+  void Rehash(size_t capacity);
+
+  std::mutex mt_;
+  std::vector<Entry> entries_;
+  std::vector<uint32_t> free_entries_;
+  // 存放entries_下标，容量为2的幂，负载不超过1/2
+  std::vector<uint32_t> slots_;
+  uint32_t head_ = UINT32_MAX;
+  uint32_t tail_ = UINT32_MAX;
+  std::atomic<size_t> size_{0UL};
+};
+
 class DataFlowDataAligner {
  public:
   using CheckIgnoreTransIdFunc = std::function<bool(uint64_t trans_id)>;
@@ -69,18 +126,26 @@ class DataFlowDataAligner {
   }
 
  private:
+  static constexpr uint32_t kShardBits = 4U;
+  static constexpr size_t kShardNum = 1UL << kShardBits;
   Status TryTakeExpired(std::vector<GeTensor> &data, DataFlowInfo &info, bool &has_output);
   Status TryTakeOverLimit(std::vector<GeTensor> &data, DataFlowInfo &info, bool &has_output);
+  AlignCacheShard &GetShard(uint64_t trans_id);
+  // 锁住最早到达的缓存所在的分片并返回，所有分片为空时返回nullptr
+  AlignCacheShard *LockOldestShard(std::unique_lock<std::mutex> &lock);
+  size_t GetCacheSize() const;
+  std::vector<size_t> GetCacheNums() const;
 
-  std::mutex mt_;
   const std::vector<uint32_t> queue_idxes_;
-  // the index of queue_idx in queue_idxes_
-  std::map<uint32_t, size_t> queue_idx_order_;
+  // the index of queue_idx in queue_idxes_, indexed by queue_idx, SIZE_MAX means invalid
+  std::vector<size_t> queue_idx_order_;
   const InputAlignAttrs align_attrs_;
   CheckIgnoreTransIdFunc check_ignore_trans_id_func_;
-  std::vector<size_t> cache_nums_;
-  std::map<std::pair<uint64_t, uint32_t>, AlignCacheData> wait_align_data_;
-  std::set<uint64_t> exception_trans_id_set_;
+  // 需在shards_之前定义，分片析构时会更新
+  std::vector<std::atomic<size_t>> cache_nums_;
+  std::atomic<uint64_t> next_seq_{0UL};
+  // 按trans_id分片，同一trans_id的所有data_label在同一个分片
+  std::array<AlignCacheShard, kShardNum> shards_;
 };
 }  // namespace ge
 #endif  // EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_DEPLOY_DATAFLOW_DATA_ALIGNER_H_
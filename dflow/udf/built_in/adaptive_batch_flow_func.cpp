@@ -0,0 +1,452 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "adaptive_batch_flow_func.h"
+#include <algorithm>
+#include "flow_func/flow_func_timer.h"
+#include "common/udf_log.h"
+#include "securec.h"
+#include "flow_func/flow_func_dumper.h"
+
+namespace FlowFunc {
+namespace {
+// 到达间隔滑动平均的权重，新观测值占1/kArrivalEwmaWeight
+constexpr uint64_t kArrivalEwmaWeight = 8UL;
+// 空闲后的到达间隔按时延预算的倍数截断，避免负载恢复后长时间只组小batch
+constexpr uint64_t kMaxIntervalSloTimes = 2UL;
+}  // namespace
+
+AdaptiveBatchFlowFunc::~AdaptiveBatchFlowFunc() {
+  if (timer_handle_ != nullptr) {
+    (void)FlowFuncTimer::Instance().DeleteTimer(timer_handle_);
+  }
+  UDF_LOG_INFO("[AdaptiveBatch]batch_num=%lu, sample_num=%lu, padding_num=%lu, reuse_num=%lu.", batch_num_,
+               sample_num_, padding_num_, reuse_num_);
+  slots_.clear();
+}
+
+int32_t AdaptiveBatchFlowFunc::Init() {
+  auto err_code = GetBatchAttr();
+  if (err_code != FLOW_FUNC_SUCCESS) {
+    UDF_LOG_ERROR("[AdaptiveBatch]GetBatchAttr Failed. err_code=%d.", err_code);
+    return err_code;
+  }
+  const auto timeout_proc = [this]() {
+    std::unique_lock<std::mutex> lk(mutex_);
+    if (batch_count_ == 0L) {
+      UDF_LOG_DEBUG("[AdaptiveBatch]timeout_proc: no sample is waiting, return.");
+      return;
+    }
+    const uint64_t current_time = FlowFuncTimer::Instance().GetCurrentTimestamp();
+    const uint64_t wait_time = current_time - batch_start_time_;
+    const uint64_t slo_us = static_cast<uint64_t>(latency_slo_) * kMsToUsCast;
+    if (wait_time < slo_us) {
+      // 定时器可能由已经输出的batch启动，按当前batch的剩余时间重新启动
+      const uint64_t remain_ms = (slo_us - wait_time + kMsToUsCast - 1UL) / kMsToUsCast;
+      UDF_LOG_DEBUG("[AdaptiveBatch]timeout_proc: wait time[%lu us] is less than slo, restart timer[%lu ms].",
+                    wait_time, remain_ms);
+      (void)FlowFuncTimer::Instance().StartTimer(timer_handle_, static_cast<uint32_t>(remain_ms), true);
+      return;
+    }
+    UDF_LOG_DEBUG("[AdaptiveBatch]timeout_proc: wait time[%lu us] reach slo, flush %ld samples.", wait_time,
+                  batch_count_);
+    (void)FlushBatch();
+  };
+  timer_handle_ = FlowFuncTimer::Instance().CreateTimer(timeout_proc);
+  if (timer_handle_ == nullptr) {
+    UDF_LOG_ERROR("[AdaptiveBatch]CreateTimer failed.");
+    return FLOW_FUNC_FAILED;
+  }
+  slots_.clear();
+  ResetBatch();
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::GetBatchAttr() {
+  auto get_ret = context_->GetAttr("latency_slo", latency_slo_);
+  if (get_ret != FLOW_FUNC_SUCCESS) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Failed to get attr[latency_slo].");
+    return get_ret;
+  }
+  if ((latency_slo_ <= 0L) || (latency_slo_ >= static_cast<int64_t>(UINT32_MAX))) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Attr[latency_slo] is invalid[%ld], vaild range is(0, %u).", latency_slo_,
+                  UINT32_MAX);
+    return FLOW_FUNC_ERR_PARAM_INVALID;
+  }
+  get_ret = context_->GetAttr("batch_buckets", batch_buckets_);
+  if (get_ret != FLOW_FUNC_SUCCESS) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Failed to get attr[batch_buckets].");
+    return get_ret;
+  }
+  if (batch_buckets_.empty()) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Attr[batch_buckets] is empty.");
+    return FLOW_FUNC_ERR_PARAM_INVALID;
+  }
+  for (size_t i = 0U; i < batch_buckets_.size(); ++i) {
+    if ((batch_buckets_[i] <= 0L) || ((i > 0U) && (batch_buckets_[i] <= batch_buckets_[i - 1U]))) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Attr[batch_buckets][%zu]=%ld is invalid, buckets must be positive and ascending.",
+                    i, batch_buckets_[i]);
+      return FLOW_FUNC_ERR_PARAM_INVALID;
+    }
+  }
+  get_ret = context_->GetAttr("padding", padding_);
+  if (get_ret != FLOW_FUNC_SUCCESS) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Failed to get attr[padding].");
+    return get_ret;
+  }
+  UDF_LOG_DEBUG("[AdaptiveBatch]GetBatchAttr success, latency_slo_ = %ld, bucket num = %zu, max bucket = %ld, "
+                "padding_ = %d.",
+                latency_slo_, batch_buckets_.size(), batch_buckets_.back(), padding_);
+  return FLOW_FUNC_SUCCESS;
+}
+
+bool AdaptiveBatchFlowFunc::IsEmptyEosMsgs(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const {
+  for (const auto &input_msg : input_msgs) {
+    if ((input_msg->GetTensor() != nullptr) ||
+        ((input_msg->GetFlowFlags() & static_cast<uint32_t>(FlowFlag::FLOW_FLAG_EOS)) == 0U)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int32_t AdaptiveBatchFlowFunc::CheckTensorInfo(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const {
+  for (size_t i = 0U; i < input_msgs.size(); ++i) {
+    const auto input_tensor = input_msgs[i]->GetTensor();
+    if (input_tensor == nullptr) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Input[%zu] tensor is nullptr.", i);
+      return FLOW_FUNC_ERR_PARAM_INVALID;
+    }
+    if (batch_count_ == 0L) {
+      continue;
+    }
+    const auto &slot = slots_[i];
+    if (input_tensor->GetShape() != slot.sample_shape) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Input[%zu] shape is invalid for auto batch.", i);
+      return FLOW_FUNC_ERR_PARAM_INVALID;
+    }
+    if (input_tensor->GetDataType() != slot.data_type) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Input[%zu] data type[%d] is not equal to last input data type[%d].", i,
+                    static_cast<int32_t>(input_tensor->GetDataType()), static_cast<int32_t>(slot.data_type));
+      return FLOW_FUNC_ERR_PARAM_INVALID;
+    }
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::CheckInput(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const {
+  if (input_msgs.empty()) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Input is empty.");
+    return FLOW_FUNC_ERR_PARAM_INVALID;
+  }
+  for (size_t i = 0U; i < input_msgs.size(); ++i) {
+    if (input_msgs[i] == nullptr) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Input[%zu] msg is nullptr.", i);
+      return FLOW_FUNC_ERR_PARAM_INVALID;
+    }
+    const auto ret_code = input_msgs[i]->GetRetCode();
+    if (ret_code != 0) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Input[%zu] is invalid, error code[%d].", i, ret_code);
+      return ret_code;
+    }
+  }
+  if ((batch_count_ != 0L) && (input_msgs.size() != slots_.size())) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Input current input num is %zu, but cached input num is %zu.", input_msgs.size(),
+                  slots_.size());
+    return FLOW_FUNC_ERR_PARAM_INVALID;
+  }
+  if (IsEmptyEosMsgs(input_msgs)) {
+    return FLOW_FUNC_SUCCESS;
+  }
+  return CheckTensorInfo(input_msgs);
+}
+
+void AdaptiveBatchFlowFunc::ObserveArrival(uint64_t current_time) {
+  if ((last_arrival_time_ != 0UL) && (current_time >= last_arrival_time_)) {
+    const uint64_t max_interval = static_cast<uint64_t>(latency_slo_) * kMsToUsCast * kMaxIntervalSloTimes;
+    const uint64_t interval = std::max(std::min(current_time - last_arrival_time_, max_interval), 1UL);
+    arrival_interval_us_ = (arrival_interval_us_ == 0UL)
+                               ? interval
+                               : (arrival_interval_us_ * (kArrivalEwmaWeight - 1UL) + interval) / kArrivalEwmaWeight;
+  }
+  last_arrival_time_ = current_time;
+}
+
+int64_t AdaptiveBatchFlowFunc::SelectTargetBucket() const {
+  // 还没有到达间隔的观测值时按最小档位组batch
+  if (arrival_interval_us_ == 0UL) {
+    return batch_buckets_.front();
+  }
+  // 凑满n个样本时第一个样本需要等待(n-1)个到达间隔，选不超过时延预算的最大档位
+  const uint64_t slo_us = static_cast<uint64_t>(latency_slo_) * kMsToUsCast;
+  const uint64_t fill_num = slo_us / arrival_interval_us_ + 1UL;
+  const auto iter = std::upper_bound(batch_buckets_.cbegin(), batch_buckets_.cend(), fill_num,
+                                     [](uint64_t num, int64_t bucket) { return num < static_cast<uint64_t>(bucket); });
+  return (iter == batch_buckets_.cbegin()) ? batch_buckets_.front() : *(iter - 1);
+}
+
+int64_t AdaptiveBatchFlowFunc::SelectPaddingBucket(int64_t sample_num) const {
+  const auto iter = std::lower_bound(batch_buckets_.cbegin(), batch_buckets_.cend(), sample_num);
+  return (iter == batch_buckets_.cend()) ? sample_num : *iter;
+}
+
+int32_t AdaptiveBatchFlowFunc::AcquireBatchMsg(BatchSlot &slot, int64_t batch_size,
+                                               std::shared_ptr<FlowMsg> &batch_msg) {
+  const auto iter = slot.spare_msgs.find(batch_size);
+  if (iter != slot.spare_msgs.end()) {
+    batch_msg = std::move(iter->second);
+    (void)slot.spare_msgs.erase(iter);
+    ++reuse_num_;
+    return FLOW_FUNC_SUCCESS;
+  }
+  std::vector<int64_t> batch_shape(slot.sample_shape);
+  (void)batch_shape.insert(batch_shape.cbegin(), batch_size);
+  batch_msg = context_->AllocTensorMsg(batch_shape, slot.data_type);
+  if (batch_msg == nullptr) {
+    UDF_LOG_ERROR("[AdaptiveBatch]alloc tensor failed, batch_size=%ld.", batch_size);
+    return FLOW_FUNC_FAILED;
+  }
+  const uint64_t data_size = batch_msg->GetTensor()->GetDataSize();
+  if (data_size < static_cast<uint64_t>(batch_size) * slot.sample_size) {
+    UDF_LOG_ERROR("[AdaptiveBatch]batch data size[%lu] is less than batch_size[%ld] * sample size[%lu].", data_size,
+                  batch_size, slot.sample_size);
+    batch_msg = nullptr;
+    return FLOW_FUNC_FAILED;
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::StartBatch(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs,
+                                          uint64_t current_time) {
+  if (slots_.size() != input_msgs.size()) {
+    slots_.clear();
+    slots_.resize(input_msgs.size());
+  }
+  target_bucket_ = SelectTargetBucket();
+  for (size_t i = 0U; i < input_msgs.size(); ++i) {
+    const auto input_tensor = input_msgs[i]->GetTensor();
+    auto &slot = slots_[i];
+    if ((input_tensor->GetShape() != slot.sample_shape) || (input_tensor->GetDataType() != slot.data_type)) {
+      // 样本shape变化后缓存的输出buffer不能再复用
+      slot.spare_msgs.clear();
+      slot.sample_shape = input_tensor->GetShape();
+      slot.data_type = input_tensor->GetDataType();
+    }
+    slot.sample_size = input_tensor->GetDataSize();
+    slot.max_step = 0U;
+    auto ret = AcquireBatchMsg(slot, target_bucket_, slot.staging_msg);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Acquire batch msg for input[%zu] failed, ret=%d.", i, ret);
+      return ret;
+    }
+    slot.staging_bucket = target_bucket_;
+  }
+  batch_start_time_ = current_time;
+  if (target_bucket_ > 1L) {
+    (void)FlowFuncTimer::Instance().StartTimer(timer_handle_, static_cast<uint32_t>(latency_slo_), true);
+  }
+  UDF_LOG_DEBUG("[AdaptiveBatch]Start batch, arrival interval=%lu us, target bucket=%ld.", arrival_interval_us_,
+                target_bucket_);
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::AppendSample(BatchSlot &slot, const std::shared_ptr<FlowMsg> &input_msg) const {
+  const auto input_tensor = input_msg->GetTensor();
+  if (input_tensor->GetDataSize() != slot.sample_size) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Input data size[%lu] is not equal to sample size[%lu].", input_tensor->GetDataSize(),
+                  slot.sample_size);
+    return FLOW_FUNC_ERR_PARAM_INVALID;
+  }
+  const auto mbuf_msg = std::dynamic_pointer_cast<MbufFlowMsg>(input_msg);
+  if (mbuf_msg != nullptr) {
+    const auto step = mbuf_msg->GetStepId();
+    slot.max_step = ((FlowFuncDumpManager::IsInDumpStep(step)) && (step > slot.max_step)) ? step : slot.max_step;
+  }
+  if (slot.sample_size == 0UL) {
+    return FLOW_FUNC_SUCCESS;
+  }
+  const auto staging_tensor = slot.staging_msg->GetTensor();
+  const uint64_t offset = static_cast<uint64_t>(batch_count_) * slot.sample_size;
+  auto data = static_cast<uint8_t *>(staging_tensor->GetData()) + offset;
+  const errno_t ret =
+      memcpy_s(data, staging_tensor->GetDataSize() - offset, input_tensor->GetData(), slot.sample_size);
+  if (ret != EOK) {
+    UDF_LOG_ERROR("[AdaptiveBatch]memcpy_s failed, offset=%lu, sample size=%lu.", offset, slot.sample_size);
+    return FLOW_FUNC_FAILED;
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::AssembleOutput(BatchSlot &slot, int64_t batch_size,
+                                              std::shared_ptr<FlowMsg> &output_msg) {
+  const uint64_t used_size = static_cast<uint64_t>(batch_count_) * slot.sample_size;
+  if (batch_size == slot.staging_bucket) {
+    output_msg = std::move(slot.staging_msg);
+  } else {
+    // 提前输出时样本数小于目标档位，拷贝到对应大小的输出，目标档位的buffer留给后续batch
+    auto ret = AcquireBatchMsg(slot, batch_size, output_msg);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      return ret;
+    }
+    if (used_size > 0UL) {
+      const auto output_tensor = output_msg->GetTensor();
+      const errno_t err = memcpy_s(output_tensor->GetData(), output_tensor->GetDataSize(),
+                                   slot.staging_msg->GetTensor()->GetData(), used_size);
+      if (err != EOK) {
+        UDF_LOG_ERROR("[AdaptiveBatch]memcpy_s failed, used size=%lu.", used_size);
+        return FLOW_FUNC_FAILED;
+      }
+    }
+    slot.spare_msgs[slot.staging_bucket] = std::move(slot.staging_msg);
+  }
+  slot.staging_msg = nullptr;
+  const auto output_tensor = output_msg->GetTensor();
+  const uint64_t data_size = output_tensor->GetDataSize();
+  if (data_size > used_size) {
+    const errno_t err =
+        memset_s(static_cast<uint8_t *>(output_tensor->GetData()) + used_size, data_size - used_size, 0,
+                 data_size - used_size);
+    if (err != EOK) {
+      UDF_LOG_ERROR("[AdaptiveBatch]memset_s failed, padding size=%lu.", data_size - used_size);
+      return FLOW_FUNC_FAILED;
+    }
+  }
+  const auto mbuf_output_msg = std::dynamic_pointer_cast<MbufFlowMsg>(output_msg);
+  if (mbuf_output_msg != nullptr) {
+    mbuf_output_msg->SetStepId(slot.max_step);
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::FlushBatch() {
+  if (batch_count_ == 0L) {
+    return FLOW_FUNC_SUCCESS;
+  }
+  const int64_t batch_size = padding_ ? SelectPaddingBucket(batch_count_) : batch_count_;
+  published_output_num_ = 0U;
+  std::shared_ptr<FlowMsg> output_msg;
+  for (size_t i = 0U; i < slots_.size(); ++i) {
+    auto ret = AssembleOutput(slots_[i], batch_size, output_msg);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]AssembleOutput[%zu] failed, ret=%d.", i, ret);
+      AbnormalProc(ret);
+      return ret;
+    }
+    ret = context_->SetOutput(static_cast<uint32_t>(i), output_msg);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]SetOutput[%zu] failed, ret=%d.", i, ret);
+      AbnormalProc(ret);
+      return ret;
+    }
+    published_output_num_++;
+  }
+  ++batch_num_;
+  padding_num_ += static_cast<uint64_t>(batch_size - batch_count_);
+  UDF_LOG_DEBUG("[AdaptiveBatch]Flush batch, sample num=%ld, target bucket=%ld, output batch size=%ld.", batch_count_,
+                target_bucket_, batch_size);
+  ResetBatch();
+  return FLOW_FUNC_SUCCESS;
+}
+
+int32_t AdaptiveBatchFlowFunc::PublishEmptyEosOut() {
+  auto empty_data_msg = context_->AllocEmptyDataMsg(MsgType::MSG_TYPE_TENSOR_DATA);
+  if (empty_data_msg == nullptr) {
+    UDF_LOG_ERROR("[AdaptiveBatch]Failed to alloc empty data msg.");
+    return FLOW_FUNC_FAILED;
+  }
+  empty_data_msg->SetFlowFlags(static_cast<uint32_t>(FlowFlag::FLOW_FLAG_EOS));
+  published_output_num_ = 0U;
+  for (uint32_t i = 0U; i < total_output_num_; ++i) {
+    const auto ret = context_->SetOutput(i, empty_data_msg);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]Failed to set empty eos output[%u], ret = %d", i, ret);
+      return ret;
+    }
+    published_output_num_++;
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+void AdaptiveBatchFlowFunc::AbnormalProc(int32_t error_code) {
+  // alloc size 1 output for error report
+  auto error_output_msg = context_->AllocTensorMsg({1}, TensorDataType::DT_INT8);
+  if (error_output_msg != nullptr) {
+    error_output_msg->SetRetCode(error_code);
+    for (uint32_t i = published_output_num_; i < total_output_num_; ++i) {
+      (void)context_->SetOutput(i, error_output_msg);
+    }
+  }
+  ResetBatch();
+  UDF_LOG_DEBUG("[AdaptiveBatch]AbnormalProc finished.");
+}
+
+void AdaptiveBatchFlowFunc::ResetBatch() {
+  for (auto &slot : slots_) {
+    if (slot.staging_msg != nullptr) {
+      slot.spare_msgs[slot.staging_bucket] = std::move(slot.staging_msg);
+      slot.staging_msg = nullptr;
+    }
+    slot.max_step = 0U;
+  }
+  batch_count_ = 0L;
+  target_bucket_ = 0L;
+}
+
+int32_t AdaptiveBatchFlowFunc::Proc(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) {
+  std::unique_lock<std::mutex> lk(mutex_);
+  if (batch_count_ == 0L) {
+    total_output_num_ = static_cast<uint32_t>(input_msgs.size());
+  }
+  published_output_num_ = 0U;
+  auto ret = CheckInput(input_msgs);
+  if (ret != FLOW_FUNC_SUCCESS) {
+    UDF_LOG_ERROR("[AdaptiveBatch]CheckInput failed, ret=%d.", ret);
+    AbnormalProc(ret);
+    return FLOW_FUNC_SUCCESS;
+  }
+  if (IsEmptyEosMsgs(input_msgs)) {
+    // 结束前把已缓存的样本输出，不等待时延预算
+    if (FlushBatch() != FLOW_FUNC_SUCCESS) {
+      return FLOW_FUNC_SUCCESS;
+    }
+    ret = PublishEmptyEosOut();
+    if (ret != FLOW_FUNC_SUCCESS) {
+      AbnormalProc(ret);
+    }
+    return FLOW_FUNC_SUCCESS;
+  }
+  const uint64_t current_time = FlowFuncTimer::Instance().GetCurrentTimestamp();
+  ObserveArrival(current_time);
+  if (batch_count_ == 0L) {
+    ret = StartBatch(input_msgs, current_time);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]StartBatch failed, ret=%d.", ret);
+      AbnormalProc(ret);
+      return FLOW_FUNC_SUCCESS;
+    }
+  }
+  for (size_t i = 0U; i < input_msgs.size(); ++i) {
+    ret = AppendSample(slots_[i], input_msgs[i]);
+    if (ret != FLOW_FUNC_SUCCESS) {
+      UDF_LOG_ERROR("[AdaptiveBatch]AppendSample[%zu] failed, ret=%d.", i, ret);
+      AbnormalProc(ret);
+      return FLOW_FUNC_SUCCESS;
+    }
+  }
+  ++batch_count_;
+  ++sample_num_;
+  if (batch_count_ >= target_bucket_) {
+    (void)FlushBatch();
+  }
+  return FLOW_FUNC_SUCCESS;
+}
+
+REGISTER_FLOW_FUNC("_BuiltIn_AdaptiveBatch", AdaptiveBatchFlowFunc);
+}  // namespace FlowFunc
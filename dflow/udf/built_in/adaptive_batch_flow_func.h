@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef BUILT_IN_ADAPTIVE_BATCH_FLOW_FUNC_H
+#define BUILT_IN_ADAPTIVE_BATCH_FLOW_FUNC_H
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include "flow_func/meta_flow_func.h"
+
+namespace FlowFunc {
+/**
+ * 自适应组batch：按到达间隔的滑动平均和时延预算(latency_slo)选择目标batch，目标只取batch_buckets中的档位。
+ * 样本到达时直接拷贝到按目标档位预申请的输出buffer中，凑满目标档位立即输出；
+ * 第一个样本等待超过latency_slo时按已有样本数输出，padding为true时补0到不小于样本数的最小档位。
+ */
+class AdaptiveBatchFlowFunc : public MetaFlowFunc {
+ public:
+  AdaptiveBatchFlowFunc() = default;
+  ~AdaptiveBatchFlowFunc() override;
+  int32_t Init() override;
+  int32_t Proc(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) override;
+
+ private:
+  struct BatchSlot {
+    std::vector<int64_t> sample_shape;
+    TensorDataType data_type = TensorDataType::DT_UNDEFINED;
+    uint64_t sample_size = 0UL;
+    // 按目标档位预申请的输出，样本到达时直接拷入
+    std::shared_ptr<FlowMsg> staging_msg;
+    int64_t staging_bucket = 0L;
+    uint32_t max_step = 0U;
+    // 提前输出时未发送的输出buffer，按batch大小缓存给后续batch复用
+    std::map<int64_t, std::shared_ptr<FlowMsg>> spare_msgs;
+  };
+
+  int32_t GetBatchAttr();
+  int32_t CheckTensorInfo(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const;
+  int32_t CheckInput(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const;
+  bool IsEmptyEosMsgs(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs) const;
+  void ObserveArrival(uint64_t current_time);
+  int64_t SelectTargetBucket() const;
+  int64_t SelectPaddingBucket(int64_t sample_num) const;
+  int32_t AcquireBatchMsg(BatchSlot &slot, int64_t batch_size, std::shared_ptr<FlowMsg> &batch_msg);
+  int32_t StartBatch(const std::vector<std::shared_ptr<FlowMsg>> &input_msgs, uint64_t current_time);
+  int32_t AppendSample(BatchSlot &slot, const std::shared_ptr<FlowMsg> &input_msg) const;
+  int32_t AssembleOutput(BatchSlot &slot, int64_t batch_size, std::shared_ptr<FlowMsg> &output_msg);
+  int32_t FlushBatch();
+  int32_t PublishEmptyEosOut();
+  void AbnormalProc(int32_t error_code);
+  void ResetBatch();
+
+  int64_t latency_slo_ = 0L;
+  std::vector<int64_t> batch_buckets_;
+  bool padding_ = false;
+  std::mutex mutex_;
+  std::vector<BatchSlot> slots_;
+  int64_t batch_count_ = 0L;
+  int64_t target_bucket_ = 0L;
+  uint64_t batch_start_time_ = 0UL;
+  uint64_t last_arrival_time_ = 0UL;
+  uint64_t arrival_interval_us_ = 0UL;  // 到达间隔的滑动平均，0表示还没有观测值
+  uint32_t published_output_num_ = 0U;
+  uint32_t total_output_num_ = 0U;
+  void *timer_handle_ = nullptr;
+  uint64_t batch_num_ = 0UL;
+  uint64_t sample_num_ = 0UL;
+  uint64_t padding_num_ = 0UL;
+  uint64_t reuse_num_ = 0UL;
+};
+}  // namespace FlowFunc
+
+#endif  // BUILT_IN_ADAPTIVE_BATCH_FLOW_FUNC_H
@@ -0,0 +1,378 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "common/sparse_reachability.h"
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace ge {
+namespace {
+constexpr uint32_t kInvalidId = std::numeric_limits<uint32_t>::max();
+
+template <typename T>
+size_t GetVectorSize(const std::vector<T> &vec) {
+  return vec.capacity() * sizeof(T);
+}
+}  // namespace
+
+SparseReachability::SparseReachability(const SparseReachability &other) {
+  *this = other;
+}
+
+SparseReachability &SparseReachability::operator=(const SparseReachability &other) {
+  if (this == &other) {
+    return *this;
+  }
+  const std::lock_guard<std::mutex> other_lock(other.query_mutex_);
+  const std::lock_guard<std::mutex> lock(query_mutex_);
+  finalized_ = other.finalized_;
+  next_ord_ = other.next_ord_;
+  parent_ = other.parent_;
+  ord_ = other.ord_;
+  out_edges_ = other.out_edges_;
+  in_edges_ = other.in_edges_;
+  mark_epoch_ = other.mark_epoch_;
+  forward_marks_ = other.forward_marks_;
+  backward_marks_ = other.backward_marks_;
+  stack_.clear();
+  return *this;
+}
+
+void SparseReachability::Reset(size_t node_num) {
+  finalized_ = false;
+  next_ord_ = 0U;
+  mark_epoch_ = 0U;
+  parent_.clear();
+  ord_.clear();
+  out_edges_.clear();
+  in_edges_.clear();
+  forward_marks_.clear();
+  backward_marks_.clear();
+  stack_.clear();
+  parent_.reserve(node_num);
+  for (size_t i = 0U; i < node_num; ++i) {
+    (void)AddNode();
+  }
+}
+
+uint32_t SparseReachability::AddNode() {
+  const auto id = static_cast<uint32_t>(parent_.size());
+  parent_.emplace_back(id);
+  ord_.emplace_back(finalized_ ? next_ord_++ : 0U);
+  out_edges_.emplace_back();
+  in_edges_.emplace_back();
+  forward_marks_.emplace_back(0U);
+  backward_marks_.emplace_back(0U);
+  return id;
+}
+
+uint32_t SparseReachability::AddNodeToGroup(uint32_t member) {
+  const uint32_t group = Find(member);
+  const uint32_t id = AddNode();
+  parent_[id] = group;
+  return id;
+}
+
+uint32_t SparseReachability::Find(uint32_t id) const {
+  while (parent_[id] != id) {
+    parent_[id] = parent_[parent_[id]];
+    id = parent_[id];
+  }
+  return id;
+}
+
+uint32_t SparseReachability::FindRoot(uint32_t id) const {
+  while (parent_[id] != id) {
+    id = parent_[id];
+  }
+  return id;
+}
+
+uint32_t SparseReachability::NextMarkEpoch() const {
+  if (mark_epoch_ == std::numeric_limits<uint32_t>::max()) {
+    std::fill(forward_marks_.begin(), forward_marks_.end(), 0U);
+    std::fill(backward_marks_.begin(), backward_marks_.end(), 0U);
+    mark_epoch_ = 0U;
+  }
+  return ++mark_epoch_;
+}
+
+void SparseReachability::NormalizeEdges(uint32_t group) {
+  for (auto *edges : {&out_edges_[group], &in_edges_[group]}) {
+    for (auto &peer : *edges) {
+      peer = Find(peer);
+    }
+    std::sort(edges->begin(), edges->end());
+    edges->erase(std::unique(edges->begin(), edges->end()), edges->end());
+    const auto self_iter = std::lower_bound(edges->begin(), edges->end(), group);
+    if ((self_iter != edges->end()) && (*self_iter == group)) {
+      (void)edges->erase(self_iter);
+    }
+  }
+}
+
+void SparseReachability::AddEdge(uint32_t src, uint32_t dst) {
+  const uint32_t src_group = Find(src);
+  const uint32_t dst_group = Find(dst);
+  out_edges_[src_group].emplace_back(dst_group);
+  in_edges_[dst_group].emplace_back(src_group);
+  if ((!finalized_) || (src_group == dst_group) || (ord_[src_group] < ord_[dst_group])) {
+    return;
+  }
+
+  // 新边违反拓扑序，dst在窗口内的后继若包含src则成环，收缩环上所有节点
+  const uint32_t lower_ord = ord_[dst_group];
+  const uint32_t upper_ord = ord_[src_group];
+  const uint32_t epoch = NextMarkEpoch();
+  std::vector<uint32_t> after = {dst_group};
+  forward_marks_[dst_group] = epoch;
+  CollectReachable(after, true, lower_ord, upper_ord + 1U, forward_marks_, after);
+  if (forward_marks_[src_group] == epoch) {
+    Contract({src_group, dst_group});
+    return;
+  }
+  std::vector<uint32_t> before = {src_group};
+  backward_marks_[src_group] = epoch;
+  CollectReachable(before, false, lower_ord, upper_ord, backward_marks_, before);
+  std::vector<uint32_t> slots;
+  slots.reserve(before.size() + after.size());
+  for (const uint32_t group : before) {
+    slots.emplace_back(ord_[group]);
+  }
+  for (const uint32_t group : after) {
+    slots.emplace_back(ord_[group]);
+  }
+  AssignOrder(before, kInvalidId, after, slots);
+}
+
+void SparseReachability::CollectReachable(const std::vector<uint32_t> &sources, bool forward, uint32_t lower_ord,
+                                          uint32_t upper_ord, std::vector<uint32_t> &marks,
+                                          std::vector<uint32_t> &result) const {
+  const uint32_t epoch = mark_epoch_;
+  const auto &edges = forward ? out_edges_ : in_edges_;
+  stack_.assign(sources.begin(), sources.end());
+  while (!stack_.empty()) {
+    const uint32_t group = stack_.back();
+    stack_.pop_back();
+    for (const uint32_t peer : edges[group]) {
+      const uint32_t peer_group = Find(peer);
+      if ((marks[peer_group] == epoch) || (ord_[peer_group] <= lower_ord) || (ord_[peer_group] >= upper_ord)) {
+        continue;
+      }
+      marks[peer_group] = epoch;
+      result.emplace_back(peer_group);
+      stack_.emplace_back(peer_group);
+    }
+  }
+}
+
+void SparseReachability::AssignOrder(std::vector<uint32_t> &before, uint32_t group, std::vector<uint32_t> &after,
+                                     std::vector<uint32_t> &slots) {
+  const auto by_ord = [this](const uint32_t lhs, const uint32_t rhs) { return ord_[lhs] < ord_[rhs]; };
+  std::sort(before.begin(), before.end(), by_ord);
+  std::sort(after.begin(), after.end(), by_ord);
+  std::sort(slots.begin(), slots.end());
+  size_t slot_idx = 0U;
+  for (const uint32_t node : before) {
+    ord_[node] = slots[slot_idx++];
+  }
+  if (group != kInvalidId) {
+    ord_[group] = slots[slot_idx++];
+  }
+  // 前驱分组取最小的序号，后继分组取最大的序号，与窗口内未移动的分组仍满足拓扑序
+  slot_idx = slots.size() - after.size();
+  for (const uint32_t node : after) {
+    ord_[node] = slots[slot_idx++];
+  }
+}
+
+void SparseReachability::MergeGroups(const std::vector<uint32_t> &groups) {
+  const uint32_t root = groups.front();
+  for (size_t i = 1U; i < groups.size(); ++i) {
+    const uint32_t group = groups[i];
+    parent_[group] = root;
+    out_edges_[root].insert(out_edges_[root].end(), out_edges_[group].begin(), out_edges_[group].end());
+    in_edges_[root].insert(in_edges_[root].end(), in_edges_[group].begin(), in_edges_[group].end());
+    std::vector<uint32_t>().swap(out_edges_[group]);
+    std::vector<uint32_t>().swap(in_edges_[group]);
+  }
+  NormalizeEdges(root);
+}
+
+void SparseReachability::Contract(const std::vector<uint32_t> &nodes) {
+  std::vector<uint32_t> groups;
+  groups.reserve(nodes.size());
+  for (const uint32_t node : nodes) {
+    if (node < parent_.size()) {
+      groups.emplace_back(Find(node));
+    }
+  }
+  std::sort(groups.begin(), groups.end());
+  groups.erase(std::unique(groups.begin(), groups.end()), groups.end());
+  if (groups.size() < 2U) {
+    return;
+  }
+  if (!finalized_) {
+    MergeGroups(groups);
+    return;
+  }
+
+  uint32_t lower_ord = std::numeric_limits<uint32_t>::max();
+  uint32_t upper_ord = 0U;
+  const uint32_t epoch = NextMarkEpoch();
+  for (const uint32_t group : groups) {
+    lower_ord = std::min(lower_ord, ord_[group]);
+    upper_ord = std::max(upper_ord, ord_[group]);
+    forward_marks_[group] = epoch;
+    backward_marks_[group] = epoch;
+  }
+  // 窗口内既是融合节点的后继又是前驱的节点位于融合节点之间的路径上
+  std::vector<uint32_t> descendants;
+  std::vector<uint32_t> ancestors;
+  CollectReachable(groups, true, lower_ord, upper_ord, forward_marks_, descendants);
+  CollectReachable(groups, false, lower_ord, upper_ord, backward_marks_, ancestors);
+
+  std::vector<uint32_t> slots;
+  slots.reserve(groups.size() + descendants.size() + ancestors.size());
+  for (const uint32_t group : groups) {
+    slots.emplace_back(ord_[group]);
+  }
+  std::vector<uint32_t> after;
+  for (const uint32_t group : descendants) {
+    slots.emplace_back(ord_[group]);
+    if (backward_marks_[group] == epoch) {
+      groups.emplace_back(group);
+    } else {
+      after.emplace_back(group);
+    }
+  }
+  std::vector<uint32_t> before;
+  for (const uint32_t group : ancestors) {
+    if (forward_marks_[group] != epoch) {
+      slots.emplace_back(ord_[group]);
+      before.emplace_back(group);
+    }
+  }
+  MergeGroups(groups);
+  AssignOrder(before, groups.front(), after, slots);
+}
+
+void SparseReachability::Finalize() {
+  // 迭代版Tarjan，强连通分量按逆拓扑序产生
+  const auto node_num = static_cast<uint32_t>(parent_.size());
+  std::vector<uint32_t> index(node_num, kInvalidId);
+  std::vector<uint32_t> low(node_num, 0U);
+  std::vector<bool> on_stack(node_num, false);
+  std::vector<uint32_t> scc_stack;
+  std::vector<std::pair<uint32_t, size_t>> call_stack;
+  std::vector<uint32_t> scc_roots;
+  std::vector<uint32_t> members;
+  uint32_t next_index = 0U;
+  for (uint32_t root = 0U; root < node_num; ++root) {
+    if ((index[root] != kInvalidId) || (parent_[root] != root)) {
+      continue;
+    }
+    index[root] = next_index;
+    low[root] = next_index++;
+    scc_stack.emplace_back(root);
+    on_stack[root] = true;
+    call_stack.emplace_back(root, 0U);
+    while (!call_stack.empty()) {
+      const uint32_t node = call_stack.back().first;
+      const size_t edge_idx = call_stack.back().second;
+      if (edge_idx < out_edges_[node].size()) {
+        ++call_stack.back().second;
+        const uint32_t peer = Find(out_edges_[node][edge_idx]);
+        if (index[peer] == kInvalidId) {
+          index[peer] = next_index;
+          low[peer] = next_index++;
+          scc_stack.emplace_back(peer);
+          on_stack[peer] = true;
+          call_stack.emplace_back(peer, 0U);
+        } else if (on_stack[peer]) {
+          low[node] = std::min(low[node], index[peer]);
+        }
+        continue;
+      }
+      call_stack.pop_back();
+      if (!call_stack.empty()) {
+        const uint32_t caller = call_stack.back().first;
+        low[caller] = std::min(low[caller], low[node]);
+      }
+      if (low[node] != index[node]) {
+        continue;
+      }
+      members.clear();
+      uint32_t member = kInvalidId;
+      while (member != node) {
+        member = scc_stack.back();
+        scc_stack.pop_back();
+        on_stack[member] = false;
+        members.emplace_back(member);
+      }
+      std::swap(members.front(), members.back());
+      MergeGroups(members);
+      scc_roots.emplace_back(node);
+    }
+  }
+
+  next_ord_ = static_cast<uint32_t>(scc_roots.size());
+  for (size_t i = 0U; i < scc_roots.size(); ++i) {
+    ord_[scc_roots[i]] = next_ord_ - 1U - static_cast<uint32_t>(i);
+  }
+  finalized_ = true;
+}
+
+bool SparseReachability::IsReachable(uint32_t src, uint32_t dst) const {
+  if ((src >= parent_.size()) || (dst >= parent_.size())) {
+    return false;
+  }
+  const uint32_t src_group = FindRoot(src);
+  const uint32_t dst_group = FindRoot(dst);
+  if (src_group == dst_group) {
+    return true;
+  }
+  if (finalized_ && (ord_[src_group] > ord_[dst_group])) {
+    return false;
+  }
+  const std::lock_guard<std::mutex> lock(query_mutex_);
+  const uint32_t epoch = NextMarkEpoch();
+  const uint32_t upper_ord = ord_[dst_group];
+  forward_marks_[src_group] = epoch;
+  stack_.assign(1U, src_group);
+  while (!stack_.empty()) {
+    const uint32_t group = stack_.back();
+    stack_.pop_back();
+    for (const uint32_t peer : out_edges_[group]) {
+      const uint32_t peer_group = FindRoot(peer);
+      if (peer_group == dst_group) {
+        return true;
+      }
+      if ((forward_marks_[peer_group] == epoch) || (finalized_ && (ord_[peer_group] > upper_ord))) {
+        continue;
+      }
+      forward_marks_[peer_group] = epoch;
+      stack_.emplace_back(peer_group);
+    }
+  }
+  return false;
+}
+
+size_t SparseReachability::GetMemorySize() const {
+  size_t size = sizeof(*this) + GetVectorSize(parent_) + GetVectorSize(ord_) + GetVectorSize(out_edges_) +
+                GetVectorSize(in_edges_) + GetVectorSize(forward_marks_) + GetVectorSize(backward_marks_) +
+                GetVectorSize(stack_);
+  for (size_t i = 0U; i < out_edges_.size(); ++i) {
+    size += GetVectorSize(out_edges_[i]) + GetVectorSize(in_edges_[i]);
+  }
+  return size;
+}
+}  // namespace ge
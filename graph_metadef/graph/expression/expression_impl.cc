@@ -25,6 +25,7 @@
 #include "expr_print_manager.h"
 #include "const_values.h"
 #include "expr_parser.h"
+#include "expression_table.h"
 #include "common/checker.h"
 
 namespace ge {
@@ -230,7 +231,9 @@ ExpressionImplPtr ExpressionImpl::Replace(const std::map<ExpressionImpl *, Expre
     sym_replace_vars.emplace(sym_expr_impl_ptr_item.first->sym_expr_, sym_expr_impl_ptr_item.second->sym_expr_);
   }
   GE_ASSERT_TRUE(!sym_expr_.is_null());
-  SymEngineExprPtr replaced_expr = sym_expr_->xreplace(sym_replace_vars);
+  SymEngineExprPtr replaced_expr = ExpressionTable::GetInstance().Substitute(
+      SubstituteType::kReplace, sym_expr_, sym_replace_vars,
+      [this, &sym_replace_vars]() { return sym_expr_->xreplace(sym_replace_vars); });
   return ExpressionImpl::CreateExpressionImpl<const SymEngineExprPtr &>(replaced_expr);
 }
 
@@ -244,7 +247,9 @@ ExpressionImplPtr ExpressionImpl::Subs(const std::map<ExpressionImpl *, Expressi
     sym_replace_vars.emplace(sym_expr_impl_ptr_item.first->sym_expr_, sym_expr_impl_ptr_item.second->sym_expr_);
   }
   GE_ASSERT_TRUE(!sym_expr_.is_null());
-  SymEngineExprPtr subs_expr = sym_expr_->subs(sym_replace_vars);
+  SymEngineExprPtr subs_expr = ExpressionTable::GetInstance().Substitute(
+      SubstituteType::kSubs, sym_expr_, sym_replace_vars,
+      [this, &sym_replace_vars]() { return sym_expr_->subs(sym_replace_vars); });
   return ExpressionImpl::CreateExpressionImpl<const SymEngineExprPtr &>(subs_expr);
 }
 
@@ -257,8 +262,10 @@ void ExpressionImpl::AsNumerDenom(ExpressionImplPtr &numer, ExpressionImplPtr &d
 }
 
 ExpressionImplPtr ExpressionImpl::Simplify() const {
-  SymEngineExprPtr expanded_expr = SymEngine::expand(sym_expr_);
-  SymEngineExprPtr simplified_expr = SymEngine::simplify(expanded_expr);
+  SymEngineExprPtr simplified_expr = ExpressionTable::GetInstance().Simplify(sym_expr_, [this]() {
+    SymEngineExprPtr expanded_expr = SymEngine::expand(sym_expr_);
+    return SymEngine::simplify(expanded_expr);
+  });
   return ExpressionImpl::CreateExpressionImpl<const SymEngineExprPtr &>(simplified_expr);
 }
 
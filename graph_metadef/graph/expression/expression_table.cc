@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "expression_table.h"
+
+#include "common/checker.h"
+
+namespace ge {
+namespace {
+// 表项超过该值时整体清空，限制常驻内存
+constexpr size_t kMaxExprNum = 1UL << 20U;
+}  // namespace
+
+SymEngineExprPtr ExpressionTable::Intern(const SymEngineExprPtr &expr) {
+  if (expr.is_null()) {
+    return expr;
+  }
+  const std::lock_guard<std::mutex> lk(mutex_);
+  if (id_to_expr_.size() >= kMaxExprNum) {
+    ClearLocked();
+  }
+  return id_to_expr_[InternLocked(expr)];
+}
+
+SymEngineExprPtr ExpressionTable::Simplify(const SymEngineExprPtr &expr, const ComputeFunc &func) {
+  if (expr.is_null()) {
+    return func();
+  }
+  uint64_t expr_id = 0UL;
+  uint64_t generation = 0UL;
+  {
+    const std::lock_guard<std::mutex> lk(mutex_);
+    if (id_to_expr_.size() >= kMaxExprNum) {
+      ClearLocked();
+    }
+    expr_id = InternLocked(expr);
+    const auto iter = simplify_memo_.find(expr_id);
+    if (iter != simplify_memo_.end()) {
+      return id_to_expr_[iter->second];
+    }
+    generation = generation_;
+  }
+
+  const SymEngineExprPtr result = func();
+  const std::lock_guard<std::mutex> lk(mutex_);
+  if (result.is_null() || (generation != generation_)) {
+    return result;
+  }
+  const uint64_t result_id = InternLocked(result);
+  simplify_memo_[expr_id] = result_id;
+  return id_to_expr_[result_id];
+}
+
+SymEngineExprPtr ExpressionTable::Substitute(const SubstituteType type, const SymEngineExprPtr &expr,
+                                             const SymEngine::map_basic_basic &vars, const ComputeFunc &func) {
+  if (expr.is_null()) {
+    return func();
+  }
+  std::vector<uint64_t> key;
+  key.reserve((vars.size() * 2U) + 2U);
+  uint64_t generation = 0UL;
+  {
+    const std::lock_guard<std::mutex> lk(mutex_);
+    if (id_to_expr_.size() >= kMaxExprNum) {
+      ClearLocked();
+    }
+    key.emplace_back(static_cast<uint64_t>(type));
+    key.emplace_back(InternLocked(expr));
+    // map_basic_basic按结构有序，结构相同的替换表生成相同的key
+    for (const auto &var : vars) {
+      key.emplace_back(InternLocked(var.first));
+      key.emplace_back(InternLocked(var.second));
+    }
+    const auto iter = substitute_memo_.find(key);
+    if (iter != substitute_memo_.end()) {
+      return id_to_expr_[iter->second];
+    }
+    generation = generation_;
+  }
+
+  const SymEngineExprPtr result = func();
+  const std::lock_guard<std::mutex> lk(mutex_);
+  if (result.is_null() || (generation != generation_)) {
+    return result;
+  }
+  const uint64_t result_id = InternLocked(result);
+  substitute_memo_[std::move(key)] = result_id;
+  return id_to_expr_[result_id];
+}
+
+size_t ExpressionTable::Size() const {
+  const std::lock_guard<std::mutex> lk(mutex_);
+  return id_to_expr_.size();
+}
+
+void ExpressionTable::Clear() {
+  const std::lock_guard<std::mutex> lk(mutex_);
+  ClearLocked();
+}
+
+uint64_t ExpressionTable::InternLocked(const SymEngineExprPtr &expr) {
+  const auto iter = expr_to_id_.find(expr);
+  if (iter != expr_to_id_.end()) {
+    return iter->second;
+  }
+  const auto id = static_cast<uint64_t>(id_to_expr_.size());
+  id_to_expr_.emplace_back(expr);
+  (void)expr_to_id_.emplace(expr, id);
+  return id;
+}
+
+void ExpressionTable::ClearLocked() {
+  GELOGD("Clear expression table, expr num: %zu, generation: %lu.", id_to_expr_.size(), generation_);
+  expr_to_id_.clear();
+  id_to_expr_.clear();
+  simplify_memo_.clear();
+  substitute_memo_.clear();
+  ++generation_;
+}
+}  // namespace ge
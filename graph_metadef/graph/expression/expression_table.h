@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef GRAPH_EXPRESSION_EXPRESSION_TABLE_H_
+#define GRAPH_EXPRESSION_EXPRESSION_TABLE_H_
+#include <functional>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <symengine/basic.h>
+
+#include "expression_impl.h"
+
+namespace ge {
+enum class SubstituteType : uint64_t { kReplace = 0, kSubs };
+
+/**
+ * 表达式的hash-consing表：结构相同的表达式共享同一个id与规范化的SymEngine对象(hash在对象内只计算一次)，
+ * Simplify/Replace/Subs的结果以id为键缓存，避免符号推导中对同一表达式反复化简与替换。
+ * 表项超过上限时整体清空，已返回给调用者的表达式不受影响。
+ */
+class ExpressionTable {
+ public:
+  using ComputeFunc = std::function<SymEngineExprPtr()>;
+
+  static ExpressionTable &GetInstance() {
+    static ExpressionTable instance;
+    return instance;
+  }
+
+  // 返回与expr结构相同的规范化表达式
+  SymEngineExprPtr Intern(const SymEngineExprPtr &expr);
+  // 未命中缓存时在锁外调用func计算，func的结果必须只由expr(及vars)决定
+  SymEngineExprPtr Simplify(const SymEngineExprPtr &expr, const ComputeFunc &func);
+  SymEngineExprPtr Substitute(const SubstituteType type, const SymEngineExprPtr &expr,
+                              const SymEngine::map_basic_basic &vars, const ComputeFunc &func);
+
+  size_t Size() const;
+  void Clear();
+
+ private:
+  using IdMap = std::unordered_map<SymEngineExprPtr, uint64_t, SymEngine::RCPBasicHash, SymEngine::RCPBasicKeyEq>;
+
+  ExpressionTable() = default;
+  ~ExpressionTable() = default;
+  ExpressionTable(const ExpressionTable &) = delete;
+  ExpressionTable &operator=(const ExpressionTable &) = delete;
+
+  // 以下接口需在持锁时调用
+  uint64_t InternLocked(const SymEngineExprPtr &expr);
+  void ClearLocked();
+
+  mutable std::mutex mutex_;
+  // 每次清空后递增，用于丢弃清空前未命中、清空后才计算完成的结果
+  uint64_t generation_{0UL};
+  IdMap expr_to_id_;
+  std::vector<SymEngineExprPtr> id_to_expr_;
+  std::unordered_map<uint64_t, uint64_t> simplify_memo_;
+  // key: {SubstituteType, expr id, 被替换表达式id, 替换表达式id, ...}
+  std::map<std::vector<uint64_t>, uint64_t> substitute_memo_;
+};
+}  // namespace ge
+
+#endif  // GRAPH_EXPRESSION_EXPRESSION_TABLE_H_
@@ -52,66 +52,41 @@ void ConnectionMatrix::ExpandAndUpdate(const vector<ge::NodePtr> &fusion_nodes,
 
 ConnectionMatrixImpl::ConnectionMatrixImpl(const ComputeGraphPtr &graph) : graph_(graph) {
   const auto direct_nodes = graph->GetDirectNode();
-  size_ = direct_nodes.size();
-  bit_maps_.reserve(size_);
-  uint64_t index_loop = 0;
+  uint32_t index_loop = 0U;
   for (const auto &node : direct_nodes) {
     name_to_index_[node->GetName()] = index_loop;
-    bit_maps_.emplace_back(size_);
     index_loop++;
   }
-  used_ = size_;
+  reachability_.Reset(name_to_index_.size());
 };
 
 ConnectionMatrixImpl::~ConnectionMatrixImpl() {
-  bit_maps_.clear();
   name_to_index_.clear();
 }
 
 uint64_t ConnectionMatrixImpl::AddNode(const std::string &op_name) {
-  if (used_ + 1 >= size_) {
-    size_t new_size = size_ + expand_step_;
-    for (auto &m : bit_maps_) {
-      m.ResizeBits(new_size);
-    }
-
-    ge::LargeBitmap new_bit_vector(new_size);
-    bit_maps_.resize(new_size, new_bit_vector);
-    for (size_t i = used_; i < new_size; ++i) {
-      bit_maps_[i].SetValues(0);
-    }
-
-    size_ = new_size;
-  }
-
-  uint64_t new_index = used_;
-  ++used_;
+  const uint32_t new_index = reachability_.AddNode();
   name_to_index_[op_name] = new_index;
   return new_index;
 }
 
 void ConnectionMatrixImpl::ExpandAndUpdate(const vector<ge::NodePtr> &fusion_nodes, const std::string &node_name) {
-  uint64_t new_index = AddNode(node_name);
-  ge::LargeBitmap &new_bit_vector = GetBitMap(new_index);
-
-  // update
-  new_bit_vector.SetBit(new_index);
-  std::vector<uint64_t> fusion_indexs(fusion_nodes.size(), 0);
-  for (size_t i = 0U; i < fusion_nodes.size(); ++i) {
-    auto index = GetIndex(fusion_nodes[i]);
-    new_bit_vector.Or(GetBitMap(index));
-    fusion_indexs[i] = index;
-  }
-
-  for (size_t i = 0; i < used_; ++i) {
-    ge::LargeBitmap &node_map = bit_maps_[i];
-    for (size_t j = 0; j < fusion_nodes.size(); ++j) {
-      if (node_map.GetBit(fusion_indexs[j])) {
-        node_map.Or(new_bit_vector);
-        break;
-      }
+  std::vector<uint32_t> fusion_indexs;
+  fusion_indexs.reserve(fusion_nodes.size());
+  for (const auto &fusion_node : fusion_nodes) {
+    uint32_t index = 0U;
+    if (GetIndex(fusion_node, index)) {
+      fusion_indexs.emplace_back(index);
     }
   }
+  if (fusion_indexs.empty()) {
+    (void)AddNode(node_name);
+    return;
+  }
+
+  // 新节点与融合节点属于同一分组，继承其全部前驱与后继
+  reachability_.Contract(fusion_indexs);
+  name_to_index_[node_name] = reachability_.AddNodeToGroup(fusion_indexs.front());
 }
 
 graphStatus ConnectionMatrixImpl::Generate(const ComputeGraphPtr &graph) {
@@ -119,10 +94,12 @@ graphStatus ConnectionMatrixImpl::Generate(const ComputeGraphPtr &graph) {
   if (shared_graph == nullptr) {
     graph_ = graph;
   }
+  reachability_.Reset(name_to_index_.size());
   for (auto &node : graph->GetDirectNode()) {
     const auto inputs = node->GetInAllNodes();
     SetConnectivity(inputs, node);
   }
+  reachability_.Finalize();
   return GRAPH_SUCCESS;
 }
 
@@ -136,66 +113,51 @@ void ConnectionMatrixImpl::Update(const ComputeGraphPtr &graph, const vector<Nod
            shared_graph->GetName().c_str());
     return;
   }
-  LargeBitmap new_bit_vector(graph->GetDirectNode().size());
-  new_bit_vector.SetValues(0U);
-  for (size_t i = 0U; i < fusion_nodes.size(); i++) {
-    new_bit_vector.Or(GetBitMap(fusion_nodes[i]));
-  }
-  for (auto &node : graph->GetDirectNode()) {
-    bool is_connected_to_fusion = false;
-    for (size_t i = 0U; i < fusion_nodes.size(); i++) {
-      if (GetBitMap(node).GetBit(static_cast<size_t>(GetIndex(fusion_nodes[i])))) {
-        is_connected_to_fusion = true;
-        break;
-      }
-    }
-    if (is_connected_to_fusion) {
-      GetBitMap(node).Or(new_bit_vector);
+  std::vector<uint32_t> fusion_indexs;
+  fusion_indexs.reserve(fusion_nodes.size());
+  for (const auto &fusion_node : fusion_nodes) {
+    uint32_t index = 0U;
+    if (GetIndex(fusion_node, index)) {
+      fusion_indexs.emplace_back(index);
     }
   }
+  reachability_.Contract(fusion_indexs);
 }
 
 void ConnectionMatrixImpl::SetConnectivity(const Node::Vistor<NodePtr> &inputs, const NodePtr &node) {
-  LargeBitmap &bitmap = GetBitMap(node);
-  if (std::find(inputs.begin(), inputs.end(), node) == inputs.end()) {
-    bitmap.SetValues(0U);
+  uint32_t node_index = 0U;
+  if (!GetIndex(node, node_index)) {
+    return;
   }
-
-  bitmap.SetBit(static_cast<size_t>(GetIndex(node)));
   for (const NodePtr &input : inputs) {
-    if (input != node) {
-      bitmap.Or(GetBitMap(input));
+    uint32_t input_index = 0U;
+    if ((input != node) && GetIndex(input, input_index)) {
+      reachability_.AddEdge(input_index, node_index);
     }
   }
 }
 
-uint64_t ConnectionMatrixImpl::GetIndex(const std::string &op_name) const {
+bool ConnectionMatrixImpl::GetIndex(const std::string &op_name, uint32_t &index) const {
   const auto iter = name_to_index_.find(op_name);
   if (iter != name_to_index_.end()) {
-    return iter->second;
+    index = iter->second;
+    return true;
   } else {
     GELOGW("node %s is not found in name_to_index_", op_name.c_str());
-    return 0;
+    return false;
   }
 }
 
-uint64_t ConnectionMatrixImpl::GetIndex(const NodePtr &node) const {
-  return GetIndex(node->GetName());
+bool ConnectionMatrixImpl::GetIndex(const NodePtr &node, uint32_t &index) const {
+  return GetIndex(node->GetName(), index);
 }
 
 bool ConnectionMatrixImpl::IsConnected(const NodePtr &a, const NodePtr &b) const {
-  return GetBitMap(b).GetBit(static_cast<size_t>(GetIndex(a)));
-}
-
-const LargeBitmap &ConnectionMatrixImpl::GetBitMap(const NodePtr &node) const {
-  return bit_maps_[static_cast<uint64_t>(GetIndex(node))];
-}
-
-LargeBitmap &ConnectionMatrixImpl::GetBitMap(const NodePtr &node) {
-  return bit_maps_[static_cast<uint64_t>(GetIndex(node))];
-}
-
-LargeBitmap &ConnectionMatrixImpl::GetBitMap(uint64_t index) {
-  return bit_maps_[index];
+  uint32_t index_a = 0U;
+  uint32_t index_b = 0U;
+  if ((!GetIndex(a, index_a)) || (!GetIndex(b, index_b))) {
+    return false;
+  }
+  return reachability_.IsReachable(index_a, index_b);
 }
 }  // namespace ge
@@ -15,7 +15,7 @@
 #include "graph/node.h"
 #include "graph/graph.h"
 #include "graph/compute_graph.h"
-#include "common/large_bm.h"
+#include "common/sparse_reachability.h"
 
 namespace ge {
 class ConnectionMatrixImpl {
@@ -30,6 +30,7 @@ class ConnectionMatrixImpl {
   // if there is a path between A->B, then B will own A's
   // connectivity. The reason is ---
   // If some node can reach A, than it can also reach B.
+  // After Generate, edges are added incrementally and existing connectivity is kept.
   void SetConnectivity(const Node::Vistor<NodePtr> &inputs, const NodePtr &node);
 
   /* Computes the connectivity between two nodes in the
@@ -49,23 +50,14 @@ class ConnectionMatrixImpl {
 
  private:
   ConnectionMatrixImpl() = delete;
-  uint64_t GetIndex(const NodePtr &node) const;
+  bool GetIndex(const NodePtr &node, uint32_t &index) const;
 
-  uint64_t GetIndex(const std::string &op_name) const;
+  bool GetIndex(const std::string &op_name, uint32_t &index) const;
 
-  const LargeBitmap &GetBitMap(const NodePtr &node) const;
+  // 按拓扑序剪枝的稀疏可达性，内存与节点数和边数成正比
+  SparseReachability reachability_;
 
-  LargeBitmap &GetBitMap(const NodePtr &node);
-
-  LargeBitmap &GetBitMap(uint64_t index);
-
-  size_t size_ = 0;
-  size_t used_ = 0;
-  size_t expand_step_ = 64;
-
-  std::vector<LargeBitmap> bit_maps_;
-
-  std::unordered_map<std::string, uint64_t> name_to_index_;
+  std::unordered_map<std::string, uint32_t> name_to_index_;
 
   std::weak_ptr<ComputeGraph> graph_;
 };
@@ -19,31 +19,21 @@ ConnectionMatrix::ConnectionMatrix(const ge::ComputeGraph &graph) : enable_data_
 }
 
 ConnectionMatrix::~ConnectionMatrix() {
-  bit_maps.clear();
   name_to_index_.clear();
-  bit_maps_back_up_.clear();
-  data_bit_maps_.clear();
-  data_bit_maps_back_up_.clear();
 }
 
 void ConnectionMatrix::Generate(const ge::ComputeGraph &graph) {
-  bit_maps.clear();
-  data_bit_maps_.clear();
   name_to_index_.clear();
   const ge::ComputeGraph::Vistor<ge::NodePtr> direct_nodes = graph.GetDirectNode();
   size_ = direct_nodes.size();
-  bit_maps.reserve(size_);
-  int64_t index_loop = 0;
+  uint32_t index_loop = 0U;
   for (const ge::NodePtr &node : direct_nodes) {
     name_to_index_[node->GetName()] = index_loop;
-    (void)bit_maps.emplace_back(size_);
     index_loop++;
   }
 
-  if (enable_data_flow_) {
-    data_bit_maps_ = bit_maps;
-  }
-
+  reachability_.Reset(size_);
+  data_reachability_.Reset(enable_data_flow_ ? size_ : 0U);
   for (const ge::NodePtr &node : direct_nodes) {
     const ge::Node::Vistor<ge::NodePtr> inputs = node->GetInAllNodes();
     SetConnectivity(inputs, node);
@@ -52,121 +42,89 @@ void ConnectionMatrix::Generate(const ge::ComputeGraph &graph) {
       SetDataConnectivity(data_inputs, node);
     }
   }
+  reachability_.Finalize();
+  data_reachability_.Finalize();
 }
 
 void ConnectionMatrix::Update(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &fusion_nodes) {
-  ge::LargeBitmap new_bit_vector(graph.GetDirectNodesSize());
-  new_bit_vector.SetValues(0U);
-  std::vector<uint64_t> fusion_indexs(fusion_nodes.size(), 0);
-  for (size_t i = 0U; i < fusion_nodes.size(); ++i) {
-    const uint64_t index = static_cast<uint64_t>(GetIndex(fusion_nodes[i]));
-    new_bit_vector.Or(GetBitMap(index));
-    fusion_indexs[i] = index;
-  }
-
-  for (ge::LargeBitmap &node_map : bit_maps) {
-    for (size_t i = 0U; i < fusion_nodes.size(); ++i) {
-      if (node_map.GetBit(fusion_indexs[i])) {
-        node_map.Or(new_bit_vector);
-        break;
-      }
+  (void)graph;
+  std::vector<uint32_t> fusion_indexs;
+  fusion_indexs.reserve(fusion_nodes.size());
+  for (const ge::NodePtr &fusion_node : fusion_nodes) {
+    uint32_t index = 0U;
+    if (GetIndex(fusion_node, index)) {
+      fusion_indexs.emplace_back(index);
     }
   }
 
+  reachability_.Contract(fusion_indexs);
   if (enable_data_flow_) {
-    new_bit_vector.SetValues(0U);
-    for (size_t i = 0U; i < fusion_nodes.size(); ++i) {
-      const uint64_t index = static_cast<uint64_t>(GetIndex(fusion_nodes[i]));
-      new_bit_vector.Or(GetDataBitMap(index));
-    }
-    for (ge::LargeBitmap &node_map : data_bit_maps_) {
-      for (size_t i = 0U; i < fusion_nodes.size(); ++i) {
-        if (node_map.GetBit(fusion_indexs[i])) {
-          node_map.Or(new_bit_vector);
-          break;
-        }
-      }
-    }
+    data_reachability_.Contract(fusion_indexs);
   }
 }
 
 void ConnectionMatrix::BackupBitMap() {
-  bit_maps_back_up_ = bit_maps;
-  data_bit_maps_back_up_ = data_bit_maps_;
+  reachability_back_up_ = reachability_;
+  data_reachability_back_up_ = data_reachability_;
 }
 
 void ConnectionMatrix::RestoreBitMap() {
-  bit_maps = bit_maps_back_up_;
-  data_bit_maps_ = data_bit_maps_back_up_;
+  reachability_ = reachability_back_up_;
+  data_reachability_ = data_reachability_back_up_;
 }
 
 void ConnectionMatrix::SetConnectivity(const ge::Node::Vistor<ge::NodePtr> &inputs, const ge::NodePtr &node) {
-  ge::LargeBitmap &bitmap = GetBitMap(node);
-  if (std::find(inputs.begin(), inputs.end(), node) == inputs.end()) {
-    bitmap.SetValues(0);
+  uint32_t node_index = 0U;
+  if (!GetIndex(node, node_index)) {
+    return;
   }
-
-  bitmap.SetBit(static_cast<size_t>(GetIndex(node)));
   for (const ge::NodePtr &input : inputs) {
-    if (input != node) {
-      bitmap.Or(GetBitMap(input));
+    uint32_t input_index = 0U;
+    if ((input != node) && GetIndex(input, input_index)) {
+      reachability_.AddEdge(input_index, node_index);
     }
   }
 }
 
 void ConnectionMatrix::SetDataConnectivity(const ge::Node::Vistor<ge::NodePtr> &inputs, const ge::NodePtr &node) {
-  ge::LargeBitmap &bitmap = GetDataBitMap(node);
-  if (std::find(inputs.begin(), inputs.end(), node) == inputs.end()) {
-    bitmap.SetValues(0);
+  uint32_t node_index = 0U;
+  if (!GetIndex(node, node_index)) {
+    return;
   }
-
-  bitmap.SetBit(static_cast<size_t>(GetIndex(node)));
   for (const ge::NodePtr &input : inputs) {
-    if (input != node) {
-      bitmap.Or(GetDataBitMap(input));
+    uint32_t input_index = 0U;
+    if ((input != node) && GetIndex(input, input_index)) {
+      data_reachability_.AddEdge(input_index, node_index);
     }
   }
 }
 
-int64_t ConnectionMatrix::GetIndex(const ge::NodePtr &node) const {
+bool ConnectionMatrix::GetIndex(const ge::NodePtr &node, uint32_t &index) const {
   const auto iter = name_to_index_.find(node->GetName());
   if (iter != name_to_index_.end()) {
-    return iter->second;
+    index = iter->second;
+    return true;
   } else {
     GELOGW("Node %s was not found in name_to_index_.", node->GetName().c_str());
-    return 0;
+    return false;
   }
 }
 
 bool ConnectionMatrix::IsConnected(const ge::NodePtr &a, const ge::NodePtr &b) const {
-  return GetBitMap(b).GetBit(static_cast<size_t>(GetIndex(a)));
+  uint32_t index_a = 0U;
+  uint32_t index_b = 0U;
+  if ((!GetIndex(a, index_a)) || (!GetIndex(b, index_b))) {
+    return false;
+  }
+  return reachability_.IsReachable(index_a, index_b);
 }
 
 bool ConnectionMatrix::IsDataConnected(const ge::NodePtr &a, const ge::NodePtr &b) const {
-  return GetDataBitMap(b).GetBit(static_cast<size_t>(GetIndex(a)));
-}
-
-const ge::LargeBitmap &ConnectionMatrix::GetBitMap(const ge::NodePtr &node) const {
-  return bit_maps[static_cast<uint64_t>(GetIndex(node))];
-}
-
-ge::LargeBitmap &ConnectionMatrix::GetBitMap(const ge::NodePtr &node) {
-  return bit_maps[static_cast<uint64_t>(GetIndex(node))];
-}
-
-ge::LargeBitmap &ConnectionMatrix::GetBitMap(uint64_t index) {
-  return bit_maps[index];
-}
-
-const ge::LargeBitmap &ConnectionMatrix::GetDataBitMap(const ge::NodePtr &node) const {
-  return data_bit_maps_[static_cast<uint64_t>(GetIndex(node))];
-}
-
-ge::LargeBitmap &ConnectionMatrix::GetDataBitMap(const ge::NodePtr &node) {
-  return data_bit_maps_[static_cast<uint64_t>(GetIndex(node))];
-}
-
-ge::LargeBitmap &ConnectionMatrix::GetDataBitMap(uint64_t index) {
-  return data_bit_maps_[index];
+  uint32_t index_a = 0U;
+  uint32_t index_b = 0U;
+  if ((!GetIndex(a, index_a)) || (!GetIndex(b, index_b))) {
+    return false;
+  }
+  return data_reachability_.IsReachable(index_a, index_b);
 }
 }  // namespace fe
@@ -0,0 +1,306 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include "framework/common/debug/ge_log.h"
+#include "graph/utils/node_utils.h"
+
+namespace fe {
+namespace {
+const std::string kAttrFusionPatternIndex = "FusionPatternIndex";
+constexpr uint64_t kHashSeed = 0x9e3779b97f4a7c15UL;
+
+inline void HashCombine(uint64_t &seed, const uint64_t value) {
+  seed ^= value + kHashSeed + (seed << 6U) + (seed >> 2U);
+}
+}  // namespace
+
+void FusionPatternIndex::AddPattern(const FusionPattern *pattern) {
+  if ((pattern == nullptr) || (pattern_to_entry_.count(pattern) > 0U)) {
+    return;
+  }
+  const FusionPattern::OpDescPtr output_op_desc = pattern->GetOutput();
+  if (output_op_desc == nullptr) {
+    GELOGD("Pattern %s has no output op desc, it is not indexed.", pattern->GetName().c_str());
+    return;
+  }
+  PatternEntry entry;
+  entry.output_types = output_op_desc->types;
+  entry.candidates.resize(entry.output_types.size());
+  const std::vector<FusionPattern::OpDescPtr> *const inputs_desc = FusionPattern::GetInputs(output_op_desc);
+  if (inputs_desc != nullptr) {
+    entry.need_inputs = !inputs_desc->empty();
+    for (const auto &input_desc : *inputs_desc) {
+      if ((input_desc != nullptr) && (!input_desc->types.empty())) {
+        entry.input_types.emplace_back(input_desc->types);
+      }
+    }
+  }
+  entry.check_output_size = output_op_desc->is_output_fullmatch && (!FusionPattern::GetOutputs(output_op_desc).empty());
+  entry.output_size = FusionPattern::GetOutputSize(output_op_desc);
+
+  const size_t entry_idx = entries_.size();
+  entries_.emplace_back(std::move(entry));
+  pattern_to_entry_[pattern] = entry_idx;
+  for (size_t type_idx = 0U; type_idx < entries_[entry_idx].output_types.size(); ++type_idx) {
+    type_to_entries_[entries_[entry_idx].output_types[type_idx]].emplace_back(entry_idx, type_idx);
+  }
+
+  // 已建立索引后新增的pattern，只对已有节点匹配这一个pattern
+  std::vector<std::string> in_types;
+  for (auto &record_pair : records_) {
+    NodeRecord &record = record_pair.second;
+    const std::string node_type = ge::NodeUtils::GetNodeType(*record.node);
+    const auto &output_types = entries_[entry_idx].output_types;
+    for (size_t type_idx = 0U; type_idx < output_types.size(); ++type_idx) {
+      if (output_types[type_idx] != node_type) {
+        continue;
+      }
+      in_types.clear();
+      (void)CalcSignature(record.node, in_types);
+      if (IsEdgeShapeMatched(entries_[entry_idx], record.node, in_types)) {
+        entries_[entry_idx].candidates[type_idx][record.name] = record.node;
+        record.matched.emplace_back(entry_idx, type_idx);
+      }
+    }
+  }
+}
+
+void FusionPatternIndex::AddPatterns(const std::vector<FusionPattern *> &patterns) {
+  for (const FusionPattern *const pattern : patterns) {
+    AddPattern(pattern);
+  }
+}
+
+void FusionPatternIndex::Build(const ge::ComputeGraph &graph) {
+  records_.clear();
+  for (auto &entry : entries_) {
+    for (auto &candidates : entry.candidates) {
+      candidates.clear();
+    }
+  }
+  RefreshAll(graph);
+  GELOGD("Fusion pattern index of graph %s is built, pattern num %zu, node num %zu.", graph.GetName().c_str(),
+         entries_.size(), records_.size());
+}
+
+void FusionPatternIndex::Update(const ge::ComputeGraph &graph) {
+  RefreshAll(graph);
+  GELOGD("Fusion pattern index of graph %s is updated, %zu of %zu nodes are re-matched.", graph.GetName().c_str(),
+         last_matched_node_num_, records_.size());
+}
+
+void FusionPatternIndex::Update(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes) {
+  if (Refresh(graph, touched_nodes)) {
+    GELOGD("Fusion pattern index of graph %s is updated, %zu of %zu touched nodes are re-matched.",
+           graph.GetName().c_str(), last_matched_node_num_, touched_nodes.size());
+    return;
+  }
+  GELOGD("Fusion pattern index of graph %s is not consistent with touched nodes, traverse graph instead.",
+         graph.GetName().c_str());
+  Update(graph);
+}
+
+uint64_t FusionPatternIndex::CalcSignature(const ge::NodePtr &node, std::vector<std::string> &in_types) {
+  const std::hash<std::string> str_hash;
+  uint64_t signature = str_hash(node->GetName());
+  HashCombine(signature, str_hash(ge::NodeUtils::GetNodeType(*node)));
+  for (const auto &in_anchor : node->GetAllInDataAnchors()) {
+    if ((in_anchor == nullptr) || (in_anchor->GetPeerOutAnchor() == nullptr) ||
+        (in_anchor->GetPeerOutAnchor()->GetOwnerNode() == nullptr)) {
+      continue;
+    }
+    in_types.emplace_back(ge::NodeUtils::GetNodeType(*in_anchor->GetPeerOutAnchor()->GetOwnerNode()));
+    HashCombine(signature, static_cast<uint64_t>(in_anchor->GetIdx()));
+    HashCombine(signature, str_hash(in_types.back()));
+  }
+  HashCombine(signature, static_cast<uint64_t>(node->GetOutDataNodesSize()));
+  return signature;
+}
+
+bool FusionPatternIndex::IsEdgeShapeMatched(const PatternEntry &entry, const ge::NodePtr &node,
+                                            const std::vector<std::string> &in_types) const {
+  if (entry.need_inputs && in_types.empty()) {
+    return false;
+  }
+  for (const auto &types : entry.input_types) {
+    const bool found = std::any_of(in_types.begin(), in_types.end(), [&types](const std::string &in_type) {
+      return std::find(types.begin(), types.end(), in_type) != types.end();
+    });
+    if (!found) {
+      return false;
+    }
+  }
+  return (!entry.check_output_size) || (static_cast<size_t>(node->GetOutDataNodesSize()) == entry.output_size);
+}
+
+void FusionPatternIndex::MatchNode(const ge::NodePtr &node, const std::string &node_type,
+                                   const std::vector<std::string> &in_types, NodeRecord &record) {
+  record.node = node;
+  record.name = node->GetName();
+  record.matched.clear();
+  ++last_matched_node_num_;
+  const auto iter = type_to_entries_.find(node_type);
+  if (iter == type_to_entries_.end()) {
+    return;
+  }
+  for (const auto &entry_type : iter->second) {
+    PatternEntry &entry = entries_[entry_type.first];
+    if (IsEdgeShapeMatched(entry, node, in_types)) {
+      entry.candidates[entry_type.second][record.name] = node;
+      record.matched.emplace_back(entry_type);
+    }
+  }
+}
+
+void FusionPatternIndex::UnmatchNode(NodeRecord &record) {
+  for (const auto &entry_type : record.matched) {
+    auto &candidates = entries_[entry_type.first].candidates[entry_type.second];
+    const auto iter = candidates.find(record.name);
+    // 同名的新节点可能已经先于旧节点被记录
+    if ((iter != candidates.end()) && (iter->second == record.node)) {
+      (void)candidates.erase(iter);
+    }
+  }
+  record.matched.clear();
+}
+
+void FusionPatternIndex::RefreshNode(const ge::NodePtr &node, std::vector<std::string> &in_types) {
+  in_types.clear();
+  const uint64_t signature = CalcSignature(node, in_types);
+  auto iter = records_.find(node.get());
+  if (iter == records_.end()) {
+    iter = records_.emplace(node.get(), NodeRecord()).first;
+    MatchNode(node, ge::NodeUtils::GetNodeType(*node), in_types, iter->second);
+  } else if (iter->second.signature != signature) {
+    UnmatchNode(iter->second);
+    MatchNode(node, ge::NodeUtils::GetNodeType(*node), in_types, iter->second);
+  }
+  iter->second.signature = signature;
+  iter->second.visit_id = visit_id_;
+}
+
+bool FusionPatternIndex::Refresh(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes) {
+  last_matched_node_num_ = 0U;
+  std::vector<std::string> in_types;
+  std::unordered_set<const ge::Node *> visited;
+  // 被删除的节点已与图断开所有边，孤立节点先不处理，核对节点数后再决定是否移除
+  std::vector<ge::NodePtr> isolated_nodes;
+  size_t isolated_record_num = 0U;
+  for (const ge::NodePtr &node : touched_nodes) {
+    if ((node == nullptr) || (!visited.insert(node.get()).second)) {
+      continue;
+    }
+    if ((node->GetInNodesSize() == 0U) && (node->GetOutNodesSize() == 0U)) {
+      isolated_record_num += records_.count(node.get());
+      isolated_nodes.emplace_back(node);
+      continue;
+    }
+    RefreshNode(node, in_types);
+  }
+
+  // 孤立节点全部被删除时，图中节点数恰好等于去掉这些记录后的记录数，否则由调用者遍历整图
+  if (graph.GetDirectNodesSize() != (records_.size() - isolated_record_num)) {
+    return false;
+  }
+  for (const ge::NodePtr &node : isolated_nodes) {
+    const auto iter = records_.find(node.get());
+    if (iter != records_.end()) {
+      UnmatchNode(iter->second);
+      (void)records_.erase(iter);
+    }
+  }
+  return true;
+}
+
+void FusionPatternIndex::RefreshAll(const ge::ComputeGraph &graph) {
+  ++visit_id_;
+  last_matched_node_num_ = 0U;
+  std::vector<std::string> in_types;
+  for (const ge::NodePtr &node : graph.GetDirectNode()) {
+    if (node != nullptr) {
+      RefreshNode(node, in_types);
+    }
+  }
+
+  // 本次未访问到的节点已从图中删除
+  for (auto iter = records_.begin(); iter != records_.end();) {
+    if (iter->second.visit_id != visit_id_) {
+      UnmatchNode(iter->second);
+      iter = records_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+bool FusionPatternIndex::GetCandidates(const ge::ComputeGraph &graph, const FusionPattern &pattern,
+                                       std::vector<ge::NodePtr> &candidates) const {
+  const auto iter = pattern_to_entry_.find(&pattern);
+  if (iter == pattern_to_entry_.end()) {
+    return false;
+  }
+  if (graph.GetDirectNodesSize() != records_.size()) {
+    GELOGD("Fusion pattern index of graph %s is out of date, node num %zu, indexed node num %zu.",
+           graph.GetName().c_str(), graph.GetDirectNodesSize(), records_.size());
+    return false;
+  }
+  for (const auto &type_candidates : entries_[iter->second].candidates) {
+    for (const auto &name_node : type_candidates) {
+      candidates.emplace_back(name_node.second);
+    }
+  }
+  return true;
+}
+
+bool FusionPatternIndex::IsIndexed(const FusionPattern *pattern) const {
+  return pattern_to_entry_.count(pattern) > 0U;
+}
+
+FusionPatternIndexPtr FusionPatternIndex::GetFromGraph(const ge::ComputeGraph &graph) {
+  FusionPatternIndexPtr index = nullptr;
+  return graph.TryGetExtAttr(kAttrFusionPatternIndex, index);
+}
+
+void FusionPatternIndex::SetToGraph(ge::ComputeGraph &graph, const FusionPatternIndexPtr &index) {
+  (void)graph.SetExtAttr(kAttrFusionPatternIndex, index);
+}
+
+void FusionPatternIndex::UpdateInGraph(const ge::ComputeGraph &graph) {
+  const FusionPatternIndexPtr index = GetFromGraph(graph);
+  if (index != nullptr) {
+    index->Update(graph);
+  }
+}
+
+void FusionPatternIndex::UpdateInGraph(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes) {
+  const FusionPatternIndexPtr index = GetFromGraph(graph);
+  if (index != nullptr) {
+    index->Update(graph, touched_nodes);
+  }
+}
+
+void FusionPatternIndex::CollectTouchedNodes(const ge::NodePtr &node, std::vector<ge::NodePtr> &touched_nodes) {
+  if (node == nullptr) {
+    return;
+  }
+  touched_nodes.emplace_back(node);
+  // 输入节点的输出个数、输出节点的输入类型都可能随改写变化
+  for (const ge::NodePtr &in_node : node->GetInDataNodes()) {
+    touched_nodes.emplace_back(in_node);
+  }
+  for (const ge::NodePtr &out_node : node->GetOutDataNodes()) {
+    touched_nodes.emplace_back(out_node);
+  }
+}
+}  // namespace fe
@@ -20,6 +20,7 @@
 #include "register/graph_optimizer/fusion_common/fusion_statistic_recorder.h"
 #include "register/graph_optimizer/fusion_common/graph_pass_util.h"
 #include "register/graph_optimizer/graph_fusion/pattern_fusion_base_pass_impl.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
 #include "register/graph_optimizer/fusion_common/fusion_config_info.h"
 
 namespace fe {
@@ -203,6 +204,9 @@ Status PatternFusionBasePass::RunOnePattern(ge::ComputeGraph &graph, const Fusio
   NodeMapInfoPtr node_map_info = nullptr;
   // get nodes by type from node
   (void)GraphPassUtil::GetOpTypeMapToGraph(node_map_info, graph);
+  // only the nodes rewritten by this pattern and their neighbors need to be re-matched for the following patterns
+  const bool has_pattern_index = FusionPatternIndex::GetFromGraph(graph) != nullptr;
+  std::vector<ge::NodePtr> touched_nodes;
   // do fusion for each mapping
   for (Mapping &mapping : mappings) {
     GraphPassUtil::OriginOpAttrsVec origin_op_attrs;
@@ -210,6 +214,13 @@ Status PatternFusionBasePass::RunOnePattern(ge::ComputeGraph &graph, const Fusio
     StoreOriginNodes(mapping, origin_op_attrs, original_nodes);
     bool backward = false;
     GraphPassUtil::GetBackWardAttr(original_nodes, backward, BackWardInheritMode::kFusedNode);
+    // 被删除的节点改写后已断开所有边，需要在改写前记录其相邻节点
+    const size_t touched_begin = touched_nodes.size();
+    if (has_pattern_index) {
+      for (const ge::NodePtr &node : original_nodes) {
+        FusionPatternIndex::CollectTouchedNodes(node, touched_nodes);
+      }
+    }
     std::vector<ge::NodePtr> fus_nodes;
     const Status status = Fusion(graph, mapping, fus_nodes);
 
@@ -250,9 +261,22 @@ Status PatternFusionBasePass::RunOnePattern(ge::ComputeGraph &graph, const Fusio
       const BackWardInheritMode inherit_mode =
           backward ? BackWardInheritMode::kInheritTrue : BackWardInheritMode::kDoNotInherit;
       GraphPassUtil::InheritAttrFromOriNodes(original_nodes, fus_nodes, inherit_mode);
+      if (has_pattern_index) {
+        for (const ge::NodePtr &node : original_nodes) {
+          FusionPatternIndex::CollectTouchedNodes(node, touched_nodes);
+        }
+        for (const ge::NodePtr &node : fus_nodes) {
+          FusionPatternIndex::CollectTouchedNodes(node, touched_nodes);
+        }
+      }
+    } else {
+      touched_nodes.resize(touched_begin);
     }
     changed = (changed || (status == SUCCESS));
   }
+  if (changed) {
+    FusionPatternIndex::UpdateInGraph(graph, touched_nodes);
+  }
 
   // get match times and effect times
   FusionStatisticRecorder &fusion_statistic_inst = FusionStatisticRecorder::Instance();
@@ -10,6 +10,7 @@
 
 #include "register/graph_optimizer/graph_fusion/pattern_fusion_base_pass_impl.h"
 #include "register/graph_optimizer/fusion_common/graph_pass_util.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
 
 namespace fe {
 namespace {
@@ -415,6 +416,18 @@ void PatternFusionBasePassImpl::GetOutDataAnchors(const ge::NodePtr &node,
   }
 }
 
+bool PatternFusionBasePassImpl::IsNodeInTypeMap(const NodeMapInfo &node_map_info, const ge::NodePtr &node) {
+  if (node_map_info.node_type_map == nullptr) {
+    return false;
+  }
+  const auto type_iter = node_map_info.node_type_map->find(ge::NodeUtils::GetNodeType(*node));
+  if (type_iter == node_map_info.node_type_map->end()) {
+    return false;
+  }
+  const auto node_iter = type_iter->second.find(node->GetName());
+  return (node_iter != type_iter->second.end()) && (node_iter->second == node);
+}
+
 bool PatternFusionBasePassImpl::GetMatchOutputNodes(const ge::ComputeGraph &graph, const FusionPattern &pattern,
                                                     std::vector<ge::NodePtr> &matched_output_nodes) const {
   const FusionPattern::OpDescPtr output_op_desc = pattern.GetOutput();
@@ -424,8 +437,22 @@ bool PatternFusionBasePassImpl::GetMatchOutputNodes(const ge::ComputeGraph &grap
   }
 
   NodeMapInfoPtr node_map_info = nullptr;
-  // get nodes by type from node
-  if (GraphPassUtil::GetOpTypeMapToGraph(node_map_info, graph) == SUCCESS) {
+  const bool has_node_map = GraphPassUtil::GetOpTypeMapToGraph(node_map_info, graph) == SUCCESS;
+  // get candidates from the shared index of all patterns in this stage
+  const FusionPatternIndexPtr pattern_index = FusionPatternIndex::GetFromGraph(graph);
+  std::vector<ge::NodePtr> candidates;
+  if ((pattern_index != nullptr) && pattern_index->GetCandidates(graph, pattern, candidates)) {
+    for (const ge::NodePtr &node_ptr : candidates) {
+      if (has_node_map && (!IsNodeInTypeMap(*node_map_info, node_ptr) ||
+                           (node_ptr->GetInDataNodes().empty() && node_ptr->GetOutAllNodes().empty()))) {
+        continue;
+      }
+      if (IsOpFusible(node_ptr->GetOpDesc(), output_op_desc)) {
+        matched_output_nodes.push_back(node_ptr);
+      }
+    }
+  } else if (has_node_map) {
+    // get nodes by type from node
     for (auto &OutOpType : output_op_desc->types) {
       const auto iter = node_map_info->node_type_map->find(OutOpType);
       if (iter != node_map_info->node_type_map->end()) {
@@ -20,6 +20,7 @@
 #include "framework/common/debug/ge_log.h"
 #include "common/opskernel/ops_kernel_info_store.h"
 #include "register/graph_optimizer/graph_fusion/fusion_pattern.h"
+#include "register/graph_optimizer/fusion_common/graph_pass_util.h"
 
 namespace fe {
 using OpDesc = FusionPattern::OpDesc;
@@ -123,6 +124,8 @@ class PatternFusionBasePassImpl {
 
   static bool IsOpFusible(const ge::OpDescPtr &op_desc, const FusionPattern::OpDescPtr &pattern_desc);
 
+  static bool IsNodeInTypeMap(const NodeMapInfo &node_map_info, const ge::NodePtr &node);
+
   static bool VerifyInputDescNodes(const ge::NodePtr &input_node, const std::shared_ptr<OpDesc> &input_desc,
                                    const Mapping &mapping);
 };
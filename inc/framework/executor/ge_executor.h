@@ -345,6 +345,9 @@ class GE_FUNC_VISIBILITY GeExecutor {
 
   static Status ReleaseSingleOpResource(void *const stream);
 
+  // 设置单算子资源池大小，stream释放后其资源按device及context缓存供新stream复用，0表示关闭
+  static void SetSingleOpResourcePoolSize(const size_t pool_size);
+
   static Status ClearCustomAicpuSo(const uint32_t device_id);
 
   static Status GetDeviceIdByModelId(const uint32_t model_id, uint32_t &device_id);
@@ -12,7 +12,12 @@
 #define AIR_CXX_INC_FRAMEWORK_RUNTIME_SUBSCRIBER_GLOBAL_PROFILER_H_
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <fstream>
 #include "mmpa/mmpa_api.h"
@@ -28,9 +33,13 @@
 
 namespace gert {
 constexpr uint32_t kTensorInfoBytes = 44UL;
+constexpr size_t kProfilingCacheLineSize = 64UL;
 constexpr uint32_t kTensorInfoBytesWithCap = 56U;
 constexpr size_t kMaxContextIdNum =
     (static_cast<size_t>(MSPROF_ADDTIONAL_INFO_DATA_LENGTH) - sizeof(uint32_t) - sizeof(uint64_t)) / sizeof(uint32_t);
+// host profiling统一使用单调时钟打点，dump时再换算成系统时间
+using ProfilingClock = std::chrono::steady_clock;
+using ProfilingTimePoint = ProfilingClock::time_point;
 struct ProfilingData {
   uint64_t name_idx;
   uint64_t type_idx;
@@ -38,6 +47,14 @@ struct ProfilingData {
   std::chrono::time_point<std::chrono::system_clock> timestamp;
   int64_t thread_id;
 };
+// GlobalProfiler内部缓存的记录，与ProfilingData的区别仅在于时间戳取自ProfilingClock
+struct ProfilingRecord {
+  uint64_t name_idx;
+  uint64_t type_idx;
+  ExecutorEvent event;
+  ProfilingTimePoint timestamp;
+  int64_t thread_id;
+};
 #pragma pack(push)
 #pragma pack(1)
 struct rtProfTraceUserData {
@@ -80,26 +97,134 @@ struct ContextIdInfoWrapper {
 };
 
 extern const std::unordered_map<std::string, GeProfInfoType> kNamesToProfTypes;
+
+// 每个记录线程独占一个环形缓冲区，记录线程写、落盘线程读，满了之后丢弃新记录并计数
+class ProfilingRecordRing {
+ public:
+  ProfilingRecordRing(const size_t capacity, const int64_t thread_id);
+  bool Push(const uint64_t name_idx, const uint64_t type_idx, const ExecutorEvent event,
+            const ProfilingTimePoint timestamp) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if ((head - tail_.load(std::memory_order_acquire)) >= capacity_) {
+      dropped_.store(dropped_.load(std::memory_order_relaxed) + 1UL, std::memory_order_relaxed);
+      return false;
+    }
+    records_[head & mask_] = {name_idx, type_idx, event, timestamp, thread_id_};
+    head_.store(head + 1UL, std::memory_order_release);
+    return true;
+  }
+  // 写到一半时提前唤醒落盘线程，减少突发记录时的丢弃
+  bool IsHalfFull() const {
+    return (head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed)) == (capacity_ >> 1U);
+  }
+  // 只能在落盘线程(或持有落盘锁的线程)中调用
+  size_t PopAll(std::vector<ProfilingRecord> &records);
+  size_t GetRecordCount() const {
+    return head_.load(std::memory_order_relaxed) + dropped_.load(std::memory_order_relaxed);
+  }
+  size_t GetDroppedCount() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+  bool IsValid() const {
+    return records_ != nullptr;
+  }
+
+ private:
+  // 读写位置分开放在不同的cache line上，避免记录线程与落盘线程互相干扰
+  std::atomic<size_t> head_{0UL};
+  std::atomic<size_t> dropped_{0UL};
+  uint8_t head_padding_[kProfilingCacheLineSize - (sizeof(std::atomic<size_t>) * 2UL)]{};
+  std::atomic<size_t> tail_{0UL};
+  uint8_t tail_padding_[kProfilingCacheLineSize - sizeof(std::atomic<size_t>)]{};
+  size_t capacity_;
+  size_t mask_;
+  int64_t thread_id_;
+  std::unique_ptr<ProfilingRecord[]> records_;
+};
+
+struct GlobalProfilerOption {
+  // 每N次模型执行采样一次，1表示全部采样
+  uint64_t sample_interval{1UL};
+  // 非空时记录以差值+varint编码持续写入该文件，内存中不再保留
+  std::string stream_path;
+  static GlobalProfilerOption LoadFromEnv();
+};
+
 class GlobalProfiler {
  public:
-  GlobalProfiler() = default;
+  GlobalProfiler() : GlobalProfiler(GlobalProfilerOption()) {}
+  explicit GlobalProfiler(const GlobalProfilerOption &option);
+  ~GlobalProfiler();
+  GlobalProfiler(const GlobalProfiler &) = delete;
+  GlobalProfiler &operator=(const GlobalProfiler &) = delete;
+
+  void Record(uint64_t name_idx, uint64_t type_idx, ExecutorEvent event, ProfilingTimePoint timestamp) {
+    if (sample_interval_ > 1UL) {
+      if (event == kModelStart) {
+        const auto model_exe_count = model_exe_count_.fetch_add(1UL, std::memory_order_relaxed);
+        is_sampling_.store((model_exe_count % sample_interval_) == 0UL, std::memory_order_relaxed);
+      }
+      if (!is_sampling_.load(std::memory_order_relaxed)) {
+        return;
+      }
+    }
+    const auto ring = GetThreadRing();
+    if ((ring != nullptr) && ring->Push(name_idx, type_idx, event, timestamp) && ring->IsHalfFull()) {
+      flush_cv_.notify_one();
+    }
+  }
+  // 兼容以系统时钟打点的调用者，换算成单调时钟后记录
   void Record(uint64_t name_idx, uint64_t type_idx, ExecutorEvent event,
               std::chrono::time_point<std::chrono::system_clock> timestamp) {
-    auto index = count_.fetch_add(1, std::memory_order_relaxed);
-    if (index >= kProfilingDataCap) {
-      return;
-    }
-    thread_local static auto tid = static_cast<int64_t>(mmGetTid());
-    records_[index] = {name_idx, type_idx, event, timestamp, tid};
+    Record(name_idx, type_idx, event,
+           ProfilingTimePoint(std::chrono::duration_cast<ProfilingClock::duration>(
+               timestamp.time_since_epoch() - std::chrono::nanoseconds(wall_clock_offset_ns_))));
   }
-  void Dump(std::ostream &out_stream, std::vector<std::string> &idx_to_str) const;
-  size_t GetCount() const {
-    return count_.load();
+  void Dump(std::ostream &out_stream, std::vector<std::string> &idx_to_str);
+  size_t GetCount() const;
+
+ private:
+  struct ThreadRingCache {
+    uint64_t generation{0UL};
+    ProfilingRecordRing *ring{nullptr};
+  };
+  ProfilingRecordRing *GetThreadRing() {
+    thread_local static ThreadRingCache cache;
+    if (cache.generation != generation_) {
+      cache.ring = RegisterThreadRing();
+      cache.generation = generation_;
+    }
+    return cache.ring;
   }
+  ProfilingRecordRing *RegisterThreadRing();
+  void FlushLoop();
+  void DrainRings();
+  void WriteStringTable(const std::vector<std::string> &idx_to_str);
+  void DumpRecords(std::ostream &out_stream, const std::vector<std::string> &idx_to_str);
 
  private:
-  std::atomic<size_t> count_{0UL};
-  ProfilingData records_[kProfilingDataCap];
+  const uint64_t generation_;
+  const uint64_t sample_interval_;
+  const std::string stream_path_;
+  // 单调时钟与系统时钟的差值，dump时用于换算成与日志一致的系统时间
+  const int64_t wall_clock_offset_ns_;
+  std::atomic<uint64_t> model_exe_count_{0UL};
+  std::atomic<bool> is_sampling_{true};
+
+  mutable std::mutex rings_mutex_;
+  std::vector<std::unique_ptr<ProfilingRecordRing>> rings_;
+
+  std::mutex flush_mutex_;
+  std::condition_variable flush_cv_;
+  bool stop_flush_{false};
+  std::vector<ProfilingRecord> drain_buffer_;
+  std::vector<ProfilingRecord> records_;
+  size_t overflow_count_{0UL};
+  std::ofstream stream_file_;
+  std::string stream_buffer_;
+  // 已写入流式文件的字符串表，每次dump只追加新增部分
+  std::vector<std::string> written_strs_;
+  std::thread flush_thread_;
 };
 
 struct ProfFusionMemSize {
@@ -167,6 +292,11 @@ class VISIBILITY_EXPORT GlobalProfilingWrapper {
       global_profiler_->Dump(out_stream, idx_to_str_);
     }
   }
+  void Record(uint64_t name_idx, uint64_t type_idx, ExecutorEvent event, ProfilingTimePoint timestamp) {
+    if (global_profiler_ != nullptr) {
+      global_profiler_->Record(name_idx, type_idx, event, timestamp);
+    }
+  }
   void Record(uint64_t name_idx, uint64_t type_idx, ExecutorEvent event,
               std::chrono::time_point<std::chrono::system_clock> timestamp) {
     if (global_profiler_ != nullptr) {
@@ -258,7 +388,7 @@ class ScopeProfiler {
  public:
   ScopeProfiler(const size_t element, const size_t event) : element_(element), event_(event) {
     if (GlobalProfilingWrapper::GetInstance()->IsEnabled(ProfilingType::kGeHost)) {
-      start_trace_ = std::chrono::system_clock::now();
+      start_trace_ = ProfilingClock::now();
     }
   }
 
@@ -269,12 +399,12 @@ class ScopeProfiler {
   ~ScopeProfiler() {
     if (GlobalProfilingWrapper::GetInstance()->IsEnabled(ProfilingType::kGeHost)) {
       GlobalProfilingWrapper::GetInstance()->Record(element_, event_, kExecuteStart, start_trace_);
-      GlobalProfilingWrapper::GetInstance()->Record(element_, event_, kExecuteEnd, std::chrono::system_clock::now());
+      GlobalProfilingWrapper::GetInstance()->Record(element_, event_, kExecuteEnd, ProfilingClock::now());
     }
   }
 
  private:
-  std::chrono::time_point<std::chrono::system_clock> start_trace_;
+  ProfilingTimePoint start_trace_;
   size_t element_;
   size_t event_;
 };
@@ -335,9 +465,9 @@ class ProfLaunchTypeRegistry {
 }  // namespace gert
 
 #define GE_PROFILING_START(event)                                                             \
-  std::chrono::time_point<std::chrono::system_clock> event##start_time;                       \
+  gert::ProfilingTimePoint event##start_time;                                                 \
   if (gert::GlobalProfilingWrapper::GetInstance()->IsEnabled(gert::ProfilingType::kGeHost)) { \
-    event##start_time = std::chrono::system_clock::now();                                     \
+    event##start_time = gert::ProfilingClock::now();                                          \
   }
 
 #define GE_PROFILING_END(name_idx, type_idx, event)                                                         \
@@ -346,7 +476,7 @@ class ProfLaunchTypeRegistry {
       gert::GlobalProfilingWrapper::GetInstance()->Record(name_idx, type_idx, ExecutorEvent::kExecuteStart, \
                                                           event##start_time);                               \
       gert::GlobalProfilingWrapper::GetInstance()->Record(name_idx, type_idx, ExecutorEvent::kExecuteEnd,   \
-                                                          std::chrono::system_clock::now());                \
+                                                          gert::ProfilingClock::now());                     \
     }                                                                                                       \
   } while (false)
 
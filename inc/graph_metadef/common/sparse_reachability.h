@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef INC_COMMON_SPARSE_REACHABILITY_H_
+#define INC_COMMON_SPARSE_REACHABILITY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/* SparseReachability answers reachability queries on a dag with O(N + E) memory.
+ * 节点id为[0, GetNodeNum())的连续整数。每个节点属于一个分组，环或融合后的节点集合收缩为一个分组，
+ * 分组之间维护一个动态拓扑序：
+ * 1. 查询src->dst时，若src的拓扑序大于dst则直接返回不可达，否则只在拓扑序不大于dst的范围内做前向搜索；
+ * 2. Finalize之后新增边或收缩节点时，只对拓扑序窗口内受影响的分组重新分配序号(Pearce-Kelly)。
+ * 修改接口(AddNode/AddEdge/Finalize/Contract)不能与查询或其他修改并发。 */
+namespace ge {
+class SparseReachability {
+ public:
+  SparseReachability() = default;
+
+  ~SparseReachability() = default;
+
+  // 拷贝节点、边及拓扑序，不拷贝互斥锁
+  SparseReachability(const SparseReachability &other);
+
+  SparseReachability &operator=(const SparseReachability &other);
+
+  // clear all nodes and edges, then add node_num isolated nodes
+  void Reset(size_t node_num);
+
+  // add an isolated node, return its id
+  uint32_t AddNode();
+
+  // add a node which is in the same group with member, return its id
+  uint32_t AddNodeToGroup(uint32_t member);
+
+  // add edge src->dst. Before Finalize only the edge is recorded,
+  // after that the topological order is maintained incrementally and a new cycle is contracted.
+  void AddEdge(uint32_t src, uint32_t dst);
+
+  // contract cycles and compute the topological order of all recorded edges
+  void Finalize();
+
+  // whether there is a path src->dst, a node is reachable to itself.
+  // 按拓扑序剪枝的DFS：Finalize之后ord(src) > ord(dst)时不加锁O(1)返回；否则在内部互斥锁下前向DFS，
+  // 只访问拓扑序在[ord(src), ord(dst)]内的分组，最坏为整图的O(N + E)。查询不修改分组关系，可以并发调用。
+  bool IsReachable(uint32_t src, uint32_t dst) const;
+
+  // contract nodes into one group. Nodes on the paths between them are contracted together,
+  // otherwise the contracted graph will contain a cycle.
+  void Contract(const std::vector<uint32_t> &nodes);
+
+  size_t GetNodeNum() const {
+    return parent_.size();
+  }
+
+  size_t GetMemorySize() const;
+
+ private:
+  uint32_t Find(uint32_t id) const;
+
+  // same as Find but without path compression, used by queries which may run concurrently
+  uint32_t FindRoot(uint32_t id) const;
+
+  // map the edges of group to groups, remove duplicates and self loops
+  void NormalizeEdges(uint32_t group);
+
+  // mark groups reachable from sources whose order is in (lower_ord, upper_ord)
+  void CollectReachable(const std::vector<uint32_t> &sources, bool forward, uint32_t lower_ord, uint32_t upper_ord,
+                        std::vector<uint32_t> &marks, std::vector<uint32_t> &result) const;
+
+  // before and after take the slots in ascending order and keep their original relative order,
+  // group takes the slot between them if it is valid
+  void AssignOrder(std::vector<uint32_t> &before, uint32_t group, std::vector<uint32_t> &after,
+                   std::vector<uint32_t> &slots);
+
+  void MergeGroups(const std::vector<uint32_t> &groups);
+
+  uint32_t NextMarkEpoch() const;
+
+  bool finalized_ = false;
+  uint32_t next_ord_ = 0U;
+  mutable std::vector<uint32_t> parent_;
+  std::vector<uint32_t> ord_;
+  // 以节点id记录的出边与入边，分组收缩后合并到分组代表节点
+  std::vector<std::vector<uint32_t>> out_edges_;
+  std::vector<std::vector<uint32_t>> in_edges_;
+  mutable uint32_t mark_epoch_ = 0U;
+  mutable std::vector<uint32_t> forward_marks_;
+  mutable std::vector<uint32_t> backward_marks_;
+  mutable std::vector<uint32_t> stack_;
+  // 保护查询DFS使用的访问标记
+  mutable std::mutex query_mutex_;
+};
+}  // namespace ge
+#endif  // INC_COMMON_SPARSE_REACHABILITY_H_
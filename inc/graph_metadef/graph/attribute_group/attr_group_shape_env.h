@@ -18,6 +18,7 @@
 #include "attribute_group/attr_group_base.h"
 #include "graph/symbolizer/symbolic.h"
 #include "graph/symbolizer/symbolic_utils.h"
+#include "graph/symbolizer/source_load_info.h"
 #include "common/checker.h"
 #include "graph/detail/attributes_holder.h"
 
@@ -51,6 +52,10 @@ class Source {
   virtual size_t GetDimIdx() const {
     return std::numeric_limits<size_t>::max();
   }
+  // 目的是用于guard解释执行时从图输入取值，返回kUnsupported表示只能通过codegen取值
+  virtual SourceLoadInfo GetLoadInfo() const {
+    return {};
+  }
 
  private:
   size_t global_index_{std::numeric_limits<size_t>::max()};
@@ -75,7 +80,8 @@ struct HashSymbol {
         GE_ASSERT_TRUE(e.GetConstValue(value_float));
         return std::hash<double>()(value_float);
       default:
-        return std::hash<std::string>()(std::string(e.Serialize().get()));
+        // 结构hash由SymEngine对象缓存，避免每次序列化表达式
+        return static_cast<size_t>(e.Hash());
     }
   }
 };
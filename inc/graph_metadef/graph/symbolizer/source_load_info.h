@@ -0,0 +1,36 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef INC_GRAPH_SYMBOLIZER_SOURCE_LOAD_INFO_H_
+#define INC_GRAPH_SYMBOLIZER_SOURCE_LOAD_INFO_H_
+
+#include <cstdint>
+#include "graph/types.h"
+
+namespace ge {
+// 描述符号在执行时如何从图输入上取值，guard解释执行时按此取值，不需要codegen
+enum class SourceLoadType : int32_t {
+  kUnsupported = 0,      // 只能通过GetSourceStr生成代码取值
+  kInputShapeDim,        // 输入originShape的第index维，输入为空时为-1
+  kInputRank,            // 输入originShape的维数，输入为空时为-1
+  kInputValueElement,    // 输入数据的第index个元素，输入或数据为空时为-1
+  kInputValueSum,        // 输入所有元素的和，输入或数据为空时为-1
+  kInputValueForCond,    // 输入首个元素按cond语义转换成的整数，输入为空时为-1
+  kEnd
+};
+
+struct SourceLoadInfo {
+  SourceLoadType type{SourceLoadType::kUnsupported};
+  int32_t input_data_idx{-1};
+  int64_t index{0};
+  DataType dtype{DT_UNDEFINED};
+};
+}  // namespace ge
+#endif  // INC_GRAPH_SYMBOLIZER_SOURCE_LOAD_INFO_H_
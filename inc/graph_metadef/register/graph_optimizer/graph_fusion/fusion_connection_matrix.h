@@ -16,6 +16,7 @@
 #include "graph/graph.h"
 #include "graph/compute_graph.h"
 #include "common/large_bm.h"
+#include "common/sparse_reachability.h"
 #include "register/graph_optimizer/graph_optimize_register_error_codes.h"
 
 namespace fe {
@@ -33,6 +34,7 @@ class ConnectionMatrix {
   // if there is a path between A->B, then B will own A's
   // connectivity. The reason is ---
   // If some node can reach A, than it can also reach B.
+  // After Generate, edges are added incrementally and existing connectivity is kept.
   void SetConnectivity(const ge::Node::Vistor<ge::NodePtr> &inputs, const ge::NodePtr &node);
 
   bool IsDataConnected(const ge::NodePtr &a, const ge::NodePtr &b) const;
@@ -53,29 +55,18 @@ class ConnectionMatrix {
   void RestoreBitMap();
 
  private:
-  int64_t GetIndex(const ge::NodePtr &node) const;
-
-  const ge::LargeBitmap &GetBitMap(const ge::NodePtr &node) const;
-
-  ge::LargeBitmap &GetBitMap(const ge::NodePtr &node);
-
-  ge::LargeBitmap &GetBitMap(uint64_t index);
-
-  const ge::LargeBitmap &GetDataBitMap(const ge::NodePtr &node) const;
-
-  ge::LargeBitmap &GetDataBitMap(const ge::NodePtr &node);
-
-  ge::LargeBitmap &GetDataBitMap(uint64_t index);
+  bool GetIndex(const ge::NodePtr &node, uint32_t &index) const;
 
   void SetDataConnectivity(const ge::Node::Vistor<ge::NodePtr> &inputs, const ge::NodePtr &node);
 
   bool enable_data_flow_;
   size_t size_ = 0;
-  std::vector<ge::LargeBitmap> bit_maps;
-  std::vector<ge::LargeBitmap> bit_maps_back_up_;
-  std::vector<ge::LargeBitmap> data_bit_maps_;
-  std::vector<ge::LargeBitmap> data_bit_maps_back_up_;
-  std::map<std::string, int64_t> name_to_index_;
+  // 所有边的可达性与仅数据边的可达性，按拓扑序剪枝查询，内存与节点数和边数成正比
+  ge::SparseReachability reachability_;
+  ge::SparseReachability reachability_back_up_;
+  ge::SparseReachability data_reachability_;
+  ge::SparseReachability data_reachability_back_up_;
+  std::map<std::string, uint32_t> name_to_index_;
 };
 }  // namespace fe
 #endif  // INC_REGISTER_GRAPH_OPTIMIZER_GRAPH_FUSION_FUSION_CONNECTION_MATRIX_H_
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef INC_REGISTER_GRAPH_OPTIMIZER_GRAPH_FUSION_FUSION_PATTERN_INDEX_H_
+#define INC_REGISTER_GRAPH_OPTIMIZER_GRAPH_FUSION_FUSION_PATTERN_INDEX_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "graph/compute_graph.h"
+#include "graph/node.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern.h"
+
+namespace fe {
+class FusionPatternIndex;
+using FusionPatternIndexPtr = std::shared_ptr<FusionPatternIndex>;
+
+/** Shared output-node index of all fusion patterns in one fusion stage
+ * @ingroup FUSION_PASS_GROUP
+ * @note 一个阶段内所有pass的pattern按输出节点类型编入同一索引，一次遍历图即可得到每个pattern的候选输出节点。
+ * 候选节点需满足输出节点的边形状：各输入描述要求的类型在输入节点中存在，全匹配输出时输出节点个数一致。
+ * 该条件只是MatchFromOutput的必要条件，完整匹配仍由pass执行。
+ * pattern改图后基类只把改写涉及的节点及其相邻节点传给Update，只对这些节点重新匹配，不再遍历整图。
+ * 若pass在Fusion之外自行修改了图，需要调用不带节点列表的UpdateInGraph，遍历整图找出新增或边形状变化的节点。
+ */
+class FusionPatternIndex {
+ public:
+  FusionPatternIndex() = default;
+  ~FusionPatternIndex() = default;
+  FusionPatternIndex(const FusionPatternIndex &) = delete;
+  FusionPatternIndex &operator=(const FusionPatternIndex &) = delete;
+
+  /** add pattern to index, pattern should be built and outlive the index
+   *
+   * @param pattern fusion pattern
+   */
+  void AddPattern(const FusionPattern *pattern);
+
+  void AddPatterns(const std::vector<FusionPattern *> &patterns);
+
+  /** match all patterns in one traversal of graph
+   *
+   * @param graph graph to be indexed
+   */
+  void Build(const ge::ComputeGraph &graph);
+
+  /** re-match nodes which are added or whose edges changed after graph is rewritten
+   *
+   * @param graph graph rewritten
+   */
+  void Update(const ge::ComputeGraph &graph);
+
+  /** re-match only nodes touched by a rewrite, falls back to traverse graph if node num is not consistent
+   *
+   * @param graph graph rewritten
+   * @param touched_nodes nodes removed, added or rewired by the rewrite together with their neighbors,
+   *                      removed nodes should be collected before the rewrite
+   */
+  void Update(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes);
+
+  /** get candidate output nodes of pattern, ordered by output op type of pattern and node name
+   *
+   * @param graph graph indexed
+   * @param pattern fusion pattern
+   * @param candidates candidate output nodes
+   * @return false if pattern is not indexed or index is out of date, caller should traverse graph instead
+   */
+  bool GetCandidates(const ge::ComputeGraph &graph, const FusionPattern &pattern,
+                     std::vector<ge::NodePtr> &candidates) const;
+
+  bool IsIndexed(const FusionPattern *pattern) const;
+
+  size_t GetPatternNum() const {
+    return entries_.size();
+  }
+
+  size_t GetNodeNum() const {
+    return records_.size();
+  }
+
+  // number of nodes matched in last Build or Update
+  size_t GetLastMatchedNodeNum() const {
+    return last_matched_node_num_;
+  }
+
+  static FusionPatternIndexPtr GetFromGraph(const ge::ComputeGraph &graph);
+
+  static void SetToGraph(ge::ComputeGraph &graph, const FusionPatternIndexPtr &index);
+
+  static void UpdateInGraph(const ge::ComputeGraph &graph);
+
+  static void UpdateInGraph(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes);
+
+  // collect node and its input and output data nodes as touched nodes
+  static void CollectTouchedNodes(const ge::NodePtr &node, std::vector<ge::NodePtr> &touched_nodes);
+
+ private:
+  struct PatternEntry {
+    std::vector<std::string> output_types;
+    // 输出节点每个有类型限制的输入描述，至少有一个输入节点的类型在其中
+    std::vector<std::vector<std::string>> input_types;
+    bool need_inputs = false;
+    bool check_output_size = false;
+    size_t output_size = 0U;
+    // 按输出类型下标分组，节点按名字排序，与node_type_map的遍历顺序一致
+    std::vector<std::map<std::string, ge::NodePtr>> candidates;
+  };
+
+  struct NodeRecord {
+    ge::NodePtr node;
+    std::string name;
+    uint64_t signature = 0U;
+    uint64_t visit_id = 0U;
+    // (entry index, output type index)
+    std::vector<std::pair<size_t, size_t>> matched;
+  };
+
+  static uint64_t CalcSignature(const ge::NodePtr &node, std::vector<std::string> &in_types);
+
+  bool IsEdgeShapeMatched(const PatternEntry &entry, const ge::NodePtr &node,
+                          const std::vector<std::string> &in_types) const;
+
+  void MatchNode(const ge::NodePtr &node, const std::string &node_type, const std::vector<std::string> &in_types,
+                 NodeRecord &record);
+
+  void UnmatchNode(NodeRecord &record);
+
+  void RefreshNode(const ge::NodePtr &node, std::vector<std::string> &in_types);
+
+  void RefreshAll(const ge::ComputeGraph &graph);
+
+  bool Refresh(const ge::ComputeGraph &graph, const std::vector<ge::NodePtr> &touched_nodes);
+
+  std::vector<PatternEntry> entries_;
+  std::unordered_map<const FusionPattern *, size_t> pattern_to_entry_;
+  // output op type -> (entry index, output type index)
+  std::unordered_map<std::string, std::vector<std::pair<size_t, size_t>>> type_to_entries_;
+  std::unordered_map<const ge::Node *, NodeRecord> records_;
+  uint64_t visit_id_ = 0U;
+  size_t last_matched_node_num_ = 0U;
+};
+}  // namespace fe
+
+#endif  // INC_REGISTER_GRAPH_OPTIMIZER_GRAPH_FUSION_FUSION_PATTERN_INDEX_H_
@@ -8,7 +8,9 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
 #include <cinttypes>
+#include <future>
 #include <string>
 #include <fstream>
 #include <regex>
@@ -39,7 +41,9 @@
 #include "common/om2/rt_var_resource.h"
 #include "zip_archive_reader.h"
 #include "common/om2/om2_model_data.h"
+#include "common/om2/om2_binary_meta.h"
 #include "om2_aipp_utils.h"
+#include "om2_thread_pool.h"
 #include <fstream>
 #include <vector>
 
@@ -48,6 +52,7 @@ namespace {
 constexpr size_t kMaxErrorStringLen = 128U;
 constexpr size_t FILE_MAGIC_HEADER_SIZE = 4U;
 constexpr uint8_t OM2_MAGIC[] = {0x50, 0x4B, 0x03, 0x04};
+constexpr size_t kMaxMetaDecodeThreadNum = 4U;
 
 using Om2ModelHandle = void *;
 using CreateFunc = ge::graphStatus (*)(Om2ModelHandle *, rtModel_t *, const char **, const void **, size_t *, int,
@@ -493,6 +498,42 @@ ge::Status DeserializeOpAttrEntry(const ge::RAIIZipArchive &archive, const std::
   return ge::SUCCESS;
 }
 
+ge::Status DeserializeBinaryOpAttrEntry(const ge::RAIIZipArchive &archive, const std::string &entry,
+                                        gert::Om2ModelData &model_data) {
+  size_t buff_size = 0U;
+  auto buff_data = archive.ExtractToMem(entry, buff_size);
+  GE_ASSERT_NOTNULL(buff_data, "[OM2] Failed to extract %s", entry.c_str());
+  if (ge::Om2BinaryMetaCodec::DecodeOpAttrMap(buff_data.get(), buff_size, model_data.debug_info.op_attr_map) !=
+      ge::SUCCESS) {
+    GELOGW("[OM2] Failed to decode %s, using empty map", entry.c_str());
+    model_data.debug_info.op_attr_map.clear();
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status DeserializeBinaryConstantsConfigEntry(const ge::RAIIZipArchive &archive, const std::string &entry,
+                                                 gert::Om2ModelData &model_data) {
+  size_t buff_size = 0U;
+  auto buff_data = archive.ExtractToMem(entry, buff_size);
+  GE_ASSERT_NOTNULL(buff_data, "[OM2] Failed to extract %s", entry.c_str());
+  GE_ASSERT_SUCCESS(ge::Om2BinaryMetaCodec::DecodeConstantsConfig(buff_data.get(), buff_size,
+                                                                  model_data.constants_data.consts,
+                                                                  model_data.constants_data.internal_weight_size),
+                    "[OM2] Invalid constants config from entry %s", entry.c_str());
+  return ge::SUCCESS;
+}
+
+ge::Status DeserializeBinaryVariablesConfigEntry(const ge::RAIIZipArchive &archive, const std::string &entry,
+                                                 gert::Om2ModelData &model_data) {
+  size_t buff_size = 0U;
+  auto buff_data = archive.ExtractToMem(entry, buff_size);
+  GE_ASSERT_NOTNULL(buff_data, "[OM2] Failed to extract %s", entry.c_str());
+  GE_ASSERT_SUCCESS(ge::Om2BinaryMetaCodec::DecodeVariablesConfig(buff_data.get(), buff_size, model_data.var_metas,
+                                                                  model_data.graph_id),
+                    "[OM2] Invalid variables config from entry %s", entry.c_str());
+  return ge::SUCCESS;
+}
+
 ge::Status HandleArchiveEntry(const ge::RAIIZipArchive &archive, const std::string &entry,
                               gert::Om2ModelData &model_data) {
   if (entry.find("/runtime/") != std::string::npos && IsFileNameEndsWith(entry, ".so")) {
@@ -502,6 +543,8 @@ ge::Status HandleArchiveEntry(const ge::RAIIZipArchive &archive, const std::stri
   if (entry.find("/debug/") != std::string::npos) {
     if (IsFileNameEndsWith(entry, "op_attr.json")) {
       GE_ASSERT_SUCCESS(DeserializeOpAttrEntry(archive, entry, model_data));
+    } else if (IsFileNameEndsWith(entry, "op_attr.om2meta")) {
+      GE_ASSERT_SUCCESS(DeserializeBinaryOpAttrEntry(archive, entry, model_data));
     }
     return ge::SUCCESS;
   }
@@ -512,6 +555,8 @@ ge::Status HandleArchiveEntry(const ge::RAIIZipArchive &archive, const std::stri
   if (entry.find("data/constants/") != std::string::npos) {
     if (IsFileNameEndsWith(entry, "_constants_config.json")) {
       GE_ASSERT_SUCCESS(DeserializeConstantsConfigEntry(archive, entry, model_data));
+    } else if (IsFileNameEndsWith(entry, "_constants_config.om2meta")) {
+      GE_ASSERT_SUCCESS(DeserializeBinaryConstantsConfigEntry(archive, entry, model_data));
     } else if (entry.find("data/constants/constant_") != std::string::npos) {
       GE_ASSERT_SUCCESS(DeserializeWeightEntry(archive, entry, model_data));
     }
@@ -522,6 +567,8 @@ ge::Status HandleArchiveEntry(const ge::RAIIZipArchive &archive, const std::stri
       GE_ASSERT_SUCCESS(DeserializeVarResourceEntry(archive, entry, model_data));
     } else if (IsFileNameEndsWith(entry, "_variables_config.json")) {
       GE_ASSERT_SUCCESS(DeserializeVariablesConfigEntry(archive, entry, model_data));
+    } else if (IsFileNameEndsWith(entry, "_variables_config.om2meta")) {
+      GE_ASSERT_SUCCESS(DeserializeBinaryVariablesConfigEntry(archive, entry, model_data));
     }
     return ge::SUCCESS;
   }
@@ -540,6 +587,56 @@ ge::Status HandleArchiveEntry(const ge::RAIIZipArchive &archive, const std::stri
   return ge::SUCCESS;
 }
 
+// 以下元数据entry各自只写Om2ModelData中互不相交的字段，彼此之间可以并行解析
+enum class MetaEntryKind : size_t { kModelMeta = 0U, kOpAttr, kConstantsConfig, kVarResource, kVariablesConfig, kEnd };
+
+bool GetMetaEntryKind(const std::string &entry, MetaEntryKind &kind) {
+  if (entry.find("/debug/") != std::string::npos) {
+    kind = MetaEntryKind::kOpAttr;
+    return IsFileNameEndsWith(entry, "op_attr.json") || IsFileNameEndsWith(entry, "op_attr.om2meta");
+  }
+  if (IsFileNameEndsWith(entry, "model_meta.json")) {
+    kind = MetaEntryKind::kModelMeta;
+    return true;
+  }
+  if (entry.find("data/constants/") != std::string::npos) {
+    kind = MetaEntryKind::kConstantsConfig;
+    return IsFileNameEndsWith(entry, "_constants_config.json") ||
+           IsFileNameEndsWith(entry, "_constants_config.om2meta");
+  }
+  if (entry.find("data/variables/") != std::string::npos) {
+    if (IsFileNameEndsWith(entry, "var_resource.json")) {
+      kind = MetaEntryKind::kVarResource;
+      return true;
+    }
+    kind = MetaEntryKind::kVariablesConfig;
+    return IsFileNameEndsWith(entry, "_variables_config.json") ||
+           IsFileNameEndsWith(entry, "_variables_config.om2meta");
+  }
+  return false;
+}
+
+// 压缩的entry需要通过共享的unzFile解压，只有原地可读的entry才能在其他线程解析
+bool IsInPlaceReadableMetaEntry(const ge::RAIIZipArchive &archive, const std::string &entry,
+                                const MetaEntryKind kind) {
+  if (!archive.IsInPlaceReadable(entry)) {
+    return false;
+  }
+  if (kind == MetaEntryKind::kVarResource) {
+    const std::string weight_entry = ExtractParentDirAndFileName(entry).first + "var_weight_data";
+    return !archive.HasEntry(weight_entry) || archive.IsInPlaceReadable(weight_entry);
+  }
+  return true;
+}
+
+ge::Status DeserializeMetaEntries(const ge::RAIIZipArchive &archive, const std::vector<std::string> &entries,
+                                  gert::Om2ModelData &model_data) {
+  for (const auto &entry : entries) {
+    GE_ASSERT_SUCCESS(HandleArchiveEntry(archive, entry, model_data));
+  }
+  return ge::SUCCESS;
+}
+
 ge::Status DeserializeOm2ModelDataFromArchive(ge::RAIIZipArchive &archive, gert::Om2ModelData &model_data) {
   const auto &entries = archive.ListFiles();
   if (entries.empty()) {
@@ -547,10 +644,47 @@ ge::Status DeserializeOm2ModelDataFromArchive(ge::RAIIZipArchive &archive, gert:
     return ACL_ERROR_GE_PARAM_INVALID;
   }
 
+  std::vector<std::vector<std::string>> meta_entries(static_cast<size_t>(MetaEntryKind::kEnd));
+  std::vector<std::string> other_entries;
   for (const auto &entry : entries) {
-    GE_ASSERT_SUCCESS(HandleArchiveEntry(archive, entry, model_data));
+    MetaEntryKind kind = MetaEntryKind::kEnd;
+    if (GetMetaEntryKind(entry, kind) && IsInPlaceReadableMetaEntry(archive, entry, kind)) {
+      meta_entries[static_cast<size_t>(kind)].emplace_back(entry);
+    } else {
+      other_entries.emplace_back(entry);
+    }
+  }
+  const size_t meta_task_num = static_cast<size_t>(std::count_if(
+      meta_entries.cbegin(), meta_entries.cend(), [](const std::vector<std::string> &v) { return !v.empty(); }));
+
+  std::unique_ptr<ge::om2::ThreadPool> thread_pool;
+  std::vector<std::future<ge::Status>> futures;
+  if (meta_task_num > 1U) {
+    thread_pool = std::make_unique<ge::om2::ThreadPool>(
+        "om2meta", static_cast<uint32_t>(std::min(meta_task_num, kMaxMetaDecodeThreadNum)));
+    for (const auto &kind_entries : meta_entries) {
+      if (kind_entries.empty()) {
+        continue;
+      }
+      futures.emplace_back(thread_pool->commit([&archive, &kind_entries, &model_data]() -> ge::Status {
+        return DeserializeMetaEntries(archive, kind_entries, model_data);
+      }));
+    }
+  } else {
+    for (const auto &kind_entries : meta_entries) {
+      other_entries.insert(other_entries.end(), kind_entries.cbegin(), kind_entries.cend());
+    }
   }
 
+  // 其余entry(so、kernel、权重等)在当前线程处理，与元数据解析重叠
+  ge::Status ret = DeserializeMetaEntries(archive, other_entries, model_data);
+  for (auto &future : futures) {
+    GE_ASSERT_TRUE(future.valid(), "[OM2] Invalid meta entry decode future.");
+    const auto task_ret = future.get();
+    ret = (ret == ge::SUCCESS) ? task_ret : ret;
+  }
+  GE_ASSERT_SUCCESS(ret, "[OM2] Failed to deserialize entries of ZIP archive.");
+
   GE_ASSERT_TRUE(!model_data.model_meta.model_name.empty(), "[OM2] model_meta.json not found in ZIP archive.");
   GE_ASSERT_TRUE(!model_data.program_body.so_artifact.file_name.empty(),
                  "[OM2] Compiled .so not found in ZIP archive.");
@@ -617,6 +751,15 @@ ge::Status GetOm2MemAndWeightSizeFromArchive(ge::RAIIZipArchive &archive, size_t
       GE_ASSERT_SUCCESS(GetModelJsonValue("work_size", work_size, model_meta_json));
       continue;
     }
+    if (IsFileNameEndsWith(file_name, "_constants_config.om2meta")) {
+      size_t buff_size = 0UL;
+      auto buff_data = archive.ExtractToMem(file_name, buff_size);
+      GE_ASSERT_TRUE(buff_data != nullptr && buff_size != 0U);
+      ge::Om2ConstMetas consts;
+      GE_ASSERT_SUCCESS(
+          ge::Om2BinaryMetaCodec::DecodeConstantsConfig(buff_data.get(), buff_size, consts, internal_weight_size));
+      continue;
+    }
     if (IsFileNameEndsWith(file_name, "_constants_config.json")) {
       size_t buff_size = 0UL;
       auto buff_data = archive.ExtractToMem(file_name, buff_size);
@@ -455,6 +455,14 @@ bool RAIIZipArchive::HasEntry(const std::string &entry_name) const {
   return entry_cache_.find(entry_name) != entry_cache_.end();
 }
 
+bool RAIIZipArchive::IsInPlaceReadable(const std::string &entry_name) const {
+  if (!IsGood()) {
+    return false;
+  }
+  const auto iter = entry_cache_.find(entry_name);
+  return (iter != entry_cache_.end()) && iter->second.raw_data_ready;
+}
+
 ReadonlyByteBuffer RAIIZipArchive::ExtractToMem(const std::string &entry_name, size_t &buff_size) const {
   GE_ASSERT_TRUE(IsGood(), "Invalid status of archive");
 
@@ -61,6 +61,13 @@ class RAIIZipArchive {
    * @return true if the entry exists, false otherwise.
    */
   bool HasEntry(const std::string &entry_name) const;
+  /**
+   * Checks if an entry is stored without compression, so that ExtractToMem returns its data in place.
+   * Extracting such entries only reads the entry cache and is safe to be called concurrently.
+   * @param entry_name Filename (relative path) within the ZIP archive.
+   * @return true if the entry exists and can be read in place, false otherwise.
+   */
+  bool IsInPlaceReadable(const std::string &entry_name) const;
 
  private:
   struct CachedZipEntry {
@@ -1320,6 +1320,10 @@ Status GeExecutor::ReleaseSingleOpResource(void *const stream) {
   return SingleOpManager::GetInstance().ReleaseResource(stream);
 }
 
+void GeExecutor::SetSingleOpResourcePoolSize(const size_t pool_size) {
+  SingleOpManager::GetInstance().SetResourcePoolSize(pool_size);
+}
+
 Status GeExecutor::ClearCustomAicpuSo(const uint32_t device_id) {
   int32_t cur_device_id = -1;
   GE_CHK_ACL_RET(aclrtGetDevice(&cur_device_id));
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "args_patch_program.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "common/checker.h"
+#include "framework/common/debug/ge_log.h"
+#include "graph/def_types.h"
+
+namespace ge {
+namespace {
+constexpr uint32_t kLow32BitsMask = 0xFFFFFFFFU;
+constexpr uint32_t kHigh32BitsShift = 32U;
+
+inline uint64_t ToAddrAll(const uint64_t addr) {
+  return addr;
+}
+inline uint32_t ToAddrLow32Bit(const uint64_t addr) {
+  return static_cast<uint32_t>(addr & kLow32BitsMask);
+}
+inline uint32_t ToAddrHigh32Bit(const uint64_t addr) {
+  return static_cast<uint32_t>(addr >> kHigh32BitsShift);
+}
+
+template <typename T, T (*Convert)(uint64_t)>
+void ExecuteStridedRun(const ArgsPatchProgram::PatchRun &run, const uint64_t *offsets, const uint64_t base) {
+  // 连续写入时走无间隔的定长循环，便于编译器向量化
+  if (run.stride == sizeof(T)) {
+    T *const dst = PtrToPtr<uint8_t, T>(run.host_addr);
+    for (uint32_t i = 0U; i < run.count; ++i) {
+      dst[i] = Convert(base + offsets[i]);
+    }
+    return;
+  }
+  uint8_t *dst = run.host_addr;
+  for (uint32_t i = 0U; i < run.count; ++i) {
+    *PtrToPtr<uint8_t, T>(dst) = Convert(base + offsets[i]);
+    dst += run.stride;
+  }
+}
+
+template <typename T, T (*Convert)(uint64_t)>
+void ExecuteIndexedRun(const ArgsPatchProgram::PatchRun &run, const uint64_t *offsets, const uint32_t *positions,
+                       const uint64_t base) {
+  uint8_t *const anchor = run.host_addr;
+  for (uint32_t i = 0U; i < run.count; ++i) {
+    *PtrToPtr<uint8_t, T>(anchor + positions[i]) = Convert(base + offsets[i]);
+  }
+}
+}  // namespace
+
+void ArgsPatchProgram::Reset(const size_t allocation_num) {
+  compiled_ = false;
+  pending_patches_.clear();
+  pending_patches_.resize(allocation_num);
+  slot_to_run_begin_.clear();
+  runs_.clear();
+  offsets_.clear();
+  positions_.clear();
+}
+
+Status ArgsPatchProgram::AddPatch(const uint32_t id, const PatchFormat format, void *host_addr,
+                                  const uint64_t offset) {
+  GE_ASSERT_TRUE(!compiled_, "Args patch program has been compiled, can not add patch any more.");
+  GE_ASSERT_TRUE(id < pending_patches_.size(), "Allocation id %u is out of range %zu.", id, pending_patches_.size());
+  GE_ASSERT_TRUE(format < PatchFormat::kEnd);
+  GE_ASSERT_NOTNULL(host_addr);
+  auto &patches = pending_patches_[id];
+  const auto seq = static_cast<uint32_t>(patches.size());
+  patches.emplace_back(PendingPatch{PtrToPtr<void, uint8_t>(host_addr), offset, format, seq});
+  return SUCCESS;
+}
+
+void ArgsPatchProgram::CompileSlot(const PendingPatch *patches, const size_t patch_num) {
+  std::vector<size_t> scattered_indexes;
+  size_t begin = 0U;
+  while (begin < patch_num) {
+    size_t end = begin + 1U;
+    uint64_t stride = 0U;
+    if (end < patch_num) {
+      stride = static_cast<uint64_t>(patches[end].host_addr - patches[begin].host_addr);
+      while ((end < patch_num) &&
+             (static_cast<uint64_t>(patches[end].host_addr - patches[end - 1U].host_addr) == stride)) {
+        ++end;
+      }
+    }
+    if (((end - begin) < kMinStridedRunPatchNum) || (stride > std::numeric_limits<uint32_t>::max())) {
+      scattered_indexes.emplace_back(begin);
+      ++begin;
+      continue;
+    }
+    runs_.emplace_back(PatchRun{patches[begin].host_addr, static_cast<uint32_t>(stride),
+                                static_cast<uint32_t>(end - begin), static_cast<uint32_t>(offsets_.size()), 0U});
+    for (size_t i = begin; i < end; ++i) {
+      offsets_.emplace_back(patches[i].offset);
+    }
+    begin = end;
+  }
+
+  // 零散刷新点按地址顺序合并为indexed run，位置超出32位字节偏移时另起一个run
+  size_t run_index = runs_.size();
+  for (const size_t index : scattered_indexes) {
+    const auto &patch = patches[index];
+    if ((run_index == runs_.size()) ||
+        (static_cast<uint64_t>(patch.host_addr - runs_[run_index].host_addr) > std::numeric_limits<uint32_t>::max())) {
+      run_index = runs_.size();
+      runs_.emplace_back(PatchRun{patch.host_addr, 0U, 0U, static_cast<uint32_t>(offsets_.size()),
+                                  static_cast<uint32_t>(positions_.size())});
+    }
+    auto &run = runs_[run_index];
+    positions_.emplace_back(static_cast<uint32_t>(patch.host_addr - run.host_addr));
+    offsets_.emplace_back(patch.offset);
+    ++run.count;
+  }
+}
+
+void ArgsPatchProgram::CompileAllocation(std::vector<PendingPatch> &patches) {
+  std::sort(patches.begin(), patches.end(), [](const PendingPatch &lhs, const PendingPatch &rhs) {
+    if (lhs.format != rhs.format) {
+      return lhs.format < rhs.format;
+    }
+    if (lhs.host_addr != rhs.host_addr) {
+      return lhs.host_addr < rhs.host_addr;
+    }
+    return lhs.seq < rhs.seq;
+  });
+  // 同一地址被重复刷新时，与逐个刷新的结果保持一致，仅保留最后添加的刷新点
+  size_t kept = 0U;
+  for (size_t i = 0U; i < patches.size(); ++i) {
+    if ((kept > 0U) && (patches[kept - 1U].format == patches[i].format) &&
+        (patches[kept - 1U].host_addr == patches[i].host_addr)) {
+      patches[kept - 1U] = patches[i];
+    } else {
+      patches[kept++] = patches[i];
+    }
+  }
+  patches.resize(kept);
+
+  // 刷新格式按kAddrAll、kAddrLow32Bit、kAddrHigh32Bit的顺序执行，与逐个刷新时的写入顺序一致
+  size_t begin = 0U;
+  for (size_t format = 0U; format < static_cast<size_t>(PatchFormat::kEnd); ++format) {
+    slot_to_run_begin_.emplace_back(static_cast<uint32_t>(runs_.size()));
+    size_t end = begin;
+    while ((end < patches.size()) && (static_cast<size_t>(patches[end].format) == format)) {
+      ++end;
+    }
+    CompileSlot(patches.data() + begin, end - begin);
+    begin = end;
+  }
+}
+
+Status ArgsPatchProgram::Compile() {
+  GE_ASSERT_TRUE(!compiled_, "Args patch program has been compiled.");
+  size_t total_patch_num = 0U;
+  for (const auto &patches : pending_patches_) {
+    total_patch_num += patches.size();
+  }
+  GE_ASSERT_TRUE(total_patch_num < static_cast<size_t>(std::numeric_limits<uint32_t>::max()),
+                 "Too many args patches: %zu.", total_patch_num);
+  offsets_.reserve(total_patch_num);
+  slot_to_run_begin_.reserve((pending_patches_.size() * static_cast<size_t>(PatchFormat::kEnd)) + 1U);
+  for (auto &patches : pending_patches_) {
+    CompileAllocation(patches);
+  }
+  slot_to_run_begin_.emplace_back(static_cast<uint32_t>(runs_.size()));
+  const size_t allocation_num = pending_patches_.size();
+  pending_patches_.clear();
+  pending_patches_.shrink_to_fit();
+  runs_.shrink_to_fit();
+  positions_.shrink_to_fit();
+  compiled_ = true;
+  GELOGI("[Args][PatchProgram] compiled %zu patches of %zu allocations into %zu runs, scattered patch num: %zu.",
+         offsets_.size(), allocation_num, runs_.size(), positions_.size());
+  return SUCCESS;
+}
+
+template <typename T, T (*Convert)(uint64_t)>
+size_t ArgsPatchProgram::ExecuteSlot(const size_t slot, const uint64_t base) const {
+  size_t patch_num = 0U;
+  for (uint32_t i = slot_to_run_begin_[slot]; i < slot_to_run_begin_[slot + 1U]; ++i) {
+    const auto &run = runs_[i];
+    if (run.stride == 0U) {
+      ExecuteIndexedRun<T, Convert>(run, &offsets_[run.offset_begin], &positions_[run.position_begin], base);
+    } else {
+      ExecuteStridedRun<T, Convert>(run, &offsets_[run.offset_begin], base);
+    }
+    patch_num += run.count;
+  }
+  return patch_num;
+}
+
+size_t ArgsPatchProgram::Execute(const uint32_t id, const uint64_t base) const {
+  const size_t slot = GetSlot(id, PatchFormat::kAddrAll);
+  if ((slot + static_cast<size_t>(PatchFormat::kEnd)) >= slot_to_run_begin_.size()) {
+    return 0U;
+  }
+  size_t patch_num = ExecuteSlot<uint64_t, &ToAddrAll>(slot, base);
+  patch_num += ExecuteSlot<uint32_t, &ToAddrLow32Bit>(GetSlot(id, PatchFormat::kAddrLow32Bit), base);
+  patch_num += ExecuteSlot<uint32_t, &ToAddrHigh32Bit>(GetSlot(id, PatchFormat::kAddrHigh32Bit), base);
+  return patch_num;
+}
+
+size_t ArgsPatchProgram::GetRunNum(const uint32_t id) const {
+  const size_t slot = GetSlot(id, PatchFormat::kAddrAll);
+  if ((slot + static_cast<size_t>(PatchFormat::kEnd)) >= slot_to_run_begin_.size()) {
+    return 0U;
+  }
+  return slot_to_run_begin_[slot + static_cast<size_t>(PatchFormat::kEnd)] - slot_to_run_begin_[slot];
+}
+
+size_t ArgsPatchProgram::GetPatchNum(const uint32_t id) const {
+  const size_t slot = GetSlot(id, PatchFormat::kAddrAll);
+  if ((slot + static_cast<size_t>(PatchFormat::kEnd)) >= slot_to_run_begin_.size()) {
+    return 0U;
+  }
+  size_t patch_num = 0U;
+  for (uint32_t i = slot_to_run_begin_[slot]; i < slot_to_run_begin_[slot + static_cast<size_t>(PatchFormat::kEnd)];
+       ++i) {
+    patch_num += runs_[i].count;
+  }
+  return patch_num;
+}
+}  // namespace ge
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_ARGS_PATCH_PROGRAM_H_
+#define AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_ARGS_PATCH_PROGRAM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ge_common/ge_api_error_codes.h"
+
+namespace ge {
+/**
+ * host args刷新程序：加载时将各allocation的刷新点(host地址, offset, 刷新格式)按host地址排序后编译为run，
+ * 执行时按run批量写入base + offset，替代逐个刷新点的遍历：
+ *   strided run：相同格式、host地址等间距且个数不少于kMinStridedRunPatchNum的刷新点，间距等于写入宽度时
+ *                为连续写入，可被编译器向量化；
+ *   indexed run：其余零散刷新点，以相对run首地址的32位字节偏移记录位置，与offset分别连续存放。
+ */
+class ArgsPatchProgram {
+ public:
+  enum class PatchFormat : uint8_t {
+    kAddrAll = 0,        // 写入完整64位地址
+    kAddrLow32Bit = 1,   // 写入地址低32位
+    kAddrHigh32Bit = 2,  // 写入地址高32位
+    kEnd = 3
+  };
+
+  static constexpr uint32_t kMinStridedRunPatchNum = 8U;
+
+  struct PatchRun {
+    uint8_t *host_addr;       // run内首个刷新点的host地址
+    uint32_t stride;          // strided run相邻刷新点host地址的间距，单位字节；indexed run为0
+    uint32_t count;           // run内刷新点的个数
+    uint32_t offset_begin;    // run在offset池中的起始下标
+    uint32_t position_begin;  // indexed run在位置池中的起始下标
+  };
+
+  /**
+   * 清空已编译的程序，并按allocation个数重新开始收集刷新点
+   */
+  void Reset(size_t allocation_num);
+  Status AddPatch(uint32_t id, PatchFormat format, void *host_addr, uint64_t offset);
+  /**
+   * 将收集到的刷新点编译为run，编译后不可再AddPatch
+   */
+  Status Compile();
+
+  /**
+   * 将allocation id对应的所有刷新点刷新为base + offset
+   * @return 本次刷新的地址个数
+   */
+  size_t Execute(uint32_t id, uint64_t base) const;
+
+  bool IsCompiled() const {
+    return compiled_;
+  }
+  size_t GetRunNum(uint32_t id) const;
+  size_t GetPatchNum(uint32_t id) const;
+  size_t GetTotalRunNum() const {
+    return runs_.size();
+  }
+  size_t GetTotalPatchNum() const {
+    return offsets_.size();
+  }
+
+ private:
+  struct PendingPatch {
+    uint8_t *host_addr;
+    uint64_t offset;
+    PatchFormat format;
+    uint32_t seq;  // 添加顺序，相同host地址重复刷新时保留最后添加的刷新点
+  };
+  static size_t GetSlot(const uint32_t id, const PatchFormat format) {
+    return (static_cast<size_t>(id) * static_cast<size_t>(PatchFormat::kEnd)) + static_cast<size_t>(format);
+  }
+  void CompileAllocation(std::vector<PendingPatch> &patches);
+  void CompileSlot(const PendingPatch *patches, size_t patch_num);
+  template <typename T, T (*Convert)(uint64_t)>
+  size_t ExecuteSlot(size_t slot, uint64_t base) const;
+
+  bool compiled_{false};
+  std::vector<std::vector<PendingPatch>> pending_patches_;
+  // CSR格式：(allocation id, 刷新格式)对应slot的run区间为[slot_to_run_begin_[slot], slot_to_run_begin_[slot + 1])
+  std::vector<uint32_t> slot_to_run_begin_;
+  std::vector<PatchRun> runs_;
+  std::vector<uint64_t> offsets_;
+  std::vector<uint32_t> positions_;
+};
+}  // namespace ge
+
+#endif  // AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_ARGS_PATCH_PROGRAM_H_
@@ -49,6 +49,15 @@ class DataInputer {
     return queue_.Pop(data) ? SUCCESS : INTERNAL_ERROR;
   }
 
+  /// @ingroup domi_ome
+  /// @brief pop input data without waiting
+  /// @param [out] save popped input data
+  /// @return SUCCESS pop success
+  /// @return INTERNAL_ERROR  queue is empty or stopped
+  Status TryPop(std::shared_ptr<RunArgs> &data) {
+    return queue_.Pop(data, 0) ? SUCCESS : INTERNAL_ERROR;
+  }
+
   /// @ingroup domi_ome
   /// @brief stop receiving data, invoke thread at Pop
   void Stop() {
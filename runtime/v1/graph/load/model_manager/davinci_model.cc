@@ -100,6 +100,7 @@ const std::string kMallocPurpose = "davinci_model_load";
 const std::string kPlatformSoPathSuffix = "/lib64/device/lib64/libkernel_load_platform.so";
 constexpr const char_t *kUndefinedOptype = "Undefined";
 constexpr const char_t *kStaticModelAddrFixed = "ge.exec.static_model_addr_fixed";
+constexpr const char_t *kInputMergeCopyPrefetch = "ge.exec.inputMergeCopyPrefetch";
 constexpr const char_t *kAscendHomePath = "ASCEND_HOME_PATH";
 
 constexpr const char *K_INPUT = "Input";
@@ -850,13 +851,17 @@ Status DavinciModel::DoTaskSink() {
                     model_id_);
   GE_CHK_STATUS_RET(model_mgr.CheckAicpuOpList(ge_model_), "[Check][AicpuOpList] failed, model_id: %u.", model_id_);
 
+  const uint64_t distribute_begin = ge::GetCurrentTimestamp();
   GE_CHK_STATUS_RET(DistributeTask(*model_task_def), "[Distribute][Task] failed, model_id: %u.", model_id_);
+  mdl_prof_.task_distribute_cost = ge::GetCurrentTimestamp() - distribute_begin;
 
   GE_CHK_STATUS_RET(CreateHcclGroupOrderedEvent());
 
   CalculateMemAllocationsHitInfo();
 
+  const uint64_t args_h2d_begin = ge::GetCurrentTimestamp();
   GE_CHK_STATUS_RET(UpdateStaticModelArgsByFm());
+  mdl_prof_.args_h2d_cost = ge::GetCurrentTimestamp() - args_h2d_begin;
 
   GE_CHK_ACL_RET(aclmdlRIBuildEnd(rt_model_handle_, nullptr));
 
@@ -1310,6 +1315,14 @@ void DavinciModel::PrintfModelProfOfModelLoad() {
           "] micro seconds, "
           "name[%s]model_id[%u]graph_id[%u].",
           (mdl_prof_.init_end - mdl_prof_.init_begin), name_.c_str(), model_id_, runtime_param_.graph_id);
+  // task下沉各阶段耗时汇总为一条，parse/init由args manager统计
+  const auto &task_phase_cost = args_manager_.GetLoadPhaseCost();
+  GEEVENT("[GEPERFTRACE] The time cost of GraphLoader::TaskSinkPhases is parse[%" PRIu64 "] init[%" PRIu64
+          "] distribute[%" PRIu64 "] args_h2d[%" PRIu64
+          "] micro seconds, task_num[%zu]concurrent_parse_task_num[%zu]parse_thread_num[%zu]model_id[%u].",
+          task_phase_cost.parse_cost, task_phase_cost.init_cost, mdl_prof_.task_distribute_cost,
+          mdl_prof_.args_h2d_cost, task_list_.size(), task_phase_cost.concurrent_parse_task_num,
+          task_phase_cost.parse_thread_num, model_id_);
 
   if (!mdl_prof_.enable_flag) {
     return;
@@ -2807,9 +2820,26 @@ void DavinciModel::InitModelInputsMergeCopyHostMem() {
   GELOGI("[InputMergeCopy]host base: %p, first input index: %u, fusion input num: %zu, size:%" PRIu64,
          input_merge_copy_mem_base_.get(), fisrt_input_index_of_merge_copy_, input_index_to_merge_copy_offset_.size(),
          input_merge_copy_mem_size_);
+  InitInputMergeCopyPrefetcher();
   return;
 }
 
+void DavinciModel::InitInputMergeCopyPrefetcher() {
+  std::string prefetch_str;
+  (void)GetThreadLocalContext().GetOption(kInputMergeCopyPrefetch, prefetch_str);
+  if (prefetch_str != "1") {
+    return;
+  }
+  auto prefetcher = MakeUnique<InputMergeCopyPrefetcher>();
+  if ((prefetcher == nullptr) || (prefetcher->Init(input_merge_copy_mem_size_) != SUCCESS)) {
+    GELOGW("[InputMergeCopy] init prefetcher failed, size:%" PRIu64 ", run without prefetch.",
+           input_merge_copy_mem_size_);
+    return;
+  }
+  input_merge_copy_prefetcher_ = std::move(prefetcher);
+  GELOGI("[InputMergeCopy] prefetch enabled, model id:%u, size:%" PRIu64, model_id_, input_merge_copy_mem_size_);
+}
+
 Status DavinciModel::GetMemAllocationByLogicAddr(const uint64_t addr, MemAllocationAndOffset &allocation_info) const {
   for (const auto &item : logical_mem_allocations_) {
     if ((addr >= item.logical_addr) && (addr < (item.logical_addr + item.data_size))) {
@@ -4591,11 +4621,11 @@ Status DavinciModel::CopyInputData(const InputData &input_data) {
   return TensorTransUtils::TryBatchMemcpy(memcpy_batch_params_);
 }
 
-Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
+Status DavinciModel::PackMergeCopyInputs(const InputData &input_data, uint8_t *const host_base,
+                                         std::vector<size_t> &non_merge_copy_indexs,
+                                         void *&merge_copy_device_addr) const {
   const std::vector<DataBuffer> &blobs = input_data.blobs;
-  std::vector<size_t> non_merge_copy_indexs;
-  void *input_merge_copy_device_addr = nullptr;
-
+  merge_copy_device_addr = nullptr;
   for (const auto &data_info : input_data_info_) {
     const size_t data_idx = data_info.first;
     if (data_idx >= blobs.size()) {
@@ -4609,8 +4639,8 @@ Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
       return FAILED;
     }
     // find device addr for merge copy
-    input_merge_copy_device_addr =
-        (data_idx == fisrt_input_index_of_merge_copy_) ? data_info.second.GetBasicAddr() : input_merge_copy_device_addr;
+    merge_copy_device_addr =
+        (data_idx == fisrt_input_index_of_merge_copy_) ? data_info.second.GetBasicAddr() : merge_copy_device_addr;
 
     const DataBuffer &data_buf = blobs.at(data_idx);
     if (data_buf.length == 0U) {
@@ -4631,6 +4661,10 @@ Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
       non_merge_copy_indexs.push_back(data_idx);
       continue;
     }
+    // 输入已被预取到device暂存内存时无需再打包
+    if (host_base == nullptr) {
+      continue;
+    }
 
     // copy input to host buffer, h2h
     const auto host_offset = merge_copy_offset->second;
@@ -4638,23 +4672,48 @@ Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
            "] datasize[%" PRIu64 "]",
            runtime_param_.graph_id, data_info.second.GetOpName().c_str(), data_idx, host_offset, data_buf.data,
            data_size, data_buf.length);
-    const auto mem_ret =
-        GeMemcpy(input_merge_copy_mem_base_.get() + host_offset, input_merge_copy_mem_size_ - host_offset,
-                 reinterpret_cast<uint8_t *>(data_buf.data), data_buf.length);
+    const auto mem_ret = GeMemcpy(host_base + host_offset, input_merge_copy_mem_size_ - host_offset,
+                                  reinterpret_cast<uint8_t *>(data_buf.data), data_buf.length);
     GE_CHK_BOOL_RET_STATUS(mem_ret == SUCCESS, FAILED,
                            "memcpy fail, graph %u, index %zu, data len:%" PRIu64 ", buffer size:%" PRIu64
                            ", offset:%" PRIu64,
                            runtime_param_.graph_id, data_idx, data_buf.length, input_merge_copy_mem_size_, host_offset);
   }
-
-  // merge copy input to device buffer, h2d
-  GELOGI("[InputMergeCopy]CopyPlainData graph_%u type[F] dst[%p] src[%p] mem_size[%" PRIu64 "].",
-         runtime_param_.graph_id, input_merge_copy_device_addr, input_merge_copy_mem_base_.get(),
-         input_merge_copy_mem_size_);
-  GE_CHECK_NOTNULL(input_merge_copy_device_addr,
+  GE_CHECK_NOTNULL(merge_copy_device_addr,
                    "invalid input_merge_copy_device_addr value, input_merge_copy_device_addr is nullptr");
-  GE_CHK_ACL_RET(aclrtMemcpy(input_merge_copy_device_addr, input_merge_copy_mem_size_, input_merge_copy_mem_base_.get(),
-                             input_merge_copy_mem_size_, ACL_MEMCPY_HOST_TO_DEVICE));
+  return SUCCESS;
+}
+
+Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
+  const std::vector<DataBuffer> &blobs = input_data.blobs;
+  std::vector<size_t> non_merge_copy_indexs;
+  void *input_merge_copy_device_addr = nullptr;
+  const bool prefetched = (input_merge_copy_prefetcher_ != nullptr) && input_merge_copy_prefetcher_->IsReady();
+  const Status pack_ret =
+      PackMergeCopyInputs(input_data, prefetched ? nullptr : input_merge_copy_mem_base_.get(), non_merge_copy_indexs,
+                          input_merge_copy_device_addr);
+  if (pack_ret != SUCCESS) {
+    if (prefetched) {
+      input_merge_copy_prefetcher_->Discard();
+    }
+    return pack_ret;
+  }
+
+  if (prefetched) {
+    // 上一步执行期间已拷贝到device暂存内存，这里只在模型流上下发等待及D2D拷贝
+    GELOGI("[InputMergeCopy]CopyPrefetchedData graph_%u type[F] dst[%p] mem_size[%" PRIu64 "].",
+           runtime_param_.graph_id, input_merge_copy_device_addr, input_merge_copy_mem_size_);
+    GE_CHK_STATUS_RET(input_merge_copy_prefetcher_->Consume(input_merge_copy_device_addr, rt_model_stream_),
+                      "[InputMergeCopy] consume prefetched input failed, model id:%u", model_id_);
+  } else {
+    // merge copy input to device buffer, h2d
+    GELOGI("[InputMergeCopy]CopyPlainData graph_%u type[F] dst[%p] src[%p] mem_size[%" PRIu64 "].",
+           runtime_param_.graph_id, input_merge_copy_device_addr, input_merge_copy_mem_base_.get(),
+           input_merge_copy_mem_size_);
+    GE_CHK_ACL_RET(aclrtMemcpy(input_merge_copy_device_addr, input_merge_copy_mem_size_,
+                               input_merge_copy_mem_base_.get(), input_merge_copy_mem_size_,
+                               ACL_MEMCPY_HOST_TO_DEVICE));
+  }
   // copy non merge copy input
 
   int32_t cur_device_id = -1;
@@ -4689,6 +4748,35 @@ Status DavinciModel::CopyInputDataWithMergeH2D(const InputData &input_data) {
   return TensorTransUtils::TryBatchMemcpy(memcpy_batch_params_);
 }
 
+Status DavinciModel::PrefetchInputDataWithMergeH2D(const InputData &input_data) {
+  uint8_t *host_base = nullptr;
+  GE_CHK_STATUS_RET(input_merge_copy_prefetcher_->AcquireHostBuffer(host_base, stream_sync_timeout_),
+                    "[InputMergeCopy] acquire prefetch buffer failed, model id:%u", model_id_);
+  std::vector<size_t> non_merge_copy_indexs;
+  void *input_merge_copy_device_addr = nullptr;
+  GE_CHK_STATUS_RET_NOLOG(
+      PackMergeCopyInputs(input_data, host_base, non_merge_copy_indexs, input_merge_copy_device_addr));
+  return input_merge_copy_prefetcher_->Submit();
+}
+
+void DavinciModel::PrefetchNextInputData(std::shared_ptr<RunArgs> &next_args) {
+  // 动态shape场景每步还需追加档位输入，不做预取
+  const bool dynamic_shape_data = is_online_infer_dynamic_ && (!is_getnext_sink_dynamic_);
+  if ((input_merge_copy_prefetcher_ == nullptr) || has_no_tiling_input_ || dynamic_shape_data) {
+    return;
+  }
+  if ((data_inputer_.TryPop(next_args) != SUCCESS) || (next_args == nullptr)) {
+    return;
+  }
+  InputData next_data;
+  BuildRunInputData(*next_args, next_data);
+  if (PrefetchInputDataWithMergeH2D(next_data) != SUCCESS) {
+    // 预取失败时下一步退回到同步拷贝，由其上报错误
+    GELOGW("[InputMergeCopy] prefetch next input failed, model id:%u.", model_id_);
+    input_merge_copy_prefetcher_->Discard();
+  }
+}
+
 void DavinciModel::ResetMemcpyBatchParams() {
   memcpy_batch_params_.dsts.clear();
   memcpy_batch_params_.dst_aligned_sizes.clear();
@@ -5557,6 +5645,22 @@ void DavinciModel::ConstructActiveMemBaseAddrs() {
   }
 }
 
+void DavinciModel::BuildRunInputData(const RunArgs &args, InputData &input_data) const {
+  const std::vector<gert::Tensor> &inputs = args.input_tensor;
+  input_data.blobs.reserve(inputs.size());
+  input_data.shapes.reserve(inputs.size());
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    input_data.shapes.emplace_back(TensorTransUtils::GetDimsFromGertShape(inputs[i].GetStorageShape()));
+    DataBuffer data_blob;
+    data_blob.data = ValueToPtr(PtrToValue(inputs[i].GetAddr()));
+    data_blob.length = inputs[i].GetSize();
+    data_blob.placement = static_cast<uint32_t>(gert::TensorPlacementUtils::IsOnDevice(inputs[i].GetPlacement())
+                                                    ? ge::Placement::kPlacementDevice
+                                                    : ge::Placement::kPlacementHost);
+    input_data.blobs.push_back(data_blob);
+  }
+}
+
 void DavinciModel::Run() {
   SET_THREAD_NAME(pthread_self(), "ge_davidmdlrun");
   const uint32_t run_dev_id = device_id_;
@@ -5572,13 +5676,15 @@ void DavinciModel::Run() {
   // DeviceReset before thread run finished!
   GE_MAKE_GUARD(reset_device, [run_dev_id]() { GE_CHK_STATUS(ModelUtils::ResetDevice(run_dev_id)); });
 
+  // 上一步执行期间已取出并预取了输入的下一步
+  std::shared_ptr<RunArgs> prefetched_args;
   while (run_flg_) {
     // Model hasn't truly started running before received data
     const bool is_prof_enabled = gert::GlobalProfilingWrapper::GetInstance()->IsEnabled(gert::ProfilingType::kTaskTime);
     SetRunningFlag(false);
     std::vector<gert::Tensor> outputs;
-    std::shared_ptr<RunArgs> args;
-    Status ret = data_inputer_.Pop(args);
+    std::shared_ptr<RunArgs> args = std::move(prefetched_args);
+    Status ret = (args != nullptr) ? SUCCESS : data_inputer_.Pop(args);
     const bool close_terminated = (args == nullptr) || (ret != SUCCESS) || (!run_flg_);
     if (close_terminated) {
       GELOGW("args is null or data queue closed, exit!");
@@ -5591,19 +5697,7 @@ void DavinciModel::Run() {
 
     SetRunningFlag(true);
     InputData current_data;
-    const std::vector<gert::Tensor> &inputs = args->input_tensor;
-    current_data.blobs.reserve(inputs.size());
-    current_data.shapes.reserve(inputs.size());
-    for (size_t i = 0U; i < inputs.size(); ++i) {
-      current_data.shapes.emplace_back(TensorTransUtils::GetDimsFromGertShape(inputs[i].GetStorageShape()));
-      DataBuffer data_blob;
-      data_blob.data = ValueToPtr(PtrToValue(inputs[i].GetAddr()));
-      data_blob.length = inputs[i].GetSize();
-      data_blob.placement = static_cast<uint32_t>(gert::TensorPlacementUtils::IsOnDevice(inputs[i].GetPlacement())
-                                                      ? ge::Placement::kPlacementDevice
-                                                      : ge::Placement::kPlacementHost);
-      current_data.blobs.push_back(data_blob);
-    }
+    BuildRunInputData(*args, current_data);
     if (MallocPhysicalMemory() != SUCCESS) {
       OnComputeDoneWithResultCallback(args, 0U, INTERNAL_ERROR, outputs);
       return;
@@ -5633,6 +5727,9 @@ void DavinciModel::Run() {
     GELOGI("Model thread Run begin, model id:%u, data index:%u.", model_id_, 0U);
     ret = HandleInputData(current_data);
     if (ret != SUCCESS) {
+      if (input_merge_copy_prefetcher_ != nullptr) {
+        input_merge_copy_prefetcher_->Discard();
+      }
       GELOGE(FAILED, "[Call][HandleInputData] handle input data failed, model_id:%u.", model_id_);
       OnComputeDoneWithResultCallback(args, 0U, INTERNAL_ERROR, outputs);
       continue;
@@ -5653,6 +5750,8 @@ void DavinciModel::Run() {
     CANN_PROFILING_STEP_TRACE(model_id_, iterator_count_, 1U, rt_model_stream_);
     GE_IF_BOOL_EXEC(is_first_execute_, GE_TIMESTAMP_EVENT_END(aclmdlRIExecuteAsync, "aclmdlRIExecuteAsync"));
     iterator_count_++;
+    // 在等待本步执行完成前，打包下一步的合并输入并在拷贝流上异步H2D，与本步执行重叠
+    PrefetchNextInputData(prefetched_args);
 
     GE_TIMESTAMP_START(aclrtSynchronizeStreamWithTimeout);
     GELOGI("aclrtSynchronizeStreamWithTimeout start, model id:%u.", model_id_);
@@ -5670,6 +5769,9 @@ void DavinciModel::Run() {
       GELOGE(FAILED, "[Invoke][aclrtSynchronizeStreamWithTimeout] failed, timeout:%dms, ret:%d.", stream_sync_timeout_,
              rt_ret);
       OnComputeDoneWithResultCallback(args, 0U, INTERNAL_ERROR, outputs);
+      if (prefetched_args != nullptr) {
+        OnComputeDoneWithResultCallback(prefetched_args, 0U, INTERNAL_ERROR, outputs);
+      }
       return;
     }
     const bool model_abort = ((rt_ret == kSinkModelAbortNormal) || (rt_ret == kSinkModelAbortNormalNew));
@@ -7724,7 +7826,7 @@ Status DavinciModel::NnExecute(aclrtStream const stream, const bool async_mode,
   const bool is_prof_enabled = gert::GlobalProfilingWrapper::GetInstance()->IsEnabled(gert::ProfilingType::kTaskTime);
   GE_IF_BOOL_EXEC(is_prof_enabled, SetProfileTime(ModelProcStage::MODEL_PRE_PROC_START));
   GE_IF_BOOL_EXEC(is_dump_to_std_enable_,
-                  davinci_model_stage_time_[kStageBeforeH2D] = std::chrono::system_clock::now());
+                  davinci_model_stage_time_[kStageBeforeH2D] = gert::ProfilingClock::now());
 
   GetStageTimestampStart(kCopyMdlData);
   Status ret = CopyModelData(input_tensor, output_tensor);
@@ -7735,7 +7837,7 @@ Status DavinciModel::NnExecute(aclrtStream const stream, const bool async_mode,
   }
 
   GE_IF_BOOL_EXEC(is_dump_to_std_enable_,
-                  davinci_model_stage_time_[kStageBeforeRtExecute] = std::chrono::system_clock::now());
+                  davinci_model_stage_time_[kStageBeforeRtExecute] = gert::ProfilingClock::now());
   GE_IF_BOOL_EXEC(is_prof_enabled, SetProfileTime(ModelProcStage::MODEL_PRE_PROC_END));
   // 自动多流寻优打点：口径为「任务下发 -> 流同步完成」，不含 H2D / D2H 拷贝
   multistream_tune::StepScope step(multistream_tune::kSiteNnExecute, auto_multistream_tuning_mode_, model_id_,
@@ -7787,7 +7889,7 @@ Status DavinciModel::NnExecute(aclrtStream const stream, const bool async_mode,
   }
   step.Stop(SUCCESS);
   GE_IF_BOOL_EXEC(is_dump_to_std_enable_,
-                  davinci_model_stage_time_[kStageAfterRtExecute] = std::chrono::system_clock::now());
+                  davinci_model_stage_time_[kStageAfterRtExecute] = gert::ProfilingClock::now());
   GE_IF_BOOL_EXEC(is_prof_enabled, SetProfileTime(ModelProcStage::MODEL_AFTER_PROC_START));
   GetStageTimestampStart(kCopyOutputData);
   ret = CopyOutputData(output_tensor);
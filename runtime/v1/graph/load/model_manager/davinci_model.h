@@ -28,6 +28,7 @@
 #include "graph/load/model_manager/aipp_utils.h"
 #include "common/dump/data_dumper.h"
 #include "graph/load/model_manager/data_inputer.h"
+#include "graph/load/model_manager/input_merge_copy_prefetcher.h"
 #include "graph/load/model_manager/model_utils.h"
 #include "graph/load/model_manager/model_args_manager.h"
 #include "graph/load/model_manager/tbe_kernel_handle.h"
@@ -127,6 +128,9 @@ struct DavinciModelProf {
   uint64_t init_end;
   uint64_t execute_begin;
   uint64_t execute_end;
+  // task下发与加载阶段args全量h2d拷贝的耗时，单位us
+  uint64_t task_distribute_cost = 0UL;
+  uint64_t args_h2d_cost = 0UL;
   // 以下定义数据记录受环境变量控制
   std::map<ModelProfStage, uint64_t> stage_to_timestamp;
   std::map<uint32_t, uint64_t> task_type_to_distribute_time;
@@ -1021,6 +1025,8 @@ class DavinciModel {
   Status RecoverModel();
 
   void SetTilingSinkTaskArgDescs(uint32_t op_index, std::vector<ArgDesc> &arg_descs) {
+    // task解析阶段可能被多线程并发调用
+    const std::lock_guard<std::mutex> lk(tiling_sink_task_arg_descs_mutex_);
     tiling_sink_task_arg_descs_list_[op_index] = arg_descs;
     for (size_t i = 0; i < arg_descs.size(); i++) {
       GELOGI("set op index: %u, arg desc index: %zu, arg desc type: %d", op_index, i,
@@ -1029,6 +1035,7 @@ class DavinciModel {
   }
 
   Status GetAndEraseTilingSinkTaskArgDescs(uint32_t op_index, std::vector<ArgDesc> &arg_descs) {
+    const std::lock_guard<std::mutex> lk(tiling_sink_task_arg_descs_mutex_);
     const auto it = tiling_sink_task_arg_descs_list_.find(op_index);
     if (it == tiling_sink_task_arg_descs_list_.end()) {
       return FAILED;
@@ -1139,6 +1146,15 @@ class DavinciModel {
 
   Status CopyInputDataWithMergeH2D(const InputData &input_data);
 
+  Status PackMergeCopyInputs(const InputData &input_data, uint8_t *const host_base,
+                             std::vector<size_t> &non_merge_copy_indexs, void *&merge_copy_device_addr) const;
+
+  void BuildRunInputData(const RunArgs &args, InputData &input_data) const;
+
+  void PrefetchNextInputData(std::shared_ptr<RunArgs> &next_args);
+
+  Status PrefetchInputDataWithMergeH2D(const InputData &input_data);
+
   Status CopyInputData(const InputData &input_data);
 
   void ResetMemcpyBatchParams();
@@ -1503,6 +1519,7 @@ class DavinciModel {
                            const std::vector<OpDescPtr> &output_op_list);
 
   void InitModelInputsMergeCopyHostMem();
+  void InitInputMergeCopyPrefetcher();
 
   void InitBatchMemcpyH2d();
 
@@ -1813,6 +1830,8 @@ class DavinciModel {
   uint64_t input_merge_copy_mem_size_{0UL};
   std::map<uint32_t, uint64_t> input_index_to_merge_copy_offset_;
   uint32_t fisrt_input_index_of_merge_copy_{0U};  // index of input locate at the begin of merge copy buffer
+  // 模型执行期间预取下一步的合并输入，仅在异步执行线程Run中使用
+  std::unique_ptr<InputMergeCopyPrefetcher> input_merge_copy_prefetcher_;
   MemcpyBatchParam memcpy_batch_params_;
 
   void InitModelProf();
@@ -1873,12 +1892,13 @@ class DavinciModel {
   std::map<uint32_t, void *> mem_event_id_mem_map_;
   ModelDevMemStatistic dev_mem_statistic_{};
   bool support_extend_memory_full_{false};
-  std::chrono::time_point<std::chrono::system_clock> davinci_model_stage_time_[kStageEnd]{};
+  gert::ProfilingTimePoint davinci_model_stage_time_[kStageEnd]{};
   std::unordered_set<uint32_t> copy_host_input_indexes_;
   std::vector<CopyHostInputInfo> copy_host_input_infos_;
   uint64_t host_input_size_{0UL};
   std::map<uint32_t, std::shared_ptr<MemoryBlockManager>> mem_type_to_allocator_;
 
+  std::mutex tiling_sink_task_arg_descs_mutex_;
   std::map<uint32_t, std::vector<ArgDesc>> tiling_sink_task_arg_descs_list_;
 
   std::vector<DumpProcState> dump_fsm_state_;
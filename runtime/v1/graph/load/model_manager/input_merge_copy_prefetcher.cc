@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "input_merge_copy_prefetcher.h"
+
+#include "common/aclrt_malloc_helper.h"
+#include "common/checker.h"
+#include "framework/common/debug/ge_log.h"
+#include "rt_external.h"
+#include "securec.h"
+
+namespace ge {
+InputMergeCopyPrefetcher::~InputMergeCopyPrefetcher() {
+  Release();
+}
+
+void InputMergeCopyPrefetcher::Release() {
+  // 拷贝流上可能仍有在途的H2D拷贝，需等待完成后才能释放内存
+  if ((copy_stream_ != nullptr) && (aclrtSynchronizeStream(copy_stream_) != ACL_SUCCESS)) {
+    GELOGW("[InputMergeCopy] synchronize prefetch stream failed, buffers may be still in use.");
+  }
+  for (auto &buffer : buffers_) {
+    if (buffer.event != nullptr) {
+      (void)aclrtDestroyEvent(buffer.event);
+    }
+    if (buffer.host_addr != nullptr) {
+      (void)aclrtFreeHost(buffer.host_addr);
+    }
+    if (buffer.dev_addr != nullptr) {
+      (void)aclrtFree(buffer.dev_addr);
+    }
+    buffer = Buffer{nullptr, nullptr, nullptr, false};
+  }
+  if (copy_stream_ != nullptr) {
+    (void)aclrtDestroyStream(copy_stream_);
+    copy_stream_ = nullptr;
+  }
+  buffer_size_ = 0UL;
+  ready_ = false;
+}
+
+Status InputMergeCopyPrefetcher::Init(const uint64_t buffer_size) {
+  GE_ASSERT_TRUE(copy_stream_ == nullptr, "[InputMergeCopy] prefetcher has been initialized.");
+  GE_ASSERT_TRUE(buffer_size > 0UL, "[InputMergeCopy] invalid prefetch buffer size %" PRIu64 ".", buffer_size);
+  if (aclrtCreateStream(&copy_stream_) != ACL_SUCCESS) {
+    GELOGW("[InputMergeCopy] create prefetch stream failed.");
+    copy_stream_ = nullptr;
+    return FAILED;
+  }
+  for (size_t i = 0U; i < kBufferNum; ++i) {
+    auto &buffer = buffers_[i];
+    void *host_mem = nullptr;
+    if ((AclrtMallocHost(&host_mem, buffer_size, GE_MODULE_NAME_U16) != ACL_SUCCESS) || (host_mem == nullptr)) {
+      GELOGW("[InputMergeCopy] alloc prefetch host buffer failed, size:%" PRIu64 ", index:%zu.", buffer_size, i);
+      Release();
+      return FAILED;
+    }
+    buffer.host_addr = static_cast<uint8_t *>(host_mem);
+    (void)memset_s(buffer.host_addr, buffer_size, 0, buffer_size);
+    if ((AclrtMalloc(&buffer.dev_addr, buffer_size, RT_MEMORY_HBM, GE_MODULE_NAME_U16) != ACL_SUCCESS) ||
+        (buffer.dev_addr == nullptr)) {
+      GELOGW("[InputMergeCopy] alloc prefetch device buffer failed, size:%" PRIu64 ", index:%zu.", buffer_size, i);
+      buffer.dev_addr = nullptr;
+      Release();
+      return FAILED;
+    }
+    if (aclrtCreateEvent(&buffer.event) != ACL_SUCCESS) {
+      GELOGW("[InputMergeCopy] create prefetch event failed, index:%zu.", i);
+      buffer.event = nullptr;
+      Release();
+      return FAILED;
+    }
+  }
+  buffer_size_ = buffer_size;
+  GELOGI("[InputMergeCopy] init prefetcher success, buffer size:%" PRIu64 ", copy stream:%p.", buffer_size,
+         copy_stream_);
+  return SUCCESS;
+}
+
+Status InputMergeCopyPrefetcher::AcquireHostBuffer(uint8_t *&host_addr, const int32_t timeout) {
+  GE_ASSERT_TRUE(buffer_size_ > 0UL, "[InputMergeCopy] prefetcher is not initialized.");
+  GE_ASSERT_TRUE(!ready_, "[InputMergeCopy] last prefetch has not been consumed.");
+  auto &buffer = buffers_[GetFreeIndex()];
+  if (buffer.in_flight) {
+    aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+    if ((aclrtQueryEventStatus(buffer.event, &status) != ACL_SUCCESS) ||
+        (status != ACL_EVENT_RECORDED_STATUS_COMPLETE)) {
+      GE_ASSERT_RT_OK(aclrtSynchronizeEventWithTimeout(buffer.event, timeout));
+    }
+    buffer.in_flight = false;
+  }
+  host_addr = buffer.host_addr;
+  return SUCCESS;
+}
+
+Status InputMergeCopyPrefetcher::Submit() {
+  GE_ASSERT_TRUE(buffer_size_ > 0UL, "[InputMergeCopy] prefetcher is not initialized.");
+  GE_ASSERT_TRUE(!ready_, "[InputMergeCopy] last prefetch has not been consumed.");
+  const size_t index = GetFreeIndex();
+  auto &buffer = buffers_[index];
+  GE_ASSERT_TRUE(!buffer.in_flight, "[InputMergeCopy] prefetch buffer %zu must be acquired before submit.", index);
+  GE_ASSERT_RT_OK(aclrtMemcpyAsync(buffer.dev_addr, buffer_size_, buffer.host_addr, buffer_size_,
+                                   ACL_MEMCPY_HOST_TO_DEVICE, copy_stream_));
+  buffer.in_flight = true;
+  GE_ASSERT_RT_OK(aclrtRecordEvent(buffer.event, copy_stream_));
+  ready_index_ = index;
+  ready_ = true;
+  return SUCCESS;
+}
+
+Status InputMergeCopyPrefetcher::Consume(void *const dst, aclrtStream const model_stream) {
+  GE_ASSERT_TRUE(ready_, "[InputMergeCopy] no prefetched input to consume.");
+  GE_ASSERT_NOTNULL(dst);
+  // 无论成功与否，本次预取都不能再被使用
+  ready_ = false;
+  const auto &buffer = buffers_[ready_index_];
+  GE_ASSERT_RT_OK(aclrtStreamWaitEvent(model_stream, buffer.event));
+  consumed_index_ = ready_index_;
+  GE_ASSERT_RT_OK(aclrtMemcpyAsync(dst, buffer_size_, buffer.dev_addr, buffer_size_, ACL_MEMCPY_DEVICE_TO_DEVICE,
+                                   model_stream));
+  return SUCCESS;
+}
+}  // namespace ge
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_INPUT_MERGE_COPY_PREFETCHER_H_
+#define AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_INPUT_MERGE_COPY_PREFETCHER_H_
+
+#include <array>
+#include <cstdint>
+
+#include "acl/acl_rt.h"
+#include "ge_common/ge_api_error_codes.h"
+
+namespace ge {
+/**
+ * 输入合并拷贝的预取双缓冲：
+ * 模型执行第N步期间，把第N+1步的小输入打包到host锁页内存，在独立的拷贝流上异步H2D拷贝到device暂存内存；
+ * 第N+1步下发前，模型流先等待该拷贝完成，再以一次D2D拷贝把暂存内存搬到模型的输入内存。
+ * 暂存内存有两份，预取总是写入最近一次被消费之外的那一份，因此不会覆盖第N步仍在读取的暂存内存。
+ */
+class InputMergeCopyPrefetcher {
+ public:
+  InputMergeCopyPrefetcher() = default;
+  ~InputMergeCopyPrefetcher();
+  InputMergeCopyPrefetcher(const InputMergeCopyPrefetcher &) = delete;
+  InputMergeCopyPrefetcher &operator=(const InputMergeCopyPrefetcher &) = delete;
+
+  Status Init(uint64_t buffer_size);
+
+  /**
+   * 获取用于打包下一步输入的host内存，若其上一次的H2D拷贝尚未完成则等待
+   * @param timeout 等待超时时间，单位ms，-1表示一直等待
+   */
+  Status AcquireHostBuffer(uint8_t *&host_addr, int32_t timeout);
+
+  /**
+   * 在拷贝流上下发host内存到device暂存内存的异步拷贝，不等待拷贝完成
+   */
+  Status Submit();
+
+  /**
+   * 在模型流上等待预取的拷贝完成，并把暂存内存拷贝到模型输入内存dst
+   */
+  Status Consume(void *dst, aclrtStream model_stream);
+
+  /**
+   * 丢弃已下发但不会被消费的预取
+   */
+  void Discard() {
+    ready_ = false;
+  }
+
+  bool IsReady() const {
+    return ready_;
+  }
+  uint64_t GetBufferSize() const {
+    return buffer_size_;
+  }
+  aclrtStream GetCopyStream() const {
+    return copy_stream_;
+  }
+
+ private:
+  static constexpr size_t kBufferNum = 2U;
+  struct Buffer {
+    uint8_t *host_addr;
+    void *dev_addr;
+    aclrtEvent event;
+    bool in_flight;
+  };
+  size_t GetFreeIndex() const {
+    return (consumed_index_ + 1U) % kBufferNum;
+  }
+  void Release();
+
+  std::array<Buffer, kBufferNum> buffers_{};
+  aclrtStream copy_stream_{nullptr};
+  uint64_t buffer_size_{0UL};
+  // 初始时让第一次预取使用buffers_[0]
+  size_t consumed_index_{kBufferNum - 1U};
+  size_t ready_index_{0U};
+  bool ready_{false};
+};
+}  // namespace ge
+
+#endif  // AIR_CXX_EXECUTOR_GRAPH_LOAD_MODEL_MANAGER_INPUT_MERGE_COPY_PREFETCHER_H_
@@ -17,9 +17,11 @@
 #include "common/dump/kernel_tracing_utils.h"
 #include "common/compile_profiling/ge_call_wrapper.h"
 #include "common/runtime_api_wrapper.h"
+#include "common/thread_pool/thread_pool.h"
 #include "common/utils/executor_utils.h"
 #include "framework/common/op/ge_op_utils.h"
 #include "graph/ge_context.h"
+#include "graph/ge_local_context.h"
 #include "graph/load/model_manager/model_manager.h"
 #include "graph/manager/mem_manager.h"
 #include "graph/manager/trans_var_data_utils.h"
@@ -58,6 +60,10 @@ constexpr const ge::char_t *kCoreTypeAIV = "AIV";
 const std::string kAddrRefreshOpName = "UpdateModelParam_static_bin";
 const std::string kAddrRefreshOpType = "Data";
 constexpr uint32_t kModelLoadStage = 0;
+// 可并发解析的task数达到阈值后才分片并发解析，避免小模型承担线程池开销
+constexpr size_t kMinConcurrentParseTaskNum = 1024UL;
+constexpr size_t kMinTaskNumPerParseShard = 256UL;
+constexpr size_t kMaxParseThreadNum = 8UL;
 }  // namespace
 namespace ge {
 rtMemType_t GetRtsMemoryType(const ArgsPlacement placement, const int64_t size) {
@@ -600,7 +606,10 @@ Status ModelArgsManager::InitTaskInfoV2(domi::ModelTaskDef &model_task_def) {
   std::vector<TaskRunParam> task_indexes_to_run_param(task_size);
   TaskNodeMap task_node_map;
   GE_ASSERT_SUCCESS(task_node_map.Init(davinci_model_->GetCompiledComputeGraph(), task_size));
+  load_phase_cost_ = LoadPhaseCost{};
+  const uint64_t parse_begin = ge::GetCurrentTimestamp();
   GE_ASSERT_SUCCESS(ParseModelTaskDef(model_task_def, task_indexes_to_run_param, task_node_map));
+  load_phase_cost_.parse_cost = ge::GetCurrentTimestamp() - parse_begin;
 
   // todo 逻辑地址与memory type的对应关系，看起来通过task_info返回有些重复了，因为不同的task
   //      info可能返回同一个逻辑地址，而一个逻辑地址是什么memory type是确定的，没必要在每个task info中都返回一
@@ -631,6 +640,8 @@ Status ModelArgsManager::InitTaskInfoV2(domi::ModelTaskDef &model_task_def) {
   GE_ASSERT_SUCCESS(ConstructTaskInitParams(task_indexes_to_refresh_type, logical_addrs_to_memory_type,
                                             std::move(task_indexes_to_run_param), task_indexes_to_init_param));
 
+  // task info的Init会修改davinci model中的共享状态(内存申请、零拷贝地址、kernel handle等)，保持串行
+  const uint64_t init_begin = ge::GetCurrentTimestamp();
   for (size_t i = 0UL; i < task_list_ptr_->size(); ++i) {
     const auto task_info = task_list_ptr_->at(i);
     // todo persistent workspaces not set yet
@@ -655,6 +666,7 @@ Status ModelArgsManager::InitTaskInfoV2(domi::ModelTaskDef &model_task_def) {
     GE_ASSERT_SUCCESS(
         GenAllocationToIowPaRemapInfos(task_info, task_node_map.FindNodeByTaskIndex(i).node, pa_remap_infos));
   }
+  load_phase_cost_.init_cost = ge::GetCurrentTimestamp() - init_begin;
 
   /*
    * todo: davinci model中存在编译时即返回的不支持零拷贝的输入输出，这部分信息需要被利用
@@ -670,6 +682,7 @@ Status ModelArgsManager::InitTaskInfoV2(domi::ModelTaskDef &model_task_def) {
    * 判断一个输入/输出是否可以零拷贝：当模型的输入/输出地址不是modelio段时，本输入/输出不可以零拷贝。
    * todo: 不可以零拷贝的段被识别后，需要返回给davinci model，在模型执行前/后，做显式的拷贝动作
    */
+  GE_ASSERT_SUCCESS(CompileArgsPatchProgram());
   GE_CHK_RT_RET(rtNeedDevVA2PA(&need_dev_va_2_pa_));
   if (update_version_ != 1) {
     InitForUpdate();
@@ -721,33 +734,37 @@ void ModelArgsManager::UpdateHostArgs(uint64_t *active_mem_base_addr) {
     if (active_mem_base_addr[id] == last_bases_[id]) {
       continue;
     }
-
-    for (const auto &info : allocation_ids_to_model_args_refresh_infos_addr_all[id]) {
-      *(PtrToPtr<void, uint64_t>(info.host_args_addr)) = active_mem_base_addr[id] + info.offset;
-      GELOGI("[Args][Updater] update model args refresh info:[%s], active addr:0x%llx.", info.ToString().c_str(),
-             *(PtrToPtr<void, uint64_t>(info.host_args_addr)));
-    }
-    dfx_info_.update_addr_num += allocation_ids_to_model_args_refresh_infos_addr_all[id].size();
-
-    for (const auto &info : allocation_ids_to_model_args_refresh_infos_addr_low_32bit[id]) {
-      *(PtrToPtr<void, uint32_t>(info.host_args_addr)) =
-          static_cast<uint32_t>((active_mem_base_addr[id] + info.offset) & k32BitsMask);
-      GELOGI("[Args][Updater] update model args refresh info:[%s], active addr:0x%x", info.ToString().c_str(),
-             *(PtrToPtr<void, uint32_t>(info.host_args_addr)));
-    }
-    dfx_info_.update_addr_num += allocation_ids_to_model_args_refresh_infos_addr_low_32bit[id].size();
-
-    for (const auto &info : allocation_ids_to_model_args_refresh_infos_addr_high_32bit[id]) {
-      *(PtrToPtr<void, uint32_t>(info.host_args_addr)) =
-          static_cast<uint32_t>((active_mem_base_addr[id] + info.offset) >> k32Bits);
-      GELOGI("[Args][Updater] update model args refresh info:%s, active addr:0x%x", info.ToString().c_str(),
-             *(PtrToPtr<void, uint32_t>(info.host_args_addr)));
+    const size_t patch_num = args_patch_program_.Execute(static_cast<uint32_t>(id), active_mem_base_addr[id]);
+    dfx_info_.update_addr_num += patch_num;
+    if (logLevel_ <= DLOG_INFO) {
+      GELOGI("[Args][Updater] allocation id:%zu, active addr:0x%llx, update %zu addrs in %zu runs.", id,
+             active_mem_base_addr[id], patch_num, args_patch_program_.GetRunNum(static_cast<uint32_t>(id)));
     }
-
     last_bases_[id] = active_mem_base_addr[id];
   }
 }
 
+Status ModelArgsManager::CompileArgsPatchProgram() {
+  args_patch_program_.Reset(allocation_ids_to_model_args_refresh_infos_addr_all.size());
+  const auto add_patches = [this](const std::vector<std::vector<ModelArgsRefreshInfo>> &id_to_infos,
+                                  const ArgsPatchProgram::PatchFormat format) -> Status {
+    for (const auto &infos : id_to_infos) {
+      for (const auto &info : infos) {
+        GE_ASSERT_SUCCESS(args_patch_program_.AddPatch(info.id, format, info.host_args_addr, info.offset),
+                          "Failed to add args patch, model args refresh info:[%s]", info.ToString().c_str());
+      }
+    }
+    return SUCCESS;
+  };
+  GE_ASSERT_SUCCESS(
+      add_patches(allocation_ids_to_model_args_refresh_infos_addr_all, ArgsPatchProgram::PatchFormat::kAddrAll));
+  GE_ASSERT_SUCCESS(add_patches(allocation_ids_to_model_args_refresh_infos_addr_low_32bit,
+                                ArgsPatchProgram::PatchFormat::kAddrLow32Bit));
+  GE_ASSERT_SUCCESS(add_patches(allocation_ids_to_model_args_refresh_infos_addr_high_32bit,
+                                ArgsPatchProgram::PatchFormat::kAddrHigh32Bit));
+  return args_patch_program_.Compile();
+}
+
 void ModelArgsManager::GenModelArgsAaddrAfterDistributed() {
   // 满足以下条件才用算子刷新
   // 1、地址刷新算子已加载
@@ -1669,14 +1686,11 @@ Status ModelArgsManager::ParseModelTaskDef(domi::ModelTaskDef &model_task_def,
     reserved_segments_[i].current_offset = 0UL;
   }
   davinci_model_->ResetDumpFsmState();
+  GE_ASSERT_SUCCESS(ParseTaskRunParams(model_task_def, task_indexes_to_run_param));
+  // 以下记录依赖task顺序，在全部task解析完成后按task顺序串行处理
   for (size_t i = 0UL; i < task_size; ++i) {
-    domi::TaskDef *const task_def = model_task_def.mutable_task(static_cast<int32_t>(i));
-
-    auto &task_info = task_list_ptr_->at(i);
-    task_info = TaskInfoFactory::Instance().Create(static_cast<ModelTaskType>(task_def->type()));
-    GE_ASSERT_NOTNULL(task_info, "Failed to create task info from type %d, task index %zu", task_def->type(), i);
-    GE_ASSERT_SUCCESS(task_info->ParseTaskRunParam(*task_def, davinci_model_, task_indexes_to_run_param[i]),
-                      "task index:%zu ParseTaskRunParam failed", i);
+    const domi::TaskDef *const task_def = &model_task_def.task(static_cast<int32_t>(i));
+    const auto &task_info = task_list_ptr_->at(i);
     GE_ASSERT_SUCCESS(ValidateTaskRunParam(task_indexes_to_run_param[i].args_descs),
                       "task index %zu occurred multiple placement, task_type is %d", i, task_def->type());
     has_args_ = (has_args_) || (!task_indexes_to_run_param[i].args_descs.empty());
@@ -1717,6 +1731,79 @@ Status ModelArgsManager::ParseModelTaskDef(domi::ModelTaskDef &model_task_def,
   return SUCCESS;
 }
 
+Status ModelArgsManager::ParseTaskRunParams(domi::ModelTaskDef &model_task_def,
+                                            std::vector<TaskRunParam> &task_indexes_to_run_param) {
+  const size_t task_size = static_cast<size_t>(model_task_def.task_size());
+  std::vector<size_t> concurrent_task_indexes;
+  for (size_t i = 0UL; i < task_size; ++i) {
+    domi::TaskDef *const task_def = model_task_def.mutable_task(static_cast<int32_t>(i));
+    auto &task_info = task_list_ptr_->at(i);
+    task_info = TaskInfoFactory::Instance().Create(static_cast<ModelTaskType>(task_def->type()));
+    GE_ASSERT_NOTNULL(task_info, "Failed to create task info from type %d, task index %zu", task_def->type(), i);
+    if (task_info->IsParseTaskRunParamConcurrent()) {
+      concurrent_task_indexes.emplace_back(i);
+      continue;
+    }
+    GE_ASSERT_SUCCESS(task_info->ParseTaskRunParam(*task_def, davinci_model_, task_indexes_to_run_param[i]),
+                      "task index:%zu ParseTaskRunParam failed", i);
+  }
+
+  if (concurrent_task_indexes.size() < kMinConcurrentParseTaskNum) {
+    for (const size_t i : concurrent_task_indexes) {
+      GE_ASSERT_SUCCESS(task_list_ptr_->at(i)->ParseTaskRunParam(model_task_def.task(static_cast<int32_t>(i)),
+                                                                 davinci_model_, task_indexes_to_run_param[i]),
+                        "task index:%zu ParseTaskRunParam failed", i);
+    }
+    return SUCCESS;
+  }
+  return ParseTaskRunParamsConcurrently(model_task_def, concurrent_task_indexes, task_indexes_to_run_param);
+}
+
+Status ModelArgsManager::ParseTaskRunParamsConcurrently(domi::ModelTaskDef &model_task_def,
+                                                        const std::vector<size_t> &task_indexes,
+                                                        std::vector<TaskRunParam> &task_indexes_to_run_param) {
+  const size_t shard_num =
+      std::min(kMaxParseThreadNum, (task_indexes.size() + kMinTaskNumPerParseShard - 1UL) / kMinTaskNumPerParseShard);
+  const size_t shard_size = (task_indexes.size() + shard_num - 1UL) / shard_num;
+  load_phase_cost_.concurrent_parse_task_num = task_indexes.size();
+  load_phase_cost_.parse_thread_num = shard_num;
+  GELOGI("Parse %zu task run params concurrently, shard num %zu, shard size %zu", task_indexes.size(), shard_num,
+         shard_size);
+
+  ThreadPool thread_pool("ge.parsetask", static_cast<uint32_t>(shard_num), false);
+  std::vector<std::future<Status>> fut_rets;
+  const auto thread_local_context = GetThreadLocalContext();
+  const auto error_manager_context = error_message::GetErrMgrContext();
+  const int32_t device_id = static_cast<int32_t>(davinci_model_->GetDeviceId());
+  for (size_t begin = 0UL; begin < task_indexes.size(); begin += shard_size) {
+    const size_t end = std::min(begin + shard_size, task_indexes.size());
+    // 每个task只写自身的task info与task_indexes_to_run_param中对应的元素，分片之间无共享写
+    auto fut = thread_pool.commit([this, &model_task_def, &task_indexes, &task_indexes_to_run_param, begin, end,
+                                   device_id, thread_local_context, error_manager_context]() -> Status {
+      GetThreadLocalContext() = thread_local_context;
+      error_message::SetErrMgrContext(error_manager_context);
+      GE_CHK_ACL_RET(aclrtSetDevice(device_id));
+      GE_MAKE_GUARD(reset_device, [device_id]() { GE_CHK_RT(aclrtResetDevice(device_id)); });
+      for (size_t k = begin; k < end; ++k) {
+        const size_t i = task_indexes[k];
+        GE_ASSERT_SUCCESS(task_list_ptr_->at(i)->ParseTaskRunParam(model_task_def.task(static_cast<int32_t>(i)),
+                                                                   davinci_model_, task_indexes_to_run_param[i]),
+                          "task index:%zu ParseTaskRunParam failed", i);
+      }
+      return SUCCESS;
+    });
+    GE_ASSERT_TRUE(fut.valid(), "Failed to commit parse task, task index range [%zu, %zu)", begin, end);
+    fut_rets.emplace_back(std::move(fut));
+  }
+  Status ret = SUCCESS;
+  for (auto &fut : fut_rets) {
+    const Status shard_ret = fut.get();
+    ret = (ret == SUCCESS) ? shard_ret : ret;
+  }
+  GE_ASSERT_SUCCESS(ret, "Failed to parse task run params concurrently");
+  return SUCCESS;
+}
+
 const std::vector<ModelArgsManager::ModelArgs> &ModelArgsManager::GetModelArgs() const {
   return model_args_;
 }
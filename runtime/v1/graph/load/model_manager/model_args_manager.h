@@ -38,6 +38,7 @@
 #include "framework/common/util.h"
 #include "framework/runtime/subscriber/global_profiler.h"
 #include "graph/load/model_manager/aicpu_resources.h"
+#include "graph/load/model_manager/args_patch_program.h"
 #include "graph/load/model_manager/aipp_utils.h"
 #include "graph/load/model_manager/cpu_queue_schedule.h"
 #include "graph/load/model_manager/data_inputer.h"
@@ -177,6 +178,14 @@ class ModelArgsManager {
     kStageMax = 8,
   };
 
+  // 加载阶段task info处理的耗时，单位us
+  struct LoadPhaseCost {
+    uint64_t parse_cost = 0UL;
+    uint64_t init_cost = 0UL;
+    size_t concurrent_parse_task_num = 0UL;
+    size_t parse_thread_num = 0UL;
+  };
+
   struct ModelArgsDfxInfo {
     bool enable_flag = false;
     bool get_model_args_device_table_flag = false;
@@ -289,6 +298,9 @@ class ModelArgsManager {
   void PrintDfxStatistics(const uint32_t model_execute_stage = 1);
   Status PaRemapped(const uint64_t va, const uint64_t new_pa, const uint64_t len,
                     std::vector<std::pair<uint64_t, uint64_t>> &overlap_range);
+  const LoadPhaseCost &GetLoadPhaseCost() const {
+    return load_phase_cost_;
+  }
 
  private:
   struct OneTaskUpdateData {
@@ -324,6 +336,11 @@ class ModelArgsManager {
   Status GenKernelLaunchArgs(uint64_t &offset_num);
   Status ParseModelTaskDef(domi::ModelTaskDef &model_task_def, std::vector<TaskRunParam> &task_indexes_to_run_param,
                            TaskNodeMap &task_node_map);
+  // 创建task info并解析TaskRunParam，IsParseTaskRunParamConcurrent的task在task数较多时分片并发解析
+  Status ParseTaskRunParams(domi::ModelTaskDef &model_task_def, std::vector<TaskRunParam> &task_indexes_to_run_param);
+  Status ParseTaskRunParamsConcurrently(domi::ModelTaskDef &model_task_def,
+                                        const std::vector<size_t> &task_indexes,
+                                        std::vector<TaskRunParam> &task_indexes_to_run_param);
   Status ConstructTaskInitParams(
       const std::vector<TaskArgsRefreshTypeClassifier::TaskRefreshType> &task_indexes_to_refresh_type,
       const std::map<std::pair<uint64_t, uint64_t>, MemoryAppType> &logical_addrs_to_mem_app_type,
@@ -341,6 +358,8 @@ class ModelArgsManager {
   Status TaskArgsVa2PaAssociatedWithModelIO(aclrtStream const stm) const;
   void GetStageTimeInfo(ModelArgsManagerStage stage);
   void UpdateHostArgs(uint64_t *active_mem_base_addr);
+  // 将三类刷新信息编译为按host地址排序的刷新程序，供UpdateHostArgs按run批量刷新
+  Status CompileArgsPatchProgram();
 
   Status GenModelArgsRefreshInfosForTask(std::vector<TaskArgsRefreshInfo> &infos, PisToArgs &pls_to_args,
                                          const NodePtr &node);
@@ -377,6 +396,7 @@ class ModelArgsManager {
   uint64_t fm_hit_count_{0U};
   uint64_t model_io_hit_count_{0U};
   ModelArgsDfxInfo dfx_info_{};
+  LoadPhaseCost load_phase_cost_{};
   UpdatePolicy up_;
   std::vector<ModelArgs> model_args_;
   std::vector<ModelArgs> model_persistent_workspace_;
@@ -412,6 +432,7 @@ class ModelArgsManager {
   std::vector<std::vector<ModelArgsRefreshInfo>> allocation_ids_to_model_args_refresh_infos_addr_all;
   std::vector<std::vector<ModelArgsRefreshInfo>> allocation_ids_to_model_args_refresh_infos_addr_low_32bit;
   std::vector<std::vector<ModelArgsRefreshInfo>> allocation_ids_to_model_args_refresh_infos_addr_high_32bit;
+  ArgsPatchProgram args_patch_program_;
 
   std::vector<std::multiset<IowPaRemapInfo>> allocation_ids_to_iow_pa_remap_infos_;
   uint64_t pa_remap_match_support_num_{0UL};
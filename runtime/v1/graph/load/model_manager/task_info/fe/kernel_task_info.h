@@ -63,6 +63,9 @@ class KernelTaskInfo : public TaskInfo {
 
   Status ParseTaskRunParam(const domi::TaskDef &task_def, DavinciModel *const davinci_model,
                            TaskRunParam &task_run_param) override;
+  bool IsParseTaskRunParamConcurrent() const override {
+    return true;
+  }
   Status CopyTilingDataIfNeeded();
 
   Status Release() override;
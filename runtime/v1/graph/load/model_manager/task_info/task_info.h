@@ -522,6 +522,10 @@ class TaskInfo {
     (void)task_run_param;
     return SUCCESS;
   }
+  // ParseTaskRunParam仅读取task def与模型的只读信息时返回true，加载时允许与其他task并发解析
+  virtual bool IsParseTaskRunParamConcurrent() const {
+    return false;
+  }
 
   virtual Status GetTaskArgsRefreshInfos(std::vector<TaskArgsRefreshInfo> &infos) {
     (void)infos;
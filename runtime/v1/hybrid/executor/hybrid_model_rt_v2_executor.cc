@@ -1119,6 +1119,13 @@ Status HybridModelRtV2Executor::InitCtx() {
 }
 
 Status HybridModelRtV2Executor::LoadGuardFunc(const ge::ComputeGraphPtr &graph) {
+  const std::string *program_data = AttrUtils::GetStr(graph, kGuardCheckProgramData);
+  if ((program_data != nullptr) && !program_data->empty()) {
+    GELOGI("Start load guard program");
+    guard_check_info_.guard_program = GuardProgramCache::GetInstance().Load(*program_data);
+    GE_ASSERT_NOTNULL(guard_check_info_.guard_program);
+    return ge::SUCCESS;
+  }
   const std::string *buffer = AttrUtils::GetStr(graph, kGuardCheckSoDataResult);
   if ((buffer == nullptr) || buffer->empty()) {
     return ge::SUCCESS;
@@ -1143,11 +1150,17 @@ Status HybridModelRtV2Executor::LoadGuardFunc(const ge::ComputeGraphPtr &graph)
 }
 
 Status HybridModelRtV2Executor::CheckGuard() {
+  char_t reason[kMaxStringSize] = {'\0'};
+  if (guard_check_info_.guard_program != nullptr) {
+    GE_ASSERT_TRUE(guard_check_info_.guard_program->Check(rt_inputs_.data(), rt_inputs_.size(), reason,
+                                                          kMaxStringSize),
+                   reason);
+    return SUCCESS;
+  }
   if (guard_check_info_.guard_check_func == nullptr) {
     return ge::SUCCESS;
   }
   GELOGI("Start Check guard");
-  char_t reason[kMaxStringSize];
   GE_ASSERT_TRUE(guard_check_info_.guard_check_func(rt_inputs_.data(), rt_inputs_.size(), reason, kMaxStringSize),
                  reason);
   return SUCCESS;
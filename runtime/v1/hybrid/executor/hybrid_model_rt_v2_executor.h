@@ -26,6 +26,7 @@
 #include "hybrid/executor/runtime_v2/rt_v2_executor_factory.h"
 #include "runtime_v2/scalable_allocator_manager.h"
 #include "graph/optimize/symbolic/codegen/guard_codegen.h"
+#include "common/guard/guard_program.h"
 #include "mmpa/mmpa_api.h"
 
 namespace gert {
@@ -213,6 +214,8 @@ class HybridModelRtV2Executor : public HybridModelExecutor {
   };
 
   struct GuardCheckInfo {
+    // 进程内解释执行的guard program，存在时不再加载guard check so
+    GuardProgramPtr guard_program;
     // guard check 函数
     GuardCheckFunc guard_check_func{nullptr};
     // guard check so
@@ -33,6 +33,11 @@ class SingleOpImpl {
 
   void FreeAllocatedMem();
 
+  // task在下发时才使用stream，资源被其他stream复用时只需替换stream
+  void RebindStream(aclrtStream const stream) {
+    stream_ = stream;
+  }
+
  private:
   Status ValidateArgs(const std::vector<DataBuffer> &inputs, const std::vector<DataBuffer> &outputs);
 
@@ -72,6 +77,16 @@ class DynamicSingleOpImpl {
 
   int64_t GetProfilingNodeIndex() const noexcept;
 
+  void RebindStream(const uintptr_t resource_id, aclrtStream const stream) {
+    resource_id_ = resource_id;
+    stream_ = stream;
+  }
+
+  // hybrid执行器构建时绑定了stream，不能被其他stream复用
+  bool IsStreamBound() const {
+    return hybrid_model_executor_ != nullptr;
+  }
+
  private:
   friend class SingleOpModel;
 
@@ -44,7 +44,11 @@ Status SingleOpManager::GetOpFromModel(const std::string &model_name, const Mode
     return SUCCESS;
   }
 
-  return res->BuildOperator(model_data, single_op, model_id);
+  const Status ret = res->BuildOperator(model_data, single_op, model_id);
+  if (ret == SUCCESS) {
+    IncreaseBuildCount();
+  }
+  return ret;
 }
 
 Status SingleOpManager::ReleaseResource(const void *const stream) {
@@ -57,7 +61,9 @@ Status SingleOpManager::ReleaseResource(const void *const stream) {
     hybrid::NpuMemoryAllocator::FreeCachedMem();
     return SUCCESS;
   }
+  auto res = std::move(it->second);
   (void)stream_resources_.erase(it);
+  RecycleResource(std::move(res));
   MemManager::Instance().CachingInstance(RT_MEMORY_HBM).TryFreeBlocks();
   hybrid::NpuMemoryAllocator::FreeCachedMem();
   return SUCCESS;
@@ -68,15 +74,12 @@ StreamResource *SingleOpManager::GetResource(const uintptr_t resource_id, aclrtS
   const auto it = stream_resources_.find(resource_id);
   StreamResource *res = nullptr;
   if (it == stream_resources_.end()) {
-    auto guarded_res = MakeUnique<StreamResource>(resource_id);
+    auto guarded_res = AcquirePooledResource(resource_id, stream);
+    if (guarded_res == nullptr) {
+      guarded_res = CreateResource(resource_id, stream);
+    }
     if (guarded_res != nullptr) {
-      if (guarded_res->Init() != SUCCESS) {
-        GELOGE(FAILED, "[Malloc][Memory]Failed to malloc device buffer.");
-        return nullptr;
-      }
       res = guarded_res.get();
-      res->SetStream(stream);
-      res->SetAllocator(res->GetInternalAllocator());
       (void)stream_resources_.emplace(resource_id, std::move(guarded_res));
     }
   } else {
@@ -85,6 +88,125 @@ StreamResource *SingleOpManager::GetResource(const uintptr_t resource_id, aclrtS
   return res;
 }
 
+std::unique_ptr<StreamResource> SingleOpManager::CreateResource(const uintptr_t resource_id,
+                                                                aclrtStream const stream) {
+  auto res = MakeUnique<StreamResource>(resource_id);
+  if (res != nullptr) {
+    if (res->Init() != SUCCESS) {
+      GELOGE(FAILED, "[Malloc][Memory]Failed to malloc device buffer.");
+      return nullptr;
+    }
+    res->SetStream(stream);
+    res->SetAllocator(res->GetInternalAllocator());
+  }
+  return res;
+}
+
+std::unique_ptr<StreamResource> SingleOpManager::AcquirePooledResource(const uintptr_t resource_id,
+                                                                       aclrtStream const stream) {
+  if (idle_resources_.empty()) {
+    return nullptr;
+  }
+  PoolKey pool_key;
+  if (GetPoolKey(pool_key) != SUCCESS) {
+    return nullptr;
+  }
+  const auto it = idle_resources_.find(pool_key);
+  if ((it == idle_resources_.end()) || it->second.empty()) {
+    return nullptr;
+  }
+  auto res = std::move(it->second.back());
+  it->second.pop_back();
+  res->Rebind(resource_id, stream);
+  const size_t op_num = res->GetOperatorNum();
+  pool_stats_.op_reuse_count += op_num;
+  ++pool_stats_.resource_reuse_count;
+  GELOGI("Reuse pooled stream resource for resource id 0x%" PRIx64 ", op num = %zu, idle num = %zu",
+         static_cast<uint64_t>(resource_id), op_num, it->second.size());
+  return res;
+}
+
+void SingleOpManager::RecycleResource(std::unique_ptr<StreamResource> res) {
+  if ((max_pool_size_ == 0U) || (res == nullptr)) {
+    return;
+  }
+  PoolKey pool_key;
+  if ((!res->IsReusable()) || (GetPoolKey(pool_key) != SUCCESS)) {
+    ++pool_stats_.resource_drop_count;
+    return;
+  }
+  auto &idle_resources = idle_resources_[pool_key];
+  if (idle_resources.size() >= max_pool_size_) {
+    GELOGI("Resource pool of device %d context 0x%" PRIx64 " is full, size = %zu", pool_key.first,
+           static_cast<uint64_t>(pool_key.second), idle_resources.size());
+    ++pool_stats_.resource_drop_count;
+    return;
+  }
+  if (res->PrepareForReuse() != SUCCESS) {
+    GELOGW("Failed to prepare stream resource for reuse, release it.");
+    ++pool_stats_.resource_drop_count;
+    return;
+  }
+  idle_resources.emplace_back(std::move(res));
+  ++pool_stats_.resource_recycle_count;
+}
+
+void SingleOpManager::SetResourcePoolSize(const size_t max_pool_size) {
+  const std::lock_guard<std::recursive_mutex> lk(mutex_);
+  GELOGI("Set single op resource pool size from %zu to %zu", max_pool_size_, max_pool_size);
+  max_pool_size_ = max_pool_size;
+  for (auto it = idle_resources_.begin(); it != idle_resources_.end();) {
+    if (it->second.size() > max_pool_size_) {
+      pool_stats_.resource_drop_count += it->second.size() - max_pool_size_;
+      it->second.resize(max_pool_size_);
+    }
+    if (it->second.empty()) {
+      it = idle_resources_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+Status SingleOpManager::PrewarmResource(aclrtStream const stream,
+                                        const std::vector<SingleOpPrewarmInfo> &prewarm_infos) {
+  {
+    const std::lock_guard<std::recursive_mutex> lk(mutex_);
+    GE_ASSERT_TRUE(max_pool_size_ > 0U, "[Check][Param]Single op resource pool is not enabled.");
+  }
+  RegisterTilingFunc();
+  uintptr_t resource_id = 0U;
+  GE_CHK_STATUS_RET(GetResourceId(stream, resource_id));
+  auto res = CreateResource(resource_id, stream);
+  GE_ASSERT_NOTNULL(res);
+  for (const auto &prewarm_info : prewarm_infos) {
+    if (prewarm_info.is_dynamic) {
+      DynamicSingleOp *single_op = nullptr;
+      GE_CHK_STATUS_RET(res->BuildDynamicOperator(prewarm_info.model_data, &single_op, prewarm_info.model_id),
+                        "[Build][DynamicOp]Prewarm failed, model id = %" PRIu64, prewarm_info.model_id);
+    } else {
+      SingleOp *single_op = nullptr;
+      GE_CHK_STATUS_RET(res->BuildOperator(prewarm_info.model_data, &single_op, prewarm_info.model_id),
+                        "[Build][SingleOp]Prewarm failed, model id = %" PRIu64, prewarm_info.model_id);
+    }
+    IncreaseBuildCount();
+  }
+  const std::lock_guard<std::recursive_mutex> lk(mutex_);
+  RecycleResource(std::move(res));
+  GELOGI("Prewarm single op resource on stream %p finished, op num = %zu", stream, prewarm_infos.size());
+  return SUCCESS;
+}
+
+SingleOpResourcePoolStats SingleOpManager::GetResourcePoolStats() {
+  const std::lock_guard<std::recursive_mutex> lk(mutex_);
+  return pool_stats_;
+}
+
+void SingleOpManager::IncreaseBuildCount() {
+  const std::lock_guard<std::recursive_mutex> lk(mutex_);
+  ++pool_stats_.op_build_count;
+}
+
 Status SingleOpManager::GetDynamicOpFromModel(const std::string &model_name, const ModelData &model_data,
                                               void *const stream, DynamicSingleOp **const single_op,
                                               const uint64_t model_id) {
@@ -108,7 +230,11 @@ Status SingleOpManager::GetDynamicOpFromModel(const std::string &model_name, con
     return SUCCESS;
   }
 
-  return res->BuildDynamicOperator(model_data, single_op, model_id);
+  const Status ret = res->BuildDynamicOperator(model_data, single_op, model_id);
+  if (ret == SUCCESS) {
+    IncreaseBuildCount();
+  }
+  return ret;
 }
 
 Status SingleOpManager::DeleteSingleOp(const uint64_t op_id) {
@@ -117,6 +243,12 @@ Status SingleOpManager::DeleteSingleOp(const uint64_t op_id) {
     GE_CHECK_NOTNULL(it.second);
     GE_CHK_STATUS_RET(it.second->DeleteOperator(op_id));
   }
+  for (const auto &it : idle_resources_) {
+    for (const auto &res : it.second) {
+      GE_CHECK_NOTNULL(res);
+      GE_CHK_STATUS_RET(res->DeleteOperator(op_id));
+    }
+  }
   return SUCCESS;
 }
 
@@ -126,6 +258,12 @@ Status SingleOpManager::DeleteDynamicSingleOp(const uint64_t op_id) {
     GE_CHECK_NOTNULL(it.second);
     GE_CHK_STATUS_RET(it.second->DeleteDynamicOperator(op_id));
   }
+  for (const auto &it : idle_resources_) {
+    for (const auto &res : it.second) {
+      GE_CHECK_NOTNULL(res);
+      GE_CHK_STATUS_RET(res->DeleteDynamicOperator(op_id));
+    }
+  }
   return SUCCESS;
 }
 
@@ -155,6 +293,17 @@ Status SingleOpManager::GetResourceId(aclrtStream const stream, uintptr_t &resou
   return SUCCESS;
 }
 
+// 资源中算子task使用的overflow地址取自创建时的context，复用时不会刷新，因此按device及context索引，
+// 同一context下不同线程创建的stream可以复用
+Status SingleOpManager::GetPoolKey(PoolKey &pool_key) {
+  int32_t device_id = -1;
+  GE_CHK_ACL_RET(aclrtGetDevice(&device_id));
+  aclrtContext context = nullptr;
+  GE_CHK_ACL_RET(aclrtGetCurrentContext(&context));
+  pool_key = std::make_pair(device_id, static_cast<uintptr_t>(PtrToValue(context)));
+  return SUCCESS;
+}
+
 Status SingleOpManager::SetAllocator(aclrtStream const stream, Allocator *const allocator) {
   uintptr_t resource_id = 0U;
   GE_ASSERT_SUCCESS(GetResourceId(stream, resource_id));
@@ -11,14 +11,31 @@
 #ifndef GE_SINGLE_OP_SINGLE_OP_MANAGER_H_
 #define GE_SINGLE_OP_SINGLE_OP_MANAGER_H_
 
+#include <map>
 #include <mutex>
 #include <unordered_map>
 #include <string>
+#include <utility>
+#include <vector>
 #include "common/plugin/op_tiling_manager.h"
 #include "single_op/single_op_model.h"
 #include "single_op/stream_resource.h"
 
 namespace ge {
+struct SingleOpPrewarmInfo {
+  uint64_t model_id = 0U;
+  ModelData model_data;
+  bool is_dynamic = false;
+};
+
+struct SingleOpResourcePoolStats {
+  uint64_t op_build_count = 0U;          // 新构建的单算子数
+  uint64_t op_reuse_count = 0U;          // 随资源复用、无需重新构建的单算子数
+  uint64_t resource_reuse_count = 0U;    // 从资源池取出并绑定到新stream的次数
+  uint64_t resource_recycle_count = 0U;  // stream释放后放入资源池的次数
+  uint64_t resource_drop_count = 0U;     // 资源池已满或不可复用而释放的资源数
+};
+
 class SingleOpManager {
  public:
   ~SingleOpManager() = default;
@@ -46,12 +63,31 @@ class SingleOpManager {
 
   Status SetAllocator(aclrtStream const stream, Allocator *const allocator);
 
+  // 开启资源池后，stream释放时其资源(已构建的单算子及内部allocator内存)按device及context缓存，
+  // 供同一context上新建的stream直接复用。max_pool_size为每个context缓存的资源数上限，0表示关闭
+  void SetResourcePoolSize(const size_t max_pool_size);
+
+  // 在stream上预先构建指定的单算子，完成后放入资源池
+  Status PrewarmResource(aclrtStream const stream, const std::vector<SingleOpPrewarmInfo> &prewarm_infos);
+
+  SingleOpResourcePoolStats GetResourcePoolStats();
+
  private:
+  // (device id, context)
+  using PoolKey = std::pair<int32_t, uintptr_t>;
   static Status GetResourceId(aclrtStream const stream, uintptr_t &resource_id);
+  static Status GetPoolKey(PoolKey &pool_key);
+  static std::unique_ptr<StreamResource> CreateResource(const uintptr_t resource_id, aclrtStream const stream);
+  std::unique_ptr<StreamResource> AcquirePooledResource(const uintptr_t resource_id, aclrtStream const stream);
+  void RecycleResource(std::unique_ptr<StreamResource> res);
+  void IncreaseBuildCount();
   std::recursive_mutex mutex_;
   bool tiling_func_registered_ = false;
   std::unordered_map<uintptr_t, std::unique_ptr<StreamResource>> stream_resources_;
   OpTilingManager op_tiling_manager_;
+  size_t max_pool_size_ = 0U;
+  std::map<PoolKey, std::vector<std::unique_ptr<StreamResource>>> idle_resources_;
+  SingleOpResourcePoolStats pool_stats_;
 };
 }  // namespace ge
 
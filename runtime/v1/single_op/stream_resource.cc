@@ -121,9 +121,11 @@ Status StreamResource::DeleteOperator(const uint64_t key) {
   const std::lock_guard<std::mutex> lk(mu_);
   const auto it = op_map_.find(key);
   if (it != op_map_.end()) {
-    // need to stream sync before erase
+    // need to stream sync before erase, resource in pool has been synchronized when recycled
     GELOGI("static op %" PRIu64 " need to be deleted, start to sync stream %p", key, stream_);
-    GE_CHK_ACL_RET(aclrtSynchronizeStream(stream_));
+    if (!pooled_) {
+      GE_CHK_ACL_RET(aclrtSynchronizeStream(stream_));
+    }
     (void)op_map_.erase(it);
     GELOGI("static op %" PRIu64 " delete success", key);
   }
@@ -134,9 +136,11 @@ Status StreamResource::DeleteDynamicOperator(const uint64_t key) {
   const std::lock_guard<std::mutex> lk(mu_);
   const auto it = dynamic_op_map_.find(key);
   if (it != dynamic_op_map_.end()) {
-    // need to stream sync before erase
+    // need to stream sync before erase, resource in pool has been synchronized when recycled
     GELOGI("dynamic op %" PRIu64 " need to be deleted, start to sync stream %p", key, stream_);
-    GE_CHK_ACL_RET(aclrtSynchronizeStream(stream_));
+    if (!pooled_) {
+      GE_CHK_ACL_RET(aclrtSynchronizeStream(stream_));
+    }
     (void)dynamic_op_map_.erase(it);
     GELOGI("dynamic op %" PRIu64 " delete success", key);
   }
@@ -152,6 +156,53 @@ DynamicSingleOp *StreamResource::GetDynamicOperator(const uint64_t key) {
   return it->second.get();
 }
 
+Status StreamResource::PrepareForReuse() {
+  const std::lock_guard<std::mutex> lk(mu_);
+  GE_CHK_ACL_RET(aclrtSynchronizeStream(stream_));
+  for (auto it = dynamic_op_map_.begin(); it != dynamic_op_map_.end();) {
+    if ((it->second == nullptr) || (it->second->impl_ == nullptr) || it->second->impl_->IsStreamBound()) {
+      GELOGI("dynamic op %" PRIu64 " is bound to stream %p, can not be reused", it->first, stream_);
+      it = dynamic_op_map_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (callback_manager_ != nullptr) {
+    (void)callback_manager_->Destroy();
+    callback_manager_.reset();
+  }
+  stream_ = nullptr;
+  internal_allocator_.SetStream(nullptr);
+  pooled_ = true;
+  return SUCCESS;
+}
+
+void StreamResource::Rebind(const uintptr_t resource_id, const aclrtStream stream) {
+  const std::lock_guard<std::mutex> lk(mu_);
+  GELOGI("Rebind stream resource from 0x%" PRIx64 " to 0x%" PRIx64 ", op num = %zu, dynamic op num = %zu",
+         static_cast<uint64_t>(resource_id_), static_cast<uint64_t>(resource_id), op_map_.size(),
+         dynamic_op_map_.size());
+  resource_id_ = resource_id;
+  stream_ = stream;
+  internal_allocator_.SetStream(stream);
+  pooled_ = false;
+  for (const auto &it : op_map_) {
+    if ((it.second != nullptr) && (it.second->impl_ != nullptr)) {
+      it.second->impl_->RebindStream(stream);
+    }
+  }
+  for (const auto &it : dynamic_op_map_) {
+    if ((it.second != nullptr) && (it.second->impl_ != nullptr)) {
+      it.second->impl_->RebindStream(resource_id, stream);
+    }
+  }
+}
+
+size_t StreamResource::GetOperatorNum() {
+  const std::lock_guard<std::mutex> lk(mu_);
+  return op_map_.size() + dynamic_op_map_.size();
+}
+
 aclrtStream StreamResource::GetStream() const {
   return stream_;
 }
@@ -38,6 +38,10 @@ class InternalAllocator : public Allocator {
   void Free(MemBlock *block) override;
   ~InternalAllocator() override;
 
+  void SetStream(const aclrtStream stream) {
+    stream_ = stream;
+  }
+
  private:
   std::vector<std::unique_ptr<MemBlock>> memory_list_{};
   size_t max_memory_size_{0UL};
@@ -94,6 +98,18 @@ class StreamResource {
     return &internal_allocator_;
   }
 
+  // 使用内部allocator的资源才能在stream释放后被其他stream复用，外部allocator的内存由用户按stream管理
+  bool IsReusable() const {
+    return allocator_ == &internal_allocator_;
+  }
+
+  // 回收前同步stream并释放与stream绑定的资源，已构建的算子及内部allocator的内存保留
+  Status PrepareForReuse();
+
+  void Rebind(const uintptr_t resource_id, const aclrtStream stream);
+
+  size_t GetOperatorNum();
+
  private:
   uint8_t *DoMallocMemory(const std::string &purpose, const size_t size, ge::MemBlock *&block) const;
 
@@ -112,6 +128,7 @@ class StreamResource {
   InternalAllocator internal_allocator_{};
   ge::Allocator *allocator_{nullptr};
   void *overflow_addr_ = nullptr;
+  bool pooled_ = false;
 };
 }  // namespace ge
 
@@ -25,12 +25,12 @@ class GeHostProfiler : public BaseExecutorProfiler {
 
   void Record(const Node *node, ExecutorEvent event) const {
     if (event == kModelStart || event == kModelEnd) {
-      GetGlobalProf()->Record(profiling::kModel, profiling::kExecute, event, std::chrono::system_clock::now());
+      GetGlobalProf()->Record(profiling::kModel, profiling::kExecute, event, ProfilingClock::now());
       return;
     }
     const auto prof_extend_info = prof_extend_infos_[node->node_id];
     GetGlobalProf()->Record(prof_extend_info.node_name_idx, prof_extend_info.kernel_type_idx, event,
-                            std::chrono::system_clock::now());
+                            ProfilingClock::now());
   }
 
  private:
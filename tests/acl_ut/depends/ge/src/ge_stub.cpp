@@ -709,6 +709,10 @@ Status GeExecutor::ReleaseSingleOpResource(void *stream) {
   return SUCCESS;
 }
 
+void GeExecutor::SetSingleOpResourcePoolSize(const size_t pool_size) {
+  (void)pool_size;
+}
+
 Status GeExecutor::ReleaseResource() {
   return SUCCESS;
 }
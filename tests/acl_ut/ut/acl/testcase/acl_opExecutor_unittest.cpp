@@ -410,7 +410,7 @@ TEST_F(OpExecutorTest, TestCaseaclopExecWithHandle) {
 
 TEST_F(OpExecutorTest, TestCaseaclopUpdateParamsAging) {
   ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.maxOpNum, UINT64_MAX);
-  acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.clear();
+  acl::OpKernelSelector::GetInstance().kernelDescMap_.Clear();
   acl::OpKernelSelector::GetInstance().kernelDescMap_.maxOpNum = 1;
   acl::OpKernelSelector::GetInstance().kernelDescMap_.cnt = 0;
 
@@ -420,10 +420,10 @@ TEST_F(OpExecutorTest, TestCaseaclopUpdateParamsAging) {
       ACL_SUCCESS);
   ASSERT_EQ(aclopUpdateParams("BatchNorm_Test3", 1, input_desc_, 1, output_desc_, nullptr), ACL_SUCCESS);
 
-  ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.size(), 1);
-  uint64_t timestamp_1 = acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.begin()->second[0]->timestamp;
+  ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.GetStats().entryCount, 1);
+  uint64_t timestamp_1 = acl::OpKernelSelector::GetInstance().kernelDescMap_.lruList_.back().entry->timestamp;
   ASSERT_EQ(aclopUpdateParams("BatchNorm_Test3", 1, input_desc_, 1, output_desc_, nullptr), ACL_SUCCESS);
-  uint64_t timestamp_2 = acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.begin()->second[0]->timestamp;
+  uint64_t timestamp_2 = acl::OpKernelSelector::GetInstance().kernelDescMap_.lruList_.back().entry->timestamp;
   ASSERT_TRUE(timestamp_2 > timestamp_1);
   aclopUnregisterCompileFunc("BatchNorm_Test3");
 
@@ -432,7 +432,7 @@ TEST_F(OpExecutorTest, TestCaseaclopUpdateParamsAging) {
       aclopCreateKernel("BatchNorm_Test2", "kernel1", "kernel1", (void *)0x1000, 1024, ACL_ENGINE_AICORE, nullptr),
       ACL_SUCCESS);
   ASSERT_EQ(aclopUpdateParams("BatchNorm_Test2", 1, input_desc_, 1, output_desc_, nullptr), ACL_SUCCESS);
-  ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.size(), 1);
+  ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.GetStats().entryCount, 1);
   aclopUnregisterCompileFunc("BatchNorm_Test2");
   acl::OpKernelSelector::GetInstance().kernelDescMap_.maxOpNum = UINT64_MAX;
 }
@@ -440,7 +440,7 @@ TEST_F(OpExecutorTest, TestCaseaclopUpdateParamsAging) {
 TEST_F(OpExecutorTest, TestCaseaclopSetMaxOpQueueNumAging) {
   ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.maxOpNum, UINT64_MAX);
   ASSERT_EQ(acl::AclOpResourceManager::GetInstance().opModels_.maxOpNum, DEFAULT_MAX_OPQUEUE_NUM);
-  acl::OpKernelSelector::GetInstance().kernelDescMap_.hashMap_.clear();
+  acl::OpKernelSelector::GetInstance().kernelDescMap_.Clear();
   ASSERT_EQ(aclopSetMaxOpQueueNum(0), ACL_ERROR_INVALID_PARAM);
   ASSERT_EQ(aclopSetMaxOpQueueNum(1), ACL_SUCCESS);
   ASSERT_EQ(acl::OpKernelSelector::GetInstance().kernelDescMap_.maxOpNum, 1UL);
@@ -40,6 +40,7 @@
 #include "utils/acl_file_utils.h"
 #include "utils/acl_attr_utils.h"
 #include "single_op/op_model_parser.h"
+#include "single_op/op_model_match_cache.h"
 #include "single_op/compile/op_compile_service.h"
 #include "utils/acl_hash_utils.h"
 #include "single_op/compile/local_compiler.h"
@@ -412,11 +413,11 @@ TEST(UTEST_ACL_Resource_Manager, MatchModelDynamicHashTest) {
 
   auto modelDefPtr = shared_ptr<OpModelDef>(new (std::nothrow) OpModelDef(std::move(modelDef_2)));
   size_t k = 17836075261947842321ULL;
-  instance.opModels_.hashMap_[k].push_back(std::move(modelDefPtr));
+  instance.opModels_.GetStripe(k).hashMap[k].push_back(std::move(modelDefPtr));
 
   EXPECT_NE(instance.MatchOpModel(aclOp, opModel, isDynamic), ACL_SUCCESS);
 
-  instance.opModels_.hashMap_[k].clear();
+  instance.opModels_.GetStripe(k).hashMap[k].clear();
   aclDestroyTensorDesc(inputDesc[0]);
   aclDestroyTensorDesc(inputDesc[1]);
   aclDestroyTensorDesc(outputDesc[0]);
@@ -466,7 +467,8 @@ TEST(UTEST_ACL_Resource_Manager, MatchModelHashTest) {
   modelDef.opAttr.SetAttr<string>("testAttr", "attrValue");
 
   auto modelDefPtr = shared_ptr<OpModelDef>(new (std::nothrow) OpModelDef(std::move(modelDef_2)));
-  instance.opModels_.hashMap_[6687538955415257199].push_back(std::move(modelDefPtr));
+  const size_t k = 6687538955415257199ULL;
+  instance.opModels_.GetStripe(k).hashMap[k].push_back(std::move(modelDefPtr));
 
   EXPECT_NE(instance.MatchOpModel(aclOp, opModel, isDynamic), ACL_SUCCESS);
 
@@ -475,7 +477,7 @@ TEST(UTEST_ACL_Resource_Manager, MatchModelHashTest) {
   aclDestroyTensorDesc(outputDesc[0]);
   aclopDestroyAttr(opAttr);
 
-  instance.opModels_.hashMap_[6687538955415257199].clear();
+  instance.opModels_.GetStripe(k).hashMap[k].clear();
 }
 
 TEST(UTEST_ACL_Resource_Manager, MatchModelTest) {
@@ -630,6 +632,14 @@ TEST(UTEST_ACL_Resource_Manager, HandleMaxOpQueueConfigTest) {
   EXPECT_NE(ret, ACL_SUCCESS);
 }
 
+TEST(UTEST_ACL_Resource_Manager, HandleOpResourcePoolConfigTest) {
+  AclOpResourceManager modelManager;
+  EXPECT_EQ(modelManager.HandleOpResourcePoolConfig("{\"max_opqueue_num\" : \"1\"}"), ACL_SUCCESS);
+  EXPECT_EQ(modelManager.HandleOpResourcePoolConfig("{\"op_resource_pool_size\" : \"-1\"}"), ACL_ERROR_INVALID_PARAM);
+  EXPECT_EQ(modelManager.HandleOpResourcePoolConfig("{\"op_resource_pool_size\" : \"2a\"}"), ACL_ERROR_INVALID_PARAM);
+  EXPECT_EQ(modelManager.HandleOpResourcePoolConfig("{\"op_resource_pool_size\" : 4}"), ACL_SUCCESS);
+}
+
 TEST(UTEST_ACL_Resource_Manager, LoadModelFromMemTest) {
   size_t modelSize = 20;
   auto *aclModelData = new (std::nothrow) char[modelSize];
@@ -1115,6 +1125,69 @@ TEST(UTEST_ACL_Resource_Manager, RegisterModelTest_SameDynamicCache) {
   EXPECT_EQ(acquireModelDef->opModelId, 9999);
 }
 
+TEST(UTEST_ACL_Resource_Manager, AclOpMap_LruAgingAndStats) {
+  AclOpMap<std::shared_ptr<OpModelDef>> opMap;
+  opMap.SetMaxOpNum(2U);
+  std::vector<AclOp> aclOps(3U);
+  std::vector<std::shared_ptr<OpModelDef>> modelDefs;
+  for (size_t i = 0U; i < aclOps.size(); ++i) {
+    aclOps[i].opType = "lru_op_" + std::to_string(i);
+    OpModelDef modelConfig;
+    modelConfig.opModelId = i;
+    modelConfig.opType = aclOps[i].opType;
+    modelConfig.timestamp = attr_utils::GetCurrentTimestamp();
+    modelDefs.emplace_back(std::make_shared<OpModelDef>(modelConfig));
+  }
+  std::shared_ptr<OpModelDef> agingModelDef = nullptr;
+  bool isRegistered = false;
+  EXPECT_EQ(opMap.Insert(aclOps[0U], modelDefs[0U], agingModelDef, isRegistered), ACL_SUCCESS);
+  EXPECT_EQ(opMap.Insert(aclOps[1U], modelDefs[1U], agingModelDef, isRegistered), ACL_SUCCESS);
+  EXPECT_EQ(agingModelDef, nullptr);
+
+  // 访问只刷新时间戳，老化时lru_op_0被移到LRU尾部，淘汰最久未使用的lru_op_1
+  std::shared_ptr<OpModelDef> acquireModelDef = nullptr;
+  EXPECT_EQ(opMap.Get(aclOps[0U], acquireModelDef, true), ACL_SUCCESS);
+  EXPECT_EQ(acquireModelDef, modelDefs[0U]);
+  EXPECT_EQ(opMap.lruList_.front().entry, modelDefs[0U]);
+  EXPECT_EQ(opMap.Insert(aclOps[2U], modelDefs[2U], agingModelDef, isRegistered), ACL_SUCCESS);
+  EXPECT_EQ(agingModelDef, modelDefs[1U]);
+  EXPECT_NE(opMap.Get(aclOps[1U], acquireModelDef, false), ACL_SUCCESS);
+  EXPECT_EQ(opMap.lruList_.front().entry, modelDefs[2U]);
+  EXPECT_EQ(opMap.lruList_.back().entry, modelDefs[0U]);
+
+  // 去重命中即将被淘汰的项时刷新其时间戳，该项不再被淘汰，去重结果保持有效
+  opMap.SetMaxOpNum(1U);
+  EXPECT_EQ(opMap.Insert(aclOps[2U], modelDefs[2U], agingModelDef, isRegistered), ACL_SUCCESS);
+  EXPECT_TRUE(isRegistered);
+  agingModelDef = nullptr;
+  opMap.Aging(agingModelDef);
+  EXPECT_EQ(agingModelDef, modelDefs[0U]);
+  EXPECT_EQ(opMap.Get(aclOps[2U], acquireModelDef, false), ACL_SUCCESS);
+  EXPECT_EQ(acquireModelDef, modelDefs[2U]);
+  opMap.SetMaxOpNum(2U);
+  EXPECT_EQ(opMap.Insert(aclOps[1U], modelDefs[1U], agingModelDef, isRegistered), ACL_SUCCESS);
+
+  // 静态注册的模型不参与老化
+  AclOp staticOp;
+  staticOp.opType = "lru_static_op";
+  OpModelDef staticConfig;
+  staticConfig.opType = staticOp.opType;
+  agingModelDef = nullptr;
+  EXPECT_EQ(opMap.Insert(staticOp, std::make_shared<OpModelDef>(staticConfig), agingModelDef, isRegistered),
+            ACL_SUCCESS);
+  EXPECT_EQ(agingModelDef, nullptr);
+  EXPECT_EQ(opMap.lruList_.size(), 2U);
+
+  const AclOpMapStats stats = opMap.GetStats();
+  EXPECT_EQ(stats.hitCount, 2U);
+  EXPECT_EQ(stats.missCount, 1U);
+  EXPECT_EQ(stats.evictionCount, 2U);
+  EXPECT_EQ(stats.entryCount, 3U);
+  opMap.Clear();
+  EXPECT_EQ(opMap.GetStats().entryCount, 0U);
+  EXPECT_TRUE(opMap.lruList_.empty());
+}
+
 TEST(UTEST_ACL_Resource_Manager, GetAllocators_Fail_HostAllocatorIsNull) {
   auto &instance = AclResourceManager::GetInstance();
   EXPECT_CALL(MockFunctionTest::aclStubInstance(), Create(_))
@@ -1148,3 +1221,99 @@ TEST(UTEST_ACL_Resource_Manager, GetKeyByStreamOrDefaultStreamTest) {
   retStream = instance.GetKeyByStreamOrDefaultStream(stream);
   EXPECT_NE(retStream, nullptr);
 }
+
+namespace {
+constexpr uint64_t kMatchCacheOpModelId = 0x5A5A0001U;
+
+void RegisterMatchCacheOpModel(AclOpResourceManager &instance, const std::string &opType, const uint64_t opModelId) {
+  OpModelDef modelDef;
+  modelDef.opType = opType;
+  modelDef.opModelId = opModelId;
+  modelDef.modelPath = "match_cache_model";
+  int64_t shape[]{16, 16};
+  modelDef.inputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  modelDef.inputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  modelDef.outputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  modelDef.opAttr.SetAttr<string>("testAttr", "attrValue");
+
+  OpModel opModel;
+  char_t *data = new char_t[32];
+  opModel.data = std::shared_ptr<void>(data, [](const char_t *const p) { delete[] p; });
+  opModel.size = 32U;
+  opModel.name = opType;
+  EXPECT_EQ(instance.modelCache_.Add(opModelId, opModel), ACL_SUCCESS);
+  bool isDeduplicate = false;
+  EXPECT_EQ(instance.RegisterModel(std::move(modelDef), instance.opModels_, false, isDeduplicate), ACL_SUCCESS);
+}
+}  // namespace
+
+TEST(UTEST_ACL_Resource_Manager, MatchOpModel_InlineCacheHitAndInvalidate) {
+  auto &instance = AclOpResourceManager::GetInstance();
+  RegisterMatchCacheOpModel(instance, "MatchCacheOp", kMatchCacheOpModelId);
+
+  int64_t shape[]{16, 16};
+  const aclTensorDesc *inputDesc[2];
+  const aclTensorDesc *outputDesc[1];
+  inputDesc[0] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  inputDesc[1] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  outputDesc[0] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+  aclopAttr *opAttr = aclopCreateAttr();
+  aclopSetAttrString(opAttr, "testAttr", "attrValue");
+  AclOp aclOp;
+  aclOp.opType = "MatchCacheOp";
+  aclOp.numInputs = 2;
+  aclOp.numOutputs = 1;
+  aclOp.inputDesc = inputDesc;
+  aclOp.outputDesc = outputDesc;
+  aclOp.opAttr = opAttr;
+
+  OpModelMatchCache::Clear();
+  OpModel opModel;
+  bool isDynamic = true;
+  EXPECT_EQ(instance.MatchOpModel(aclOp, opModel, isDynamic), ACL_SUCCESS);
+  EXPECT_EQ(OpModelMatchCache::GetStats().missCount, 1U);
+  EXPECT_EQ(OpModelMatchCache::GetStats().hitCount, 0U);
+
+  OpModel cachedOpModel;
+  isDynamic = true;
+  EXPECT_EQ(instance.MatchOpModel(aclOp, cachedOpModel, isDynamic), ACL_SUCCESS);
+  EXPECT_EQ(OpModelMatchCache::GetStats().hitCount, 1U);
+  EXPECT_FALSE(isDynamic);
+  EXPECT_EQ(cachedOpModel.opModelId, kMatchCacheOpModelId);
+  EXPECT_EQ(cachedOpModel.name, opModel.name);
+  EXPECT_EQ(cachedOpModel.data, opModel.data);
+
+  // 属性值不同时不能命中
+  aclopSetAttrString(opAttr, "testAttr", "otherValue");
+  EXPECT_EQ(instance.MatchOpModel(aclOp, cachedOpModel, isDynamic), ACL_ERROR_OP_NOT_FOUND);
+  EXPECT_EQ(OpModelMatchCache::GetStats().hitCount, 1U);
+  aclopSetAttrString(opAttr, "testAttr", "attrValue");
+
+  // 模型数据卸载后缓存失效，需重新匹配得到最新结果
+  EXPECT_EQ(instance.UnloadModelData(kMatchCacheOpModelId), ACL_SUCCESS);
+  const auto missCount = OpModelMatchCache::GetStats().missCount;
+  EXPECT_EQ(instance.MatchOpModel(aclOp, cachedOpModel, isDynamic), ACL_SUCCESS);
+  EXPECT_EQ(OpModelMatchCache::GetStats().missCount, missCount + 1U);
+  EXPECT_EQ(cachedOpModel.data, nullptr);
+  EXPECT_EQ(instance.MatchOpModel(aclOp, cachedOpModel, isDynamic), ACL_SUCCESS);
+  EXPECT_EQ(OpModelMatchCache::GetStats().hitCount, 2U);
+
+  // host内存输入的匹配结果依赖数据，不走缓存
+  const_cast<aclTensorDesc *>(inputDesc[1])->memtype = ACL_MEMTYPE_HOST;
+  EXPECT_FALSE(OpModelMatchCache::IsCacheable(aclOp));
+  const_cast<aclTensorDesc *>(inputDesc[1])->memtype = ACL_MEMTYPE_DEVICE;
+  aclOp.isCompile = true;
+  EXPECT_FALSE(OpModelMatchCache::IsCacheable(aclOp));
+  aclOp.isCompile = false;
+
+  OpModelMatchCache::SetEnable(false);
+  EXPECT_EQ(instance.MatchOpModel(aclOp, cachedOpModel, isDynamic), ACL_SUCCESS);
+  EXPECT_EQ(OpModelMatchCache::GetStats().hitCount, 2U);
+  OpModelMatchCache::SetEnable(true);
+
+  OpModelMatchCache::Clear();
+  aclopDestroyAttr(opAttr);
+  aclDestroyTensorDesc(inputDesc[0]);
+  aclDestroyTensorDesc(inputDesc[1]);
+  aclDestroyTensorDesc(outputDesc[0]);
+}
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <memory>
+#include <string>
+#include <benchmark/benchmark.h>
+#include "acl/acl.h"
+#include "single_op/acl_op_resource_manager.h"
+#include "single_op/op_model_match_cache.h"
+
+namespace acl {
+namespace {
+constexpr uint64_t kOpModelId = 0x5A5A0002U;
+constexpr const char_t *kOpType = "MatchCacheBenchOp";
+
+class MatchOpModelFixture {
+ public:
+  MatchOpModelFixture() {
+    auto &instance = AclOpResourceManager::GetInstance();
+    OpModelDef modelDef;
+    modelDef.opType = kOpType;
+    modelDef.opModelId = kOpModelId;
+    modelDef.modelPath = "match_cache_bench_model";
+    int64_t shape[]{16, 16};
+    modelDef.inputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    modelDef.inputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    modelDef.outputDescArr.emplace_back(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    modelDef.opAttr.SetAttr<std::string>("testAttr", "attrValue");
+    OpModel opModel;
+    opModel.data = std::shared_ptr<void>(new char_t[32], [](const char_t *const p) { delete[] p; });
+    opModel.size = 32U;
+    opModel.name = kOpType;
+    (void)instance.modelCache_.Add(kOpModelId, opModel);
+    bool isDeduplicate = false;
+    (void)instance.RegisterModel(std::move(modelDef), instance.opModels_, false, isDeduplicate);
+
+    inputDesc_[0] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    inputDesc_[1] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    outputDesc_[0] = aclCreateTensorDesc(ACL_FLOAT16, 2, shape, ACL_FORMAT_ND);
+    opAttr_ = aclopCreateAttr();
+    (void)aclopSetAttrString(opAttr_, "testAttr", "attrValue");
+    aclOp_.opType = kOpType;
+    aclOp_.numInputs = 2;
+    aclOp_.numOutputs = 1;
+    aclOp_.inputDesc = inputDesc_;
+    aclOp_.outputDesc = outputDesc_;
+    aclOp_.opAttr = opAttr_;
+  }
+
+  ~MatchOpModelFixture() {
+    aclopDestroyAttr(opAttr_);
+    aclDestroyTensorDesc(inputDesc_[0]);
+    aclDestroyTensorDesc(inputDesc_[1]);
+    aclDestroyTensorDesc(outputDesc_[0]);
+  }
+
+  const AclOp &GetOp() const {
+    return aclOp_;
+  }
+
+ private:
+  const aclTensorDesc *inputDesc_[2]{};
+  const aclTensorDesc *outputDesc_[1]{};
+  aclopAttr *opAttr_{nullptr};
+  AclOp aclOp_;
+};
+
+// 单算子下发时op model匹配的开销，range(0)为1时启用线程内匹配缓存
+void MatchOpModel(benchmark::State &state) {
+  static MatchOpModelFixture fixture;
+  auto &instance = AclOpResourceManager::GetInstance();
+  OpModelMatchCache::Clear();
+  OpModelMatchCache::SetEnable(state.range(0) != 0);
+  for (auto _ : state) {
+    OpModel opModel;
+    bool isDynamic = false;
+    if (instance.MatchOpModel(fixture.GetOp(), opModel, isDynamic) != ACL_SUCCESS) {
+      state.SkipWithError("Match op model failed.");
+      break;
+    }
+    benchmark::DoNotOptimize(opModel.data.get());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  OpModelMatchCache::SetEnable(true);
+  OpModelMatchCache::Clear();
+}
+}  // namespace
+
+BENCHMARK(MatchOpModel)->Arg(0)->Arg(1)->Unit(benchmark::kNanosecond);
+}  // namespace acl
+
+BENCHMARK_MAIN();
@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "common/util/mem_utils.h"
+#include "graph/compute_graph.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/utils/graph_utils.h"
+#include "compiler/graph/passes/standard_optimize/cse_node_table.h"
+
+namespace ge {
+namespace {
+constexpr int64_t kHiddenSize = 4096;
+constexpr size_t kAttrNum = 6U;
+const std::vector<std::string> kBranchNames = {"q", "k", "v"};
+
+// 与原实现一致：拼接节点名、shape字符串和全部属性串作为key
+std::string GetCseKey(const NodePtr &node) {
+  std::stringstream ss;
+  ss << node->GetType() << "-data-inputs-";
+  for (auto &in_anchor : node->GetAllInDataAnchors()) {
+    auto src_anchor = in_anchor->GetPeerOutAnchor();
+    if (src_anchor == nullptr) {
+      ss << in_anchor->GetIdx() << "-null-";
+    } else {
+      const auto &input_desc = node->GetOpDesc()->GetInputDescPtr(in_anchor->GetIdx());
+      ss << in_anchor->GetIdx() << "-" << src_anchor->GetOwnerNode()->GetName() << "-" << src_anchor->GetIdx() << "-"
+         << input_desc->GetShape().ToString() << "-" << input_desc->GetOriginShape().ToString() << "-"
+         << input_desc->GetFormat() << "-" << input_desc->GetOriginFormat() << "-";
+    }
+  }
+  ss << "control-inputs-";
+  std::set<std::string> control_in_node_names;
+  for (auto &src_node : node->GetInControlNodes()) {
+    control_in_node_names.insert(src_node->GetName());
+  }
+  for (auto &name : control_in_node_names) {
+    ss << name << "-";
+  }
+  ss << "attrs-" << AttrUtils::GetAllAttrsStr(node->GetOpDesc());
+  return ss.str();
+}
+
+NodePtr AddNode(const ComputeGraphPtr &graph, const std::string &name, const std::string &type,
+                const std::vector<NodePtr> &inputs, const int64_t attr_value) {
+  const auto op_desc = MakeShared<OpDesc>(name, type);
+  const GeTensorDesc tensor_desc(GeShape({-1, 128, kHiddenSize}), FORMAT_ND, DT_FLOAT16);
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    (void)op_desc->AddInputDesc(tensor_desc);
+  }
+  (void)op_desc->AddOutputDesc(tensor_desc);
+  for (size_t i = 0U; i < kAttrNum; ++i) {
+    (void)AttrUtils::SetInt(op_desc, "attr_" + std::to_string(i), attr_value);
+  }
+  const auto node = graph->AddNode(op_desc);
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    (void)GraphUtils::AddEdge(inputs[i]->GetOutDataAnchor(0), node->GetInDataAnchor(static_cast<int32_t>(i)));
+  }
+  return node;
+}
+
+/**
+ * 模拟transformer展开后的图：每层的hidden被head_num组q/k/v分支消费，
+ * 每个分支都有一个相同的Cast(可消除)，以及属性各不相同的Slice(hash相同、属性不同)
+ */
+ComputeGraphPtr BuildTransformerGraph(const size_t layer_num, const size_t head_num, std::vector<NodePtr> &candidates) {
+  const auto graph = MakeShared<ComputeGraph>("cse_benchmark");
+  auto hidden = AddNode(graph, "input", "Data", {}, 0);
+  for (size_t layer = 0U; layer < layer_num; ++layer) {
+    const auto prefix = "layer" + std::to_string(layer) + "_";
+    std::vector<NodePtr> head_outputs;
+    for (size_t head = 0U; head < head_num; ++head) {
+      for (size_t branch = 0U; branch < kBranchNames.size(); ++branch) {
+        const auto name = prefix + kBranchNames[branch] + std::to_string(head);
+        const auto cast = AddNode(graph, name + "_cast", "Cast", {hidden}, 0);
+        const auto slice_idx = static_cast<int64_t>(head * kBranchNames.size() + branch);
+        const auto slice = AddNode(graph, name + "_slice", "Slice", {hidden}, slice_idx);
+        candidates.emplace_back(cast);
+        candidates.emplace_back(slice);
+        head_outputs.emplace_back(AddNode(graph, name + "_matmul", "MatMul", {cast, slice}, 0));
+      }
+    }
+    hidden = AddNode(graph, prefix + "concat", "ConcatV2", head_outputs, 0);
+  }
+  return graph;
+}
+
+// range(0): 层数，range(1): 每层的head数
+template <typename LookUp>
+void RunLookUp(benchmark::State &state, LookUp look_up) {
+  std::vector<NodePtr> candidates;
+  const auto graph =
+      BuildTransformerGraph(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)), candidates);
+  std::unordered_map<NodePtr, size_t> nodes_2_topo_idx;
+  size_t index = 0U;
+  for (const auto &node : graph->GetDirectNode()) {
+    nodes_2_topo_idx.emplace(node, index++);
+  }
+  size_t same_num = 0U;
+  for (auto _ : state) {
+    same_num = look_up(nodes_2_topo_idx, candidates);
+  }
+  // 每层每个head的q/k/v三个Cast中有两个可消除
+  if (same_num != static_cast<size_t>(state.range(0) * state.range(1) * 2)) {
+    state.SkipWithError("Unexpected cse result.");
+  }
+  state.counters["nodes"] = static_cast<double>(graph->GetDirectNodesSize());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * candidates.size()));
+}
+}  // namespace
+
+static void CseLookUp_StringKey(benchmark::State &state) {
+  RunLookUp(state, [](const std::unordered_map<NodePtr, size_t> &nodes_2_topo_idx,
+                      const std::vector<NodePtr> &candidates) {
+    (void)nodes_2_topo_idx;
+    std::unordered_map<std::string, NodePtr> keys_to_node;
+    size_t same_num = 0U;
+    for (const auto &node : candidates) {
+      if (!keys_to_node.emplace(GetCseKey(node), node).second) {
+        ++same_num;
+      }
+    }
+    return same_num;
+  });
+}
+BENCHMARK(CseLookUp_StringKey)->Args({8, 16})->Args({96, 96})->Unit(benchmark::kMillisecond);
+
+static void CseLookUp_StructuralHash(benchmark::State &state) {
+  RunLookUp(state, [](const std::unordered_map<NodePtr, size_t> &nodes_2_topo_idx,
+                      const std::vector<NodePtr> &candidates) {
+    CseNodeTable cse_nodes(nodes_2_topo_idx);
+    size_t same_num = 0U;
+    for (const auto &node : candidates) {
+      NodePtr same_node = nullptr;
+      (void)cse_nodes.FindOrInsert(node, same_node);
+      if (same_node != nullptr) {
+        ++same_num;
+      }
+    }
+    return same_num;
+  });
+}
+BENCHMARK(CseLookUp_StructuralHash)->Args({8, 16})->Args({96, 96})->Unit(benchmark::kMillisecond);
+}  // namespace ge
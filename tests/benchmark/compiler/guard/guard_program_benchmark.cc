@@ -0,0 +1,191 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <dlfcn.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "common/guard/guard_program.h"
+
+namespace ge {
+namespace {
+using GuardCheckFunc = bool (*)(gert::Tensor **tensors, size_t num_tensors, char_t *reason, size_t reason_size);
+constexpr size_t kRank = 8U;
+constexpr int64_t kDimUpperBound = 4096;
+
+// 第i个guard为 ExpectLe((s[i % kRank] * s[(i + 1) % kRank]), (kDimUpperBound + i))，输入满足所有guard
+std::string GetSymbolName(const size_t idx) {
+  return "s" + std::to_string(idx % kRank);
+}
+
+GuardProgramPtr BuildProgram(const size_t guard_num) {
+  GuardProgramBuilder builder;
+  std::vector<uint16_t> dims;
+  for (size_t i = 0U; i < kRank; ++i) {
+    dims.emplace_back(builder.AddLoad({SourceLoadType::kInputShapeDim, 0, static_cast<int64_t>(i), DT_UNDEFINED}));
+  }
+  for (size_t i = 0U; i < guard_num; ++i) {
+    const auto mul = builder.AddInstruction(GuardProgram::OpCode::kMulInt, dims[i % kRank], dims[(i + 1U) % kRank]);
+    const auto bound = builder.AddIntConst(kDimUpperBound + static_cast<int64_t>(i));
+    builder.AddCheck(builder.AddInstruction(GuardProgram::OpCode::kLeInt, mul, bound),
+                     "Check Symbol Check Expression: guard " + std::to_string(i) + " missed.");
+  }
+  return builder.Build();
+}
+
+// 与GuardCodegen生成的代码结构一致：先取所有符号，再计算所有guard，最后找第一个失败的guard
+std::string GenGuardSource(const size_t guard_num) {
+  std::string code = R"(#include <memory>
+#include <string>
+#include <vector>
+#include "exe_graph/runtime/runtime_tensor.h"
+using char_t = char;
+namespace {
+std::vector<uint8_t> GetCheckResults(gert::Tensor **tensors, size_t num_tensors) {
+  auto dim = [&](size_t idx) -> int64_t {
+    if ((num_tensors == 0U) || (tensors[0] == nullptr)) {
+      return -1;
+    }
+    return tensors[0]->GetOriginShape().GetDim(idx);
+  };
+)";
+  for (size_t i = 0U; i < kRank; ++i) {
+    code += "  const auto s" + std::to_string(i) + " = dim(" + std::to_string(i) + ");\n";
+  }
+  code += "  std::vector<uint8_t> check_results;\n  check_results.reserve(" + std::to_string(guard_num) + ");\n";
+  for (size_t i = 0U; i < guard_num; ++i) {
+    code += "  check_results.emplace_back((" + GetSymbolName(i) + " * " + GetSymbolName(i + 1U) +
+            ") <= " + std::to_string(kDimUpperBound + static_cast<int64_t>(i)) + ");\n";
+  }
+  code += R"(  return check_results;
+}
+}  // namespace
+extern "C" bool GuardCheckFunc(gert::Tensor **tensors, size_t num_tensors, char_t *reason, size_t reason_size) {
+  (void)reason;
+  (void)reason_size;
+  const auto check_results = GetCheckResults(tensors, num_tensors);
+  for (size_t i = 0UL; i < check_results.size(); i++) {
+    if (check_results[i] == 0U) {
+      return false;
+    }
+  }
+  return true;
+}
+)";
+  return code;
+}
+
+// 与guard_check.so的编译命令一致，依赖ASCEND_OPP_PATH下的头文件
+struct GuardSo {
+  int32_t src_fd{-1};
+  int32_t so_fd{-1};
+  void *handle{nullptr};
+  GuardCheckFunc func{nullptr};
+
+  ~GuardSo() {
+    if (handle != nullptr) {
+      (void)dlclose(handle);
+    }
+    if (src_fd != -1) {
+      (void)close(src_fd);
+    }
+    if (so_fd != -1) {
+      (void)close(so_fd);
+    }
+  }
+
+  bool Compile(const std::string &code) {
+    const char_t *opp_path = std::getenv("ASCEND_OPP_PATH");
+    if (opp_path == nullptr) {
+      return false;
+    }
+    src_fd = static_cast<int32_t>(syscall(__NR_memfd_create, "guard_check.cc", 0));
+    so_fd = static_cast<int32_t>(syscall(__NR_memfd_create, "guard_check.so", 0));
+    if ((src_fd == -1) || (so_fd == -1) || (write(src_fd, code.data(), code.size()) != static_cast<ssize_t>(code.size()))) {
+      return false;
+    }
+    const std::string so_path = "/proc/self/fd/" + std::to_string(so_fd);
+    const std::string command = "g++ -O2 -fstack-protector-all -shared -fPIC -Wl,-z,now -Wl,-z,noexecstack -s -o " +
+                                so_path + " -I " + std::string(opp_path) + "/../include -x c++ /proc/self/fd/" +
+                                std::to_string(src_fd);
+    if (system(command.c_str()) != 0) {
+      return false;
+    }
+    handle = dlopen(so_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    func = (handle == nullptr) ? nullptr : reinterpret_cast<GuardCheckFunc>(dlsym(handle, "GuardCheckFunc"));
+    return func != nullptr;
+  }
+};
+
+gert::Tensor MakeInput() {
+  gert::Tensor tensor = {{{8, 16, 32, 64, 8, 16, 32, 64}, {8, 16, 32, 64, 8, 16, 32, 64}},  // shape
+                         {ge::FORMAT_ND, ge::FORMAT_ND, {}},                                // format
+                         gert::kOnDeviceHbm,                                                // placement
+                         ge::DT_FLOAT16,                                                    // data type
+                         nullptr};
+  return tensor;
+}
+}  // namespace
+
+// 编译期：降级成字节码并序列化，加载时反序列化
+static void GuardProgram_BuildAndLoad(benchmark::State &state) {
+  const auto guard_num = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    const auto data = BuildProgram(guard_num)->Serialize();
+    benchmark::DoNotOptimize(GuardProgram::Deserialize(data));
+  }
+}
+BENCHMARK(GuardProgram_BuildAndLoad)->Arg(16)->Arg(256)->Unit(benchmark::kMicrosecond);
+
+// 编译期：生成代码，调用g++编译guard_check.so，加载时dlopen
+static void GuardCheckSo_CompileAndLoad(benchmark::State &state) {
+  const auto guard_num = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    GuardSo guard_so;
+    if (!guard_so.Compile(GenGuardSource(guard_num))) {
+      state.SkipWithError("Compile guard_check.so failed, please check g++ and ASCEND_OPP_PATH.");
+      break;
+    }
+  }
+}
+BENCHMARK(GuardCheckSo_CompileAndLoad)->Arg(16)->Arg(256)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+static void GuardProgram_Check(benchmark::State &state) {
+  const auto program = BuildProgram(static_cast<size_t>(state.range(0)));
+  auto input = MakeInput();
+  std::vector<gert::Tensor *> inputs{&input};
+  char_t reason[1024] = {'\0'};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(GuardProgram_Check)->Arg(16)->Arg(256);
+
+static void GuardCheckSo_Check(benchmark::State &state) {
+  GuardSo guard_so;
+  if (!guard_so.Compile(GenGuardSource(static_cast<size_t>(state.range(0))))) {
+    state.SkipWithError("Compile guard_check.so failed, please check g++ and ASCEND_OPP_PATH.");
+    return;
+  }
+  auto input = MakeInput();
+  std::vector<gert::Tensor *> inputs{&input};
+  char_t reason[1024] = {'\0'};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(guard_so.func(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(GuardCheckSo_Check)->Arg(16)->Arg(256);
+}  // namespace ge
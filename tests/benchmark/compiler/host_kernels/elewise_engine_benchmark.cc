@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <type_traits>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "compiler/host_kernels/kernel_elewise_engine.h"
+
+namespace ge {
+namespace {
+// range(0): 广播场景
+enum class BcastCase : int64_t { kSameShape = 0, kScalar, kRow, kColumn };
+
+void GetShapes(const BcastCase bcast_case, const int64_t row, const int64_t col, std::vector<int64_t> &x_dims,
+               std::vector<int64_t> &y_dims) {
+  x_dims = {row, col};
+  switch (bcast_case) {
+    case BcastCase::kScalar:
+      y_dims = {};
+      break;
+    case BcastCase::kRow:
+      y_dims = {col};
+      break;
+    case BcastCase::kColumn:
+      y_dims = {row, 1};
+      break;
+    default:
+      y_dims = {row, col};
+      break;
+  }
+}
+
+// 与原BCast实现一致：先展开每个输出元素在两个输入上的下标，再逐元素调用带溢出检查的std::function
+void BCastIndexes(const std::vector<int64_t> &x_dims, const std::vector<int64_t> &y_dims,
+                  std::vector<int64_t> &x_indexes, std::vector<int64_t> &y_indexes) {
+  const size_t rank = std::max(x_dims.size(), y_dims.size());
+  std::vector<int64_t> x_bcast(rank, 1);
+  std::vector<int64_t> y_bcast(rank, 1);
+  std::copy(x_dims.begin(), x_dims.end(), x_bcast.begin() + static_cast<int64_t>(rank - x_dims.size()));
+  std::copy(y_dims.begin(), y_dims.end(), y_bcast.begin() + static_cast<int64_t>(rank - y_dims.size()));
+  x_indexes = {0};
+  y_indexes = {0};
+  int64_t x_acc = 1;
+  int64_t y_acc = 1;
+  // 从低维开始，每一维把已有下标复制out_dim份
+  for (size_t i = rank; i > 0U; --i) {
+    const int64_t x_dim = x_bcast[i - 1U];
+    const int64_t y_dim = y_bcast[i - 1U];
+    const int64_t out_dim = std::max(x_dim, y_dim);
+    const size_t inner_num = x_indexes.size();
+    std::vector<int64_t> x_next;
+    std::vector<int64_t> y_next;
+    for (int64_t j = 0; j < out_dim; ++j) {
+      for (size_t k = 0U; k < inner_num; ++k) {
+        x_next.push_back(x_indexes[k] + ((x_dim == 1) ? 0 : j * x_acc));
+        y_next.push_back(y_indexes[k] + ((y_dim == 1) ? 0 : j * y_acc));
+      }
+    }
+    x_indexes.swap(x_next);
+    y_indexes.swap(y_next);
+    x_acc *= x_dim;
+    y_acc *= y_dim;
+  }
+}
+
+template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int32_t>::type = 0>
+Status OverflowCheckAdd(const T &a, const T &b) {
+  return std::isfinite(a + b) ? SUCCESS : FAILED;
+}
+
+template <typename T, typename std::enable_if<std::is_integral<T>::value, int32_t>::type = 0>
+Status OverflowCheckAdd(const T &a, const T &b) {
+  T result;
+  return __builtin_add_overflow(a, b, &result) ? FAILED : SUCCESS;
+}
+
+template <typename T>
+Status LegacyAdd(const T *const x, const std::vector<int64_t> &x_dims, const T *const y,
+                 const std::vector<int64_t> &y_dims, std::vector<T> &out) {
+  const std::function<T(T const &, T const &, Status &)> func = [](T const &a, T const &b, Status &ret) -> T {
+    ret = OverflowCheckAdd(a, b);
+    return (ret == SUCCESS) ? static_cast<T>(a + b) : static_cast<T>(0);
+  };
+  std::vector<int64_t> x_indexes;
+  std::vector<int64_t> y_indexes;
+  BCastIndexes(x_dims, y_dims, x_indexes, y_indexes);
+  out.clear();
+  for (size_t i = 0U; i < x_indexes.size(); ++i) {
+    Status ret = SUCCESS;
+    out.push_back(func(x[x_indexes[i]], y[y_indexes[i]], ret));
+    if (ret != SUCCESS) {
+      return ret;
+    }
+  }
+  return SUCCESS;
+}
+
+template <typename T>
+std::vector<T> MakeData(const int64_t num) {
+  std::vector<T> data(static_cast<size_t>(std::max(num, static_cast<int64_t>(1))));
+  for (size_t i = 0U; i < data.size(); ++i) {
+    data[i] = static_cast<T>(i % 97U);
+  }
+  return data;
+}
+
+int64_t GetNum(const std::vector<int64_t> &dims) {
+  int64_t num = 1;
+  for (const auto dim : dims) {
+    num *= dim;
+  }
+  return num;
+}
+
+// range(0): 广播场景，range(1): 行数，range(2): 列数
+template <typename T>
+void RunLegacy(benchmark::State &state) {
+  std::vector<int64_t> x_dims;
+  std::vector<int64_t> y_dims;
+  GetShapes(static_cast<BcastCase>(state.range(0)), state.range(1), state.range(2), x_dims, y_dims);
+  const auto x = MakeData<T>(GetNum(x_dims));
+  const auto y = MakeData<T>(GetNum(y_dims));
+  std::vector<T> out;
+  for (auto _ : state) {
+    if (LegacyAdd(x.data(), x_dims, y.data(), y_dims, out) != SUCCESS) {
+      state.SkipWithError("Unexpected overflow.");
+      break;
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * GetNum(x_dims));
+}
+
+template <typename T>
+void RunEngine(benchmark::State &state) {
+  std::vector<int64_t> x_dims;
+  std::vector<int64_t> y_dims;
+  GetShapes(static_cast<BcastCase>(state.range(0)), state.range(1), state.range(2), x_dims, y_dims);
+  const auto x = MakeData<T>(GetNum(x_dims));
+  const auto y = MakeData<T>(GetNum(y_dims));
+  std::vector<T> out;
+  for (auto _ : state) {
+    BroadcastPlan plan;
+    if (ElewiseEngine::GenerateBroadcastPlan(x_dims, y_dims, plan) != SUCCESS) {
+      state.SkipWithError("Unexpected shape.");
+      break;
+    }
+    out.resize(static_cast<size_t>(plan.out_num));
+    if (ElewiseEngine::BinaryCompute<elewise::AddOp, T>(x.data(), y.data(), plan, out.data()) != SUCCESS) {
+      state.SkipWithError("Unexpected overflow.");
+      break;
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * GetNum(x_dims));
+}
+
+void BcastArgs(benchmark::internal::Benchmark *bench) {
+  for (int64_t bcast_case = 0; bcast_case <= static_cast<int64_t>(BcastCase::kColumn); ++bcast_case) {
+    bench->Args({bcast_case, 16, 64});
+    bench->Args({bcast_case, 1024, 1024});
+  }
+}
+}  // namespace
+
+static void ElewiseAdd_Float_Legacy(benchmark::State &state) {
+  RunLegacy<float>(state);
+}
+BENCHMARK(ElewiseAdd_Float_Legacy)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+
+static void ElewiseAdd_Float_Engine(benchmark::State &state) {
+  RunEngine<float>(state);
+}
+BENCHMARK(ElewiseAdd_Float_Engine)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+
+static void ElewiseAdd_Int32_Legacy(benchmark::State &state) {
+  RunLegacy<int32_t>(state);
+}
+BENCHMARK(ElewiseAdd_Int32_Legacy)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+
+static void ElewiseAdd_Int32_Engine(benchmark::State &state) {
+  RunEngine<int32_t>(state);
+}
+BENCHMARK(ElewiseAdd_Int32_Engine)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+
+static void ElewiseAdd_Int64_Legacy(benchmark::State &state) {
+  RunLegacy<int64_t>(state);
+}
+BENCHMARK(ElewiseAdd_Int64_Legacy)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+
+static void ElewiseAdd_Int64_Engine(benchmark::State &state) {
+  RunEngine<int64_t>(state);
+}
+BENCHMARK(ElewiseAdd_Int64_Engine)->Apply(BcastArgs)->Unit(benchmark::kMicrosecond);
+}  // namespace ge
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <sys/stat.h>
+#include "cache/te_cache_store.h"
+
+namespace te {
+namespace fusion {
+namespace {
+const std::string kBenchCacheDir = "./te_cache_store_benchmark";
+
+std::string GetKernelName(const int64_t id) {
+  return "te_fused_mul_add_" + std::to_string(id) + "_3f1c9a0b2d7e5f4a6c8b0d2e4f6a8c0e1b3d5f7a9c1e3b5d";
+}
+
+// 生成entryNum个kernel的索引，文件布局与编译结果落盘一致：json + bin
+void PrepareCacheStore(const int64_t entryNum) {
+  static int64_t preparedNum = -1;
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  if (preparedNum == entryNum) {
+    (void)cacheStore.Open(kBenchCacheDir);
+    return;
+  }
+  cacheStore.Close();
+  (void)system(("rm -rf " + kBenchCacheDir).c_str());
+  (void)mkdir(kBenchCacheDir.c_str(), S_IRWXU);
+  (void)cacheStore.Open(kBenchCacheDir);
+  for (int64_t i = 0; i < entryNum; ++i) {
+    TeCacheEntry entry;
+    entry.kernelName = GetKernelName(i);
+    entry.files = {{entry.kernelName + ".json", 2048U}, {entry.kernelName + ".o", 65536U}};
+    entry.totalSize = 2048U + 65536U;
+    entry.binChecksum = static_cast<uint64_t>(i) + 1U;
+    (void)cacheStore.Insert(entry);
+  }
+  cacheStore.SetAuthoritative(true);
+  preparedNum = entryNum;
+}
+}  // namespace
+
+// 新进程打开已有缓存目录后的首次查询
+static void TeCacheStore_ColdOpenLookup(benchmark::State &state) {
+  PrepareCacheStore(state.range(0));
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  int64_t id = 0;
+  for (auto _ : state) {
+    cacheStore.Close();
+    benchmark::DoNotOptimize(cacheStore.Open(kBenchCacheDir));
+    TeCacheEntry entry;
+    benchmark::DoNotOptimize(cacheStore.Lookup(GetKernelName(id), entry));
+    id = (id + 7919) % state.range(0);
+  }
+}
+BENCHMARK(TeCacheStore_ColdOpenLookup)->Arg(100000);
+
+static void TeCacheStore_WarmLookupHit(benchmark::State &state) {
+  PrepareCacheStore(state.range(0));
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  int64_t id = 0;
+  for (auto _ : state) {
+    TeCacheEntry entry;
+    benchmark::DoNotOptimize(cacheStore.Lookup(GetKernelName(id), entry));
+    cacheStore.Touch(entry);
+    id = (id + 7919) % state.range(0);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(TeCacheStore_WarmLookupHit)->Arg(1000)->Arg(100000);
+
+static void TeCacheStore_WarmLookupMiss(benchmark::State &state) {
+  PrepareCacheStore(state.range(0));
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  int64_t id = state.range(0);
+  for (auto _ : state) {
+    TeCacheEntry entry;
+    benchmark::DoNotOptimize(cacheStore.Lookup(GetKernelName(id++), entry));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(TeCacheStore_WarmLookupMiss)->Arg(100000);
+
+// 未建立索引时每次未命中都需要访问文件系统
+static void TeCacheDir_StatMiss(benchmark::State &state) {
+  PrepareCacheStore(state.range(0));
+  int64_t id = state.range(0);
+  for (auto _ : state) {
+    struct stat fileStat;
+    benchmark::DoNotOptimize(stat((kBenchCacheDir + "/" + GetKernelName(id++) + ".json").c_str(), &fileStat));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(TeCacheDir_StatMiss)->Arg(100000);
+}  // namespace fusion
+}  // namespace te
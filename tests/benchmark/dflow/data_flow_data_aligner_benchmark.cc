@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "dflow/runner/executor/data_flow_data_aligner.h"
+
+namespace ge {
+namespace {
+constexpr uint64_t kTransIdStride = 1UL << 32U;
+
+// 与原实现一致：std::map索引 + 全局锁，缓存数据结构相同
+class MapAligner {
+ public:
+  explicit MapAligner(const std::vector<uint32_t> &queue_idxes) : cache_nums_(queue_idxes.size()) {
+    for (size_t i = 0U; i < queue_idxes.size(); ++i) {
+      queue_idx_order_[queue_idxes[i]] = i;
+    }
+  }
+
+  Status PushAndAlignData(uint32_t queue_idx, TensorWithHeader tensor_with_header, std::vector<GeTensor> &output,
+                          DataFlowInfo &info, bool &is_aligned) {
+    is_aligned = false;
+    std::lock_guard<std::mutex> guard(mt_);
+    const auto queue_find_ret = queue_idx_order_.find(queue_idx);
+    if (queue_find_ret == queue_idx_order_.end()) {
+      return FAILED;
+    }
+    const std::pair<uint64_t, uint32_t> key(tensor_with_header.msg_info.trans_id,
+                                            tensor_with_header.msg_info.data_label);
+    auto cache_find_ret = wait_align_data_.find(key);
+    if (cache_find_ret == wait_align_data_.end()) {
+      cache_find_ret = wait_align_data_.emplace(key, AlignCacheData(cache_nums_)).first;
+    }
+    auto &cache_data = cache_find_ret->second;
+    Status ret = cache_data.Push(queue_find_ret->second, std::move(tensor_with_header));
+    if ((ret == SUCCESS) && cache_data.IsComplete()) {
+      is_aligned = true;
+      ret = cache_data.Take(output, info);
+    }
+    if (cache_data.IsEmpty()) {
+      (void)wait_align_data_.erase(cache_find_ret);
+    }
+    return ret;
+  }
+
+ private:
+  std::mutex mt_;
+  std::map<uint32_t, size_t> queue_idx_order_;
+  std::vector<std::atomic<size_t>> cache_nums_;
+  std::map<std::pair<uint64_t, uint32_t>, AlignCacheData> wait_align_data_;
+};
+
+template <typename Aligner>
+std::unique_ptr<Aligner> CreateAligner(const std::vector<uint32_t> &queue_idxes);
+
+template <>
+std::unique_ptr<MapAligner> CreateAligner<MapAligner>(const std::vector<uint32_t> &queue_idxes) {
+  return std::unique_ptr<MapAligner>(new MapAligner(queue_idxes));
+}
+
+template <>
+std::unique_ptr<DataFlowDataAligner> CreateAligner<DataFlowDataAligner>(const std::vector<uint32_t> &queue_idxes) {
+  InputAlignAttrs align_attrs{};
+  align_attrs.align_max_cache_num = UINT32_MAX;
+  align_attrs.align_timeout = -1;
+  align_attrs.drop_when_not_align = false;
+  return std::unique_ptr<DataFlowDataAligner>(new DataFlowDataAligner(queue_idxes, align_attrs, nullptr));
+}
+
+// range(0): 队列个数，range(1): 每个线程同时在途的trans id个数
+// 每轮每个线程先把在途的trans id依次写入前n-1个队列，再写最后一个队列完成对齐
+template <typename Aligner>
+void RunAlign(benchmark::State &state) {
+  static std::unique_ptr<Aligner> aligner;
+  const auto queue_num = static_cast<uint32_t>(state.range(0));
+  const auto inflight_num = static_cast<uint64_t>(state.range(1));
+  if (state.thread_index() == 0) {
+    std::vector<uint32_t> queue_idxes;
+    for (uint32_t i = 0U; i < queue_num; ++i) {
+      queue_idxes.emplace_back(i);
+    }
+    aligner = CreateAligner<Aligner>(queue_idxes);
+  }
+  uint64_t trans_id_base = static_cast<uint64_t>(state.thread_index()) * kTransIdStride;
+  std::vector<GeTensor> output;
+  DataFlowInfo info;
+  size_t aligned_num = 0U;
+  for (auto _ : state) {
+    for (uint32_t queue_idx = 0U; queue_idx < queue_num; ++queue_idx) {
+      for (uint64_t i = 0U; i < inflight_num; ++i) {
+        TensorWithHeader tensor_with_header{};
+        tensor_with_header.msg_info.trans_id = trans_id_base + i;
+        bool is_aligned = false;
+        (void)aligner->PushAndAlignData(queue_idx, std::move(tensor_with_header), output, info, is_aligned);
+        if (is_aligned) {
+          ++aligned_num;
+          output.clear();
+        }
+      }
+    }
+    trans_id_base += inflight_num;
+  }
+  if (aligned_num != static_cast<size_t>(state.iterations()) * inflight_num) {
+    state.SkipWithError("Align data failed.");
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * inflight_num * queue_num));
+  if (state.thread_index() == 0) {
+    aligner.reset();
+  }
+}
+}  // namespace
+
+static void DataAlign_Map(benchmark::State &state) {
+  RunAlign<MapAligner>(state);
+}
+BENCHMARK(DataAlign_Map)->Args({16, 256})->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+
+static void DataAlign_Sharded(benchmark::State &state) {
+  RunAlign<DataFlowDataAligner>(state);
+}
+BENCHMARK(DataAlign_Sharded)->Args({16, 256})->Threads(1)->Threads(4)->Threads(8)->UseRealTime();
+}  // namespace ge
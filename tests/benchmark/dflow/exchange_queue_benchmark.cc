@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <benchmark/benchmark.h>
+
+namespace ge {
+namespace {
+constexpr size_t kQueueDepth = 1024U;
+constexpr int32_t kWaitIntervalMs = 100;
+
+// 模拟rtMemQueue：队列自身带锁，满/空时直接返回，由事件通知空转非空、满转非满
+class HostMemQueue {
+ public:
+  bool TryPush(void *msg, bool &empty_to_not_empty) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (msgs_.size() >= kQueueDepth) {
+      return false;
+    }
+    empty_to_not_empty = msgs_.empty();
+    msgs_.emplace_back(msg);
+    return true;
+  }
+
+  bool TryPop(void *&msg, bool &full_to_not_full) {
+    std::lock_guard<std::mutex> lk(mu_);
+    if (msgs_.empty()) {
+      return false;
+    }
+    full_to_not_full = (msgs_.size() == kQueueDepth);
+    msg = msgs_.front();
+    msgs_.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex mu_;
+  std::deque<void *> msgs_;
+};
+
+// 与原实现一致：出队、入队各一把全局锁和条件变量，每条消息单独加锁、单独唤醒
+class GlobalLockExchange {
+ public:
+  explicit GlobalLockExchange(size_t queue_num) : queues_(queue_num) {
+    for (uint32_t i = 0U; i < queue_num; ++i) {
+      not_empty_[i] = false;
+      not_full_[i] = false;
+    }
+  }
+
+  size_t Enqueue(uint32_t queue_id, void *const *msgs, size_t num) {
+    for (size_t i = 0U; i < num; ++i) {
+      bool empty_to_not_empty = false;
+      {
+        std::unique_lock<std::mutex> lk(enqueue_mu_);
+        while (true) {
+          not_full_[queue_id] = false;
+          if (queues_[queue_id].TryPush(msgs[i], empty_to_not_empty)) {
+            break;
+          }
+          (void)enqueue_cv_.wait_for(lk, std::chrono::milliseconds(kWaitIntervalMs),
+                                     [this, queue_id] { return not_full_[queue_id]; });
+        }
+      }
+      if (empty_to_not_empty) {
+        std::lock_guard<std::mutex> lk(dequeue_mu_);
+        not_empty_[queue_id] = true;
+        dequeue_cv_.notify_all();
+      }
+    }
+    return num;
+  }
+
+  size_t Dequeue(uint32_t queue_id, void **msgs, size_t max_num) {
+    (void)max_num;
+    bool full_to_not_full = false;
+    {
+      std::unique_lock<std::mutex> lk(dequeue_mu_);
+      while (true) {
+        not_empty_[queue_id] = false;
+        if (queues_[queue_id].TryPop(msgs[0], full_to_not_full)) {
+          break;
+        }
+        (void)dequeue_cv_.wait_for(lk, std::chrono::milliseconds(kWaitIntervalMs),
+                                   [this, queue_id] { return not_empty_[queue_id]; });
+      }
+    }
+    if (full_to_not_full) {
+      std::lock_guard<std::mutex> lk(enqueue_mu_);
+      not_full_[queue_id] = true;
+      enqueue_cv_.notify_all();
+    }
+    return 1U;
+  }
+
+ private:
+  std::vector<HostMemQueue> queues_;
+  std::mutex dequeue_mu_;
+  std::condition_variable dequeue_cv_;
+  std::map<uint32_t, bool> not_empty_;
+  std::mutex enqueue_mu_;
+  std::condition_variable enqueue_cv_;
+  std::map<uint32_t, bool> not_full_;
+};
+
+// 与新实现一致：出入队不持有服务的锁，只在等待事件时持有单个队列的锁，一批消息只查找一次订阅表、只唤醒一次
+class PerQueueBatchExchange {
+ public:
+  explicit PerQueueBatchExchange(size_t queue_num) : queues_(queue_num) {
+    for (uint32_t i = 0U; i < queue_num; ++i) {
+      not_empty_[i] = std::make_shared<QueueEventState>();
+      not_full_[i] = std::make_shared<QueueEventState>();
+    }
+  }
+
+  size_t Enqueue(uint32_t queue_id, void *const *msgs, size_t num) {
+    const auto state = GetState(not_full_, queue_id);
+    bool empty_to_not_empty = false;
+    size_t enqueued_num = 0U;
+    while (enqueued_num < num) {
+      const uint64_t event_seq = state->event_seq.load();
+      bool transition = false;
+      if (queues_[queue_id].TryPush(msgs[enqueued_num], transition)) {
+        empty_to_not_empty = empty_to_not_empty || transition;
+        ++enqueued_num;
+        continue;
+      }
+      if (empty_to_not_empty) {
+        // 等待前先通知已入队的部分，避免与出队方互相等待
+        Notify(not_empty_, queue_id);
+        empty_to_not_empty = false;
+      }
+      Wait(*state, event_seq);
+    }
+    if (empty_to_not_empty) {
+      Notify(not_empty_, queue_id);
+    }
+    return num;
+  }
+
+  size_t Dequeue(uint32_t queue_id, void **msgs, size_t max_num) {
+    const auto state = GetState(not_empty_, queue_id);
+    bool full_to_not_full = false;
+    size_t dequeued_num = 0U;
+    while (dequeued_num < max_num) {
+      const uint64_t event_seq = state->event_seq.load();
+      bool transition = false;
+      if (queues_[queue_id].TryPop(msgs[dequeued_num], transition)) {
+        full_to_not_full = full_to_not_full || transition;
+        ++dequeued_num;
+        continue;
+      }
+      if (dequeued_num > 0U) {
+        break;
+      }
+      Wait(*state, event_seq);
+    }
+    if (full_to_not_full) {
+      Notify(not_full_, queue_id);
+    }
+    return dequeued_num;
+  }
+
+ private:
+  struct QueueEventState {
+    std::mutex mu;
+    std::condition_variable cv;
+    std::atomic<uint64_t> event_seq{0UL};
+  };
+  using QueueEventStates = std::map<uint32_t, std::shared_ptr<QueueEventState>>;
+
+  std::shared_ptr<QueueEventState> GetState(const QueueEventStates &states, uint32_t queue_id) {
+    std::lock_guard<std::mutex> lk(registry_mu_);
+    return states.at(queue_id);
+  }
+
+  static void Wait(QueueEventState &state, uint64_t event_seq) {
+    std::unique_lock<std::mutex> lk(state.mu);
+    (void)state.cv.wait_for(lk, std::chrono::milliseconds(kWaitIntervalMs),
+                            [&state, event_seq] { return state.event_seq != event_seq; });
+  }
+
+  // 模拟事件线程收到事件
+  void Notify(const QueueEventStates &states, uint32_t queue_id) {
+    std::lock_guard<std::mutex> lk(registry_mu_);
+    auto &state = *states.at(queue_id);
+    std::lock_guard<std::mutex> state_lk(state.mu);
+    ++state.event_seq;
+    state.cv.notify_all();
+  }
+
+  std::vector<HostMemQueue> queues_;
+  std::mutex registry_mu_;
+  QueueEventStates not_empty_;
+  QueueEventStates not_full_;
+};
+
+// range(0): 队列个数，range(1): 每次出入队的消息个数
+// 每个线程轮流操作自己负责的队列：先入队一批再全部出队，多个线程可能共用同一队列
+template <typename Exchange>
+void RunExchange(benchmark::State &state) {
+  static std::unique_ptr<Exchange> exchange;
+  const auto queue_num = static_cast<uint32_t>(state.range(0));
+  const auto batch_num = static_cast<size_t>(state.range(1));
+  if (state.thread_index() == 0) {
+    exchange.reset(new Exchange(queue_num));
+  }
+  const auto thread_num = static_cast<uint32_t>(state.threads());
+  const auto thread_index = static_cast<uint32_t>(state.thread_index());
+  std::vector<uint32_t> queue_ids;
+  for (uint32_t queue_id = thread_index % queue_num; queue_id < queue_num; queue_id += thread_num) {
+    queue_ids.emplace_back(queue_id);
+  }
+  std::vector<void *> in_msgs(batch_num, &state);
+  std::vector<void *> out_msgs(batch_num, nullptr);
+  size_t msg_num = 0U;
+  for (auto _ : state) {
+    for (const auto queue_id : queue_ids) {
+      size_t enqueued_num = 0U;
+      while (enqueued_num < batch_num) {
+        enqueued_num += exchange->Enqueue(queue_id, &in_msgs[enqueued_num], batch_num - enqueued_num);
+      }
+      size_t dequeued_num = 0U;
+      while (dequeued_num < batch_num) {
+        dequeued_num += exchange->Dequeue(queue_id, &out_msgs[dequeued_num], batch_num - dequeued_num);
+      }
+      msg_num += batch_num;
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(msg_num));
+  if (state.thread_index() == 0) {
+    exchange.reset();
+  }
+}
+}  // namespace
+
+static void ExchangeQueue_GlobalLock(benchmark::State &state) {
+  RunExchange<GlobalLockExchange>(state);
+}
+BENCHMARK(ExchangeQueue_GlobalLock)
+    ->ArgsProduct({{1, 8, 64}, {1, 16}})
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+
+static void ExchangeQueue_PerQueueBatch(benchmark::State &state) {
+  RunExchange<PerQueueBatchExchange>(state);
+}
+BENCHMARK(ExchangeQueue_PerQueueBatch)
+    ->ArgsProduct({{1, 8, 64}, {1, 16}})
+    ->Threads(1)
+    ->Threads(4)
+    ->Threads(8)
+    ->UseRealTime();
+}  // namespace ge
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <string>
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include "deploy/model_send/weight_stream_sender.h"
+#include "depends/helper_runtime/src/loopback_exchange_service.h"
+
+namespace ge {
+namespace {
+constexpr size_t kBytesPerMb = 1024U * 1024U;
+constexpr size_t kQueueDepth = 8U;
+constexpr int32_t kTimeout = 60 * 1000;
+
+// 权重文件，整个进程只生成一次
+class WeightFile {
+ public:
+  static const std::string &GetPath(const size_t size_mb) {
+    static WeightFile weight_file;
+    if (weight_file.size_mb_ < size_mb) {
+      std::ofstream out(weight_file.path_, std::ios::binary | std::ios::trunc);
+      std::string block(kBytesPerMb, '\0');
+      for (size_t i = 0U; i < block.size(); ++i) {
+        block[i] = static_cast<char>(i * 131U);
+      }
+      for (size_t i = 0U; i < size_mb; ++i) {
+        out.write(block.data(), static_cast<std::streamsize>(block.size()));
+      }
+      weight_file.size_mb_ = size_mb;
+    }
+    return weight_file.path_;
+  }
+
+ private:
+  WeightFile() : path_("weight_stream_benchmark_" + std::to_string(getpid()) + ".bin") {}
+  ~WeightFile() {
+    (void)std::remove(path_.c_str());
+  }
+  std::string path_;
+  size_t size_mb_ = 0U;
+};
+
+// 接收端持续从loopback队列中取数据
+std::future<Status> StartReceiver(LoopbackExchangeService &exchange_service, const uint32_t queue_id,
+                                  const uint64_t total_length) {
+  return std::async(std::launch::async, [&exchange_service, queue_id, total_length]() -> Status {
+    uint64_t received = 0U;
+    while (received < total_length) {
+      LoopbackExchangeService::Message message;
+      GE_CHK_STATUS_RET_NOLOG(exchange_service.DequeueMessage(0, queue_id, message, kTimeout));
+      received += message.data.size();
+    }
+    return SUCCESS;
+  });
+}
+
+// 与原TransferWeightWithQ一致：单个缓冲，读一块、同步入队一块
+Status SendSerially(ExchangeService &exchange_service, std::istream &input_stream, const uint64_t length,
+                    const DeployQueueAttr &queue_attr, const size_t chunk_size) {
+  std::string buffer(chunk_size, '\0');
+  ExchangeService::ControlInfo control_info{};
+  control_info.timeout = kTimeout;
+  uint64_t sent = 0U;
+  while (sent < length) {
+    const auto read_len = static_cast<size_t>(std::min(static_cast<uint64_t>(chunk_size), length - sent));
+    (void)input_stream.read(&buffer[0U], static_cast<std::streamsize>(read_len));
+    GE_CHK_STATUS_RET_NOLOG(
+        exchange_service.Enqueue(queue_attr.device_id, queue_attr.queue_id, buffer.data(), read_len, control_info));
+    sent += read_len;
+  }
+  return SUCCESS;
+}
+
+// range(0): 文件大小(MB)，range(1): 模拟链路带宽(MB/s，0表示不限)，range(2): 预读缓冲个数(0表示串行发送)
+void RunWeightTransfer(benchmark::State &state) {
+  const auto size_mb = static_cast<size_t>(state.range(0));
+  const auto length = static_cast<uint64_t>(size_mb * kBytesPerMb);
+  const auto &path = WeightFile::GetPath(size_mb);
+  WeightStreamOption option;
+  option.read_ahead_num = static_cast<size_t>(state.range(2));
+  option.enqueue_timeout = kTimeout;
+  for (auto _ : state) {
+    LoopbackExchangeService exchange_service(kQueueDepth, static_cast<uint64_t>(state.range(1)));
+    DeployQueueAttr queue_attr{};
+    (void)exchange_service.CreateQueue(0, "transfer_file", kQueueDepth, 0U, queue_attr.queue_id);
+    std::ifstream input_stream(path, std::ifstream::binary);
+    auto receiver = StartReceiver(exchange_service, queue_attr.queue_id, length);
+    Status ret = SUCCESS;
+    if (option.read_ahead_num == 0U) {
+      ret = SendSerially(exchange_service, input_stream, length, queue_attr, option.chunk_size);
+    } else {
+      WeightStreamSender sender(exchange_service, option);
+      ret = sender.Send(input_stream, length, queue_attr);
+    }
+    if ((ret != SUCCESS) || (receiver.get() != SUCCESS)) {
+      state.SkipWithError("Transfer weight failed.");
+      break;
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(length));
+}
+}  // namespace
+
+static void WeightTransfer_Serial(benchmark::State &state) {
+  RunWeightTransfer(state);
+}
+BENCHMARK(WeightTransfer_Serial)->Args({256, 0, 0})->Args({256, 2048, 0})->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void WeightTransfer_Stream(benchmark::State &state) {
+  RunWeightTransfer(state);
+}
+BENCHMARK(WeightTransfer_Stream)
+    ->Args({256, 0, 4})
+    ->Args({256, 2048, 1})
+    ->Args({256, 2048, 4})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+}  // namespace ge
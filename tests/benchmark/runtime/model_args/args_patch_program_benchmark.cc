@@ -0,0 +1,145 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "graph/load/model_manager/args_patch_program.h"
+
+namespace ge {
+namespace {
+constexpr size_t kAllocationNum = 16U;
+constexpr size_t kFmAllocationNum = 4U;
+constexpr size_t kArgsNumPerTask = 8U;
+constexpr size_t kTaskNumPerFmBlock = 256U;
+constexpr uint32_t kK32Bits = 32U;
+constexpr uint32_t k32BitsMask = 0xFFFFFFFFU;
+
+// 与ModelArgsManager::ModelArgsRefreshInfo的内存布局一致
+struct RefreshInfo {
+  RefreshInfo(const uint64_t info_offset, void *const info_host_args_addr)
+      : offset(info_offset), host_args_addr(info_host_args_addr) {}
+  uint32_t id{0U};
+  uint64_t offset;
+  void *host_args_addr;
+  uint64_t device_args_addr{0U};
+};
+
+struct PatchCase {
+  std::vector<uint64_t> host_args;
+  std::vector<std::vector<RefreshInfo>> addr_all;
+  std::vector<std::vector<RefreshInfo>> addr_low_32bit;
+  std::vector<std::vector<RefreshInfo>> addr_high_32bit;
+  std::vector<uint64_t> bases;
+};
+
+/**
+ * 模拟task args表：每个task有kArgsNumPerTask个地址，按task顺序连续排布；
+ * 连续kTaskNumPerFmBlock个task的地址属于同一块fm，约1/8的地址为model io或权重，
+ * model io归属随机的allocation，权重地址不刷新；fm地址中约1/8以低/高32位两段格式刷新
+ */
+void BuildPatchCase(const size_t task_num, PatchCase &patch_case) {
+  std::mt19937 rng(0x5EED);
+  patch_case.host_args.assign(task_num * kArgsNumPerTask, 0U);
+  patch_case.addr_all.assign(kAllocationNum, {});
+  patch_case.addr_low_32bit.assign(kAllocationNum, {});
+  patch_case.addr_high_32bit.assign(kAllocationNum, {});
+  patch_case.bases.assign(kAllocationNum, 0U);
+  for (size_t i = 0U; i < patch_case.host_args.size(); ++i) {
+    const uint64_t offset = (rng() % 0x100000U) * 0x20U;
+    auto *host_addr = &patch_case.host_args[i];
+    const size_t fm_id = (i / (kArgsNumPerTask * kTaskNumPerFmBlock)) % kFmAllocationNum;
+    const uint32_t kind = rng() % 16U;
+    if (kind == 0U) {
+      const size_t io_id = kFmAllocationNum + (rng() % (kAllocationNum - kFmAllocationNum));
+      patch_case.addr_all[io_id].emplace_back(offset, host_addr);
+    } else if (kind == 1U) {
+      continue;
+    } else if ((i % kArgsNumPerTask) == (kArgsNumPerTask - 1U)) {
+      patch_case.addr_low_32bit[fm_id].emplace_back(offset, host_addr);
+      patch_case.addr_high_32bit[fm_id].emplace_back(offset, reinterpret_cast<uint32_t *>(host_addr) + 1);
+    } else {
+      patch_case.addr_all[fm_id].emplace_back(offset, host_addr);
+    }
+  }
+}
+
+ArgsPatchProgram CompileProgram(const PatchCase &patch_case) {
+  ArgsPatchProgram program;
+  program.Reset(kAllocationNum);
+  for (uint32_t id = 0U; id < kAllocationNum; ++id) {
+    for (const auto &info : patch_case.addr_all[id]) {
+      (void)program.AddPatch(id, ArgsPatchProgram::PatchFormat::kAddrAll, info.host_args_addr, info.offset);
+    }
+    for (const auto &info : patch_case.addr_low_32bit[id]) {
+      (void)program.AddPatch(id, ArgsPatchProgram::PatchFormat::kAddrLow32Bit, info.host_args_addr, info.offset);
+    }
+    for (const auto &info : patch_case.addr_high_32bit[id]) {
+      (void)program.AddPatch(id, ArgsPatchProgram::PatchFormat::kAddrHigh32Bit, info.host_args_addr, info.offset);
+    }
+  }
+  (void)program.Compile();
+  return program;
+}
+
+// 每步所有allocation的base都变化，对应fm与model io均需刷新的最坏场景
+void NextBases(std::vector<uint64_t> &bases, const uint64_t step) {
+  for (size_t id = 0U; id < bases.size(); ++id) {
+    bases[id] = 0x124000000000UL + (step % 2U) * 0x100000000UL + id * 0x10000000UL;
+  }
+}
+}  // namespace
+
+static void ArgsPatch_PerAddrLoop(benchmark::State &state) {
+  PatchCase patch_case;
+  BuildPatchCase(static_cast<size_t>(state.range(0)), patch_case);
+  uint64_t step = 0U;
+  for (auto _ : state) {
+    NextBases(patch_case.bases, step++);
+    for (size_t id = 0U; id < kAllocationNum; ++id) {
+      const uint64_t base = patch_case.bases[id];
+      for (const auto &info : patch_case.addr_all[id]) {
+        *static_cast<uint64_t *>(info.host_args_addr) = base + info.offset;
+      }
+      for (const auto &info : patch_case.addr_low_32bit[id]) {
+        *static_cast<uint32_t *>(info.host_args_addr) = static_cast<uint32_t>((base + info.offset) & k32BitsMask);
+      }
+      for (const auto &info : patch_case.addr_high_32bit[id]) {
+        *static_cast<uint32_t *>(info.host_args_addr) = static_cast<uint32_t>((base + info.offset) >> kK32Bits);
+      }
+    }
+    benchmark::DoNotOptimize(patch_case.host_args.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(patch_case.host_args.size()));
+}
+BENCHMARK(ArgsPatch_PerAddrLoop)->Arg(1000)->Arg(10000)->Arg(50000);
+
+static void ArgsPatch_CompiledProgram(benchmark::State &state) {
+  PatchCase patch_case;
+  BuildPatchCase(static_cast<size_t>(state.range(0)), patch_case);
+  const auto program = CompileProgram(patch_case);
+  state.counters["runs"] = static_cast<double>(program.GetTotalRunNum());
+  uint64_t step = 0U;
+  for (auto _ : state) {
+    NextBases(patch_case.bases, step++);
+    for (uint32_t id = 0U; id < kAllocationNum; ++id) {
+      benchmark::DoNotOptimize(program.Execute(id, patch_case.bases[id]));
+    }
+    benchmark::DoNotOptimize(patch_case.host_args.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(patch_case.host_args.size()));
+}
+BENCHMARK(ArgsPatch_CompiledProgram)->Arg(1000)->Arg(10000)->Arg(50000);
+}  // namespace ge
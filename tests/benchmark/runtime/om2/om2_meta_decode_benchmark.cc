@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "nlohmann/json.hpp"
+#include "common/om2/om2_binary_meta.h"
+
+namespace ge {
+namespace {
+using OpAttrMap = std::map<std::string, std::map<std::string, std::string>>;
+constexpr size_t kAttrNumPerOp = 6U;
+
+OpAttrMap BuildOpAttrMap(const size_t op_num) {
+  OpAttrMap op_attr_map;
+  for (size_t i = 0U; i < op_num; ++i) {
+    auto &attrs = op_attr_map["model/layer_" + std::to_string(i / 16U) + "/op_" + std::to_string(i)];
+    for (size_t j = 0U; j < kAttrNumPerOp; ++j) {
+      attrs["_attr_" + std::to_string(j)] = std::to_string(i * kAttrNumPerOp + j);
+    }
+  }
+  return op_attr_map;
+}
+
+std::string DumpOpAttrMapToJson(const OpAttrMap &op_attr_map) {
+  nlohmann::json json_obj = nlohmann::json::object();
+  for (const auto &[op_name, attrs] : op_attr_map) {
+    nlohmann::json op_attrs = nlohmann::json::object();
+    for (const auto &[attr_name, value] : attrs) {
+      op_attrs[attr_name] = value;
+    }
+    json_obj[op_name] = op_attrs;
+  }
+  return json_obj.dump();
+}
+
+// 与加载流程中op_attr.json的解析方式保持一致
+void ParseOpAttrMapJson(const std::string &json_str, OpAttrMap &op_attr_map) {
+  const auto json_obj = nlohmann::json::parse(json_str);
+  for (auto &[op_name, attrs] : json_obj.items()) {
+    std::map<std::string, std::string> op_attrs;
+    for (auto &[attr_name, value] : attrs.items()) {
+      op_attrs[attr_name] = value.is_string() ? value.get<std::string>() : value.dump();
+    }
+    op_attr_map[op_name] = op_attrs;
+  }
+}
+
+std::vector<Om2VarMeta> BuildVarMetas(const size_t var_num) {
+  std::vector<Om2VarMeta> var_metas(var_num);
+  for (size_t i = 0U; i < var_num; ++i) {
+    auto &meta = var_metas[i];
+    meta.index = i;
+    meta.var_name = "var_" + std::to_string(i);
+    meta.op_type = "Variable";
+    meta.op_name = "model/var_" + std::to_string(i);
+    meta.tensor_desc.SetName(meta.var_name);
+    meta.tensor_desc.SetShape({1, 16, 64, 64});
+    meta.tensor_desc.SetShapeRange({{1, 1}, {16, 16}, {64, 64}, {64, 64}});
+    meta.tensor_desc.SetDataType(DT_FLOAT16);
+    meta.tensor_desc.SetFormat(FORMAT_ND);
+    meta.tensor_desc.SetSize(1U * 16U * 64U * 64U * 2U);
+  }
+  return var_metas;
+}
+
+std::string DumpVarMetasToJson(const std::vector<Om2VarMeta> &var_metas) {
+  nlohmann::json var_metas_json = nlohmann::json::array();
+  for (const auto &meta : var_metas) {
+    nlohmann::json desc_json;
+    desc_json["name"] = meta.tensor_desc.GetName();
+    desc_json["shape"] = meta.tensor_desc.GetShape();
+    desc_json["data_type"] = "DT_FLOAT16";
+    desc_json["format"] = "ND";
+    desc_json["size"] = meta.tensor_desc.GetSize();
+    desc_json["shape_range"] = meta.tensor_desc.GetShapeRange();
+    nlohmann::json meta_json;
+    meta_json["index"] = meta.index;
+    meta_json["var_name"] = meta.var_name;
+    meta_json["op_type"] = meta.op_type;
+    meta_json["op_name"] = meta.op_name;
+    meta_json["tensor_desc"] = desc_json;
+    var_metas_json.push_back(meta_json);
+  }
+  nlohmann::json json_obj;
+  json_obj["graph_id"] = 0U;
+  json_obj["var_metas"] = var_metas_json;
+  return json_obj.dump();
+}
+
+void ParseVarMetasJson(const std::string &json_str, std::vector<Om2VarMeta> &var_metas) {
+  const auto json_obj = nlohmann::json::parse(json_str);
+  for (const auto &meta_json : json_obj["var_metas"]) {
+    Om2VarMeta meta;
+    meta.index = meta_json["index"].get<size_t>();
+    meta.var_name = meta_json["var_name"].get<std::string>();
+    meta.op_type = meta_json["op_type"].get<std::string>();
+    meta.op_name = meta_json["op_name"].get<std::string>();
+    const auto &desc_json = meta_json["tensor_desc"];
+    meta.tensor_desc.SetName(desc_json["name"].get<std::string>());
+    meta.tensor_desc.SetShape(desc_json["shape"].get<std::vector<int64_t>>());
+    meta.tensor_desc.SetSize(desc_json["size"].get<size_t>());
+    meta.tensor_desc.SetShapeRange(desc_json["shape_range"].get<std::vector<std::pair<int64_t, int64_t>>>());
+    var_metas.emplace_back(std::move(meta));
+  }
+}
+}  // namespace
+
+static void Om2Meta_OpAttrDecodeJson(benchmark::State &state) {
+  const auto json_str = DumpOpAttrMapToJson(BuildOpAttrMap(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    OpAttrMap op_attr_map;
+    ParseOpAttrMapJson(json_str, op_attr_map);
+    benchmark::DoNotOptimize(op_attr_map);
+  }
+  state.counters["bytes"] = static_cast<double>(json_str.size());
+}
+BENCHMARK(Om2Meta_OpAttrDecodeJson)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+static void Om2Meta_OpAttrDecodeBinary(benchmark::State &state) {
+  std::vector<uint8_t> buffer;
+  (void)Om2BinaryMetaCodec::EncodeOpAttrMap(BuildOpAttrMap(static_cast<size_t>(state.range(0))), buffer);
+  for (auto _ : state) {
+    OpAttrMap op_attr_map;
+    (void)Om2BinaryMetaCodec::DecodeOpAttrMap(buffer.data(), buffer.size(), op_attr_map);
+    benchmark::DoNotOptimize(op_attr_map);
+  }
+  state.counters["bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(Om2Meta_OpAttrDecodeBinary)->Arg(10000)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+static void Om2Meta_VarMetasDecodeJson(benchmark::State &state) {
+  const auto json_str = DumpVarMetasToJson(BuildVarMetas(static_cast<size_t>(state.range(0))));
+  for (auto _ : state) {
+    std::vector<Om2VarMeta> var_metas;
+    ParseVarMetasJson(json_str, var_metas);
+    benchmark::DoNotOptimize(var_metas);
+  }
+  state.counters["bytes"] = static_cast<double>(json_str.size());
+}
+BENCHMARK(Om2Meta_VarMetasDecodeJson)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void Om2Meta_VarMetasDecodeBinary(benchmark::State &state) {
+  std::vector<uint8_t> buffer;
+  (void)Om2BinaryMetaCodec::EncodeVariablesConfig(BuildVarMetas(static_cast<size_t>(state.range(0))), 0U, buffer);
+  for (auto _ : state) {
+    std::vector<Om2VarMeta> var_metas;
+    uint32_t graph_id = 0U;
+    (void)Om2BinaryMetaCodec::DecodeVariablesConfig(buffer.data(), buffer.size(), var_metas, graph_id);
+    benchmark::DoNotOptimize(var_metas);
+  }
+  state.counters["bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(Om2Meta_VarMetasDecodeBinary)->Arg(10000)->Unit(benchmark::kMillisecond);
+}  // namespace ge
@@ -0,0 +1,242 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef AIR_TESTS_DEPENDS_HELPER_RUNTIME_LOOPBACK_EXCHANGE_SERVICE_H_
+#define AIR_TESTS_DEPENDS_HELPER_RUNTIME_LOOPBACK_EXCHANGE_SERVICE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "dflow/base/deploy/exchange_service.h"
+
+namespace ge {
+/**
+ * 进程内的ExchangeService，队列数据保存在内存中，不依赖mbuf和device，
+ * 可按带宽模拟传输耗时，并可注入入队失败与数据篡改，用于在普通Linux环境下验证和压测发送流程
+ */
+class LoopbackExchangeService : public ExchangeService {
+ public:
+  struct Message {
+    std::vector<uint8_t> data;
+    int8_t user_data[kMaxUserDataSize] = {};
+  };
+
+  explicit LoopbackExchangeService(const size_t depth = 8U, const uint64_t bandwidth_mb = 0U)
+      : depth_(depth), bandwidth_mb_(bandwidth_mb) {}
+  ~LoopbackExchangeService() override = default;
+
+  using ExchangeService::CreateQueue;
+
+  Status CreateQueue(const int32_t device_id, const std::string &name, const MemQueueAttr &mem_queue_attr,
+                     uint32_t &queue_id) override {
+    (void)device_id;
+    (void)name;
+    (void)mem_queue_attr;
+    std::lock_guard<std::mutex> lk(mu_);
+    queue_id = next_queue_id_++;
+    (void)queues_[queue_id];
+    return SUCCESS;
+  }
+
+  Status DestroyQueue(const int32_t device_id, const uint32_t queue_id) override {
+    (void)device_id;
+    std::lock_guard<std::mutex> lk(mu_);
+    (void)queues_.erase(queue_id);
+    return SUCCESS;
+  }
+
+  Status Enqueue(const int32_t device_id, const uint32_t queue_id, const void *const data, const size_t size,
+                 const ControlInfo &control_info) override {
+    (void)device_id;
+    Message message;
+    message.data.assign(static_cast<const uint8_t *>(data), static_cast<const uint8_t *>(data) + size);
+    return Push(queue_id, std::move(message), control_info);
+  }
+
+  Status Enqueue(const int32_t device_id, const uint32_t queue_id, const size_t size, const FillFunc &fill_func,
+                 const ControlInfo &control_info) override {
+    (void)device_id;
+    Message message;
+    message.data.resize(size);
+    GE_CHK_STATUS_RET_NOLOG(fill_func(message.data.data(), size));
+    return Push(queue_id, std::move(message), control_info);
+  }
+
+  Status Enqueue(const int32_t device_id, const uint32_t queue_id, const std::vector<BuffInfo> &buffs,
+                 const ControlInfo &control_info) override {
+    (void)device_id;
+    Message message;
+    for (const auto &buff : buffs) {
+      const auto *const addr = static_cast<const uint8_t *>(buff.addr);
+      message.data.insert(message.data.end(), addr, addr + buff.len);
+    }
+    return Push(queue_id, std::move(message), control_info);
+  }
+
+  Status Enqueue(int32_t device_id, uint32_t queue_id, size_t size, rtMbufPtr_t m_buf,
+                 const ControlInfo &control_info) override {
+    (void)device_id;
+    (void)queue_id;
+    (void)size;
+    (void)m_buf;
+    (void)control_info;
+    return UNSUPPORTED;
+  }
+
+  Status EnqueueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t m_buf, int32_t timeout) override {
+    (void)device_id;
+    (void)queue_id;
+    (void)m_buf;
+    (void)timeout;
+    return UNSUPPORTED;
+  }
+
+  Status Dequeue(const int32_t device_id, const uint32_t queue_id, void *const data, const size_t size,
+                 ControlInfo &control_info) override {
+    Message message;
+    GE_CHK_STATUS_RET_NOLOG(DequeueMessage(device_id, queue_id, message, control_info.timeout));
+    GE_CHK_BOOL_RET_STATUS(message.data.size() <= size, FAILED, "Buffer size[%zu] is less than message size[%zu].",
+                           size, message.data.size());
+    if (!message.data.empty()) {
+      (void)memcpy(data, message.data.data(), message.data.size());
+    }
+    (void)memcpy(control_info.user_data, message.user_data, sizeof(message.user_data));
+    return SUCCESS;
+  }
+
+  Status DequeueMbufTensor(const int32_t device_id, const uint32_t queue_id, std::shared_ptr<AlignedPtr> &aligned_ptr,
+                           const size_t size, ControlInfo &control_info) override {
+    (void)device_id;
+    (void)queue_id;
+    (void)aligned_ptr;
+    (void)size;
+    (void)control_info;
+    return UNSUPPORTED;
+  }
+
+  Status DequeueTensor(const int32_t device_id, const uint32_t queue_id, GeTensor &tensor,
+                       ControlInfo &control_info) override {
+    (void)device_id;
+    (void)queue_id;
+    (void)tensor;
+    (void)control_info;
+    return UNSUPPORTED;
+  }
+
+  Status DequeueMbuf(int32_t device_id, uint32_t queue_id, rtMbufPtr_t *m_buf, int32_t timeout) override {
+    (void)device_id;
+    (void)queue_id;
+    (void)m_buf;
+    (void)timeout;
+    return UNSUPPORTED;
+  }
+
+  void ResetQueueInfo(const int32_t device_id, const uint32_t queue_id) override {
+    (void)device_id;
+    std::lock_guard<std::mutex> lk(mu_);
+    const auto it = queues_.find(queue_id);
+    if (it != queues_.end()) {
+      it->second.clear();
+    }
+  }
+
+  // timeout为-1时一直等待
+  Status DequeueMessage(const int32_t device_id, const uint32_t queue_id, Message &message, const int32_t timeout) {
+    (void)device_id;
+    std::unique_lock<std::mutex> lk(mu_);
+    const auto ready = [this, queue_id]() {
+      const auto it = queues_.find(queue_id);
+      return (it == queues_.end()) || (!it->second.empty());
+    };
+    if (!WaitFor(lk, ready, timeout)) {
+      return FAILED;
+    }
+    const auto it = queues_.find(queue_id);
+    GE_CHK_BOOL_RET_STATUS(it != queues_.end(), PARAM_INVALID, "Queue[%u] does not exist.", queue_id);
+    message = std::move(it->second.front());
+    it->second.pop_front();
+    cv_.notify_all();
+    return SUCCESS;
+  }
+
+  // 之后的enqueue_failure_num次入队直接失败
+  void InjectEnqueueFailure(const size_t enqueue_failure_num) {
+    std::lock_guard<std::mutex> lk(mu_);
+    enqueue_failure_num_ = enqueue_failure_num;
+  }
+
+  // 跳过之后skip_num次成功的入队，再之后corruption_num次入队的数据被篡改一个字节
+  void InjectCorruption(const size_t skip_num, const size_t corruption_num = 1U) {
+    std::lock_guard<std::mutex> lk(mu_);
+    corruption_skip_num_ = skip_num;
+    corruption_num_ = corruption_num;
+  }
+
+ private:
+  template <typename Pred>
+  bool WaitFor(std::unique_lock<std::mutex> &lk, const Pred &pred, const int32_t timeout) {
+    if (timeout < 0) {
+      cv_.wait(lk, pred);
+      return true;
+    }
+    return cv_.wait_for(lk, std::chrono::milliseconds(timeout), pred);
+  }
+
+  Status Push(const uint32_t queue_id, Message &&message, const ControlInfo &control_info) {
+    (void)memcpy(message.user_data, control_info.user_data, sizeof(message.user_data));
+    if (bandwidth_mb_ > 0U) {
+      // 模拟链路传输耗时
+      std::this_thread::sleep_for(std::chrono::microseconds(message.data.size() / bandwidth_mb_));
+    }
+    std::unique_lock<std::mutex> lk(mu_);
+    if (enqueue_failure_num_ > 0U) {
+      --enqueue_failure_num_;
+      return FAILED;
+    }
+    const auto not_full = [this, queue_id]() {
+      const auto it = queues_.find(queue_id);
+      return (it == queues_.end()) || (it->second.size() < depth_);
+    };
+    if (!WaitFor(lk, not_full, control_info.timeout)) {
+      return FAILED;
+    }
+    const auto it = queues_.find(queue_id);
+    GE_CHK_BOOL_RET_STATUS(it != queues_.end(), PARAM_INVALID, "Queue[%u] does not exist.", queue_id);
+    if (corruption_num_ > 0U) {
+      if (corruption_skip_num_ > 0U) {
+        --corruption_skip_num_;
+      } else if (!message.data.empty()) {
+        --corruption_num_;
+        message.data[message.data.size() / 2U] ^= 0x1U;
+      }
+    }
+    it->second.emplace_back(std::move(message));
+    cv_.notify_all();
+    return SUCCESS;
+  }
+
+  size_t depth_;
+  uint64_t bandwidth_mb_;  // MB/s，为0时不模拟传输耗时
+  std::mutex mu_;
+  std::condition_variable cv_;
+  std::map<uint32_t, std::deque<Message>> queues_;
+  uint32_t next_queue_id_ = 0U;
+  size_t enqueue_failure_num_ = 0U;
+  size_t corruption_skip_num_ = 0U;
+  size_t corruption_num_ = 0U;
+};
+}  // namespace ge
+
+#endif  // AIR_TESTS_DEPENDS_HELPER_RUNTIME_LOOPBACK_EXCHANGE_SERVICE_H_
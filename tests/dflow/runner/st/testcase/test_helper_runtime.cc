@@ -3581,8 +3581,8 @@ TEST_F(STEST_helper_runtime, TestEnqueueAndDequeueFail) {
   RuntimeStub::SetInstance(std::make_shared<MockRuntime>());
   enqueue_dequeue_error_flag = true;
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
   uint8_t buf[128];
@@ -3606,8 +3606,8 @@ TEST_F(STEST_helper_runtime, TestHeterogeneousProfiler) {
   setenv("GE_PROFILING_TO_STD_OUT", "2", true);
   HeterogeneousExchangeService exchange_service;
   exchange_service.Initialize(0);
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
   uint8_t buf[128];
@@ -3738,8 +3738,8 @@ TEST_F(STEST_helper_runtime, TestDeployWithFlowOnServer) {
 
 TEST_F(STEST_helper_runtime, TestEnqueueAndDequeueMbufTensorSuccess) {
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
   ExchangeService::ControlInfo control_info = {};
@@ -3758,8 +3758,8 @@ TEST_F(STEST_helper_runtime, TestEnqueueAndDequeueMbufTensorSuccess) {
 
 TEST_F(STEST_helper_runtime, TestEnqueueAndDequeueSuccess) {
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   uint32_t client_queue_id = 1;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
@@ -3809,8 +3809,8 @@ TEST_F(STEST_helper_runtime, TestEnqueueAndDequeueSuccess) {
 
 TEST_F(STEST_helper_runtime, TestModelIoProfiling) {
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
   ExchangeService::ControlInfo control_info = {};
@@ -9,6 +9,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 #include <vector>
 #include "macro_utils/dt_public_scope.h"
 #include "dflow/runner/executor/data_flow_data_aligner.h"
@@ -77,7 +78,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_in_order) {
   EXPECT_TRUE(output.empty());
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 1;
   msg_info.data_label = 0;
 
@@ -89,7 +90,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_in_order) {
   tensor_with_header1.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(7, std::move(tensor_with_header1), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(is_aligned);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
   EXPECT_FALSE(output.empty());
   EXPECT_EQ(info.GetStartTime(), expect_start_time);
   ASSERT_EQ(output.size(), 2);
@@ -138,7 +139,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_with_repeat) {
   EXPECT_TRUE(output.empty());
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 1;
   msg_info.data_label = 0;
   constexpr uint64_t expect_data1 = 7777;
@@ -201,7 +202,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_out_of_order) {
   EXPECT_FALSE(has_output);
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 2;
   msg_info.data_label = 0;
   constexpr uint64_t expect_data1 = 7777;
@@ -212,7 +213,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_out_of_order) {
   tensor_with_header.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(7, tensor_with_header, output, info, is_aligned), SUCCESS);
 
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
   EXPECT_TRUE(output.empty());
 
   msg_info.trans_id = 2;
@@ -222,7 +223,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_out_of_order) {
   EXPECT_EQ(aligner.PushAndAlignData(6, tensor_with_header, output, info, is_aligned), SUCCESS);
   ASSERT_EQ(output.size(), 2);
   EXPECT_TRUE(is_aligned);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   output.clear();
 
   msg_info.trans_id = 1;
@@ -233,7 +234,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_out_of_order) {
   EXPECT_EQ(aligner.PushAndAlignData(7, tensor_with_header, output, info, is_aligned), SUCCESS);
   ASSERT_EQ(output.size(), 2);
   EXPECT_TRUE(is_aligned);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
 }
 
 TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
@@ -265,7 +266,7 @@ TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
   bool is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   msg_info.trans_id = 2;
   TensorWithHeader tensor_with_header1{};
@@ -274,7 +275,7 @@ TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
   is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header1), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   msg_info.trans_id = 3;
   TensorWithHeader tensor_with_header2{};
@@ -283,7 +284,7 @@ TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
   is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header2), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
 
   msg_info.trans_id = 4;
   TensorWithHeader tensor_with_header3{};
@@ -292,7 +293,7 @@ TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
   is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header3), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
 
   msg_info.trans_id = 5;
   TensorWithHeader tensor_with_header4{};
@@ -301,13 +302,13 @@ TEST_F(DataFlowDataAlignerTest, ignore_trans_id) {
   is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header4), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
-  EXPECT_EQ(aligner.cache_nums_[0], 3);
-  EXPECT_EQ(aligner.cache_nums_[1], 0);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
+  EXPECT_EQ(aligner.GetCacheNums()[0], 3);
+  EXPECT_EQ(aligner.GetCacheNums()[1], 0);
   aligner.ClearCacheByTransId(3);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
-  EXPECT_EQ(aligner.cache_nums_[0], 2);
-  EXPECT_EQ(aligner.cache_nums_[1], 0);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
+  EXPECT_EQ(aligner.GetCacheNums()[0], 2);
+  EXPECT_EQ(aligner.GetCacheNums()[1], 0);
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop) {
@@ -340,7 +341,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop) {
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header1), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
   // repeat trans id and data label just as one group
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   bool has_output = false;
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -348,7 +349,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop) {
   EXPECT_FALSE(has_output);
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 2;
   msg_info.data_label = 0;
   constexpr uint64_t expect_data1 = 7777;
@@ -359,7 +360,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop) {
   tensor_with_header2.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(7, std::move(tensor_with_header2), output, info, is_aligned), SUCCESS);
 
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
   EXPECT_TRUE(output.empty());
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -373,19 +374,19 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop) {
   tensor_with_header3.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header3), output, info, is_aligned), SUCCESS);
   ASSERT_EQ(output.size(), 0);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   ASSERT_EQ(output.size(), 1);
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
 
   output.clear();
   has_output = false;
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   ASSERT_EQ(output.size(), 1);
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
@@ -416,7 +417,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
   EXPECT_EQ(aligner.PushAndAlignData(6, tensor_with_header, output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
   // repeat trans id and data label just as one group
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   bool has_output = false;
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -424,7 +425,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
   EXPECT_FALSE(has_output);
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 2;
   msg_info.data_label = 0;
   GeTensor data1;
@@ -432,7 +433,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
   tensor_with_header.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(7, tensor_with_header, output, info, is_aligned), SUCCESS);
 
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
   EXPECT_TRUE(output.empty());
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -445,13 +446,13 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
   tensor_with_header.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(6, tensor_with_header, output, info, is_aligned), SUCCESS);
   ASSERT_EQ(output.size(), 0);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   // null data output is empty
   ASSERT_EQ(output.size(), 0);
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
 
   output.clear();
   has_output = false;
@@ -459,7 +460,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_no_drop_null_data) {
   // null data output is empty
   ASSERT_EQ(output.size(), 0);
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
@@ -487,7 +488,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
   bool is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   TensorWithHeader tensor_with_header1{};
   tensor_with_header1.tensor = data0;
@@ -495,7 +496,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header1), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
   // repeat trans id and data label only count 1.
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   bool has_output = true;
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -503,7 +504,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
   EXPECT_FALSE(has_output);
 
   EXPECT_EQ(aligner.SelectNextQueueIdx(), 7);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   msg_info.trans_id = 2;
   msg_info.data_label = 0;
   constexpr uint64_t expect_data1 = 7777;
@@ -514,7 +515,7 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
   tensor_with_header2.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(7, std::move(tensor_with_header2), output, info, is_aligned), SUCCESS);
 
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
   EXPECT_TRUE(output.empty());
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
@@ -527,16 +528,16 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_limit_drop) {
   tensor_with_header3.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header3), output, info, is_aligned), SUCCESS);
   ASSERT_EQ(output.size(), 0);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 3);
+  EXPECT_EQ(aligner.GetCacheSize(), 3);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   // drop data no return data
   ASSERT_EQ(output.size(), 0);
   EXPECT_FALSE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 2);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
   aligner.ClearCache();
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<std::size_t>({0, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<std::size_t>({0, 0}));
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_time_no_drop) {
@@ -567,33 +568,33 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_time_no_drop) {
   EXPECT_FALSE(has_output);
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
   TensorWithHeader tensor_with_header1{};
   tensor_with_header1.tensor = data0;
   tensor_with_header1.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header1), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_TRUE(output.empty());
   EXPECT_FALSE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({2, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({2, 0}));
 
-  aligner.wait_align_data_.begin()->second.start_time_ -= 2000ms;
+  aligner.GetShard(1).Find({1, 0})->start_time_ -= 2000ms;
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_FALSE(output.empty());
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({1, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({1, 0}));
   output.clear();
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_FALSE(output.empty());
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({0, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({0, 0}));
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_time_no_drop_null_data) {
@@ -623,35 +624,35 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_time_no_drop_null_data) {
   EXPECT_FALSE(has_output);
   EXPECT_EQ(aligner.PushAndAlignData(6, tensor_with_header, output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   tensor_with_header.tensor = data0;
   tensor_with_header.msg_info = msg_info;
   EXPECT_EQ(aligner.PushAndAlignData(6, tensor_with_header, output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_TRUE(output.empty());
   EXPECT_FALSE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({2, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({2, 0}));
 
-  aligner.wait_align_data_.begin()->second.start_time_ -= 2000ms;
+  aligner.GetShard(1).Find({1, 0})->start_time_ -= 2000ms;
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   // null data without output
   EXPECT_TRUE(output.empty());
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({1, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({1, 0}));
   output.clear();
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   // null data without output
   EXPECT_TRUE(output.empty());
   EXPECT_TRUE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({0, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({0, 0}));
 }
 
 TEST_F(DataFlowDataAlignerTest, normal_align_over_time_drop) {
@@ -684,19 +685,132 @@ TEST_F(DataFlowDataAlignerTest, normal_align_over_time_drop) {
   bool is_aligned = false;
   EXPECT_EQ(aligner.PushAndAlignData(6, std::move(tensor_with_header), output, info, is_aligned), SUCCESS);
   EXPECT_TRUE(output.empty());
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_TRUE(output.empty());
   EXPECT_FALSE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 1);
+  EXPECT_EQ(aligner.GetCacheSize(), 1);
 
-  aligner.wait_align_data_.begin()->second.start_time_ -= 2000ms;
+  aligner.GetShard(1).Find({1, 0})->start_time_ -= 2000ms;
 
   EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
   EXPECT_TRUE(output.empty());
   EXPECT_FALSE(has_output);
-  EXPECT_EQ(aligner.wait_align_data_.size(), 0);
-  EXPECT_EQ(aligner.cache_nums_, std::vector<size_t>({0, 0}));
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({0, 0}));
+}
+namespace {
+TensorWithHeader MakeTensorWithHeader(uint64_t trans_id, uint32_t data_label) {
+  TensorWithHeader tensor_with_header{};
+  tensor_with_header.msg_info.trans_id = trans_id;
+  tensor_with_header.msg_info.data_label = data_label;
+  tensor_with_header.msg_info.data_flag = kNullDataFlagBit;
+  return tensor_with_header;
+}
+}  // namespace
+
+TEST_F(DataFlowDataAlignerTest, align_many_trans_id_out_of_order) {
+  std::vector<uint32_t> queue_idxes{6, 7, 8};
+  InputAlignAttrs input_align_attrs{};
+  input_align_attrs.align_max_cache_num = 10000;
+  input_align_attrs.drop_when_not_align = true;
+  input_align_attrs.align_timeout = -1;
+  DataFlowDataAligner aligner(queue_idxes, input_align_attrs, nullptr);
+  constexpr uint64_t kTransNum = 2000;
+  std::vector<GeTensor> output;
+  DataFlowInfo info;
+  bool is_aligned = false;
+  // 每个trans id有两个data label，哈希表需要多次扩容
+  for (uint64_t trans_id = 0; trans_id < kTransNum; ++trans_id) {
+    for (uint32_t data_label = 0; data_label < 2; ++data_label) {
+      EXPECT_EQ(aligner.PushAndAlignData(6, MakeTensorWithHeader(trans_id, data_label), output, info, is_aligned),
+                SUCCESS);
+      EXPECT_FALSE(is_aligned);
+      EXPECT_EQ(aligner.PushAndAlignData(7, MakeTensorWithHeader(trans_id, data_label), output, info, is_aligned),
+                SUCCESS);
+      EXPECT_FALSE(is_aligned);
+    }
+  }
+  EXPECT_EQ(aligner.GetCacheSize(), kTransNum * 2);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({kTransNum * 2, kTransNum * 2, 0}));
+  EXPECT_EQ(aligner.SelectNextQueueIdx(), 8);
+
+  // 按与写入相反的顺序完成对齐，删除时哈希表中的其他缓存仍然能找到
+  size_t aligned_num = 0;
+  for (uint64_t trans_id = kTransNum; trans_id > 0; --trans_id) {
+    if ((trans_id % 5) == 0) {
+      aligner.ClearCacheByTransId(trans_id - 1);
+      continue;
+    }
+    EXPECT_EQ(aligner.PushAndAlignData(8, MakeTensorWithHeader(trans_id - 1, 1), output, info, is_aligned), SUCCESS);
+    EXPECT_TRUE(is_aligned);
+    ++aligned_num;
+  }
+  const size_t cleared_num = kTransNum / 5;
+  EXPECT_EQ(aligner.GetCacheSize(), kTransNum - cleared_num);
+  for (uint64_t trans_id = 0; trans_id < kTransNum; ++trans_id) {
+    const bool cleared = ((trans_id + 1) % 5) == 0;
+    EXPECT_EQ(aligner.GetShard(trans_id).Find({trans_id, 0}) != nullptr, !cleared);
+    EXPECT_EQ(aligner.GetShard(trans_id).Find({trans_id, 1}), nullptr);
+  }
+  EXPECT_EQ(aligned_num, kTransNum - cleared_num);
+  aligner.ClearCache();
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({0, 0, 0}));
+}
+
+TEST_F(DataFlowDataAlignerTest, over_limit_take_in_arrival_order) {
+  std::vector<uint32_t> queue_idxes{6, 7};
+  InputAlignAttrs input_align_attrs{};
+  input_align_attrs.align_max_cache_num = 2;
+  input_align_attrs.drop_when_not_align = false;
+  input_align_attrs.align_timeout = -1;
+  DataFlowDataAligner aligner(queue_idxes, input_align_attrs, nullptr);
+  std::vector<GeTensor> output;
+  DataFlowInfo info;
+  bool is_aligned = false;
+  for (uint64_t trans_id : {30, 10, 20}) {
+    EXPECT_EQ(aligner.PushAndAlignData(6, MakeTensorWithHeader(trans_id, 0), output, info, is_aligned), SUCCESS);
+  }
+  bool has_output = false;
+  EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
+  EXPECT_TRUE(has_output);
+  EXPECT_EQ(info.GetTransactionId(), 30);
+  EXPECT_EQ(aligner.GetCacheSize(), 2);
+  EXPECT_EQ(aligner.GetShard(30).Find({30, 0}), nullptr);
+  has_output = false;
+  EXPECT_EQ(aligner.TryTakeExpiredOrOverLimitData(output, info, has_output), SUCCESS);
+  EXPECT_FALSE(has_output);
+}
+
+TEST_F(DataFlowDataAlignerTest, push_concurrently) {
+  std::vector<uint32_t> queue_idxes{6, 7};
+  InputAlignAttrs input_align_attrs{};
+  input_align_attrs.align_max_cache_num = 100000;
+  input_align_attrs.drop_when_not_align = true;
+  input_align_attrs.align_timeout = -1;
+  DataFlowDataAligner aligner(queue_idxes, input_align_attrs, nullptr);
+  constexpr uint64_t kTransNum = 1000;
+  std::atomic<size_t> aligned_num{0};
+  auto push_func = [&aligner, &aligned_num](uint32_t queue_idx) {
+    std::vector<GeTensor> output;
+    DataFlowInfo info;
+    bool is_aligned = false;
+    for (uint64_t trans_id = 0; trans_id < kTransNum; ++trans_id) {
+      EXPECT_EQ(aligner.PushAndAlignData(queue_idx, MakeTensorWithHeader(trans_id, 0), output, info, is_aligned),
+                SUCCESS);
+      if (is_aligned) {
+        ++aligned_num;
+      }
+    }
+  };
+  std::thread push_thread0(push_func, 6);
+  std::thread push_thread1(push_func, 7);
+  push_thread0.join();
+  push_thread1.join();
+  EXPECT_EQ(aligned_num.load(), kTransNum);
+  EXPECT_EQ(aligner.GetCacheSize(), 0);
+  EXPECT_EQ(aligner.GetCacheNums(), std::vector<size_t>({0, 0}));
 }
 }  // namespace ge
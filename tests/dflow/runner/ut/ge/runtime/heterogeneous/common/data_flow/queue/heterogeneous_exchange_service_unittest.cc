@@ -138,8 +138,8 @@ TEST_F(HeterogeneousExchangeServiceTest, TestEnqueueAndDequeue) {
 
 TEST_F(HeterogeneousExchangeServiceTest, TestEnqueueAndDequeueTensor) {
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   uint32_t client_queue_id = 1;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
@@ -203,8 +203,8 @@ TEST_F(HeterogeneousExchangeServiceTest, TestEnqueueAndDequeueFail) {
   MockRuntime mock_runtime;
   RuntimeStub::Install(&mock_runtime);
   HeterogeneousExchangeService exchange_service;
-  exchange_service.subscribed_enqueues_[0] = false;
-  exchange_service.subscribed_dequeues_[0] = false;
+  exchange_service.subscribed_enqueues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_dequeues_[0] = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
   uint32_t queue_id = 0;
   ASSERT_EQ(exchange_service.CreateQueue(0, "queue", 2, RT_MQ_MODE_PULL, queue_id), SUCCESS);
   uint8_t buf[128];
@@ -217,6 +217,91 @@ TEST_F(HeterogeneousExchangeServiceTest, TestEnqueueAndDequeueFail) {
   exchange_service.Finalize();
   RuntimeStub::UnInstall(&mock_runtime);
 }
+
+TEST_F(HeterogeneousExchangeServiceTest, TestMbufsEnqueueAndDequeue) {
+  HeterogeneousExchangeService exchange_service;
+  const uint32_t queue_id = 1001U;
+  std::vector<rtMbufPtr_t> m_bufs(3U, nullptr);
+  for (auto &m_buf : m_bufs) {
+    ASSERT_EQ(rtMbufAlloc(&m_buf, 128U), RT_ERROR_NONE);
+  }
+  GE_MAKE_GUARD(free_mbufs, [&m_bufs]() {
+    for (auto &m_buf : m_bufs) {
+      rtMbufFree(m_buf);
+    }
+  });
+  size_t enqueued_num = 0U;
+  ASSERT_EQ(exchange_service.EnqueueMbufs(0, queue_id, m_bufs, 1000, enqueued_num), SUCCESS);
+  EXPECT_EQ(enqueued_num, 3U);
+  EXPECT_EQ(exchange_service.subscribed_enqueues_.count(queue_id), 1U);
+
+  std::vector<rtMbufPtr_t> out_m_bufs;
+  ASSERT_EQ(exchange_service.DequeueMbufs(0, queue_id, 2U, 1000, out_m_bufs), SUCCESS);
+  EXPECT_EQ(out_m_bufs.size(), 2U);
+  // 取到数据后不再等待，只返回队列中现有的
+  ASSERT_EQ(exchange_service.DequeueMbufs(0, queue_id, 4U, 1000, out_m_bufs), SUCCESS);
+  EXPECT_EQ(out_m_bufs.size(), 1U);
+  EXPECT_NE(exchange_service.DequeueMbufs(0, queue_id, 4U, 0, out_m_bufs), SUCCESS);
+  EXPECT_TRUE(out_m_bufs.empty());
+  EXPECT_EQ(exchange_service.DequeueMbufs(0, queue_id, 0U, 0, out_m_bufs), PARAM_INVALID);
+
+  std::vector<rtMbufPtr_t> empty_m_bufs;
+  EXPECT_EQ(exchange_service.EnqueueMbufs(0, queue_id, empty_m_bufs, 0, enqueued_num), SUCCESS);
+  EXPECT_EQ(enqueued_num, 0U);
+  exchange_service.Finalize();
+}
+
+TEST_F(HeterogeneousExchangeServiceTest, TestMbufsEnqueueFull) {
+  MockRuntime mock_runtime;
+  RuntimeStub::Install(&mock_runtime);
+  GE_MAKE_GUARD(recover, [&mock_runtime]() { RuntimeStub::UnInstall(&mock_runtime); });
+  HeterogeneousExchangeService exchange_service;
+  const uint32_t queue_id = 1002U;
+  std::vector<rtMbufPtr_t> m_bufs(2U, nullptr);
+  for (auto &m_buf : m_bufs) {
+    ASSERT_EQ(rtMbufAlloc(&m_buf, 128U), RT_ERROR_NONE);
+  }
+  size_t enqueued_num = 0U;
+  EXPECT_NE(exchange_service.EnqueueMbufs(0, queue_id, m_bufs, 1, enqueued_num), SUCCESS);
+  // 未入队的mbuf所有权仍属于调用者
+  EXPECT_EQ(enqueued_num, 0U);
+  for (auto &m_buf : m_bufs) {
+    rtMbufFree(m_buf);
+  }
+  std::vector<rtMbufPtr_t> out_m_bufs;
+  EXPECT_NE(exchange_service.DequeueMbufs(0, queue_id, 2U, 1, out_m_bufs), SUCCESS);
+  EXPECT_TRUE(out_m_bufs.empty());
+  exchange_service.Finalize();
+}
+
+TEST_F(HeterogeneousExchangeServiceTest, TestQueueEventNotifyPerQueue) {
+  HeterogeneousExchangeService exchange_service;
+  auto enqueue_state = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  auto dequeue_state = std::make_shared<HeterogeneousExchangeService::QueueEventState>();
+  exchange_service.subscribed_enqueues_[1] = enqueue_state;
+  exchange_service.subscribed_dequeues_[1] = dequeue_state;
+  // 未订阅的队列不会被加入订阅表
+  exchange_service.ProcessF2NFEvent(2);
+  exchange_service.ProcessEmptyToNotEmptyEvent(2);
+  EXPECT_EQ(enqueue_state->event_seq.load(), 0U);
+  EXPECT_EQ(dequeue_state->event_seq.load(), 0U);
+  EXPECT_EQ(exchange_service.subscribed_enqueues_.count(2), 0U);
+  EXPECT_EQ(exchange_service.subscribed_dequeues_.count(2), 0U);
+  exchange_service.ProcessF2NFEvent(1);
+  exchange_service.ProcessEmptyToNotEmptyEvent(1);
+  EXPECT_EQ(enqueue_state->event_seq.load(), 1U);
+  EXPECT_EQ(dequeue_state->event_seq.load(), 1U);
+
+  int32_t left_wait_time = 10;
+  // 记录的事件序号已变化，不消耗等待时间
+  EXPECT_EQ(HeterogeneousExchangeService::WaitEnqueueEvent(1, *dequeue_state, 0U, left_wait_time), SUCCESS);
+  EXPECT_EQ(left_wait_time, 10);
+  EXPECT_EQ(HeterogeneousExchangeService::WaitEnqueueEvent(1, *dequeue_state, 1U, left_wait_time), SUCCESS);
+  EXPECT_EQ(left_wait_time, 0);
+  left_wait_time = 10;
+  EXPECT_EQ(HeterogeneousExchangeService::WaitF2NFEvent(*enqueue_state, 1U, left_wait_time), SUCCESS);
+  EXPECT_EQ(left_wait_time, 0);
+}
 TEST_F(HeterogeneousExchangeServiceTest, TestHeterogeneousProfiler) {
   setenv("GE_PROFILING_TO_STD_OUT", "2", true);
   uint32_t queue_id = 0;
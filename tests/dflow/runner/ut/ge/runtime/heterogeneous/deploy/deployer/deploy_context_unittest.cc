@@ -394,6 +394,50 @@ TEST_F(DeployContextTest, TestProcessVarManagerAndSharedInfo) {
   HeterogeneousExchangeService::GetInstance().Finalize();
 }
 
+TEST_F(DeployContextTest, TestProcessSharedContentManifest) {
+  DeployContext context;
+  const int32_t device_id = 0;
+  deployer::MultiVarManagerRequest info;
+  info.add_device_ids(device_id);
+  auto var_manager_info = info.mutable_multi_var_manager_info()->add_var_manager_info();
+  var_manager_info->set_device_id(device_id);
+  var_manager_info->set_session_id(1);
+  var_manager_info->set_use_max_mem_size(128);
+  ASSERT_EQ(context.ProcessMultiVarManager(info), SUCCESS);
+  auto var_manager = context.GetVarManager(device_id, 1);
+  ASSERT_TRUE(var_manager != nullptr);
+  // 模拟device 0上的node已接收完成
+  deployer::SharedContentDescription shared_content_desc;
+  shared_content_desc.set_session_id(1);
+  shared_content_desc.set_node_name("node");
+  shared_content_desc.set_total_length(4);
+  var_manager->shared_content_descs_["node"] = shared_content_desc;
+  var_manager->AddContentDigest("digest", "node");
+
+  deployer::SharedContentManifestRequest request;
+  auto item = request.add_items();
+  *item->mutable_shared_content_desc() = shared_content_desc;
+  item->mutable_shared_content_desc()->set_node_name("node_1");
+  item->set_content_digest("digest");
+  item->add_device_ids(device_id);
+  item->add_device_ids(1);  // device 1上没有var manager
+  item = request.add_items();
+  *item->mutable_shared_content_desc() = shared_content_desc;
+  item->mutable_shared_content_desc()->set_node_name("node_2");
+  item->set_content_digest("other_digest");
+  item->add_device_ids(device_id);
+
+  deployer::DeployerResponse response;
+  ASSERT_EQ(context.ProcessSharedContentManifest(request, response), SUCCESS);
+  const auto &held_items = response.shared_content_manifest_response().held_items();
+  ASSERT_EQ(held_items.size(), 1);
+  EXPECT_EQ(held_items[0].index(), 0U);
+  ASSERT_EQ(held_items[0].device_ids_size(), 1);
+  EXPECT_EQ(held_items[0].device_ids(0), device_id);
+  EXPECT_EQ(var_manager->GetSharedContentDescs().count("node_1"), 1U);
+  EXPECT_EQ(var_manager->GetSharedContentDescs().count("node_2"), 0U);
+}
+
 TEST_F(DeployContextTest, TestProcessVarManagerAndSharedInfoAndSyncMem) {
   DeployContext context;
   deployer::DeployerResponse response;
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "deploy/deployer/deploy_task_scheduler.h"
+
+namespace ge {
+class DeployTaskSchedulerTest : public testing::Test {
+ protected:
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+TEST_F(DeployTaskSchedulerTest, RunInDependencyOrder) {
+  DeployTaskScheduler scheduler("test", 4U);
+  std::mutex mu;
+  std::vector<std::string> orders;
+  auto record = [&mu, &orders](const std::string &name) -> Status {
+    std::lock_guard<std::mutex> lk(mu);
+    orders.emplace_back(name);
+    return SUCCESS;
+  };
+  size_t cfg_0 = 0U;
+  size_t cfg_1 = 0U;
+  size_t route_0 = 0U;
+  size_t plan_0 = 0U;
+  ASSERT_EQ(scheduler.AddTask("cfg", "node_0", [&]() { return record("cfg_0"); }, {}, cfg_0), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("cfg", "node_1", [&]() { return record("cfg_1"); }, {}, cfg_1), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("route", "node_0", [&]() { return record("route_0"); }, {cfg_0}, route_0), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("plan", "node_0", [&]() { return record("plan_0"); }, {route_0, cfg_1}, plan_0),
+            SUCCESS);
+  EXPECT_EQ(scheduler.Run(), SUCCESS);
+  ASSERT_EQ(orders.size(), 4U);
+  auto index_of = [&orders](const std::string &name) {
+    return std::find(orders.begin(), orders.end(), name) - orders.begin();
+  };
+  EXPECT_LT(index_of("cfg_0"), index_of("route_0"));
+  EXPECT_LT(index_of("route_0"), index_of("plan_0"));
+  EXPECT_LT(index_of("cfg_1"), index_of("plan_0"));
+
+  const auto &stats = scheduler.GetPhaseStats();
+  ASSERT_EQ(stats.size(), 3U);
+  EXPECT_EQ(stats.at("cfg").task_num, 2U);
+  EXPECT_EQ(stats.at("route").task_num, 1U);
+  EXPECT_EQ(stats.at("plan").task_num, 1U);
+}
+
+TEST_F(DeployTaskSchedulerTest, InflightNumBounded) {
+  constexpr size_t kMaxInflightNum = 2U;
+  DeployTaskScheduler scheduler("test", kMaxInflightNum);
+  std::atomic<size_t> inflight_num{0U};
+  std::atomic<size_t> max_inflight_num{0U};
+  for (size_t i = 0U; i < 8U; ++i) {
+    size_t task_id = 0U;
+    ASSERT_EQ(scheduler.AddTask("transfer", "device_" + std::to_string(i),
+                                [&]() -> Status {
+                                  const auto current = ++inflight_num;
+                                  auto max_num = max_inflight_num.load();
+                                  while ((current > max_num) &&
+                                         (!max_inflight_num.compare_exchange_weak(max_num, current))) {
+                                  }
+                                  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                                  --inflight_num;
+                                  return SUCCESS;
+                                },
+                                {}, task_id),
+              SUCCESS);
+  }
+  EXPECT_EQ(scheduler.Run(), SUCCESS);
+  EXPECT_LE(max_inflight_num.load(), kMaxInflightNum);
+  const auto &stat = scheduler.GetPhaseStats().at("transfer");
+  EXPECT_EQ(stat.task_num, 8U);
+  EXPECT_GE(stat.total_cost_us, stat.max_cost_us);
+  EXPECT_GE(stat.span_us, stat.max_cost_us);
+}
+
+TEST_F(DeployTaskSchedulerTest, FailedTaskStopDependents) {
+  DeployTaskScheduler scheduler("test", 1U);
+  std::atomic<size_t> run_num{0U};
+  size_t failed_task = 0U;
+  size_t dependent_task = 0U;
+  size_t independent_task = 0U;
+  auto failed_func = [&run_num]() -> Status {
+    ++run_num;
+    return PARAM_INVALID;
+  };
+  auto success_func = [&run_num]() -> Status {
+    ++run_num;
+    return SUCCESS;
+  };
+  ASSERT_EQ(scheduler.AddTask("cfg", "node_0", failed_func, {}, failed_task), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("route", "node_0", success_func, {failed_task}, dependent_task), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("cfg", "node_1", success_func, {}, independent_task), SUCCESS);
+  EXPECT_EQ(scheduler.Run(), PARAM_INVALID);
+  // 窗口为1，失败后不再调度新任务
+  EXPECT_EQ(run_num.load(), 1U);
+  EXPECT_EQ(scheduler.GetPhaseStats().count("route"), 0U);
+}
+
+TEST_F(DeployTaskSchedulerTest, AddTaskInvalid) {
+  DeployTaskScheduler scheduler("test", 4U);
+  size_t task_id = 0U;
+  EXPECT_NE(scheduler.AddTask("cfg", "node_0", nullptr, {}, task_id), SUCCESS);
+  // 只能依赖已添加的任务
+  EXPECT_NE(scheduler.AddTask("cfg", "node_0", []() { return SUCCESS; }, {0U}, task_id), SUCCESS);
+  ASSERT_EQ(scheduler.AddTask("cfg", "node_0", []() { return SUCCESS; }, {}, task_id), SUCCESS);
+  EXPECT_EQ(task_id, 0U);
+  EXPECT_NE(scheduler.AddTask("route", "node_0", []() { return SUCCESS; }, {1U}, task_id), SUCCESS);
+  EXPECT_EQ(scheduler.Run(), SUCCESS);
+}
+
+TEST_F(DeployTaskSchedulerTest, RunEmpty) {
+  DeployTaskScheduler scheduler("test", 0U);
+  EXPECT_EQ(scheduler.Run(), SUCCESS);
+  EXPECT_TRUE(scheduler.GetPhaseStats().empty());
+}
+}  // namespace ge
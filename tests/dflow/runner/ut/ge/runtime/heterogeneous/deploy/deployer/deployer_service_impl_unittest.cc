@@ -231,6 +231,17 @@ TEST_F(DeployerServiceImplTest, SharedContentProcess) {
   EXPECT_NE(response.error_code(), SUCCESS);
 }
 
+TEST_F(DeployerServiceImplTest, SharedContentManifestProcess) {
+  deployer::DeployerRequest request;
+  deployer::DeployerResponse response;
+  DeployContext context;
+  request.set_type(deployer::kQuerySharedContent);
+  request.mutable_shared_content_manifest_request()->add_items()->add_device_ids(0);
+  DeployerServiceImpl::SharedContentManifestProcess(context, request, response);
+  EXPECT_EQ(response.error_code(), SUCCESS);
+  EXPECT_EQ(response.shared_content_manifest_response().held_items_size(), 0);
+}
+
 TEST_F(DeployerServiceImplTest, InitProcessResourceProcess) {
   ge::DeployerServiceImpl deployer_service;
   deployer::DeployerRequest request;
@@ -73,4 +73,39 @@ TEST_F(DeployerVarManagerTest, TestProcessVarManager) {
 
   deployer_var_manager.Finalize();
 }
+
+TEST_F(DeployerVarManagerTest, TestReuseSharedContent) {
+  DeployerVarManager deployer_var_manager;
+  deployer::VarManagerInfo var_info;
+  var_info.set_use_max_mem_size(12800);
+  var_info.set_session_id(1);
+  ASSERT_EQ(deployer_var_manager.Initialize(var_info), SUCCESS);
+
+  deployer::SharedContentDescription shared_content_desc;
+  shared_content_desc.set_session_id(1);
+  shared_content_desc.set_node_name("node");
+  shared_content_desc.set_total_length(8);
+  shared_content_desc.set_current_offset(0);
+  // 未接收完成时不记录摘要
+  ASSERT_EQ(deployer_var_manager.ProcessSharedContent(shared_content_desc, 4, 0, 0), SUCCESS);
+  deployer_var_manager.AddContentDigest("digest", "node");
+  auto new_desc = shared_content_desc;
+  new_desc.set_node_name("node_1");
+  EXPECT_FALSE(deployer_var_manager.ReuseSharedContent("digest", new_desc));
+
+  ASSERT_EQ(deployer_var_manager.ProcessSharedContent(shared_content_desc, 4, 4, 0), SUCCESS);
+  deployer_var_manager.AddContentDigest("digest", "node");
+  EXPECT_TRUE(deployer_var_manager.ReuseSharedContent("digest", new_desc));
+  ASSERT_EQ(deployer_var_manager.GetSharedContentDescs().count("node_1"), 1U);
+  EXPECT_EQ(deployer_var_manager.GetSharedContentDescs().at("node_1").total_length(), 8U);
+  // 摘要不同或长度不一致时不能复用
+  new_desc.set_node_name("node_2");
+  EXPECT_FALSE(deployer_var_manager.ReuseSharedContent("other_digest", new_desc));
+  EXPECT_FALSE(deployer_var_manager.ReuseSharedContent("", new_desc));
+  new_desc.set_total_length(4);
+  EXPECT_FALSE(deployer_var_manager.ReuseSharedContent("digest", new_desc));
+  EXPECT_EQ(deployer_var_manager.GetSharedContentDescs().count("node_2"), 0U);
+
+  deployer_var_manager.Finalize();
+}
 }  // namespace ge
@@ -8,7 +8,9 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <cstdlib>
@@ -337,6 +339,48 @@ TEST_F(MasterModelDeployerTest, TestDeployRemoteVarManager) {
   ASSERT_EQ(flow_model_sender.DeployRemoteVarManager(deploy_state), SUCCESS);
 }
 
+TEST_F(MasterModelDeployerTest, TestTransferPlans) {
+  DeployState deploy_state;
+  deploy_state.SetDeployPlan(StubModels::BuildSimpleDeployPlan());
+  deploy_state.AddFlowRoutePlanToDeploy(1, deployer::FlowRoutePlan());
+
+  map<std::string, std::string> sess_options = ge::GetThreadLocalContext().GetAllSessionOptions();
+  GE_MAKE_GUARD(recover_sess_cfg, [&sess_options]() { GetThreadLocalContext().SetSessionOption(sess_options); });
+  map<std::string, std::string> options{{"TestSessionOption", "TestTransferPlans"}};
+  GetThreadLocalContext().SetSessionOption(options);
+
+  std::mutex mu;
+  std::vector<deployer::DeployerRequestType> request_types;
+  size_t context_missed_num = 0U;
+  auto stub_func = [&mu, &request_types, &context_missed_num](deployer::DeployerRequest &request,
+                                                              deployer::DeployerResponse &response) -> Status {
+    // 任务在调度器的线程池中执行，需要能取到调用线程的session option
+    std::string option_value;
+    (void)GetThreadLocalContext().GetOption("TestSessionOption", option_value);
+    std::lock_guard<std::mutex> lk(mu);
+    request_types.emplace_back(request.type());
+    if (option_value != "TestTransferPlans") {
+      ++context_missed_num;
+    }
+    response.set_error_code(SUCCESS);
+    return SUCCESS;
+  };
+  auto &remote_device = reinterpret_cast<stub::MockRemoteDeployer &>(*DeployerProxy::GetInstance().deployers_[1]);
+  EXPECT_CALL(remote_device, Process).WillRepeatedly(Invoke(stub_func));
+  ASSERT_EQ(FlowModelSender::TransferPlans(deploy_state), SUCCESS);
+  EXPECT_EQ(context_missed_num, 0U);
+  // 同一节点上FlowRoutePlan先于DeployPlan下发
+  const auto route_plan_it = std::find(request_types.cbegin(), request_types.cend(), deployer::kAddFlowRoutePlan);
+  const auto deploy_plan_it = std::find(request_types.cbegin(), request_types.cend(), deployer::kUpdateDeployPlan);
+  ASSERT_NE(route_plan_it, request_types.cend());
+  ASSERT_NE(deploy_plan_it, request_types.cend());
+  EXPECT_LT(route_plan_it - request_types.cbegin(), deploy_plan_it - request_types.cbegin());
+
+  // 任一任务失败时返回失败
+  EXPECT_CALL(remote_device, Process).WillRepeatedly(Return(FAILED));
+  EXPECT_NE(FlowModelSender::TransferPlans(deploy_state), SUCCESS);
+}
+
 TEST_F(MasterModelDeployerTest, TestDeployRemoteVarManagerWithFileConstant) {
   auto mock_runtime = std::make_shared<MockRuntime>();
   RuntimeStub::SetInstance(mock_runtime);
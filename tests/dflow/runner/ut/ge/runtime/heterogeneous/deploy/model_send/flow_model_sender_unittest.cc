@@ -132,4 +132,18 @@ TEST_F(FlowModelSenderTest, BuildDeployPlanOptions) {
   EXPECT_EQ(request.options().session_options_size(), 1);
   EXPECT_EQ(request.options().graph_options_size(), 1);
 }
+
+TEST_F(FlowModelSenderTest, GetContentDigestReuseWeightSha256) {
+  FlowModelSender flow_model_sender;
+  auto op_desc = MakeShared<OpDesc>("file_constant", "FileConstant");
+  ASSERT_NE(op_desc, nullptr);
+  // 文件不存在，只有复用节点上的摘要时才能成功
+  const std::string file_path = "./not_exist_file_constant.bin";
+  std::string digest;
+  EXPECT_NE(flow_model_sender.GetContentDigest(op_desc, file_path, 0U, 16U, digest), SUCCESS);
+
+  ASSERT_TRUE(AttrUtils::SetStr(op_desc, ATTR_NAME_WEIGHT_SHA256, "abcdef"));
+  ASSERT_EQ(flow_model_sender.GetContentDigest(op_desc, file_path, 0U, 16U, digest), SUCCESS);
+  EXPECT_EQ(digest, "w_abcdef_16");
+}
 }  // namespace ge
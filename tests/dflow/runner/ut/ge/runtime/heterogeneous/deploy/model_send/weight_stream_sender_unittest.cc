@@ -0,0 +1,298 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <future>
+#include <sstream>
+#include <gtest/gtest.h>
+#include "deploy/model_send/weight_stream_sender.h"
+#include "depends/helper_runtime/src/loopback_exchange_service.h"
+
+namespace ge {
+namespace {
+constexpr size_t kChunkSize = 64U * 1024U;
+constexpr int32_t kTimeout = 10 * 1000;
+
+std::string MakeContent(const size_t size) {
+  std::string content(size, '\0');
+  for (size_t i = 0U; i < size; ++i) {
+    content[i] = static_cast<char>((i * 131U + 7U) & 0xFFU);
+  }
+  return content;
+}
+
+// 模拟接收端：按分片头校验并拼接数据
+Status ReceiveAll(LoopbackExchangeService &exchange_service, const uint32_t queue_id, const uint64_t total_length,
+                  std::string &received, size_t &duplicated_num) {
+  WeightChunkChecker checker(total_length);
+  while (checker.GetReceivedLength() < total_length) {
+    LoopbackExchangeService::Message message;
+    GE_CHK_STATUS_RET_NOLOG(exchange_service.DequeueMessage(0, queue_id, message, kTimeout));
+    WeightChunkHead head{};
+    GE_CHK_BOOL_RET_STATUS(WeightChunkUtils::ParseHead(message.user_data, sizeof(message.user_data), head), FAILED,
+                           "chunk head not found");
+    auto result = WeightChunkChecker::Result::kAccepted;
+    GE_CHK_STATUS_RET_NOLOG(checker.Check(head, message.data.data(), message.data.size(), result));
+    if (result == WeightChunkChecker::Result::kDuplicated) {
+      ++duplicated_num;
+      continue;
+    }
+    GE_CHK_BOOL_RET_STATUS(result == WeightChunkChecker::Result::kAccepted, FAILED, "chunk is corrupted");
+    received.append(reinterpret_cast<const char *>(message.data.data()), message.data.size());
+  }
+  return SUCCESS;
+}
+
+// 模拟接收端处理一轮传输：按分片偏移写入received，返回crc校验失败的分片
+Status ReceiveOneRound(LoopbackExchangeService &exchange_service, const uint32_t queue_id,
+                       const std::vector<uint64_t> &resend_indices, std::string &received,
+                       std::vector<uint64_t> &failed_indices) {
+  WeightChunkChecker checker(received.size(), resend_indices);
+  while (!checker.IsFinished()) {
+    LoopbackExchangeService::Message message;
+    GE_CHK_STATUS_RET_NOLOG(exchange_service.DequeueMessage(0, queue_id, message, kTimeout));
+    WeightChunkHead head{};
+    GE_CHK_BOOL_RET_STATUS(WeightChunkUtils::ParseHead(message.user_data, sizeof(message.user_data), head), FAILED,
+                           "chunk head not found");
+    auto result = WeightChunkChecker::Result::kAccepted;
+    GE_CHK_STATUS_RET_NOLOG(checker.Check(head, message.data.data(), message.data.size(), result));
+    if (result == WeightChunkChecker::Result::kAccepted) {
+      (void)received.replace(head.chunk_offset, message.data.size(),
+                             reinterpret_cast<const char *>(message.data.data()), message.data.size());
+    }
+  }
+  failed_indices = checker.GetFailedChunks();
+  return SUCCESS;
+}
+}  // namespace
+
+class WeightStreamSenderTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_EQ(exchange_service_.CreateQueue(0, "transfer_file", 4U, 0U, queue_attr_.queue_id), SUCCESS);
+    queue_attr_.device_id = 0;
+    option_.chunk_size = kChunkSize;
+    option_.read_ahead_num = 2U;
+    option_.enqueue_timeout = kTimeout;
+  }
+  void TearDown() override {}
+
+  LoopbackExchangeService exchange_service_{4U};
+  DeployQueueAttr queue_attr_{};
+  WeightStreamOption option_;
+};
+
+TEST_F(WeightStreamSenderTest, Crc32) {
+  const std::string data = "123456789";
+  EXPECT_EQ(WeightChunkUtils::Crc32(data.data(), data.size()), 0xE3069283U);
+  EXPECT_EQ(WeightChunkUtils::Crc32(data.data(), 0U), 0U);
+  // 分段计算与整体计算结果一致
+  const auto content = MakeContent(1000U);
+  const auto crc = WeightChunkUtils::Crc32(content.data(), 333U);
+  EXPECT_EQ(WeightChunkUtils::Crc32(content.data() + 333U, content.size() - 333U, crc),
+            WeightChunkUtils::Crc32(content.data(), content.size()));
+}
+
+TEST_F(WeightStreamSenderTest, ComputeDigest) {
+  const auto content = MakeContent(3U * 1024U * 1024U + 17U);
+  std::stringstream ss(content + content);
+  std::string digest;
+  ASSERT_EQ(WeightChunkUtils::ComputeDigest(ss, content.size(), digest), SUCCESS);
+  // 计算完成后读位置不变
+  EXPECT_EQ(ss.tellg(), 0);
+  std::string same_digest;
+  ss.seekg(content.size());
+  ASSERT_EQ(WeightChunkUtils::ComputeDigest(ss, content.size(), same_digest), SUCCESS);
+  EXPECT_EQ(same_digest, digest);
+  EXPECT_EQ(ss.tellg(), static_cast<std::streamoff>(content.size()));
+
+  auto modified = content;
+  modified[2U * 1024U * 1024U] ^= 0x1;
+  std::stringstream modified_ss(modified);
+  std::string modified_digest;
+  ASSERT_EQ(WeightChunkUtils::ComputeDigest(modified_ss, modified.size(), modified_digest), SUCCESS);
+  EXPECT_NE(modified_digest, digest);
+  // 长度不同
+  std::stringstream short_ss(content);
+  std::string short_digest;
+  ASSERT_EQ(WeightChunkUtils::ComputeDigest(short_ss, content.size() - 1U, short_digest), SUCCESS);
+  EXPECT_NE(short_digest, digest);
+  // 流长度不足
+  std::stringstream shorter_ss(content);
+  EXPECT_NE(WeightChunkUtils::ComputeDigest(shorter_ss, content.size() + 1U, short_digest), SUCCESS);
+  // SHA-256标准测试向量
+  std::stringstream abc_ss("abc");
+  std::string abc_digest;
+  ASSERT_EQ(WeightChunkUtils::ComputeDigest(abc_ss, 3U, abc_digest), SUCCESS);
+  EXPECT_EQ(abc_digest, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad_3");
+}
+
+TEST_F(WeightStreamSenderTest, SendInChunks) {
+  const auto content = MakeContent(kChunkSize * 16U + 123U);
+  std::stringstream ss(content);
+  std::string received;
+  size_t duplicated_num = 0U;
+  auto fut = std::async(std::launch::async, [&]() {
+    return ReceiveAll(exchange_service_, queue_attr_.queue_id, content.size(), received, duplicated_num);
+  });
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_EQ(sender.Send(ss, content.size(), queue_attr_), SUCCESS);
+  EXPECT_EQ(fut.get(), SUCCESS);
+  EXPECT_EQ(received, content);
+  EXPECT_EQ(duplicated_num, 0U);
+  EXPECT_EQ(sender.GetStat().chunk_num, 17U);
+  EXPECT_EQ(sender.GetStat().resend_num, 0U);
+  EXPECT_EQ(sender.GetStat().total_length, content.size());
+}
+
+TEST_F(WeightStreamSenderTest, SendFromCurrentPosition) {
+  const auto content = MakeContent(kChunkSize * 3U);
+  const size_t offset = 1000U;
+  const size_t length = kChunkSize + 1U;
+  std::stringstream ss(content);
+  ss.seekg(offset);
+  std::string received;
+  size_t duplicated_num = 0U;
+  auto fut = std::async(std::launch::async, [&]() {
+    return ReceiveAll(exchange_service_, queue_attr_.queue_id, length, received, duplicated_num);
+  });
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_EQ(sender.Send(ss, length, queue_attr_), SUCCESS);
+  EXPECT_EQ(fut.get(), SUCCESS);
+  EXPECT_EQ(received, content.substr(offset, length));
+}
+
+TEST_F(WeightStreamSenderTest, ResendFailedChunkOnly) {
+  const auto content = MakeContent(kChunkSize * 4U);
+  std::stringstream ss(content);
+  std::string received;
+  size_t duplicated_num = 0U;
+  auto fut = std::async(std::launch::async, [&]() {
+    return ReceiveAll(exchange_service_, queue_attr_.queue_id, content.size(), received, duplicated_num);
+  });
+  exchange_service_.InjectEnqueueFailure(2U);
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_EQ(sender.Send(ss, content.size(), queue_attr_), SUCCESS);
+  EXPECT_EQ(fut.get(), SUCCESS);
+  EXPECT_EQ(received, content);
+  EXPECT_EQ(sender.GetStat().chunk_num, 4U);
+  EXPECT_EQ(sender.GetStat().resend_num, 2U);
+}
+
+TEST_F(WeightStreamSenderTest, ResendCorruptedChunkOnly) {
+  const auto content = MakeContent(kChunkSize * 8U + 11U);
+  std::stringstream ss(content);
+  std::string received(content.size(), '\0');
+  std::vector<std::vector<uint64_t>> rounds;
+  const auto confirm = [this, &received, &rounds](const std::vector<uint64_t> &resend_indices,
+                                                  std::vector<uint64_t> &failed_indices) -> Status {
+    rounds.emplace_back(resend_indices);
+    return ReceiveOneRound(exchange_service_, queue_attr_.queue_id, resend_indices, received, failed_indices);
+  };
+  // 分片3在传输中被篡改，只重发该分片
+  exchange_service_.InjectCorruption(3U, 1U);
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_EQ(sender.SendWithConfirm(ss, content.size(), queue_attr_, confirm), SUCCESS);
+  EXPECT_EQ(received, content);
+  ASSERT_EQ(rounds.size(), 2U);
+  EXPECT_TRUE(rounds[0U].empty());
+  EXPECT_EQ(rounds[1U], std::vector<uint64_t>({3U}));
+  EXPECT_EQ(sender.GetStat().chunk_num, 9U);
+  EXPECT_EQ(sender.GetStat().resend_num, 1U);
+  // 发送完成后读位置在内容末尾
+  EXPECT_EQ(ss.tellg(), static_cast<std::streamoff>(content.size()));
+}
+
+TEST_F(WeightStreamSenderTest, CorruptedChunkExceedResendTimes) {
+  const auto content = MakeContent(kChunkSize * 2U);
+  std::stringstream ss(content);
+  std::string received(content.size(), '\0');
+  size_t round_num = 0U;
+  const auto confirm = [this, &received, &round_num](const std::vector<uint64_t> &resend_indices,
+                                                     std::vector<uint64_t> &failed_indices) -> Status {
+    ++round_num;
+    return ReceiveOneRound(exchange_service_, queue_attr_.queue_id, resend_indices, received, failed_indices);
+  };
+  // 第2个分片每次传输都被篡改
+  exchange_service_.InjectCorruption(1U, option_.max_resend_times + 1U);
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_NE(sender.SendWithConfirm(ss, content.size(), queue_attr_, confirm), SUCCESS);
+  EXPECT_EQ(round_num, option_.max_resend_times + 1U);
+  EXPECT_EQ(sender.GetStat().resend_num, option_.max_resend_times);
+  EXPECT_EQ(received.substr(0U, kChunkSize), content.substr(0U, kChunkSize));
+}
+
+TEST_F(WeightStreamSenderTest, EnqueueFailedExceedResendTimes) {
+  const auto content = MakeContent(kChunkSize * 8U);
+  std::stringstream ss(content);
+  exchange_service_.InjectEnqueueFailure(option_.max_resend_times + 1U);
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_NE(sender.Send(ss, content.size(), queue_attr_), SUCCESS);
+  EXPECT_EQ(sender.GetStat().chunk_num, 0U);
+}
+
+TEST_F(WeightStreamSenderTest, StreamShorterThanLength) {
+  const auto content = MakeContent(kChunkSize);
+  std::stringstream ss(content);
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_NE(sender.Send(ss, content.size() + 1U, queue_attr_), SUCCESS);
+  EXPECT_LE(sender.GetStat().chunk_num, 1U);
+}
+
+TEST_F(WeightStreamSenderTest, SendEmptyContent) {
+  std::stringstream ss;
+  WeightStreamSender sender(exchange_service_, option_);
+  EXPECT_EQ(sender.Send(ss, 0U, queue_attr_), SUCCESS);
+  EXPECT_EQ(sender.GetStat().chunk_num, 0U);
+}
+
+TEST_F(WeightStreamSenderTest, CheckerDropDuplicatedAndRecordCorruptedChunk) {
+  const auto content = MakeContent(200U);
+  WeightChunkHead head{};
+  ExchangeService::ControlInfo control_info{};
+  std::stringstream ss(content);
+  WeightStreamOption option = option_;
+  option.chunk_size = 100U;
+  WeightStreamSender sender(exchange_service_, option);
+  ASSERT_EQ(sender.Send(ss, content.size(), queue_attr_), SUCCESS);
+  std::vector<LoopbackExchangeService::Message> messages(2U);
+  ASSERT_EQ(exchange_service_.DequeueMessage(0, queue_attr_.queue_id, messages[0U], kTimeout), SUCCESS);
+  ASSERT_EQ(exchange_service_.DequeueMessage(0, queue_attr_.queue_id, messages[1U], kTimeout), SUCCESS);
+
+  WeightChunkChecker checker(content.size());
+  auto result = WeightChunkChecker::Result::kAccepted;
+  ASSERT_TRUE(WeightChunkUtils::ParseHead(messages[0U].user_data, sizeof(messages[0U].user_data), head));
+  EXPECT_EQ(checker.Check(head, messages[0U].data.data(), messages[0U].data.size(), result), SUCCESS);
+  EXPECT_EQ(result, WeightChunkChecker::Result::kAccepted);
+  // 重复的分片被丢弃
+  EXPECT_EQ(checker.Check(head, messages[0U].data.data(), messages[0U].data.size(), result), SUCCESS);
+  EXPECT_EQ(result, WeightChunkChecker::Result::kDuplicated);
+  // 数据被篡改时crc校验失败，记录下来等待重发
+  WeightChunkHead corrupted_head{};
+  ASSERT_TRUE(WeightChunkUtils::ParseHead(messages[1U].user_data, sizeof(messages[1U].user_data), corrupted_head));
+  auto corrupted_data = messages[1U].data;
+  corrupted_data[10U] ^= 0x1U;
+  EXPECT_EQ(checker.Check(corrupted_head, corrupted_data.data(), corrupted_data.size(), result), SUCCESS);
+  EXPECT_EQ(result, WeightChunkChecker::Result::kCorrupted);
+  EXPECT_TRUE(checker.IsFinished());
+  EXPECT_EQ(checker.GetReceivedLength(), 100U);
+  EXPECT_EQ(checker.GetFailedChunks(), std::vector<uint64_t>({1U}));
+
+  // 重发轮次只接收校验失败的分片
+  WeightChunkChecker resend_checker(content.size(), checker.GetFailedChunks());
+  EXPECT_FALSE(resend_checker.IsFinished());
+  EXPECT_NE(resend_checker.Check(head, messages[0U].data.data(), messages[0U].data.size(), result), SUCCESS);
+  EXPECT_EQ(resend_checker.Check(corrupted_head, messages[1U].data.data(), messages[1U].data.size(), result), SUCCESS);
+  EXPECT_EQ(result, WeightChunkChecker::Result::kAccepted);
+  EXPECT_TRUE(resend_checker.IsFinished());
+  EXPECT_TRUE(resend_checker.GetFailedChunks().empty());
+  // 不带分片头的user data
+  EXPECT_FALSE(WeightChunkUtils::ParseHead(control_info.user_data, sizeof(control_info.user_data), head));
+}
+}  // namespace ge
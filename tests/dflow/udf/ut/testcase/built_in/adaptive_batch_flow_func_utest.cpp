@@ -0,0 +1,358 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include "gtest/gtest.h"
+#include "securec.h"
+#include "ascend_hal.h"
+#include "mockcpp/mockcpp.hpp"
+#define private public
+#include "built_in/adaptive_batch_flow_func.h"
+#include "flow_func/flow_func_timer.h"
+#include "flow_func/flow_func_context.h"
+#include "model/attr_value_impl.h"
+#include "flow_func/mbuf_flow_msg.h"
+#undef private
+#include "flow_func/flow_func_params.h"
+#include "flow_func/flow_func_run_context.h"
+
+using namespace std;
+namespace FlowFunc {
+namespace {
+struct MbufImpl {
+  uint32_t mbuf_size;
+  uint8_t reserve_head[256 - sizeof(MbufHeadMsg)];
+  MbufHeadMsg head_msg;
+  RuntimeTensorDesc tensor_desc;
+  uint8_t data[2048];
+};
+
+int halMbufAllocExStub(uint64_t size, unsigned int align, unsigned long flag, int grp_id, Mbuf **mbuf) {
+  MbufImpl *mbuf_impl = new (std::nothrow) MbufImpl();
+  memset_s(mbuf_impl, sizeof(MbufImpl), 0, sizeof(MbufImpl));
+  mbuf_impl->mbuf_size = size;
+  *mbuf = reinterpret_cast<Mbuf *>(mbuf_impl);
+  return DRV_ERROR_NONE;
+}
+
+int halMbufFreeStub(Mbuf *mbuf) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  delete mbuf_impl;
+  return DRV_ERROR_NONE;
+}
+
+int halMbufGetBuffAddrStub(Mbuf *mbuf, void **buf) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  *buf = mbuf_impl->data;
+  return DRV_ERROR_NONE;
+}
+
+int halMbufGetBuffSizeStub(Mbuf *mbuf, uint64_t *total_size) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  *total_size = mbuf_impl->mbuf_size;
+  return DRV_ERROR_NONE;
+}
+
+int halMbufSetDataLenStub(Mbuf *mbuf, uint64_t len) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  mbuf_impl->mbuf_size = len;
+  return DRV_ERROR_NONE;
+}
+
+int halMbufGetPrivInfoStub(Mbuf *mbuf, void **priv, unsigned int *size) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  *priv = &mbuf_impl->reserve_head;
+  *size = 256;
+  return DRV_ERROR_NONE;
+}
+
+int halMbufGetDataLenStub(Mbuf *mbuf, uint64_t *len) {
+  MbufImpl *mbuf_impl = reinterpret_cast<MbufImpl *>(mbuf);
+  *len = mbuf_impl->mbuf_size;
+  return DRV_ERROR_NONE;
+}
+
+std::shared_ptr<MbufFlowMsg> CreateSampleMsg(uint32_t value) {
+  MbufHead mbuf_head;
+  std::shared_ptr<MbufFlowMsg> mbuf_flow_msg =
+      MbufFlowMsg::AllocTensorMsg({2}, TensorDataType::DT_UINT32, 0, mbuf_head);
+  auto data = static_cast<uint32_t *>(mbuf_flow_msg->GetTensor()->GetData());
+  data[0] = value;
+  data[1] = value;
+  return mbuf_flow_msg;
+}
+}  // namespace
+
+class ADAPTIVE_BATCH_FLOW_FUNC_UTEST : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    MOCKER(halMbufAllocEx).defaults().will(invoke(halMbufAllocExStub));
+    MOCKER(halMbufFree).defaults().will(invoke(halMbufFreeStub));
+    MOCKER(halMbufGetBuffAddr).defaults().will(invoke(halMbufGetBuffAddrStub));
+    MOCKER(halMbufGetBuffSize).defaults().will(invoke(halMbufGetBuffSizeStub));
+    MOCKER(halMbufSetDataLen).defaults().will(invoke(halMbufSetDataLenStub));
+    MOCKER(halMbufGetPrivInfo).defaults().will(invoke(halMbufGetPrivInfoStub));
+    MOCKER(halMbufGetDataLen).defaults().will(invoke(halMbufGetDataLenStub));
+  }
+
+  virtual void TearDown() {
+    GlobalMockObject::verify();
+  }
+};
+
+std::map<std::string, std::shared_ptr<const AttrValue>> CreateAdaptiveAttrs(int64_t latency_slo_value,
+                                                                            const std::vector<int64_t> &buckets,
+                                                                            bool padding_flag) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs;
+  if (latency_slo_value >= 0) {
+    ff::udf::AttrValue latency_slo;
+    latency_slo.set_i(latency_slo_value);
+    attrs["latency_slo"] = std::make_shared<AttrValueImpl>(latency_slo);
+  }
+  ff::udf::AttrValue batch_buckets;
+  auto array = batch_buckets.mutable_array();
+  for (const auto bucket : buckets) {
+    array->add_i(bucket);
+  }
+  attrs["batch_buckets"] = std::make_shared<AttrValueImpl>(batch_buckets);
+  ff::udf::AttrValue padding;
+  padding.set_b(padding_flag);
+  attrs["padding"] = std::make_shared<AttrValueImpl>(padding);
+  return attrs;
+}
+
+FlowFuncContext CreateAdaptiveFlowFuncContext(std::map<std::string, std::shared_ptr<const AttrValue>> &attrs) {
+  uint32_t input_num = 1;
+  uint32_t output_num = 1;
+  std::shared_ptr<FlowFuncParams> flow_func_param(new (std::nothrow)
+                                                      FlowFuncParams("AdaptiveBatch", input_num, output_num, 0, 0));
+  flow_func_param->SetAttrMap(attrs);
+  std::shared_ptr<FlowFuncRunContext> flow_func_run_context(new (std::nothrow)
+                                                                FlowFuncRunContext(0, flow_func_param, nullptr));
+  FlowFuncContext flow_func_context(flow_func_param, flow_func_run_context);
+  return flow_func_context;
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, init_success) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(10, {1, 2, 4, 8}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.latency_slo_, 10);
+  EXPECT_EQ(adaptive_batch.batch_buckets_, std::vector<int64_t>({1, 2, 4, 8}));
+  EXPECT_EQ(adaptive_batch.padding_, true);
+  EXPECT_NE(adaptive_batch.timer_handle_, nullptr);
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, get_attr_failed) {
+  AdaptiveBatchFlowFunc adaptive_batch;
+  // empty attr
+  std::map<std::string, std::shared_ptr<const AttrValue>> empty_attr;
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(empty_attr);
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_ERR_ATTR_NOT_EXITS);
+  // invalid latency slo
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs1 = CreateAdaptiveAttrs(0, {1, 2}, true);
+  FlowFuncContext flow_func_context1 = CreateAdaptiveFlowFuncContext(attrs1);
+  adaptive_batch.SetContext(&flow_func_context1);
+  EXPECT_NE(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  // empty buckets
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs2 = CreateAdaptiveAttrs(10, {}, true);
+  FlowFuncContext flow_func_context2 = CreateAdaptiveFlowFuncContext(attrs2);
+  adaptive_batch.SetContext(&flow_func_context2);
+  EXPECT_NE(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  // buckets not ascending
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs3 = CreateAdaptiveAttrs(10, {4, 2}, true);
+  FlowFuncContext flow_func_context3 = CreateAdaptiveFlowFuncContext(attrs3);
+  adaptive_batch.SetContext(&flow_func_context3);
+  EXPECT_NE(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  // bucket not positive
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs4 = CreateAdaptiveAttrs(10, {0, 2}, true);
+  FlowFuncContext flow_func_context4 = CreateAdaptiveFlowFuncContext(attrs4);
+  adaptive_batch.SetContext(&flow_func_context4);
+  EXPECT_NE(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, select_bucket_by_arrival_interval) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(10, {1, 2, 4, 8}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  // no observation
+  EXPECT_EQ(adaptive_batch.SelectTargetBucket(), 1);
+  adaptive_batch.arrival_interval_us_ = 20000UL;
+  EXPECT_EQ(adaptive_batch.SelectTargetBucket(), 1);
+  adaptive_batch.arrival_interval_us_ = 10000UL;
+  EXPECT_EQ(adaptive_batch.SelectTargetBucket(), 2);
+  adaptive_batch.arrival_interval_us_ = 3000UL;
+  EXPECT_EQ(adaptive_batch.SelectTargetBucket(), 4);
+  adaptive_batch.arrival_interval_us_ = 1UL;
+  EXPECT_EQ(adaptive_batch.SelectTargetBucket(), 8);
+  EXPECT_EQ(adaptive_batch.SelectPaddingBucket(3), 4);
+  EXPECT_EQ(adaptive_batch.SelectPaddingBucket(8), 8);
+
+  adaptive_batch.arrival_interval_us_ = 0UL;
+  adaptive_batch.last_arrival_time_ = 0UL;
+  adaptive_batch.ObserveArrival(100UL);
+  adaptive_batch.ObserveArrival(1100UL);
+  EXPECT_EQ(adaptive_batch.arrival_interval_us_, 1000UL);
+  // idle interval is limited to twice of latency slo
+  adaptive_batch.ObserveArrival(1000000UL);
+  EXPECT_EQ(adaptive_batch.arrival_interval_us_, (1000UL * 7UL + 20000UL) / 8UL);
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, proc_flush_when_bucket_full) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(100, {2, 4, 8}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  MOCKER_CPP_VIRTUAL(flow_func_context, &FlowFuncContext::SetOutput,
+                     int32_t (FlowFuncContext::*)(uint32_t, std::shared_ptr<FlowMsg>))
+      .stubs()
+      .will(returnValue(FLOW_FUNC_SUCCESS));
+  adaptive_batch.arrival_interval_us_ = 1UL;
+  for (uint32_t i = 0U; i < 8U; ++i) {
+    std::vector<std::shared_ptr<FlowMsg>> input_msgs = {CreateSampleMsg(i)};
+    EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+    if (i != 7U) {
+      EXPECT_EQ(adaptive_batch.target_bucket_, 8);
+      EXPECT_EQ(adaptive_batch.batch_count_, static_cast<int64_t>(i + 1U));
+      auto staging_data = static_cast<uint32_t *>(adaptive_batch.slots_[0].staging_msg->GetTensor()->GetData());
+      EXPECT_EQ(staging_data[i * 2U], i);
+    }
+  }
+  EXPECT_EQ(adaptive_batch.batch_count_, 0);
+  EXPECT_EQ(adaptive_batch.batch_num_, 1UL);
+  EXPECT_EQ(adaptive_batch.sample_num_, 8UL);
+  EXPECT_EQ(adaptive_batch.padding_num_, 0UL);
+  EXPECT_EQ(adaptive_batch.slots_[0].staging_msg, nullptr);
+  EXPECT_TRUE(adaptive_batch.slots_[0].spare_msgs.empty());
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, assemble_output_padding_to_bucket) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(100, {2, 4, 8}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  adaptive_batch.arrival_interval_us_ = 1UL;
+  for (uint32_t i = 0U; i < 3U; ++i) {
+    std::vector<std::shared_ptr<FlowMsg>> input_msgs = {CreateSampleMsg(i + 1U)};
+    EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  }
+  std::shared_ptr<FlowMsg> output_msg;
+  EXPECT_EQ(adaptive_batch.AssembleOutput(adaptive_batch.slots_[0], 4, output_msg), FLOW_FUNC_SUCCESS);
+  ASSERT_NE(output_msg, nullptr);
+  EXPECT_EQ(output_msg->GetTensor()->GetShape(), std::vector<int64_t>({4, 2}));
+  auto data = static_cast<uint32_t *>(output_msg->GetTensor()->GetData());
+  EXPECT_EQ(data[0], 1U);
+  EXPECT_EQ(data[2], 2U);
+  EXPECT_EQ(data[4], 3U);
+  EXPECT_EQ(data[6], 0U);
+  EXPECT_EQ(data[7], 0U);
+  // buffer of target bucket is kept for next batch
+  EXPECT_EQ(adaptive_batch.slots_[0].staging_msg, nullptr);
+  EXPECT_EQ(adaptive_batch.slots_[0].spare_msgs.count(8), 1U);
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, proc_timeout_and_reuse_buffer) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(100, {2, 4, 8}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  MOCKER_CPP_VIRTUAL(flow_func_context, &FlowFuncContext::SetOutput,
+                     int32_t (FlowFuncContext::*)(uint32_t, std::shared_ptr<FlowMsg>))
+      .stubs()
+      .will(returnValue(FLOW_FUNC_SUCCESS));
+  adaptive_batch.arrival_interval_us_ = 1UL;
+  for (uint32_t i = 0U; i < 3U; ++i) {
+    std::vector<std::shared_ptr<FlowMsg>> input_msgs = {CreateSampleMsg(i)};
+    EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  }
+  TimerInfo *timer_info = (TimerInfo *)(adaptive_batch.timer_handle_);
+  // not reach latency slo
+  timer_info->timer_callback();
+  EXPECT_EQ(adaptive_batch.batch_count_, 3);
+  adaptive_batch.batch_start_time_ = 0UL;
+  timer_info->timer_callback();
+  EXPECT_EQ(adaptive_batch.batch_count_, 0);
+  EXPECT_EQ(adaptive_batch.batch_num_, 1UL);
+  EXPECT_EQ(adaptive_batch.padding_num_, 1UL);
+  EXPECT_EQ(adaptive_batch.slots_[0].spare_msgs.count(8), 1U);
+
+  adaptive_batch.arrival_interval_us_ = 1UL;
+  adaptive_batch.last_arrival_time_ = 0UL;
+  std::vector<std::shared_ptr<FlowMsg>> input_msgs = {CreateSampleMsg(10U)};
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.target_bucket_, 8);
+  EXPECT_EQ(adaptive_batch.reuse_num_, 1UL);
+  EXPECT_TRUE(adaptive_batch.slots_[0].spare_msgs.empty());
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, proc_eos_flush_without_padding) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(100, {4, 8}, false);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  MOCKER_CPP_VIRTUAL(flow_func_context, &FlowFuncContext::SetOutput,
+                     int32_t (FlowFuncContext::*)(uint32_t, std::shared_ptr<FlowMsg>))
+      .stubs()
+      .will(returnValue(FLOW_FUNC_SUCCESS));
+  for (uint32_t i = 0U; i < 2U; ++i) {
+    std::vector<std::shared_ptr<FlowMsg>> input_msgs = {CreateSampleMsg(i)};
+    EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  }
+  EXPECT_EQ(adaptive_batch.batch_count_, 2);
+  auto eos_msg = flow_func_context.AllocEmptyDataMsg(MsgType::MSG_TYPE_TENSOR_DATA);
+  ASSERT_NE(eos_msg, nullptr);
+  eos_msg->SetFlowFlags(static_cast<uint32_t>(FlowFlag::FLOW_FLAG_EOS));
+  std::vector<std::shared_ptr<FlowMsg>> eos_msgs = {eos_msg};
+  EXPECT_EQ(adaptive_batch.Proc(eos_msgs), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.batch_count_, 0);
+  EXPECT_EQ(adaptive_batch.batch_num_, 1UL);
+  EXPECT_EQ(adaptive_batch.padding_num_, 0UL);
+  EXPECT_EQ(adaptive_batch.slots_[0].spare_msgs.count(4), 1U);
+}
+
+TEST_F(ADAPTIVE_BATCH_FLOW_FUNC_UTEST, proc_input_invalid) {
+  std::map<std::string, std::shared_ptr<const AttrValue>> attrs = CreateAdaptiveAttrs(100, {4}, true);
+  FlowFuncContext flow_func_context = CreateAdaptiveFlowFuncContext(attrs);
+  AdaptiveBatchFlowFunc adaptive_batch;
+  adaptive_batch.SetContext(&flow_func_context);
+  EXPECT_EQ(adaptive_batch.Init(), FLOW_FUNC_SUCCESS);
+  std::vector<std::shared_ptr<FlowMsg>> input_msgs;
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  input_msgs.resize(1);
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+
+  input_msgs = {CreateSampleMsg(1U)};
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.batch_count_, 1);
+  MbufHead mbuf_head;
+  std::shared_ptr<MbufFlowMsg> shape_error_msg =
+      MbufFlowMsg::AllocTensorMsg({3}, TensorDataType::DT_UINT32, 0, mbuf_head);
+  input_msgs = {shape_error_msg};
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.batch_count_, 0);
+
+  input_msgs = {CreateSampleMsg(1U)};
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  std::shared_ptr<MbufFlowMsg> dtype_error_msg =
+      MbufFlowMsg::AllocTensorMsg({2}, TensorDataType::DT_INT32, 0, mbuf_head);
+  input_msgs = {dtype_error_msg};
+  EXPECT_EQ(adaptive_batch.Proc(input_msgs), FLOW_FUNC_SUCCESS);
+  EXPECT_EQ(adaptive_batch.batch_count_, 0);
+}
+}  // namespace FlowFunc
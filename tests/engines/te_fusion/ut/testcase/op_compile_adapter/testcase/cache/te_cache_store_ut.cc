@@ -0,0 +1,231 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include "common/common_utils.h"
+
+#define private public
+#define protected public
+#include "cache/te_cache_store.h"
+#include "cache/te_cache_manager.h"
+#include "cache/te_cache_space_manager.h"
+#undef protected public
+#undef private public
+
+using namespace std;
+using namespace testing;
+namespace fs = std::filesystem;
+
+namespace te {
+namespace fusion {
+namespace {
+const std::string kTestCacheDir = "./te_cache_store_ut";
+
+void CreateCacheFile(const std::string &fileName, const size_t size) {
+  std::ofstream ofs(kTestCacheDir + "/" + fileName);
+  ofs << std::string(size, 'a');
+}
+
+TeCacheEntry MakeEntry(const std::string &kernelName, const uint64_t lastAccessTime) {
+  TeCacheEntry entry;
+  entry.kernelName = kernelName;
+  entry.files = {{kernelName + ".json", 10U}, {kernelName + ".o", 90U}};
+  entry.totalSize = 100U;
+  entry.binChecksum = TeCacheStore::CalcChecksum(kernelName.data(), kernelName.size());
+  entry.lastAccessTime = lastAccessTime;
+  return entry;
+}
+}  // namespace
+
+class TeCacheStoreUTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    fs::remove_all(kTestCacheDir);
+    fs::create_directories(kTestCacheDir);
+    cacheDir_ = RealPath(kTestCacheDir);
+    ASSERT_TRUE(TeCacheStore::Instance().Open(cacheDir_));
+  }
+
+  void TearDown() override {
+    TeCacheStore::Instance().Close();
+    fs::remove_all(kTestCacheDir);
+  }
+
+  std::string cacheDir_;
+};
+
+TEST_F(TeCacheStoreUTest, insert_lookup_remove) {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  EXPECT_FALSE(cacheStore.IsAuthoritative());
+  for (size_t i = 0U; i < 100U; ++i) {
+    EXPECT_TRUE(cacheStore.Insert(MakeEntry("te_add_" + std::to_string(i), 0U)));
+  }
+  EXPECT_EQ(cacheStore.GetEntryNum(), 100U);
+  EXPECT_EQ(cacheStore.GetTotalSize(), 10000U);
+
+  TeCacheEntry entry;
+  ASSERT_TRUE(cacheStore.Lookup("te_add_7", entry));
+  EXPECT_EQ(entry.kernelName, "te_add_7");
+  ASSERT_EQ(entry.files.size(), 2U);
+  EXPECT_EQ(entry.files[1].first, "te_add_7.o");
+  EXPECT_EQ(entry.files[1].second, 90U);
+  EXPECT_EQ(entry.binChecksum, TeCacheStore::CalcChecksum("te_add_7", 8U));
+  EXPECT_FALSE(cacheStore.Lookup("te_add_100", entry));
+
+  // 同名kernel以新记录为准
+  TeCacheEntry newEntry = MakeEntry("te_add_7", 0U);
+  newEntry.binChecksum = 1U;
+  newEntry.totalSize = 50U;
+  EXPECT_TRUE(cacheStore.Insert(newEntry));
+  EXPECT_EQ(cacheStore.GetEntryNum(), 100U);
+  EXPECT_EQ(cacheStore.GetTotalSize(), 9950U);
+  ASSERT_TRUE(cacheStore.Lookup("te_add_7", entry));
+  EXPECT_EQ(entry.binChecksum, 1U);
+
+  EXPECT_TRUE(cacheStore.Remove("te_add_7"));
+  EXPECT_FALSE(cacheStore.Remove("te_add_7"));
+  EXPECT_FALSE(cacheStore.Lookup("te_add_7", entry));
+  EXPECT_EQ(cacheStore.GetEntryNum(), 99U);
+}
+
+TEST_F(TeCacheStoreUTest, reopen_keep_entries_and_authoritative) {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  EXPECT_TRUE(cacheStore.Insert(MakeEntry("te_mul_0", 0U)));
+  cacheStore.SetAuthoritative(true);
+  cacheStore.Close();
+  EXPECT_FALSE(cacheStore.IsOpened());
+
+  ASSERT_TRUE(cacheStore.Open(cacheDir_));
+  EXPECT_TRUE(cacheStore.IsAuthoritative());
+  TeCacheEntry entry;
+  EXPECT_TRUE(cacheStore.Lookup("te_mul_0", entry));
+  EXPECT_EQ(cacheStore.GetEntryNum(), 1U);
+}
+
+TEST_F(TeCacheStoreUTest, evict_by_lru) {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  const uint64_t now = static_cast<uint64_t>(std::time(nullptr));
+  for (size_t i = 0U; i < 4U; ++i) {
+    const std::string kernelName = "te_sub_" + std::to_string(i);
+    CreateCacheFile(kernelName + ".json", 10U);
+    CreateCacheFile(kernelName + ".o", 90U);
+    // te_sub_3最近访问过，不满足最小老化时间
+    EXPECT_TRUE(cacheStore.Insert(MakeEntry(kernelName, (i == 3U) ? now : (1000U + i))));
+  }
+  TeCacheEntry entry;
+  ASSERT_TRUE(cacheStore.Lookup("te_sub_2", entry));
+  cacheStore.Touch(entry);
+
+  EXPECT_EQ(cacheStore.EvictByLru(150U, 1800U), 200U);
+  EXPECT_FALSE(cacheStore.Lookup("te_sub_0", entry));
+  EXPECT_FALSE(cacheStore.Lookup("te_sub_1", entry));
+  EXPECT_TRUE(cacheStore.Lookup("te_sub_2", entry));
+  EXPECT_FALSE(fs::exists(kTestCacheDir + "/te_sub_0.json"));
+  EXPECT_FALSE(fs::exists(kTestCacheDir + "/te_sub_1.o"));
+  EXPECT_TRUE(fs::exists(kTestCacheDir + "/te_sub_2.o"));
+
+  cacheStore.StartBackgroundAging(1000U, 1800U);
+  cacheStore.WaitBackgroundTask();
+  EXPECT_EQ(cacheStore.GetEntryNum(), 2U);
+  EXPECT_EQ(cacheStore.GetTotalSize(), 200U);
+}
+
+TEST_F(TeCacheStoreUTest, compact_keep_live_entries) {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  for (size_t round = 0U; round < 3U; ++round) {
+    for (size_t i = 0U; i < 10U; ++i) {
+      EXPECT_TRUE(cacheStore.Insert(MakeEntry("te_relu_" + std::to_string(i), 0U)));
+    }
+  }
+  EXPECT_TRUE(cacheStore.Remove("te_relu_0"));
+  const uintmax_t dataSize = fs::file_size(kTestCacheDir + "/kernel_cache.dat");
+  EXPECT_TRUE(cacheStore.Compact());
+  EXPECT_FALSE(cacheStore.NeedCompact());
+  EXPECT_EQ(cacheStore.GetEntryNum(), 9U);
+  // 只保留9条有效记录
+  EXPECT_EQ(fs::file_size(kTestCacheDir + "/kernel_cache.dat") * 30U, dataSize * 9U);
+  TeCacheEntry entry;
+  EXPECT_FALSE(cacheStore.Lookup("te_relu_0", entry));
+  EXPECT_TRUE(cacheStore.Lookup("te_relu_9", entry));
+  EXPECT_EQ(entry.files.size(), 2U);
+}
+
+TEST_F(TeCacheStoreUTest, confirmed_miss_with_authoritative_index) {
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  EXPECT_TRUE(cacheStore.Insert(MakeEntry("te_exp_0", 0U)));
+  TeCacheEntry entry;
+  bool confirmedMiss = true;
+  EXPECT_FALSE(cacheStore.Lookup("te_exp_1", entry, confirmedMiss));
+  EXPECT_FALSE(confirmedMiss);
+
+  cacheStore.SetAuthoritative(true);
+  EXPECT_FALSE(cacheStore.Lookup("te_exp_1", entry, confirmedMiss));
+  EXPECT_TRUE(confirmedMiss);
+  EXPECT_TRUE(cacheStore.Lookup("te_exp_0", entry, confirmedMiss));
+  EXPECT_FALSE(confirmedMiss);
+
+  // 压缩重建完成后恢复authoritative
+  EXPECT_TRUE(cacheStore.Compact());
+  EXPECT_TRUE(cacheStore.IsAuthoritative());
+  EXPECT_TRUE(cacheStore.Lookup("te_exp_0", entry, confirmedMiss));
+}
+
+TEST_F(TeCacheStoreUTest, insert_fail_revoke_authoritative) {
+  TeCacheManager &cacheManager = TeCacheManager::Instance();
+  const std::string oldDir = cacheManager.cache_dir_path_;
+  cacheManager.cache_dir_path_ = cacheDir_;
+  TeCacheStore::Instance().SetAuthoritative(true);
+
+  // 未能写入索引的kernel不在索引中，之后的未命中需退回文件搜索
+  cacheManager.AddCacheStoreEntry("", {}, 0U);
+  EXPECT_FALSE(TeCacheStore::Instance().IsAuthoritative());
+
+  cacheManager.cache_dir_path_ = oldDir;
+}
+
+TEST_F(TeCacheStoreUTest, import_cache_files) {
+  CreateCacheFile("te_div_pre.json", 20U);
+  TeCacheSpaceManager::Instance().ImportCacheFilesIntoStore(cacheDir_);
+  TeCacheStore &cacheStore = TeCacheStore::Instance();
+  EXPECT_TRUE(cacheStore.IsAuthoritative());
+  TeCacheEntry entry;
+  ASSERT_TRUE(cacheStore.Lookup("te_div_pre", entry));
+  EXPECT_EQ(entry.binChecksum, 0U);
+  EXPECT_EQ(entry.totalSize, 20U);
+}
+
+TEST_F(TeCacheStoreUTest, match_cache_with_authoritative_index) {
+  TeCacheManager &cacheManager = TeCacheManager::Instance();
+  const CompileCacheMode oldMode = cacheManager.cache_mode_;
+  const std::string oldDir = cacheManager.cache_dir_path_;
+  cacheManager.cache_mode_ = CompileCacheMode::Enable;
+  cacheManager.cache_dir_path_ = cacheDir_;
+  TeCacheStore::Instance().SetAuthoritative(true);
+
+  // 索引中不存在时直接认定未命中，即使目录中存在文件
+  CreateCacheFile("te_abs_pre.json", 20U);
+  EXPECT_EQ(cacheManager.MatchPreCompileCache("te_abs_pre"), nullptr);
+  EXPECT_EQ(cacheManager.MatchCompileCache("te_abs_0", false), nullptr);
+
+  PreCompileResultPtr preCompileRet = std::make_shared<PreCompileResult>("Elemwise");
+  EXPECT_TRUE(cacheManager.SetPreCompileResult("te_neg_pre", preCompileRet));
+  cacheManager.precompile_ret_cache_map_.clear();
+  PreCompileResultPtr matchedRet = cacheManager.MatchPreCompileCache("te_neg_pre");
+  ASSERT_NE(matchedRet, nullptr);
+  EXPECT_EQ(matchedRet->opPattern, "Elemwise");
+
+  cacheManager.precompile_ret_cache_map_.clear();
+  cacheManager.cache_mode_ = oldMode;
+  cacheManager.cache_dir_path_ = oldDir;
+}
+}  // namespace fusion
+}  // namespace te
@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#define private public
+#define protected public
+#include "common/tbe_op_info_hash.h"
+#include "common/fusion_common.h"
+#include "assemble_json/te_attr_utils.h"
+#undef protected public
+#undef private public
+
+using namespace std;
+using namespace testing;
+namespace te {
+namespace fusion {
+namespace {
+// 与kernel json中属性的描述一致：dtype + value
+std::string DumpAttrJson(const TbeAttrValue &attr) {
+  nlohmann::json attrJson;
+  SetAttrDtype2Json(attr, attrJson);
+  nlohmann::json valueJson;
+  GetAttrValueToJson(attr, valueJson);
+  attrJson["value"] = valueJson;
+  return attrJson.dump();
+}
+
+std::vector<TbeAttrValue> BuildAttrCorpus() {
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<TbeAttrValue> attrs;
+  attrs.emplace_back("a", static_cast<int8_t>(5));
+  attrs.emplace_back("b", static_cast<int8_t>(5));
+  attrs.emplace_back("a", static_cast<int32_t>(5));
+  attrs.emplace_back("a", static_cast<int64_t>(5));
+  attrs.emplace_back("a", static_cast<int64_t>(-5));
+  attrs.emplace_back("a", static_cast<uint64_t>(5));
+  attrs.emplace_back("a", true);
+  attrs.emplace_back("a", 1.0F);
+  attrs.emplace_back("b", 1.0F);
+  attrs.emplace_back("a", 0.0F);
+  attrs.emplace_back("a", -0.0F);
+  attrs.emplace_back("a", inf);
+  attrs.emplace_back("a", -inf);
+  attrs.emplace_back("a", nan);
+  attrs.emplace_back("a", 1.0);
+  attrs.emplace_back("a", std::string(""));
+  attrs.emplace_back("a", std::string("ab"));
+  attrs.emplace_back("a", std::string("abcdefghi"));
+  attrs.emplace_back("a", std::vector<int64_t>{});
+  attrs.emplace_back("a", std::vector<int64_t>{1, 2});
+  attrs.emplace_back("b", std::vector<int64_t>{1, 2});
+  attrs.emplace_back("a", std::vector<int64_t>{12});
+  attrs.emplace_back("a", std::vector<int32_t>{1, 2});
+  attrs.emplace_back("a", std::vector<float>{1.5F, nan});
+  attrs.emplace_back("a", std::vector<float>{1.5F, inf});
+  attrs.emplace_back("a", std::vector<float>{1.5F});
+  attrs.emplace_back("a", std::vector<bool>{true, false});
+  attrs.emplace_back("a", std::vector<bool>{false, true});
+  attrs.emplace_back("a", std::vector<std::string>{"ab", "c"});
+  attrs.emplace_back("a", std::vector<std::string>{"a", "bc"});
+  attrs.emplace_back("a", std::vector<std::vector<int64_t>>{{1}, {2}});
+  attrs.emplace_back("a", std::vector<std::vector<int64_t>>{{1, 2}});
+  return attrs;
+}
+
+TbeOpInfoPtr BuildOpInfo(const std::string &dtype, const std::vector<int64_t> &shape, const int64_t axis) {
+  TbeOpInfoPtr opInfo = std::make_shared<TbeOpInfo>("add_0", "", "Add", "AiCore");
+  TbeOpTensor tensor("x", shape, dtype, "ND");
+  tensor.SetOriginShape(shape);
+  tensor.SetShapeRange({{1, -1}});
+  opInfo->AddInput(TbeOpParam(TT_REQ, {tensor}));
+  opInfo->AddInput(TbeOpParam(TT_REQ, {tensor}));
+  opInfo->AddOutput(TbeOpParam(TT_REQ, {tensor}));
+  opInfo->AddAttrValue(TbeAttrValue("axis", axis));
+  opInfo->AddAttrValue(TbeAttrValue("perm", std::vector<int64_t>{0, 1}));
+  return opInfo;
+}
+}  // namespace
+
+TEST(TbeOpInfoHashUT, attr_hash_match_json) {
+  const std::vector<TbeAttrValue> attrs = BuildAttrCorpus();
+  for (size_t i = 0; i < attrs.size(); ++i) {
+    for (size_t j = 0; j < attrs.size(); ++j) {
+      const bool jsonEqual = DumpAttrJson(attrs[i]) == DumpAttrJson(attrs[j]);
+      const bool hashEqual = TbeOpInfoHasher::CalcAttr(attrs[i]) == TbeOpInfoHasher::CalcAttr(attrs[j]);
+      EXPECT_EQ(jsonEqual, hashEqual) << DumpAttrJson(attrs[i]) << " vs " << DumpAttrJson(attrs[j]);
+    }
+  }
+}
+
+TEST(TbeOpInfoHashUT, tensor_hash) {
+  TbeOpTensor tensor1("x", {2, 3}, "bool", "ND");
+  TbeOpTensor tensor2("y", {2, 3}, "int8", "ND");
+  // bool与int8视为相同，tensor名不参与
+  EXPECT_EQ(TbeOpInfoHasher::CalcTensor(tensor1), TbeOpInfoHasher::CalcTensor(tensor2));
+
+  // 未设置range与设置空range不同
+  tensor2.SetShapeRange({});
+  EXPECT_NE(TbeOpInfoHasher::CalcTensor(tensor1), TbeOpInfoHasher::CalcTensor(tensor2));
+
+  TbeOpTensor tensor3("x", {2, 3}, "int8", "ND");
+  TbeOpTensor tensor4("x", {2}, "int8", "ND");
+  tensor4.SetOriginShape({3});
+  tensor3.SetOriginShape({});
+  EXPECT_NE(TbeOpInfoHasher::CalcTensor(tensor3), TbeOpInfoHasher::CalcTensor(tensor4));
+
+  tensor4 = tensor3;
+  tensor4.SetConstValue(TbeAttrValue("const", std::vector<float>{1.0F}));
+  EXPECT_NE(TbeOpInfoHasher::CalcTensor(tensor3), TbeOpInfoHasher::CalcTensor(tensor4));
+}
+
+TEST(TbeOpInfoHashUT, op_info_hash_memo_and_invalidate) {
+  TbeOpInfoPtr opInfo1 = BuildOpInfo("float16", {16, 16}, 1);
+  TbeOpInfoPtr opInfo2 = BuildOpInfo("float16", {16, 16}, 1);
+  const TbeOpInfoHashValue hashValue = TbeOpInfoHasher::Get(*opInfo1);
+  EXPECT_TRUE(opInfo1->structural_hash_.IsValid());
+  EXPECT_EQ(hashValue, TbeOpInfoHasher::Calc(*opInfo1));
+  EXPECT_EQ(hashValue, TbeOpInfoHasher::Get(*opInfo2));
+  EXPECT_EQ(HashTbeOpInfo()(opInfo1), HashTbeOpInfo()(opInfo2));
+  EXPECT_TRUE(EqualToTbeOpInfo()(opInfo1, opInfo2));
+
+  // 通过可写引用修改后缓存失效
+  opInfo2->MutableInputs()[0].MutableTensors()[0].SetShape({16, 32});
+  EXPECT_FALSE(opInfo2->structural_hash_.IsValid());
+  EXPECT_NE(hashValue, TbeOpInfoHasher::Get(*opInfo2));
+  EXPECT_FALSE(EqualToTbeOpInfo()(opInfo1, opInfo2));
+
+  opInfo2 = BuildOpInfo("float16", {16, 16}, 1);
+  opInfo2->SetOpImplMode("high_precision");
+  EXPECT_NE(hashValue, TbeOpInfoHasher::Get(*opInfo2));
+  opInfo2->ClearOpImplMode();
+  EXPECT_EQ(hashValue, TbeOpInfoHasher::Get(*opInfo2));
+  opInfo2->SetL1Space(1024);
+  EXPECT_NE(hashValue, TbeOpInfoHasher::Get(*opInfo2));
+
+  // 输入输出个数不同但tensor序列相同
+  TbeOpInfoPtr opInfo3 = BuildOpInfo("float16", {16, 16}, 1);
+  opInfo3->MutableOutputs().emplace_back(opInfo3->GetInputs()[1]);
+  opInfo3->MutableInputs().pop_back();
+  EXPECT_NE(hashValue, TbeOpInfoHasher::Get(*opInfo3));
+  EXPECT_NE(hashValue, TbeOpInfoHasher::Get(*BuildOpInfo("float16", {16, 16}, 2)));
+}
+
+TEST(TbeOpInfoHashUT, op_info_hash_concurrent_get) {
+  TbeOpInfoPtr opInfo = BuildOpInfo("float16", {16, 16}, 1);
+  const TbeOpInfoHashValue expectValue = TbeOpInfoHasher::Calc(*opInfo);
+  constexpr size_t kThreadNum = 8U;
+  std::vector<TbeOpInfoHashValue> hashValues(kThreadNum);
+  std::vector<std::thread> threads;
+  for (size_t i = 0U; i < kThreadNum; ++i) {
+    threads.emplace_back([&opInfo, &hashValues, i]() {
+      for (size_t loop = 0U; loop < 100U; ++loop) {
+        hashValues[i] = TbeOpInfoHasher::Get(*opInfo);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (const auto &hashValue : hashValues) {
+    EXPECT_EQ(hashValue, expectValue);
+  }
+  EXPECT_TRUE(opInfo->structural_hash_.IsValid());
+
+  // 拷贝保留已计算的hash
+  const TbeOpInfo copyInfo(*opInfo);
+  EXPECT_TRUE(copyInfo.structural_hash_.IsValid());
+  EXPECT_EQ(TbeOpInfoHasher::Get(copyInfo), expectValue);
+}
+
+TEST(TbeOpInfoHashUT, dedup_in_unordered_map) {
+  std::unordered_map<TbeOpInfoPtr, size_t, HashTbeOpInfo, EqualToTbeOpInfo> opInfoMap;
+  for (size_t i = 0; i < 100U; ++i) {
+    opInfoMap.emplace(BuildOpInfo("float16", {16, 16}, static_cast<int64_t>(i % 5U)), i);
+  }
+  EXPECT_EQ(opInfoMap.size(), 5U);
+}
+}  // namespace fusion
+}  // namespace te
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "common/om2/om2_binary_meta.h"
+
+namespace ge {
+namespace {
+class Om2BinaryMetaTest : public testing::Test {
+ protected:
+  static Om2VarMeta MakeVarMeta(const size_t index, const std::string &name) {
+    Om2VarMeta meta;
+    meta.index = index;
+    meta.var_name = name;
+    meta.op_type = "Variable";
+    meta.op_name = "graph/" + name;
+    meta.tensor_desc.SetName(name);
+    meta.tensor_desc.SetShape({2, -1, 16});
+    meta.tensor_desc.SetShapeRange({{2, 2}, {1, 128}, {16, 16}});
+    meta.tensor_desc.SetDataType(DT_FLOAT16);
+    meta.tensor_desc.SetFormat(FORMAT_NCHW);
+    meta.tensor_desc.SetSize(1024U);
+    return meta;
+  }
+};
+
+TEST_F(Om2BinaryMetaTest, OpAttrMapRoundTrip) {
+  std::map<std::string, std::map<std::string, std::string>> op_attr_map;
+  op_attr_map["conv1"] = {{"_kernelname", "conv_kernel"}, {"pads", "[0,0,0,0]"}};
+  op_attr_map["relu1"] = {{"_kernelname", "relu_kernel"}};
+  op_attr_map["empty_op"] = {};
+  op_attr_map["empty_value"] = {{"attr", ""}};
+
+  std::vector<uint8_t> buffer;
+  ASSERT_EQ(Om2BinaryMetaCodec::EncodeOpAttrMap(op_attr_map, buffer), SUCCESS);
+  EXPECT_TRUE(Om2BinaryMetaCodec::IsBinaryMeta(buffer.data(), buffer.size()));
+
+  std::map<std::string, std::map<std::string, std::string>> decoded;
+  ASSERT_EQ(Om2BinaryMetaCodec::DecodeOpAttrMap(buffer.data(), buffer.size(), decoded), SUCCESS);
+  EXPECT_EQ(decoded, op_attr_map);
+}
+
+TEST_F(Om2BinaryMetaTest, ConstantsConfigRoundTripSameAsJson) {
+  Om2ConstMetas consts(3U);
+  consts[0U].index = 0U;
+  consts[0U].type = "INTERNAL";
+  consts[0U].offset = 0;
+  consts[0U].size = 64;
+  consts[0U].op_name = "const_b";
+  consts[1U].index = 1U;
+  consts[1U].type = "EXTERNAL";
+  consts[1U].file_name = "weight_1";
+  consts[1U].file_path = "/tmp/weight_1";
+  consts[1U].size = 128;
+  consts[1U].op_name = "const_a";
+  consts[2U] = consts[1U];
+  consts[2U].index = 2U;
+
+  std::vector<uint8_t> buffer;
+  ASSERT_EQ(Om2BinaryMetaCodec::EncodeConstantsConfig(consts, 64U, false, buffer), SUCCESS);
+  Om2ConstMetas decoded;
+  size_t internal_weight_size = 0U;
+  ASSERT_EQ(Om2BinaryMetaCodec::DecodeConstantsConfig(buffer.data(), buffer.size(), decoded, internal_weight_size),
+            SUCCESS);
+  EXPECT_EQ(internal_weight_size, 64U);
+  // 与json一致，按const key去重并排序
+  ASSERT_EQ(decoded.size(), 2U);
+  EXPECT_EQ(decoded[0U].op_name, "const_a");
+  EXPECT_EQ(decoded[0U].index, 2U);
+  EXPECT_EQ(decoded[0U].file_path, "/tmp/weight_1");
+  EXPECT_EQ(decoded[1U].op_name, "const_b");
+  EXPECT_EQ(decoded[1U].type, "INTERNAL");
+  EXPECT_EQ(decoded[1U].size, 64);
+
+  // 离线模式不保存file_path
+  ASSERT_EQ(Om2BinaryMetaCodec::EncodeConstantsConfig(consts, 64U, true, buffer), SUCCESS);
+  decoded.clear();
+  ASSERT_EQ(Om2BinaryMetaCodec::DecodeConstantsConfig(buffer.data(), buffer.size(), decoded, internal_weight_size),
+            SUCCESS);
+  ASSERT_EQ(decoded.size(), 2U);
+  EXPECT_TRUE(decoded[0U].file_path.empty());
+  EXPECT_EQ(decoded[0U].file_name, "weight_1");
+}
+
+TEST_F(Om2BinaryMetaTest, VariablesConfigRoundTrip) {
+  const std::vector<Om2VarMeta> var_metas = {MakeVarMeta(0U, "var_0"), MakeVarMeta(1U, "var_1")};
+  std::vector<uint8_t> buffer;
+  ASSERT_EQ(Om2BinaryMetaCodec::EncodeVariablesConfig(var_metas, 7U, buffer), SUCCESS);
+
+  std::vector<Om2VarMeta> decoded;
+  uint32_t graph_id = 0U;
+  ASSERT_EQ(Om2BinaryMetaCodec::DecodeVariablesConfig(buffer.data(), buffer.size(), decoded, graph_id), SUCCESS);
+  EXPECT_EQ(graph_id, 7U);
+  ASSERT_EQ(decoded.size(), var_metas.size());
+  for (size_t i = 0U; i < decoded.size(); ++i) {
+    EXPECT_EQ(decoded[i].index, var_metas[i].index);
+    EXPECT_EQ(decoded[i].var_name, var_metas[i].var_name);
+    EXPECT_EQ(decoded[i].op_type, var_metas[i].op_type);
+    EXPECT_EQ(decoded[i].op_name, var_metas[i].op_name);
+    EXPECT_EQ(decoded[i].tensor_desc.GetName(), var_metas[i].tensor_desc.GetName());
+    EXPECT_EQ(decoded[i].tensor_desc.GetShape(), var_metas[i].tensor_desc.GetShape());
+    EXPECT_EQ(decoded[i].tensor_desc.GetShapeRange(), var_metas[i].tensor_desc.GetShapeRange());
+    EXPECT_EQ(decoded[i].tensor_desc.GetDataType(), DT_FLOAT16);
+    EXPECT_EQ(decoded[i].tensor_desc.GetFormat(), FORMAT_NCHW);
+    EXPECT_EQ(decoded[i].tensor_desc.GetSize(), 1024U);
+  }
+}
+
+TEST_F(Om2BinaryMetaTest, DecodeFailedWhenDataInvalid) {
+  std::map<std::string, std::map<std::string, std::string>> op_attr_map;
+  op_attr_map["conv1"] = {{"_kernelname", "conv_kernel"}};
+  std::vector<uint8_t> buffer;
+  ASSERT_EQ(Om2BinaryMetaCodec::EncodeOpAttrMap(op_attr_map, buffer), SUCCESS);
+
+  std::map<std::string, std::map<std::string, std::string>> decoded;
+  // 截断
+  EXPECT_NE(Om2BinaryMetaCodec::DecodeOpAttrMap(buffer.data(), buffer.size() - 1U, decoded), SUCCESS);
+  // 类型不匹配
+  std::vector<Om2VarMeta> var_metas;
+  uint32_t graph_id = 0U;
+  EXPECT_NE(Om2BinaryMetaCodec::DecodeVariablesConfig(buffer.data(), buffer.size(), var_metas, graph_id), SUCCESS);
+  // 主版本号不一致
+  auto wrong_version = buffer;
+  wrong_version[4U] = 0xFFU;
+  EXPECT_NE(Om2BinaryMetaCodec::DecodeOpAttrMap(wrong_version.data(), wrong_version.size(), decoded), SUCCESS);
+  // json内容
+  const std::string json_str = "{\"conv1\":{}}";
+  EXPECT_FALSE(Om2BinaryMetaCodec::IsBinaryMeta(reinterpret_cast<const uint8_t *>(json_str.data()), json_str.size()));
+  EXPECT_NE(Om2BinaryMetaCodec::DecodeOpAttrMap(reinterpret_cast<const uint8_t *>(json_str.data()), json_str.size(),
+                                                decoded),
+            SUCCESS);
+}
+}  // namespace
+}  // namespace ge
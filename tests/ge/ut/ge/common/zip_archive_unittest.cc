@@ -676,4 +676,38 @@ TEST_F(ZipArchiveUt, TestSimpleZipArchiveReader_Ok_ListFilesFromCompressedArchiv
   const auto file_names = reader.ListFiles();
   ASSERT_EQ(file_names.size(), 2U);
 }
+TEST_F(ZipArchiveUt, TestZipArchiveWriter_Ok_AlignedNoCompressionEntryReadInPlace) {
+  const std::string zipfile_name = kZipFileBaseName + "_aligned.zip";
+  const auto zipfile_path = PathUtils::Join({test_work_dir, zipfile_name});
+  constexpr size_t kAlignment = 64U;
+  ModelBufferData model;
+  const std::vector<std::string> arc_names = {"a.bin", "dir/bb.bin", "dir/sub/ccc.bin"};
+  {
+    ZipArchiveWriter zip_writer(zipfile_path);
+    ASSERT_TRUE(zip_writer.IsMemFileOpened());
+    const std::string odd_data(13, 'x');
+    for (const auto &arc_name : arc_names) {
+      // 前置一个不对齐的entry，确保填充长度各不相同
+      EXPECT_TRUE(zip_writer.WriteBytes(arc_name + ".pad", odd_data.data(), odd_data.size(), false));
+      EXPECT_TRUE(zip_writer.WriteBytes(arc_name, arc_name.data(), arc_name.size(), false, kAlignment));
+    }
+    EXPECT_TRUE(zip_writer.WriteBytes("compressed.bin", odd_data.data(), odd_data.size(), true, kAlignment));
+    ASSERT_TRUE(zip_writer.SaveModelData(model, false));
+  }
+
+  RAIIZipArchive archive(model.data.get(), model.length);
+  ASSERT_TRUE(archive.IsGood());
+  for (const auto &arc_name : arc_names) {
+    const auto entry_name = PathUtils::Join({kZipFileBaseName, arc_name});
+    EXPECT_TRUE(archive.IsInPlaceReadable(entry_name));
+    size_t extracted_size = 0UL;
+    const auto extracted = archive.ExtractToMem(entry_name, extracted_size);
+    ASSERT_NE(extracted, nullptr);
+    ASSERT_EQ(extracted_size, arc_name.size());
+    EXPECT_EQ(std::memcmp(extracted.get(), arc_name.data(), extracted_size), 0);
+    EXPECT_EQ(static_cast<size_t>(extracted.get() - model.data.get()) % kAlignment, 0U);
+  }
+  EXPECT_FALSE(archive.IsInPlaceReadable(PathUtils::Join({kZipFileBaseName, "compressed.bin"})));
+  EXPECT_FALSE(archive.IsInPlaceReadable("not_exist.bin"));
+}
 }  // namespace ge
@@ -0,0 +1,86 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "graph/load/model_manager/args_patch_program.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace ge {
+class ArgsPatchProgramUT : public testing::Test {};
+
+TEST_F(ArgsPatchProgramUT, Compile_ContiguousAndStridedPatchesMergedIntoRuns) {
+  std::vector<uint64_t> host_args(64U, 0U);
+  ArgsPatchProgram program;
+  program.Reset(2U);
+  // 乱序添加的连续刷新点，编译后合并为一个run
+  for (size_t i = 8U; i > 0U; --i) {
+    ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrAll, &host_args[i - 1U], i * 0x10U),
+              SUCCESS);
+  }
+  // 间隔4个uint64的刷新点，编译后合并为一个strided run
+  for (size_t i = 0U; i < 8U; ++i) {
+    ASSERT_EQ(program.AddPatch(1U, ArgsPatchProgram::PatchFormat::kAddrAll, &host_args[16U + i * 4U], i), SUCCESS);
+  }
+  ASSERT_EQ(program.Compile(), SUCCESS);
+  EXPECT_EQ(program.GetRunNum(0U), 1U);
+  EXPECT_EQ(program.GetRunNum(1U), 1U);
+  EXPECT_EQ(program.GetPatchNum(0U), 8U);
+  EXPECT_EQ(program.GetTotalPatchNum(), 16U);
+  EXPECT_NE(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrAll, &host_args[0U], 0U), SUCCESS);
+
+  EXPECT_EQ(program.Execute(0U, 0x1000U), 8U);
+  for (size_t i = 0U; i < 8U; ++i) {
+    EXPECT_EQ(host_args[i], 0x1000U + (i + 1U) * 0x10U);
+  }
+  EXPECT_EQ(program.Execute(1U, 0x2000U), 8U);
+  for (size_t i = 0U; i < 8U; ++i) {
+    EXPECT_EQ(host_args[16U + i * 4U], 0x2000U + i);
+    EXPECT_EQ(host_args[17U + i * 4U], 0U);
+  }
+  // 越界的allocation id不刷新
+  EXPECT_EQ(program.Execute(2U, 0x3000U), 0U);
+}
+
+TEST_F(ArgsPatchProgramUT, Execute_Low32AndHigh32Bit_SameAsPerAddrUpdate) {
+  std::vector<uint32_t> host_args(8U, 0U);
+  ArgsPatchProgram program;
+  program.Reset(1U);
+  ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrLow32Bit, &host_args[0U], 0x8U), SUCCESS);
+  ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrHigh32Bit, &host_args[1U], 0x8U), SUCCESS);
+  ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrLow32Bit, &host_args[2U], 0x10U), SUCCESS);
+  ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrHigh32Bit, &host_args[3U], 0x10U), SUCCESS);
+  // 相同地址重复添加时以最后一次为准
+  ASSERT_EQ(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrLow32Bit, &host_args[2U], 0x20U), SUCCESS);
+  ASSERT_EQ(program.Compile(), SUCCESS);
+  // 零散的刷新点按格式合并为indexed run
+  EXPECT_EQ(program.GetRunNum(0U), 2U);
+  EXPECT_EQ(program.GetPatchNum(0U), 4U);
+
+  const uint64_t base = 0x1234567FFFFFFFF8UL;
+  EXPECT_EQ(program.Execute(0U, base), 4U);
+  EXPECT_EQ(host_args[0U], static_cast<uint32_t>(base + 0x8U));
+  EXPECT_EQ(host_args[1U], static_cast<uint32_t>((base + 0x8U) >> 32U));
+  EXPECT_EQ(host_args[2U], static_cast<uint32_t>(base + 0x20U));
+  EXPECT_EQ(host_args[3U], static_cast<uint32_t>((base + 0x10U) >> 32U));
+}
+
+TEST_F(ArgsPatchProgramUT, AddPatch_Failed_InvalidParams) {
+  uint64_t host_arg = 0U;
+  ArgsPatchProgram program;
+  program.Reset(1U);
+  EXPECT_NE(program.AddPatch(1U, ArgsPatchProgram::PatchFormat::kAddrAll, &host_arg, 0U), SUCCESS);
+  EXPECT_NE(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kEnd, &host_arg, 0U), SUCCESS);
+  EXPECT_NE(program.AddPatch(0U, ArgsPatchProgram::PatchFormat::kAddrAll, nullptr, 0U), SUCCESS);
+  ASSERT_EQ(program.Compile(), SUCCESS);
+  EXPECT_TRUE(program.IsCompiled());
+  EXPECT_EQ(program.GetTotalRunNum(), 0U);
+  EXPECT_NE(program.Compile(), SUCCESS);
+}
+}  // namespace ge
@@ -10,7 +10,10 @@
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <fstream>
 
 #include "ge_graph_dsl/graph_dsl.h"
@@ -7548,6 +7551,162 @@ TEST_F(UtestDavinciModel, InputMergeCopy) {
   ge::GetThreadLocalContext().SetGraphOption({});  // restore option
 }
 
+// 开启预取后，第N+1步的合并输入在第N步执行期间于独立的拷贝流上H2D，第N+1步开始时模型流等待并D2D到输入内存
+TEST_F(UtestDavinciModel, InputMergeCopyPrefetch_OverlapWithRunningStep) {
+  // 记录模型流与拷贝流上的下发顺序，并在每步下发执行时保存模型输入内存中的数据
+  class RecordRuntime : public AclRuntimeStub {
+   public:
+    aclError aclrtMemcpyAsync(void *dst, size_t dest_max, const void *src, size_t src_count, aclrtMemcpyKind kind,
+                              aclrtStream stream) override {
+      {
+        const std::lock_guard<std::mutex> lk(mu);
+        if ((kind == ACL_MEMCPY_HOST_TO_DEVICE) && (stream == copy_stream)) {
+          records.emplace_back("h2d", stream);
+        }
+        if ((kind == ACL_MEMCPY_DEVICE_TO_DEVICE) && (dst == device_input)) {
+          records.emplace_back("d2d", stream);
+        }
+      }
+      return AclRuntimeStub::aclrtMemcpyAsync(dst, dest_max, src, src_count, kind, stream);
+    }
+    aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event) override {
+      const std::lock_guard<std::mutex> lk(mu);
+      records.emplace_back("wait", stream);
+      return AclRuntimeStub::aclrtStreamWaitEvent(stream, event);
+    }
+    aclError aclmdlRIExecuteAsync(aclmdlRI model_ri, aclrtStream stream) override {
+      const std::lock_guard<std::mutex> lk(mu);
+      records.emplace_back("exec", stream);
+      inputs_at_exec.emplace_back(device_input[0U], device_input[input0_offset]);
+      return AclRuntimeStub::aclmdlRIExecuteAsync(model_ri, stream);
+    }
+    aclError aclrtSynchronizeStreamWithTimeout(aclrtStream stream, int32_t timeout) override {
+      const std::lock_guard<std::mutex> lk(mu);
+      records.emplace_back("sync", stream);
+      return AclRuntimeStub::aclrtSynchronizeStreamWithTimeout(stream, timeout);
+    }
+    std::mutex mu;
+    std::vector<std::pair<std::string, aclrtStream>> records;
+    std::vector<std::pair<uint8_t, uint8_t>> inputs_at_exec;
+    aclrtStream copy_stream{nullptr};
+    uint8_t *device_input{nullptr};
+    size_t input0_offset{0U};
+  };
+
+  const uint64_t input_fusion_size = 25600U;
+  const uint64_t start_logic_addr = 30902000U;  // random value for test
+  std::map<std::string, std::string> options_map;
+  options_map[OPTION_EXEC_INPUT_FUSION_SIZE] = std::to_string(input_fusion_size);
+  options_map["ge.exec.inputMergeCopyPrefetch"] = "1";
+  ge::GetThreadLocalContext().SetGraphOption(options_map);
+
+  const uint64_t input0_size = input_fusion_size - 1U;  // merge copy
+  const uint64_t input1_size = input_fusion_size;       // merge copy
+  const uint64_t input2_size = input_fusion_size + 1U;  // non-merge copy
+
+  DavinciModel model(0, nullptr);
+  model.SetId(1);
+  model.zero_copy_input_indexes_ = {0U, 1U, 2U};
+  model.input_index_to_allocation_ids_ = {0U, 1U, 2U};
+  // device mem layout: input1-input0-input2
+  MemAllocation mem_allocation0 = {};
+  mem_allocation0.data_size = input0_size + 32U;
+  mem_allocation0.tensor_size = input0_size;
+  mem_allocation0.logical_addr = start_logic_addr;
+  MemAllocation mem_allocation1 = {};
+  mem_allocation1.data_size = input1_size + 32U;
+  mem_allocation1.tensor_size = input1_size;
+  mem_allocation1.logical_addr = start_logic_addr - mem_allocation1.data_size;
+  MemAllocation mem_allocation2 = {};
+  mem_allocation2.data_size = input2_size + 32U;
+  mem_allocation2.tensor_size = input2_size;
+  mem_allocation2.logical_addr = start_logic_addr + mem_allocation0.data_size;
+  model.logical_mem_allocations_ = {mem_allocation0, mem_allocation1, mem_allocation2};
+  const auto total_size = mem_allocation0.logical_addr + mem_allocation0.data_size - mem_allocation1.logical_addr;
+
+  std::vector<uint8_t> device_buffer(total_size, 0U);
+  ZeroCopyOffset zero_copy_offset0 = {};
+  ZeroCopyOffset zero_copy_offset1 = {};
+  ZeroCopyOffset zero_copy_offset2 = {};
+  zero_copy_offset0.data_size_ = mem_allocation0.data_size;
+  zero_copy_offset1.data_size_ = mem_allocation1.data_size;
+  zero_copy_offset2.data_size_ = mem_allocation2.data_size;
+  zero_copy_offset1.basic_addr_ = device_buffer.data();
+  model.input_data_info_[0] = zero_copy_offset0;
+  model.input_data_info_[1] = zero_copy_offset1;
+  model.input_data_info_[2] = zero_copy_offset2;
+
+  auto runtime = std::make_shared<RecordRuntime>();
+  AclRuntimeStub::SetInstance(runtime);
+  model.InitModelInputsMergeCopyHostMem();
+  ASSERT_NE(model.input_merge_copy_prefetcher_, nullptr);
+  runtime->copy_stream = model.input_merge_copy_prefetcher_->GetCopyStream();
+  runtime->device_input = device_buffer.data();
+  runtime->input0_offset = mem_allocation1.data_size;
+  model.global_step_addr_ = 0U;  // to skip HandleInputData() -> UpdateStepInfo()
+  model.is_online_infer_dynamic_ = false;
+
+  // 3步的输入在启动前已全部入队，第N步执行时可以取到第N+1步
+  constexpr size_t kStepNum = 3U;
+  const std::vector<uint64_t> input_sizes = {input0_size, input1_size, input2_size};
+  std::vector<std::vector<std::vector<uint8_t>>> host_inputs(kStepNum);
+  std::atomic<size_t> done_count{0U};
+  for (size_t step = 0U; step < kStepNum; ++step) {
+    auto args = std::make_shared<RunArgs>();
+    args->callback = [&done_count](Status result, std::vector<gert::Tensor> &outputs) {
+      (void)outputs;
+      if (result == SUCCESS) {
+        ++done_count;
+      }
+    };
+    for (size_t i = 0U; i < input_sizes.size(); ++i) {
+      host_inputs[step].emplace_back(input_sizes[i], static_cast<uint8_t>((step + 1U) * 10U + i));
+      gert::Tensor tensor = {{{static_cast<int64_t>(input_sizes[i])}, {static_cast<int64_t>(input_sizes[i])}},
+                             {ge::FORMAT_ND, ge::FORMAT_ND, {}},
+                             gert::kOnHost,
+                             ge::DT_UINT8,
+                             host_inputs[step][i].data()};
+      tensor.MutableTensorData().SetSize(input_sizes[i]);
+      args->input_tensor.emplace_back(std::move(tensor));
+    }
+    model.data_inputer_.Push(args);
+  }
+  model.reusable_stream_allocator_ = ReusableStreamAllocator::Create();
+  EXPECT_EQ(model.ModelRunStart(), SUCCESS);
+  for (size_t i = 0U; (i < 100U) && (done_count.load() < kStepNum); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(done_count.load(), kStepNum);
+  std::vector<std::pair<std::string, aclrtStream>> records;
+  std::vector<std::pair<uint8_t, uint8_t>> inputs_at_exec;
+  {
+    const std::lock_guard<std::mutex> lk(runtime->mu);
+    records = runtime->records;
+    inputs_at_exec = runtime->inputs_at_exec;
+  }
+  const aclrtStream model_stream = model.rt_model_stream_;
+  EXPECT_EQ(model.ModelRunStop(), SUCCESS);
+
+  // 第N+1步的H2D在第N步执行下发之后、等待第N步完成之前，且在拷贝流上
+  const std::vector<std::string> expect_ops = {"exec", "h2d",  "sync", "wait", "d2d", "exec",
+                                               "h2d",  "sync", "wait", "d2d",  "exec", "sync"};
+  ASSERT_GE(records.size(), expect_ops.size());
+  for (size_t i = 0U; i < expect_ops.size(); ++i) {
+    EXPECT_EQ(records[i].first, expect_ops[i]) << "index " << i;
+    const aclrtStream expect_stream = (expect_ops[i] == "h2d") ? runtime->copy_stream : model_stream;
+    EXPECT_EQ(records[i].second, expect_stream) << "index " << i;
+  }
+  EXPECT_NE(runtime->copy_stream, model_stream);
+  // 每步执行时模型输入内存中都是本步的数据
+  ASSERT_EQ(inputs_at_exec.size(), kStepNum);
+  for (size_t step = 0U; step < kStepNum; ++step) {
+    EXPECT_EQ(inputs_at_exec[step].first, host_inputs[step][1U][0U]);
+    EXPECT_EQ(inputs_at_exec[step].second, host_inputs[step][0U][0U]);
+  }
+  AclRuntimeStub::Reset();
+  ge::GetThreadLocalContext().SetGraphOption({});
+}
+
 TEST_F(UtestDavinciModel, InitModelInputsMergeCopyHostMem_rtMallocHost_fail) {
   class MockAclRuntime : public ge::AclRuntimeStub {
    public:
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "graph/load/model_manager/input_merge_copy_prefetcher.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "ascendcl/src/ascendcl_stub.h"
+
+namespace ge {
+namespace {
+// 模拟拷贝流上的H2D尚未完成，并记录暂存内存的使用情况
+class PrefetchRuntime : public AclRuntimeStub {
+ public:
+  aclError aclrtMemcpyAsync(void *dst, size_t dest_max, const void *src, size_t src_count, aclrtMemcpyKind kind,
+                            aclrtStream stream) override {
+    if (kind == ACL_MEMCPY_HOST_TO_DEVICE) {
+      h2d_dsts.emplace_back(dst);
+    } else if (kind == ACL_MEMCPY_DEVICE_TO_DEVICE) {
+      d2d_srcs.emplace_back(src);
+    }
+    return AclRuntimeStub::aclrtMemcpyAsync(dst, dest_max, src, src_count, kind, stream);
+  }
+  aclError aclrtQueryEventStatus(aclrtEvent event, aclrtEventRecordedStatus *status) override {
+    (void)event;
+    *status = copy_done ? ACL_EVENT_RECORDED_STATUS_COMPLETE : ACL_EVENT_RECORDED_STATUS_NOT_READY;
+    return ACL_SUCCESS;
+  }
+  aclError aclrtSynchronizeEventWithTimeout(aclrtEvent event, int32_t timeout) override {
+    (void)event;
+    (void)timeout;
+    ++event_sync_count;
+    return ACL_SUCCESS;
+  }
+  aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event) override {
+    (void)event;
+    wait_streams.emplace_back(stream);
+    return ACL_SUCCESS;
+  }
+  std::vector<void *> h2d_dsts;
+  std::vector<const void *> d2d_srcs;
+  std::vector<aclrtStream> wait_streams;
+  size_t event_sync_count{0U};
+  bool copy_done{true};
+};
+}  // namespace
+
+class InputMergeCopyPrefetcherUT : public testing::Test {
+ protected:
+  void TearDown() override {
+    AclRuntimeStub::Reset();
+  }
+};
+
+TEST_F(InputMergeCopyPrefetcherUT, Init_InvalidParam_Failed) {
+  InputMergeCopyPrefetcher prefetcher;
+  uint8_t *host_addr = nullptr;
+  EXPECT_NE(prefetcher.AcquireHostBuffer(host_addr, -1), SUCCESS);
+  EXPECT_NE(prefetcher.Submit(), SUCCESS);
+  EXPECT_NE(prefetcher.Init(0UL), SUCCESS);
+  ASSERT_EQ(prefetcher.Init(64UL), SUCCESS);
+  EXPECT_NE(prefetcher.Init(64UL), SUCCESS);
+  EXPECT_EQ(prefetcher.GetBufferSize(), 64UL);
+  EXPECT_NE(prefetcher.GetCopyStream(), nullptr);
+  EXPECT_FALSE(prefetcher.IsReady());
+  uint64_t device_input = 0UL;
+  EXPECT_NE(prefetcher.Consume(&device_input, nullptr), SUCCESS);
+}
+
+TEST_F(InputMergeCopyPrefetcherUT, SubmitAndConsume_CopyToModelInput) {
+  auto runtime = std::make_shared<PrefetchRuntime>();
+  AclRuntimeStub::SetInstance(runtime);
+  InputMergeCopyPrefetcher prefetcher;
+  ASSERT_EQ(prefetcher.Init(sizeof(uint64_t)), SUCCESS);
+  int32_t model_stream_holder = 0;
+  aclrtStream model_stream = &model_stream_holder;
+  uint64_t device_input = 0UL;
+  for (uint64_t step = 1UL; step <= 4UL; ++step) {
+    uint8_t *host_addr = nullptr;
+    ASSERT_EQ(prefetcher.AcquireHostBuffer(host_addr, -1), SUCCESS);
+    *reinterpret_cast<uint64_t *>(host_addr) = step;
+    ASSERT_EQ(prefetcher.Submit(), SUCCESS);
+    EXPECT_TRUE(prefetcher.IsReady());
+    // 上一次预取未消费前不能再次预取
+    EXPECT_NE(prefetcher.AcquireHostBuffer(host_addr, -1), SUCCESS);
+    EXPECT_NE(prefetcher.Submit(), SUCCESS);
+    ASSERT_EQ(prefetcher.Consume(&device_input, model_stream), SUCCESS);
+    EXPECT_FALSE(prefetcher.IsReady());
+    EXPECT_EQ(device_input, step);
+  }
+  // 模型流等待预取拷贝完成，两份暂存内存交替使用，D2D读取的就是刚刚H2D写入的那一份
+  ASSERT_EQ(runtime->wait_streams.size(), 4U);
+  for (const auto stream : runtime->wait_streams) {
+    EXPECT_EQ(stream, model_stream);
+  }
+  ASSERT_EQ(runtime->h2d_dsts.size(), 4U);
+  ASSERT_EQ(runtime->d2d_srcs.size(), 4U);
+  EXPECT_NE(runtime->h2d_dsts[0U], runtime->h2d_dsts[1U]);
+  EXPECT_EQ(runtime->h2d_dsts[0U], runtime->h2d_dsts[2U]);
+  EXPECT_EQ(runtime->h2d_dsts[1U], runtime->h2d_dsts[3U]);
+  for (size_t i = 0U; i < runtime->h2d_dsts.size(); ++i) {
+    EXPECT_EQ(runtime->d2d_srcs[i], runtime->h2d_dsts[i]);
+  }
+  EXPECT_EQ(runtime->event_sync_count, 0U);
+  EXPECT_NE(prefetcher.Consume(&device_input, model_stream), SUCCESS);
+}
+
+TEST_F(InputMergeCopyPrefetcherUT, Discard_ReuseBufferAfterCopyFinished) {
+  auto runtime = std::make_shared<PrefetchRuntime>();
+  AclRuntimeStub::SetInstance(runtime);
+  InputMergeCopyPrefetcher prefetcher;
+  ASSERT_EQ(prefetcher.Init(16UL), SUCCESS);
+  runtime->copy_done = false;
+  uint8_t *first_addr = nullptr;
+  ASSERT_EQ(prefetcher.AcquireHostBuffer(first_addr, -1), SUCCESS);
+  ASSERT_EQ(prefetcher.Submit(), SUCCESS);
+  prefetcher.Discard();
+  EXPECT_FALSE(prefetcher.IsReady());
+  // 被丢弃的预取没有被消费，仍写入同一份内存，但需等待其在途的拷贝完成
+  uint8_t *second_addr = nullptr;
+  ASSERT_EQ(prefetcher.AcquireHostBuffer(second_addr, -1), SUCCESS);
+  EXPECT_EQ(first_addr, second_addr);
+  EXPECT_EQ(runtime->event_sync_count, 1U);
+  ASSERT_EQ(prefetcher.Submit(), SUCCESS);
+  ASSERT_EQ(runtime->h2d_dsts.size(), 2U);
+  EXPECT_EQ(runtime->h2d_dsts[0U], runtime->h2d_dsts[1U]);
+}
+}  // namespace ge
@@ -212,6 +212,14 @@ class MockCustomOpTaskInfo : public TaskInfo {
   int update_host_args_void_calls_;
 };
 
+class ConcurrentParseAicoreStubTaskInfo : public AicoreStubTaskInfo {
+ public:
+  explicit ConcurrentParseAicoreStubTaskInfo(TaskInfoRegistryStub *registry) : AicoreStubTaskInfo(registry) {}
+  bool IsParseTaskRunParamConcurrent() const override {
+    return true;
+  }
+};
+
 class ModelArgsManagerUT : public testing::Test {};
 /**
  * 预置条件：
@@ -264,6 +272,48 @@ TEST_F(ModelArgsManagerUT, InitV2_TaskInitParametersCorrect_AllRefreshable) {
   ASSERT_TRUE(checker.CheckOutputAddrs(ret, {{MemoryAppType::kMemoryTypeModelIo, true}})) << ret;
   ASSERT_TRUE(checker.CheckWsAddrs(ret, {{MemoryAppType::kMemoryTypeFeatureMap, true}})) << ret;
 }
+TEST_F(ModelArgsManagerUT, InitV2_ParseTaskRunParamConcurrently_SameAsSerialParse) {
+  gert::GertRuntimeStub runtime_stub;
+  runtime_stub.GetTaskInfoFactoryStub().StubTaskInfo<ConcurrentParseAicoreStubTaskInfo>(
+      ModelTaskType::MODEL_TASK_KERNEL);
+  auto graph = gert::ShareGraph::BuildTwoAddNodeKnownShapeGraph();
+  graph->TopologicalSorting();
+  auto model = gert::GeModelBuilder(graph)
+                   .AddTaskDef("add1", gert::AiCoreTaskDefFaker("add1"))
+                   .AddTaskDef("add2", gert::AiCoreTaskDefFaker("add2"))
+                   .Build();
+  // 复制task def，使可并发解析的task数超过并发解析阈值
+  auto model_task_def = model->GetModelTaskDefPtr();
+  const domi::TaskDef add1_task_def = model_task_def->task(0);
+  const domi::TaskDef add2_task_def = model_task_def->task(1);
+  constexpr size_t kTaskNum = 2048UL;
+  for (size_t i = 2UL; i < kTaskNum; ++i) {
+    *model_task_def->add_task() = ((i % 2UL) == 0UL) ? add1_task_def : add2_task_def;
+  }
+
+  auto davinci_model = DavinciModelFaker()
+                           .SetFmRefreshable(true)
+                           .GeModel(model)
+                           .GenerateSymbolForTaskInfoFaker(&(runtime_stub.GetTaskInfoFactoryStub()))
+                           .Build();
+  InsertStubAllocator(davinci_model.get());
+  ModelArgsManager mam(davinci_model.get());
+  std::vector<TaskInfoPtr> task_list;
+  ASSERT_EQ(mam.Init(*model_task_def, &task_list), SUCCESS);
+  ASSERT_EQ(task_list.size(), kTaskNum);
+  EXPECT_EQ(mam.GetLoadPhaseCost().concurrent_parse_task_num, kTaskNum);
+  EXPECT_GT(mam.GetLoadPhaseCost().parse_thread_num, 1UL);
+
+  for (size_t i = 2UL; i < kTaskNum; ++i) {
+    const auto *expect = reinterpret_cast<StubTaskInfo *>(task_list[i % 2UL].get());
+    const auto *actual = reinterpret_cast<StubTaskInfo *>(task_list[i].get());
+    ASSERT_EQ(actual->GetGenInputAddrs(), expect->GetGenInputAddrs()) << "task index " << i;
+    ASSERT_EQ(actual->GetGenOutputAddrs(), expect->GetGenOutputAddrs()) << "task index " << i;
+    ASSERT_EQ(actual->GetGenWsAddrs(), expect->GetGenWsAddrs()) << "task index " << i;
+    ASSERT_EQ(actual->GetGenTaskArgsLen(), expect->GetGenTaskArgsLen()) << "task index " << i;
+    ASSERT_EQ(actual->GetInitCalls().size(), 1UL) << "task index " << i;
+  }
+}
 /**
  * 预置条件：
  * 1. feature map refreshable: false
@@ -1354,6 +1354,70 @@ TEST_F(Om2PackageHelperUt, Serialize_OnlineMode_ExternalConst_HasFilePath) {
   EXPECT_NE(constants_json.find("/data/weights/external_weight.bin"), std::string::npos);
 }
 
+TEST_F(Om2PackageHelperUt, Serialize_BinaryMetaFormat_EntriesAlignedAndDecodable) {
+  gert::Om2ModelData model_data;
+  model_data.model_meta.model_name = "test_model";
+  model_data.model_meta.root_graph_name = "test_graph";
+  Om2ConstMeta const_meta;
+  const_meta.index = 0U;
+  const_meta.type = "EXTERNAL";
+  const_meta.file_name = "external_weight.bin";
+  const_meta.file_path = "/data/weights/external_weight.bin";
+  const_meta.size = 1024;
+  const_meta.op_name = "const_op";
+  model_data.constants_data.consts.push_back(const_meta);
+  Om2VarMeta var_meta;
+  var_meta.var_name = "var_0";
+  var_meta.op_type = "Variable";
+  model_data.var_metas.push_back(var_meta);
+  model_data.graph_id = 3U;
+  model_data.debug_info.op_attr_map["conv1"] = {{"_kernelname", "conv_kernel"}};
+  model_data.program_body.so_artifact.file_name = "libtest.so";
+  model_data.program_body.so_artifact.data = "fake_so_content";
+  model_data.debug_info.visual_json = R"({"format":"ge_visual_json","format_version":1,"model":{"graph":[]}})";
+
+  const std::string writer_path = PathUtils::Join({test_work_dir, "binary_meta.om2"});
+  ModelBufferData model_buffer;
+  ASSERT_EQ(Om2ZipSaver::Save(model_data, model_buffer, false, writer_path, Om2MetaFormat::kBinary), SUCCESS);
+
+  RAIIZipArchive archive(model_buffer.data.get(), model_buffer.length);
+  ASSERT_TRUE(archive.IsGood());
+  size_t binary_entry_num = 0U;
+  for (const auto &name : archive.ListFiles()) {
+    EXPECT_EQ(name.find("constants_config.json"), std::string::npos);
+    EXPECT_EQ(name.find("variables_config.json"), std::string::npos);
+    EXPECT_EQ(name.find("op_attr.json"), std::string::npos);
+    if (name.find(OM2_BINARY_META_SUFFIX) == std::string::npos) {
+      continue;
+    }
+    ++binary_entry_num;
+    ASSERT_TRUE(archive.IsInPlaceReadable(name));
+    size_t buf_size = 0U;
+    const auto buf = archive.ExtractToMem(name, buf_size);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(static_cast<size_t>(buf.get() - model_buffer.data.get()) % kOm2BinaryMetaAlignment, 0U);
+    if (name.find("constants_config") != std::string::npos) {
+      Om2ConstMetas consts;
+      size_t internal_weight_size = 0U;
+      ASSERT_EQ(Om2BinaryMetaCodec::DecodeConstantsConfig(buf.get(), buf_size, consts, internal_weight_size), SUCCESS);
+      ASSERT_EQ(consts.size(), 1U);
+      EXPECT_EQ(consts[0U].file_path, "/data/weights/external_weight.bin");
+    } else if (name.find("variables_config") != std::string::npos) {
+      std::vector<Om2VarMeta> var_metas;
+      uint32_t graph_id = 0U;
+      ASSERT_EQ(Om2BinaryMetaCodec::DecodeVariablesConfig(buf.get(), buf_size, var_metas, graph_id), SUCCESS);
+      ASSERT_EQ(var_metas.size(), 1U);
+      EXPECT_EQ(var_metas[0U].var_name, "var_0");
+      EXPECT_EQ(graph_id, 3U);
+    } else {
+      std::map<std::string, std::map<std::string, std::string>> op_attr_map;
+      ASSERT_EQ(Om2BinaryMetaCodec::DecodeOpAttrMap(buf.get(), buf_size, op_attr_map), SUCCESS);
+      EXPECT_EQ(op_attr_map, model_data.debug_info.op_attr_map);
+    }
+  }
+  EXPECT_EQ(binary_entry_num, 3U);
+}
+
 TEST_F(Om2PackageHelperUt, Om2CodegenAndCompile_Success) {
   const auto ge_root_model = CreateGeRootModelWithAicoreOp();
   ASSERT_NE(ge_root_model, nullptr);
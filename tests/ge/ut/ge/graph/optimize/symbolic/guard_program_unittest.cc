@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <memory>
+#include <random>
+#include <gtest/gtest.h>
+#include <dlfcn.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "graph/utils/graph_utils_ex.h"
+#include "es_ge_test_ops_c.h"
+#include "common/env_path.h"
+#include "graph/optimize/symbolic/codegen/guard_codegen.h"
+#include "graph/optimize/symbolic/codegen/guard_program_lowering.h"
+#include "common/guard/guard_program.h"
+#include "attribute_group/attr_group_shape_env.h"
+#include "graph/symbolizer/symbolic.h"
+#include "graph/utils/attr_utils.h"
+#include "graph/ge_local_context.h"
+#include "graph/optimize/symbolic/shape_env_guarder.h"
+#include "compiler/graph/optimize/symbolic/infer_symbolic_shape/symbolic_shape_symbolizer.h"
+
+namespace ge {
+namespace {
+// 只能通过codegen取值的符号来源
+class CodegenOnlySource : public Source {
+ public:
+  std::string GetSourceStr() const override {
+    return "0";
+  }
+};
+
+gert::Tensor MakeShapeTensor(const std::initializer_list<int64_t> &dims) {
+  return {{dims, dims},                                // shape
+          {ge::FORMAT_ND, ge::FORMAT_ND, {}},          // format
+          gert::kOnDeviceHbm,                          // placement
+          ge::DT_FLOAT16,                              // data type
+          (void *)0x0};
+}
+}  // namespace
+
+class GuardProgramUT : public testing::Test {
+ public:
+  void SetUp() override {
+    const auto env_ptr = getenv("LD_PRELOAD");
+    if (env_ptr != nullptr) {
+      env = env_ptr;
+      unsetenv("LD_PRELOAD");
+    }
+    auto ascend_install_path = EnvPath().GetAscendInstallPath();
+    setenv("ASCEND_OPP_PATH", (ascend_install_path + "/opp").c_str(), 1);
+    setenv("LD_LIBRARY_PATH", (ascend_install_path + "/runtime/lib64").c_str(), 1);
+    graph_ = EsCreateGraphBuilder("Hello");
+  }
+
+  void TearDown() override {
+    EsDestroyGraphBuilder(graph_);
+    graph_ = nullptr;
+    unsetenv("ASCEND_OPP_PATH");
+    unsetenv("LD_LIBRARY_PATH");
+    if (!env.empty()) {
+      setenv("LD_PRELOAD", env.c_str(), 1);
+    }
+  }
+
+  ComputeGraphPtr BuildGraph() {
+    graph_holder_ = std::unique_ptr<Graph>(reinterpret_cast<Graph *>(EsBuildGraphAndReset(graph_)));
+    return GraphUtilsEx::GetComputeGraph(*graph_holder_);
+  }
+
+  EsCGraphBuilder *graph_{nullptr};
+  std::unique_ptr<Graph> graph_holder_;
+  std::string env;
+};
+
+TEST_F(GuardProgramUT, LowerGuardAndCheck) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(3, MakeShared<InputShapeSource>(0, 0));
+  auto symbol1 = attr->CreateSymbol(4, MakeShared<InputShapeSource>(0, 1));
+  auto symbol2 = attr->CreateSymbol(5, MakeShared<InputShapeSource>(0, 2));
+  auto symbol3 = attr->CreateSymbol(7, MakeShared<InputShapeSource>(1, 0));
+  auto symbol4 = attr->CreateSymbol(3, MakeShared<InputShapeSource>(1, 1));
+  auto symbol5 = attr->CreateSymbol(4, MakeShared<InputShapeSource>(1, 2));
+  auto symbol6 = attr->CreateSymbol(5, MakeShared<InputShapeSource>(1, 3));
+  EXPECT_SYMBOL_EQ(symbol0, symbol4);
+  EXPECT_SYMBOL_NE(symbol1, symbol2);
+  EXPECT_SYMBOL_LE(sym::Max(symbol0, symbol5), sym::Min(symbol6, Symbol(8)));
+  EXPECT_SYMBOL_LT(sym::Pow(symbol1, sym::Rational(1, 2)), symbol3);
+  EXPECT_SYMBOL_GE(sym::Pow(symbol4 + symbol5, Symbol(2)), sym::Ceiling(symbol3));
+  EXPECT_SYMBOL_GT(sym::Abs(symbol0 - symbol6), sym::Log(Symbol(1)));
+
+  // 所有符号来源和表达式都支持解释执行，不会编译guard_check.so
+  EXPECT_EQ(GuardCodegen().GuardFuncLowerOrCompile(compute_graph), ge::GRAPH_SUCCESS);
+  EXPECT_EQ(AttrUtils::GetStr(compute_graph, "_guard_check_so_data"), nullptr);
+  const std::string *program_data = AttrUtils::GetStr(compute_graph, kGuardCheckProgramData);
+  ASSERT_NE(program_data, nullptr);
+  const auto program = GuardProgramCache::GetInstance().Load(*program_data);
+  ASSERT_NE(program, nullptr);
+  EXPECT_EQ(program->GetCheckNum(), 6U);
+
+  gert::Tensor tensor0 = MakeShapeTensor({3, 4, 5});
+  gert::Tensor tensor1 = MakeShapeTensor({7, 3, 4, 5});
+  std::vector<gert::Tensor *> inputs{&tensor0, &tensor1};
+  char_t reason[1024] = {'\0'};
+  EXPECT_TRUE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+
+  inputs[0]->MutableOriginShape().SetDim(1, 81);
+  setenv("ASCEND_GLOBAL_LOG_LEVEL", "0", 1);
+  EXPECT_FALSE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  unsetenv("ASCEND_GLOBAL_LOG_LEVEL");
+  EXPECT_NE(std::string(reason).find("Check Symbol Check Expression: ExpectLt(Sqrt(s1), s3)"), std::string::npos);
+
+  // 输入个数不足时缺失的输入取值为-1
+  EXPECT_FALSE(program->Check(inputs.data(), 1U, reason, sizeof(reason)));
+}
+
+TEST_F(GuardProgramUT, LowerGuardWithValue) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(12, MakeShared<InputValueSumSource>(0, DT_INT32));
+  auto symbol1 = attr->CreateSymbol(5, MakeShared<InputValueElementSource>(0, 2, DT_INT32));
+  auto symbol2 = attr->CreateSymbol(1, MakeShared<InputRankSource>(0));
+  auto symbol3 = attr->CreateSymbol(12, MakeShared<InputShapeSource>(1, 0));
+  EXPECT_SYMBOL_EQ(symbol0, symbol3);
+  EXPECT_SYMBOL_EQ(sym::Mod(symbol0, symbol1), Symbol(2));
+  EXPECT_SYMBOL_LT(symbol2, Symbol(2));
+
+  const auto program = GuardProgramLowering::Lower(*attr);
+  ASSERT_NE(program, nullptr);
+  std::vector<int32_t> data_value0{3, 4, 5};
+  gert::Tensor tensor0 = {{{3}, {3}},                          // shape
+                          {ge::FORMAT_ND, ge::FORMAT_ND, {}},  // format
+                          gert::kOnHost,                       // placement
+                          ge::DT_INT32,                        // data type
+                          reinterpret_cast<void *>(data_value0.data()),
+                          nullptr};
+  gert::Tensor tensor1 = MakeShapeTensor({12, 2});
+  std::vector<gert::Tensor *> inputs{&tensor0, &tensor1};
+  char_t reason[1024] = {'\0'};
+  EXPECT_TRUE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+
+  std::vector<int32_t> data_value_invalid{7, 5, 5};
+  inputs[0]->SetData(gert::TensorData(data_value_invalid.data(), nullptr, 12, gert::kOnHost));
+  setenv("ASCEND_GLOBAL_LOG_LEVEL", "0", 1);
+  EXPECT_FALSE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  unsetenv("ASCEND_GLOBAL_LOG_LEVEL");
+  EXPECT_NE(std::string(reason).find("Check Symbol Check Expression: ExpectEq(s0, s3)"), std::string::npos);
+}
+
+TEST_F(GuardProgramUT, LowerFloatGuard) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(3, MakeShared<InputShapeSource>(0, 0));
+  EXPECT_SYMBOL_EQ(Symbol(28), sym::Floor(Symbol(84) / Symbol(3)) * sym::Rational(1, 3) * symbol0);
+
+  const auto program = GuardProgramLowering::Lower(*attr);
+  ASSERT_NE(program, nullptr);
+  gert::Tensor tensor0 = MakeShapeTensor({3});
+  std::vector<gert::Tensor *> inputs{&tensor0};
+  char_t reason[1024] = {'\0'};
+  EXPECT_TRUE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  inputs[0]->MutableOriginShape().SetDim(0, 4);
+  EXPECT_FALSE(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)));
+}
+
+// 随机输入下解释执行与guard_check.so的结果一致
+TEST_F(GuardProgramUT, ConsistentWithGuardCheckSo) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(6, MakeShared<InputShapeSource>(0, 0));
+  auto symbol1 = attr->CreateSymbol(4, MakeShared<InputShapeSource>(0, 1));
+  auto symbol2 = attr->CreateSymbol(8, MakeShared<InputShapeSource>(1, 0));
+  EXPECT_SYMBOL_LE(symbol0 * symbol1, Symbol(32) + symbol2 * Symbol(2));
+  EXPECT_SYMBOL_NE(symbol0 - symbol1, Symbol(3));
+  EXPECT_SYMBOL_LT(sym::Sqrt(symbol2), sym::Max(symbol0, symbol1));
+  EXPECT_SYMBOL_GE(sym::Mod(symbol2, Symbol(4)) + sym::Min(symbol0, symbol1), sym::Floor(symbol2 / symbol1));
+
+  GuardCodegen codegen;
+  ASSERT_EQ(codegen.GuardFuncCodegenAndCompile(compute_graph), ge::GRAPH_SUCCESS);
+  std::string buffer;
+  AttrUtils::GetStr(compute_graph, "_guard_check_so_data", buffer);
+  int so_fd = static_cast<int32_t>(syscall(__NR_memfd_create, "libdemo.so", 0));
+  write(so_fd, buffer.c_str(), buffer.size());
+  const std::string so_path = "/proc/self/fd/" + std::to_string(so_fd);
+  void *handle = dlopen(so_path.c_str(), RTLD_NOW | RTLD_LOCAL);
+  ASSERT_NE(handle, nullptr);
+  auto func = reinterpret_cast<GuardCheckFunc>(dlsym(handle, "GuardCheckFunc"));
+  ASSERT_NE(func, nullptr);
+  const auto program = GuardProgramLowering::Lower(*attr);
+  ASSERT_NE(program, nullptr);
+
+  std::mt19937 rng(0);
+  gert::Tensor tensor0 = MakeShapeTensor({6, 4});
+  gert::Tensor tensor1 = MakeShapeTensor({8});
+  std::vector<gert::Tensor *> inputs{&tensor0, &tensor1};
+  char_t reason[1024] = {'\0'};
+  for (size_t i = 0U; i < 1000U; ++i) {
+    tensor0.MutableOriginShape().SetDim(0, 1 + static_cast<int64_t>(rng() % 16U));
+    tensor0.MutableOriginShape().SetDim(1, 1 + static_cast<int64_t>(rng() % 16U));
+    tensor1.MutableOriginShape().SetDim(0, 1 + static_cast<int64_t>(rng() % 64U));
+    EXPECT_EQ(program->Check(inputs.data(), inputs.size(), reason, sizeof(reason)),
+              func(inputs.data(), inputs.size(), reason, sizeof(reason)));
+  }
+  dlclose(handle);
+  close(so_fd);
+}
+
+TEST_F(GuardProgramUT, FallbackToCodegenWhenSourceUnsupported) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(3, MakeShared<CodegenOnlySource>());
+  auto symbol1 = attr->CreateSymbol(4, MakeShared<InputShapeSource>(0, 0));
+  EXPECT_SYMBOL_LT(symbol1, Symbol(8));
+  ASSERT_NE(GuardProgramLowering::Lower(*attr), nullptr);
+
+  EXPECT_SYMBOL_NE(symbol0, symbol1);
+  EXPECT_EQ(GuardProgramLowering::Lower(*attr), nullptr);
+  EXPECT_EQ(GuardCodegen().GuardFuncLowerOrCompile(compute_graph), ge::GRAPH_SUCCESS);
+  EXPECT_EQ(AttrUtils::GetStr(compute_graph, kGuardCheckProgramData), nullptr);
+  EXPECT_NE(AttrUtils::GetStr(compute_graph, "_guard_check_so_data"), nullptr);
+}
+
+TEST_F(GuardProgramUT, CompileSoWhenCompatibleOptionEnabled) {
+  auto compute_graph = BuildGraph();
+  auto attr = compute_graph->template GetOrCreateAttrsGroup<ShapeEnvAttr>();
+  ASSERT_NE(attr, nullptr);
+  ShapeEnvGuarder guard(attr);
+  auto symbol0 = attr->CreateSymbol(4, MakeShared<InputShapeSource>(0, 0));
+  EXPECT_SYMBOL_LT(symbol0, Symbol(8));
+
+  const auto graph_options = GetThreadLocalContext().GetAllGraphOptions();
+  auto new_graph_options = graph_options;
+  new_graph_options["ge.experiment.guard_check_so_compatible"] = "1";
+  GetThreadLocalContext().SetGraphOption(new_graph_options);
+  // 能降级为GuardProgram时仍按选项生成guard_check.so，供旧版本运行时使用
+  EXPECT_EQ(GuardCodegen().GuardFuncLowerOrCompile(compute_graph), ge::GRAPH_SUCCESS);
+  GetThreadLocalContext().SetGraphOption(graph_options);
+  EXPECT_NE(AttrUtils::GetStr(compute_graph, kGuardCheckProgramData), nullptr);
+  EXPECT_NE(AttrUtils::GetStr(compute_graph, "_guard_check_so_data"), nullptr);
+}
+
+TEST_F(GuardProgramUT, DivideByZeroMissesGuard) {
+  GuardProgramBuilder builder;
+  const auto lhs = builder.AddLoad({SourceLoadType::kInputShapeDim, 0, 0, DT_UNDEFINED});
+  const auto rhs = builder.AddLoad({SourceLoadType::kInputShapeDim, 0, 1, DT_UNDEFINED});
+  const auto div = builder.AddInstruction(GuardProgram::OpCode::kDivInt, lhs, rhs);
+  builder.AddCheck(builder.AddInstruction(GuardProgram::OpCode::kEqInt, div, builder.AddIntConst(2)), "div");
+  const auto program = builder.Build();
+  ASSERT_NE(program, nullptr);
+
+  gert::Tensor tensor0 = MakeShapeTensor({8, 4});
+  std::vector<gert::Tensor *> inputs{&tensor0};
+  EXPECT_TRUE(program->Check(inputs.data(), inputs.size(), nullptr, 0U));
+  tensor0.MutableOriginShape().SetDim(1, 0);
+  EXPECT_FALSE(program->Check(inputs.data(), inputs.size(), nullptr, 0U));
+}
+
+TEST_F(GuardProgramUT, SerializeAndShareByContent) {
+  GuardProgramBuilder builder;
+  const auto dim = builder.AddLoad({SourceLoadType::kInputShapeDim, 0, 0, DT_UNDEFINED});
+  builder.AddCheck(builder.AddInstruction(GuardProgram::OpCode::kLeInt, dim, builder.AddIntConst(16)), "le");
+  const auto program = builder.Build();
+  ASSERT_NE(program, nullptr);
+  const std::string data = program->Serialize();
+
+  auto &cache = GuardProgramCache::GetInstance();
+  const auto program0 = cache.Load(data);
+  const auto program1 = cache.Load(data);
+  ASSERT_NE(program0, nullptr);
+  EXPECT_EQ(program0, program1);
+  EXPECT_EQ(program0->Serialize(), data);
+
+  // 截断或下标越界的内容反序列化失败
+  EXPECT_EQ(cache.Load(data.substr(0U, data.size() - 1U)), nullptr);
+  std::string corrupted = data;
+  corrupted[sizeof(uint32_t) * 4U + 2U] = static_cast<char_t>(0x7F);
+  EXPECT_EQ(GuardProgram::Deserialize(corrupted), nullptr);
+}
+}  // namespace ge
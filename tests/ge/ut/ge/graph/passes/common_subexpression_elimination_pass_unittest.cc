@@ -364,6 +364,37 @@ ComputeGraphPtr BuildGraph9() {
   return builder.GetGraph();
 }
 
+/*
+ *        netoutput1
+ *         /     \
+ *       mul1    mul2
+ *      /   \   /   \
+ *   add1   const1   add2
+ *      \           /
+ *          data1
+ */
+ComputeGraphPtr BuildGraph10() {
+  ut::GraphBuilder builder("g1");
+
+  auto const1 = builder.AddNode("const1", "Const", 0, 1);
+  auto data1 = builder.AddNode("data1", "Data", 0, 1);
+  auto add1 = builder.AddNode("add1", "CseAddYes", 1, 1);
+  auto add2 = builder.AddNode("add2", "CseAddYes", 1, 1);
+  auto mul1 = builder.AddNode("mul1", "CseAddYes", 2, 1);
+  auto mul2 = builder.AddNode("mul2", "CseAddYes", 2, 1);
+  auto netoutput1 = builder.AddNode("netoutput1", "NetOutput", 2, 0);
+
+  builder.AddDataEdge(data1, 0, add1, 0);
+  builder.AddDataEdge(data1, 0, add2, 0);
+  builder.AddDataEdge(add1, 0, mul1, 0);
+  builder.AddDataEdge(const1, 0, mul1, 1);
+  builder.AddDataEdge(add2, 0, mul2, 0);
+  builder.AddDataEdge(const1, 0, mul2, 1);
+  builder.AddDataEdge(mul1, 0, netoutput1, 0);
+  builder.AddDataEdge(mul2, 0, netoutput1, 1);
+  return builder.GetGraph();
+}
+
 std::string FindFirstNode(const ComputeGraphPtr &graph, const std::string &type) {
   for (auto &node : graph->GetAllNodes()) {
     if (node->GetType() == type) {
@@ -749,3 +780,38 @@ TEST_F(UTestCommonSubexpressionEliminationPass, SkipNodeWithNoNeedConstantFoldin
   EXPECT_EQ(pass.Run(graph), SUCCESS);
   EXPECT_EQ(graph->GetAllNodesSize(), 5);
 }
+
+TEST_F(UTestCommonSubexpressionEliminationPass, IterateToFixpoint) {
+  auto graph = BuildGraph10();
+  EXPECT_EQ(graph->GetAllNodesSize(), 7);
+  CommonSubexpressionEliminationPass pass(true);
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  EXPECT_EQ(graph->GetAllNodesSize(), 5);
+  auto netoutput1 = graph->FindNode("netoutput1");
+  EXPECT_EQ(GetNames(netoutput1->GetInNodes()).size(), 1);
+  auto const1 = graph->FindNode("const1");
+  EXPECT_EQ(const1->GetOutNodes().size(), 1);
+}
+
+TEST_F(UTestCommonSubexpressionEliminationPass, SingleRoundNoMoreThanFixpoint) {
+  auto graph = BuildGraph10();
+  CommonSubexpressionEliminationPass pass;
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  // mul1/mul2先于add1/add2成为候选时，单轮消除不到mul，再运行一次结果与不动点一致
+  EXPECT_GE(graph->GetAllNodesSize(), 5);
+  EXPECT_LE(graph->GetAllNodesSize(), 6);
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  EXPECT_EQ(graph->GetAllNodesSize(), 5);
+}
+
+TEST_F(UTestCommonSubexpressionEliminationPass, SameStructureDifferentAttrNotFused) {
+  auto graph = BuildGraph10();
+  AttrUtils::SetInt(graph->FindNode("mul1")->GetOpDesc(), "axis", 1);
+  AttrUtils::SetInt(graph->FindNode("mul2")->GetOpDesc(), "axis", 2);
+  CommonSubexpressionEliminationPass pass(true);
+  EXPECT_EQ(pass.Run(graph), SUCCESS);
+  // 结构hash相同，属性不同，只消除add
+  EXPECT_EQ(graph->GetAllNodesSize(), 6);
+  EXPECT_NE(graph->FindNode("mul1"), nullptr);
+  EXPECT_NE(graph->FindNode("mul2"), nullptr);
+}
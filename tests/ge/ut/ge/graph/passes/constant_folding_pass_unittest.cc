@@ -12,6 +12,7 @@
 #include "macro_utils/dt_public_scope.h"
 #include "graph/passes/standard_optimize/constant_folding/constant_folding_pass.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -41,6 +42,7 @@ const char *WrongYes2 = "WrongYes2";
 const char *WrongYes3 = "WrongYes3";
 const char *WhereDynamic2Static = "WhereDynamic2Static";
 const char *WhereDynamic = "WhereDynamic";
+const char *ParallelSumYes = "ParallelSumYes";
 
 class TestAddNKernel : public Kernel {
  public:
@@ -194,6 +196,28 @@ class TestWrongKernel3 : public Kernel {
 };
 REGISTER_COMPUTE_NODE_KERNEL(WrongYes3, TestWrongKernel3);
 
+std::atomic<int32_t> g_parallel_sum_call_num{0};
+class TestParallelSumKernel : public Kernel {
+ public:
+  Status Compute(const ge::OpDescPtr op_desc_ptr, const std::vector<ge::ConstGeTensorPtr> &input,
+                 std::vector<ge::GeTensorPtr> &v_output) override {
+    ++g_parallel_sum_call_num;
+    std::vector<uint8_t> data(9U, 0U);
+    for (const auto &tensor : input) {
+      for (size_t i = 0U; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(data[i] + tensor->GetData().data()[i]);
+      }
+    }
+    auto output = std::make_shared<GeTensor>();
+    output->MutableTensorDesc().SetShape(GeShape({9}));
+    output->SetData(data);
+    output->MutableTensorDesc().SetDataType(DT_UINT8);
+    v_output.push_back(output);
+    return SUCCESS;
+  }
+};
+REGISTER_COMPUTE_NODE_KERNEL(ParallelSumYes, TestParallelSumKernel);
+
 class UtestGraphPassesConstantFoldingPass : public testing::Test {
  protected:
   void SetUp() override {}
@@ -716,6 +740,38 @@ ComputeGraphPtr BuildPotentialConstGraph3() {
   return builder.GetGraph();
 }
 
+/**
+ *               netoutput
+ *             /    ...    \.
+ *         sum2_0  ...  sum2_7
+ *         /    \.
+ *     sum1_0  const_c
+ *     /    \.
+ * const_a_0 const_b_0
+ */
+ComputeGraphPtr BuildParallelFoldingGraph() {
+  constexpr int32_t kBranchNum = 8;
+  auto builder = ut::GraphBuilder("parallel_folding");
+  auto const_c = builder.AddNode("const_c", CONSTANT, 0, 1, FORMAT_ND, DT_UINT8, {9});
+  SetWeightForConstNode(const_c);
+  auto netoutput = builder.AddNode("netoutput", NETOUTPUT, kBranchNum, 0, FORMAT_ND, DT_UINT8, {9});
+  for (int32_t i = 0; i < kBranchNum; ++i) {
+    const std::string index = std::to_string(i);
+    auto const_a = builder.AddNode("const_a_" + index, CONSTANT, 0, 1, FORMAT_ND, DT_UINT8, {9});
+    auto const_b = builder.AddNode("const_b_" + index, CONSTANT, 0, 1, FORMAT_ND, DT_UINT8, {9});
+    SetWeightForConstNode(const_a);
+    SetWeightForConstNode(const_b);
+    auto sum1 = builder.AddNode("sum1_" + index, ParallelSumYes, 2, 1, FORMAT_ND, DT_UINT8, {9});
+    auto sum2 = builder.AddNode("sum2_" + index, ParallelSumYes, 2, 1, FORMAT_ND, DT_UINT8, {9});
+    builder.AddDataEdge(const_a, 0, sum1, 0);
+    builder.AddDataEdge(const_b, 0, sum1, 1);
+    builder.AddDataEdge(sum1, 0, sum2, 0);
+    builder.AddDataEdge(const_c, 0, sum2, 1);
+    builder.AddDataEdge(sum2, 0, netoutput, i);
+  }
+  return builder.GetGraph();
+}
+
 ComputeGraphPtr BuildWhereDynamicGraph() {
   auto builder = ut::GraphBuilder("g5");
   auto const1 = builder.AddNode("const1", CONSTANT, 0, 1, FORMAT_NCHW, DT_UINT8, {1, 2, 3});
@@ -1146,4 +1202,70 @@ TEST_F(UtestGraphPassesConstantFoldingPass, test_folding_with_data_input_no_outp
   GEPass pass(graph);
   EXPECT_EQ(pass.Run(names_to_pass), SUCCESS);
 }
+
+TEST_F(UtestGraphPassesConstantFoldingPass, test_parallel_compute_same_as_serial) {
+  auto serial_graph = BuildParallelFoldingGraph();
+  g_parallel_sum_call_num = 0;
+  names_to_pass.push_back({"ConstantFoldingPass", new ConstantFoldingPass});
+  GEPass serial_pass(serial_graph);
+  EXPECT_EQ(serial_pass.Run(names_to_pass), SUCCESS);
+  const int32_t serial_call_num = g_parallel_sum_call_num.load();
+  EXPECT_EQ(serial_call_num, 16);
+
+  auto parallel_graph = BuildParallelFoldingGraph();
+  g_parallel_sum_call_num = 0;
+  auto parallel_folding_pass = new ConstantFoldingPass(true);
+  NamesToPass parallel_names_to_pass = {{"ConstantFoldingPass", parallel_folding_pass}};
+  names_to_pass.push_back({"ConstantFoldingPass", parallel_folding_pass});
+  GEPass parallel_pass(parallel_graph);
+  EXPECT_EQ(parallel_pass.Run(parallel_names_to_pass), SUCCESS);
+  // 预计算结果全部命中，不会重复计算
+  EXPECT_EQ(g_parallel_sum_call_num.load(), serial_call_num);
+  EXPECT_TRUE(parallel_folding_pass->precomputed_results_.empty());
+
+  ASSERT_EQ(parallel_graph->GetDirectNodesSize(), serial_graph->GetDirectNodesSize());
+  auto serial_netoutput = serial_graph->FindNode("netoutput");
+  auto parallel_netoutput = parallel_graph->FindNode("netoutput");
+  ASSERT_NE(serial_netoutput, nullptr);
+  ASSERT_NE(parallel_netoutput, nullptr);
+  const auto serial_inputs = serial_netoutput->GetInDataNodes();
+  const auto parallel_inputs = parallel_netoutput->GetInDataNodes();
+  ASSERT_EQ(parallel_inputs.size(), serial_inputs.size());
+  for (size_t i = 0U; i < serial_inputs.size(); ++i) {
+    ASSERT_EQ(parallel_inputs.at(i)->GetType(), CONSTANT);
+    const auto serial_weights = OpDescUtils::GetWeights(serial_inputs.at(i));
+    const auto parallel_weights = OpDescUtils::GetWeights(parallel_inputs.at(i));
+    ASSERT_EQ(serial_weights.size(), 1U);
+    ASSERT_EQ(parallel_weights.size(), 1U);
+    EXPECT_EQ(parallel_weights[0]->GetTensorDesc().GetShape().GetDims(),
+              serial_weights[0]->GetTensorDesc().GetShape().GetDims());
+    const std::vector<uint8_t> serial_data(serial_weights[0]->GetData().data(),
+                                           serial_weights[0]->GetData().data() + serial_weights[0]->GetData().size());
+    const std::vector<uint8_t> parallel_data(
+        parallel_weights[0]->GetData().data(),
+        parallel_weights[0]->GetData().data() + parallel_weights[0]->GetData().size());
+    EXPECT_EQ(parallel_data, serial_data);
+    EXPECT_EQ(parallel_data, std::vector<uint8_t>({3, 6, 9, 12, 15, 18, 21, 24, 27}));
+  }
+}
+
+TEST_F(UtestGraphPassesConstantFoldingPass, test_parallel_compute_recompute_when_inputs_changed) {
+  auto graph = BuildParallelFoldingGraph();
+  auto folding_pass = new ConstantFoldingPass(true);
+  names_to_pass.push_back({"ConstantFoldingPass", folding_pass});
+  folding_pass->OnStartPassGraph(graph);
+  EXPECT_EQ(folding_pass->precomputed_results_.size(), 16U);
+
+  // 修改节点描述后预计算结果失效，串行遍历时重新计算
+  auto sum1 = graph->FindNode("sum1_0");
+  ASSERT_NE(sum1, nullptr);
+  sum1->GetOpDesc()->MutableInputDesc(0)->SetDataType(DT_INT8);
+  g_parallel_sum_call_num = 0;
+  std::vector<GeTensorPtr> outputs;
+  EXPECT_EQ(folding_pass->ComputePotentialWeight(sum1, outputs), SUCCESS);
+  EXPECT_EQ(g_parallel_sum_call_num.load(), 1);
+  EXPECT_EQ(folding_pass->precomputed_results_.count(sum1), 0U);
+  ASSERT_EQ(outputs.size(), 1U);
+  EXPECT_EQ(outputs[0]->GetData().size(), 9U);
+}
 }  // namespace ge
@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "host_kernels/kernel_elewise_engine.h"
+#include "common/thread_pool/thread_pool.h"
+#include "graph/ge_tensor.h"
+
+using namespace testing;
+using namespace ge;
+
+namespace {
+template <typename T>
+ConstGeTensorPtr MakeTensor(const std::vector<int64_t> &dims, const std::vector<T> &data, const DataType data_type) {
+  GeTensorDesc tensor_desc(GeShape(dims), FORMAT_ND, data_type);
+  return std::make_shared<GeTensor>(tensor_desc, reinterpret_cast<const uint8_t *>(data.data()),
+                                    data.size() * sizeof(T));
+}
+
+template <typename T>
+std::vector<T> GetData(const GeTensorPtr &tensor) {
+  const T *const data = reinterpret_cast<const T *>(tensor->GetData().data());
+  return std::vector<T>(data, data + tensor->GetData().size() / sizeof(T));
+}
+}  // namespace
+
+class UtestGraphPassesFoldingKernelElewiseEngine : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, GeneratePlanMergeDims) {
+  BroadcastPlan plan;
+  // 形状一致时整体合并为一维
+  ASSERT_EQ(ElewiseEngine::GenerateBroadcastPlan({2, 3, 4}, {2, 3, 4}, plan), SUCCESS);
+  EXPECT_EQ(plan.out_shape, std::vector<int64_t>({2, 3, 4}));
+  EXPECT_EQ(plan.dims, std::vector<int64_t>({24}));
+  EXPECT_EQ(plan.x_strides, std::vector<int64_t>({1}));
+  EXPECT_EQ(plan.y_strides, std::vector<int64_t>({1}));
+
+  // 行广播：y在高维上stride为0
+  ASSERT_EQ(ElewiseEngine::GenerateBroadcastPlan({2, 3, 4}, {1, 4}, plan), SUCCESS);
+  EXPECT_EQ(plan.dims, std::vector<int64_t>({6, 4}));
+  EXPECT_EQ(plan.x_strides, std::vector<int64_t>({4, 1}));
+  EXPECT_EQ(plan.y_strides, std::vector<int64_t>({0, 1}));
+  EXPECT_EQ(plan.out_num, 24);
+  EXPECT_EQ(plan.y_num, 4);
+
+  // 标量与标量
+  ASSERT_EQ(ElewiseEngine::GenerateBroadcastPlan({}, {1}, plan), SUCCESS);
+  EXPECT_EQ(plan.dims, std::vector<int64_t>({1}));
+  EXPECT_EQ(plan.out_shape, std::vector<int64_t>({1}));
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, GeneratePlanInvalidShape) {
+  BroadcastPlan plan;
+  EXPECT_EQ(ElewiseEngine::GenerateBroadcastPlan({2, 3}, {2, 4}, plan), PARAM_INVALID);
+  EXPECT_EQ(ElewiseEngine::GenerateBroadcastPlan({-1, 3}, {1, 3}, plan), PARAM_INVALID);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, AddBroadcastSuccess) {
+  // [2, 1, 3] + [4, 1] -> [2, 4, 3]
+  std::vector<int32_t> x_data = {1, 2, 3, 4, 5, 6};
+  std::vector<int32_t> y_data = {10, 20, 30, 40};
+  const auto x = MakeTensor({2, 1, 3}, x_data, DT_INT32);
+  const auto y = MakeTensor({4, 1}, y_data, DT_INT32);
+  auto output = std::make_shared<GeTensor>();
+  ASSERT_EQ((ElewiseEngine::BinaryCompute<elewise::AddOp, int32_t>(x, y, output)), SUCCESS);
+  EXPECT_EQ(output->GetTensorDesc().GetShape().GetDims(), std::vector<int64_t>({2, 4, 3}));
+  const auto out_data = GetData<int32_t>(output);
+  ASSERT_EQ(out_data.size(), 24U);
+  for (size_t i = 0U; i < 2U; ++i) {
+    for (size_t j = 0U; j < 4U; ++j) {
+      for (size_t k = 0U; k < 3U; ++k) {
+        EXPECT_EQ(out_data[(i * 4U + j) * 3U + k], x_data[i * 3U + k] + y_data[j]);
+      }
+    }
+  }
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, SubScalarBroadcastSuccess) {
+  std::vector<float> x_data = {1.0F};
+  std::vector<float> y_data(37U);
+  for (size_t i = 0U; i < y_data.size(); ++i) {
+    y_data[i] = static_cast<float>(i) * 0.5F;
+  }
+  const auto x = MakeTensor({}, x_data, DT_FLOAT);
+  const auto y = MakeTensor({37}, y_data, DT_FLOAT);
+  auto output = std::make_shared<GeTensor>();
+  ASSERT_EQ((ElewiseEngine::BinaryCompute<elewise::SubOp, float>(x, y, output)), SUCCESS);
+  const auto out_data = GetData<float>(output);
+  ASSERT_EQ(out_data.size(), y_data.size());
+  for (size_t i = 0U; i < y_data.size(); ++i) {
+    EXPECT_FLOAT_EQ(out_data[i], 1.0F - y_data[i]);
+  }
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, MaximumFp16Success) {
+  std::vector<fp16_t> x_data(3U);
+  std::vector<fp16_t> y_data(3U);
+  x_data[0] = 1.0F;
+  x_data[1] = -2.0F;
+  x_data[2] = 3.0F;
+  y_data[0] = 0.5F;
+  y_data[1] = 2.0F;
+  y_data[2] = 3.5F;
+  const auto x = MakeTensor({3}, x_data, DT_FLOAT16);
+  const auto y = MakeTensor({3}, y_data, DT_FLOAT16);
+  auto output = std::make_shared<GeTensor>();
+  ASSERT_EQ((ElewiseEngine::BinaryCompute<elewise::MaximumOp, fp16_t>(x, y, output)), SUCCESS);
+  const auto out_data = GetData<fp16_t>(output);
+  ASSERT_EQ(out_data.size(), 3U);
+  EXPECT_FLOAT_EQ(static_cast<float>(out_data[0]), 1.0F);
+  EXPECT_FLOAT_EQ(static_cast<float>(out_data[1]), 2.0F);
+  EXPECT_FLOAT_EQ(static_cast<float>(out_data[2]), 3.5F);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, OverflowFailed) {
+  std::vector<int32_t> int_x(20U, 1);
+  int_x[17] = std::numeric_limits<int32_t>::max();
+  std::vector<int32_t> int_y = {1};
+  auto output = std::make_shared<GeTensor>();
+  EXPECT_EQ((ElewiseEngine::BinaryCompute<elewise::AddOp, int32_t>(MakeTensor({20}, int_x, DT_INT32),
+                                                                    MakeTensor({1}, int_y, DT_INT32), output)),
+            FAILED);
+
+  std::vector<uint8_t> uint_x = {1, 2, 3};
+  std::vector<uint8_t> uint_y = {1, 3, 3};
+  EXPECT_EQ((ElewiseEngine::BinaryCompute<elewise::SubOp, uint8_t>(MakeTensor({3}, uint_x, DT_UINT8),
+                                                                    MakeTensor({3}, uint_y, DT_UINT8), output)),
+            FAILED);
+
+  std::vector<int64_t> mul_x = {std::numeric_limits<int64_t>::max() / 2 + 1};
+  std::vector<int64_t> mul_y = {1, 2};
+  EXPECT_EQ((ElewiseEngine::BinaryCompute<elewise::MulOp, int64_t>(MakeTensor({1}, mul_x, DT_INT64),
+                                                                    MakeTensor({2}, mul_y, DT_INT64), output)),
+            FAILED);
+
+  std::vector<float> float_x(9U, std::numeric_limits<float>::max());
+  std::vector<float> float_y(9U, 0.0F);
+  float_y[8] = std::numeric_limits<float>::max();
+  EXPECT_EQ((ElewiseEngine::BinaryCompute<elewise::AddOp, float>(MakeTensor({9}, float_x, DT_FLOAT),
+                                                                  MakeTensor({9}, float_y, DT_FLOAT), output)),
+            FAILED);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, DataSizeNotEnough) {
+  std::vector<int32_t> x_data = {1, 2};
+  std::vector<int32_t> y_data = {1, 2, 3};
+  auto output = std::make_shared<GeTensor>();
+  EXPECT_EQ((ElewiseEngine::BinaryCompute<elewise::AddOp, int32_t>(MakeTensor({3}, x_data, DT_INT32),
+                                                                    MakeTensor({3}, y_data, DT_INT32), output)),
+            PARAM_INVALID);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, LargeInputParallelSuccess) {
+  // 超过并行粒度，走多线程分块
+  const int64_t row = 1024;
+  const int64_t col = 513;
+  std::vector<int64_t> x_data(static_cast<size_t>(row * col));
+  for (size_t i = 0U; i < x_data.size(); ++i) {
+    x_data[i] = static_cast<int64_t>(i);
+  }
+  std::vector<int64_t> y_data(static_cast<size_t>(col));
+  for (size_t i = 0U; i < y_data.size(); ++i) {
+    y_data[i] = static_cast<int64_t>(i) * 3;
+  }
+  auto output = std::make_shared<GeTensor>();
+  ASSERT_EQ((ElewiseEngine::BinaryCompute<elewise::MulOp, int64_t>(MakeTensor({row, col}, x_data, DT_INT64),
+                                                                    MakeTensor({col}, y_data, DT_INT64), output)),
+            SUCCESS);
+  const auto out_data = GetData<int64_t>(output);
+  ASSERT_EQ(out_data.size(), x_data.size());
+  for (size_t i = 0U; i < out_data.size(); ++i) {
+    ASSERT_EQ(out_data[i], x_data[i] * y_data[i % static_cast<size_t>(col)]);
+  }
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, ReduceMulSuccess) {
+  // [2, 3, 4]沿中间轴和最内轴归约
+  std::vector<int32_t> x_data(24U);
+  for (size_t i = 0U; i < x_data.size(); ++i) {
+    x_data[i] = static_cast<int32_t>(i % 5U) + 1;
+  }
+  std::vector<int32_t> out(8U);
+  ASSERT_EQ((ElewiseEngine::ReduceCompute<elewise::MulOp, int32_t>(x_data.data(), 2, 3, 4, out.data())), SUCCESS);
+  for (size_t i = 0U; i < 2U; ++i) {
+    for (size_t k = 0U; k < 4U; ++k) {
+      int32_t expect = 1;
+      for (size_t j = 0U; j < 3U; ++j) {
+        expect *= x_data[(i * 3U + j) * 4U + k];
+      }
+      EXPECT_EQ(out[i * 4U + k], expect);
+    }
+  }
+
+  std::vector<int32_t> row_out(6U);
+  ASSERT_EQ((ElewiseEngine::ReduceCompute<elewise::MulOp, int32_t>(x_data.data(), 6, 4, 1, row_out.data())), SUCCESS);
+  for (size_t i = 0U; i < 6U; ++i) {
+    EXPECT_EQ(row_out[i], x_data[i * 4U] * x_data[i * 4U + 1U] * x_data[i * 4U + 2U] * x_data[i * 4U + 3U]);
+  }
+
+  std::vector<int32_t> overflow_data = {65536, 65536};
+  int32_t overflow_out = 0;
+  EXPECT_EQ((ElewiseEngine::ReduceCompute<elewise::MulOp, int32_t>(overflow_data.data(), 1, 2, 1, &overflow_out)),
+            FAILED);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, UnaryComputeInvalid) {
+  std::vector<float> x_data = {4.0F, 16.0F, -1.0F};
+  std::vector<float> out(3U);
+  const auto func = [](const float &x, float &y) -> bool {
+    if (x <= 0.0F) {
+      return false;
+    }
+    y = 1.0F / std::sqrt(x);
+    return true;
+  };
+  EXPECT_EQ(ElewiseEngine::UnaryCompute(x_data.data(), 2, out.data(), func), SUCCESS);
+  EXPECT_FLOAT_EQ(out[0], 0.5F);
+  EXPECT_FLOAT_EQ(out[1], 0.25F);
+  EXPECT_EQ(ElewiseEngine::UnaryCompute(x_data.data(), 3, out.data(), func), FAILED);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, ParallelForInInlineScopeRunInline) {
+  const int64_t total = ElewiseEngine::kParallelGrain * 4;
+  std::atomic<int64_t> call_num{0};
+  std::atomic<int64_t> computed_num{0};
+  const auto func = [&call_num, &computed_num](int64_t begin, int64_t end) -> Status {
+    ++call_num;
+    computed_num += (end - begin);
+    return SUCCESS;
+  };
+  {
+    const ElewiseEngine::InlineScope inline_scope;
+    EXPECT_EQ(ElewiseEngine::ParallelFor(total, ElewiseEngine::kParallelGrain, func), SUCCESS);
+  }
+  EXPECT_EQ(call_num.load(), 1);
+  EXPECT_EQ(computed_num.load(), total);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, ParallelForInOtherThreadPoolStillParallel) {
+  if (std::thread::hardware_concurrency() < 2U) {
+    GTEST_SKIP();
+  }
+  const int64_t total = ElewiseEngine::kParallelGrain * 4;
+  std::atomic<int64_t> call_num{0};
+  std::atomic<int64_t> computed_num{0};
+  const auto func = [&call_num, &computed_num](int64_t begin, int64_t end) -> Status {
+    ++call_num;
+    computed_num += (end - begin);
+    return SUCCESS;
+  };
+  // 其他线程池(如多线程子图编译)中的调用仍按块并行
+  ThreadPool thread_pool("ut_elewise", 1U, false);
+  auto fut = thread_pool.commit([total, &func]() -> Status {
+    return ElewiseEngine::ParallelFor(total, ElewiseEngine::kParallelGrain, func);
+  });
+  ASSERT_TRUE(fut.valid());
+  EXPECT_EQ(fut.get(), SUCCESS);
+  EXPECT_GT(call_num.load(), 1);
+  EXPECT_EQ(computed_num.load(), total);
+}
+
+TEST_F(UtestGraphPassesFoldingKernelElewiseEngine, ParallelForReturnFirstFailure) {
+  const int64_t total = ElewiseEngine::kParallelGrain * 4;
+  std::atomic<int64_t> computed_num{0};
+  const auto func = [total, &computed_num](int64_t begin, int64_t end) -> Status {
+    computed_num += (end - begin);
+    return (end == total) ? FAILED : SUCCESS;
+  };
+  EXPECT_EQ(ElewiseEngine::ParallelFor(total, ElewiseEngine::kParallelGrain, func), FAILED);
+  EXPECT_EQ(computed_num.load(), total);
+}
@@ -14,6 +14,8 @@
 #include "graph/utils/graph_utils_ex.h"
 #include "jit_execution/jit_executor.h"
 #include <vector>
+#include <future>
+#include <thread>
 #include "jit_share_graph.h"
 #include "common/model/external_allocator_manager.h"
 #include "ge/ge_api.h"
@@ -823,6 +825,85 @@ TEST_F(JitExecutorUT, guard_hit_success_and_miss_success_when_input_graph_contai
   EXPECT_EQ(graph_manager.Finalize(), SUCCESS);
 }
 
+/*
+ * 开启异步编译后，首次同步编译完成会在后台提交泛化编译。
+ * 后台编译占用CompileContext期间，guard命中的请求不等待编译完成；编译结束后由后续请求取回结果并放入cache
+ */
+TEST_F(JitExecutorUT, guard_hit_not_blocked_by_speculative_compile_and_swap_in_after_compiled) {
+  const auto backup_graph_options = GetThreadLocalContext().GetAllGraphOptions();
+  auto graph_options = backup_graph_options;
+  graph_options[kOptionJitAsyncCompile] = "1";
+  GetThreadLocalContext().SetGraphOption(graph_options);
+
+  ModelExecutor model_executor;
+  model_executor.Initialize({}, 0);
+  GraphManager graph_manager;
+  EXPECT_EQ(graph_manager.Initialize({}, &model_executor), SUCCESS);
+  UserGraphExecutionQueue task_queue;
+  uint32_t user_graph_id = 0u;
+  auto graph = JitShareGraph::AllNormalNodes();
+  auto compute_graph = GraphUtilsEx::GetComputeGraph(*graph.get());
+  ExecutionOrder order({user_graph_id, compute_graph});
+  CompileContext compile_context(graph_manager);
+  CompiledModelCache cmc(user_graph_id, compile_context, graph_manager);
+  std::mutex tmp_mutex;
+  auto jit_executor = JitExecutor::Create(graph_manager, task_queue, order, compile_context, cmc, tmp_mutex);
+  ASSERT_NE(jit_executor, nullptr);
+
+  std::vector<int64_t> shape_dim = {2, 3, 3, 2};
+  TensorDesc td(Shape(shape_dim), FORMAT_NCHW, DT_FLOAT);
+  td.SetOriginShape(Shape(shape_dim));
+  td.SetPlacement(kPlacementDevice);  // 后台编译仅支持device输入
+  Tensor tensor(td);
+  std::vector<gert::Tensor> gert_inputs;
+  TensorTransUtils::Tensors2GertTensors({tensor}, gert_inputs);
+  const RunAsyncCallbackV2 callback = [&](Status status, std::vector<gert::Tensor> &outputs) {
+    EXPECT_EQ(status, SUCCESS);
+    EXPECT_EQ(outputs.size(), 1);
+    return SUCCESS;
+  };
+  const auto run_once = [&]() -> Status {
+    UserGraphExecution task(user_graph_id, gert_inputs, callback, 0);
+    return jit_executor->RunWithCallback(std::move(task));
+  };
+
+  // 1 首次执行同步编译，并在后台提交泛化编译
+  EXPECT_EQ(run_once(), SUCCESS);
+  auto ep = order.GetFirstPoint();
+  ASSERT_NE(ep, nullptr);
+
+  // 2 另一线程占用CompileContext模拟耗时的后台编译，guard命中的请求需要在编译期间完成
+  std::promise<void> locked;
+  std::promise<void> release;
+  std::thread compiling([&compile_context, &locked, &release]() {
+    std::unique_lock<std::recursive_mutex> graph_lock;
+    while (!graph_lock.owns_lock()) {
+      graph_lock = compile_context.TryLock();
+      std::this_thread::yield();
+    }
+    locked.set_value();
+    release.get_future().wait();
+  });
+  locked.get_future().wait();
+  auto guard_hit = std::async(std::launch::async, run_once);
+  EXPECT_EQ(guard_hit.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_EQ(guard_hit.get(), SUCCESS);
+  EXPECT_EQ(ep->FindGeneralized(gert_inputs), nullptr);
+
+  // 3 编译结束后，后续请求取回后台编译结果并放入cache
+  release.set_value();
+  compiling.join();
+  for (size_t i = 0U; (i < 100U) && (ep->FindGeneralized(gert_inputs) == nullptr); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_EQ(run_once(), SUCCESS);
+  }
+  EXPECT_NE(ep->FindGeneralized(gert_inputs), nullptr);
+
+  EXPECT_EQ(jit_executor->Finalize(), SUCCESS);
+  EXPECT_EQ(graph_manager.Finalize(), SUCCESS);
+  GetThreadLocalContext().SetGraphOption(backup_graph_options);
+}
+
 TEST_F(JitExecutorUT, test_autofuse_flag_slice_schedule_open) {
   mmSetEnv("AUTOFUSE_FLAGS", "--enable_autofuse=true;--experimental_enable_jit_executor_v2=true", 1);
   const bool enable_slice_schedule = (ge::GetAutofuseFlagValue("--enable_autofuse") == "true") &&
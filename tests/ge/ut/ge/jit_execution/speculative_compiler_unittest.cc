@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <memory>
+#include <gtest/gtest.h>
+#include "jit_execution/speculative_compiler.h"
+#include "jit_execution/exe_points/guard_cache.h"
+
+namespace ge {
+class SpeculativeCompilerUT : public testing::Test {
+ protected:
+  gert::Tensor MakeTensor(const std::initializer_list<int64_t> &shape, gert::TensorPlacement placement,
+                          ge::DataType data_type = ge::DT_FLOAT16) {
+    return {{shape, shape},                    // shape
+            {ge::FORMAT_ND, ge::FORMAT_ND, {}},  // format
+            placement,                         // placement
+            data_type,                         // data type
+            (void *)0x0};
+  }
+};
+
+TEST_F(SpeculativeCompilerUT, predict_next_shape_when_steps_are_equal) {
+  ShapeBucketPredictor predictor;
+  std::vector<gert::Shape> predicted;
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 128}), gert::Shape({128})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 256}), gert::Shape({256})}, predicted));
+  EXPECT_TRUE(predictor.RecordAndPredict(0, {gert::Shape({1, 384}), gert::Shape({384})}, predicted));
+  ASSERT_EQ(predicted.size(), 2U);
+  EXPECT_EQ(predicted[0], gert::Shape({1, 512}));
+  EXPECT_EQ(predicted[1], gert::Shape({512}));
+}
+
+TEST_F(SpeculativeCompilerUT, no_prediction_when_steps_differ_or_rank_changes) {
+  ShapeBucketPredictor predictor;
+  std::vector<gert::Shape> predicted;
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 128})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 256})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 512})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(0, {gert::Shape({1, 512, 1})}, predicted));
+  // 每个EP独立记录历史
+  EXPECT_FALSE(predictor.RecordAndPredict(1, {gert::Shape({2, 2})}, predicted));
+  // 无变化的shape不需要预测
+  EXPECT_FALSE(predictor.RecordAndPredict(2, {gert::Shape({2, 2})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(2, {gert::Shape({2, 2})}, predicted));
+  EXPECT_FALSE(predictor.RecordAndPredict(2, {gert::Shape({2, 2})}, predicted));
+}
+
+TEST_F(SpeculativeCompilerUT, host_inputs_not_supported) {
+  std::vector<gert::Tensor> inputs;
+  inputs.emplace_back(MakeTensor({2, 3}, gert::kOnDeviceHbm));
+  EXPECT_TRUE(SpeculativeCompiler::IsSupportedInputs(inputs));
+  inputs.emplace_back(MakeTensor({2}, gert::kOnHost));
+  EXPECT_FALSE(SpeculativeCompiler::IsSupportedInputs(inputs));
+}
+
+TEST_F(SpeculativeCompilerUT, generalized_gep_match_by_rank_and_dtype) {
+  GuardCheckCache cache(2, nullptr);
+  std::vector<gert::Tensor> compile_inputs;
+  compile_inputs.emplace_back(MakeTensor({-1, -1}, gert::kOnDeviceHbm));
+  auto gep = MakeUnique<GuardedExecutionPoint>(nullptr);
+  ASSERT_NE(gep, nullptr);
+  gep->SetGeneralized(3U, compile_inputs);
+  EXPECT_TRUE(gep->Compiled());
+  EXPECT_TRUE(gep->IsGeneralized());
+  EXPECT_EQ(cache.SetGeneralized(std::move(gep)), SUCCESS);
+
+  std::vector<gert::Tensor> inputs;
+  inputs.emplace_back(MakeTensor({8, 1024}, gert::kOnDeviceHbm));
+  auto generalized = cache.FindGeneralized(inputs);
+  ASSERT_NE(generalized, nullptr);
+  EXPECT_EQ(generalized->GetCompiledGraphId(), 3U);
+  // 泛化图不在guard cache中，不影响特化图的查找
+  EXPECT_EQ(cache.FindGuardedExecutionPoint(inputs), nullptr);
+  EXPECT_EQ(cache.GetSavedCacheNum(), 0U);
+
+  std::vector<gert::Tensor> rank_changed;
+  rank_changed.emplace_back(MakeTensor({8, 1024, 1}, gert::kOnDeviceHbm));
+  EXPECT_EQ(cache.FindGeneralized(rank_changed), nullptr);
+  std::vector<gert::Tensor> dtype_changed;
+  dtype_changed.emplace_back(MakeTensor({8, 1024}, gert::kOnDeviceHbm, ge::DT_FLOAT));
+  EXPECT_EQ(cache.FindGeneralized(dtype_changed), nullptr);
+}
+
+TEST_F(SpeculativeCompilerUT, speculative_compiled_gep_add_to_cache_without_copy) {
+  GuardCheckCache cache(1, nullptr);
+  auto gep = MakeUnique<GuardedExecutionPoint>(nullptr);
+  ASSERT_NE(gep, nullptr);
+  // 未编译的gep不允许放入cache
+  EXPECT_NE(cache.AddSpeculativeCompiled(std::move(gep)), SUCCESS);
+  EXPECT_EQ(cache.GetSavedCacheNum(), 0U);
+}
+}  // namespace ge
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+
+#include "nlohmann/json.hpp"
+#include "common/compile_profiling/compile_profiler.h"
+#include "graph/passes/pass_manager.h"
+#include "graph/passes/base_pass.h"
+#include "graph/debug/ge_attr_define.h"
+#include "graph/utils/graph_utils.h"
+#include "register/optimization_option_registry.h"
+
+namespace ge {
+namespace {
+NodePtr AddNode(const ComputeGraphPtr &graph, const std::string &name, const std::string &type) {
+  GeTensorDesc tensor_desc(GeShape({1}), FORMAT_ND, DT_INT32);
+  OpDescPtr op_desc = std::make_shared<OpDesc>(name, type);
+  op_desc->AddInputDesc(tensor_desc);
+  op_desc->AddOutputDesc(tensor_desc);
+  return graph->AddNode(op_desc);
+}
+
+// data->add1->add2
+ComputeGraphPtr BuildGraph() {
+  auto graph = std::make_shared<ComputeGraph>("compile_profile_graph");
+  const auto data = AddNode(graph, "data", "Data");
+  const auto add1 = AddNode(graph, "add1", "Add");
+  const auto add2 = AddNode(graph, "add2", "Add");
+  GraphUtils::AddEdge(data->GetOutDataAnchor(0), add1->GetInDataAnchor(0));
+  GraphUtils::AddEdge(add1->GetOutDataAnchor(0), add2->GetInDataAnchor(0));
+  return graph;
+}
+
+// 删除第一个Add节点并把两侧直连
+class RemoveAddPass : public GraphPass {
+ public:
+  Status Run(ComputeGraphPtr graph) override {
+    const auto add1 = graph->FindNode("add1");
+    if (add1 == nullptr) {
+      return NOT_CHANGED;
+    }
+    return GraphUtils::IsolateNode(add1, {0}) == GRAPH_SUCCESS ? GraphUtils::RemoveNodeWithoutRelink(graph, add1)
+                                                                 : FAILED;
+  }
+};
+REG_PASS_OPTION("CompileProfileRemoveAddPass").LEVELS(OoLevel::kO3);
+
+class CountNodePass : public BaseNodePass {
+ public:
+  Status Run(NodePtr &node) override {
+    (void)node;
+    return SUCCESS;
+  }
+};
+REG_PASS_OPTION("CompileProfileCountNodePass").LEVELS(OoLevel::kO3);
+}  // namespace
+
+class CompileProfilerUT : public testing::Test {
+ protected:
+  void SetUp() override {
+    CompileProfiler::GetInstance().Reset();
+    CompileProfiler::GetInstance().SetEnabled(true);
+  }
+  void TearDown() override {
+    CompileProfiler::GetInstance().SetEnabled(false);
+    CompileProfiler::GetInstance().SetTopN(20U);
+    CompileProfiler::GetInstance().Reset();
+  }
+};
+
+TEST_F(CompileProfilerUT, GraphPassRecordGraphDelta) {
+  auto graph = BuildGraph();
+  PassManager pass_manager;
+  ASSERT_EQ(pass_manager.AddPass("CompileProfileRemoveAddPass", new (std::nothrow) RemoveAddPass), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph), SUCCESS);
+
+  const auto records = CompileProfiler::GetInstance().GetRecords("");
+  ASSERT_EQ(records.size(), 1U);
+  EXPECT_EQ(records[0].pass_name, "CompileProfileRemoveAddPass");
+  EXPECT_EQ(records[0].graph_name, "compile_profile_graph");
+  EXPECT_EQ(records[0].run_count, 2U);
+  EXPECT_EQ(records[0].nodes_before, 3);
+  EXPECT_EQ(records[0].edges_before, 2);
+  EXPECT_EQ(records[0].nodes_after, 2);
+  EXPECT_EQ(records[0].edges_after, 1);
+}
+
+TEST_F(CompileProfilerUT, DisabledNotRecord) {
+  CompileProfiler::GetInstance().SetEnabled(false);
+  auto graph = BuildGraph();
+  PassManager pass_manager;
+  ASSERT_EQ(pass_manager.AddPass("CompileProfileRemoveAddPass", new (std::nothrow) RemoveAddPass), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph), SUCCESS);
+  EXPECT_TRUE(CompileProfiler::GetInstance().GetRecords("").empty());
+}
+
+TEST_F(CompileProfilerUT, NodePassRecordCallNum) {
+  auto graph = BuildGraph();
+  CountNodePass count_pass;
+  NamesToPass names_to_passes = {{"CompileProfileCountNodePass", &count_pass}};
+  GEPass ge_pass(graph);
+  ASSERT_EQ(ge_pass.Run(names_to_passes), SUCCESS);
+
+  const auto records = CompileProfiler::GetInstance().GetRecords("");
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_EQ(records[0].pass_name, "GEPass(CompileProfileCountNodePass)");
+  EXPECT_EQ(records[0].run_count, 1U);
+  EXPECT_EQ(records[0].nodes_before, 3);
+  EXPECT_EQ(records[1].pass_name, "CompileProfileCountNodePass");
+  EXPECT_EQ(records[1].run_count, 3U);
+  EXPECT_EQ(records[1].nodes_before, -1);
+}
+
+TEST_F(CompileProfilerUT, TopPassesSortedByTotalTime) {
+  PassProfileSample sample;
+  sample.time_cost_us = 10UL;
+  CompileProfiler::GetInstance().Record("", "PassA", "graph1", sample);
+  sample.time_cost_us = 30UL;
+  CompileProfiler::GetInstance().Record("", "PassB", "graph1", sample);
+  sample.time_cost_us = 15UL;
+  CompileProfiler::GetInstance().Record("", "PassA", "graph2", sample);
+  sample.time_cost_us = 1UL;
+  CompileProfiler::GetInstance().Record("", "PassC", "graph1", sample);
+  CompileProfiler::GetInstance().SetTopN(2U);
+
+  const auto top_passes = CompileProfiler::GetInstance().GetTopPasses("");
+  ASSERT_EQ(top_passes.size(), 2U);
+  EXPECT_EQ(top_passes[0].pass_name, "PassB");
+  EXPECT_EQ(top_passes[0].total_time_us, 30U);
+  EXPECT_EQ(top_passes[1].pass_name, "PassA");
+  EXPECT_EQ(top_passes[1].total_time_us, 25U);
+  EXPECT_EQ(top_passes[1].run_count, 2U);
+  EXPECT_EQ(top_passes[1].max_time_us, 15U);
+}
+
+TEST_F(CompileProfilerUT, DumpJsonAndReset) {
+  auto graph = BuildGraph();
+  PassManager pass_manager;
+  ASSERT_EQ(pass_manager.AddPass("CompileProfileRemoveAddPass", new (std::nothrow) RemoveAddPass), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph), SUCCESS);
+
+  std::string path = "./ut_compile_profile.json";
+  ASSERT_EQ(CompileProfiler::GetInstance().Dump("", graph->GetName(), 1U, path), SUCCESS);
+  EXPECT_TRUE(CompileProfiler::GetInstance().GetRecords("").empty());
+
+  std::ifstream profile_file(path);
+  ASSERT_TRUE(profile_file.is_open());
+  const auto profile_json = nlohmann::json::parse(profile_file);
+  EXPECT_EQ(profile_json["graph_name"], "compile_profile_graph");
+  EXPECT_EQ(profile_json["graph_id"], 1U);
+  ASSERT_EQ(profile_json["passes"].size(), 1U);
+  EXPECT_EQ(profile_json["passes"][0]["pass"], "CompileProfileRemoveAddPass");
+  EXPECT_EQ(profile_json["passes"][0]["nodes_before"], 3);
+  EXPECT_EQ(profile_json["passes"][0]["nodes_after"], 2);
+  ASSERT_EQ(profile_json["top_passes"].size(), 1U);
+  EXPECT_EQ(profile_json["top_passes"][0].count("graph"), 0U);
+  (void)std::remove(path.c_str());
+}
+
+TEST_F(CompileProfilerUT, DumpOnlyReleaseRecordsOfSameCompile) {
+  auto graph1 = BuildGraph();
+  auto graph2 = BuildGraph();
+  ASSERT_TRUE(AttrUtils::SetStr(graph1, ATTR_NAME_SESSION_GRAPH_ID, "0_1"));
+  ASSERT_TRUE(AttrUtils::SetStr(graph2, ATTR_NAME_SESSION_GRAPH_ID, "1_1"));
+  EXPECT_EQ(CompileProfiler::GetCompileKey(graph1), "0_1");
+  PassManager pass_manager;
+  ASSERT_EQ(pass_manager.AddPass("CompileProfileRemoveAddPass", new (std::nothrow) RemoveAddPass), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph1), SUCCESS);
+  ASSERT_EQ(pass_manager.Run(graph2), SUCCESS);
+  ASSERT_EQ(CompileProfiler::GetInstance().GetRecords("0_1").size(), 1U);
+  ASSERT_EQ(CompileProfiler::GetInstance().GetRecords("1_1").size(), 1U);
+
+  // 不同session中同名的图分别统计，落盘一个不影响另一个
+  std::string path = "./ut_compile_profile_0_1.json";
+  ASSERT_EQ(CompileProfiler::GetInstance().Dump("0_1", graph1->GetName(), 1U, path), SUCCESS);
+  EXPECT_TRUE(CompileProfiler::GetInstance().GetRecords("0_1").empty());
+  const auto records = CompileProfiler::GetInstance().GetRecords("1_1");
+  ASSERT_EQ(records.size(), 1U);
+  EXPECT_EQ(records[0].run_count, 1U);
+  (void)std::remove(path.c_str());
+}
+}  // namespace ge
@@ -9,7 +9,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <fstream>
 #include <memory>
+#include <thread>
 
 #include "runtime/fast_v2/common/fake_node_helper.h"
 #include "framework/common/string_util.h"
@@ -17,6 +19,7 @@
 #include "common/global_variables/diagnose_switch.h"
 #include "core/executor_error_code.h"
 #include "depends/profiler/src/profiling_test_util.h"
+#include "common/profiling/ge_host_trace_exporter.h"
 #include "macro_utils/dt_public_scope.h"
 #include "subscriber/profiler/ge_host_profiler.h"
 #include "macro_utils/dt_public_unscope.h"
@@ -62,8 +65,9 @@ TEST_F(GlobalProfilingUT, RecordOk) {
   EXPECT_EQ(ins->GetGlobalProfiler(), nullptr);
   ins->Init(4UL);
   EXPECT_NE(ins->GetGlobalProfiler(), nullptr);
-  ins->Record(0UL, 1UL, kModelStart, std::chrono::system_clock::now());
-  EXPECT_EQ(ins->GetRecordCount(), 1);
+  ins->Record(0UL, 1UL, kModelStart, ProfilingClock::now());
+  ins->Record(0UL, 1UL, kModelEnd, std::chrono::system_clock::now());
+  EXPECT_EQ(ins->GetRecordCount(), 2);
   ins->Free();
   EXPECT_EQ(ins->GetGlobalProfiler(), nullptr);
 }
@@ -146,6 +150,170 @@ TEST_F(GlobalProfilingUT, DumpAndClearOk) {
   EXPECT_EQ(GlobalProfilingWrapper::GetInstance()->GetGlobalProfiler(), nullptr);
 }
 
+TEST_F(GlobalProfilingUT, MultiThreadRecordAndDumpInTimeOrder) {
+  std::vector<std::string> idx_to_str = {"Model", "Execute", "NodeName1", "InferShape"};
+  GlobalProfiler profiler;
+  constexpr size_t kThreadNum = 4UL;
+  constexpr size_t kRecordNum = 1000UL;
+  std::vector<std::thread> threads;
+  for (size_t i = 0UL; i < kThreadNum; ++i) {
+    threads.emplace_back([&profiler]() {
+      for (size_t j = 0UL; j < kRecordNum; ++j) {
+        profiler.Record(2UL, 3UL, kExecuteStart, ProfilingClock::now());
+        profiler.Record(2UL, 3UL, kExecuteEnd, ProfilingClock::now());
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(profiler.GetCount(), kThreadNum * kRecordNum * 2UL);
+
+  std::stringstream ss;
+  profiler.Dump(ss, idx_to_str);
+  auto lines = ge::StringUtils::Split(ss.str(), '\n');
+  ASSERT_EQ(lines.size(), kThreadNum * kRecordNum * 2UL + 3UL);
+  int64_t last_timestamp = 0;
+  for (size_t i = 1UL; i <= kThreadNum * kRecordNum * 2UL; ++i) {
+    const auto timestamp = std::stoll(ge::StringUtils::Split(lines[i], ' ')[0]);
+    EXPECT_GE(timestamp, last_timestamp);
+    last_timestamp = timestamp;
+  }
+}
+
+TEST_F(GlobalProfilingUT, RecordWithSystemClockTimestamp) {
+  std::vector<std::string> idx_to_str = {"Model", "Execute", "NodeName1", "InferShape"};
+  GlobalProfiler profiler;
+  const auto start = std::chrono::system_clock::now();
+  profiler.Record(2UL, 3UL, kExecuteStart, start);
+  profiler.Record(2UL, 3UL, kExecuteEnd, start + std::chrono::microseconds(5));
+  std::stringstream ss;
+  profiler.Dump(ss, idx_to_str);
+  auto lines = ge::StringUtils::Split(ss.str(), '\n');
+  ASSERT_GE(lines.size(), 3UL);
+  // 系统时钟打点换算成单调时钟记录，dump时换算回来的时间与打点时一致
+  const auto start_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count();
+  EXPECT_EQ(lines[1], std::to_string(start_ns) + " " + std::to_string(mmGetTid()) + " [NodeName1] [InferShape] Start");
+  EXPECT_EQ(std::stoll(ge::StringUtils::Split(lines[2], ' ')[0]), start_ns + 5000);
+}
+
+TEST_F(GlobalProfilingUT, RecordOnlySampledModelExecution) {
+  GlobalProfilerOption option;
+  option.sample_interval = 4UL;
+  GlobalProfiler profiler(option);
+  for (size_t i = 0UL; i < 8UL; ++i) {
+    profiler.Record(0UL, 1UL, kModelStart, ProfilingClock::now());
+    profiler.Record(2UL, 3UL, kExecuteStart, ProfilingClock::now());
+    profiler.Record(2UL, 3UL, kExecuteEnd, ProfilingClock::now());
+    profiler.Record(0UL, 1UL, kModelEnd, ProfilingClock::now());
+  }
+  // 第0次和第4次模型执行被采样
+  EXPECT_EQ(profiler.GetCount(), 8UL);
+}
+
+TEST_F(GlobalProfilingUT, StreamToFileAndExportChromeTrace) {
+  ge::char_t current_path[MMPA_MAX_PATH] = {'\0'};
+  getcwd(current_path, MMPA_MAX_PATH);
+  mmSetEnv("ASCEND_WORK_PATH", current_path, 1);
+  mmSetEnv("GE_HOST_PROFILING_STREAM", "1", 1);
+  const auto option = GlobalProfilerOption::LoadFromEnv();
+  unsetenv("GE_HOST_PROFILING_STREAM");
+  ASSERT_FALSE(option.stream_path.empty());
+
+  std::vector<std::string> idx_to_str = {"Model", "Execute", "Node\"1", "InferShape"};
+  {
+    GlobalProfiler profiler(option);
+    profiler.Record(0UL, 1UL, kModelStart, ProfilingClock::now());
+    std::thread worker([&profiler]() {
+      profiler.Record(2UL, 3UL, kExecuteStart, ProfilingClock::now());
+      profiler.Record(2UL, 3UL, kExecuteEnd, ProfilingClock::now());
+    });
+    worker.join();
+    profiler.Record(0UL, 1UL, kModelEnd, ProfilingClock::now());
+    std::stringstream ss;
+    profiler.Dump(ss, idx_to_str);
+    auto lines = ge::StringUtils::Split(ss.str(), '\n');
+    ASSERT_GE(lines.size(), 3UL);
+    EXPECT_EQ(lines[0], "ExecutorProfiler version: 2.0-SingleThread, dump start, records num: 4");
+    EXPECT_NE(lines[1].find("chrome trace"), std::string::npos);
+  }
+
+  GeHostTraceExporter exporter;
+  ASSERT_EQ(exporter.LoadStream(option.stream_path), ge::SUCCESS);
+  EXPECT_EQ(exporter.GetEventNum(), 4UL);
+  std::stringstream trace;
+  ASSERT_EQ(exporter.WriteChromeTrace(trace), ge::SUCCESS);
+  EXPECT_NE(trace.str().find("\"name\":\"Node\\\"1\",\"cat\":\"InferShape\",\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"name\":\"Model\",\"cat\":\"Execute\",\"ph\":\"E\""), std::string::npos);
+
+  const std::string trace_path =
+      std::string(current_path) + "/ge_profiling_" + std::to_string(mmGetPid()) + ".json";
+  EXPECT_EQ(mmAccess(trace_path.c_str()), EN_OK);
+  (void)remove(option.stream_path.c_str());
+  (void)remove(trace_path.c_str());
+  unsetenv("ASCEND_WORK_PATH");
+}
+
+TEST_F(GlobalProfilingUT, StreamToFileKeepsWritingAfterDump) {
+  ge::char_t current_path[MMPA_MAX_PATH] = {'\0'};
+  getcwd(current_path, MMPA_MAX_PATH);
+  mmSetEnv("ASCEND_WORK_PATH", current_path, 1);
+  mmSetEnv("GE_HOST_PROFILING_STREAM", "1", 1);
+  const auto option = GlobalProfilerOption::LoadFromEnv();
+  unsetenv("GE_HOST_PROFILING_STREAM");
+  ASSERT_FALSE(option.stream_path.empty());
+
+  std::vector<std::string> idx_to_str = {"Model", "Execute", "NodeName1", "InferShape", "", ""};
+  {
+    GlobalProfiler profiler(option);
+    profiler.Record(2UL, 3UL, kExecuteStart, ProfilingClock::now());
+    profiler.Record(2UL, 3UL, kExecuteEnd, ProfilingClock::now());
+    std::stringstream first_dump;
+    profiler.Dump(first_dump, idx_to_str);
+    EXPECT_NE(first_dump.str().find("chrome trace"), std::string::npos);
+
+    // dump之后新注册的字符串和新的记录仍然写入流式文件，不会退回到内存中
+    idx_to_str[4] = "NodeName2";
+    idx_to_str[5] = "Tiling";
+    profiler.Record(4UL, 5UL, kExecuteStart, ProfilingClock::now());
+    profiler.Record(4UL, 5UL, kExecuteEnd, ProfilingClock::now());
+    std::stringstream second_dump;
+    profiler.Dump(second_dump, idx_to_str);
+    EXPECT_NE(second_dump.str().find("chrome trace"), std::string::npos);
+    EXPECT_EQ(second_dump.str().find("dropped"), std::string::npos);
+  }
+
+  GeHostTraceExporter exporter;
+  ASSERT_EQ(exporter.LoadStream(option.stream_path), ge::SUCCESS);
+  EXPECT_EQ(exporter.GetEventNum(), 4UL);
+  std::stringstream trace;
+  ASSERT_EQ(exporter.WriteChromeTrace(trace), ge::SUCCESS);
+  EXPECT_NE(trace.str().find("\"name\":\"NodeName1\",\"cat\":\"InferShape\",\"ph\":\"E\""), std::string::npos);
+  EXPECT_NE(trace.str().find("\"name\":\"NodeName2\",\"cat\":\"Tiling\",\"ph\":\"B\""), std::string::npos);
+
+  (void)remove(option.stream_path.c_str());
+  (void)remove((std::string(current_path) + "/ge_profiling_" + std::to_string(mmGetPid()) + ".json").c_str());
+  unsetenv("ASCEND_WORK_PATH");
+}
+
+TEST_F(GlobalProfilingUT, ExportChromeTraceFromDumpText) {
+  std::stringstream text;
+  text << "ExecutorProfiler version: 2.0-SingleThread, dump start, records num: 4\n"
+       << "1000 1 [Model] [Execute] Start\n"
+       << "2000 2 [Node Name] [Tiling] Start\n"
+       << "3500 2 [Node Name] [Tiling] End\n"
+       << "4000 1 [Model] [Execute] End\n"
+       << "Profiling dump end\n";
+  GeHostTraceExporter exporter;
+  ASSERT_EQ(exporter.LoadText(text), ge::SUCCESS);
+  EXPECT_EQ(exporter.GetEventNum(), 4UL);
+  std::stringstream trace;
+  ASSERT_EQ(exporter.WriteChromeTrace(trace), ge::SUCCESS);
+  EXPECT_NE(trace.str().find("{\"name\":\"Node Name\",\"cat\":\"Tiling\",\"ph\":\"E\",\"ts\":3.500"),
+            std::string::npos);
+  EXPECT_NE(trace.str().find("\"tid\":1"), std::string::npos);
+}
+
 TEST_F(GlobalProfilingUT, ConstructGlobalProfiler_NonRegisterBuiltInString_WithGeProfilingOff) {
   auto gloabl_prof_ins = GlobalProfilingWrapper::GetInstance();
   gloabl_prof_ins->str_idx_ = 0UL;
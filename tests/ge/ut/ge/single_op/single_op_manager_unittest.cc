@@ -9,6 +9,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <thread>
 #include <vector>
 
 #include "rt_external.h"
@@ -18,16 +19,29 @@
 #include "single_op/single_op_manager.h"
 #include "hybrid/common/npu_memory_allocator.h"
 #include "macro_utils/dt_public_unscope.h"
+#include "depends/ascendcl/src/ascendcl_stub.h"
 
 using namespace std;
 using namespace testing;
 using namespace ge;
 
+namespace {
+class OtherContextRuntime : public AclRuntimeStub {
+ public:
+  aclError aclrtGetCurrentContext(aclrtContext *context) override {
+    *context = reinterpret_cast<aclrtContext>(0x2);
+    return ACL_SUCCESS;
+  }
+};
+}  // namespace
+
 class UtestSingleOpManager : public testing::Test {
  protected:
   void SetUp() {}
 
-  void TearDown() {}
+  void TearDown() {
+    AclRuntimeStub::Reset();
+  }
 };
 
 TEST_F(UtestSingleOpManager, test_get_resource) {
@@ -77,3 +91,84 @@ TEST_F(UtestSingleOpManager, SingleOp_SetAllocator) {
   SingleOpManager::GetInstance().SetAllocator(stream, (ge::Allocator *)0x01);
   EXPECT_NE(res->allocator_, nullptr);
 }
+
+TEST_F(UtestSingleOpManager, ResourcePool_ReuseResource_AfterStreamReleased) {
+  auto &instance = SingleOpManager::GetInstance();
+  ge::GeExecutor::SetSingleOpResourcePoolSize(1U);
+  EXPECT_EQ(instance.max_pool_size_, 1U);
+  const auto stats = instance.GetResourcePoolStats();
+  auto stream = (rtStream_t)0x1001;
+  auto res = instance.GetResource(0x1001, stream);
+  ASSERT_NE(res, nullptr);
+  res->op_map_[0].reset(new (std::nothrow) SingleOp(res, &res->stream_mu_, stream));
+  ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_recycle_count, stats.resource_recycle_count + 1U);
+
+  // 同一context下，其他线程上新建的stream同样可以复用
+  auto new_stream = (rtStream_t)0x1002;
+  StreamResource *reused = nullptr;
+  std::thread worker([&instance, &reused, new_stream]() { reused = instance.GetResource(0x1002, new_stream); });
+  worker.join();
+  EXPECT_EQ(reused, res);
+  EXPECT_EQ(res->GetStream(), new_stream);
+  EXPECT_NE(res->GetOperator(0), nullptr);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_reuse_count, stats.resource_reuse_count + 1U);
+  EXPECT_EQ(instance.GetResourcePoolStats().op_reuse_count, stats.op_reuse_count + 1U);
+
+  // 资源池已满时直接释放
+  auto other_stream = (rtStream_t)0x1003;
+  ASSERT_NE(instance.GetResource(0x1003, other_stream), nullptr);
+  ASSERT_EQ(instance.ReleaseResource(new_stream), SUCCESS);
+  ASSERT_EQ(instance.ReleaseResource(other_stream), SUCCESS);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_drop_count, stats.resource_drop_count + 1U);
+
+  // 卸载单算子时同时删除资源池中的算子
+  EXPECT_EQ(instance.DeleteSingleOp(0), SUCCESS);
+  ASSERT_EQ(instance.idle_resources_.size(), 1U);
+  EXPECT_EQ(instance.idle_resources_.begin()->second.back()->GetOperatorNum(), 0U);
+  instance.SetResourcePoolSize(0U);
+  EXPECT_TRUE(instance.idle_resources_.empty());
+}
+
+TEST_F(UtestSingleOpManager, ResourcePool_NotReuseResource_InOtherContext) {
+  auto &instance = SingleOpManager::GetInstance();
+  instance.SetResourcePoolSize(1U);
+  const auto stats = instance.GetResourcePoolStats();
+  auto stream = (rtStream_t)0x3001;
+  auto res = instance.GetResource(0x3001, stream);
+  ASSERT_NE(res, nullptr);
+  ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_recycle_count, stats.resource_recycle_count + 1U);
+
+  // 资源中的overflow地址属于原context，其他context上新建的stream不能复用
+  AclRuntimeStub::SetInstance(std::make_shared<OtherContextRuntime>());
+  auto new_stream = (rtStream_t)0x3002;
+  ASSERT_NE(instance.GetResource(0x3002, new_stream), nullptr);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_reuse_count, stats.resource_reuse_count);
+  ASSERT_EQ(instance.ReleaseResource(new_stream), SUCCESS);
+  EXPECT_EQ(instance.idle_resources_.size(), 2U);
+  instance.SetResourcePoolSize(0U);
+  EXPECT_TRUE(instance.idle_resources_.empty());
+}
+
+TEST_F(UtestSingleOpManager, ResourcePool_Prewarm) {
+  auto &instance = SingleOpManager::GetInstance();
+  auto stream = (rtStream_t)0x2001;
+  std::vector<SingleOpPrewarmInfo> prewarm_infos;
+  EXPECT_NE(instance.PrewarmResource(stream, prewarm_infos), SUCCESS);
+
+  instance.SetResourcePoolSize(2U);
+  const auto stats = instance.GetResourcePoolStats();
+  ASSERT_EQ(instance.PrewarmResource(stream, prewarm_infos), SUCCESS);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_recycle_count, stats.resource_recycle_count + 1U);
+  // 无效的模型构建失败，不放入资源池
+  prewarm_infos.resize(1U);
+  prewarm_infos[0].model_id = 2001U;
+  EXPECT_NE(instance.PrewarmResource(stream, prewarm_infos), SUCCESS);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_recycle_count, stats.resource_recycle_count + 1U);
+
+  EXPECT_NE(instance.GetResource(0x2001, stream), nullptr);
+  EXPECT_EQ(instance.GetResourcePoolStats().resource_reuse_count, stats.resource_reuse_count + 1U);
+  ASSERT_EQ(instance.ReleaseResource(stream), SUCCESS);
+  instance.SetResourcePoolSize(0U);
+}
@@ -15,6 +15,7 @@
 
 #include "macro_utils/dt_public_scope.h"
 #include "single_op/stream_resource.h"
+#include "single_op/single_op_impl.h"
 #include "macro_utils/dt_public_unscope.h"
 #include "framework/ge_runtime_stub/include/faker/fake_allocator.h"
 
@@ -137,3 +138,36 @@ TEST_F(UtestStreamResource, DeleteDynamicOperator_SyncFail) {
   EXPECT_NE(res.DeleteDynamicOperator(0), SUCCESS);
   unsetenv("CONSTANT_FOLDING_PASS_9");
 }
+
+TEST_F(UtestStreamResource, Rebind_Ok_AfterPrepareForReuse) {
+  StreamResource res((uintptr_t)1);
+  res.allocator_ = &res.internal_allocator_;
+  EXPECT_TRUE(res.IsReusable());
+  res.op_map_[0].reset(new (std::nothrow) SingleOp(&res, &res.stream_mu_, res.stream_));
+  res.dynamic_op_map_[1].reset(
+      new (std::nothrow) DynamicSingleOp(&res.tensor_pool_, 1U, &res.stream_mu_, res.stream_));
+  res.dynamic_op_map_[2].reset(nullptr);
+  hybrid::CallbackManager *callback_manager = nullptr;
+  EXPECT_EQ(res.GetCallbackManager(&callback_manager), SUCCESS);
+
+  EXPECT_EQ(res.PrepareForReuse(), SUCCESS);
+  EXPECT_EQ(res.callback_manager_, nullptr);
+  EXPECT_EQ(res.GetOperatorNum(), 2U);
+  // 回收时已同步过stream，删除算子不再同步
+  mmSetEnv("CONSTANT_FOLDING_PASS_9", "mock_fail", 1);
+  EXPECT_EQ(res.DeleteDynamicOperator(2), SUCCESS);
+  unsetenv("CONSTANT_FOLDING_PASS_9");
+
+  auto stream = (aclrtStream)0x02;
+  res.Rebind(2U, stream);
+  EXPECT_EQ(res.GetStream(), stream);
+  EXPECT_EQ(res.resource_id_, 2U);
+  EXPECT_EQ(res.internal_allocator_.stream_, stream);
+  EXPECT_EQ(res.op_map_[0]->impl_->stream_, stream);
+  EXPECT_EQ(res.dynamic_op_map_[1]->impl_->stream_, stream);
+  EXPECT_EQ(res.dynamic_op_map_[1]->impl_->resource_id_, 2U);
+  EXPECT_FALSE(res.pooled_);
+
+  res.SetAllocator((ge::Allocator *)0x01);
+  EXPECT_FALSE(res.IsReusable());
+}
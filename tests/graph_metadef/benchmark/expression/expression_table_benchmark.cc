@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <symengine/functions.h>
+#include <symengine/simplify.h>
+#include "attribute_group/attr_group_shape_env.h"
+#include "expression/expression_impl.h"
+#include "expression/expression_table.h"
+#include "graph/symbolizer/symbol_operator.h"
+#include "graph/symbolizer/symbolic.h"
+
+namespace ge {
+namespace {
+constexpr int64_t kSymbolNum = 32;
+// 每次追加replacement后会全量化简已有guard，此处模拟化简的轮数
+constexpr int64_t kSimplifyRound = 8;
+
+// 模拟LLM动态shape图中的guard：batch * seq * hidden相关的乘积与对齐关系
+std::vector<Expression> BuildGuards(const int64_t guard_num) {
+  std::vector<Expression> syms;
+  for (int64_t i = 0; i < kSymbolNum; ++i) {
+    syms.emplace_back(Symbol(("s" + std::to_string(i)).c_str()));
+  }
+  std::vector<Expression> guards;
+  for (int64_t i = 0; i < guard_num; ++i) {
+    const auto &a = syms[static_cast<size_t>(i % kSymbolNum)];
+    const auto &b = syms[static_cast<size_t>((i * 7 + 3) % kSymbolNum)];
+    const auto &c = syms[static_cast<size_t>((i * 13 + 5) % kSymbolNum)];
+    const auto lhs = (a + Symbol(1)) * b * Symbol(128);
+    const auto rhs = sym::Max(c * Symbol(64), b * Symbol(64)) + a * b * Symbol(128) - a * b * Symbol(128);
+    guards.emplace_back(sym::Eq(lhs, rhs + Symbol(i % 4)));
+  }
+  return guards;
+}
+
+// 原实现：非常量表达式以序列化字符串计算hash，每次都完整执行expand+simplify
+void RunLegacy(benchmark::State &state) {
+  const int64_t guard_num = state.range(0);
+  for (auto _ : state) {
+    const auto guards = BuildGuards(guard_num);
+    size_t hash = 0U;
+    for (int64_t round = 0; round < kSimplifyRound; ++round) {
+      for (const auto &guard : guards) {
+        hash ^= std::hash<std::string>()(std::string(guard.Serialize().get()));
+        const auto &sym_expr = guard.impl_->sym_expr_;
+        const auto simplified = SymEngine::simplify(SymEngine::expand(sym_expr));
+        benchmark::DoNotOptimize(simplified.get());
+      }
+    }
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * guard_num * kSimplifyRound);
+}
+
+// hash-consing表：结构hash缓存在对象内，化简结果以表达式id缓存
+void RunMemoized(benchmark::State &state) {
+  const int64_t guard_num = state.range(0);
+  for (auto _ : state) {
+    // 每次迭代从空表开始，包含首轮未命中的开销
+    ExpressionTable::GetInstance().Clear();
+    const auto guards = BuildGuards(guard_num);
+    size_t hash = 0U;
+    for (int64_t round = 0; round < kSimplifyRound; ++round) {
+      for (const auto &guard : guards) {
+        hash ^= HashSymbol()(guard);
+        const auto simplified = guard.Simplify();
+        benchmark::DoNotOptimize(simplified.Hash());
+      }
+    }
+    benchmark::DoNotOptimize(hash);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * guard_num * kSimplifyRound);
+}
+}  // namespace
+
+static void ExprGuardSimplify_Legacy(benchmark::State &state) {
+  RunLegacy(state);
+}
+BENCHMARK(ExprGuardSimplify_Legacy)->Arg(64)->Arg(1024)->Unit(benchmark::kMicrosecond);
+
+static void ExprGuardSimplify_Memoized(benchmark::State &state) {
+  RunMemoized(state);
+}
+BENCHMARK(ExprGuardSimplify_Memoized)->Arg(64)->Arg(1024)->Unit(benchmark::kMicrosecond);
+}  // namespace ge
+
+BENCHMARK_MAIN();
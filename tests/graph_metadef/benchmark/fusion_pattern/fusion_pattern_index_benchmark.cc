@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "graph/compute_graph.h"
+#include "graph/op_desc.h"
+#include "graph/utils/graph_utils.h"
+#include "register/graph_optimizer/fusion_common/pattern_fusion_base_pass.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
+
+using namespace ge;
+
+namespace fe {
+namespace {
+const std::vector<std::string> kOpTypes = {"MatMul", "BatchMatMul", "Add", "Mul", "Softmax", "LayerNorm",
+                                           "Gelu", "Cast", "Transpose", "Reshape", "Relu", "Sub"};
+
+// input_type -> output_type，只匹配不改图，用于衡量各pass的匹配开销
+class TwoOpPatternPass : public PatternFusionBasePass {
+ public:
+  TwoOpPatternPass(std::string input_type, std::string output_type)
+      : input_type_(std::move(input_type)), output_type_(std::move(output_type)) {}
+
+ protected:
+  std::vector<FusionPattern *> DefinePatterns() override {
+    auto pattern = new (std::nothrow) FusionPattern(input_type_ + output_type_);
+    if (pattern == nullptr) {
+      return {};
+    }
+    pattern->AddOpDesc("input", {input_type_})
+        .AddOpDesc("output", {output_type_})
+        .SetInputs("output", {"input"})
+        .SetOutput("output");
+    return {pattern};
+  }
+
+  Status Fusion(ComputeGraph &graph, Mapping &mapping, std::vector<NodePtr> &new_nodes) override {
+    (void)graph;
+    (void)mapping;
+    (void)new_nodes;
+    return NOT_CHANGED;
+  }
+
+ private:
+  std::string input_type_;
+  std::string output_type_;
+};
+
+NodePtr AddNode(const ComputeGraphPtr &graph, const std::string &name, const std::string &type,
+                const std::vector<NodePtr> &inputs) {
+  auto op_desc = std::make_shared<OpDesc>(name, type);
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    (void)op_desc->AddInputDesc(GeTensorDesc());
+  }
+  (void)op_desc->AddOutputDesc(GeTensorDesc());
+  auto node = graph->AddNode(op_desc);
+  for (size_t i = 0U; i < inputs.size(); ++i) {
+    (void)GraphUtils::AddEdge(inputs[i]->GetOutDataAnchor(0), node->GetInDataAnchor(static_cast<int32_t>(i)));
+  }
+  return node;
+}
+
+// 每层为attention + ffn，约30个节点
+ComputeGraphPtr BuildTransformerGraph(const int64_t layer_num) {
+  auto graph = std::make_shared<ComputeGraph>("transformer");
+  NodePtr x = AddNode(graph, "x", "Data", {});
+  for (int64_t i = 0; i < layer_num; ++i) {
+    const std::string l = "layer" + std::to_string(i) + "_";
+    auto matmul = [&graph, &l](const std::string &name, const NodePtr &input) {
+      auto weight = AddNode(graph, l + name + "_w", "Const", {});
+      return AddNode(graph, l + name, "MatMul", {input, weight});
+    };
+    auto q = AddNode(graph, l + "q_trans", "Transpose", {AddNode(graph, l + "q_reshape", "Reshape", {matmul("q", x)})});
+    auto k = AddNode(graph, l + "k_trans", "Transpose", {AddNode(graph, l + "k_reshape", "Reshape", {matmul("k", x)})});
+    auto v = AddNode(graph, l + "v_trans", "Transpose", {AddNode(graph, l + "v_reshape", "Reshape", {matmul("v", x)})});
+    auto scale = AddNode(graph, l + "scale", "Const", {});
+    auto score = AddNode(graph, l + "score_mul", "Mul", {AddNode(graph, l + "qk", "BatchMatMul", {q, k}), scale});
+    auto prob = AddNode(graph, l + "softmax", "Softmax", {score});
+    auto ctx = AddNode(graph, l + "ctx_reshape", "Reshape", {AddNode(graph, l + "pv", "BatchMatMul", {prob, v})});
+    auto attn = AddNode(graph, l + "attn_add", "Add", {matmul("o", ctx), x});
+    auto ln1 = AddNode(graph, l + "ln1", "LayerNorm", {attn});
+    auto bias = AddNode(graph, l + "ffn_bias", "Const", {});
+    auto ffn1 = AddNode(graph, l + "ffn1_add", "Add", {matmul("ffn1", ln1), bias});
+    auto gelu = AddNode(graph, l + "gelu", "Gelu", {ffn1});
+    auto ffn = AddNode(graph, l + "ffn_add", "Add", {matmul("ffn2", gelu), ln1});
+    x = AddNode(graph, l + "ln2", "LayerNorm", {ffn});
+  }
+  (void)AddNode(graph, "output", "NetOutput", {x});
+  return graph;
+}
+
+// 所有类型两两组合，共144个pass
+std::vector<std::unique_ptr<PatternFusionBasePass>> CreatePasses() {
+  std::vector<std::unique_ptr<PatternFusionBasePass>> passes;
+  for (const auto &input_type : kOpTypes) {
+    for (const auto &output_type : kOpTypes) {
+      passes.emplace_back(new TwoOpPatternPass(input_type, output_type));
+      passes.back()->SetName(input_type + output_type + "FusionPass");
+      (void)passes.back()->GetPatterns();
+    }
+  }
+  return passes;
+}
+}  // namespace
+
+// 每个pass各自遍历图查找输出节点并匹配
+static void FusionPattern_RunPassesPerPass(benchmark::State &state) {
+  auto graph = BuildTransformerGraph(state.range(0));
+  auto passes = CreatePasses();
+  for (auto _ : state) {
+    for (const auto &pass : passes) {
+      benchmark::DoNotOptimize(pass->Run(*graph));
+    }
+  }
+  state.counters["nodes"] = static_cast<double>(graph->GetDirectNodesSize());
+}
+BENCHMARK(FusionPattern_RunPassesPerPass)->Arg(24)->Arg(96)->Unit(benchmark::kMillisecond);
+
+// 一次遍历建立所有pattern的索引，pass只对满足边形状的候选节点匹配
+static void FusionPattern_RunPassesWithIndex(benchmark::State &state) {
+  auto graph = BuildTransformerGraph(state.range(0));
+  auto passes = CreatePasses();
+  for (auto _ : state) {
+    auto index = std::make_shared<FusionPatternIndex>();
+    for (const auto &pass : passes) {
+      index->AddPatterns(pass->GetPatterns());
+    }
+    index->Build(*graph);
+    FusionPatternIndex::SetToGraph(*graph, index);
+    for (const auto &pass : passes) {
+      benchmark::DoNotOptimize(pass->Run(*graph));
+    }
+    FusionPatternIndex::SetToGraph(*graph, nullptr);
+  }
+  state.counters["nodes"] = static_cast<double>(graph->GetDirectNodesSize());
+}
+BENCHMARK(FusionPattern_RunPassesWithIndex)->Arg(24)->Arg(96)->Unit(benchmark::kMillisecond);
+
+// 改图后遍历整图更新：改接一条边，对比边形状后只有相邻节点重新匹配
+static void FusionPattern_IndexUpdateAfterRewrite(benchmark::State &state) {
+  auto graph = BuildTransformerGraph(state.range(0));
+  auto passes = CreatePasses();
+  FusionPatternIndex index;
+  for (const auto &pass : passes) {
+    index.AddPatterns(pass->GetPatterns());
+  }
+  index.Build(*graph);
+  const NodePtr gelu = graph->FindNode("layer0_gelu");
+  const NodePtr ffn1_add = graph->FindNode("layer0_ffn1_add");
+  const NodePtr ffn2 = graph->FindNode("layer0_ffn2");
+  for (auto _ : state) {
+    (void)GraphUtils::RemoveEdge(gelu->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(ffn1_add->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    index.Update(*graph);
+    (void)GraphUtils::RemoveEdge(ffn1_add->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(gelu->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    index.Update(*graph);
+  }
+  state.counters["nodes"] = static_cast<double>(graph->GetDirectNodesSize());
+}
+BENCHMARK(FusionPattern_IndexUpdateAfterRewrite)->Arg(24)->Arg(96)->Unit(benchmark::kMicrosecond);
+
+// 改图后只更新改写涉及的节点及其相邻节点，耗时与图规模无关
+static void FusionPattern_IndexUpdateTouchedNodes(benchmark::State &state) {
+  auto graph = BuildTransformerGraph(state.range(0));
+  auto passes = CreatePasses();
+  FusionPatternIndex index;
+  for (const auto &pass : passes) {
+    index.AddPatterns(pass->GetPatterns());
+  }
+  index.Build(*graph);
+  const NodePtr gelu = graph->FindNode("layer0_gelu");
+  const NodePtr ffn1_add = graph->FindNode("layer0_ffn1_add");
+  const NodePtr ffn2 = graph->FindNode("layer0_ffn2");
+  std::vector<NodePtr> touched_nodes;
+  for (auto _ : state) {
+    touched_nodes.clear();
+    FusionPatternIndex::CollectTouchedNodes(ffn2, touched_nodes);
+    (void)GraphUtils::RemoveEdge(gelu->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(ffn1_add->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    FusionPatternIndex::CollectTouchedNodes(ffn2, touched_nodes);
+    index.Update(*graph, touched_nodes);
+    touched_nodes.clear();
+    FusionPatternIndex::CollectTouchedNodes(ffn2, touched_nodes);
+    (void)GraphUtils::RemoveEdge(ffn1_add->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    (void)GraphUtils::AddEdge(gelu->GetOutDataAnchor(0), ffn2->GetInDataAnchor(0));
+    FusionPatternIndex::CollectTouchedNodes(ffn2, touched_nodes);
+    index.Update(*graph, touched_nodes);
+  }
+  state.counters["nodes"] = static_cast<double>(graph->GetDirectNodesSize());
+}
+BENCHMARK(FusionPattern_IndexUpdateTouchedNodes)->Arg(24)->Arg(96)->Unit(benchmark::kMicrosecond);
+}  // namespace fe
+
+BENCHMARK_MAIN();
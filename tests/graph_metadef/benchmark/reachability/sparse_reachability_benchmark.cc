@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include "common/large_bm.h"
+#include "common/sparse_reachability.h"
+
+namespace ge {
+namespace {
+constexpr uint32_t kInputWindow = 32U;
+constexpr size_t kQueryNum = 1024U;
+constexpr uint32_t kScopeSize = 3U;
+constexpr uint32_t kScopeStride = 97U;
+
+// 节点i的输入来自[i - kInputWindow, i)，与网络中边大多连接相邻层的特点一致
+std::vector<std::pair<uint32_t, uint32_t>> BuildEdges(const uint32_t node_num) {
+  std::mt19937 rng(node_num);
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (uint32_t i = 1U; i < node_num; ++i) {
+    const uint32_t window = (i < kInputWindow) ? i : kInputWindow;
+    edges.emplace_back(i - 1U, i);
+    edges.emplace_back(i - 1U - static_cast<uint32_t>(rng() % window), i);
+  }
+  return edges;
+}
+
+// 融合检测中的查询大多发生在拓扑序相近的节点之间
+std::vector<std::pair<uint32_t, uint32_t>> BuildQueries(const uint32_t node_num) {
+  std::mt19937 rng(node_num + 1U);
+  std::vector<std::pair<uint32_t, uint32_t>> queries;
+  for (size_t i = 0U; i < kQueryNum; ++i) {
+    const uint32_t src = static_cast<uint32_t>(rng() % node_num);
+    const uint32_t dst = static_cast<uint32_t>(rng() % node_num);
+    queries.emplace_back(src, (src / 64U * 64U + dst % 64U) % node_num);
+  }
+  return queries;
+}
+
+// 与PatternFusionBasePass::CycleDetection一致：对融合范围内每个节点的范围外后继peer_out，
+// 查询peer_out是否可达范围内的其他节点。融合范围取拓扑序相邻的kScopeSize个节点
+std::vector<std::pair<uint32_t, uint32_t>> BuildCycleDetectionQueries(
+    const uint32_t node_num, const std::vector<std::pair<uint32_t, uint32_t>> &edges) {
+  std::vector<std::vector<uint32_t>> out_nodes(node_num);
+  for (const auto &edge : edges) {
+    out_nodes[edge.first].emplace_back(edge.second);
+  }
+  std::vector<std::pair<uint32_t, uint32_t>> queries;
+  for (uint32_t first = 0U; first + kScopeSize <= node_num; first += kScopeStride) {
+    const uint32_t last = first + kScopeSize;
+    for (uint32_t node = first; node < last; ++node) {
+      for (const uint32_t peer_out : out_nodes[node]) {
+        if ((peer_out >= first) && (peer_out < last)) {
+          continue;
+        }
+        for (uint32_t node_temp = first; node_temp < last; ++node_temp) {
+          if (node_temp != node) {
+            queries.emplace_back(peer_out, node_temp);
+          }
+        }
+      }
+    }
+  }
+  return queries;
+}
+
+std::vector<LargeBitmap> BuildBitmaps(const uint32_t node_num, const std::vector<std::pair<uint32_t, uint32_t>> &edges) {
+  std::vector<LargeBitmap> bit_maps(node_num, LargeBitmap(node_num));
+  for (uint32_t i = 0U; i < node_num; ++i) {
+    bit_maps[i].SetValues(0U);
+    bit_maps[i].SetBit(i);
+  }
+  for (const auto &edge : edges) {
+    bit_maps[edge.second].Or(bit_maps[edge.first]);
+  }
+  return bit_maps;
+}
+
+void BuildReachability(const uint32_t node_num, const std::vector<std::pair<uint32_t, uint32_t>> &edges,
+                       SparseReachability &reachability) {
+  reachability.Reset(node_num);
+  for (const auto &edge : edges) {
+    reachability.AddEdge(edge.first, edge.second);
+  }
+  reachability.Finalize();
+}
+}  // namespace
+
+static void Reachability_BitmapBuild(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto edges = BuildEdges(node_num);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(BuildBitmaps(node_num, edges));
+  }
+  state.counters["memory_bytes"] = static_cast<double>(node_num) * ((node_num + 63U) / 64U) * sizeof(uint64_t);
+}
+BENCHMARK(Reachability_BitmapBuild)->Arg(1024)->Arg(8192)->Arg(32768)->Unit(benchmark::kMillisecond);
+
+static void Reachability_SparseBuild(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto edges = BuildEdges(node_num);
+  SparseReachability reachability;
+  for (auto _ : state) {
+    BuildReachability(node_num, edges, reachability);
+  }
+  state.counters["memory_bytes"] = static_cast<double>(reachability.GetMemorySize());
+}
+BENCHMARK(Reachability_SparseBuild)->Arg(1024)->Arg(8192)->Arg(32768)->Unit(benchmark::kMillisecond);
+
+static void Reachability_BitmapQuery(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto bit_maps = BuildBitmaps(node_num, BuildEdges(node_num));
+  const auto queries = BuildQueries(node_num);
+  for (auto _ : state) {
+    for (const auto &query : queries) {
+      benchmark::DoNotOptimize(bit_maps[query.second].GetBit(query.first));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(Reachability_BitmapQuery)->Arg(1024)->Arg(8192);
+
+static void Reachability_SparseQuery(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  SparseReachability reachability;
+  BuildReachability(node_num, BuildEdges(node_num), reachability);
+  const auto queries = BuildQueries(node_num);
+  for (auto _ : state) {
+    for (const auto &query : queries) {
+      benchmark::DoNotOptimize(reachability.IsReachable(query.first, query.second));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(Reachability_SparseQuery)->Arg(1024)->Arg(8192)->Arg(32768);
+
+static void Reachability_BitmapCycleDetectionQuery(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto edges = BuildEdges(node_num);
+  const auto bit_maps = BuildBitmaps(node_num, edges);
+  const auto queries = BuildCycleDetectionQueries(node_num, edges);
+  for (auto _ : state) {
+    for (const auto &query : queries) {
+      benchmark::DoNotOptimize(bit_maps[query.second].GetBit(query.first));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(Reachability_BitmapCycleDetectionQuery)->Arg(1024)->Arg(8192);
+
+static void Reachability_SparseCycleDetectionQuery(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto edges = BuildEdges(node_num);
+  SparseReachability reachability;
+  BuildReachability(node_num, edges, reachability);
+  const auto queries = BuildCycleDetectionQueries(node_num, edges);
+  for (auto _ : state) {
+    for (const auto &query : queries) {
+      benchmark::DoNotOptimize(reachability.IsReachable(query.first, query.second));
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * queries.size()));
+}
+BENCHMARK(Reachability_SparseCycleDetectionQuery)->Arg(1024)->Arg(8192)->Arg(32768);
+
+// 每次融合拓扑序相邻的若干节点后更新可达关系
+static void Reachability_BitmapUpdate(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  const auto origin_bit_maps = BuildBitmaps(node_num, BuildEdges(node_num));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto bit_maps = origin_bit_maps;
+    state.ResumeTiming();
+    for (uint32_t first = 0U; first + 3U < node_num; first += 97U) {
+      LargeBitmap new_bit_vector(node_num);
+      new_bit_vector.SetValues(0U);
+      for (uint32_t i = first; i < first + 3U; ++i) {
+        new_bit_vector.Or(bit_maps[i]);
+      }
+      for (auto &node_map : bit_maps) {
+        if (node_map.GetBit(first) || node_map.GetBit(first + 1U) || node_map.GetBit(first + 2U)) {
+          node_map.Or(new_bit_vector);
+        }
+      }
+    }
+  }
+}
+BENCHMARK(Reachability_BitmapUpdate)->Arg(1024)->Arg(8192)->Unit(benchmark::kMillisecond);
+
+static void Reachability_SparseUpdate(benchmark::State &state) {
+  const auto node_num = static_cast<uint32_t>(state.range(0));
+  SparseReachability origin_reachability;
+  BuildReachability(node_num, BuildEdges(node_num), origin_reachability);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto reachability = origin_reachability;
+    state.ResumeTiming();
+    for (uint32_t first = 0U; first + 3U < node_num; first += 97U) {
+      reachability.Contract({first, first + 1U, first + 2U});
+    }
+  }
+}
+BENCHMARK(Reachability_SparseUpdate)->Arg(1024)->Arg(8192)->Arg(32768)->Unit(benchmark::kMillisecond);
+}  // namespace ge
+
+BENCHMARK_MAIN();
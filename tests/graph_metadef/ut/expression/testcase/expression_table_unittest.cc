@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <symengine/add.h>
+#include <symengine/functions.h>
+#include <symengine/integer.h>
+#include <symengine/mul.h>
+#include <symengine/simplify.h>
+#include <symengine/symbol.h>
+#include "expression/expression_table.h"
+#include "attribute_group/attr_group_shape_env.h"
+#include "graph/symbolizer/symbolic.h"
+
+namespace ge {
+class UtestExpressionTable : public testing::Test {
+ protected:
+  void SetUp() {
+    ExpressionTable::GetInstance().Clear();
+  }
+
+  void TearDown() {
+    ExpressionTable::GetInstance().Clear();
+  }
+};
+
+namespace {
+// (s0 + 1) * s1
+SymEngineExprPtr BuildExpr() {
+  return SymEngine::mul(SymEngine::add(SymEngine::symbol("s0"), SymEngine::integer(1)), SymEngine::symbol("s1"));
+}
+}  // namespace
+
+TEST_F(UtestExpressionTable, InternSameStructure) {
+  const auto expr1 = BuildExpr();
+  const auto expr2 = BuildExpr();
+  ASSERT_NE(expr1.get(), expr2.get());
+  const auto interned1 = ExpressionTable::GetInstance().Intern(expr1);
+  const auto interned2 = ExpressionTable::GetInstance().Intern(expr2);
+  EXPECT_EQ(interned1.get(), interned2.get());
+  EXPECT_EQ(ExpressionTable::GetInstance().Size(), 1U);
+  ExpressionTable::GetInstance().Intern(SymEngine::symbol("s2"));
+  EXPECT_EQ(ExpressionTable::GetInstance().Size(), 2U);
+}
+
+TEST_F(UtestExpressionTable, SimplifyMemoized) {
+  int32_t call_num = 0;
+  const auto func = [&call_num]() {
+    ++call_num;
+    return SymEngine::expand(BuildExpr());
+  };
+  const auto result1 = ExpressionTable::GetInstance().Simplify(BuildExpr(), func);
+  const auto result2 = ExpressionTable::GetInstance().Simplify(BuildExpr(), func);
+  EXPECT_EQ(call_num, 1);
+  EXPECT_EQ(result1.get(), result2.get());
+  EXPECT_TRUE(SymEngine::eq(*result1, *SymEngine::expand(BuildExpr())));
+
+  // 清空后重新计算
+  ExpressionTable::GetInstance().Clear();
+  EXPECT_EQ(ExpressionTable::GetInstance().Size(), 0U);
+  (void)ExpressionTable::GetInstance().Simplify(BuildExpr(), func);
+  EXPECT_EQ(call_num, 2);
+}
+
+TEST_F(UtestExpressionTable, SubstituteKeyedByTypeAndVars) {
+  int32_t call_num = 0;
+  const auto expr = BuildExpr();
+  SymEngine::map_basic_basic vars1;
+  vars1[SymEngine::symbol("s0")] = SymEngine::integer(2);
+  SymEngine::map_basic_basic vars2;
+  vars2[SymEngine::symbol("s0")] = SymEngine::integer(3);
+  const auto replace1 = [&call_num, &expr, &vars1]() {
+    ++call_num;
+    return expr->xreplace(vars1);
+  };
+  const auto subs1 = [&call_num, &expr, &vars1]() {
+    ++call_num;
+    return expr->subs(vars1);
+  };
+  const auto replace2 = [&call_num, &expr, &vars2]() {
+    ++call_num;
+    return expr->xreplace(vars2);
+  };
+  auto &table = ExpressionTable::GetInstance();
+  const auto result1 = table.Substitute(SubstituteType::kReplace, expr, vars1, replace1);
+  EXPECT_TRUE(SymEngine::eq(*result1, *SymEngine::mul(SymEngine::integer(3), SymEngine::symbol("s1"))));
+  (void)table.Substitute(SubstituteType::kReplace, BuildExpr(), vars1, replace1);
+  EXPECT_EQ(call_num, 1);
+  (void)table.Substitute(SubstituteType::kSubs, expr, vars1, subs1);
+  EXPECT_EQ(call_num, 2);
+  const auto result2 = table.Substitute(SubstituteType::kReplace, expr, vars2, replace2);
+  EXPECT_EQ(call_num, 3);
+  EXPECT_TRUE(SymEngine::eq(*result2, *SymEngine::mul(SymEngine::integer(4), SymEngine::symbol("s1"))));
+}
+
+TEST_F(UtestExpressionTable, ExpressionApiUseTable) {
+  const auto s0 = Symbol("s0");
+  const auto s1 = Symbol("s1");
+  const auto expr = (s0 + Symbol(1)) * s1 - s1;
+  const auto simplified1 = expr.Simplify();
+  const size_t table_size = ExpressionTable::GetInstance().Size();
+  const auto simplified2 = ((s0 + Symbol(1)) * s1 - s1).Simplify();
+  EXPECT_EQ(simplified1, simplified2);
+  EXPECT_EQ(simplified1, s0 * s1);
+  EXPECT_EQ(ExpressionTable::GetInstance().Size(), table_size);
+
+  EXPECT_EQ(expr.Replace({{s0, Symbol(2)}}).Simplify(), Symbol(2) * s1);
+  EXPECT_EQ(expr.Subs({{s1, Symbol(3)}}).Simplify(), Symbol(3) * s0);
+}
+
+TEST_F(UtestExpressionTable, HashSymbolConsistentWithEqual) {
+  const auto expr1 = Symbol("s0") * Symbol("s1") + Symbol(1);
+  const auto expr2 = Symbol("s0") * Symbol("s1") + Symbol(1);
+  EXPECT_EQ(HashSymbol()(expr1), HashSymbol()(expr2));
+  EXPECT_EQ(HashSymbol()(Symbol(8)), std::hash<int64_t>()(8));
+}
+}  // namespace ge
@@ -10,6 +10,7 @@
 
 #include <gtest/gtest.h>
 #include <vector>
+#include <set>
 #include <sstream>
 #include "graph/utils/cycle_detector.h"
 #include "graph/utils/graph_utils.h"
@@ -152,22 +153,6 @@ static ComputeGraphPtr BuildFusionGraph02(std::vector<ge::NodePtr> &fusion_nodes
   return graph;
 }
 
-/*
-ori connection_matrix(5x5):
-1 0 0 0 0
-1 1 0 0 0
-1 0 1 0 0
-1 0 1 1 0
-1 1 1 1 1
-After update(6x6):
-1 1 1 0 0 1
-1 1 1 0 0 1
-1 1 1 0 0 1
-1 1 1 1 0 1
-1 1 1 1 1 1
-1 1 1 0 0 1
-*/
-
 TEST_F(UtestCycleDetector, cycle_detection_02) {
   std::vector<ge::NodePtr> fusion_nodes;
   auto graph = BuildFusionGraph02(fusion_nodes);
@@ -176,25 +161,38 @@ TEST_F(UtestCycleDetector, cycle_detection_02) {
   EXPECT_NE(detector, nullptr);
   bool has_cycle = detector->HasDetectedCycle({fusion_nodes});
   EXPECT_FALSE(has_cycle);
-  std::string res_ori = "1000011000101001011011111";
-  std::string res_update = "111001111001111001111101111111111001";
-  std::stringstream val_ori;
-  for (size_t i = 0; i < 5; ++i) {
-    auto bit_map = detector->connectivity_->impl_->bit_maps_[i];
-    for (size_t j = 0; j < 5; ++j) {
-      val_ori << bit_map.GetBit(j);
+  const auto &nodes = graph->GetDirectNode();
+  const std::vector<NodePtr> all_nodes(nodes.begin(), nodes.end());
+  const auto a = graph->FindNode("A");
+  const auto b = graph->FindNode("B");
+  const auto c = graph->FindNode("C");
+  const auto d = graph->FindNode("D");
+  const auto netoutput = graph->FindNode("NetOutput");
+  const std::set<std::pair<NodePtr, NodePtr>> ori_connected = {
+      {a, b}, {a, c}, {a, d}, {b, d}, {a, netoutput}, {b, netoutput}, {c, netoutput}, {d, netoutput}};
+  for (const auto &src : all_nodes) {
+    for (const auto &dst : all_nodes) {
+      const bool expect_connected = (src == dst) || (ori_connected.count({src, dst}) > 0U);
+      EXPECT_EQ(detector->connectivity_->IsConnected(src, dst), expect_connected)
+          << src->GetName() << "->" << dst->GetName();
     }
   }
-  EXPECT_EQ(val_ori.str(), res_ori);
+
+  // A/B/C及融合后的ABC互相可达，继承全部前驱和后继
   detector->ExpandAndUpdate(fusion_nodes, "ABC");
-  std::stringstream val_update;
-  for (size_t i = 0; i < 6; ++i) {
-    auto bit_map = detector->connectivity_->impl_->bit_maps_[i];
-    for (size_t j = 0; j < 6; ++j) {
-      val_update << bit_map.GetBit(j);
+  ut::GraphBuilder fused_builder("fused_graph");
+  const auto abc = fused_builder.AddNode("ABC", "ABC", 1, 1);
+  const std::vector<NodePtr> fused_nodes = {a, b, c, abc};
+  for (const auto &src : fused_nodes) {
+    for (const auto &dst : fused_nodes) {
+      EXPECT_TRUE(detector->connectivity_->IsConnected(src, dst));
     }
+    EXPECT_TRUE(detector->connectivity_->IsConnected(src, d));
+    EXPECT_TRUE(detector->connectivity_->IsConnected(src, netoutput));
+    EXPECT_FALSE(detector->connectivity_->IsConnected(d, src));
+    EXPECT_FALSE(detector->connectivity_->IsConnected(netoutput, src));
   }
-  EXPECT_EQ(val_update.str(), res_update);
+  EXPECT_FALSE(detector->connectivity_->IsConnected(netoutput, d));
 }
 
 /*   A--->B---->C---->D
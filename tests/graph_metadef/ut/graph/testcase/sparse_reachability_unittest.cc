@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "common/sparse_reachability.h"
+
+namespace ge {
+class UtestSparseReachability : public testing::Test {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+/*  0 -> 1 -> 2
+ *   \-> 3    4 */
+TEST_F(UtestSparseReachability, query_after_finalize) {
+  SparseReachability reachability;
+  reachability.Reset(5U);
+  reachability.AddEdge(0U, 1U);
+  reachability.AddEdge(1U, 2U);
+  reachability.AddEdge(0U, 3U);
+  reachability.Finalize();
+  EXPECT_TRUE(reachability.IsReachable(0U, 2U));
+  EXPECT_TRUE(reachability.IsReachable(0U, 3U));
+  EXPECT_TRUE(reachability.IsReachable(4U, 4U));
+  EXPECT_FALSE(reachability.IsReachable(2U, 0U));
+  EXPECT_FALSE(reachability.IsReachable(1U, 3U));
+  EXPECT_FALSE(reachability.IsReachable(3U, 2U));
+  EXPECT_FALSE(reachability.IsReachable(0U, 4U));
+  EXPECT_FALSE(reachability.IsReachable(0U, 5U));
+}
+
+TEST_F(UtestSparseReachability, cycle_is_contracted_in_finalize) {
+  SparseReachability reachability;
+  reachability.Reset(4U);
+  reachability.AddEdge(0U, 1U);
+  reachability.AddEdge(1U, 2U);
+  reachability.AddEdge(2U, 1U);
+  reachability.AddEdge(2U, 3U);
+  reachability.Finalize();
+  EXPECT_TRUE(reachability.IsReachable(2U, 1U));
+  EXPECT_TRUE(reachability.IsReachable(1U, 2U));
+  EXPECT_TRUE(reachability.IsReachable(0U, 3U));
+  EXPECT_FALSE(reachability.IsReachable(3U, 1U));
+}
+
+TEST_F(UtestSparseReachability, add_edge_after_finalize) {
+  SparseReachability reachability;
+  reachability.Reset(4U);
+  reachability.Finalize();
+  // 新边与当前拓扑序相反时需要重排序号
+  reachability.AddEdge(3U, 2U);
+  reachability.AddEdge(2U, 1U);
+  reachability.AddEdge(1U, 0U);
+  EXPECT_TRUE(reachability.IsReachable(3U, 0U));
+  EXPECT_FALSE(reachability.IsReachable(0U, 3U));
+
+  // 成环后环上节点互相可达
+  reachability.AddEdge(0U, 2U);
+  EXPECT_TRUE(reachability.IsReachable(0U, 1U));
+  EXPECT_TRUE(reachability.IsReachable(2U, 0U));
+  EXPECT_FALSE(reachability.IsReachable(0U, 3U));
+  EXPECT_TRUE(reachability.IsReachable(3U, 1U));
+
+  const uint32_t new_node = reachability.AddNode();
+  reachability.AddEdge(new_node, 3U);
+  EXPECT_TRUE(reachability.IsReachable(new_node, 0U));
+  EXPECT_FALSE(reachability.IsReachable(0U, new_node));
+}
+
+/*  0 -> 1 -> 2 -> 3
+ *   \-----> 4 --/      contract 0 and 3, 1/2/4 are on the paths between them */
+TEST_F(UtestSparseReachability, contract_nodes_on_path) {
+  SparseReachability reachability;
+  reachability.Reset(7U);
+  reachability.AddEdge(0U, 1U);
+  reachability.AddEdge(1U, 2U);
+  reachability.AddEdge(2U, 3U);
+  reachability.AddEdge(0U, 4U);
+  reachability.AddEdge(4U, 3U);
+  reachability.AddEdge(5U, 1U);
+  reachability.AddEdge(3U, 6U);
+  reachability.Finalize();
+  EXPECT_FALSE(reachability.IsReachable(5U, 0U));
+
+  reachability.Contract({0U, 3U});
+  for (uint32_t src = 0U; src < 5U; ++src) {
+    for (uint32_t dst = 0U; dst < 5U; ++dst) {
+      EXPECT_TRUE(reachability.IsReachable(src, dst));
+    }
+    EXPECT_TRUE(reachability.IsReachable(5U, src));
+    EXPECT_TRUE(reachability.IsReachable(src, 6U));
+    EXPECT_FALSE(reachability.IsReachable(6U, src));
+  }
+
+  const uint32_t fused_node = reachability.AddNodeToGroup(0U);
+  EXPECT_TRUE(reachability.IsReachable(fused_node, 2U));
+  EXPECT_TRUE(reachability.IsReachable(5U, fused_node));
+  EXPECT_FALSE(reachability.IsReachable(fused_node, 5U));
+}
+
+TEST_F(UtestSparseReachability, copy_is_independent) {
+  SparseReachability reachability;
+  reachability.Reset(3U);
+  reachability.AddEdge(0U, 1U);
+  reachability.AddEdge(1U, 2U);
+  reachability.Finalize();
+  const SparseReachability back_up = reachability;
+  reachability.Contract({0U, 2U});
+  EXPECT_TRUE(reachability.IsReachable(2U, 0U));
+  EXPECT_FALSE(back_up.IsReachable(2U, 0U));
+  reachability = back_up;
+  EXPECT_FALSE(reachability.IsReachable(2U, 0U));
+}
+
+TEST_F(UtestSparseReachability, concurrent_query) {
+  constexpr uint32_t kNodeNum = 256U;
+  SparseReachability reachability;
+  reachability.Reset(kNodeNum);
+  for (uint32_t i = 1U; i < kNodeNum; ++i) {
+    reachability.AddEdge(i - 1U, i);
+  }
+  reachability.Finalize();
+  reachability.Contract({10U, 20U});
+  std::atomic<uint32_t> mismatch_count{0U};
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0U; t < 4U; ++t) {
+    threads.emplace_back([&reachability, &mismatch_count, t]() {
+      for (uint32_t i = t; i < kNodeNum; i += 4U) {
+        if (!reachability.IsReachable(0U, i) || (reachability.IsReachable(kNodeNum - 1U, i) != (i == kNodeNum - 1U))) {
+          ++mismatch_count;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(mismatch_count.load(), 0U);
+}
+
+TEST_F(UtestSparseReachability, memory_is_linear) {
+  constexpr uint32_t kNodeNum = 4096U;
+  SparseReachability reachability;
+  reachability.Reset(kNodeNum);
+  for (uint32_t i = 1U; i < kNodeNum; ++i) {
+    reachability.AddEdge(i - 1U, i);
+  }
+  reachability.Finalize();
+  EXPECT_TRUE(reachability.IsReachable(0U, kNodeNum - 1U));
+  EXPECT_FALSE(reachability.IsReachable(kNodeNum - 1U, 0U));
+  EXPECT_LT(reachability.GetMemorySize(), kNodeNum * kNodeNum / 8U);
+}
+}  // namespace ge
@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <gtest/gtest.h>
+#include "graph/compute_graph.h"
+#include "graph/utils/graph_utils.h"
+#include "register/graph_optimizer/fusion_common/pattern_fusion_base_pass.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern.h"
+#include "register/graph_optimizer/graph_fusion/fusion_pattern_index.h"
+#include "graph_builder_utils.h"
+
+using namespace std;
+using namespace ge;
+
+namespace fe {
+namespace {
+// conv -> add -> relu
+class ConvAddReluPatternPass : public PatternFusionBasePass {
+ public:
+  std::vector<FusionPattern *> DefinePatterns() override {
+    std::vector<FusionPattern *> patterns;
+    auto pattern = new (std::nothrow) FusionPattern("ConvAddReluPattern");
+    if (pattern != nullptr) {
+      pattern->AddOpDesc("conv", {"Conv2D"})
+          .AddOpDesc("add", {"Add"})
+          .AddOpDesc("relu", {"Relu"})
+          .SetInputs("add", {"conv"})
+          .SetInputs("relu", {"add"})
+          .SetOutput("relu");
+      patterns.push_back(pattern);
+    }
+    return patterns;
+  }
+
+  Status Fusion(ComputeGraph &graph, Mapping &mapping, vector<NodePtr> &new_nodes) override {
+    ++fusion_times;
+    return NOT_CHANGED;
+  }
+
+  size_t fusion_times = 0U;
+};
+
+// 删除匹配到的relu，使后续pattern依赖增量更新后的索引
+class RemoveReluPass : public PatternFusionBasePass {
+ public:
+  std::vector<FusionPattern *> DefinePatterns() override {
+    std::vector<FusionPattern *> patterns;
+    auto pattern = new (std::nothrow) FusionPattern("RemoveReluPattern");
+    if (pattern != nullptr) {
+      pattern->AddOpDesc("relu", {"Relu"}).SetOutput("relu");
+      patterns.push_back(pattern);
+    }
+    return patterns;
+  }
+
+  Status Fusion(ComputeGraph &graph, Mapping &mapping, vector<NodePtr> &new_nodes) override {
+    const NodePtr relu = GetNodeFromMapping("relu", mapping);
+    if (relu == nullptr) {
+      return FAILED;
+    }
+    if (GraphUtils::IsolateNode(relu, {0}) != GRAPH_SUCCESS) {
+      return FAILED;
+    }
+    const ComputeGraphPtr owner_graph = relu->GetOwnerComputeGraph();
+    return (GraphUtils::RemoveNodeWithoutRelink(owner_graph, relu) == GRAPH_SUCCESS) ? SUCCESS : FAILED;
+  }
+};
+
+ComputeGraphPtr BuildGraph(const size_t layer_num) {
+  ut::GraphBuilder builder("fusion_pattern_index");
+  NodePtr last = builder.AddNode("data", "Data", 0, 1);
+  for (size_t i = 0U; i < layer_num; ++i) {
+    const std::string idx = std::to_string(i);
+    auto conv = builder.AddNode("conv" + idx, "Conv2D", 1, 1);
+    auto mul = builder.AddNode("mul" + idx, "Mul", 1, 1);
+    auto add = builder.AddNode("add" + idx, "Add", 2, 1);
+    auto relu = builder.AddNode("relu" + idx, "Relu", 1, 1);
+    builder.AddDataEdge(last, 0, conv, 0);
+    builder.AddDataEdge(last, 0, mul, 0);
+    // 奇数层add的输入中没有conv，满足边形状但完整匹配失败
+    builder.AddDataEdge((i % 2U == 0U) ? conv : mul, 0, add, 0);
+    builder.AddDataEdge(mul, 0, add, 1);
+    builder.AddDataEdge(add, 0, relu, 0);
+    last = relu;
+  }
+  auto output = builder.AddNode("output", "NetOutput", 1, 0);
+  builder.AddDataEdge(last, 0, output, 0);
+  return builder.GetGraph();
+}
+}  // namespace
+
+class UTestFusionPatternIndex : public testing::Test {
+ protected:
+  void TearDown() override {}
+};
+
+TEST_F(UTestFusionPatternIndex, build_index_filter_by_edge_shape) {
+  auto graph = BuildGraph(4U);
+  ConvAddReluPatternPass conv_pass;
+  RemoveReluPass relu_pass;
+  auto index = std::make_shared<FusionPatternIndex>();
+  index->AddPatterns(conv_pass.GetPatterns());
+  index->AddPatterns(relu_pass.GetPatterns());
+  index->AddPattern(nullptr);
+  index->Build(*graph);
+  EXPECT_EQ(index->GetPatternNum(), 2U);
+  EXPECT_EQ(index->GetNodeNum(), graph->GetDirectNodesSize());
+  EXPECT_EQ(index->GetLastMatchedNodeNum(), graph->GetDirectNodesSize());
+
+  std::vector<NodePtr> candidates;
+  ASSERT_TRUE(index->GetCandidates(*graph, *conv_pass.GetPatterns()[0], candidates));
+  ASSERT_EQ(candidates.size(), 4U);
+  EXPECT_EQ(candidates[0]->GetName(), "relu0");
+  candidates.clear();
+  ASSERT_TRUE(index->GetCandidates(*graph, *relu_pass.GetPatterns()[0], candidates));
+  EXPECT_EQ(candidates.size(), 4U);
+
+  // 未编入索引的pattern由调用者遍历图
+  FusionPattern other_pattern("Other");
+  other_pattern.AddOpDesc("add", {"Add"}).SetOutput("add");
+  ASSERT_TRUE(other_pattern.Build());
+  EXPECT_FALSE(index->IsIndexed(&other_pattern));
+  EXPECT_FALSE(index->GetCandidates(*graph, other_pattern, candidates));
+
+  // 建立索引后新增pattern，只匹配该pattern
+  index->AddPattern(&other_pattern);
+  candidates.clear();
+  ASSERT_TRUE(index->GetCandidates(*graph, other_pattern, candidates));
+  EXPECT_EQ(candidates.size(), 4U);
+}
+
+TEST_F(UTestFusionPatternIndex, update_only_rematch_dirty_nodes) {
+  auto graph = BuildGraph(4U);
+  RemoveReluPass relu_pass;
+  auto index = std::make_shared<FusionPatternIndex>();
+  index->AddPatterns(relu_pass.GetPatterns());
+  index->Build(*graph);
+
+  index->Update(*graph);
+  EXPECT_EQ(index->GetLastMatchedNodeNum(), 0U);
+
+  // 删除relu0后，只有add0的输出及conv1、mul1的输入发生变化
+  const NodePtr relu0 = graph->FindNode("relu0");
+  ASSERT_NE(relu0, nullptr);
+  ASSERT_EQ(GraphUtils::IsolateNode(relu0, {0}), GRAPH_SUCCESS);
+  ASSERT_EQ(GraphUtils::RemoveNodeWithoutRelink(graph, relu0), GRAPH_SUCCESS);
+  std::vector<NodePtr> candidates;
+  // 图已变化但索引未更新时不使用索引
+  EXPECT_FALSE(index->GetCandidates(*graph, *relu_pass.GetPatterns()[0], candidates));
+  index->Update(*graph);
+  EXPECT_EQ(index->GetLastMatchedNodeNum(), 3U);
+  EXPECT_EQ(index->GetNodeNum(), graph->GetDirectNodesSize());
+  ASSERT_TRUE(index->GetCandidates(*graph, *relu_pass.GetPatterns()[0], candidates));
+  ASSERT_EQ(candidates.size(), 3U);
+  EXPECT_EQ(candidates[0]->GetName(), "relu1");
+}
+
+TEST_F(UTestFusionPatternIndex, update_with_touched_nodes_only_rematch_them) {
+  auto graph = BuildGraph(4U);
+  RemoveReluPass relu_pass;
+  auto index = std::make_shared<FusionPatternIndex>();
+  index->AddPatterns(relu_pass.GetPatterns());
+  index->Build(*graph);
+
+  // 删除前记录relu0及其相邻节点，删除后只有add0、conv1、mul1需要重新匹配
+  const NodePtr relu0 = graph->FindNode("relu0");
+  ASSERT_NE(relu0, nullptr);
+  std::vector<NodePtr> touched_nodes;
+  FusionPatternIndex::CollectTouchedNodes(relu0, touched_nodes);
+  EXPECT_EQ(touched_nodes.size(), 4U);
+  ASSERT_EQ(GraphUtils::IsolateNode(relu0, {0}), GRAPH_SUCCESS);
+  ASSERT_EQ(GraphUtils::RemoveNodeWithoutRelink(graph, relu0), GRAPH_SUCCESS);
+  index->Update(*graph, touched_nodes);
+  EXPECT_EQ(index->GetLastMatchedNodeNum(), 3U);
+  EXPECT_EQ(index->GetNodeNum(), graph->GetDirectNodesSize());
+  std::vector<NodePtr> candidates;
+  ASSERT_TRUE(index->GetCandidates(*graph, *relu_pass.GetPatterns()[0], candidates));
+  ASSERT_EQ(candidates.size(), 3U);
+  EXPECT_EQ(candidates[0]->GetName(), "relu1");
+
+  // 改图时漏报了新增节点，节点数对不上，回退为遍历整图
+  auto op_desc = std::make_shared<OpDesc>("relu_new", "Relu");
+  (void)op_desc->AddInputDesc(GeTensorDesc());
+  const NodePtr relu_new = graph->AddNode(op_desc);
+  ASSERT_NE(relu_new, nullptr);
+  ASSERT_EQ(GraphUtils::AddEdge(graph->FindNode("relu1")->GetOutDataAnchor(0), relu_new->GetInDataAnchor(0)),
+            GRAPH_SUCCESS);
+  index->Update(*graph, {});
+  EXPECT_EQ(index->GetNodeNum(), graph->GetDirectNodesSize());
+  candidates.clear();
+  ASSERT_TRUE(index->GetCandidates(*graph, *relu_pass.GetPatterns()[0], candidates));
+  EXPECT_EQ(candidates.size(), 4U);
+}
+
+TEST_F(UTestFusionPatternIndex, run_passes_with_shared_index) {
+  auto graph = BuildGraph(4U);
+  auto conv_pass = std::make_shared<ConvAddReluPatternPass>();
+  auto relu_pass = std::make_shared<RemoveReluPass>();
+  auto index = std::make_shared<FusionPatternIndex>();
+  index->AddPatterns(conv_pass->GetPatterns());
+  index->AddPatterns(relu_pass->GetPatterns());
+  index->Build(*graph);
+  FusionPatternIndex::SetToGraph(*graph, index);
+  EXPECT_EQ(FusionPatternIndex::GetFromGraph(*graph), index);
+
+  EXPECT_EQ(conv_pass->Run(*graph), NOT_CHANGED);
+  EXPECT_EQ(conv_pass->fusion_times, 2U);
+  EXPECT_EQ(relu_pass->Run(*graph), SUCCESS);
+  EXPECT_EQ(graph->FindFirstNodeMatchType("Relu"), nullptr);
+
+  // relu删除后索引已在pass内更新，conv pass不再有候选
+  conv_pass->fusion_times = 0U;
+  EXPECT_EQ(conv_pass->Run(*graph), NOT_CHANGED);
+  EXPECT_EQ(conv_pass->fusion_times, 0U);
+  std::vector<NodePtr> candidates;
+  ASSERT_TRUE(index->GetCandidates(*graph, *conv_pass->GetPatterns()[0], candidates));
+  EXPECT_TRUE(candidates.empty());
+
+  FusionPatternIndex::SetToGraph(*graph, nullptr);
+  EXPECT_EQ(FusionPatternIndex::GetFromGraph(*graph), nullptr);
+}
+}  // namespace fe